@@ -0,0 +1,130 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+/// <summary>
+/// A bump allocator for the workspace of the routines, which take it
+/// as a work pointer sized by their WorkSize helper.
+///
+/// Take( count ) hands out the next count elements; a
+/// <see cref="Aux_Arena::Frame"/> gives back everything taken while it
+/// lived, so that nested calls stack their workspace on the same arena.
+/// </summary>
+/// <remarks>
+/// The arena holds one block, sized by Reserve or by the peak use
+/// seen so far. What does not fit is taken from blocks of its own,
+/// merged into the main one once the arena is empty again; so an arena
+/// reserved for the largest call, or one that has served it once, does
+/// not allocate any more. Pointers stay valid until their frame ends.
+/// An arena serves one thread; give each thread its own.
+/// </remarks>
+template< typename T_Scalar >
+class Aux_Arena
+{
+  std::vector< T_Scalar > _block;
+  std::vector< std::vector< T_Scalar > > _spills;
+
+  // Elements taken from _block, and from _block and _spills together
+  Size _top = 0;
+  Size _used = 0;
+  Size _peak = 0;
+
+public:
+
+  Aux_Arena() = default;
+
+  explicit Aux_Arena( Size capacity )
+  : _block( capacity )
+  {}
+
+  /// <summary>
+  /// Elements that can be taken without allocating.
+  /// </summary>
+  Size Capacity() const noexcept
+  { return this->_block.size(); }
+
+  /// <summary>
+  /// Elements taken and not given back.
+  /// </summary>
+  Size Used() const noexcept
+  { return this->_used; }
+
+  /// <summary>
+  /// The most elements ever taken at once.
+  /// </summary>
+  Size Peak() const noexcept
+  { return this->_peak; }
+
+  /// <summary>
+  /// Grows the capacity to at least count elements, at once if nothing
+  /// is taken, else once everything is given back.
+  /// </summary>
+  void Reserve( Size count )
+  {
+    this->_peak = Max( this->_peak, count );
+    if( ( 0 == this->_used ) && ( this->_block.size() < count ) )
+    { this->_block.resize( count ); }
+  }
+
+  /// <summary>
+  /// Takes count elements, uninitialized as far as the caller knows.
+  /// </summary>
+  T_Scalar *Take( Size count )
+  {
+    T_Scalar *p;
+    if( this->_top + count <= this->_block.size() )
+    {
+      p = this->_block.data() + this->_top;
+      this->_top += count;
+    }
+    else
+    {
+      this->_spills.emplace_back( count );
+      p = this->_spills.back().data();
+    }
+
+    this->_used += count;
+    this->_peak = Max( this->_peak, this->_used );
+    return p;
+  }
+
+  /// <summary>
+  /// Gives back everything taken since it was made, when it ends.
+  /// </summary>
+  class Frame
+  {
+    Aux_Arena &_arena;
+    Size _top, _used, _spills;
+
+  public:
+
+    explicit Frame( Aux_Arena &arena ) noexcept
+    : _arena{ arena }, _top{ arena._top }, _used{ arena._used }, _spills{ arena._spills.size() }
+    {}
+
+    Frame( const Frame & ) = delete;
+    Frame &operator=( const Frame & ) = delete;
+
+    ~Frame()
+    {
+      auto &a = this->_arena;
+      a._spills.resize( this->_spills );
+      a._top = this->_top;
+      a._used = this->_used;
+
+      // Empty again: fold what spilled into the main block
+      if( ( 0 == a._used ) && ( a._block.size() < a._peak ) )
+      { a._block.resize( a._peak ); }
+    }
+  };
+};
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
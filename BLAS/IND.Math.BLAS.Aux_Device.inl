@@ -0,0 +1,553 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+/// <summary>
+/// A compute device with its own memory, such as a GPU, to which the
+/// Level-3 routines are routed when their blocks are
+/// <see cref="Dev_Ptr"/>s of it. Its pointers are to its own memory,
+/// and its matrices are ColMajor:
+///
+///   Alloc( count ), Free( p )                 count elements of memory;
+///   Upload( m, n, A_, A_ld, B_, B_ld )        copies the host block A
+///                                             into the device block B;
+///   Download( m, n, A_, A_ld, B_, B_ld )      copies the device block A
+///                                             into the host block B;
+///   Copy( m, n, A_, A_ld, B_, B_ld )          copies on the device;
+///   Sync()                                    waits for all the work
+///                                             given to the device;
+///
+/// and the operations, with the arguments of the routines named:
+///
+///   MatMul         <see cref="Mat_MatMul"/>
+///   TriMatMul      <see cref="Tri_MatMul"/>
+///   TriSolvMat     <see cref="Tri_Solv_Mat"/>
+///   SymRank2kUpd   <see cref="Sym_Rank2kUpd"/>
+///   SymVecMul      <see cref="Sym_VecMul"/>
+///   MatAdd         <see cref="Mat_Add"/>, B += alpha*A only
+///   RowSwp         <see cref="Mat_RowSwp"/>, piv on the host
+///
+/// The operations may run asynchronously, in the order given; Upload
+/// and Download return once their data has arrived, so the host can
+/// work on the panels of a hybrid driver (e.g.
+/// <see cref="Mat_Fctr_LU_Dev"/>) while the device is still busy with
+/// the updates queued before.
+/// </summary>
+/// <remarks>
+/// <see cref="Dev_Host"/> is a device in host memory, on the
+/// routines of this library; with IND_MATH_CUDA defined,
+/// <see cref="Dev_Cuda"/> is one on CUDA and cuBLAS.
+/// </remarks>
+template< typename T_Device >
+concept Device = requires( T_Device &dev, Size m,
+  typename T_Device::Scalar *A_, const typename T_Device::Scalar *B_,
+  Stride ld, typename T_Device::Scalar u )
+{
+  { dev.Alloc( m ) } -> std::same_as< typename T_Device::Scalar * >;
+  dev.Free( A_ );
+  dev.Upload( m, m, B_, ld, A_, ld );
+  dev.Download( m, m, B_, ld, A_, ld );
+  dev.Copy( m, m, B_, ld, A_, ld );
+  dev.Sync();
+  dev.MatMul( Trnsp::No, Trnsp::No, m, m, m, u, B_, ld, B_, ld, u, A_, ld );
+  dev.TriSolvMat( Side::Left, Half::Lower, Trnsp::No, Diag::IsUnit, m, m, u, B_, ld, A_, ld );
+};
+
+/// <summary>
+/// A pointer into the memory of a <see cref="Device"/>, which routes
+/// the routines given it to that device. It only supports the offsets
+/// of ColMajor::BlkPtr; it cannot be dereferenced on the host.
+/// </summary>
+template< typename T_Device >
+struct Dev_Ptr
+{
+  using Scalar = typename T_Device::Scalar;
+
+  T_Device *device = nullptr;
+  Scalar *ptr = nullptr;
+
+  constexpr Dev_Ptr operator + ( Index i ) const noexcept
+  { return Dev_Ptr{ this->device, this->ptr + i }; }
+};
+
+/// <summary>
+/// count elements of the memory of a device, freed with the buffer.
+/// </summary>
+template< typename T_Device >
+requires( Device< T_Device > )
+class Dev_Buffer
+{
+  T_Device *_device;
+  typename T_Device::Scalar *_ptr;
+
+public:
+
+  Dev_Buffer( T_Device &device, Size count )
+  : _device{ &device }, _ptr{ device.Alloc( Max( count, (Size)1 ) ) }
+  {}
+
+  Dev_Buffer( const Dev_Buffer & ) = delete;
+  Dev_Buffer &operator=( const Dev_Buffer & ) = delete;
+
+  ~Dev_Buffer()
+  { this->_device->Free( this->_ptr ); }
+
+  Dev_Ptr< T_Device > Ptr() const noexcept
+  { return Dev_Ptr< T_Device >{ this->_device, this->_ptr }; }
+};
+
+/// <summary>
+/// A <see cref="Device"/> whose memory is the host's, running the
+/// operations synchronously on the routines of this library: the
+/// reference for a real one, and a way to run the hybrid drivers
+/// without one.
+/// </summary>
+template< typename T_Scalar >
+requires( ! isComplex< T_Scalar > )
+class Dev_Host
+{
+public:
+
+  using Scalar = T_Scalar;
+
+  T_Scalar *Alloc( Size count )
+  { return new T_Scalar[ count ]{}; }
+
+  void Free( T_Scalar *p ) noexcept
+  { delete[] p; }
+
+  void Upload( Size m, Size n, const T_Scalar *A_, Stride A_ld, T_Scalar *B_, Stride B_ld )
+  { Mat_Copy< ColMajor, ColMajor >( m, n, A_, A_ld, B_, B_ld ); }
+
+  void Download( Size m, Size n, const T_Scalar *A_, Stride A_ld, T_Scalar *B_, Stride B_ld )
+  { Mat_Copy< ColMajor, ColMajor >( m, n, A_, A_ld, B_, B_ld ); }
+
+  void Copy( Size m, Size n, const T_Scalar *A_, Stride A_ld, T_Scalar *B_, Stride B_ld )
+  { Mat_Copy< ColMajor, ColMajor >( m, n, A_, A_ld, B_, B_ld ); }
+
+  void Sync() noexcept
+  {}
+
+  void MatMul( Trnsp A_trnsp, Trnsp B_trnsp, Size m, Size n, Size k,
+    const T_Scalar &alpha, const T_Scalar *A_, Stride A_ld, const T_Scalar *B_, Stride B_ld,
+    const T_Scalar &beta, T_Scalar *C_, Stride C_ld )
+  { Mat_MatMul< ColMajor >( A_trnsp, B_trnsp, m, n, k, alpha, A_, A_ld, B_, B_ld, beta, C_, C_ld ); }
+
+  void TriMatMul( Side side, Half half, Trnsp A_trnsp, Diag diag, Size m, Size n,
+    const T_Scalar &alpha, const T_Scalar *A_, Stride A_ld, T_Scalar *B_, Stride B_ld )
+  { Tri_MatMul< ColMajor >( side, half, A_trnsp, diag, m, n, alpha, A_, A_ld, B_, B_ld ); }
+
+  void TriSolvMat( Side side, Half half, Trnsp A_trnsp, Diag diag, Size m, Size n,
+    const T_Scalar &alpha, const T_Scalar *A_, Stride A_ld, T_Scalar *B_, Stride B_ld )
+  { Tri_Solv_Mat_Rec< ColMajor >( side, half, A_trnsp, diag, m, n, alpha, A_, A_ld, B_, B_ld ); }
+
+  void SymRank2kUpd( Half half, Trnsp AB_trnsp, Size n, Size k,
+    const T_Scalar &alpha, const T_Scalar *A_, Stride A_ld, const T_Scalar *B_, Stride B_ld,
+    const T_Scalar &beta, T_Scalar *C_, Stride C_ld )
+  { Sym_Rank2kUpd< ColMajor >( half, AB_trnsp, n, k, alpha, A_, A_ld, B_, B_ld, beta, C_, C_ld ); }
+
+  void SymVecMul( Half half, Size n,
+    const T_Scalar &alpha, const T_Scalar *A_, Stride A_ld, const T_Scalar *x_, Stride x_s,
+    const T_Scalar &beta, T_Scalar *y_, Stride y_s )
+  { Sym_VecMul< ColMajor >( half, n, alpha, A_, A_ld, x_, x_s, beta, y_, y_s ); }
+
+  void MatAdd( Size m, Size n,
+    const T_Scalar &alpha, const T_Scalar *A_, Stride A_ld, T_Scalar *B_, Stride B_ld )
+  { Mat_Add< ColMajor >( Trnsp::No, m, n, alpha, A_, A_ld, B_, B_ld ); }
+
+  template< typename T_Arr_piv >
+  void RowSwp( Size n, T_Scalar *A_, Stride A_ld, Index k0, Index k1, T_Arr_piv piv_ )
+  { Mat_RowSwp< ColMajor >( n, A_, A_ld, k0, k1, piv_ ); }
+};
+
+#if defined( IND_MATH_CUDA )
+
+/// <summary>
+/// A <see cref="Device"/> on a CUDA GPU, with the operations on
+/// cuBLAS, all queued on one stream of its own.
+/// </summary>
+/// <remarks>
+/// Compiled in by defining IND_MATH_CUDA, and linking cudart and
+/// cublas. Throws <see cref="InternalError"/> on any CUDA or cuBLAS
+/// error. Upload and Download go through pageable memory unless the
+/// host blocks were pinned by the caller (cudaHostRegister).
+/// </remarks>
+template< typename T_Scalar >
+requires( areTheSame< T_Scalar, float > || areTheSame< T_Scalar, double > )
+class Dev_Cuda
+{
+  cudaStream_t _stream = nullptr;
+  cublasHandle_t _handle = nullptr;
+
+  static void _Check( cudaError_t status, const char *what )
+  {
+    if( cudaSuccess != status )
+    { throw InternalError{ std::string{ "Dev_Cuda: " } + what + ": " + cudaGetErrorString( status ) }; }
+  }
+
+  static void _Check( cublasStatus_t status, const char *what )
+  {
+    if( CUBLAS_STATUS_SUCCESS != status )
+    { throw InternalError{ std::string{ "Dev_Cuda: " } + what + " failed" }; }
+  }
+
+  static cublasOperation_t _Op( Trnsp trnsp ) noexcept
+  { return ( Trnsp::No == trnsp ) ? CUBLAS_OP_N : CUBLAS_OP_T; }
+  static cublasFillMode_t _Fill( Half half ) noexcept
+  { return ( Half::Lower == half ) ? CUBLAS_FILL_MODE_LOWER : CUBLAS_FILL_MODE_UPPER; }
+  static cublasSideMode_t _Side( Side side ) noexcept
+  { return ( Side::Left == side ) ? CUBLAS_SIDE_LEFT : CUBLAS_SIDE_RIGHT; }
+  static cublasDiagType_t _Diag( Diag diag ) noexcept
+  { return ( Diag::IsUnit == diag ) ? CUBLAS_DIAG_UNIT : CUBLAS_DIAG_NON_UNIT; }
+
+  void _Memcpy( Size m, Size n, const T_Scalar *A_, Stride A_ld, T_Scalar *B_, Stride B_ld,
+    cudaMemcpyKind kind, bool sync )
+  {
+    if( ( 0 == m ) || ( 0 == n ) ){ return; }
+    _Check( cudaMemcpy2DAsync( B_, B_ld*sizeof( T_Scalar ), A_, A_ld*sizeof( T_Scalar ),
+      m*sizeof( T_Scalar ), n, kind, this->_stream ), "cudaMemcpy2DAsync" );
+    if( sync ){ this->Sync(); }
+  }
+
+public:
+
+  using Scalar = T_Scalar;
+
+  /// <summary>
+  /// Makes the stream and the cuBLAS handle on the given device.
+  /// </summary>
+  explicit Dev_Cuda( int device = 0 )
+  {
+    _Check( cudaSetDevice( device ), "cudaSetDevice" );
+    _Check( cudaStreamCreate( &this->_stream ), "cudaStreamCreate" );
+    _Check( cublasCreate( &this->_handle ), "cublasCreate" );
+    _Check( cublasSetStream( this->_handle, this->_stream ), "cublasSetStream" );
+  }
+
+  Dev_Cuda( const Dev_Cuda & ) = delete;
+  Dev_Cuda &operator=( const Dev_Cuda & ) = delete;
+
+  ~Dev_Cuda()
+  {
+    cublasDestroy( this->_handle );
+    cudaStreamDestroy( this->_stream );
+  }
+
+  T_Scalar *Alloc( Size count )
+  {
+    void *p = nullptr;
+    _Check( cudaMalloc( &p, count*sizeof( T_Scalar ) ), "cudaMalloc" );
+    return (T_Scalar *)p;
+  }
+
+  void Free( T_Scalar *p ) noexcept
+  { cudaFree( p ); }
+
+  void Upload( Size m, Size n, const T_Scalar *A_, Stride A_ld, T_Scalar *B_, Stride B_ld )
+  { this->_Memcpy( m, n, A_, A_ld, B_, B_ld, cudaMemcpyHostToDevice, true ); }
+
+  void Download( Size m, Size n, const T_Scalar *A_, Stride A_ld, T_Scalar *B_, Stride B_ld )
+  { this->_Memcpy( m, n, A_, A_ld, B_, B_ld, cudaMemcpyDeviceToHost, true ); }
+
+  void Copy( Size m, Size n, const T_Scalar *A_, Stride A_ld, T_Scalar *B_, Stride B_ld )
+  { this->_Memcpy( m, n, A_, A_ld, B_, B_ld, cudaMemcpyDeviceToDevice, false ); }
+
+  void Sync()
+  { _Check( cudaStreamSynchronize( this->_stream ), "cudaStreamSynchronize" ); }
+
+  void MatMul( Trnsp A_trnsp, Trnsp B_trnsp, Size m, Size n, Size k,
+    const T_Scalar &alpha, const T_Scalar *A_, Stride A_ld, const T_Scalar *B_, Stride B_ld,
+    const T_Scalar &beta, T_Scalar *C_, Stride C_ld )
+  {
+    if constexpr( areTheSame< T_Scalar, double > )
+    {
+      _Check( cublasDgemm( this->_handle, _Op( A_trnsp ), _Op( B_trnsp ), (int)m, (int)n, (int)k,
+        &alpha, A_, (int)A_ld, B_, (int)B_ld, &beta, C_, (int)C_ld ), "cublasDgemm" );
+    }
+    else
+    {
+      _Check( cublasSgemm( this->_handle, _Op( A_trnsp ), _Op( B_trnsp ), (int)m, (int)n, (int)k,
+        &alpha, A_, (int)A_ld, B_, (int)B_ld, &beta, C_, (int)C_ld ), "cublasSgemm" );
+    }
+  }
+
+  void TriMatMul( Side side, Half half, Trnsp A_trnsp, Diag diag, Size m, Size n,
+    const T_Scalar &alpha, const T_Scalar *A_, Stride A_ld, T_Scalar *B_, Stride B_ld )
+  {
+    if constexpr( areTheSame< T_Scalar, double > )
+    {
+      _Check( cublasDtrmm( this->_handle, _Side( side ), _Fill( half ), _Op( A_trnsp ), _Diag( diag ),
+        (int)m, (int)n, &alpha, A_, (int)A_ld, B_, (int)B_ld, B_, (int)B_ld ), "cublasDtrmm" );
+    }
+    else
+    {
+      _Check( cublasStrmm( this->_handle, _Side( side ), _Fill( half ), _Op( A_trnsp ), _Diag( diag ),
+        (int)m, (int)n, &alpha, A_, (int)A_ld, B_, (int)B_ld, B_, (int)B_ld ), "cublasStrmm" );
+    }
+  }
+
+  void TriSolvMat( Side side, Half half, Trnsp A_trnsp, Diag diag, Size m, Size n,
+    const T_Scalar &alpha, const T_Scalar *A_, Stride A_ld, T_Scalar *B_, Stride B_ld )
+  {
+    if constexpr( areTheSame< T_Scalar, double > )
+    {
+      _Check( cublasDtrsm( this->_handle, _Side( side ), _Fill( half ), _Op( A_trnsp ), _Diag( diag ),
+        (int)m, (int)n, &alpha, A_, (int)A_ld, B_, (int)B_ld ), "cublasDtrsm" );
+    }
+    else
+    {
+      _Check( cublasStrsm( this->_handle, _Side( side ), _Fill( half ), _Op( A_trnsp ), _Diag( diag ),
+        (int)m, (int)n, &alpha, A_, (int)A_ld, B_, (int)B_ld ), "cublasStrsm" );
+    }
+  }
+
+  void SymRank2kUpd( Half half, Trnsp AB_trnsp, Size n, Size k,
+    const T_Scalar &alpha, const T_Scalar *A_, Stride A_ld, const T_Scalar *B_, Stride B_ld,
+    const T_Scalar &beta, T_Scalar *C_, Stride C_ld )
+  {
+    if constexpr( areTheSame< T_Scalar, double > )
+    {
+      _Check( cublasDsyr2k( this->_handle, _Fill( half ), _Op( AB_trnsp ), (int)n, (int)k,
+        &alpha, A_, (int)A_ld, B_, (int)B_ld, &beta, C_, (int)C_ld ), "cublasDsyr2k" );
+    }
+    else
+    {
+      _Check( cublasSsyr2k( this->_handle, _Fill( half ), _Op( AB_trnsp ), (int)n, (int)k,
+        &alpha, A_, (int)A_ld, B_, (int)B_ld, &beta, C_, (int)C_ld ), "cublasSsyr2k" );
+    }
+  }
+
+  void SymVecMul( Half half, Size n,
+    const T_Scalar &alpha, const T_Scalar *A_, Stride A_ld, const T_Scalar *x_, Stride x_s,
+    const T_Scalar &beta, T_Scalar *y_, Stride y_s )
+  {
+    if constexpr( areTheSame< T_Scalar, double > )
+    {
+      _Check( cublasDsymv( this->_handle, _Fill( half ), (int)n,
+        &alpha, A_, (int)A_ld, x_, (int)x_s, &beta, y_, (int)y_s ), "cublasDsymv" );
+    }
+    else
+    {
+      _Check( cublasSsymv( this->_handle, _Fill( half ), (int)n,
+        &alpha, A_, (int)A_ld, x_, (int)x_s, &beta, y_, (int)y_s ), "cublasSsymv" );
+    }
+  }
+
+  void MatAdd( Size m, Size n,
+    const T_Scalar &alpha, const T_Scalar *A_, Stride A_ld, T_Scalar *B_, Stride B_ld )
+  {
+    const T_Scalar one = unit< T_Scalar >;
+    if constexpr( areTheSame< T_Scalar, double > )
+    {
+      _Check( cublasDgeam( this->_handle, CUBLAS_OP_N, CUBLAS_OP_N, (int)m, (int)n,
+        &alpha, A_, (int)A_ld, &one, B_, (int)B_ld, B_, (int)B_ld ), "cublasDgeam" );
+    }
+    else
+    {
+      _Check( cublasSgeam( this->_handle, CUBLAS_OP_N, CUBLAS_OP_N, (int)m, (int)n,
+        &alpha, A_, (int)A_ld, &one, B_, (int)B_ld, B_, (int)B_ld ), "cublasSgeam" );
+    }
+  }
+
+  // One swap of whole rows per pivot, as cuBLAS has no xlaswp
+  template< typename T_Arr_piv >
+  void RowSwp( Size n, T_Scalar *A_, Stride A_ld, Index k0, Index k1, T_Arr_piv piv_ )
+  {
+    for( Index i = k0; i <= k1; ++i )
+    {
+      if( (Index)piv_[i] == i ){ continue; }
+      if constexpr( areTheSame< T_Scalar, double > )
+      {
+        _Check( cublasDswap( this->_handle, (int)n,
+          A_ + i, (int)A_ld, A_ + piv_[i], (int)A_ld ), "cublasDswap" );
+      }
+      else
+      {
+        _Check( cublasSswap( this->_handle, (int)n,
+          A_ + i, (int)A_ld, A_ + piv_[i], (int)A_ld ), "cublasSswap" );
+      }
+    }
+  }
+};
+
+#endif
+
+//----------------------------------------------------------------
+// The routines on device blocks, all ColMajor, routed to the device
+// of the output block; the blocks must all be of the same device.
+//----------------------------------------------------------------
+
+/// <summary>
+/// Uploads the m by n host block A into the device block B.
+/// </summary>
+template< typename Lyt_A,
+  typename Lyt_B,
+  typename T_Device >
+requires( Device< T_Device > && isColMajor< Lyt_A > && isColMajor< Lyt_B > )
+void Mat_Copy(
+  Size m, Size n,
+  const typename T_Device::Scalar *A_, Stride A_ld,
+  Dev_Ptr< T_Device > B_, Stride B_ld )
+{ B_.device->Upload( m, n, A_, A_ld, B_.ptr, B_ld ); }
+
+/// <summary>
+/// Downloads the m by n device block A into the host block B.
+/// </summary>
+template< typename Lyt_A,
+  typename Lyt_B,
+  typename T_Device >
+requires( Device< T_Device > && isColMajor< Lyt_A > && isColMajor< Lyt_B > )
+void Mat_Copy(
+  Size m, Size n,
+  Dev_Ptr< T_Device > A_, Stride A_ld,
+  typename T_Device::Scalar *B_, Stride B_ld )
+{ A_.device->Download( m, n, A_.ptr, A_ld, B_, B_ld ); }
+
+/// <summary>
+/// Copies the m by n device block A into the device block B.
+/// </summary>
+template< typename Lyt_A,
+  typename Lyt_B,
+  typename T_Device >
+requires( Device< T_Device > && isColMajor< Lyt_A > && isColMajor< Lyt_B > )
+void Mat_Copy(
+  Size m, Size n,
+  Dev_Ptr< T_Device > A_, Stride A_ld,
+  Dev_Ptr< T_Device > B_, Stride B_ld )
+{ B_.device->Copy( m, n, A_.ptr, A_ld, B_.ptr, B_ld ); }
+
+/// <summary>
+/// <see cref="Mat_MatMul"/> on the device.
+/// </summary>
+template< typename Lyt = ColMajor,
+  typename T_Device >
+requires( Device< T_Device > && isColMajor< Lyt > )
+void Mat_MatMul(
+  Trnsp A_trnsp, Trnsp B_trnsp,
+  Size m, Size n, Size k,
+  const typename T_Device::Scalar &alpha,
+  Dev_Ptr< T_Device > A_, Stride A_ld,
+  Dev_Ptr< T_Device > B_, Stride B_ld,
+  const typename T_Device::Scalar &beta,
+  Dev_Ptr< T_Device > C_, Stride C_ld )
+{
+  if( ( 0 == m ) || ( 0 == n ) ){ return; }
+  C_.device->MatMul( A_trnsp, B_trnsp, m, n, k, alpha, A_.ptr, A_ld, B_.ptr, B_ld, beta, C_.ptr, C_ld );
+}
+
+/// <summary>
+/// <see cref="Tri_MatMul"/> on the device.
+/// </summary>
+template< typename Lyt = ColMajor,
+  typename T_Device >
+requires( Device< T_Device > && isColMajor< Lyt > )
+void Tri_MatMul(
+  Side side, Half half, Trnsp A_trnsp, Diag diag,
+  Size m, Size n,
+  const typename T_Device::Scalar &alpha,
+  Dev_Ptr< T_Device > A_, Stride A_ld,
+  Dev_Ptr< T_Device > B_, Stride B_ld )
+{
+  if( ( 0 == m ) || ( 0 == n ) ){ return; }
+  B_.device->TriMatMul( side, half, A_trnsp, diag, m, n, alpha, A_.ptr, A_ld, B_.ptr, B_ld );
+}
+
+/// <summary>
+/// <see cref="Tri_Solv_Mat"/> on the device.
+/// </summary>
+template< typename Lyt = ColMajor,
+  typename T_Device >
+requires( Device< T_Device > && isColMajor< Lyt > )
+void Tri_Solv_Mat(
+  Side side, Half half, Trnsp A_trnsp, Diag diag,
+  Size m, Size n,
+  const typename T_Device::Scalar &alpha,
+  Dev_Ptr< T_Device > A_, Stride A_ld,
+  Dev_Ptr< T_Device > B_, Stride B_ld )
+{
+  if( ( 0 == m ) || ( 0 == n ) ){ return; }
+  B_.device->TriSolvMat( side, half, A_trnsp, diag, m, n, alpha, A_.ptr, A_ld, B_.ptr, B_ld );
+}
+
+/// <summary>
+/// <see cref="Sym_Rank2kUpd"/> on the device.
+/// </summary>
+template< typename Lyt = ColMajor,
+  typename T_Device >
+requires( Device< T_Device > && isColMajor< Lyt > )
+void Sym_Rank2kUpd(
+  Half half, Trnsp AB_trnsp,
+  Size n, Size k,
+  const typename T_Device::Scalar &alpha,
+  Dev_Ptr< T_Device > A_, Stride A_ld,
+  Dev_Ptr< T_Device > B_, Stride B_ld,
+  const typename T_Device::Scalar &beta,
+  Dev_Ptr< T_Device > C_, Stride C_ld )
+{
+  if( 0 == n ){ return; }
+  C_.device->SymRank2kUpd( half, AB_trnsp, n, k, alpha, A_.ptr, A_ld, B_.ptr, B_ld, beta, C_.ptr, C_ld );
+}
+
+/// <summary>
+/// <see cref="Sym_VecMul"/> on the device.
+/// </summary>
+template< typename Lyt = ColMajor,
+  typename T_Device >
+requires( Device< T_Device > && isColMajor< Lyt > )
+void Sym_VecMul( Half half,
+  Size n,
+  const typename T_Device::Scalar &alpha,
+  Dev_Ptr< T_Device > A_, Stride A_ld,
+  Dev_Ptr< T_Device > x_, Stride x_s,
+  const typename T_Device::Scalar &beta,
+  Dev_Ptr< T_Device > y_, Stride y_s )
+{
+  if( 0 == n ){ return; }
+  y_.device->SymVecMul( half, n, alpha, A_.ptr, A_ld, x_.ptr, x_s, beta, y_.ptr, y_s );
+}
+
+/// <summary>
+/// <see cref="Mat_Add"/> on the device, B += alpha*A; A_trnsp must
+/// be Trnsp::No.
+/// </summary>
+template< typename Lyt = ColMajor,
+  typename T_Device >
+requires( Device< T_Device > && isColMajor< Lyt > )
+void Mat_Add( Trnsp A_trnsp,
+  Size m, Size n,
+  const typename T_Device::Scalar &alpha,
+  Dev_Ptr< T_Device > A_, Stride A_ld,
+  Dev_Ptr< T_Device > B_, Stride B_ld )
+{
+  if( Trnsp::No != A_trnsp ){ throw BadArgument{ "Mat_Add", 1 }; }
+  if( ( 0 == m ) || ( 0 == n ) ){ return; }
+  B_.device->MatAdd( m, n, alpha, A_.ptr, A_ld, B_.ptr, B_ld );
+}
+
+/// <summary>
+/// <see cref="Mat_RowSwp"/> on the device, with piv on the host.
+/// </summary>
+template< typename Lyt = ColMajor,
+  typename T_Device,
+  typename T_Arr_piv >
+requires( Device< T_Device > && isColMajor< Lyt >
+         && isNativeSignedIntegral< Decay<DerefTypeOf<T_Arr_piv>> > )
+void Mat_RowSwp(
+  Size n,
+  Dev_Ptr< T_Device > A_, Stride A_ld,
+  Index k0, Index k1,
+  T_Arr_piv piv_ )
+{
+  if( ( 0 == n ) || ( k1 < k0 ) ){ return; }
+  A_.device->RowSwp( n, A_.ptr, A_ld, k0, k1, piv_ );
+}
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
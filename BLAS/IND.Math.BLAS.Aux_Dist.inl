@@ -0,0 +1,447 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+/// <summary>
+/// The processes of a <see cref="Dst_Grid"/> that take part in one of
+/// its collective operations: those of the caller's process row, which
+/// are numbered by their process column, or those of its process
+/// column, numbered by their process row.
+/// </summary>
+enum class Dst_Scope
+{
+  Row,
+  Col
+};
+
+/// <summary>
+/// A P by Q grid of processes, over which the matrices of the
+/// distributed drivers (e.g. <see cref="Mat_Fctr_LU_Dst"/>) are laid
+/// out by <see cref="Dst_Matrix"/>. Each process calls the same
+/// operations, in the same order as the others of the scope:
+///
+///   Rows(), Cols()                      P and Q;
+///   Row(), Col()                        the caller's place on the grid;
+///   Bcast( scope, root, x_, count )     copies x from root to all;
+///   IBcast( scope, root, x_, count )    starts Bcast and returns a
+///                                       Request, for Wait( request );
+///   Sum( scope, x_, count )             x := the sum of all the x;
+///   AllGather( scope, x_, count, y_ )   y := the x of all, in order;
+///   Exchange( scope, peer, x_, count )  swaps x with that of peer;
+///   Send( row, col, x_, count )         point to point, to and from
+///   Recv( row, col, x_, count )         any process of the grid;
+///
+/// where x_ points to count elements of a trivially copyable type,
+/// summed only if it is float or double.
+/// </summary>
+/// <remarks>
+/// <see cref="Dst_Grid_Self"/> is the 1 by 1 grid of a single process;
+/// with IND_MATH_MPI defined, <see cref="Dst_Grid_MPI"/> is one over an
+/// MPI communicator.
+/// </remarks>
+template< typename T_Grid >
+concept Dst_Grid = requires( T_Grid &grid, typename T_Grid::Request &request,
+  Dst_Scope scope, Index i, double *x_, Size count )
+{
+  { grid.Rows() } -> std::same_as< Size >;
+  { grid.Cols() } -> std::same_as< Size >;
+  { grid.Row() } -> std::same_as< Index >;
+  { grid.Col() } -> std::same_as< Index >;
+  grid.Bcast( scope, i, x_, count );
+  { grid.IBcast( scope, i, x_, count ) } -> std::same_as< typename T_Grid::Request >;
+  grid.Wait( request );
+  grid.Sum( scope, x_, count );
+  grid.AllGather( scope, x_, count, x_ );
+  grid.Exchange( scope, i, x_, count );
+  grid.Send( i, i, x_, count );
+  grid.Recv( i, i, x_, count );
+};
+
+/// <summary>
+/// The number of the indices 0:n-1, dealt in blocks of nb to P
+/// processes in turn, that process p holds (ScaLAPACK <c>numroc</c>).
+/// It is also the local index of the first of them at or after n.
+/// </summary>
+inline constexpr Size Dst_LocSize( Size n, Size nb, Index p, Size P ) noexcept
+{
+  const Size blocks = n/nb;
+  const Size extra = blocks%P;
+
+  Size size = ( blocks/P )*nb;
+  if( (Size)p < extra ){ size += nb; }
+  else if( (Size)p == extra ){ size += n%nb; }
+  return size;
+}
+
+/// <summary>
+/// The process that holds index i, dealt as in <see cref="Dst_LocSize"/>.
+/// </summary>
+inline constexpr Index Dst_Owner( Index i, Size nb, Size P ) noexcept
+{ return (Index)( ( (Size)i/nb )%P ); }
+
+/// <summary>
+/// The local index of index i, on the process that holds it.
+/// </summary>
+inline constexpr Index Dst_LocIdx( Index i, Size nb, Size P ) noexcept
+{ return (Index)( ( (Size)i/nb/P )*nb + (Size)i%nb ); }
+
+/// <summary>
+/// The index of local index l of process p.
+/// </summary>
+inline constexpr Index Dst_GlbIdx( Index l, Size nb, Index p, Size P ) noexcept
+{ return (Index)( ( ( (Size)l/nb )*P + (Size)p )*nb + (Size)l%nb ); }
+
+/// <summary>
+/// An m by n matrix laid out 2-D block-cyclically on a
+/// <see cref="Dst_Grid"/>, in nb by nb blocks: block (I,J) is held by
+/// process ( I mod P, J mod Q ), which stores its blocks ColMajor, in
+/// the order of I and J, as the local matrix loc with leading
+/// dimension ld, of LocRows() by LocCols().
+/// </summary>
+/// <remarks>
+/// As a ScaLAPACK descriptor with mb = nb and the first block on
+/// process (0,0). Each process has its own, with its own loc.
+/// </remarks>
+template< typename T_Grid, typename T_Scalar >
+requires( Dst_Grid< T_Grid > )
+struct Dst_Matrix
+{
+  using Scalar = T_Scalar;
+
+  T_Grid *grid = nullptr;
+  Size m = 0;
+  Size n = 0;
+  Size nb = 0;
+  T_Scalar *loc = nullptr;
+  Stride ld = 0;
+
+  Size LocRows() const noexcept
+  { return Dst_LocSize( this->m, this->nb, this->grid->Row(), this->grid->Rows() ); }
+
+  Size LocCols() const noexcept
+  { return Dst_LocSize( this->n, this->nb, this->grid->Col(), this->grid->Cols() ); }
+};
+
+/// <summary>
+/// The 1 by 1 <see cref="Dst_Grid"/> of the calling process alone, on
+/// which the distributed drivers do the work of their local ones.
+/// </summary>
+class Dst_Grid_Self
+{
+public:
+
+  struct Request
+  {};
+
+  Size Rows() const noexcept { return 1; }
+  Size Cols() const noexcept { return 1; }
+  Index Row() const noexcept { return 0; }
+  Index Col() const noexcept { return 0; }
+
+  template< typename T >
+  void Bcast( Dst_Scope, Index, T *, Size ) noexcept
+  {}
+
+  template< typename T >
+  Request IBcast( Dst_Scope, Index, T *, Size ) noexcept
+  { return {}; }
+
+  void Wait( Request & ) noexcept
+  {}
+
+  template< typename T >
+  void Sum( Dst_Scope, T *, Size ) noexcept
+  {}
+
+  template< typename T >
+  void AllGather( Dst_Scope, const T *x_, Size count, T *y_ )
+  { std::copy( x_, x_ + count, y_ ); }
+
+  template< typename T >
+  void Exchange( Dst_Scope, Index, T *, Size ) noexcept
+  {}
+
+  template< typename T >
+  void Send( Index, Index, const T *, Size )
+  { throw InternalError{ "Dst_Grid_Self: no other process to send to" }; }
+
+  template< typename T >
+  void Recv( Index, Index, T *, Size )
+  { throw InternalError{ "Dst_Grid_Self: no other process to receive from" }; }
+};
+
+#if defined( IND_MATH_MPI )
+
+/// <summary>
+/// A <see cref="Dst_Grid"/> over the processes of an MPI communicator,
+/// rows by cols of them, numbered in row major order of the grid.
+/// </summary>
+/// <remarks>
+/// Compiled in by defining IND_MATH_MPI, and linking MPI (3.0 or later,
+/// for IBcast). MPI must stay initialized for the lifetime of the grid.
+/// Throws <see cref="InternalError"/> on any MPI error that returns.
+/// </remarks>
+class Dst_Grid_MPI
+{
+  MPI_Comm _comm = MPI_COMM_NULL;
+  MPI_Comm _row = MPI_COMM_NULL;
+  MPI_Comm _col = MPI_COMM_NULL;
+  Size _rows = 0;
+  Size _cols = 0;
+  Index _myRow = 0;
+  Index _myCol = 0;
+
+  static void _Check( int status, const char *what )
+  {
+    if( MPI_SUCCESS != status )
+    { throw InternalError{ std::string{ "Dst_Grid_MPI: " } + what + " failed" }; }
+  }
+
+  static int _Count( Size count )
+  {
+    if( count > (Size)std::numeric_limits< int >::max() )
+    { throw InternalError{ "Dst_Grid_MPI: message too long" }; }
+    return (int)count;
+  }
+
+  // Contiguous bytes of one T, committed once
+  template< typename T >
+  static MPI_Datatype _Type()
+  {
+    static const MPI_Datatype type = []
+    {
+      MPI_Datatype t;
+      _Check( MPI_Type_contiguous( (int)sizeof( T ), MPI_BYTE, &t ), "MPI_Type_contiguous" );
+      _Check( MPI_Type_commit( &t ), "MPI_Type_commit" );
+      return t;
+    }();
+    return type;
+  }
+
+  MPI_Comm _Comm( Dst_Scope scope ) const noexcept
+  { return ( Dst_Scope::Row == scope ) ? this->_row : this->_col; }
+
+  int _Rank( Index row, Index col ) const noexcept
+  { return (int)( (Size)row*this->_cols + (Size)col ); }
+
+public:
+
+  using Request = MPI_Request;
+
+  Dst_Grid_MPI( MPI_Comm comm, Size rows, Size cols )
+  : _comm{ comm }, _rows{ rows }, _cols{ cols }
+  {
+    int size = 0, rank = 0;
+    _Check( MPI_Comm_size( comm, &size ), "MPI_Comm_size" );
+    _Check( MPI_Comm_rank( comm, &rank ), "MPI_Comm_rank" );
+    if( ( 0 == rows ) || ( 0 == cols ) || ( rows*cols != (Size)size ) )
+    { throw BadArgument{ "Dst_Grid_MPI", 2 }; }
+
+    this->_myRow = (Index)( (Size)rank/cols );
+    this->_myCol = (Index)( (Size)rank%cols );
+    _Check( MPI_Comm_split( comm, (int)this->_myRow, (int)this->_myCol, &this->_row ), "MPI_Comm_split" );
+    _Check( MPI_Comm_split( comm, (int)this->_myCol, (int)this->_myRow, &this->_col ), "MPI_Comm_split" );
+  }
+
+  Dst_Grid_MPI( const Dst_Grid_MPI & ) = delete;
+  Dst_Grid_MPI &operator=( const Dst_Grid_MPI & ) = delete;
+
+  ~Dst_Grid_MPI()
+  {
+    MPI_Comm_free( &this->_row );
+    MPI_Comm_free( &this->_col );
+  }
+
+  Size Rows() const noexcept { return this->_rows; }
+  Size Cols() const noexcept { return this->_cols; }
+  Index Row() const noexcept { return this->_myRow; }
+  Index Col() const noexcept { return this->_myCol; }
+
+  template< typename T >
+  void Bcast( Dst_Scope scope, Index root, T *x_, Size count )
+  { _Check( MPI_Bcast( x_, _Count( count ), _Type< T >(), (int)root, this->_Comm( scope ) ), "MPI_Bcast" ); }
+
+  template< typename T >
+  Request IBcast( Dst_Scope scope, Index root, T *x_, Size count )
+  {
+    Request request;
+    _Check( MPI_Ibcast( x_, _Count( count ), _Type< T >(), (int)root, this->_Comm( scope ), &request ), "MPI_Ibcast" );
+    return request;
+  }
+
+  void Wait( Request &request )
+  { _Check( MPI_Wait( &request, MPI_STATUS_IGNORE ), "MPI_Wait" ); }
+
+  template< typename T >
+  requires( areTheSame< T, float > || areTheSame< T, double > )
+  void Sum( Dst_Scope scope, T *x_, Size count )
+  {
+    const MPI_Datatype type = areTheSame< T, float > ? MPI_FLOAT : MPI_DOUBLE;
+    _Check( MPI_Allreduce( MPI_IN_PLACE, x_, _Count( count ), type, MPI_SUM, this->_Comm( scope ) ), "MPI_Allreduce" );
+  }
+
+  template< typename T >
+  void AllGather( Dst_Scope scope, const T *x_, Size count, T *y_ )
+  {
+    _Check( MPI_Allgather( x_, _Count( count ), _Type< T >(),
+      y_, _Count( count ), _Type< T >(), this->_Comm( scope ) ), "MPI_Allgather" );
+  }
+
+  template< typename T >
+  void Exchange( Dst_Scope scope, Index peer, T *x_, Size count )
+  {
+    _Check( MPI_Sendrecv_replace( x_, _Count( count ), _Type< T >(), (int)peer, 0, (int)peer, 0,
+      this->_Comm( scope ), MPI_STATUS_IGNORE ), "MPI_Sendrecv_replace" );
+  }
+
+  template< typename T >
+  void Send( Index row, Index col, const T *x_, Size count )
+  { _Check( MPI_Send( x_, _Count( count ), _Type< T >(), this->_Rank( row, col ), 0, this->_comm ), "MPI_Send" ); }
+
+  template< typename T >
+  void Recv( Index row, Index col, T *x_, Size count )
+  {
+    _Check( MPI_Recv( x_, _Count( count ), _Type< T >(), this->_Rank( row, col ), 0, this->_comm,
+      MPI_STATUS_IGNORE ), "MPI_Recv" );
+  }
+};
+
+#endif
+
+/// <summary>
+/// Deals the m by n matrix A, held by process ( root_row, root_col )
+/// only, out to the distributed matrix B of the same size.
+/// </summary>
+/// <remarks>
+/// Sends one block at a time; only A of the root is referenced.
+/// </remarks>
+template< typename T_Grid, typename T_Scalar >
+void Dst_Scatter( Index root_row, Index root_col,
+  const T_Scalar *A_, Stride A_ld,
+  const Dst_Matrix< T_Grid, T_Scalar > &B )
+{
+  T_Grid &grid = *B.grid;
+  const Size P = grid.Rows(), Q = grid.Cols(), nb = B.nb;
+  const bool isRoot = ( grid.Row() == root_row ) && ( grid.Col() == root_col );
+
+  std::vector< T_Scalar > blk( nb*nb );
+
+  for( Size j = 0; j < B.n; j += nb )
+  {
+    const Size jb = Min( nb, B.n-j );
+    const Index q = Dst_Owner( (Index)j, nb, Q );
+    for( Size i = 0; i < B.m; i += nb )
+    {
+      const Size ib = Min( nb, B.m-i );
+      const Index p = Dst_Owner( (Index)i, nb, P );
+      const bool isOwner = ( grid.Row() == p ) && ( grid.Col() == q );
+      T_Scalar *B_ij = isOwner
+        ? ColMajor::BlkPtr( B.loc, Dst_LocIdx( (Index)i, nb, P ), Dst_LocIdx( (Index)j, nb, Q ), B.ld )
+        : nullptr;
+
+      if( isRoot && isOwner )
+      { Mat_Copy< ColMajor, ColMajor >( ib, jb, ColMajor::BlkPtr( A_, i, j, A_ld ), A_ld, B_ij, B.ld ); }
+      else if( isRoot )
+      {
+        Mat_Copy< ColMajor, ColMajor >( ib, jb, ColMajor::BlkPtr( A_, i, j, A_ld ), A_ld, blk.data(), (Stride)ib );
+        grid.Send( p, q, blk.data(), ib*jb );
+      }
+      else if( isOwner )
+      {
+        grid.Recv( root_row, root_col, blk.data(), ib*jb );
+        Mat_Copy< ColMajor, ColMajor >( ib, jb, blk.data(), (Stride)ib, B_ij, B.ld );
+      }
+    }
+  }
+}
+
+/// <summary>
+/// Collects the distributed m by n matrix A into the matrix B of
+/// process ( root_row, root_col ); B of the others is not referenced.
+/// </summary>
+template< typename T_Grid, typename T_Scalar >
+void Dst_Gather( Index root_row, Index root_col,
+  const Dst_Matrix< T_Grid, T_Scalar > &A,
+  T_Scalar *B_, Stride B_ld )
+{
+  T_Grid &grid = *A.grid;
+  const Size P = grid.Rows(), Q = grid.Cols(), nb = A.nb;
+  const bool isRoot = ( grid.Row() == root_row ) && ( grid.Col() == root_col );
+
+  std::vector< T_Scalar > blk( nb*nb );
+
+  for( Size j = 0; j < A.n; j += nb )
+  {
+    const Size jb = Min( nb, A.n-j );
+    const Index q = Dst_Owner( (Index)j, nb, Q );
+    for( Size i = 0; i < A.m; i += nb )
+    {
+      const Size ib = Min( nb, A.m-i );
+      const Index p = Dst_Owner( (Index)i, nb, P );
+      const bool isOwner = ( grid.Row() == p ) && ( grid.Col() == q );
+      const T_Scalar *A_ij = isOwner
+        ? ColMajor::BlkPtr( A.loc, Dst_LocIdx( (Index)i, nb, P ), Dst_LocIdx( (Index)j, nb, Q ), A.ld )
+        : nullptr;
+
+      if( isRoot && isOwner )
+      { Mat_Copy< ColMajor, ColMajor >( ib, jb, A_ij, A.ld, ColMajor::BlkPtr( B_, i, j, B_ld ), B_ld ); }
+      else if( isRoot )
+      {
+        grid.Recv( p, q, blk.data(), ib*jb );
+        Mat_Copy< ColMajor, ColMajor >( ib, jb, blk.data(), (Stride)ib, ColMajor::BlkPtr( B_, i, j, B_ld ), B_ld );
+      }
+      else if( isOwner )
+      {
+        Mat_Copy< ColMajor, ColMajor >( ib, jb, A_ij, A.ld, blk.data(), (Stride)ib );
+        grid.Send( root_row, root_col, blk.data(), ib*jb );
+      }
+    }
+  }
+}
+
+namespace _n_Impl {
+
+  // Swaps global rows i1 and i2 of local columns c0:c0+nc-1 of A,
+  // through buf of nc elements when they are on different processes.
+  template< typename T_Grid, typename T_Scalar >
+  void _Dst_RowSwp( const Dst_Matrix< T_Grid, T_Scalar > &A,
+    Index i1, Index i2, Size c0, Size nc, T_Scalar *buf )
+  {
+    if( ( i1 == i2 ) || ( 0 == nc ) ){ return; }
+
+    T_Grid &grid = *A.grid;
+    const Size P = grid.Rows();
+    const Index p = grid.Row();
+    const Index p1 = Dst_Owner( i1, A.nb, P );
+    const Index p2 = Dst_Owner( i2, A.nb, P );
+
+    auto A_Row = [&]( Index i ) -> T_Scalar *
+    { return ColMajor::BlkPtr( A.loc, Dst_LocIdx( i, A.nb, P ), c0, A.ld ); };
+
+    if( p1 == p2 )
+    {
+      if( p != p1 ){ return; }
+      T_Scalar *r1 = A_Row( i1 ), *r2 = A_Row( i2 );
+      for( Size c = 0; c < nc; ++c )
+      { Swap( r1[c*A.ld], r2[c*A.ld] ); }
+    }
+    else if( ( p == p1 ) || ( p == p2 ) )
+    {
+      T_Scalar *r = A_Row( ( p == p1 ) ? i1 : i2 );
+      for( Size c = 0; c < nc; ++c ){ buf[c] = r[c*A.ld]; }
+      grid.Exchange( Dst_Scope::Col, ( p == p1 ) ? p2 : p1, buf, nc );
+      for( Size c = 0; c < nc; ++c ){ r[c*A.ld] = buf[c]; }
+    }
+  }
+
+}// namespace _n_Impl
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
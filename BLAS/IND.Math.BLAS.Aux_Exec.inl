@@ -0,0 +1,128 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+/// <summary>
+/// An execution context, the optional last argument of the parallel
+/// overloads of <see cref="Mat_MatMul"/>, <see cref="Tri_Solv_Mat"/>,
+/// <see cref="Mat_Fctr_LU"/> and the LAPACK drivers built on them.
+///
+///   ThreadCount()      threads the work may be split for, counting
+///                      the caller (a hint; 1 means run serially);
+///   Fork( count, f )   starts f( t ) for t in 0:count-1, and may
+///                      return before they are done;
+///   Join()             returns once every task of the last Fork is.
+///
+/// The tasks of a Fork are independent of each other, so a context
+/// may run them in any order, on any threads, or at once inside Fork;
+/// they never use the context themselves. A context serves one call
+/// at a time.
+/// </summary>
+/// <remarks>
+/// <see cref="Exec_Seq"/> is serial and usable in constant
+/// evaluation, <see cref="Exec_Par"/> keeps its own worker threads,
+/// and a job scheduler is plugged in by a type of its own with these
+/// three members, e.g. one whose Fork posts count jobs to the
+/// scheduler and whose Join waits on a counter.
+/// </remarks>
+template< typename T_Exec >
+concept ExecContext = requires( T_Exec &exec, Size count )
+{
+  { exec.ThreadCount() } -> std::convertible_to< Size >;
+  exec.Fork( count, []( Size ){} );
+  exec.Join();
+};
+
+/// <summary>
+/// The serial execution context: Fork runs the tasks in order on the
+/// calling thread.
+/// </summary>
+struct Exec_Seq
+{
+  constexpr Size ThreadCount() const noexcept
+  { return 1; }
+
+  template< typename T_Fn >
+  constexpr void Fork( Size count, T_Fn &&task ) const
+  {
+    for( Size t = 0; t < count; ++t ){ task( t ); }
+  }
+
+  constexpr void Join() const noexcept
+  {}
+};
+
+/// <summary>
+/// An execution context with its own team of worker threads, alive for
+/// the lifetime of the object; create one and pass it to many calls.
+/// </summary>
+class Exec_Par
+{
+  _n_Impl::_ThrdTeam _team;
+
+public:
+
+  /// <summary>
+  /// A team of threadCount threads, counting the caller;
+  /// 0 means one per hardware thread.
+  /// </summary>
+  explicit Exec_Par( Size threadCount = 0 )
+  : _team{ threadCount }
+  {}
+
+  Size ThreadCount() const noexcept
+  { return this->_team.ThreadCount(); }
+
+  void Fork( Size count, _n_Impl::_ThrdTeam::Task task )
+  { this->_team.Fork( count, std::move( task ) ); }
+
+  void Join()
+  { this->_team.Join(); }
+};
+
+/// <summary>
+/// Shortest range of rows or columns the parallel overloads hand to
+/// one task; smaller problems run on the caller.
+/// </summary>
+inline constexpr Size Exec_SplitMin = 64;
+
+namespace _n_Impl {
+
+  template< typename T_Exec >
+  inline constexpr bool _isExecSeq = areTheSame< Decay< T_Exec >, Exec_Seq >;
+
+  // Splits 0:count-1 into at most exec.ThreadCount() ranges of at
+  // least minLen, and runs fn( i0, len ) on each through exec; a
+  // single range runs on the caller.
+  template< typename T_Exec, typename T_Fn >
+  constexpr void _Exec_Split( T_Exec &exec, Size count, Size minLen, T_Fn &&fn )
+  {
+    minLen = Max( minLen, (Size)1 );
+    const Size tileCount = Max( Min( (Size)exec.ThreadCount(), count/minLen ), (Size)1 );
+
+    if( 1 == tileCount )
+    {
+      fn( (Index)0, count );
+      return;
+    }
+
+    const Size tileLen = ( count + tileCount-1 )/tileCount;
+    exec.Fork( tileCount, [&]( Size t )
+    {
+      const Size i0 = t*tileLen;
+      if( i0 < count ){ fn( (Index)i0, Min( tileLen, count-i0 ) ); }
+    } );
+    exec.Join();
+  }
+
+}// namespace _n_Impl
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
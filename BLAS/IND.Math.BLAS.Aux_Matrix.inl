@@ -0,0 +1,187 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+/// <summary>
+/// Alignment, in bytes, of the storage of a <see cref="Matrix"/>: one
+/// cache line, and the width of the widest vector registers.
+/// </summary>
+inline constexpr Size Mat_AlignBytes = 64;
+
+/// <summary>
+/// Leading dimension for count elements along the contiguous dimension
+/// of a matrix: count rounded up to a whole number of cache lines, and
+/// one line more where that would put consecutive columns (rows for
+/// RowMajor) a multiple of 512 bytes apart, whose elements would then
+/// fall in the same few cache sets.
+/// </summary>
+template< typename T_Scalar >
+inline constexpr Stride Mat_PaddedLd( Size count ) noexcept
+{
+  constexpr Size size = sizeof( T_Scalar );
+  if( 0 != Mat_AlignBytes % size ){ return (Stride)Max( count, (Size)1 ); }
+
+  constexpr Size line = Mat_AlignBytes/size;
+  Size ld = Max( ( count + line-1 )/line*line, line );
+  if( ( ld > line ) && ( 0 == ld*size % 512 ) ){ ld += line; }
+  return (Stride)ld;
+}
+
+/// <summary>
+/// A non-owning m by n block of a ColMajor or RowMajor matrix: its
+/// origin and leading dimension, as the routines take them through
+/// Ptr() and Ld(). Blk( i, j, m, n ) views a sub-block without copying.
+/// </summary>
+template< typename T_Scalar, typename Lyt = ColMajor >
+requires( isColMajor< Lyt > || isRowMajor< Lyt > )
+class MatView
+{
+  T_Scalar *_A = nullptr;
+  Size _m = 0, _n = 0;
+  Stride _ld = 1;
+
+public:
+
+  using Scalar = T_Scalar;
+  using Layout = Lyt;
+
+  constexpr MatView() noexcept = default;
+
+  constexpr MatView( T_Scalar *A_, Size m, Size n, Stride A_ld ) noexcept
+  : _A{ A_ }, _m{ m }, _n{ n }, _ld{ A_ld }
+  {}
+
+  // A view of non-const elements is a view of const ones too
+  template< typename T_Other >
+  requires( areTheSame< const T_Other, T_Scalar > && ! areTheSame< T_Other, T_Scalar > )
+  constexpr MatView( const MatView< T_Other, Lyt > &other ) noexcept
+  : _A{ other.Ptr() }, _m{ other.Rows() }, _n{ other.Cols() }, _ld{ other.Ld() }
+  {}
+
+  constexpr T_Scalar *Ptr() const noexcept
+  { return this->_A; }
+  constexpr Stride Ld() const noexcept
+  { return this->_ld; }
+  constexpr Size Rows() const noexcept
+  { return this->_m; }
+  constexpr Size Cols() const noexcept
+  { return this->_n; }
+
+  constexpr T_Scalar &operator()( Index i, Index j ) const noexcept
+  { return Lyt::MatRef( this->_A, i, j, this->_ld ); }
+
+  /// <summary>
+  /// The m by n block with origin (i,j).
+  /// </summary>
+  constexpr MatView Blk( Index i, Index j, Size m, Size n ) const noexcept
+  { return { Lyt::BlkPtr( this->_A, i, j, this->_ld ), m, n, this->_ld }; }
+};
+
+/// <summary>
+/// An m by n ColMajor or RowMajor matrix owning its storage, aligned to
+/// <see cref="Mat_AlignBytes"/> and with the leading dimension padded
+/// by <see cref="Mat_PaddedLd"/>, so that each column (row for
+/// RowMajor) starts on a cache line and power-of-two orders do not
+/// thrash the cache. The elements are value-initialized; the padding
+/// is never read by the routines.
+/// </summary>
+template< typename T_Scalar, typename Lyt = ColMajor >
+requires( ( isColMajor< Lyt > || isRowMajor< Lyt > )
+  && std::is_trivially_destructible_v< T_Scalar > )
+class Matrix
+{
+  struct _Free
+  {
+    void operator()( T_Scalar *p ) const noexcept
+    { ::operator delete( (void *)p, std::align_val_t{ Mat_AlignBytes } ); }
+  };
+
+  std::unique_ptr< T_Scalar, _Free > _A;
+  Size _m = 0, _n = 0;
+  Stride _ld = 1;
+
+  // Elements of the storage, padding included
+  Size _Count() const noexcept
+  { return (Size)this->_ld*( isColMajor< Lyt > ? this->_n : this->_m ); }
+
+  void _Allocate()
+  {
+    const Size count = this->_Count();
+    if( 0 == count ){ return; }
+
+    auto *p = (T_Scalar *)::operator new( count*sizeof( T_Scalar ), std::align_val_t{ Mat_AlignBytes } );
+    std::uninitialized_value_construct_n( p, count );
+    this->_A.reset( p );
+  }
+
+public:
+
+  using Scalar = T_Scalar;
+  using Layout = Lyt;
+
+  Matrix() noexcept = default;
+
+  Matrix( Size m, Size n )
+  : _m{ m }, _n{ n }, _ld{ Mat_PaddedLd< T_Scalar >( isColMajor< Lyt > ? m : n ) }
+  { this->_Allocate(); }
+
+  Matrix( const Matrix &other )
+  : _m{ other._m }, _n{ other._n }, _ld{ other._ld }
+  {
+    this->_Allocate();
+    std::copy_n( other._A.get(), this->_Count(), this->_A.get() );
+  }
+
+  Matrix &operator=( const Matrix &other )
+  {
+    if( this != &other ){ *this = Matrix{ other }; }
+    return *this;
+  }
+
+  Matrix( Matrix && ) noexcept = default;
+  Matrix &operator=( Matrix && ) noexcept = default;
+
+  T_Scalar *Ptr() noexcept
+  { return this->_A.get(); }
+  const T_Scalar *Ptr() const noexcept
+  { return this->_A.get(); }
+  Stride Ld() const noexcept
+  { return this->_ld; }
+  Size Rows() const noexcept
+  { return this->_m; }
+  Size Cols() const noexcept
+  { return this->_n; }
+
+  T_Scalar &operator()( Index i, Index j ) noexcept
+  { return Lyt::MatRef( this->Ptr(), i, j, this->_ld ); }
+  const T_Scalar &operator()( Index i, Index j ) const noexcept
+  { return Lyt::MatRef( this->Ptr(), i, j, this->_ld ); }
+
+  MatView< T_Scalar, Lyt > View() noexcept
+  { return { this->Ptr(), this->_m, this->_n, this->_ld }; }
+  MatView< const T_Scalar, Lyt > View() const noexcept
+  { return { this->Ptr(), this->_m, this->_n, this->_ld }; }
+
+  operator MatView< T_Scalar, Lyt >() noexcept
+  { return this->View(); }
+  operator MatView< const T_Scalar, Lyt >() const noexcept
+  { return this->View(); }
+
+  /// <summary>
+  /// The m by n block with origin (i,j).
+  /// </summary>
+  MatView< T_Scalar, Lyt > Blk( Index i, Index j, Size m, Size n ) noexcept
+  { return this->View().Blk( i, j, m, n ); }
+  MatView< const T_Scalar, Lyt > Blk( Index i, Index j, Size m, Size n ) const noexcept
+  { return this->View().Blk( i, j, m, n ); }
+};
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
@@ -0,0 +1,208 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+/// <summary>
+/// Columns of A held in memory at a time by the out-of-core
+/// factorizations, <see cref="Mat_Fctr_LU_OOC"/> and
+/// <see cref="Mat_Fctr_QR_OOC"/>, unless given.
+/// </summary>
+inline constexpr Size Mat_Fctr_OOC_PnlSize = 256;
+
+/// <summary>
+/// Storage of an m by n ColMajor matrix too large to keep in memory,
+/// the source of the out-of-core factorizations, which see it as
+/// panels of whole columns:
+///
+///   Rows(), Cols()           m and n;
+///   Read( j, w, P_, P_ld )   copies columns j:j+w-1 into the m by w
+///                            ColMajor block P;
+///   Write( j, w, P_, P_ld )  copies them back from P.
+///
+/// Read may be called from another thread than the caller's, at the
+/// same time as Write of other columns.
+/// </summary>
+/// <remarks>
+/// <see cref="Aux_PanelFile"/> reads and writes a file explicitly;
+/// <see cref="Aux_PanelMem"/> copies from memory, e.g. a mapping of
+/// the file, which leaves the paging to the OS.
+/// </remarks>
+template< typename T_Store >
+concept PanelStore = requires( T_Store &store, Index j, Size w,
+  typename T_Store::Scalar *P_, Stride P_ld )
+{
+  { store.Rows() } -> std::convertible_to< Size >;
+  { store.Cols() } -> std::convertible_to< Size >;
+  store.Read( j, w, P_, P_ld );
+  store.Write( j, w, (const typename T_Store::Scalar *)P_, P_ld );
+};
+
+/// <summary>
+/// A <see cref="PanelStore"/> over an m by n ColMajor matrix in
+/// memory, of leading dimension A_ld.
+/// </summary>
+template< typename T_Scalar >
+class Aux_PanelMem
+{
+  T_Scalar *_A;
+  Size _m, _n;
+  Stride _ld;
+
+public:
+
+  using Scalar = T_Scalar;
+
+  Aux_PanelMem( T_Scalar *A_, Size m, Size n, Stride A_ld ) noexcept
+  : _A{ A_ }, _m{ m }, _n{ n }, _ld{ A_ld }
+  {}
+
+  Size Rows() const noexcept
+  { return this->_m; }
+  Size Cols() const noexcept
+  { return this->_n; }
+
+  void Read( Index j, Size w, T_Scalar *P_, Stride P_ld ) const
+  {
+    for( Index c = 0; c < (Index)w; ++c )
+    { std::copy_n( this->_A + (j+c)*this->_ld, this->_m, P_ + c*P_ld ); }
+  }
+
+  void Write( Index j, Size w, const T_Scalar *P_, Stride P_ld ) const
+  {
+    for( Index c = 0; c < (Index)w; ++c )
+    { std::copy_n( P_ + c*P_ld, this->_m, this->_A + (j+c)*this->_ld ); }
+  }
+};
+
+/// <summary>
+/// A <see cref="PanelStore"/> over a file holding an m by n ColMajor
+/// matrix as raw elements, of leading dimension m, with no header.
+/// With create, the file is made anew, zero-filled.
+/// </summary>
+/// <remarks>
+/// Throws <see cref="InternalError"/> if the file cannot be opened,
+/// read or written. Reads and writes are serialized.
+/// </remarks>
+template< typename T_Scalar >
+class Aux_PanelFile
+{
+  std::fstream _file;
+  std::mutex _mutex;
+  Size _m, _n;
+
+  void _Seek( Index j )
+  {
+    const auto offset = (std::streamoff)j*(std::streamoff)this->_m*(std::streamoff)sizeof( T_Scalar );
+    this->_file.seekg( offset );
+    this->_file.seekp( offset );
+  }
+
+public:
+
+  using Scalar = T_Scalar;
+
+  Aux_PanelFile( const std::string &path, Size m, Size n, bool create = false )
+  : _m{ m }, _n{ n }
+  {
+    const auto mode = std::ios::in | std::ios::out | std::ios::binary;
+    this->_file.open( path, create ? mode | std::ios::trunc : mode );
+    if( ! this->_file )
+    { throw InternalError{ "Aux_PanelFile: cannot open " + path }; }
+
+    if( create && ( m*n > 0 ) )
+    {
+      const char zero = 0;
+      this->_file.seekp( (std::streamoff)( m*n*sizeof( T_Scalar ) ) - 1 );
+      this->_file.write( &zero, 1 );
+      if( ! this->_file.flush() )
+      { throw InternalError{ "Aux_PanelFile: cannot size " + path }; }
+    }
+  }
+
+  Aux_PanelFile( const Aux_PanelFile & ) = delete;
+  Aux_PanelFile &operator=( const Aux_PanelFile & ) = delete;
+
+  Size Rows() const noexcept
+  { return this->_m; }
+  Size Cols() const noexcept
+  { return this->_n; }
+
+  void Read( Index j, Size w, T_Scalar *P_, Stride P_ld )
+  {
+    std::lock_guard< std::mutex > lock{ this->_mutex };
+    this->_Seek( j );
+
+    if( (Size)P_ld == this->_m )
+    { this->_file.read( (char *)P_, (std::streamsize)( this->_m*w*sizeof( T_Scalar ) ) ); }
+    else
+    {
+      for( Index c = 0; c < (Index)w; ++c )
+      { this->_file.read( (char *)( P_ + c*P_ld ), (std::streamsize)( this->_m*sizeof( T_Scalar ) ) ); }
+    }
+
+    if( ! this->_file )
+    { throw InternalError{ "Aux_PanelFile: read failed" }; }
+  }
+
+  void Write( Index j, Size w, const T_Scalar *P_, Stride P_ld )
+  {
+    std::lock_guard< std::mutex > lock{ this->_mutex };
+    this->_Seek( j );
+
+    if( (Size)P_ld == this->_m )
+    { this->_file.write( (const char *)P_, (std::streamsize)( this->_m*w*sizeof( T_Scalar ) ) ); }
+    else
+    {
+      for( Index c = 0; c < (Index)w; ++c )
+      { this->_file.write( (const char *)( P_ + c*P_ld ), (std::streamsize)( this->_m*sizeof( T_Scalar ) ) ); }
+    }
+
+    if( ! this->_file.flush() )
+    { throw InternalError{ "Aux_PanelFile: write failed" }; }
+  }
+};
+
+namespace _n_Impl {
+
+  // Starts reading columns j:j+w-1 of store into the m by w block P_
+  // on another thread.
+  template< typename T_Store >
+  std::future< void > _Pnl_Fetch( T_Store &store, Size j, Size w, typename T_Store::Scalar *P_ )
+  {
+    return std::async( std::launch::async, [&store, j, w, P_]
+    { store.Read( (Index)j, w, P_, (Stride)store.Rows() ); } );
+  }
+
+  // Calls fn( j, w, P_ ) on the panels of columns 0:n-1 of store, nb
+  // at a time, read into P0_ and P1_ in turn; the read of the next
+  // panel overlaps fn on the current one.
+  template< typename T_Store, typename T_Fn >
+  void _Pnl_Sweep( T_Store &store, Size n, Size nb,
+    typename T_Store::Scalar *P0_, typename T_Store::Scalar *P1_, T_Fn &&fn )
+  {
+    if( 0 == n ){ return; }
+
+    typename T_Store::Scalar *P_[2] = { P0_, P1_ };
+    auto next = _Pnl_Fetch( store, 0, Min( n, nb ), P_[0] );
+
+    for( Size j = 0, b = 0; j < n; j += nb, b ^= 1 )
+    {
+      next.get();
+      if( j+nb < n )
+      { next = _Pnl_Fetch( store, j+nb, Min( n-j-nb, nb ), P_[b^1] ); }
+
+      fn( j, Min( n-j, nb ), P_[b] );
+    }
+  }
+
+}// namespace _n_Impl
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
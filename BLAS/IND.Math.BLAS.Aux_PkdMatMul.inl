@@ -0,0 +1,301 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+/// <summary>
+/// Blocking parameters for the packed Level-3 engine behind
+/// <see cref="Mat_MatMul"/>.
+///
+/// mr by nr is the register tile computed by the micro-kernel,
+/// kc by nr is the B micro-panel kept in L1, mc by kc is the packed
+/// block of A kept in L2, and kc by nc is the packed panel of B
+/// kept in L3.
+///
+/// mc, kc, nc and minVolume are the defaults of
+/// <see cref="Aux_PkdMatMul_Blocking"/>, which holds those in use.
+/// </summary>
+template< typename T_Scalar >
+struct Aux_PkdMatMul_Config
+{
+  static constexpr Size mr = 64/sizeof( T_Scalar );
+  static constexpr Size nr = 4;
+
+  static constexpr Size mc = 12*mr;
+  static constexpr Size kc = 256;
+  static constexpr Size nc = 1024*nr;
+
+  // Below this m*n*k volume, packing costs more than it saves.
+  static constexpr Size minVolume = 24*24*24;
+};
+
+/// <summary>
+/// The cache blocking the packed engine runs with, the register tile
+/// being fixed by <see cref="Aux_PkdMatMul_Config"/>.
+/// </summary>
+template< typename T_Scalar >
+struct Aux_PkdMatMul_Blocking
+{
+  using Config = Aux_PkdMatMul_Config< T_Scalar >;
+
+  Size mc = Config::mc;
+  Size kc = Config::kc;
+  Size nc = Config::nc;
+  Size minVolume = Config::minVolume;
+
+  /// <summary>
+  /// The defaults, overridden by the keys Mat_MatMul.mc, .kc, .nc and
+  /// .minVolume of <see cref="Aux_Tuned"/>.
+  /// </summary>
+  static Aux_PkdMatMul_Blocking Tuned()
+  {
+    const auto &t = Aux_Tuned();
+    return { t.Get< T_Scalar >( "Mat_MatMul.mc", Config::mc ),
+      t.Get< T_Scalar >( "Mat_MatMul.kc", Config::kc ),
+      t.Get< T_Scalar >( "Mat_MatMul.nc", Config::nc ),
+      t.Get< T_Scalar >( "Mat_MatMul.minVolume", Config::minVolume ) };
+  }
+};
+
+namespace _n_Impl {
+
+  // blk with mc and nc rounded up to whole register tiles
+  template< typename T_Scalar >
+  inline Aux_PkdMatMul_Blocking< T_Scalar > _PkdMatMul_Fit( Aux_PkdMatMul_Blocking< T_Scalar > blk ) noexcept
+  {
+    using Config = Aux_PkdMatMul_Config< T_Scalar >;
+
+    blk.mc = ( ( Max( blk.mc, (Size)1 ) + Config::mr - 1 )/Config::mr )*Config::mr;
+    blk.kc = Max( blk.kc, (Size)1 );
+    blk.nc = ( ( Max( blk.nc, (Size)1 ) + Config::nr - 1 )/Config::nr )*Config::nr;
+    return blk;
+  }
+
+  // The blocking in use, tuned on first use
+  template< typename T_Scalar >
+  inline Aux_PkdMatMul_Blocking< T_Scalar > &_PkdMatMul_Blk()
+  {
+    static Aux_PkdMatMul_Blocking< T_Scalar > blk = _PkdMatMul_Fit( Aux_PkdMatMul_Blocking< T_Scalar >::Tuned() );
+    return blk;
+  }
+
+}// namespace _n_Impl
+
+/// <summary>
+/// The cache blocking <see cref="Mat_MatMul"/> runs with for T_Scalar.
+/// </summary>
+template< typename T_Scalar >
+inline Aux_PkdMatMul_Blocking< T_Scalar > Aux_PkdMatMul_GetBlocking()
+{ return _n_Impl::_PkdMatMul_Blk< T_Scalar >(); }
+
+/// <summary>
+/// Sets the cache blocking <see cref="Mat_MatMul"/> runs with for
+/// T_Scalar, with mc and nc rounded up to whole register tiles; not
+/// while a product is running.
+/// </summary>
+template< typename T_Scalar >
+inline void Aux_PkdMatMul_SetBlocking( const Aux_PkdMatMul_Blocking< T_Scalar > &blk )
+{ _n_Impl::_PkdMatMul_Blk< T_Scalar >() = _n_Impl::_PkdMatMul_Fit( blk ); }
+
+/// <summary>
+/// True for the scalar/pointer/layout combinations the packed
+/// engine handles. Everything else stays on the generic path.
+/// </summary>
+template< typename Lyt, typename T_Blk_A, typename T_Blk_B, typename T_Blk_C >
+inline constexpr bool isPkdMatMul =
+  ( isColMajor< Lyt > || isRowMajor< Lyt > )
+  && std::is_pointer_v< T_Blk_A >
+  && std::is_pointer_v< T_Blk_B >
+  && std::is_pointer_v< T_Blk_C >
+  && ( areTheSame< Decay<DerefTypeOf<T_Blk_C>>, Float32 >
+    || areTheSame< Decay<DerefTypeOf<T_Blk_C>>, Float64 > )
+  && areTheSame<
+    Decay<DerefTypeOf<T_Blk_A>>,
+    Decay<DerefTypeOf<T_Blk_B>>,
+    Decay<DerefTypeOf<T_Blk_C>> >;
+
+namespace _n_Impl {
+
+  // Per-thread pack buffers. These only ever grow, so the
+  // steady state performs no allocation.
+  template< typename T_Scalar >
+  struct _s_PkdMatMul_Bfr
+  {
+    std::vector< T_Scalar > A;
+    std::vector< T_Scalar > B;
+  };
+
+  template< typename T_Scalar >
+  inline _s_PkdMatMul_Bfr< T_Scalar > &_PkdMatMul_Bfr()
+  {
+    thread_local _s_PkdMatMul_Bfr< T_Scalar > bfr;
+    return bfr;
+  }
+
+  // Packs the mc by kc block of op(A) into row micro-panels of height mr,
+  // zero-padding the last panel. Element (i,p) of op(A) is at A_[i*A_is + p*A_ps].
+  template< Size MR, typename T_Scalar >
+  inline void _PkdMatMul_PackA( Size mc, Size kc,
+    const T_Scalar *A_, Stride A_is, Stride A_ps,
+    T_Scalar *Ap )
+  {
+    for( Size i0 = 0; i0 < mc; i0 += MR )
+    {
+      const Size mr = Min( MR, mc - i0 );
+      const T_Scalar *A_pnl = A_ + (Index)i0*A_is;
+      if( 1 == A_is )
+      {
+        for( Size p = 0; p < kc; ++p )
+        {
+          const T_Scalar *a = A_pnl + (Index)p*A_ps;
+          Size i = 0;
+          for( ; i < mr; ++i ){ Ap[i] = a[i]; }
+          for( ; i < MR; ++i ){ Ap[i] = {}; }
+          Ap += MR;
+        }
+      }
+      else
+      {
+        for( Size p = 0; p < kc; ++p )
+        {
+          const T_Scalar *a = A_pnl + (Index)p*A_ps;
+          Size i = 0;
+          for( ; i < mr; ++i ){ Ap[i] = a[(Index)i*A_is]; }
+          for( ; i < MR; ++i ){ Ap[i] = {}; }
+          Ap += MR;
+        }
+      }
+    }
+  }
+
+  // Packs the kc by nc panel of op(B) into column micro-panels of width nr,
+  // zero-padding the last panel. Element (p,j) of op(B) is at B_[p*B_ps + j*B_js].
+  template< Size NR, typename T_Scalar >
+  inline void _PkdMatMul_PackB( Size kc, Size nc,
+    const T_Scalar *B_, Stride B_ps, Stride B_js,
+    T_Scalar *Bp )
+  {
+    for( Size j0 = 0; j0 < nc; j0 += NR )
+    {
+      const Size nr = Min( NR, nc - j0 );
+      const T_Scalar *B_pnl = B_ + (Index)j0*B_js;
+      for( Size p = 0; p < kc; ++p )
+      {
+        const T_Scalar *b = B_pnl + (Index)p*B_ps;
+        Size j = 0;
+        for( ; j < nr; ++j ){ Bp[j] = b[(Index)j*B_js]; }
+        for( ; j < NR; ++j ){ Bp[j] = {}; }
+        Bp += NR;
+      }
+    }
+  }
+
+  // AB := Ap*Bp for one mr by kc micro-panel of A and one
+  // kc by nr micro-panel of B. The fixed trip counts let
+  // the compiler keep AB in vector registers.
+  template< Size MR, Size NR, typename T_Scalar >
+  inline void _PkdMatMul_Krnl( Size kc,
+    const T_Scalar *__restrict Ap,
+    const T_Scalar *__restrict Bp,
+    T_Scalar (&AB)[NR][MR] )
+  {
+    for( Size j = 0; j < NR; ++j )
+    { for( Size i = 0; i < MR; ++i ){ AB[j][i] = {}; } }
+
+    for( Size p = 0; p < kc; ++p )
+    {
+      for( Size j = 0; j < NR; ++j )
+      {
+        const T_Scalar b = Bp[j];
+        for( Size i = 0; i < MR; ++i )
+        { AB[j][i] += Ap[i]*b; }
+      }
+      Ap += MR;
+      Bp += NR;
+    }
+  }
+
+  // C := alpha*op(A)*op(B) + C, over the packed representation.
+  // Element (i,j) of C is at C_[i*C_is + j*C_js].
+  template< typename T_Scalar >
+  void _PkdMatMul(
+    Size m, Size n, Size k,
+    const T_Scalar &alpha,
+    const T_Scalar *A_, Stride A_is, Stride A_ps,
+    const T_Scalar *B_, Stride B_ps, Stride B_js,
+    T_Scalar *C_, Stride C_is, Stride C_js )
+  {
+    using Config = Aux_PkdMatMul_Config< T_Scalar >;
+
+    constexpr Size MR = Config::mr;
+    constexpr Size NR = Config::nr;
+
+    auto &bfr = _PkdMatMul_Bfr< T_Scalar >();
+    const auto blk = _PkdMatMul_Blk< T_Scalar >();
+
+    const Size mc_max = Min( blk.mc, ( (m + MR - 1)/MR )*MR );
+    const Size nc_max = Min( blk.nc, ( (n + NR - 1)/NR )*NR );
+    const Size kc_max = Min( blk.kc, k );
+
+    if( bfr.A.size() < mc_max*kc_max ){ bfr.A.resize( mc_max*kc_max ); }
+    if( bfr.B.size() < kc_max*nc_max ){ bfr.B.resize( kc_max*nc_max ); }
+
+    T_Scalar *Ap = bfr.A.data();
+    T_Scalar *Bp = bfr.B.data();
+
+    alignas( 64 ) T_Scalar AB[NR][MR];
+
+    for( Size jc = 0; jc < n; jc += blk.nc )
+    {
+      const Size nc = Min( blk.nc, n - jc );
+
+      for( Size pc = 0; pc < k; pc += blk.kc )
+      {
+        const Size kc = Min( blk.kc, k - pc );
+
+        _PkdMatMul_PackB< NR >( kc, nc,
+          B_ + (Index)pc*B_ps + (Index)jc*B_js, B_ps, B_js, Bp );
+
+        for( Size ic = 0; ic < m; ic += blk.mc )
+        {
+          const Size mc = Min( blk.mc, m - ic );
+
+          _PkdMatMul_PackA< MR >( mc, kc,
+            A_ + (Index)ic*A_is + (Index)pc*A_ps, A_is, A_ps, Ap );
+
+          for( Size jr = 0; jr < nc; jr += NR )
+          {
+            const Size nr = Min( NR, nc - jr );
+            const T_Scalar *Bp_pnl = Bp + jr*kc;
+
+            for( Size ir = 0; ir < mc; ir += MR )
+            {
+              const Size mr = Min( MR, mc - ir );
+              const T_Scalar *Ap_pnl = Ap + ir*kc;
+
+              _PkdMatMul_Krnl< MR, NR >( kc, Ap_pnl, Bp_pnl, AB );
+
+              T_Scalar *C_tile = C_ + (Index)(ic + ir)*C_is + (Index)(jc + jr)*C_js;
+              for( Size j = 0; j < nr; ++j )
+              {
+                T_Scalar *c = C_tile + (Index)j*C_js;
+                for( Size i = 0; i < mr; ++i )
+                { c[(Index)i*C_is] += alpha*AB[j][i]; }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+}// namespace _n_Impl
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
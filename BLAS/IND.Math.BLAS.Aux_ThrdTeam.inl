@@ -0,0 +1,121 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+namespace _n_Impl {
+
+  // Fork-join team of worker threads, alive for the lifetime of the
+  // object. Fork hands out tiles 0:count-1 to the workers and returns
+  // at once, so the calling thread can do other work (e.g. factor the
+  // next panel); Join has the caller help with any tiles left and
+  // waits until all of them are done.
+  class _ThrdTeam
+  {
+  public:
+
+    using Task = std::function< void( Size ) >;
+
+  private:
+
+    std::vector< std::thread > _workers;
+
+    std::mutex _mutex;
+    std::condition_variable _go;
+    std::condition_variable _done;
+
+    Task _task;
+    Size _count = 0;
+    std::atomic< Size > _next{ 0 };
+
+    Size _generation = 0;
+    Size _active = 0;
+    bool _quit = false;
+
+    void _Drain()
+    {
+      for( Size t; ( t = _next.fetch_add( 1 ) ) < _count; )
+      { _task( t ); }
+    }
+
+    void _Work()
+    {
+      std::unique_lock< std::mutex > lock{ _mutex };
+      Size seen = 0;
+      for( ;; )
+      {
+        _go.wait( lock, [&]{ return _quit || ( seen != _generation ); } );
+        if( _quit ){ return; }
+        seen = _generation;
+
+        lock.unlock();
+        _Drain();
+        lock.lock();
+
+        if( 0 == --_active ){ _done.notify_all(); }
+      }
+    }
+
+  public:
+
+    // A team of threadCount threads, counting the caller; 0 means
+    // one per hardware thread.
+    explicit _ThrdTeam( Size threadCount )
+    {
+      if( 0 == threadCount )
+      { threadCount = Max( (Size)std::thread::hardware_concurrency(), (Size)1 ); }
+
+      _workers.reserve( threadCount-1 );
+      for( Size i = 1; i < threadCount; ++i )
+      { _workers.emplace_back( [this]{ this->_Work(); } ); }
+    }
+
+    _ThrdTeam( const _ThrdTeam & ) = delete;
+    _ThrdTeam &operator = ( const _ThrdTeam & ) = delete;
+
+    ~_ThrdTeam()
+    {
+      {
+        std::lock_guard< std::mutex > lock{ _mutex };
+        _quit = true;
+      }
+      _go.notify_all();
+      for( auto &worker : _workers ){ worker.join(); }
+    }
+
+    Size ThreadCount() const noexcept
+    { return _workers.size() + 1; }
+
+    // Starts task( t ) for t in 0:count-1 on the workers.
+    void Fork( Size count, Task task )
+    {
+      {
+        std::lock_guard< std::mutex > lock{ _mutex };
+        _task = std::move( task );
+        _count = count;
+        _next = 0;
+        _active = _workers.size();
+        ++_generation;
+      }
+      _go.notify_all();
+    }
+
+    // Runs the tiles not yet taken, then waits for the workers.
+    void Join()
+    {
+      _Drain();
+      std::unique_lock< std::mutex > lock{ _mutex };
+      _done.wait( lock, [&]{ return 0 == _active; } );
+    }
+  };
+
+}// namespace _n_Impl
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
@@ -0,0 +1,268 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+// Instrumentation of the BLAS and LAPACK entry points, compiled in by
+// defining IND_MATH_TRACE before including this library; otherwise
+// IND_MATH_TRACE_SCOPE is empty and nothing below exists.
+//
+// The Level-3 BLAS, the reflector and rotation kernels, and the LAPACK
+// factorizations and drivers are instrumented; the Level-1 and Level-2
+// routines are not, as a clock read costs about as much as their work.
+
+#if defined( IND_MATH_TRACE )
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+/// <summary>
+/// One call of an instrumented routine, handed to the sink of
+/// <see cref="Trace_SetSink"/> as it returns.
+/// </summary>
+struct Trace_Event
+{
+  // Name of the routine, a string literal
+  const char *routine;
+
+  // Its dimensions, 0 for those it has not
+  Size m, n, k;
+
+  // Analytic flop count, and bytes of the operands as if each were
+  // read and written once; 0 where they depend on the convergence.
+  double flops, bytes;
+
+  // Start, in seconds of std::chrono::steady_clock, and the wall time,
+  // whole and less that of the instrumented calls nested in it.
+  double start, seconds, selfSeconds;
+
+  // Number of instrumented calls this one is nested in on its thread,
+  // and a small id of the thread, 0 for the first one traced.
+  Size depth, thread;
+};
+
+using Trace_Sink = std::function< void( const Trace_Event & ) >;
+
+namespace _n_Impl {
+
+  struct _Trace_State
+  {
+    std::mutex mutex;
+    Trace_Sink sink;
+    std::atomic< bool > on{ false };
+    std::atomic< Size > threadCount{ 0 };
+  };
+
+  inline _Trace_State _trace{};
+
+  struct _Trace_Scope;
+
+  // The innermost instrumented call running on this thread
+  inline thread_local _Trace_Scope *_trace_top = nullptr;
+  inline thread_local Size _trace_thread = ~(Size)0;
+
+  inline double _Trace_Now() noexcept
+  {
+    return std::chrono::duration< double >(
+      std::chrono::steady_clock::now().time_since_epoch() ).count();
+  }
+
+  // LAWN 41 flop counts of the m by n factorizations, with k = min( m, n )
+
+  constexpr double _Trace_Flops_LU( Size m, Size n ) noexcept
+  {
+    const double dm = (double)m, dn = (double)n, dk = (double)Min( m, n );
+    return 2*( dm*dn*dk - ( dm + dn )*dk*dk/2 + dk*dk*dk/3 );
+  }
+
+  constexpr double _Trace_Flops_QR( Size m, Size n ) noexcept
+  {
+    const double dm = (double)m, dn = (double)n, dk = (double)Min( m, n );
+    return 4*dm*dn*dk - 2*( dm + dn )*dk*dk + 4*dk*dk*dk/3;
+  }
+
+  constexpr double _Trace_Flops_Bid( Size m, Size n ) noexcept
+  {
+    const double dm = (double)Max( m, n ), dn = (double)Min( m, n );
+    return 4*dm*dn*dn - 4*dn*dn*dn/3;
+  }
+
+  void _Trace_Begin( _Trace_Scope &scope ) noexcept;
+  void _Trace_End( _Trace_Scope &scope ) noexcept;
+
+  // Lives for the duration of one instrumented call; a literal type, so
+  // the routines stay usable in constant evaluation, where it does
+  // nothing.
+  struct _Trace_Scope
+  {
+    const char *routine;
+    Size m, n, k;
+    double flops, bytes;
+
+    _Trace_Scope *parent = nullptr;
+    double start = 0, childSeconds = 0;
+    Size depth = 0;
+    bool on = false;
+
+    constexpr _Trace_Scope( const char *routine, Size m, Size n, Size k,
+      double flops, double bytes ) noexcept
+    : routine{ routine }, m{ m }, n{ n }, k{ k }, flops{ flops }, bytes{ bytes }
+    {
+      if( ! std::is_constant_evaluated() ){ _Trace_Begin( *this ); }
+    }
+
+    _Trace_Scope( const _Trace_Scope & ) = delete;
+    _Trace_Scope &operator=( const _Trace_Scope & ) = delete;
+
+    constexpr ~_Trace_Scope() noexcept
+    {
+      if( ! std::is_constant_evaluated() && this->on ){ _Trace_End( *this ); }
+    }
+  };
+
+  inline void _Trace_Begin( _Trace_Scope &scope ) noexcept
+  {
+    if( ! _trace.on.load( std::memory_order_relaxed ) ){ return; }
+
+    scope.on = true;
+    scope.parent = _trace_top;
+    scope.depth = scope.parent ? scope.parent->depth+1 : 0;
+    _trace_top = &scope;
+    scope.start = _Trace_Now();
+  }
+
+  inline void _Trace_End( _Trace_Scope &scope ) noexcept
+  {
+    const double seconds = _Trace_Now() - scope.start;
+
+    _trace_top = scope.parent;
+    if( scope.parent ){ scope.parent->childSeconds += seconds; }
+
+    if( ~(Size)0 == _trace_thread )
+    { _trace_thread = _trace.threadCount.fetch_add( 1, std::memory_order_relaxed ); }
+
+    const Trace_Event event{ scope.routine, scope.m, scope.n, scope.k,
+      scope.flops, scope.bytes, scope.start, seconds, seconds - scope.childSeconds,
+      scope.depth, _trace_thread };
+
+    std::lock_guard< std::mutex > lock{ _trace.mutex };
+    if( _trace.sink ){ _trace.sink( event ); }
+  }
+
+}// namespace _n_Impl
+
+/// <summary>
+/// Sets the sink every instrumented call is reported to, or none if
+/// sink is empty. Calls that started while there was none are not
+/// reported.
+/// </summary>
+/// <remarks>
+/// The sink is called from whichever thread made the call, one event
+/// at a time, and must not throw. Wrap an object in std::ref to keep
+/// it in place, e.g. a <see cref="Trace_Summary"/> or a
+/// <see cref="Trace_ChromeWriter"/>.
+/// </remarks>
+inline void Trace_SetSink( Trace_Sink sink )
+{
+  std::lock_guard< std::mutex > lock{ _n_Impl::_trace.mutex };
+  const bool on = (bool)sink;
+  _n_Impl::_trace.sink = std::move( sink );
+  _n_Impl::_trace.on.store( on, std::memory_order_relaxed );
+}
+
+/// <summary>
+/// A sink that adds up the calls of each routine: their count, whole
+/// and self wall time, flops and bytes.
+/// </summary>
+class Trace_Summary
+{
+public:
+
+  struct Entry
+  {
+    Size calls = 0;
+    double seconds = 0, selfSeconds = 0;
+    double flops = 0, bytes = 0;
+  };
+
+  std::map< std::string, Entry > entries;
+
+  void operator()( const Trace_Event &event )
+  {
+    auto &x = this->entries[ event.routine ];
+    ++x.calls;
+    x.seconds += event.seconds;
+    x.selfSeconds += event.selfSeconds;
+    x.flops += event.flops;
+    x.bytes += event.bytes;
+  }
+
+  /// <summary>
+  /// Writes one CSV line per routine, by decreasing self time.
+  /// </summary>
+  void Write( std::ostream &os ) const
+  {
+    std::vector< std::pair< std::string, Entry > > rows( this->entries.begin(), this->entries.end() );
+    std::sort( rows.begin(), rows.end(), []( const auto &a, const auto &b )
+    { return a.second.selfSeconds > b.second.selfSeconds; } );
+
+    os << "routine,calls,seconds,self_seconds,gflops,bytes\n";
+    for( const auto &[ routine, x ] : rows )
+    {
+      os << routine << ',' << x.calls << ',' << x.seconds << ',' << x.selfSeconds << ','
+        << ( ( x.seconds > 0 ) ? x.flops/x.seconds*1e-9 : 0.0 ) << ',' << x.bytes << '\n';
+    }
+  }
+};
+
+/// <summary>
+/// A sink that keeps every event, and writes them in the Chrome trace
+/// event format, which chrome://tracing and Perfetto open: one track
+/// per thread, with the nested calls under the calls they are made in.
+/// </summary>
+class Trace_ChromeWriter
+{
+public:
+
+  std::vector< Trace_Event > events;
+
+  void operator()( const Trace_Event &event )
+  { this->events.push_back( event ); }
+
+  void Write( std::ostream &os ) const
+  {
+    const double t0 = this->events.empty() ? 0 : std::min_element( this->events.begin(), this->events.end(),
+      []( const auto &a, const auto &b ){ return a.start < b.start; } )->start;
+
+    os << "{\"traceEvents\":[\n";
+    for( Size e = 0; e < this->events.size(); ++e )
+    {
+      const auto &x = this->events[e];
+      os << "{\"name\":\"" << x.routine << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << x.thread
+        << ",\"ts\":" << ( x.start - t0 )*1e6 << ",\"dur\":" << x.seconds*1e6
+        << ",\"args\":{\"m\":" << x.m << ",\"n\":" << x.n << ",\"k\":" << x.k
+        << ",\"flops\":" << x.flops << ",\"bytes\":" << x.bytes << "}}"
+        << ( ( e+1 < this->events.size() ) ? ",\n" : "\n" );
+    }
+    os << "],\"displayTimeUnit\":\"ms\"}\n";
+  }
+};
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+// Reports the enclosing call of routine, with dimensions m, n and k
+// and the given analytic flop and byte counts, as it returns.
+#define IND_MATH_TRACE_SCOPE( routine, m, n, k, flops, bytes )\
+  ::IND::Math::BLAS::_n_Impl::_Trace_Scope _ind_trace_scope{ routine,\
+    (::IND::Math::BLAS::Size)( m ), (::IND::Math::BLAS::Size)( n ), (::IND::Math::BLAS::Size)( k ),\
+    (double)( flops ), (double)( bytes ) }
+
+#else
+
+#define IND_MATH_TRACE_SCOPE( routine, m, n, k, flops, bytes ) (void)0
+
+#endif
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
@@ -0,0 +1,160 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+namespace _n_Impl {
+
+  template< typename T_Scalar > inline constexpr const char *_Tuning_Scalar = "";
+  template<> inline constexpr const char *_Tuning_Scalar< Float32 > = "float";
+  template<> inline constexpr const char *_Tuning_Scalar< Float64 > = "double";
+
+}// namespace _n_Impl
+
+/// <summary>
+/// Machine-specific block sizes and crossovers, by scalar type, as
+/// written by the autotuner of the benchmark harness (bench --tune).
+///
+/// The tuning file has one section per scalar type, and one key per
+/// line; keys it does not have keep their defaults:
+///
+///   [double]
+///   Mat_MatMul.kc = 384
+///   Mat_Fctr_LU.nb = 96
+///   Sym_Eig.dcMin = 48
+///
+/// Lines starting with # are comments.
+/// </summary>
+/// <remarks>
+/// Tuned values reach the routines through the Tuned() factories of
+/// their Config structs, e.g. <see cref="Mat_Fctr_LU_Config"/>, and
+/// through <see cref="Aux_PkdMatMul_Blocking"/> for the packed engine
+/// of <see cref="Mat_MatMul"/>.
+/// </remarks>
+class Aux_Tuning
+{
+public:
+
+  // Values by scalar type name, then by key
+  std::map< std::string, std::map< std::string, Size > > sections;
+
+  template< typename T_Scalar >
+  Size Get( const char *key, Size fallback ) const
+  {
+    const auto s = this->sections.find( _n_Impl::_Tuning_Scalar< T_Scalar > );
+    if( s == this->sections.end() ){ return fallback; }
+    const auto v = s->second.find( key );
+    return ( v == s->second.end() ) ? fallback : v->second;
+  }
+
+  template< typename T_Scalar >
+  void Set( const char *key, Size value )
+  { this->sections[ _n_Impl::_Tuning_Scalar< T_Scalar > ][ key ] = value; }
+
+  /// <summary>
+  /// Adds the values of a tuning file, over those already held.
+  /// Returns false, keeping what was read, at the first malformed line.
+  /// </summary>
+  bool Read( std::istream &is )
+  {
+    std::string line, section;
+    while( std::getline( is, line ) )
+    {
+      const auto Trim = []( const std::string &s )
+      {
+        const auto i = s.find_first_not_of( " \t\r" );
+        const auto j = s.find_last_not_of( " \t\r" );
+        return ( std::string::npos == i ) ? std::string{} : s.substr( i, j-i+1 );
+      };
+
+      line = Trim( line );
+      if( line.empty() || ( '#' == line[0] ) ){ continue; }
+
+      if( '[' == line[0] )
+      {
+        if( ']' != line.back() ){ return false; }
+        section = Trim( line.substr( 1, line.size()-2 ) );
+        continue;
+      }
+
+      const auto eq = line.find( '=' );
+      if( section.empty() || ( std::string::npos == eq ) ){ return false; }
+
+      const std::string value = Trim( line.substr( eq+1 ) );
+      char *end = nullptr;
+      const auto x = std::strtoull( value.c_str(), &end, 10 );
+      if( value.empty() || ( '\0' != *end ) ){ return false; }
+
+      this->sections[ section ][ Trim( line.substr( 0, eq ) ) ] = (Size)x;
+    }
+    return true;
+  }
+
+  void Write( std::ostream &os ) const
+  {
+    os << "# IND.Math tuning file\n";
+    for( const auto &[ section, values ] : this->sections )
+    {
+      os << '[' << section << "]\n";
+      for( const auto &[ key, value ] : values )
+      { os << key << " = " << value << '\n'; }
+    }
+  }
+};
+
+/// <summary>
+/// The process-wide tuning, read on first use from the file named by
+/// the environment variable IND_MATH_TUNING, if it is set.
+/// </summary>
+/// <remarks>
+/// Read once, at startup, by whichever tuned Config is made first;
+/// <see cref="Aux_LoadTuning"/> is to be called before that.
+/// </remarks>
+inline Aux_Tuning &Aux_Tuned()
+{
+  static Aux_Tuning tuning = []
+  {
+    Aux_Tuning t{};
+#ifdef _MSC_VER
+    // std::getenv is deprecated by MSVC (C4996, an error under /sdl)
+    char *path = nullptr;
+    size_t len = 0;
+    if( ( 0 == _dupenv_s( &path, &len, "IND_MATH_TUNING" ) ) && path )
+    {
+      std::ifstream file{ path };
+      t.Read( file );
+    }
+    std::free( path );
+#else
+    if( const char *path = std::getenv( "IND_MATH_TUNING" ) )
+    {
+      std::ifstream file{ path };
+      t.Read( file );
+    }
+#endif
+    return t;
+  }();
+  return tuning;
+}
+
+/// <summary>
+/// Replaces <see cref="Aux_Tuned"/> by the tuning file at path, or
+/// returns false, leaving it as it was, if the file cannot be read.
+/// </summary>
+inline bool Aux_LoadTuning( const std::string &path )
+{
+  std::ifstream file{ path };
+  Aux_Tuning t{};
+  if( ! file || ! t.Read( file ) ){ return false; }
+  Aux_Tuned() = std::move( t );
+  return true;
+}
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
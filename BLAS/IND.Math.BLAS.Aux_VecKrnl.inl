@@ -0,0 +1,421 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+//----------------------------------------------------------------
+// Unit-stride Level-1 kernels for Float32/Float64 with a one-time
+// runtime choice of instruction set.
+//
+// The kernels are written once as plain loops that the compiler
+// vectorizes; each instruction set gets its own instantiation by
+// compiling that same loop under a function-level target. This
+// keeps a single source of truth for the arithmetic while still
+// letting a generic x86-64 build use AVX2 or AVX-512 when the CPU
+// has them. On AArch64 NEON is baseline, so the portable
+// instantiation is already the NEON one. Toolchains without
+// function-level targets (MSVC) use the portable instantiation
+// compiled for whatever /arch was given.
+//----------------------------------------------------------------
+
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define IND_BLAS_VEC_KRNL_X86
+#define IND_BLAS_TARGET_AVX2   __attribute__(( target( "avx2,fma" ), flatten ))
+#define IND_BLAS_TARGET_AVX512 __attribute__(( target( "avx512f,avx2,fma" ), flatten ))
+#endif
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+/// <summary>
+/// Instruction sets the Level-1 kernels may be dispatched to.
+/// </summary>
+enum class Aux_Isa
+{
+  Generic = 0,
+  AVX2,
+  AVX512,
+  NEON
+};
+
+/// <summary>
+/// Queries the CPU for the best supported <see cref="Aux_Isa"/>.
+/// </summary>
+inline Aux_Isa Aux_DetectIsa() noexcept
+{
+#if defined( IND_BLAS_VEC_KRNL_X86 )
+  __builtin_cpu_init();
+  if( __builtin_cpu_supports( "avx512f" ) )
+  { return Aux_Isa::AVX512; }
+  if( __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" ) )
+  { return Aux_Isa::AVX2; }
+  return Aux_Isa::Generic;
+#elif defined( __ARM_NEON ) || defined( _M_ARM64 )
+  return Aux_Isa::NEON;
+#else
+  return Aux_Isa::Generic;
+#endif
+}
+
+/// <summary>
+/// The instruction set chosen for this process. Detected once.
+/// </summary>
+inline Aux_Isa Aux_ActiveIsa() noexcept
+{
+  static const Aux_Isa isa = Aux_DetectIsa();
+  return isa;
+}
+
+/// <summary>
+/// True when a Level-1 routine over these vector types can be
+/// handed to the unit-stride kernels.
+/// </summary>
+template< typename Lyt, typename T_Vec_x, typename ...T_Vec_y >
+inline constexpr bool isVecKrnl =
+  ( areTheSame< Lyt, Flat > || isColMajor< Lyt > || isRowMajor< Lyt >
+    || isPacked< Lyt > || isRfp< Lyt > )
+  && std::is_pointer_v< T_Vec_x >
+  && ( std::is_pointer_v< T_Vec_y > && ... )
+  && ( areTheSame< Decay<DerefTypeOf<T_Vec_x>>, Float32 >
+    || areTheSame< Decay<DerefTypeOf<T_Vec_x>>, Float64 > )
+  && ( areTheSame< Decay<DerefTypeOf<T_Vec_x>>, Decay<DerefTypeOf<T_Vec_y>> > && ... );
+
+namespace _n_Impl {
+
+  //--------------------------------------------------------------
+  // Portable kernels. These must stay free of intrinsics so that
+  // they can be inlined into any of the target instantiations.
+  //--------------------------------------------------------------
+
+  template< typename T_Scalar >
+  inline void _VecKrnl_AXPlusY( Size n, T_Scalar alpha, const T_Scalar *x, T_Scalar *y )
+  { for( Size i = 0; i < n; ++i ){ y[i] += alpha*x[i]; } }
+
+  template< typename T_Scalar >
+  inline void _VecKrnl_Scale( Size n, T_Scalar alpha, T_Scalar *x )
+  { for( Size i = 0; i < n; ++i ){ x[i] *= alpha; } }
+
+  template< typename T_Scalar >
+  inline void _VecKrnl_ScaleTo( Size n, T_Scalar alpha, const T_Scalar *x, T_Scalar *y )
+  { for( Size i = 0; i < n; ++i ){ y[i] = alpha*x[i]; } }
+
+  template< typename T_Scalar >
+  inline void _VecKrnl_Copy( Size n, const T_Scalar *x, T_Scalar *y )
+  { for( Size i = 0; i < n; ++i ){ y[i] = x[i]; } }
+
+  template< typename T_Scalar >
+  inline void _VecKrnl_Swap( Size n, T_Scalar *x, T_Scalar *y )
+  {
+    for( Size i = 0; i < n; ++i )
+    {
+      const T_Scalar t = x[i];
+      x[i] = y[i];
+      y[i] = t;
+    }
+  }
+
+  template< typename T_Scalar >
+  inline void _VecKrnl_PlnRot( Size n, T_Scalar *x, T_Scalar *y, T_Scalar c, T_Scalar s )
+  {
+    for( Size i = 0; i < n; ++i )
+    {
+      const T_Scalar x0 = x[i];
+      const T_Scalar y0 = y[i];
+      x[i] = c*x0 + s*y0;
+      y[i] = c*y0 - s*x0;
+    }
+  }
+
+  // Strict IEEE semantics forbid reassociating a single running sum,
+  // so the dot product carries a fixed block of independent partial
+  // sums (a few vector registers' worth) and folds them at the end.
+  template< typename T_Scalar >
+  inline T_Scalar _VecKrnl_Dot( Size n, const T_Scalar *x, const T_Scalar *y )
+  {
+    constexpr Size W = 128/sizeof( T_Scalar );
+
+    T_Scalar acc[W] = {};
+
+    Size i = 0;
+    for( ; i + W <= n; i += W )
+    { for( Size l = 0; l < W; ++l ){ acc[l] += x[i+l]*y[i+l]; } }
+
+    for( Size w = W/2; w > 0; w /= 2 )
+    { for( Size l = 0; l < w; ++l ){ acc[l] += acc[l+w]; } }
+
+    T_Scalar sum = acc[0];
+    for( ; i < n; ++i ){ sum += x[i]*y[i]; }
+    return sum;
+  }
+
+  constexpr int _Ssq_FloorHalf( int e ) noexcept
+  { return ( e >= 0 ) ? e/2 : -( ( 1-e )/2 ); }
+
+  template< typename T_Scalar >
+  constexpr T_Scalar _Ssq_Pow2( int e ) noexcept
+  {
+    T_Scalar x = unit< T_Scalar >;
+    for( ; e > 0; --e ){ x *= 2; }
+    for( ; e < 0; ++e ){ x /= 2; }
+    return x;
+  }
+
+  // Blue's sum of squares, with the thresholds of the la_constants of
+  // LAPACK 3.10: squares of values in [tsml, tbig] neither overflow nor
+  // underflow, those above are scaled by sbig and those below by ssml,
+  // each into a sum of its own. No running rescale, no branch on the
+  // data, so the loops over it vectorize.
+  template< typename T_Scalar >
+  struct _s_Ssq_Blue
+  {
+    static constexpr int t = std::numeric_limits< T_Scalar >::digits;
+    static constexpr int emin = std::numeric_limits< T_Scalar >::min_exponent;
+    static constexpr int emax = std::numeric_limits< T_Scalar >::max_exponent;
+
+    static constexpr T_Scalar tsml = _Ssq_Pow2< T_Scalar >( -_Ssq_FloorHalf( 1-emin ) );
+    static constexpr T_Scalar tbig = _Ssq_Pow2< T_Scalar >( _Ssq_FloorHalf( emax-t+1 ) );
+    static constexpr T_Scalar ssml = _Ssq_Pow2< T_Scalar >( -_Ssq_FloorHalf( emin-t ) );
+    static constexpr T_Scalar sbig = _Ssq_Pow2< T_Scalar >( _Ssq_FloorHalf( 1-emax-t ) );
+
+    // Adds the square of ax = |x| to the sum it belongs to; NaN goes
+    // to the middle one.
+    static constexpr void Add( T_Scalar ax, T_Scalar &big, T_Scalar &med, T_Scalar &sml ) noexcept
+    {
+      const bool isBig = ax > tbig;
+      const bool isSml = ax < tsml;
+      big += isBig ? Sqr( ax*sbig ) : T_Scalar{};
+      sml += isSml ? Sqr( ax*ssml ) : T_Scalar{};
+      med += ( isBig || isSml ) ? T_Scalar{} : Sqr( ax );
+    }
+  };
+
+  // Adds the squares of x to ssq = { big, med, sml } of Blue's
+  // algorithm, with a block of independent sums as in the dot product.
+  template< typename T_Scalar >
+  inline void _VecKrnl_Ssq( Size n, const T_Scalar *x, T_Scalar *ssq )
+  {
+    using Blue = _s_Ssq_Blue< T_Scalar >;
+
+    constexpr Size W = 64/sizeof( T_Scalar );
+
+    T_Scalar big[W] = {}, med[W] = {}, sml[W] = {};
+
+    Size i = 0;
+    for( ; i + W <= n; i += W )
+    { for( Size l = 0; l < W; ++l ){ Blue::Add( Abs( x[i+l] ), big[l], med[l], sml[l] ); } }
+
+    for( ; i < n; ++i ){ Blue::Add( Abs( x[i] ), big[0], med[0], sml[0] ); }
+
+    for( Size l = 0; l < W; ++l )
+    {
+      ssq[0] += big[l];
+      ssq[1] += med[l];
+      ssq[2] += sml[l];
+    }
+  }
+
+  // B := alpha*(~A) + beta*B, with A m by n and B n by m, both column
+  // major; beta == 0 writes B without reading it. The matrix goes in
+  // square tiles of two cache lines a side, each written along the
+  // columns of B from W columns of A that stay in L1. The loops over a
+  // whole tile have fixed bounds, so they unroll into vector stores.
+  template< bool T_isAcc, typename T_Scalar >
+  inline void _VecKrnl_TrnspTiles( Size m, Size n, T_Scalar alpha, const T_Scalar *A, Stride A_ld, T_Scalar beta, T_Scalar *B, Stride B_ld )
+  {
+    constexpr Size W = 128/sizeof( T_Scalar );
+
+    auto Put = [&]( T_Scalar &b, T_Scalar a )
+    {
+      if constexpr( T_isAcc ){ b = alpha*a + beta*b; }
+      else{ b = alpha*a; }
+    };
+
+    for( Size j0 = 0; j0 < n; j0 += W )
+    {
+      const Size jb = Min( W, n-j0 );
+      for( Size i0 = 0; i0 < m; i0 += W )
+      {
+        const Size ib = Min( W, m-i0 );
+        const T_Scalar *a = A + i0 + j0*A_ld;
+        T_Scalar *b = B + j0 + i0*B_ld;
+
+        if( ( W == ib ) && ( W == jb ) )
+        {
+          for( Size i = 0; i < W; ++i )
+          { for( Size j = 0; j < W; ++j ){ Put( b[j + i*B_ld], a[i + j*A_ld] ); } }
+        }
+        else
+        {
+          for( Size i = 0; i < ib; ++i )
+          { for( Size j = 0; j < jb; ++j ){ Put( b[j + i*B_ld], a[i + j*A_ld] ); } }
+        }
+      }
+    }
+  }
+
+  template< typename T_Scalar >
+  inline void _VecKrnl_Trnsp( Size m, Size n, T_Scalar alpha, const T_Scalar *A, Stride A_ld, T_Scalar beta, T_Scalar *B, Stride B_ld )
+  {
+    if( T_Scalar{} == beta )
+    { _VecKrnl_TrnspTiles< false >( m, n, alpha, A, A_ld, beta, B, B_ld ); }
+    else
+    { _VecKrnl_TrnspTiles< true >( m, n, alpha, A, A_ld, beta, B, B_ld ); }
+  }
+
+  template< typename T_Scalar >
+  struct _s_VecKrnl_Tbl
+  {
+    void (*AXPlusY)( Size, T_Scalar, const T_Scalar *, T_Scalar * );
+    void (*Scale)( Size, T_Scalar, T_Scalar * );
+    void (*ScaleTo)( Size, T_Scalar, const T_Scalar *, T_Scalar * );
+    void (*Copy)( Size, const T_Scalar *, T_Scalar * );
+    void (*Swap)( Size, T_Scalar *, T_Scalar * );
+    void (*PlnRot)( Size, T_Scalar *, T_Scalar *, T_Scalar, T_Scalar );
+    T_Scalar (*Dot)( Size, const T_Scalar *, const T_Scalar * );
+    void (*Ssq)( Size, const T_Scalar *, T_Scalar * );
+    void (*Trnsp)( Size, Size, T_Scalar, const T_Scalar *, Stride, T_Scalar, T_Scalar *, Stride );
+  };
+
+#if defined( IND_BLAS_VEC_KRNL_X86 )
+
+  template< typename T_Scalar >
+  struct _s_VecKrnl_AVX2
+  {
+    IND_BLAS_TARGET_AVX2 static void AXPlusY( Size n, T_Scalar alpha, const T_Scalar *x, T_Scalar *y )
+    { _VecKrnl_AXPlusY( n, alpha, x, y ); }
+
+    IND_BLAS_TARGET_AVX2 static void Scale( Size n, T_Scalar alpha, T_Scalar *x )
+    { _VecKrnl_Scale( n, alpha, x ); }
+
+    IND_BLAS_TARGET_AVX2 static void ScaleTo( Size n, T_Scalar alpha, const T_Scalar *x, T_Scalar *y )
+    { _VecKrnl_ScaleTo( n, alpha, x, y ); }
+
+    IND_BLAS_TARGET_AVX2 static void Copy( Size n, const T_Scalar *x, T_Scalar *y )
+    { _VecKrnl_Copy( n, x, y ); }
+
+    IND_BLAS_TARGET_AVX2 static void Swap( Size n, T_Scalar *x, T_Scalar *y )
+    { _VecKrnl_Swap( n, x, y ); }
+
+    IND_BLAS_TARGET_AVX2 static void PlnRot( Size n, T_Scalar *x, T_Scalar *y, T_Scalar c, T_Scalar s )
+    { _VecKrnl_PlnRot( n, x, y, c, s ); }
+
+    IND_BLAS_TARGET_AVX2 static T_Scalar Dot( Size n, const T_Scalar *x, const T_Scalar *y )
+    { return _VecKrnl_Dot( n, x, y ); }
+
+    IND_BLAS_TARGET_AVX2 static void Ssq( Size n, const T_Scalar *x, T_Scalar *ssq )
+    { _VecKrnl_Ssq( n, x, ssq ); }
+
+    IND_BLAS_TARGET_AVX2 static void Trnsp( Size m, Size n, T_Scalar alpha, const T_Scalar *A, Stride A_ld, T_Scalar beta, T_Scalar *B, Stride B_ld )
+    { _VecKrnl_Trnsp( m, n, alpha, A, A_ld, beta, B, B_ld ); }
+  };
+
+  template< typename T_Scalar >
+  struct _s_VecKrnl_AVX512
+  {
+    IND_BLAS_TARGET_AVX512 static void AXPlusY( Size n, T_Scalar alpha, const T_Scalar *x, T_Scalar *y )
+    { _VecKrnl_AXPlusY( n, alpha, x, y ); }
+
+    IND_BLAS_TARGET_AVX512 static void Scale( Size n, T_Scalar alpha, T_Scalar *x )
+    { _VecKrnl_Scale( n, alpha, x ); }
+
+    IND_BLAS_TARGET_AVX512 static void ScaleTo( Size n, T_Scalar alpha, const T_Scalar *x, T_Scalar *y )
+    { _VecKrnl_ScaleTo( n, alpha, x, y ); }
+
+    IND_BLAS_TARGET_AVX512 static void Copy( Size n, const T_Scalar *x, T_Scalar *y )
+    { _VecKrnl_Copy( n, x, y ); }
+
+    IND_BLAS_TARGET_AVX512 static void Swap( Size n, T_Scalar *x, T_Scalar *y )
+    { _VecKrnl_Swap( n, x, y ); }
+
+    IND_BLAS_TARGET_AVX512 static void PlnRot( Size n, T_Scalar *x, T_Scalar *y, T_Scalar c, T_Scalar s )
+    { _VecKrnl_PlnRot( n, x, y, c, s ); }
+
+    IND_BLAS_TARGET_AVX512 static T_Scalar Dot( Size n, const T_Scalar *x, const T_Scalar *y )
+    { return _VecKrnl_Dot( n, x, y ); }
+
+    IND_BLAS_TARGET_AVX512 static void Ssq( Size n, const T_Scalar *x, T_Scalar *ssq )
+    { _VecKrnl_Ssq( n, x, ssq ); }
+
+    IND_BLAS_TARGET_AVX512 static void Trnsp( Size m, Size n, T_Scalar alpha, const T_Scalar *A, Stride A_ld, T_Scalar beta, T_Scalar *B, Stride B_ld )
+    { _VecKrnl_Trnsp( m, n, alpha, A, A_ld, beta, B, B_ld ); }
+  };
+
+#endif
+
+  template< typename T_Krnl, typename T_Scalar >
+  constexpr _s_VecKrnl_Tbl< T_Scalar > _VecKrnl_TblOf()
+  {
+    return {
+      &T_Krnl::AXPlusY, &T_Krnl::Scale, &T_Krnl::ScaleTo,
+      &T_Krnl::Copy, &T_Krnl::Swap, &T_Krnl::PlnRot, &T_Krnl::Dot,
+      &T_Krnl::Ssq, &T_Krnl::Trnsp };
+  }
+
+  template< typename T_Scalar >
+  struct _s_VecKrnl_Generic
+  {
+    static void AXPlusY( Size n, T_Scalar alpha, const T_Scalar *x, T_Scalar *y )
+    { _VecKrnl_AXPlusY( n, alpha, x, y ); }
+
+    static void Scale( Size n, T_Scalar alpha, T_Scalar *x )
+    { _VecKrnl_Scale( n, alpha, x ); }
+
+    static void ScaleTo( Size n, T_Scalar alpha, const T_Scalar *x, T_Scalar *y )
+    { _VecKrnl_ScaleTo( n, alpha, x, y ); }
+
+    static void Copy( Size n, const T_Scalar *x, T_Scalar *y )
+    { _VecKrnl_Copy( n, x, y ); }
+
+    static void Swap( Size n, T_Scalar *x, T_Scalar *y )
+    { _VecKrnl_Swap( n, x, y ); }
+
+    static void PlnRot( Size n, T_Scalar *x, T_Scalar *y, T_Scalar c, T_Scalar s )
+    { _VecKrnl_PlnRot( n, x, y, c, s ); }
+
+    static T_Scalar Dot( Size n, const T_Scalar *x, const T_Scalar *y )
+    { return _VecKrnl_Dot( n, x, y ); }
+
+    static void Ssq( Size n, const T_Scalar *x, T_Scalar *ssq )
+    { _VecKrnl_Ssq( n, x, ssq ); }
+
+    static void Trnsp( Size m, Size n, T_Scalar alpha, const T_Scalar *A, Stride A_ld, T_Scalar beta, T_Scalar *B, Stride B_ld )
+    { _VecKrnl_Trnsp( m, n, alpha, A, A_ld, beta, B, B_ld ); }
+  };
+
+  template< typename T_Scalar >
+  inline _s_VecKrnl_Tbl< T_Scalar > _VecKrnl_MakeTbl( Aux_Isa isa ) noexcept
+  {
+    switch( isa )
+    {
+#if defined( IND_BLAS_VEC_KRNL_X86 )
+    case Aux_Isa::AVX512:
+      return _VecKrnl_TblOf< _s_VecKrnl_AVX512< T_Scalar >, T_Scalar >();
+    case Aux_Isa::AVX2:
+      return _VecKrnl_TblOf< _s_VecKrnl_AVX2< T_Scalar >, T_Scalar >();
+#endif
+    default:
+      return _VecKrnl_TblOf< _s_VecKrnl_Generic< T_Scalar >, T_Scalar >();
+    }
+  }
+
+  /// <summary>
+  /// The kernel table for the active instruction set, built on first use.
+  /// </summary>
+  template< typename T_Scalar >
+  inline const _s_VecKrnl_Tbl< T_Scalar > &_VecKrnl()
+  {
+    static const _s_VecKrnl_Tbl< T_Scalar > tbl = _VecKrnl_MakeTbl< T_Scalar >( Aux_ActiveIsa() );
+    return tbl;
+  }
+
+}// namespace _n_Impl
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#undef IND_BLAS_TARGET_AVX512
+#undef IND_BLAS_TARGET_AVX2
+#undef IND_BLAS_VEC_KRNL_X86
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
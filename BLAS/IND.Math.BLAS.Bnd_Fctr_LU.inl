@@ -0,0 +1,134 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+/// <summary>
+/// Computes an LU factorization of a general M-by-N band matrix A with
+/// kl subdiagonals and ku superdiagonals, using partial pivoting with
+/// row interchanges, with the result and pivot contract of
+/// <see cref="Mat_Fctr_LU"/>.
+///
+/// A is in <see cref="Band"/> storage with the diagonal in row kl+ku,
+/// so AB_ld must be at least 2*kl+ku+1: rows kl:2*kl+ku hold the band
+/// of A on entry, and the first kl rows are set here, to take the
+/// fill-in of the interchanges. On exit U is upper triangular with
+/// kl+ku superdiagonals in rows 0:kl+ku, and the multipliers of L are
+/// below the diagonal, in rows kl+ku+1:2*kl+ku.
+/// </summary>
+///<returns>
+/// A <see cref="Mat_Fctr_LU_Result"/> describing the status of the factorization.
+/// </returns>
+/// <remarks>
+/// Based on the LAPACK routine <c>dgbtf2</c>.
+///
+/// This takes O(n*kl*(kl+ku)) operations. Each column is one column
+/// scaling and one <see cref="Mat_Rank1Upd"/> of at most kl by kl+ku,
+/// on the band seen as a ColMajor block of leading dimension
+/// <see cref="Band::BlkLd"/>. LAPACK too factors column by column
+/// below bandwidths of 32 or so.
+/// </remarks>
+template< typename T_Blk_A,
+  typename T_Arr_piv >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+         && isNativeSignedIntegral< Decay<DerefTypeOf<T_Arr_piv>> > )
+constexpr Mat_Fctr_LU_Result Bnd_Fctr_LU(
+  Size m, Size n,
+  Size kl, Size ku,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_piv piv_ )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+  // The diagonal of A is in row kv
+  const Size kv = kl+ku;
+
+  auto A = [&]( auto i, auto j ) -> auto &
+  { return Band::MatRef( A_, i, j, A_ld, kv ); };
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Band::BlkPtr( A_, i, j, A_ld, kv ); };
+
+  if( A_ld < Band::DenseLd( kl, kv ) )
+  { throw BadArgument{ "Bnd_Fctr_LU", 6 }; }
+
+  if( 0 == m || 0 == n )
+  { return { true }; }
+
+  const Stride A_bld = Band::BlkLd( A_ld );
+
+  // Zero the fill-in rows of columns ku+1:min(kv,n)-1; those of the
+  // later columns are zeroed as the factorization reaches them.
+  for( Index j = (Index)ku+1; j < (Index)Min( kv, n ); ++j )
+  {
+    for( Index r = (Index)kv-j; r < (Index)kl; ++r )
+    { A_[ r + j*A_ld ] = Scalar{}; }
+  }
+
+  Mat_Fctr_LU_Result result{ true };
+
+  // The last column of U reached so far
+  Index ju = 0;
+
+  for( Index j = 0; j < (Index)Min( m, n ); ++j )
+  {
+    // Zero the fill-in rows of column j+kv
+    if( j+(Index)kv < (Index)n )
+    { Vec_Zero( kl, A_ + ( j+(Index)kv )*A_ld, 1 ); }
+
+    // Find pivot and test for singularity
+    const Index km = Min( (Index)kl, (Index)m-1-j );
+    Index jp = 0;
+    for( Index i = 1; i <= km; ++i )
+    {
+      if( Abs( A(j+i,j) ) > Abs( A(j+jp,j) ) )
+      { jp = i; }
+    }
+    piv_[j] = j+jp;
+
+    const Scalar A_pj = A(j+jp,j);
+
+    if( IsZero( A_pj ) )
+    {
+      if( result.i < 0 ){ result.i = j; }
+      continue;
+    }
+
+    ju = Max( ju, Min( j+(Index)ku+jp, (Index)n-1 ) );
+
+    // Apply the interchange to columns j:ju
+    if( 0 != jp )
+    { Vec_Swap( ju-j+1, A_Blk(j+jp,j), A_bld, A_Blk(j,j), A_bld ); }
+
+    if( km > 0 )
+    {
+      // Compute multipliers
+      if( Abs( A_pj ) >= minValue< Scalar > )
+      { Vec_Scale( km, Inv( A_pj ), A_Blk(j+1,j), 1 ); }
+      else
+      {
+        for( Index i = 1; i <= km; ++i )
+        { A(j+i,j) /= A_pj; }
+      }
+
+      // Update the trailing submatrix within the band
+      if( ju > j )
+      {
+        Mat_Rank1Upd< ColMajor >( km, ju-j, -unit< Scalar >,
+          A_Blk(j+1,j), 1,
+          A_Blk(j,j+1), A_bld,
+          A_Blk(j+1,j+1), A_bld );
+      }
+    }
+  }
+
+  return result;
+}
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
@@ -0,0 +1,153 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+/// <summary>
+/// Solves a system of linear equations
+///   A * X = B  or  (~A)*X = B
+/// with a general N-by-N band matrix A, with kl subdiagonals and ku
+/// superdiagonals, using the LU factorization computed by
+/// <see cref="Bnd_Fctr_LU"/>, for the nrhs columns of B at once.
+///
+/// B is overwritten by X on output.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dgbtrs</c>.
+///
+/// Each row of L and of U is one <see cref="Mat_Rank1Upd"/> or
+/// <see cref="Mat_VecMul"/> over the rows of B it reaches, so this
+/// takes O(n*(2*kl+ku)*nrhs) operations.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_piv,
+  typename T_Blk_B >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+         && isNativeSignedIntegral< Decay<DerefTypeOf<T_Arr_piv>> >
+         && areTheSame< Decay<DerefTypeOf<T_Blk_A>>, Decay<DerefTypeOf<T_Blk_B>> > )
+constexpr void Bnd_Solv_LU( Trnsp A_trnsp,
+  Size n, Size kl, Size ku, Size nrhs,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_piv piv_,
+  T_Blk_B B_, Stride B_ld )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_B>>;
+
+  // The diagonal of A is in row kv
+  const Size kv = kl+ku;
+
+  auto A = [&]( auto i, auto j ) -> const auto &
+  { return Band::MatRef( A_, i, j, A_ld, kv ); };
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Band::BlkPtr( A_, i, j, A_ld, kv ); };
+  auto B_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( B_, i, j, B_ld ); };
+  auto B_Row = [&]( auto i, auto j ) -> auto
+  { return Lyt::RowPtr( B_, i, j, B_ld ); };
+
+  if( A_ld < Band::DenseLd( kl, kv ) )
+  { throw BadArgument{ "Bnd_Solv_LU", 7 }; }
+
+  // Quick return if possible
+  if( ( 0 == n ) || ( 0 == nrhs ) )
+  { return; }
+
+  const auto B_rs = Lyt::RowStride( B_, B_ld );
+
+  // B(j,:) := B(j,:)/U(j,j)
+  auto Div_Row = [&]( Index j )
+  {
+    const Scalar &U_jj = A(j,j);
+    auto B_j = B_Row( j, 0 );
+    for( Index c = 0; c < (Index)nrhs; ++c )
+    { Lyt::VecRef( B_j, c, B_rs ) /= U_jj; }
+  };
+
+  switch( A_trnsp )
+  {
+  default:
+    {}throw BadArgument{ "Bnd_Solv_LU", 1 };
+  case Trnsp::No:
+    {
+      // Solve L*X = B, applying the interchanges as they come.
+      if( kl > 0 )
+      {
+        for( Index j = 0; j < (Index)n-1; ++j )
+        {
+          const Size lm = Min( kl, n-1-(Size)j );
+          const Index l = piv_[j];
+          if( l != j )
+          { Vec_Swap< Lyt >( nrhs, B_Row(l,0), B_rs, B_Row(j,0), B_rs ); }
+
+          Mat_Rank1Upd< Lyt >( lm, nrhs, -unit< Scalar >,
+            A_Blk(j+1,j), 1,
+            B_Row(j,0), B_rs,
+            B_Blk(j+1,0), B_ld );
+        }
+      }
+
+      // Solve U*X = B, U with kv superdiagonals
+      for( Index j = (Index)n-1; j >= 0; --j )
+      {
+        Div_Row( j );
+
+        const Index i0 = Max( (Index)0, j-(Index)kv );
+        if( i0 < j )
+        {
+          Mat_Rank1Upd< Lyt >( j-i0, nrhs, -unit< Scalar >,
+            A_Blk(i0,j), 1,
+            B_Row(j,0), B_rs,
+            B_Blk(i0,0), B_ld );
+        }
+      }
+    }
+    break;
+
+  case Trnsp::Yes:
+  case Trnsp::Conj:
+    {
+      // Solve (~U)*X = B
+      for( Index j = 0; j < (Index)n; ++j )
+      {
+        const Index i0 = Max( (Index)0, j-(Index)kv );
+        if( i0 < j )
+        {
+          Mat_VecMul< Lyt >( Trnsp::Yes, j-i0, nrhs, -unit< Scalar >,
+            B_Blk(i0,0), B_ld,
+            A_Blk(i0,j), 1,
+            unit< Scalar >, B_Row(j,0), B_rs );
+        }
+
+        Div_Row( j );
+      }
+
+      // Solve (~L)*X = B, undoing the interchanges last first.
+      if( kl > 0 )
+      {
+        for( Index j = (Index)n-2; j >= 0; --j )
+        {
+          const Size lm = Min( kl, n-1-(Size)j );
+          Mat_VecMul< Lyt >( Trnsp::Yes, lm, nrhs, -unit< Scalar >,
+            B_Blk(j+1,0), B_ld,
+            A_Blk(j+1,j), 1,
+            unit< Scalar >, B_Row(j,0), B_rs );
+
+          const Index l = piv_[j];
+          if( l != j )
+          { Vec_Swap< Lyt >( nrhs, B_Row(l,0), B_rs, B_Row(j,0), B_rs ); }
+        }
+      }
+    }
+    break;
+  }
+}
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
@@ -31,11 +31,15 @@ constexpr void Mat_Add( Trnsp A_trnsp,
   auto B_Col = [&]( auto i, auto j ) -> auto
   { return Lyt::ColPtr( B_, i, j, B_ld ); };
 
-  const Stride A_rs = Lyt::RowStride( A_, A_ld );
-  const Stride A_cs = Lyt::ColStride( A_, A_ld );
+  const auto A_rs = Lyt::RowStride( A_, A_ld );
+  const auto A_cs = Lyt::ColStride( A_, A_ld );
 
-  const Stride B_rs = Lyt::RowStride( B_, B_ld );
-  const Stride B_cs = Lyt::ColStride( B_, B_ld );
+  const auto B_rs = Lyt::RowStride( B_, B_ld );
+  const auto B_cs = Lyt::ColStride( B_, B_ld );
+
+  if( ( Trnsp::No != A_trnsp )
+    && _n_Impl::_Mat_TrnspKrnl< Lyt >( n, m, unit< Decay<DerefTypeOf<T_Blk_B>> >, A_, A_ld, unit< Decay<DerefTypeOf<T_Blk_B>> >, B_, B_ld ) )
+  { return; }
 
   if constexpr ( isColMajor< Lyt > )
   {
@@ -44,22 +48,22 @@ constexpr void Mat_Add( Trnsp A_trnsp,
     case Trnsp::No:
       {
         // Add columns
-        for( Index j = 0; j < (Index)m; ++j )
-        { Vec_Add< Lyt >( n, A_Col(0,j), A_cs, B_Col(0,j), B_cs ); }
+        for( Index j = 0; j < (Index)n; ++j )
+        { Vec_Add< Lyt >( m, A_Col(0,j), A_cs, B_Col(0,j), B_cs ); }
       }
       break;
     case Trnsp::Yes:
       {
         // Add rows to columns
-        for( Index j = 0; j < (Index)m; ++j )
-        { Vec_Add< Lyt >( n, A_Row(j,0), A_rs, B_Col(0,j), B_cs ); }
+        for( Index j = 0; j < (Index)n; ++j )
+        { Vec_Add< Lyt >( m, A_Row(j,0), A_rs, B_Col(0,j), B_cs ); }
       }
       break;
     case Trnsp::Conj:
       {
         // Add row conjugates to columns
-        for( Index j = 0; j < (Index)m; ++j )
-        { Vec_AddConj< Lyt >( n, A_Row(j,0), A_rs, B_Col(0,j), B_cs ); }
+        for( Index j = 0; j < (Index)n; ++j )
+        { Vec_AddConj< Lyt >( m, A_Row(j,0), A_rs, B_Col(0,j), B_cs ); }
       }
       break;
     }
@@ -71,22 +75,22 @@ constexpr void Mat_Add( Trnsp A_trnsp,
     case Trnsp::No:
       {
         // Add rows
-        for( Index i = 0; i < (Index)n; ++i )
-        { Vec_Add< Lyt >( m, A_Row(i,0), A_rs, B_Row(i,0), B_rs ); }
+        for( Index i = 0; i < (Index)m; ++i )
+        { Vec_Add< Lyt >( n, A_Row(i,0), A_rs, B_Row(i,0), B_rs ); }
       }
       break;
     case Trnsp::Yes:
       {
         // Add columns to rows
-        for( Index i = 0; i < (Index)n; ++i )
-        { Vec_Add< Lyt >( m, A_Col(0,i), A_cs, B_Row(i,0), B_rs ); }
+        for( Index i = 0; i < (Index)m; ++i )
+        { Vec_Add< Lyt >( n, A_Col(0,i), A_cs, B_Row(i,0), B_rs ); }
       }
       break;
     case Trnsp::Conj:
       {
         // Add column conjugates to rows
-        for( Index i = 0; i < (Index)n; ++i )
-        { Vec_AddConj< Lyt >( m, A_Col(0,i), A_cs, B_Row(i,0), B_rs ); }
+        for( Index i = 0; i < (Index)m; ++i )
+        { Vec_AddConj< Lyt >( n, A_Col(0,i), A_cs, B_Row(i,0), B_rs ); }
       }
       break;
     }
@@ -120,11 +124,15 @@ constexpr void Mat_Sub( Trnsp A_trnsp,
   auto B_Col = [&]( auto i, auto j ) -> auto
   { return Lyt::ColPtr( B_, i, j, B_ld ); };
 
-  const Stride A_rs = Lyt::RowStride( A_, A_ld );
-  const Stride A_cs = Lyt::ColStride( A_, A_ld );
+  const auto A_rs = Lyt::RowStride( A_, A_ld );
+  const auto A_cs = Lyt::ColStride( A_, A_ld );
+
+  const auto B_rs = Lyt::RowStride( B_, B_ld );
+  const auto B_cs = Lyt::ColStride( B_, B_ld );
 
-  const Stride B_rs = Lyt::RowStride( B_, B_ld );
-  const Stride B_cs = Lyt::ColStride( B_, B_ld );
+  if( ( Trnsp::No != A_trnsp )
+    && _n_Impl::_Mat_TrnspKrnl< Lyt >( n, m, -unit< Decay<DerefTypeOf<T_Blk_B>> >, A_, A_ld, unit< Decay<DerefTypeOf<T_Blk_B>> >, B_, B_ld ) )
+  { return; }
 
   if constexpr ( isColMajor< Lyt > )
   {
@@ -133,22 +141,22 @@ constexpr void Mat_Sub( Trnsp A_trnsp,
     case Trnsp::No:
       {
         // Subtract columns
-        for( Index j = 0; j < (Index)m; ++j )
-        { Vec_Sub< Lyt >( n, A_Col(0,j), A_cs, B_Col(0,j), B_cs ); }
+        for( Index j = 0; j < (Index)n; ++j )
+        { Vec_Sub< Lyt >( m, A_Col(0,j), A_cs, B_Col(0,j), B_cs ); }
       }
       break;
     case Trnsp::Yes:
       {
         // Subtract rows from columns
-        for( Index j = 0; j < (Index)m; ++j )
-        { Vec_Sub< Lyt >( n, A_Row(j,0), A_rs, B_Col(0,j), B_cs ); }
+        for( Index j = 0; j < (Index)n; ++j )
+        { Vec_Sub< Lyt >( m, A_Row(j,0), A_rs, B_Col(0,j), B_cs ); }
       }
       break;
     case Trnsp::Conj:
       {
         // Subtract row conjugates from columns
-        for( Index j = 0; j < (Index)m; ++j )
-        { Vec_SubConj< Lyt >( n, A_Row(j,0), A_rs, B_Col(0,j), B_cs ); }
+        for( Index j = 0; j < (Index)n; ++j )
+        { Vec_SubConj< Lyt >( m, A_Row(j,0), A_rs, B_Col(0,j), B_cs ); }
       }
       break;
     }
@@ -160,22 +168,115 @@ constexpr void Mat_Sub( Trnsp A_trnsp,
     case Trnsp::No:
       {
         // Subtract rows
-        for( Index i = 0; i < (Index)n; ++i )
-        { Vec_Sub< Lyt >( m, A_Row(i,0), A_rs, B_Row(i,0), B_rs ); }
+        for( Index i = 0; i < (Index)m; ++i )
+        { Vec_Sub< Lyt >( n, A_Row(i,0), A_rs, B_Row(i,0), B_rs ); }
       }
       break;
     case Trnsp::Yes:
       {
         // Subtract columns from rows
-        for( Index i = 0; i < (Index)n; ++i )
-        { Vec_Sub< Lyt >( m, A_Col(0,i), A_cs, B_Row(i,0), B_rs ); }
+        for( Index i = 0; i < (Index)m; ++i )
+        { Vec_Sub< Lyt >( n, A_Col(0,i), A_cs, B_Row(i,0), B_rs ); }
       }
       break;
     case Trnsp::Conj:
       {
         // Subtract column conjugates from rows
-        for( Index i = 0; i < (Index)n; ++i )
-        { Vec_AddConj< Lyt >( m, A_Col(0,i), A_cs, B_Row(i,0), B_rs ); }
+        for( Index i = 0; i < (Index)m; ++i )
+        { Vec_SubConj< Lyt >( n, A_Col(0,i), A_cs, B_Row(i,0), B_rs ); }
+      }
+      break;
+    }
+  }
+}
+
+/// <summary>
+/// B := B + alpha*A
+/// or B := B + alpha*(~A)
+/// 
+/// B is m by n
+/// A is m by n
+/// (~A) is n by m
+/// 
+/// The transposes of whole real matrices in <see cref="ColMajor"/> or
+/// <see cref="RowMajor"/> run in cache-sized tiles, as in
+/// <see cref="Mat_Copy"/>.
+/// </summary>
+template< typename Lyt = ColMajor,
+  typename T_Scalar,
+  typename T_Blk_A,
+  typename T_Blk_B >
+requires( requires( T_Scalar alpha, T_Blk_A A_, T_Blk_B B_ ){ { B_[0] += alpha*A_[0] }; } )
+constexpr void Mat_Add( Trnsp A_trnsp,
+  Size m, Size n,
+  const T_Scalar &alpha,
+  T_Blk_A A_, Stride A_ld,
+  T_Blk_B B_, Stride B_ld )
+{
+  auto A_Row = [&]( auto i, auto j ) -> auto
+  { return Lyt::RowPtr( A_, i, j, A_ld ); };
+  auto A_Col = [&]( auto i, auto j ) -> auto
+  { return Lyt::ColPtr( A_, i, j, A_ld ); };
+
+  auto B_Row = [&]( auto i, auto j ) -> auto
+  { return Lyt::RowPtr( B_, i, j, B_ld ); };
+  auto B_Col = [&]( auto i, auto j ) -> auto
+  { return Lyt::ColPtr( B_, i, j, B_ld ); };
+
+  const auto A_rs = Lyt::RowStride( A_, A_ld );
+  const auto A_cs = Lyt::ColStride( A_, A_ld );
+
+  const auto B_rs = Lyt::RowStride( B_, B_ld );
+  const auto B_cs = Lyt::ColStride( B_, B_ld );
+
+  if( ( Trnsp::No != A_trnsp )
+    && _n_Impl::_Mat_TrnspKrnl< Lyt >( n, m, alpha, A_, A_ld, unit< Decay<DerefTypeOf<T_Blk_B>> >, B_, B_ld ) )
+  { return; }
+
+  if constexpr ( isColMajor< Lyt > )
+  {
+    switch( A_trnsp )
+    {
+    case Trnsp::No:
+      {
+        for( Index j = 0; j < (Index)n; ++j )
+        { Vec_AXPlusY< Lyt >( m, alpha, A_Col(0,j), A_cs, B_Col(0,j), B_cs ); }
+      }
+      break;
+    case Trnsp::Yes:
+      {
+        for( Index j = 0; j < (Index)n; ++j )
+        { Vec_AXPlusY< Lyt >( m, alpha, A_Row(j,0), A_rs, B_Col(0,j), B_cs ); }
+      }
+      break;
+    case Trnsp::Conj:
+      {
+        for( Index j = 0; j < (Index)n; ++j )
+        { Vec_AConjXPlusY< Lyt >( m, alpha, A_Row(j,0), A_rs, B_Col(0,j), B_cs ); }
+      }
+      break;
+    }
+  }
+  else
+  {
+    switch( A_trnsp )
+    {
+    case Trnsp::No:
+      {
+        for( Index i = 0; i < (Index)m; ++i )
+        { Vec_AXPlusY< Lyt >( n, alpha, A_Row(i,0), A_rs, B_Row(i,0), B_rs ); }
+      }
+      break;
+    case Trnsp::Yes:
+      {
+        for( Index i = 0; i < (Index)m; ++i )
+        { Vec_AXPlusY< Lyt >( n, alpha, A_Col(0,i), A_cs, B_Row(i,0), B_rs ); }
+      }
+      break;
+    case Trnsp::Conj:
+      {
+        for( Index i = 0; i < (Index)m; ++i )
+        { Vec_AConjXPlusY< Lyt >( n, alpha, A_Col(0,i), A_cs, B_Row(i,0), B_rs ); }
       }
       break;
     }
@@ -19,7 +19,9 @@ template< typename Lyt = ColMajor,
   typename T_Scalar,
   typename T_Blk_A,
   typename T_Vec_x,
-  typename T_Vec_y >
+  typename T_Vec_y,
+  StrideArg T_Stride_x,
+  StrideArg T_Stride_y >
 requires( requires( T_Blk_A A_, T_Scalar u, T_Vec_x x, T_Vec_y y )
 { { (*y) = u*(*A_)*Conj(*x) + u*(*y) }; } )
 constexpr void Mat_ConjVecMul(
@@ -27,9 +29,9 @@ constexpr void Mat_ConjVecMul(
   Size m, Size n,
   const T_Scalar &alpha,
   T_Blk_A A_, Stride A_ld,
-  T_Vec_x x_, Stride x_s,
+  T_Vec_x x_, T_Stride_x x_s,
   const T_Scalar &beta,
-  T_Vec_y y_, Stride y_s )
+  T_Vec_y y_, T_Stride_y y_s )
 {
   auto x = [&]( auto i ) -> const auto &
   { return Lyt::VecRef( x_, i, x_s ); };
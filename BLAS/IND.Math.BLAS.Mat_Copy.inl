@@ -4,6 +4,40 @@ namespace IND {
 namespace Math {
 namespace BLAS {
 
+namespace _n_Impl {
+
+  // B := alpha*(~A) + beta*B by the cache-blocked transpose kernel, with
+  // A m by n and B n by m, both in layout Lyt; beta == 0 writes B without
+  // reading it. Returns false, having done nothing, where the kernel does
+  // not apply: other layouts or types, and constant evaluation.
+  template< typename Lyt,
+    typename T_Blk_A,
+    typename T_Blk_B >
+  constexpr bool _Mat_TrnspKrnl(
+    Size m, Size n,
+    const Decay<DerefTypeOf<T_Blk_B>> &alpha,
+    T_Blk_A A_, Stride A_ld,
+    const Decay<DerefTypeOf<T_Blk_B>> &beta,
+    T_Blk_B B_, Stride B_ld )
+  {
+    if constexpr ( isVecKrnl< Lyt, T_Blk_A, T_Blk_B > && ( isColMajor< Lyt > || isRowMajor< Lyt > ) )
+    {
+      if( ! std::is_constant_evaluated() )
+      {
+        // Row major A is column major ~A, so the kernel sees the
+        // n by m matrix.
+        if constexpr ( isColMajor< Lyt > )
+        { _VecKrnl< Decay<DerefTypeOf<T_Blk_B>> >().Trnsp( m, n, alpha, A_, A_ld, beta, B_, B_ld ); }
+        else
+        { _VecKrnl< Decay<DerefTypeOf<T_Blk_B>> >().Trnsp( n, m, alpha, A_, A_ld, beta, B_, B_ld ); }
+        return true;
+      }
+    }
+    return false;
+  }
+
+}// namespace _n_Impl
+
 /// <summary>
 /// Matrix copy with optional conjugate transpose.
 /// 
@@ -13,8 +47,12 @@ namespace BLAS {
 /// 
 /// The A and B buffers must be distinct.
 /// 
-/// B is m by n.
-/// A is m by n, and (~A) is n by m.
+/// A is m by n. B is m by n, or n by m when transposed.
+/// Half selects the upper (i &lt;= j) or lower (i &gt;= j)
+/// trapezoid of A.
+///
+/// Whole real matrices in <see cref="ColMajor"/> or
+/// <see cref="RowMajor"/> are transposed in cache-sized tiles.
 /// </summary>
 /// <remarks>
 /// Based on the LAPACK routine <c>dlacpy</c> with extended functionality.
@@ -41,11 +79,11 @@ constexpr void Mat_Copy(
   auto B_Col = [&]( auto i, auto j ) -> auto
   { return Lyt::ColPtr( B_, i, j, B_ld ); };
 
-  const Stride A_rs = Lyt::RowStride( A_, A_ld );
-  const Stride A_cs = Lyt::ColStride( A_, A_ld );
+  const auto A_rs = Lyt::RowStride( A_, A_ld );
+  const auto A_cs = Lyt::ColStride( A_, A_ld );
 
-  const Stride B_rs = Lyt::RowStride( B_, B_ld );
-  const Stride B_cs = Lyt::ColStride( B_, B_ld );
+  const auto B_rs = Lyt::RowStride( B_, B_ld );
+  const auto B_cs = Lyt::ColStride( B_, B_ld );
 
   switch( half )
   {
@@ -60,7 +98,7 @@ constexpr void Mat_Copy(
             // Copy columns
             for( Index j = 0; j < (Index)n; ++j )
             {
-              Vec_Copy< Lyt >( (Size)(m-j),
+              Vec_Copy< Lyt >( Min( (Size)(j+1), m ),
                 A_Col( 0, j ), A_cs,
                 B_Col( 0, j ), B_cs );
             }
@@ -68,7 +106,7 @@ constexpr void Mat_Copy(
           else
           {
             // Copy rows
-            for( Index i = 0; i < (Index)m; ++i )
+            for( Index i = 0; i < (Index)Min( m, n ); ++i )
             {
               Vec_Copy< Lyt >( (Size)(n-i),
                 A_Row( i, i ), A_rs,
@@ -85,19 +123,19 @@ constexpr void Mat_Copy(
             // Copy columns into rows
             for( Index j = 0; j < (Index)n; ++j )
             {
-              Vec_Copy< Lyt >( (Size)(m-j),
+              Vec_Copy< Lyt >( Min( (Size)(j+1), m ),
                 A_Col( 0, j ), A_cs,
-                B_Row( j, j ), B_rs );
+                B_Row( j, 0 ), B_rs );
             }
           }
           else
           {
             // Copy rows into columns
-            for( Index i = 0; i < (Index)m; ++i )
+            for( Index i = 0; i < (Index)Min( m, n ); ++i )
             {
               Vec_Copy< Lyt >( (Size)(n-i),
                 A_Row( i, i ), A_rs,
-                B_Col( 0, i ), B_cs );
+                B_Col( i, i ), B_cs );
             }
           }
         }
@@ -110,19 +148,19 @@ constexpr void Mat_Copy(
             // Copy columns into rows with conjugation
             for( Index j = 0; j < (Index)n; ++j )
             {
-              Vec_Conj< Lyt >( (Size)(m-j),
+              Vec_Conj< Lyt >( Min( (Size)(j+1), m ),
                 A_Col( 0, j ), A_cs,
-                B_Row( j, j ), B_rs );
+                B_Row( j, 0 ), B_rs );
             }
           }
           else
           {
             // Copy rows into columns with conjugation
-            for( Index i = 0; i < (Index)m; ++i )
+            for( Index i = 0; i < (Index)Min( m, n ); ++i )
             {
               Vec_Conj< Lyt >( (Size)(n-i),
                 A_Row( i, i ), A_rs,
-                B_Col( 0, i ), B_cs );
+                B_Col( i, i ), B_cs );
             }
           }
         }
@@ -140,7 +178,7 @@ constexpr void Mat_Copy(
           if constexpr ( isColMajor< Lyt > )
           {
             // Copy columns
-            for( Index j = 0; j < (Index)n; ++j )
+            for( Index j = 0; j < (Index)Min( m, n ); ++j )
             {
               Vec_Copy< Lyt >( (Size)(m-j),
                 A_Col( j, j ), A_cs,
@@ -152,7 +190,7 @@ constexpr void Mat_Copy(
             // Copy rows
             for( Index i = 0; i < (Index)m; ++i )
             {
-              Vec_Copy< Lyt >( (Size)(n-i),
+              Vec_Copy< Lyt >( Min( (Size)(i+1), n ),
                 A_Row( i, 0 ), A_rs,
                 B_Row( i, 0 ), B_rs );
             }
@@ -165,11 +203,11 @@ constexpr void Mat_Copy(
           if constexpr ( isColMajor< Lyt > )
           {
             // Copy columns into rows
-            for( Index j = 0; j < (Index)n; ++j )
+            for( Index j = 0; j < (Index)Min( m, n ); ++j )
             {
               Vec_Copy< Lyt >( (Size)(m-j),
-                A_Col( 0, j ), A_cs,
-                B_Row( j, 0 ), B_rs );
+                A_Col( j, j ), A_cs,
+                B_Row( j, j ), B_rs );
             }
           }
           else
@@ -177,7 +215,7 @@ constexpr void Mat_Copy(
             // Copy rows into columns
             for( Index i = 0; i < (Index)m; ++i )
             {
-              Vec_Copy< Lyt >( (Size)(n-i),
+              Vec_Copy< Lyt >( Min( (Size)(i+1), n ),
                 A_Row( i, 0 ), A_rs,
                 B_Col( 0, i ), B_cs );
             }
@@ -190,11 +228,11 @@ constexpr void Mat_Copy(
           if constexpr ( isColMajor< Lyt > )
           {
             // Copy columns into rows with conjugation
-            for( Index j = 0; j < (Index)n; ++j )
+            for( Index j = 0; j < (Index)Min( m, n ); ++j )
             {
               Vec_Conj< Lyt >( (Size)(m-j),
-                A_Col( 0, j ), A_cs,
-                B_Row( j, 0 ), B_rs );
+                A_Col( j, j ), A_cs,
+                B_Row( j, j ), B_rs );
             }
           }
           else
@@ -202,7 +240,7 @@ constexpr void Mat_Copy(
             // Copy rows into columns with conjugation
             for( Index i = 0; i < (Index)m; ++i )
             {
-              Vec_Conj< Lyt >( (Size)(n-i),
+              Vec_Conj< Lyt >( Min( (Size)(i+1), n ),
                 A_Row( i, 0 ), A_rs,
                 B_Col( 0, i ), B_cs );
             }
@@ -215,6 +253,10 @@ constexpr void Mat_Copy(
 
   case Half::Both:
     {
+      if( ( Trnsp::No != A_trnsp )
+        && _n_Impl::_Mat_TrnspKrnl< Lyt >( m, n, unit< Decay<DerefTypeOf<T_Blk_B>> >, A_, A_ld, {}, B_, B_ld ) )
+      { return; }
+
       switch( A_trnsp )
       {
       case Trnsp::No:
@@ -276,7 +318,7 @@ constexpr void Mat_Copy(
             {
               Vec_Conj< Lyt >( m,
                 A_Col( 0, j ), A_cs,
-                B_Row( j, 0 ), B_cs );
+                B_Row( j, 0 ), B_rs );
             }
           }
           else
@@ -297,6 +339,87 @@ constexpr void Mat_Copy(
   }
 }
 
+/// <summary>
+/// Copies an m by n matrix from one storage layout to another:
+///
+/// B := A
+///
+/// Lyt_A and Lyt_B may be any two layouts with MatRef, e.g. ColMajor
+/// to <see cref="TileMajor"/> and back.
+/// </summary>
+template< typename Lyt_A,
+  typename Lyt_B,
+  typename T_Blk_A,
+  typename T_Blk_B >
+requires( requires( const T_Blk_A A_, const T_Blk_B B_ )
+{ { B_[0] = A_[0] }; } )
+constexpr void Mat_Copy(
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Blk_B B_, Stride B_ld )
+{
+  auto A = [&]( auto i, auto j ) -> const auto &
+  { return Lyt_A::MatRef( A_, i, j, A_ld ); };
+  auto B = [&]( auto i, auto j ) -> auto &
+  { return Lyt_B::MatRef( B_, i, j, B_ld ); };
+
+  if constexpr( isRowMajor< Lyt_A > && isRowMajor< Lyt_B > )
+  {
+    for( Index i = 0; i < (Index)m; ++i )
+    {
+      for( Index j = 0; j < (Index)n; ++j )
+      { B(i,j) = A(i,j); }
+    }
+  }
+  else
+  {
+    for( Index j = 0; j < (Index)n; ++j )
+    {
+      for( Index i = 0; i < (Index)m; ++i )
+      { B(i,j) = A(i,j); }
+    }
+  }
+}
+
+/// <summary>
+/// Copies an m by n matrix from one storage layout to another, as the
+/// overload above does, with the columns of B split through the
+/// execution context exec (see <see cref="ExecContext"/>).
+/// </summary>
+/// <remarks>
+/// For <see cref="TileMajor"/> B, the ranges are whole tile columns,
+/// so filling newly allocated storage this way lets each tile be
+/// first touched, and so placed in memory, by a task of its own.
+/// </remarks>
+template< typename Lyt_A,
+  typename Lyt_B,
+  typename T_Blk_A,
+  typename T_Blk_B,
+  typename T_Exec >
+requires( requires( const T_Blk_A A_, const T_Blk_B B_ )
+{ { B_[0] = A_[0] }; }
+  && ExecContext< Decay<T_Exec> > )
+constexpr void Mat_Copy(
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Blk_B B_, Stride B_ld,
+  T_Exec &&exec )
+{
+  Size g = 1;
+  if constexpr( isTileMajor< Lyt_B > ){ g = Lyt_B::tileSize; }
+
+  _n_Impl::_Exec_Split( exec, (n+g-1)/g, (Exec_SplitMin+g-1)/g, [&]( Index c0, Size cn )
+  {
+    const Index j0 = c0*(Index)g;
+    const Index j1 = Min( (Index)n, j0+(Index)( cn*g ) );
+    for( Index j = j0; j < j1; ++j )
+    {
+      for( Index i = 0; i < (Index)m; ++i )
+      { Lyt_B::MatRef( B_, i, j, B_ld ) = Lyt_A::MatRef( A_, i, j, A_ld ); }
+    }
+  } );
+}
+
 }// namespace BLAS
 }// namespace Math
 }// namespace IND
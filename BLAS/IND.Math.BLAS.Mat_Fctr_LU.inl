@@ -25,6 +25,33 @@ struct Mat_Fctr_LU_Result
   {}
 };
 
+/// <summary>
+/// Tuning parameters for <see cref="Mat_Fctr_LU_Blk"/> and
+/// <see cref="Mat_Fctr_LU_Par"/>.
+/// </summary>
+struct Mat_Fctr_LU_Config
+{
+  // Width of the panels factored by the recursive code. If nb < 2,
+  // or nb >= min(m,n), the whole matrix is factored recursively.
+  Size nb = 64;
+
+  // Threads used by Mat_Fctr_LU_Par, counting the caller;
+  // 0 means one per hardware thread.
+  Size threadCount = 0;
+
+  /// <summary>
+  /// The defaults, with nb overridden by the key Mat_Fctr_LU.nb of
+  /// <see cref="Aux_Tuned"/> for T_Scalar.
+  /// </summary>
+  template< typename T_Scalar >
+  static Mat_Fctr_LU_Config Tuned()
+  {
+    Mat_Fctr_LU_Config config{};
+    config.nb = Aux_Tuned().Get< T_Scalar >( "Mat_Fctr_LU.nb", config.nb );
+    return config;
+  }
+};
+
 /// <summary>
 ///
 /// Computes an LU factorization of a general M-by-N matrix A
@@ -42,18 +69,22 @@ struct Mat_Fctr_LU_Result
 /// A <see cref="Mat_Fctr_LU_Result"/> describing the status of the factorization.
 /// </returns>
 /// <remarks>
-/// Based on the BLAS routine <c>dgetrf2</v>.
+/// Based on the LAPACK routine <c>dgetrf2</c>.
 /// </remarks>
 template< typename Lyt = ColMajor,
   typename T_Blk_A,
   typename T_Arr_piv >
-requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+requires( ! isTileMajor< Lyt >
+         && ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
          && isNativeSignedIntegral< Decay<DerefTypeOf<T_Arr_piv>> > )
 constexpr Mat_Fctr_LU_Result Mat_Fctr_LU(
   Size m, Size n,
   T_Blk_A A_, Stride A_ld,
   T_Arr_piv piv_ )
 {
+  IND_MATH_TRACE_SCOPE( "Mat_Fctr_LU", m, n, 0,
+    _n_Impl::_Trace_Flops_LU( m, n ), 2.0*m*n*sizeof( *A_ ) );
+
   using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
 
   auto A = [&]( auto i, auto j ) -> auto &
@@ -66,7 +97,7 @@ constexpr Mat_Fctr_LU_Result Mat_Fctr_LU(
   if( 0 == m || 0 == n )
   { return { true }; }
 
-  const Stride A_cs = Lyt::ColStride( A_, A_ld );
+  const auto A_cs = Lyt::ColStride( A_, A_ld );
 
   if( 1 == m )
   {
@@ -158,8 +189,8 @@ constexpr Mat_Fctr_LU_Result Mat_Fctr_LU(
 
   // Adjust INFO (Fctr_00.i) and the pivot indices
   Fctr_00.success = Fctr_11.success;
-  if( 0 == Fctr_00.i )
-  { Fctr_00.i = Fctr_11.i + n1; }
+  if( ( Fctr_00.i < 0 ) && ( Fctr_11.i >= 0 ) )
+  { Fctr_00.i = Fctr_11.i + (Index)n1; }
   for( Index i = (Index)n1; i < (Index)piv_n; ++i )
   { piv_[i] += (Index)n1; }
 
@@ -169,6 +200,522 @@ constexpr Mat_Fctr_LU_Result Mat_Fctr_LU(
   return Fctr_00;
 }
 
+/// <summary>
+/// Computes an LU factorization of a general M-by-N matrix A
+/// using partial pivoting with row interchanges, with the same
+/// result and pivot contract as <see cref="Mat_Fctr_LU"/>.
+///
+/// Panels of config.nb columns are factored by the recursive code;
+/// each then takes one <see cref="Tri_Solv_Mat_Rec"/> for the block row
+/// of U and one <see cref="Mat_MatMul"/> for the trailing matrix.
+/// </summary>
+///<returns>
+/// A <see cref="Mat_Fctr_LU_Result"/> describing the status of the factorization.
+/// </returns>
+/// <remarks>
+/// Based on the LAPACK routine <c>dgetrf</c>.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_piv >
+requires( ! isTileMajor< Lyt >
+         && ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+         && isNativeSignedIntegral< Decay<DerefTypeOf<T_Arr_piv>> > )
+constexpr Mat_Fctr_LU_Result Mat_Fctr_LU_Blk(
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_piv piv_,
+  const Mat_Fctr_LU_Config &config = {} )
+{
+  IND_MATH_TRACE_SCOPE( "Mat_Fctr_LU_Blk", m, n, config.nb,
+    _n_Impl::_Trace_Flops_LU( m, n ), 2.0*m*n*sizeof( *A_ ) );
+
+  using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+
+  const Size k = Min( m, n );
+  const Size nb = config.nb;
+
+  if( ( nb < 2 ) || ( nb >= k ) )
+  { return Mat_Fctr_LU< Lyt >( m, n, A_, A_ld, piv_ ); }
+
+  Mat_Fctr_LU_Result result{ true };
+
+  for( Index j = 0; j < (Index)k; j += (Index)nb )
+  {
+    const Size jb = Min( k-(Size)j, nb );
+    const Index j1 = j+(Index)jb;
+
+    // Factor diagonal and subdiagonal blocks and test for exact
+    // singularity
+    const auto Fctr_jj = Mat_Fctr_LU< Lyt >( m-j, jb, A_Blk(j,j), A_ld, piv_ + j );
+
+    // Adjust the result and the pivot indices
+    result.success = result.success && Fctr_jj.success;
+    if( ( result.i < 0 ) && ( Fctr_jj.i >= 0 ) )
+    { result.i = Fctr_jj.i + j; }
+    for( Index i = j; i < j1; ++i )
+    { piv_[i] += j; }
+
+    // Apply interchanges to columns 0:j-1
+    Mat_RowSwp< Lyt >( j, A_, A_ld, j, j1-1, piv_ );
+
+    if( j1 < (Index)n )
+    {
+      // Apply interchanges to columns j1:n-1
+      Mat_RowSwp< Lyt >( n-j1, A_Blk(0,j1), A_ld, j, j1-1, piv_ );
+
+      // Compute block row of U
+      Tri_Solv_Mat_Rec< Lyt >( Side::Left, Half::Lower, Trnsp::No, Diag::IsUnit,
+        jb, n-j1, unit< Scalar >,
+        A_Blk(j,j), A_ld,
+        A_Blk(j,j1), A_ld );
+
+      // Update trailing submatrix
+      if( j1 < (Index)m )
+      {
+        Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No,
+          m-j1, n-j1, jb, -unit< Scalar >,
+          A_Blk(j1,j), A_ld,
+          A_Blk(j,j1), A_ld, unit< Scalar >,
+          A_Blk(j1,j1), A_ld );
+      }
+    }
+  }
+
+  return result;
+}
+
+/// <summary>
+/// Computes an LU factorization of a general M-by-N matrix A
+/// using partial pivoting with row interchanges, with the same
+/// result and pivot contract as <see cref="Mat_Fctr_LU"/>, with the
+/// work split through the execution context exec (see
+/// <see cref="ExecContext"/>).
+///
+/// This is <see cref="Mat_Fctr_LU_Blk"/> with config.nb, whose
+/// update of the trailing matrix is split into column tiles of width
+/// config.nb, one task each. The caller updates the columns of the
+/// next panel first, and then factors that panel while the tasks
+/// are still running (lookahead of depth 1). config.threadCount is
+/// not used; exec decides.
+/// </summary>
+///<returns>
+/// A <see cref="Mat_Fctr_LU_Result"/> describing the status of the factorization.
+/// </returns>
+/// <remarks>
+/// Based on the LAPACK routine <c>dgetrf</c>.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_piv,
+  typename T_Exec >
+requires( ! isTileMajor< Lyt >
+         && ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+         && isNativeSignedIntegral< Decay<DerefTypeOf<T_Arr_piv>> >
+         && ExecContext< Decay<T_Exec> > )
+constexpr Mat_Fctr_LU_Result Mat_Fctr_LU(
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_piv piv_,
+  T_Exec &&exec,
+  const Mat_Fctr_LU_Config &config = {} )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+
+  const Size k = Min( m, n );
+  const Size nb = config.nb;
+
+  if( _n_Impl::_isExecSeq< T_Exec > || ( nb < 2 ) || ( nb >= k ) || ( 1 == exec.ThreadCount() ) )
+  { return Mat_Fctr_LU_Blk< Lyt >( m, n, A_, A_ld, piv_, config ); }
+
+  Mat_Fctr_LU_Result result{ true };
+
+  // Factors the panel of columns j:j+jb-1 and adjusts the result
+  // and the pivot indices.
+  auto Fctr_Pnl = [&]( Index j, Size jb )
+  {
+    const auto Fctr_jj = Mat_Fctr_LU< Lyt >( m-j, jb, A_Blk(j,j), A_ld, piv_ + j );
+
+    result.success = result.success && Fctr_jj.success;
+    if( ( result.i < 0 ) && ( Fctr_jj.i >= 0 ) )
+    { result.i = Fctr_jj.i + j; }
+    for( Index i = j; i < j+(Index)jb; ++i )
+    { piv_[i] += j; }
+  };
+
+  // Applies the panel of columns j:j1-1 to columns c0:c0+cn-1.
+  auto Updt_Cols = [&]( Index j, Index j1, Index c0, Size cn )
+  {
+    Mat_RowSwp< Lyt >( cn, A_Blk(0,c0), A_ld, j, j1-1, piv_ );
+
+    Tri_Solv_Mat_Rec< Lyt >( Side::Left, Half::Lower, Trnsp::No, Diag::IsUnit,
+      j1-j, cn, unit< Scalar >,
+      A_Blk(j,j), A_ld,
+      A_Blk(j,c0), A_ld );
+
+    if( j1 < (Index)m )
+    {
+      Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No,
+        m-j1, cn, j1-j, -unit< Scalar >,
+        A_Blk(j1,j), A_ld,
+        A_Blk(j,c0), A_ld, unit< Scalar >,
+        A_Blk(j1,c0), A_ld );
+    }
+  };
+
+  Fctr_Pnl( 0, Min( k, nb ) );
+
+  for( Index j = 0; j < (Index)k; j += (Index)nb )
+  {
+    const Index j1 = j+(Index)Min( k-(Size)j, nb );
+
+    // Apply interchanges to columns 0:j-1
+    Mat_RowSwp< Lyt >( j, A_, A_ld, j, j1-1, piv_ );
+
+    if( j1 >= (Index)n )
+    { break; }
+
+    // The next panel is columns j1:j2-1; the tasks update
+    // columns j2:n-1 in tiles of nb columns.
+    const Index j2 = ( j1 < (Index)k ) ? j1+(Index)Min( k-(Size)j1, nb ) : j1;
+    const Size tileCount = ( n-(Size)j2 + nb-1 )/nb;
+
+    exec.Fork( tileCount, [&, j, j1, j2]( Size t )
+    {
+      const Index c0 = j2+(Index)( t*nb );
+      Updt_Cols( j, j1, c0, Min( nb, n-(Size)c0 ) );
+    } );
+
+    // Lookahead: update and factor the next panel
+    if( j2 > j1 )
+    {
+      Updt_Cols( j, j1, j1, (Size)(j2-j1) );
+      Fctr_Pnl( j1, (Size)(j2-j1) );
+    }
+
+    exec.Join();
+  }
+
+  return result;
+}
+
+namespace _n_Impl {
+
+  // Mat_Fctr_LU for A in TileMajor storage: each panel is one tile
+  // column, factored in a ColMajor copy; the swaps, the block row of U
+  // and the trailing update are then tile operations, split over the
+  // other tile columns through exec.
+  template< typename Lyt,
+    typename T_Blk_A,
+    typename T_Arr_piv,
+    typename T_Exec >
+  Mat_Fctr_LU_Result _Mat_Fctr_LU_Tile(
+    Size m, Size n,
+    T_Blk_A A_, Stride A_ld,
+    T_Arr_piv piv_,
+    T_Exec &exec )
+  {
+    using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+    constexpr Size B = Lyt::tileSize;
+    constexpr Stride T_ld = (Stride)B;
+
+    auto A = [&]( auto i, auto j ) -> auto &
+    { return Lyt::MatRef( A_, i, j, A_ld ); };
+    auto A_Tile = [&]( Index I, Index J ) -> auto
+    { return Lyt::TilePtr( A_, I, J, A_ld ); };
+
+    const Size k = Min( m, n );
+    const Size mt = (m+B-1)/B;
+    const Size nt = (n+B-1)/B;
+
+    Mat_Fctr_LU_Result result{ true };
+
+    std::vector< Scalar > W;
+
+    for( Index J = 0; (Size)J*B < k; ++J )
+    {
+      const Index j = J*(Index)B;
+      const Size jb = Min( B, k-(Size)j );
+      const Index j1 = j+(Index)jb;
+      const Size W_m = m-(Size)j;
+
+      // Factor the panel A(j:m-1,j:j1-1) in W
+      W.resize( W_m*jb );
+      for( Index c = 0; c < (Index)jb; ++c )
+      {
+        for( Index r = 0; r < (Index)W_m; ++r )
+        { W[r+c*W_m] = A( j+r, j+c ); }
+      }
+
+      const auto Fctr_jj = Mat_Fctr_LU< ColMajor >( W_m, jb, W.data(), (Stride)W_m, piv_ + j );
+
+      for( Index c = 0; c < (Index)jb; ++c )
+      {
+        for( Index r = 0; r < (Index)W_m; ++r )
+        { A( j+r, j+c ) = W[r+c*W_m]; }
+      }
+
+      // Adjust the result and the pivot indices
+      result.success = result.success && Fctr_jj.success;
+      if( ( result.i < 0 ) && ( Fctr_jj.i >= 0 ) )
+      { result.i = Fctr_jj.i + j; }
+      for( Index i = j; i < j1; ++i )
+      { piv_[i] += j; }
+
+      // Applies the panel to the columns c0:c0+cw-1 of tile column C:
+      // the interchanges always, and the block row of U and the
+      // trailing update right of the panel.
+      auto Updt_Cols = [&]( Index C, Index c0, Size cw )
+      {
+        for( Index i = j; i < j1; ++i )
+        {
+          const Index p = piv_[i];
+          if( p != i )
+          { Vec_Swap< Flat >( cw, Lyt::BlkPtr( A_, i, c0, A_ld ), T_ld, Lyt::BlkPtr( A_, p, c0, A_ld ), T_ld ); }
+        }
+
+        if( C < J ){ return; }
+
+        Tri_Solv_Mat_Rec< ColMajor >( Side::Left, Half::Lower, Trnsp::No, Diag::IsUnit,
+          jb, cw, unit< Scalar >,
+          A_Tile( J, J ), T_ld,
+          Lyt::BlkPtr( A_, j, c0, A_ld ), T_ld );
+
+        for( Index I = J+1; I < (Index)mt; ++I )
+        {
+          const Size ib = Min( B, m-(Size)I*B );
+          Mat_MatMul< ColMajor >( Trnsp::No, Trnsp::No,
+            ib, cw, jb, -unit< Scalar >,
+            A_Tile( I, J ), T_ld,
+            Lyt::BlkPtr( A_, j, c0, A_ld ), T_ld, unit< Scalar >,
+            Lyt::BlkPtr( A_, I*(Index)B, c0, A_ld ), T_ld );
+        }
+      };
+
+      // The columns of tile column J right of a short last panel
+      const Index c1 = Min( (Index)n, j+(Index)B );
+      if( j1 < c1 ){ Updt_Cols( J, j1, (Size)(c1-j1) ); }
+
+      _Exec_Split( exec, nt, (Exec_SplitMin+B-1)/B, [&]( Index C0, Size nc )
+      {
+        for( Index C = C0; C < C0+(Index)nc; ++C )
+        {
+          if( C == J ){ continue; }
+          const Index c0 = C*(Index)B;
+          Updt_Cols( C, c0, Min( B, n-(Size)c0 ) );
+        }
+      } );
+    }
+
+    return result;
+  }
+
+}// namespace _n_Impl
+
+/// <summary>
+/// Computes an LU factorization of a general M-by-N matrix A in
+/// <see cref="TileMajor"/> storage, using partial pivoting with row
+/// interchanges, with the same result and pivot contract as
+/// <see cref="Mat_Fctr_LU"/> and the work split through the execution
+/// context exec (see <see cref="ExecContext"/>).
+///
+/// The panels are the tile columns of A, so config.nb is not used; the
+/// block row of U and the trailing update run one tile at a time.
+/// </summary>
+///<returns>
+/// A <see cref="Mat_Fctr_LU_Result"/> describing the status of the factorization.
+/// </returns>
+/// <remarks>
+/// Based on the LAPACK routine <c>dgetrf</c>.
+/// </remarks>
+template< typename Lyt,
+  typename T_Blk_A,
+  typename T_Arr_piv,
+  typename T_Exec >
+requires( isTileMajor< Lyt >
+         && ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+         && isNativeSignedIntegral< Decay<DerefTypeOf<T_Arr_piv>> >
+         && ExecContext< Decay<T_Exec> > )
+Mat_Fctr_LU_Result Mat_Fctr_LU(
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_piv piv_,
+  T_Exec &&exec,
+  const Mat_Fctr_LU_Config &config = {} )
+{
+  (void)config;
+  return _n_Impl::_Mat_Fctr_LU_Tile< Lyt >( m, n, A_, A_ld, piv_, exec );
+}
+
+/// <summary>
+/// Computes an LU factorization of a general M-by-N matrix A in
+/// <see cref="TileMajor"/> storage, as the overload above does, on the
+/// calling thread.
+/// </summary>
+template< typename Lyt,
+  typename T_Blk_A,
+  typename T_Arr_piv >
+requires( isTileMajor< Lyt >
+         && ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+         && isNativeSignedIntegral< Decay<DerefTypeOf<T_Arr_piv>> > )
+Mat_Fctr_LU_Result Mat_Fctr_LU(
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_piv piv_ )
+{
+  Exec_Seq exec;
+  return _n_Impl::_Mat_Fctr_LU_Tile< Lyt >( m, n, A_, A_ld, piv_, exec );
+}
+
+/// <summary>
+/// Computes an LU factorization of a general M-by-N matrix A in
+/// <see cref="TileMajor"/> storage, as the overload of
+/// <see cref="Mat_Fctr_LU"/> for it does; config.nb is not used.
+/// </summary>
+template< typename Lyt,
+  typename T_Blk_A,
+  typename T_Arr_piv >
+requires( isTileMajor< Lyt >
+         && ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+         && isNativeSignedIntegral< Decay<DerefTypeOf<T_Arr_piv>> > )
+Mat_Fctr_LU_Result Mat_Fctr_LU_Blk(
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_piv piv_,
+  const Mat_Fctr_LU_Config &config = {} )
+{
+  (void)config;
+  return Mat_Fctr_LU< Lyt >( m, n, A_, A_ld, piv_ );
+}
+
+/// <summary>
+/// Computes an LU factorization of a general M-by-N matrix A
+/// using partial pivoting with row interchanges, with the same
+/// result and pivot contract as <see cref="Mat_Fctr_LU"/>.
+///
+/// This is the overload of <see cref="Mat_Fctr_LU"/> taking an execution
+/// context, on an <see cref="Exec_Par"/> of config.threadCount threads
+/// made for the call.
+/// </summary>
+///<returns>
+/// A <see cref="Mat_Fctr_LU_Result"/> describing the status of the factorization.
+/// </returns>
+/// <remarks>
+/// Based on the LAPACK routine <c>dgetrf</c>.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_piv >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+         && isNativeSignedIntegral< Decay<DerefTypeOf<T_Arr_piv>> > )
+Mat_Fctr_LU_Result Mat_Fctr_LU_Par(
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_piv piv_,
+  const Mat_Fctr_LU_Config &config = {} )
+{
+  const Size nb = config.nb;
+  if( ( nb < 2 ) || ( nb >= Min( m, n ) ) || ( 1 == config.threadCount ) )
+  { return Mat_Fctr_LU_Blk< Lyt >( m, n, A_, A_ld, piv_, config ); }
+
+  Exec_Par exec{ config.threadCount };
+  return Mat_Fctr_LU< Lyt >( m, n, A_, A_ld, piv_, exec, config );
+}
+
+/// <summary>
+/// LU factorization with partial pivoting of an m by n matrix A, with
+/// m and n fixed at compile time, and with the result and pivot
+/// contract of <see cref="Mat_Fctr_LU"/>.
+///
+/// This is the right-looking unblocked algorithm, also the kernel of
+/// <see cref="Mat_Fctr_LU_Bat"/>; for the small sizes it is meant for
+/// (3 by 3, 4 by 4) the loops unroll completely, and it can be
+/// evaluated at compile time.
+/// </summary>
+///<returns>
+/// A <see cref="Mat_Fctr_LU_Result"/> describing the status of the factorization.
+/// </returns>
+/// <remarks>
+/// Based on the LAPACK routine <c>dgetf2</c>.
+/// </remarks>
+template< Size m, Size n,
+  typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_piv >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+         && isNativeSignedIntegral< Decay<DerefTypeOf<T_Arr_piv>> > )
+constexpr Mat_Fctr_LU_Result Mat_Fctr_LU(
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_piv piv_ )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+  auto A = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( A_, i, j, A_ld ); };
+
+  constexpr Size k = Min( m, n );
+
+  Mat_Fctr_LU_Result result{ true };
+
+  for( Index j = 0; j < (Index)k; ++j )
+  {
+    // Find pivot and test for singularity
+    Index p = j;
+    auto A_pj = Abs( A(j,j) );
+    for( Index i = j+1; i < (Index)m; ++i )
+    {
+      const auto A_ij = Abs( A(i,j) );
+      if( A_ij > A_pj )
+      { A_pj = A_ij; p = i; }
+    }
+    piv_[j] = p;
+
+    // The column is exactly zero, so it has nothing to eliminate.
+    if( IsZero( A_pj ) )
+    {
+      if( result.i < 0 )
+      { result.i = j; }
+      continue;
+    }
+
+    // Apply the interchange to columns 0:n-1
+    if( p != j )
+    {
+      for( Index c = 0; c < (Index)n; ++c )
+      { Swap( A(j,c), A(p,c) ); }
+    }
+
+    // Compute elements j+1:m-1 of the j-th column
+    if( Abs( A(j,j) ) >= minValue< Scalar > )
+    {
+      const Scalar rA_jj = Inv( A(j,j) );
+      for( Index i = j+1; i < (Index)m; ++i )
+      { A(i,j) *= rA_jj; }
+    }
+    else
+    {
+      for( Index i = j+1; i < (Index)m; ++i )
+      { A(i,j) /= A(j,j); }
+    }
+
+    // Update the trailing submatrix
+    for( Index c = j+1; c < (Index)n; ++c )
+    {
+      for( Index i = j+1; i < (Index)m; ++i )
+      { A(i,c) -= A(i,j)*A(j,c); }
+    }
+  }
+
+  return result;
+}
+
 }// namespace BLAS
 }// namespace Math
 }// namespace IND
@@ -0,0 +1,391 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+namespace _n_Impl {
+
+  // LU of one group of W interleaved N by N matrices: element (i,j)
+  // of lane l is A[(i + j*N)*W + l]. Every lane runs the same
+  // instruction stream: the pivot search is compare and select and
+  // the interchange a per-lane gather, so the innermost loops over
+  // lanes carry no branches and vectorize.
+  template< Size N, Size W,
+    typename T_Scalar,
+    typename T_Index >
+  constexpr void _Mat_Fctr_LU_Ilv(
+    T_Scalar *__restrict A,
+    T_Index *__restrict piv,
+    T_Index *__restrict info )
+  {
+    auto a = [&]( Index i, Index j ) -> T_Scalar *
+    { return A + (i + j*(Index)N)*(Index)W; };
+
+    for( Size l = 0; l < W; ++l )
+    { info[l] = -1; }
+
+    for( Index k = 0; k < (Index)N; ++k )
+    {
+      T_Scalar amax[W] = {};
+      T_Index p[W] = {};
+
+      // Find the pivot of each lane
+      {
+        const T_Scalar *A_k = a( k, k );
+        for( Size l = 0; l < W; ++l )
+        { amax[l] = Abs( A_k[l] ); p[l] = (T_Index)k; }
+      }
+      for( Index i = k+1; i < (Index)N; ++i )
+      {
+        const T_Scalar *A_i = a( i, k );
+        for( Size l = 0; l < W; ++l )
+        {
+          const T_Scalar v = Abs( A_i[l] );
+          const bool gt = ( v > amax[l] );
+          amax[l] = gt ? v : amax[l];
+          p[l] = gt ? (T_Index)i : p[l];
+        }
+      }
+      for( Size l = 0; l < W; ++l )
+      { piv[k*(Index)W + l] = p[l]; }
+
+      // Interchange rows k and p, lane by lane. When p(l) = k both
+      // stores write back the value that was read.
+      for( Index j = 0; j < (Index)N; ++j )
+      {
+        T_Scalar *A_j = a( 0, j );
+        for( Size l = 0; l < W; ++l )
+        {
+          const Index kl = k*(Index)W + l;
+          const Index pl = (Index)p[l]*(Index)W + l;
+          const T_Scalar x = A_j[kl], y = A_j[pl];
+          A_j[pl] = x;
+          A_j[kl] = y;
+        }
+      }
+
+      // Test for singularity. A zero pivot means the whole column
+      // is zero; scaling by one then leaves it, and the update
+      // below, unchanged.
+      T_Scalar d[W] = {};
+      bool tiny = false;
+      {
+        const T_Scalar *A_k = a( k, k );
+        for( Size l = 0; l < W; ++l )
+        {
+          const bool z = IsZero( A_k[l] );
+          info[l] = ( z && ( info[l] < 0 ) ) ? (T_Index)k : info[l];
+          d[l] = z ? unit< T_Scalar > : A_k[l];
+          tiny |= ( Abs( d[l] ) < minValue< T_Scalar > );
+        }
+      }
+
+      // Compute elements k+1:N-1 of the column, dividing only
+      // when some pivot is too small for its reciprocal. The result
+      // is also kept in c, so that the update below reads the
+      // multipliers from storage that cannot alias A.
+      T_Scalar c[N][W];
+      if( ! tiny )
+      {
+        for( Size l = 0; l < W; ++l )
+        { d[l] = Inv( d[l] ); }
+        for( Index i = k+1; i < (Index)N; ++i )
+        {
+          T_Scalar *A_i = a( i, k );
+          for( Size l = 0; l < W; ++l )
+          { c[i][l] = A_i[l] *= d[l]; }
+        }
+      }
+      else
+      {
+        for( Index i = k+1; i < (Index)N; ++i )
+        {
+          T_Scalar *A_i = a( i, k );
+          for( Size l = 0; l < W; ++l )
+          { c[i][l] = A_i[l] /= d[l]; }
+        }
+      }
+
+      // Update the trailing submatrix
+      for( Index j = k+1; j < (Index)N; ++j )
+      {
+        T_Scalar u[W];
+        {
+          const T_Scalar *A_kj = a( k, j );
+          for( Size l = 0; l < W; ++l )
+          { u[l] = A_kj[l]; }
+        }
+        for( Index i = k+1; i < (Index)N; ++i )
+        {
+          T_Scalar *A_ij = a( i, j );
+          for( Size l = 0; l < W; ++l )
+          { A_ij[l] -= c[i][l]*u[l]; }
+        }
+      }
+    }
+  }
+
+  // Solves op(A)*x = b for one group of W interleaved systems
+  // factored by _Mat_Fctr_LU_Ilv; element i of lane l of b is
+  // b[i*W + l].
+  template< Size N, Size W,
+    typename T_Scalar,
+    typename T_Index >
+  constexpr void _Mat_Solv_LU_Ilv( Trnsp A_trnsp,
+    const T_Scalar *__restrict A,
+    const T_Index *__restrict piv,
+    T_Scalar *__restrict b )
+  {
+    auto a = [&]( Index i, Index j ) -> const T_Scalar *
+    { return A + (i + j*(Index)N)*(Index)W; };
+    auto x = [&]( Index i ) -> T_Scalar *
+    { return b + i*(Index)W; };
+
+    // Interchanges b(k) and b(piv(k)) lane by lane
+    auto Piv_Swp = [&]( Index k )
+    {
+      const T_Index *p = piv + k*(Index)W;
+      for( Size l = 0; l < W; ++l )
+      {
+        const Index kl = k*(Index)W + l;
+        const Index pl = (Index)p[l]*(Index)W + l;
+        const T_Scalar u = b[kl], v = b[pl];
+        b[pl] = u;
+        b[kl] = v;
+      }
+    };
+
+    if( Trnsp::No == A_trnsp )
+    {
+      // Apply row interchanges to the right hand sides.
+      for( Index k = 0; k < (Index)N; ++k )
+      { Piv_Swp( k ); }
+
+      // Solve L*x = b, overwriting b with x.
+      for( Index k = 0; k < (Index)N; ++k )
+      {
+        const T_Scalar *b_k = x( k );
+        for( Index i = k+1; i < (Index)N; ++i )
+        {
+          const T_Scalar *A_ik = a( i, k );
+          T_Scalar *b_i = x( i );
+          for( Size l = 0; l < W; ++l )
+          { b_i[l] -= A_ik[l]*b_k[l]; }
+        }
+      }
+
+      // Solve U*x = b, overwriting b with x.
+      for( Index k = (Index)N-1; k >= 0; --k )
+      {
+        T_Scalar *b_k = x( k );
+        {
+          const T_Scalar *A_kk = a( k, k );
+          for( Size l = 0; l < W; ++l )
+          { b_k[l] /= A_kk[l]; }
+        }
+        for( Index i = 0; i < k; ++i )
+        {
+          const T_Scalar *A_ik = a( i, k );
+          T_Scalar *b_i = x( i );
+          for( Size l = 0; l < W; ++l )
+          { b_i[l] -= A_ik[l]*b_k[l]; }
+        }
+      }
+    }
+    else
+    {
+      // Solve (~U)*x = b, overwriting b with x.
+      for( Index i = 0; i < (Index)N; ++i )
+      {
+        T_Scalar *b_i = x( i );
+        for( Index k = 0; k < i; ++k )
+        {
+          const T_Scalar *A_ki = a( k, i );
+          const T_Scalar *b_k = x( k );
+          for( Size l = 0; l < W; ++l )
+          { b_i[l] -= A_ki[l]*b_k[l]; }
+        }
+        const T_Scalar *A_ii = a( i, i );
+        for( Size l = 0; l < W; ++l )
+        { b_i[l] /= A_ii[l]; }
+      }
+
+      // Solve (~L)*x = b, overwriting b with x.
+      for( Index i = (Index)N-1; i >= 0; --i )
+      {
+        T_Scalar *b_i = x( i );
+        for( Index k = i+1; k < (Index)N; ++k )
+        {
+          const T_Scalar *A_ki = a( k, i );
+          const T_Scalar *b_k = x( k );
+          for( Size l = 0; l < W; ++l )
+          { b_i[l] -= A_ki[l]*b_k[l]; }
+        }
+      }
+
+      // Apply row interchanges to the solution vectors, last first.
+      for( Index k = (Index)N-1; k >= 0; --k )
+      { Piv_Swp( k ); }
+    }
+  }
+
+}// namespace _n_Impl
+
+/// <summary>
+/// Computes the LU factorizations of count N-by-N matrices stored
+/// one after another, matrix b at A_ + b*A_bs with leading dimension
+/// A_ld, and its pivots at piv_ + b*piv_bs.
+///
+/// Each factorization has the contract of <see cref="Mat_Fctr_LU"/>:
+/// info_[b] is -1 on success, otherwise the first i with U(i,i)
+/// exactly zero.
+/// </summary>
+/// <remarks>
+/// Meant for many small systems (say N &lt;= 32), where the setup
+/// of the recursive code costs more than the arithmetic. N is a
+/// template parameter so that the kernel unrolls; for batches of
+/// Float32/Float64 matrices see also <see cref="Mat_Fctr_LU_Ilv"/>.
+/// </remarks>
+template< Size N, typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_piv,
+  typename T_Arr_info >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+         && isNativeSignedIntegral< Decay<DerefTypeOf<T_Arr_piv>> > )
+constexpr void Mat_Fctr_LU_Bat(
+  Size count,
+  T_Blk_A A_, Stride A_ld, Stride A_bs,
+  T_Arr_piv piv_, Stride piv_bs,
+  T_Arr_info info_ )
+{
+  if( A_ld < Lyt::DenseLd( N, N ) )
+  { throw BadArgument{ "Mat_Fctr_LU_Bat", 3 }; }
+  if( A_bs < (Stride)(N*N) )
+  { throw BadArgument{ "Mat_Fctr_LU_Bat", 4 }; }
+  if( piv_bs < (Stride)N )
+  { throw BadArgument{ "Mat_Fctr_LU_Bat", 6 }; }
+
+  for( Index b = 0; b < (Index)count; ++b )
+  {
+    info_[b] = Mat_Fctr_LU< N, N, Lyt >(
+      A_ + b*A_bs, A_ld, piv_ + b*piv_bs ).i;
+  }
+}
+
+/// <summary>
+/// Solves op(A)*x = b for each of count systems factored by
+/// <see cref="Mat_Fctr_LU_Bat"/>; right hand side b is stored
+/// at b_ + b*b_bs with element stride b_s.
+/// </summary>
+template< Size N, typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_piv,
+  typename T_Vec_b >
+constexpr void Mat_Solv_LU_Bat( Trnsp A_trnsp,
+  Size count,
+  T_Blk_A A_, Stride A_ld, Stride A_bs,
+  T_Arr_piv piv_, Stride piv_bs,
+  T_Vec_b b_, Stride b_s, Stride b_bs )
+{
+  if( ( Trnsp::No != A_trnsp ) && ( Trnsp::Yes != A_trnsp ) && ( Trnsp::Conj != A_trnsp ) )
+  { throw BadArgument{ "Mat_Solv_LU_Bat", 1 }; }
+
+  for( Index b = 0; b < (Index)count; ++b )
+  {
+    Mat_Solv_LU< Lyt >( A_trnsp, N,
+      A_ + b*A_bs, A_ld, piv_ + b*piv_bs, b_ + b*b_bs, b_s );
+  }
+}
+
+/// <summary>
+/// Number of matrices held side by side in one group of the
+/// interleaved batch layout: one 64-byte line of T_Scalar.
+/// </summary>
+template< typename T_Scalar >
+inline constexpr Size Mat_LU_Ilv_Width = Max( (Size)(64/sizeof( T_Scalar )), (Size)1 );
+
+/// <summary>
+/// Number of elements for count interleaved objects of len elements
+/// each (N*N for a matrix, N for pivots or a right hand side),
+/// rounded up to whole groups of width w.
+/// </summary>
+inline constexpr Size Mat_LU_Ilv_Size( Size len, Size count, Size w ) noexcept
+{ return ((count + w - 1)/w)*w*len; }
+
+/// <summary>
+/// Computes the LU factorizations of count N-by-N matrices stored
+/// interleaved: with W = Mat_LU_Ilv_Width&lt;T_Scalar&gt;, element (i,j)
+/// of matrix b is
+///
+///   A[(b/W)*N*N*W + (i + j*N)*W + b%W]
+///
+/// pivot k of matrix b is piv[(b/W)*N*W + k*W + b%W], and info[b] is
+/// as for <see cref="Mat_Fctr_LU_Bat"/>.
+///
+/// The factorization of W matrices proceeds in lockstep, one lane per
+/// matrix, so the arithmetic runs at full SIMD width even for N = 4.
+/// </summary>
+/// <remarks>
+/// A, piv and info must be sized for whole groups (see
+/// <see cref="Mat_LU_Ilv_Size"/>); lanes past count are factored
+/// too, so their contents must be finite, but they are not reported.
+/// </remarks>
+template< Size N,
+  typename T_Scalar,
+  typename T_Index >
+requires( ( N > 0 ) && ! isComplex< T_Scalar > && isNativeSignedIntegral< T_Index > )
+constexpr void Mat_Fctr_LU_Ilv(
+  Size count,
+  T_Scalar *A,
+  T_Index *piv,
+  T_Index *info )
+{
+  constexpr Size W = Mat_LU_Ilv_Width< T_Scalar >;
+
+  for( Size g = 0; g*W < count; ++g )
+  {
+    T_Index info_g[W] = {};
+
+    _n_Impl::_Mat_Fctr_LU_Ilv< N, W >( A + g*N*N*W, piv + g*N*W, info_g );
+
+    for( Size l = 0; ( l < W ) && ( g*W + l < count ); ++l )
+    { info[g*W + l] = info_g[l]; }
+  }
+}
+
+/// <summary>
+/// Solves op(A)*x = b for each of count systems factored by
+/// <see cref="Mat_Fctr_LU_Ilv"/>. The right hand sides are
+/// interleaved like the pivots: element i of b for system s is
+/// b[(s/W)*N*W + i*W + s%W]; b is overwritten by x.
+/// </summary>
+template< Size N,
+  typename T_Scalar,
+  typename T_Index >
+requires( ( N > 0 ) && ! isComplex< T_Scalar > && isNativeSignedIntegral< T_Index > )
+constexpr void Mat_Solv_LU_Ilv( Trnsp A_trnsp,
+  Size count,
+  const T_Scalar *A,
+  const T_Index *piv,
+  T_Scalar *b )
+{
+  if( ( Trnsp::No != A_trnsp ) && ( Trnsp::Yes != A_trnsp ) && ( Trnsp::Conj != A_trnsp ) )
+  { throw BadArgument{ "Mat_Solv_LU_Ilv", 1 }; }
+
+  constexpr Size W = Mat_LU_Ilv_Width< T_Scalar >;
+
+  for( Size g = 0; g*W < count; ++g )
+  {
+    _n_Impl::_Mat_Solv_LU_Ilv< N, W >( A_trnsp,
+      A + g*N*N*W, piv + g*N*W, b + g*N*W );
+  }
+}
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
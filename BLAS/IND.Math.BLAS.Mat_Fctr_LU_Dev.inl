@@ -0,0 +1,133 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+/// <summary>
+/// Panel width of the hybrid host-device factorizations,
+/// <see cref="Mat_Fctr_LU_Dev"/> and <see cref="Mat_Fctr_QR_Dev"/>,
+/// unless given.
+/// </summary>
+inline constexpr Size Mat_Fctr_Dev_PnlSize = 128;
+
+/// <summary>
+/// Calculates the size of the host workspace required for
+/// <see cref="Mat_Fctr_LU_Dev"/>: one m by nb panel.
+/// </summary>
+inline constexpr Size Mat_Fctr_LU_Dev_WorkSize( Size m, Size nb = Mat_Fctr_Dev_PnlSize ) noexcept
+{ return m*nb; }
+
+/// <summary>
+/// Computes an LU factorization of a general m by n matrix A in the
+/// memory of a device (see <see cref="Device"/>), using partial
+/// pivoting with row interchanges, with the same result and pivot
+/// contract as <see cref="Mat_Fctr_LU"/>; piv is on the host.
+///
+/// The panels of nb columns are factored on the host by
+/// <see cref="Mat_Fctr_LU_Blk"/> with config, and the rest of A is
+/// updated on the device, with one look-ahead: the next panel is
+/// updated first and downloaded, so that the host factors it while the
+/// device updates the columns past it.
+/// </summary>
+/// <returns>
+/// A <see cref="Mat_Fctr_LU_Result"/> describing the status of the factorization.
+/// </returns>
+/// <remarks>
+/// Moves each panel to the host and back once, against the Level-3
+/// update of all the columns to its right on the device.
+///
+/// work must hold <see cref="Mat_Fctr_LU_Dev_WorkSize"/>( m, nb ) elements.
+/// </remarks>
+template< typename T_Device,
+  typename T_Arr_piv >
+requires( Device< T_Device >
+         && isNativeSignedIntegral< Decay<DerefTypeOf<T_Arr_piv>> > )
+Mat_Fctr_LU_Result Mat_Fctr_LU_Dev(
+  Size m, Size n,
+  Dev_Ptr< T_Device > A_, Stride A_ld,
+  T_Arr_piv piv_,
+  typename T_Device::Scalar *work,
+  Size nb = Mat_Fctr_Dev_PnlSize,
+  const Mat_Fctr_LU_Config &config = {} )
+{
+  using Scalar = typename T_Device::Scalar;
+
+  const Size k = Min( m, n );
+
+  IND_MATH_TRACE_SCOPE( "Mat_Fctr_LU_Dev", m, n, nb,
+    _n_Impl::_Trace_Flops_LU( m, n ), 2.0*m*n*sizeof( Scalar ) );
+
+  if( 0 == nb ){ throw BadArgument{ "Mat_Fctr_LU_Dev", 7 }; }
+
+  Mat_Fctr_LU_Result result{ true };
+  if( 0 == k ){ return result; }
+
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return ColMajor::BlkPtr( A_, i, j, A_ld ); };
+
+  const Scalar one = unit< Scalar >;
+
+  // The panel on the host, rows j:m-1 of columns j:j+w-1
+  Scalar *P_ = work;
+  const Stride P_ld = (Stride)m;
+
+  auto Fctr = [&]( Size j, Size w )
+  {
+    const auto Fctr_j = Mat_Fctr_LU_Blk< ColMajor >( m-j, w, P_, P_ld, piv_ + j, config );
+
+    result.success = result.success && Fctr_j.success;
+    if( ( result.i < 0 ) && ( Fctr_j.i >= 0 ) )
+    { result.i = Fctr_j.i + (Index)j; }
+    for( Size i = j; i < j + Min( w, m-j ); ++i )
+    { piv_[i] += (Index)j; }
+  };
+
+  Mat_Copy< ColMajor, ColMajor >( m, Min( k, nb ), A_, A_ld, P_, P_ld );
+  Fctr( 0, Min( k, nb ) );
+
+  for( Size j = 0; j < k; j += nb )
+  {
+    const Size w = Min( k-j, nb );
+    const Size j1 = j+w;
+
+    Mat_Copy< ColMajor, ColMajor >( m-j, w, P_, P_ld, A_Blk(j,j), A_ld );
+
+    // The interchanges of the panel, on the columns either side of it
+    Mat_RowSwp< ColMajor >( j, A_, A_ld, (Index)j, (Index)j1-1, piv_ );
+    if( j1 >= n ){ continue; }
+    Mat_RowSwp< ColMajor >( n-j1, A_Blk(0,j1), A_ld, (Index)j, (Index)j1-1, piv_ );
+
+    // U12 and A22 -= L21*U12, on the columns of the next panel first
+    auto Updt = [&]( Size c, Size nc )
+    {
+      Tri_Solv_Mat< ColMajor >( Side::Left, Half::Lower, Trnsp::No, Diag::IsUnit,
+        w, nc, one, A_Blk(j,j), A_ld, A_Blk(j,c), A_ld );
+      Mat_MatMul< ColMajor >( Trnsp::No, Trnsp::No,
+        m-j1, nc, w, -one, A_Blk(j1,j), A_ld, A_Blk(j,c), A_ld, one, A_Blk(j1,c), A_ld );
+    };
+
+    const Size w1 = ( j1 < k ) ? Min( k-j1, nb ) : 0;
+
+    Updt( j1, ( w1 > 0 ) ? w1 : n-j1 );
+
+    if( w1 > 0 )
+    {
+      Mat_Copy< ColMajor, ColMajor >( m-j1, w1, A_Blk(j1,j1), A_ld, P_, P_ld );
+      if( j1+w1 < n ){ Updt( j1+w1, n-j1-w1 ); }
+      Fctr( j1, w1 );
+    }
+  }
+
+  A_.device->Sync();
+
+  return result;
+}
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
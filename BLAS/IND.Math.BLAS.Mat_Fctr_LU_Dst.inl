@@ -0,0 +1,263 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Mat_Fctr_LU_Dst"/> on the calling process: two panels of
+/// its local rows, its part of a block row, and a row.
+/// </summary>
+template< typename T_Grid, typename T_Scalar >
+Size Mat_Fctr_LU_Dst_WorkSize( const Dst_Matrix< T_Grid, T_Scalar > &A ) noexcept
+{
+  const Size mr = A.LocRows(), nc = A.LocCols();
+  return 2*mr*A.nb + A.nb*nc + Max( nc, A.nb );
+}
+
+namespace _n_Impl {
+
+  // Candidate pivot of one process: the largest magnitude of its part
+  // of a column, and the row of the first one; row < 0 if it has none.
+  template< typename T_Scalar >
+  struct _Dst_Piv
+  {
+    T_Scalar abs;
+    Index row;
+  };
+
+  // Factors columns j:j+jb-1 of A in place, on the processes of their
+  // process column, as Mat_Fctr_LU does with one column at a time:
+  // the pivot search and each pivot row go over the process column.
+  template< typename T_Grid, typename T_Scalar >
+  Index _Mat_Fctr_LU_Dst_Pnl( const Dst_Matrix< T_Grid, T_Scalar > &A,
+    Size j, Size jb, Index *piv_, T_Scalar *row,
+    std::vector< _Dst_Piv< T_Scalar > > &cand )
+  {
+    T_Grid &grid = *A.grid;
+    const Size P = grid.Rows(), nb = A.nb;
+    const Index p = grid.Row();
+    const Size mr = A.LocRows();
+    const Size lj = (Size)Dst_LocIdx( (Index)j, nb, grid.Cols() );
+
+    auto A_ = [&]( Size li, Size lj ) -> T_Scalar &
+    { return ColMajor::MatRef( A.loc, li, lj, A.ld ); };
+
+    Index info = -1;
+
+    for( Size c = 0; c < jb; ++c )
+    {
+      const Index jj = (Index)( j+c );
+      const Size lc = lj+c;
+      const Size r0 = Dst_LocSize( (Size)jj, nb, p, P );
+
+      // Find pivot and test for singularity
+      _Dst_Piv< T_Scalar > best{ -unit< T_Scalar >, -1 };
+      for( Size lr = r0; lr < mr; ++lr )
+      {
+        const T_Scalar a = Abs( A_( lr, lc ) );
+        if( a > best.abs ){ best = { a, Dst_GlbIdx( (Index)lr, nb, p, P ) }; }
+      }
+      grid.AllGather( Dst_Scope::Col, &best, 1, cand.data() );
+      for( const auto &other : cand )
+      {
+        if( ( other.row >= 0 ) && ( ( other.abs > best.abs )
+          || ( ( other.abs == best.abs ) && ( ( best.row < 0 ) || ( other.row < best.row ) ) ) ) )
+        { best = other; }
+      }
+      piv_[jj] = best.row;
+
+      // The column is exactly zero, so it has nothing to eliminate.
+      if( IsZero( best.abs ) )
+      {
+        if( info < 0 ){ info = jj; }
+        continue;
+      }
+
+      // Apply the interchange to the panel, and share the pivot row
+      _Dst_RowSwp( A, jj, best.row, lj, jb, row );
+
+      const Index p_jj = Dst_Owner( jj, nb, P );
+      if( p == p_jj )
+      {
+        const Size lr = (Size)Dst_LocIdx( jj, nb, P );
+        for( Size cc = c; cc < jb; ++cc ){ row[cc-c] = A_( lr, lj+cc ); }
+      }
+      grid.Bcast( Dst_Scope::Col, p_jj, row, jb-c );
+
+      // Compute the multipliers and update the rest of the panel
+      const Size r1 = Dst_LocSize( (Size)jj+1, nb, p, P );
+      if( Abs( row[0] ) >= minValue< T_Scalar > )
+      {
+        const T_Scalar rA_jj = Inv( row[0] );
+        for( Size lr = r1; lr < mr; ++lr ){ A_( lr, lc ) *= rA_jj; }
+      }
+      else
+      {
+        for( Size lr = r1; lr < mr; ++lr ){ A_( lr, lc ) /= row[0]; }
+      }
+
+      Mat_Rank1Upd< ColMajor >( mr-r1, jb-c-1, -unit< T_Scalar >,
+        ColMajor::BlkPtr( A.loc, r1, lc, A.ld ), 1, row + 1, 1,
+        ColMajor::BlkPtr( A.loc, r1, lc+1, A.ld ), A.ld );
+    }
+
+    return info;
+  }
+
+}// namespace _n_Impl
+
+/// <summary>
+/// Computes an LU factorization of a general m by n matrix A laid out
+/// 2-D block-cyclically on a grid of processes (see
+/// <see cref="Dst_Matrix"/>), using partial pivoting with row
+/// interchanges, with the same result and pivot contract as
+/// <see cref="Mat_Fctr_LU"/>. Every process of the grid calls it, with
+/// its own A, and gets all of piv.
+///
+/// Each panel of nb columns is factored by its process column and
+/// broadcast along the process rows; its row of U, solved by its
+/// process row, is broadcast down the process columns, and each
+/// process then updates its local part of the trailing matrix with one
+/// <see cref="Mat_MatMul"/>. With one panel of look-ahead, the process
+/// column of the next panel updates and factors it first, and starts
+/// its broadcast before the rest of its update, so the panels are
+/// factored and sent while the other processes update.
+/// </summary>
+/// <returns>
+/// A <see cref="Mat_Fctr_LU_Result"/> describing the status of the
+/// factorization, the same on all processes.
+/// </returns>
+/// <remarks>
+/// Based on the ScaLAPACK routine <c>pdgetrf</c>, with the look-ahead
+/// of HPL.
+///
+/// piv must hold Min( m, n ) indices; work must hold
+/// <see cref="Mat_Fctr_LU_Dst_WorkSize"/>( A ) elements.
+/// </remarks>
+template< typename T_Grid, typename T_Scalar >
+requires( ! isComplex< T_Scalar > )
+Mat_Fctr_LU_Result Mat_Fctr_LU_Dst(
+  const Dst_Matrix< T_Grid, T_Scalar > &A,
+  Index *piv_,
+  T_Scalar *work )
+{
+  const Size m = A.m, n = A.n, nb = A.nb;
+  const Size k = Min( m, n );
+
+  IND_MATH_TRACE_SCOPE( "Mat_Fctr_LU_Dst", m, n, nb,
+    _n_Impl::_Trace_Flops_LU( m, n ), 2.0*A.LocRows()*A.LocCols()*sizeof( T_Scalar ) );
+
+  if( 0 == nb ){ throw BadArgument{ "Mat_Fctr_LU_Dst", 1 }; }
+
+  Mat_Fctr_LU_Result result{ true };
+  if( 0 == k ){ return result; }
+
+  T_Grid &grid = *A.grid;
+  const Size P = grid.Rows(), Q = grid.Cols();
+  const Index p = grid.Row(), q = grid.Col();
+  const Size mr = A.LocRows(), nc = A.LocCols();
+
+  const T_Scalar one = unit< T_Scalar >;
+
+  auto RowStart = [&]( Size i ) -> Size { return Dst_LocSize( i, nb, p, P ); };
+  auto ColStart = [&]( Size j ) -> Size { return Dst_LocSize( j, nb, q, Q ); };
+  auto A_Blk = [&]( Size li, Size lj ) -> T_Scalar *
+  { return ColMajor::BlkPtr( A.loc, li, lj, A.ld ); };
+
+  // Two panels, one being applied while the next is sent; U12; a row
+  T_Scalar *L_[2] = { work, work + mr*nb };
+  T_Scalar *U_ = work + 2*mr*nb;
+  T_Scalar *row = U_ + nb*nc;
+
+  std::vector< _n_Impl::_Dst_Piv< T_Scalar > > cand( P );
+  Index info[2] = { -1, -1 };
+  typename T_Grid::Request requests[2][3];
+
+  // Factors panel j on its process column, then starts its broadcast
+  // along the process rows, rows RowStart( j ):mr-1 of it
+  auto Fctr = [&]( Size j, Size jb, Size s )
+  {
+    const Index q_j = Dst_Owner( (Index)j, nb, Q );
+    const Size r0 = RowStart( j ), L_ld = mr-r0;
+    if( q == q_j )
+    {
+      info[s] = _n_Impl::_Mat_Fctr_LU_Dst_Pnl( A, j, jb, piv_, row, cand );
+      Mat_Copy< ColMajor, ColMajor >( L_ld, jb, A_Blk( r0, ColStart( j ) ), A.ld, L_[s], (Stride)L_ld );
+    }
+    requests[s][0] = grid.IBcast( Dst_Scope::Row, q_j, L_[s], L_ld*jb );
+    requests[s][1] = grid.IBcast( Dst_Scope::Row, q_j, piv_ + j, jb );
+    requests[s][2] = grid.IBcast( Dst_Scope::Row, q_j, &info[s], 1 );
+  };
+
+  Fctr( 0, Min( k, nb ), 0 );
+
+  for( Size j = 0, s = 0; j < k; j += nb, s = 1-s )
+  {
+    const Size jb = Min( k-j, nb );
+    const Size j1 = j+jb;
+
+    for( auto &request : requests[s] ){ grid.Wait( request ); }
+    if( ( result.i < 0 ) && ( info[s] >= 0 ) ){ result.i = info[s]; }
+
+    // Apply the interchanges to the columns either side of the panel
+    const Size c0 = ColStart( j1 );
+    for( Size i = j; i < j1; ++i )
+    {
+      _n_Impl::_Dst_RowSwp( A, (Index)i, piv_[i], 0, ColStart( j ), row );
+      _n_Impl::_Dst_RowSwp( A, (Index)i, piv_[i], c0, nc-c0, row );
+    }
+    if( j1 >= n ){ continue; }
+
+    // U12 := L11^-1 A12 on the process row of the panel, sent down
+    const Index p_j = Dst_Owner( (Index)j, nb, P );
+    const Size ncr = nc-c0;
+    const Size r0 = RowStart( j ), L_ld = mr-r0;
+    if( p == p_j )
+    {
+      Tri_Solv_Mat< ColMajor >( Side::Left, Half::Lower, Trnsp::No, Diag::IsUnit,
+        jb, ncr, one, L_[s], (Stride)L_ld, A_Blk( r0, c0 ), A.ld );
+      Mat_Copy< ColMajor, ColMajor >( jb, ncr, A_Blk( r0, c0 ), A.ld, U_, (Stride)jb );
+    }
+    grid.Bcast( Dst_Scope::Col, p_j, U_, jb*ncr );
+
+    // A22 -= L21*U12 on local columns c:c+ncl-1
+    const Size r1 = RowStart( j1 );
+    auto Updt = [&]( Size c, Size ncl )
+    {
+      Mat_MatMul< ColMajor >( Trnsp::No, Trnsp::No, mr-r1, ncl, jb, -one,
+        L_[s] + ( r1-r0 ), (Stride)L_ld, U_ + ( c-c0 )*jb, (Stride)jb,
+        one, A_Blk( r1, c ), A.ld );
+    };
+
+    if( j1 >= k )
+    {
+      Updt( c0, ncr );
+      continue;
+    }
+
+    const Size w1 = Min( k-j1, nb );
+    if( q == Dst_Owner( (Index)j1, nb, Q ) )
+    {
+      Updt( c0, w1 );
+      Fctr( j1, w1, 1-s );
+      Updt( c0+w1, ncr-w1 );
+    }
+    else
+    {
+      Fctr( j1, w1, 1-s );
+      Updt( c0, ncr );
+    }
+  }
+
+  return result;
+}
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
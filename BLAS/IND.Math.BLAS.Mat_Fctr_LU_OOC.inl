@@ -0,0 +1,149 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Mat_Fctr_LU_OOC"/>: four m by nb panels.
+/// </summary>
+inline constexpr Size Mat_Fctr_LU_OOC_WorkSize( Size m, Size nb = Mat_Fctr_OOC_PnlSize ) noexcept
+{ return 4*m*nb; }
+
+/// <summary>
+/// Computes an LU factorization of a general m by n matrix A kept
+/// out of core in store (see <see cref="PanelStore"/>), using partial
+/// pivoting with row interchanges, with the same result and pivot
+/// contract as <see cref="Mat_Fctr_LU"/>.
+///
+/// This is the left-looking variant: the panels of nb columns are
+/// factored in turn, each first updated by all the panels of L to its
+/// left, streamed through memory one at a time. Only the panel being
+/// factored, the panel of L being applied, and the next ones of each
+/// are resident, the next ones read on another thread while the
+/// current ones are used. A panel is factored in core by
+/// <see cref="Mat_Fctr_LU_Blk"/> with config, and written back once.
+/// </summary>
+/// <returns>
+/// A <see cref="Mat_Fctr_LU_Result"/> describing the status of the factorization.
+/// </returns>
+/// <remarks>
+/// Reads about n*n/(2*nb) columns of A in all, against n for an in
+/// core factorization; nb trades memory for traffic. The interchanges
+/// of later panels are applied to the columns of L in one last pass.
+///
+/// work must hold <see cref="Mat_Fctr_LU_OOC_WorkSize"/>( m, nb ) elements.
+/// </remarks>
+template< typename T_Store,
+  typename T_Arr_piv >
+requires( PanelStore< T_Store >
+         && ! isComplex< typename T_Store::Scalar >
+         && isNativeSignedIntegral< Decay<DerefTypeOf<T_Arr_piv>> > )
+Mat_Fctr_LU_Result Mat_Fctr_LU_OOC(
+  T_Store &store,
+  T_Arr_piv piv_,
+  typename T_Store::Scalar *work,
+  Size nb = Mat_Fctr_OOC_PnlSize,
+  const Mat_Fctr_LU_Config &config = {} )
+{
+  using Scalar = typename T_Store::Scalar;
+
+  const Size m = store.Rows();
+  const Size n = store.Cols();
+  const Size k = Min( m, n );
+
+  IND_MATH_TRACE_SCOPE( "Mat_Fctr_LU_OOC", m, n, nb,
+    _n_Impl::_Trace_Flops_LU( m, n ), 2.0*m*n*sizeof( Scalar ) );
+
+  if( 0 == nb ){ throw BadArgument{ "Mat_Fctr_LU_OOC", 4 }; }
+
+  Mat_Fctr_LU_Result result{ true };
+  if( 0 == k ){ return result; }
+
+  const Stride ld = (Stride)m;
+
+  // The panel being factored, the next one, and two for L
+  Scalar *P_ = work;
+  Scalar *N_ = work + m*nb;
+  Scalar *L0_ = work + 2*m*nb;
+  Scalar *L1_ = work + 3*m*nb;
+
+  auto ahead = _n_Impl::_Pnl_Fetch( store, 0, Min( n, nb ), P_ );
+
+  for( Size j = 0; j < n; j += nb )
+  {
+    const Size w = Min( n-j, nb );
+
+    // Later columns are not touched before their turn, so the next
+    // panel can be read while this one is factored
+    ahead.get();
+    if( j+nb < n )
+    { ahead = _n_Impl::_Pnl_Fetch( store, j+nb, Min( n-j-nb, nb ), N_ ); }
+
+    // Columns of L to the left of the panel
+    const Size jk = Min( j, k );
+
+    if( jk > 0 )
+    {
+      Mat_RowSwp< ColMajor >( w, P_, ld, 0, (Index)jk-1, piv_ );
+
+      _n_Impl::_Pnl_Sweep( store, jk, nb, L0_, L1_, [&]( Size c, Size wc, Scalar *L_ )
+      {
+        const Size c1 = c+wc;
+
+        // Rows of L as the interchanges of the panels since left them
+        if( c1 < jk )
+        { Mat_RowSwp< ColMajor >( wc, L_, ld, (Index)c1, (Index)jk-1, piv_ ); }
+
+        Tri_Solv_Mat_Rec< ColMajor >( Side::Left, Half::Lower, Trnsp::No, Diag::IsUnit,
+          wc, w, unit< Scalar >,
+          L_ + c, ld,
+          P_ + c, ld );
+
+        if( c1 < m )
+        {
+          Mat_MatMul< ColMajor >( Trnsp::No, Trnsp::No,
+            m-c1, w, wc, -unit< Scalar >,
+            L_ + c1, ld,
+            P_ + c, ld, unit< Scalar >,
+            P_ + c1, ld );
+        }
+      } );
+    }
+
+    if( j < k )
+    {
+      const auto Fctr_j = Mat_Fctr_LU_Blk< ColMajor >( m-j, w, P_ + j, ld, piv_ + j, config );
+
+      result.success = result.success && Fctr_j.success;
+      if( ( result.i < 0 ) && ( Fctr_j.i >= 0 ) )
+      { result.i = Fctr_j.i + (Index)j; }
+      for( Size i = j; i < j + Min( w, m-j ); ++i )
+      { piv_[i] += (Index)j; }
+    }
+
+    store.Write( (Index)j, w, P_, ld );
+    std::swap( P_, N_ );
+  }
+
+  // Interchanges of the later panels, deferred for the columns of L
+  _n_Impl::_Pnl_Sweep( store, k, nb, L0_, L1_, [&]( Size c, Size wc, Scalar *L_ )
+  {
+    if( c+wc < k )
+    {
+      Mat_RowSwp< ColMajor >( wc, L_, ld, (Index)( c+wc ), (Index)k-1, piv_ );
+      store.Write( (Index)c, wc, L_, ld );
+    }
+  } );
+
+  return result;
+}
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
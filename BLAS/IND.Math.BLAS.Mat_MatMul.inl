@@ -18,13 +18,20 @@ namespace BLAS {
 /// </summary>
 /// <remarks>
 /// Based on the BLAS routine <c>dgemm</c>.
+///
+/// For Float32/Float64 pointers in ColMajor or RowMajor layout,
+/// large products are routed through the packed engine, with the
+/// blocking of <see cref="Aux_PkdMatMul_Blocking"/>; everything else,
+/// including constant evaluation, uses the column-by-column
+/// <see cref="Mat_VecMul"/> formulation below.
 /// </remarks>
 template< typename Lyt = ColMajor,
   typename T_Scalar,
   typename T_Blk_A,
   typename T_Blk_B,
   typename T_Blk_C >
-requires( requires( T_Blk_A A_, T_Blk_B B_, T_Blk_C C_, T_Scalar u )
+requires( ! isTileMajor< Lyt >
+  && requires( T_Blk_A A_, T_Blk_B B_, T_Blk_C C_, T_Scalar u )
 { { (*C_) = u*(*A_)*(*B_) + u*(*C_) }; } )
 constexpr void Mat_MatMul(
   Trnsp A_trnsp, Trnsp B_trnsp,
@@ -35,11 +42,14 @@ constexpr void Mat_MatMul(
   const T_Scalar &beta,
   T_Blk_C C_, Stride C_ld )
 {
+  IND_MATH_TRACE_SCOPE( "Mat_MatMul", m, n, k,
+    2.0*m*n*k, ( (double)m*k + (double)k*n + 2.0*m*n )*sizeof( *C_ ) );
+
   if( (0 == m) || (0 == n) || (0 == k) ){ return; }
   if( IsZero( alpha ) && IsUnit( beta ) ){ return; }
 
-  const Stride C_rs = Lyt::RowStride( C_, C_ld );
-  const Stride C_cs = Lyt::ColStride( C_, C_ld );
+  const auto C_rs = Lyt::RowStride( C_, C_ld );
+  const auto C_cs = Lyt::ColStride( C_, C_ld );
 
   if( IsZero( alpha ) )
   {
@@ -72,7 +82,7 @@ constexpr void Mat_MatMul(
         for( Index j = 0; j < (Index)n; ++j )
         {
           const auto C_col = Lyt::ColPtr( C_, 0, j, C_ld );
-          Vec_Scale< Lyt >( n, beta, C_col, 1 );
+          Vec_Scale< Lyt >( m, beta, C_col, 1 );
         }
       }
       else
@@ -81,7 +91,7 @@ constexpr void Mat_MatMul(
         for( Index i = 0; i < (Index)m; ++i )
         {
           const auto C_row = Lyt::RowPtr( C_, i, 0, C_ld );
-          Vec_Scale< Lyt >( m, beta, C_row, 1 );
+          Vec_Scale< Lyt >( n, beta, C_row, 1 );
         }
       }
     }
@@ -89,8 +99,54 @@ constexpr void Mat_MatMul(
     return;
   }
 
-  const Stride B_rs = Lyt::RowStride( B_, B_ld );
-  const Stride B_cs = Lyt::ColStride( B_, B_ld );
+  if constexpr ( isPkdMatMul< Lyt, T_Blk_A, T_Blk_B, T_Blk_C > )
+  {
+    using Scalar = Decay<DerefTypeOf<T_Blk_C>>;
+
+    if( ! std::is_constant_evaluated()
+     && ( m*n*k >= _n_Impl::_PkdMatMul_Blk< Scalar >().minVolume ) )
+    {
+      // C := beta*C
+      if( ! IsUnit( beta ) )
+      {
+        if constexpr ( isColMajor< Lyt > )
+        {
+          for( Index j = 0; j < (Index)n; ++j )
+          { Vec_Scale< Lyt >( m, beta, Lyt::ColPtr( C_, 0, j, C_ld ), 1 ); }
+        }
+        else
+        {
+          for( Index i = 0; i < (Index)m; ++i )
+          { Vec_Scale< Lyt >( n, beta, Lyt::RowPtr( C_, i, 0, C_ld ), 1 ); }
+        }
+      }
+
+      // Element strides of op(A), op(B) and C along
+      // their row index and column index respectively.
+      const auto A_cs = Lyt::ColStride( A_, A_ld );
+      const auto A_rs = Lyt::RowStride( A_, A_ld );
+      const auto B_cs = Lyt::ColStride( B_, B_ld );
+      const auto B_rs = Lyt::RowStride( B_, B_ld );
+
+      const bool A_t = ( Trnsp::No != A_trnsp );
+      const bool B_t = ( Trnsp::No != B_trnsp );
+
+      // C := alpha*op(A)*op(B) + C
+      _n_Impl::_PkdMatMul< Scalar >( m, n, k, alpha,
+        A_, A_t ? A_rs : A_cs, A_t ? A_cs : A_rs,
+        B_, B_t ? B_rs : B_cs, B_t ? B_cs : B_rs,
+        C_, C_cs, C_rs );
+
+      return;
+    }
+  }
+
+  const auto B_rs = Lyt::RowStride( B_, B_ld );
+  const auto B_cs = Lyt::ColStride( B_, B_ld );
+
+  // Mat_VecMul takes the dimensions of A as stored, not of %A.
+  const Size A_m = ( Trnsp::No == A_trnsp ) ? m : k;
+  const Size A_n = ( Trnsp::No == A_trnsp ) ? k : m;
 
   switch( B_trnsp )
   {
@@ -103,7 +159,7 @@ constexpr void Mat_MatMul(
       {
         const auto B_col = Lyt::ColPtr( B_, 0, j, B_ld );
         const auto C_col = Lyt::ColPtr( C_, 0, j, C_ld );
-        Mat_VecMul< Lyt >( A_trnsp, m, k, alpha, A_, A_ld, B_col, B_cs, beta, C_col, C_cs );
+        Mat_VecMul< Lyt >( A_trnsp, A_m, A_n, alpha, A_, A_ld, B_col, B_cs, beta, C_col, C_cs );
       }
     }
     break;
@@ -117,7 +173,7 @@ constexpr void Mat_MatMul(
       {
         const auto B_row = Lyt::RowPtr( B_, i, 0, B_ld );
         const auto C_col = Lyt::ColPtr( C_, 0, i, C_ld );
-        Mat_VecMul< Lyt >( A_trnsp, m, k, alpha, A_, A_ld, B_row, B_rs, beta, C_col, C_cs );
+        Mat_VecMul< Lyt >( A_trnsp, A_m, A_n, alpha, A_, A_ld, B_row, B_rs, beta, C_col, C_cs );
       }
     }
     break;
@@ -131,13 +187,240 @@ constexpr void Mat_MatMul(
       {
         const auto B_row = Lyt::RowPtr( B_, i, 0, B_ld );
         const auto C_col = Lyt::ColPtr( C_, 0, i, C_ld );
-        Mat_ConjVecMul< Lyt >( A_trnsp, m, k, alpha, A_, A_ld, B_row, B_rs, beta, C_col, C_cs );
+        Mat_ConjVecMul< Lyt >( A_trnsp, A_m, A_n, alpha, A_, A_ld, B_row, B_rs, beta, C_col, C_cs );
       }
     }
     break;
   }
 }
 
+/// <summary>
+/// Computes C := alpha*op(A)*op(B) + beta*C, as <see cref="Mat_MatMul"/>
+/// does, for dimensions m, n and k fixed at compile time.
+/// </summary>
+/// <remarks>
+/// Meant for small products (3 by 3, 4 by 4): every loop has a
+/// constant trip count and unrolls completely, nothing is dispatched
+/// at run time but the element strides of op(A) and op(B), and the
+/// product can be evaluated at compile time.
+/// </remarks>
+template< Size m, Size n, Size k,
+  typename Lyt = ColMajor,
+  typename T_Scalar,
+  typename T_Blk_A,
+  typename T_Blk_B,
+  typename T_Blk_C >
+requires( requires( T_Blk_A A_, T_Blk_B B_, T_Blk_C C_, T_Scalar u )
+{ { (*C_) = u*(*A_)*(*B_) + u*(*C_) }; } )
+constexpr void Mat_MatMul(
+  Trnsp A_trnsp, Trnsp B_trnsp,
+  const T_Scalar &alpha,
+  T_Blk_A A_, Stride A_ld,
+  T_Blk_B B_, Stride B_ld,
+  const T_Scalar &beta,
+  T_Blk_C C_, Stride C_ld )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_C>>;
+
+  auto C = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( C_, i, j, C_ld ); };
+
+  // Element strides of op(A) and op(B) along their row index
+  // and column index respectively.
+  const bool A_t = ( Trnsp::No != A_trnsp );
+  const bool B_t = ( Trnsp::No != B_trnsp );
+  const Stride A_is = A_t ? Lyt::RowStride( A_, A_ld ) : Lyt::ColStride( A_, A_ld );
+  const Stride A_ls = A_t ? Lyt::ColStride( A_, A_ld ) : Lyt::RowStride( A_, A_ld );
+  const Stride B_ls = B_t ? Lyt::RowStride( B_, B_ld ) : Lyt::ColStride( B_, B_ld );
+  const Stride B_js = B_t ? Lyt::ColStride( B_, B_ld ) : Lyt::RowStride( B_, B_ld );
+
+  auto opA = [&]( Index i, Index l ) -> Scalar
+  {
+    const Scalar a = *( A_ + ( i*A_is + l*A_ls ) );
+    if constexpr ( isComplex< Scalar > )
+    { if( Trnsp::Conj == A_trnsp ){ return Conj( a ); } }
+    return a;
+  };
+  auto opB = [&]( Index l, Index j ) -> Scalar
+  {
+    const Scalar b = *( B_ + ( l*B_ls + j*B_js ) );
+    if constexpr ( isComplex< Scalar > )
+    { if( Trnsp::Conj == B_trnsp ){ return Conj( b ); } }
+    return b;
+  };
+
+  for( Index j = 0; j < (Index)n; ++j )
+  {
+    for( Index i = 0; i < (Index)m; ++i )
+    {
+      Scalar u{};
+      for( Index l = 0; l < (Index)k; ++l )
+      { u += opA(i,l)*opB(l,j); }
+
+      C(i,j) = IsZero( beta ) ? alpha*u : alpha*u + beta*C(i,j);
+    }
+  }
+}
+
+/// <summary>
+/// Computes C := alpha*op(A)*op(B) + beta*C as <see cref="Mat_MatMul"/>
+/// does, with the work split through the execution context exec
+/// (see <see cref="ExecContext"/>).
+/// </summary>
+/// <remarks>
+/// The columns of C, or its rows if there are more of them, are split
+/// into one range per thread of at least <see cref="Exec_SplitMin"/>;
+/// each range is an independent product. With <see cref="Exec_Seq"/>
+/// this is the serial overload, also in constant evaluation.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Scalar,
+  typename T_Blk_A,
+  typename T_Blk_B,
+  typename T_Blk_C,
+  typename T_Exec >
+requires( ! isTileMajor< Lyt >
+  && requires( T_Blk_A A_, T_Blk_B B_, T_Blk_C C_, T_Scalar u )
+{ { (*C_) = u*(*A_)*(*B_) + u*(*C_) }; }
+  && ExecContext< Decay<T_Exec> > )
+constexpr void Mat_MatMul(
+  Trnsp A_trnsp, Trnsp B_trnsp,
+  Size m, Size n, Size k,
+  const T_Scalar &alpha,
+  T_Blk_A A_, Stride A_ld,
+  T_Blk_B B_, Stride B_ld,
+  const T_Scalar &beta,
+  T_Blk_C C_, Stride C_ld,
+  T_Exec &&exec )
+{
+  if constexpr ( ! _n_Impl::_isExecSeq< T_Exec > )
+  {
+    const bool A_t = ( Trnsp::No != A_trnsp );
+    const bool B_t = ( Trnsp::No != B_trnsp );
+
+    if( n >= m )
+    {
+      _n_Impl::_Exec_Split( exec, n, Exec_SplitMin, [&]( Index j0, Size nt )
+      {
+        Mat_MatMul< Lyt >( A_trnsp, B_trnsp, m, nt, k, alpha,
+          A_, A_ld,
+          B_t ? Lyt::BlkPtr( B_, j0, 0, B_ld ) : Lyt::BlkPtr( B_, 0, j0, B_ld ), B_ld, beta,
+          Lyt::BlkPtr( C_, 0, j0, C_ld ), C_ld );
+      } );
+    }
+    else
+    {
+      _n_Impl::_Exec_Split( exec, m, Exec_SplitMin, [&]( Index i0, Size mt )
+      {
+        Mat_MatMul< Lyt >( A_trnsp, B_trnsp, mt, n, k, alpha,
+          A_t ? Lyt::BlkPtr( A_, 0, i0, A_ld ) : Lyt::BlkPtr( A_, i0, 0, A_ld ), A_ld,
+          B_, B_ld, beta,
+          Lyt::BlkPtr( C_, i0, 0, C_ld ), C_ld );
+      } );
+    }
+  }
+  else
+  {
+    Mat_MatMul< Lyt >( A_trnsp, B_trnsp, m, n, k, alpha,
+      A_, A_ld, B_, B_ld, beta, C_, C_ld );
+  }
+}
+
+/// <summary>
+/// Computes C := alpha*op(A)*op(B) + beta*C as <see cref="Mat_MatMul"/>
+/// does, for A, B and C in <see cref="TileMajor"/> storage, with the
+/// work split through the execution context exec (see
+/// <see cref="ExecContext"/>).
+/// </summary>
+/// <remarks>
+/// Each tile of C takes one ColMajor product per tile of the inner
+/// dimension, on operands that are contiguous B by B blocks already,
+/// so whatever the packed engine copies of them stays in cache. The
+/// tile columns of C are split as the exec overload of the
+/// cross-layout <see cref="Mat_Copy"/> splits them, so storage filled
+/// that way is worked on by the same ranges.
+/// </remarks>
+template< typename Lyt,
+  typename T_Scalar,
+  typename T_Blk_A,
+  typename T_Blk_B,
+  typename T_Blk_C,
+  typename T_Exec >
+requires( isTileMajor< Lyt >
+  && requires( T_Blk_A A_, T_Blk_B B_, T_Blk_C C_, T_Scalar u )
+{ { (*C_) = u*(*A_)*(*B_) + u*(*C_) }; }
+  && ExecContext< Decay<T_Exec> > )
+constexpr void Mat_MatMul(
+  Trnsp A_trnsp, Trnsp B_trnsp,
+  Size m, Size n, Size k,
+  const T_Scalar &alpha,
+  T_Blk_A A_, Stride A_ld,
+  T_Blk_B B_, Stride B_ld,
+  const T_Scalar &beta,
+  T_Blk_C C_, Stride C_ld,
+  T_Exec &&exec )
+{
+  if( (0 == m) || (0 == n) || (0 == k) ){ return; }
+  if( IsZero( alpha ) && IsUnit( beta ) ){ return; }
+
+  constexpr Size B = Lyt::tileSize;
+  constexpr Stride T_ld = (Stride)B;
+
+  const bool A_t = ( Trnsp::No != A_trnsp );
+  const bool B_t = ( Trnsp::No != B_trnsp );
+
+  const Size mt = (m+B-1)/B;
+  const Size nt = (n+B-1)/B;
+  const Size kt = (k+B-1)/B;
+
+  _n_Impl::_Exec_Split( exec, nt, (Exec_SplitMin+B-1)/B, [&]( Index J0, Size nj )
+  {
+    for( Index J = J0; J < J0+(Index)nj; ++J )
+    {
+      const Size jb = Min( B, n-(Size)J*B );
+      for( Index I = 0; I < (Index)mt; ++I )
+      {
+        const Size ib = Min( B, m-(Size)I*B );
+        for( Index K = 0; K < (Index)kt; ++K )
+        {
+          const Size kb = Min( B, k-(Size)K*B );
+          Mat_MatMul< ColMajor >( A_trnsp, B_trnsp, ib, jb, kb, alpha,
+            A_t ? Lyt::TilePtr( A_, K, I, A_ld ) : Lyt::TilePtr( A_, I, K, A_ld ), T_ld,
+            B_t ? Lyt::TilePtr( B_, J, K, B_ld ) : Lyt::TilePtr( B_, K, J, B_ld ), T_ld,
+            ( 0 == K ) ? beta : unit< T_Scalar >,
+            Lyt::TilePtr( C_, I, J, C_ld ), T_ld );
+        }
+      }
+    }
+  } );
+}
+
+/// <summary>
+/// Computes C := alpha*op(A)*op(B) + beta*C as <see cref="Mat_MatMul"/>
+/// does, for A, B and C in <see cref="TileMajor"/> storage, one tile
+/// product at a time.
+/// </summary>
+template< typename Lyt,
+  typename T_Scalar,
+  typename T_Blk_A,
+  typename T_Blk_B,
+  typename T_Blk_C >
+requires( isTileMajor< Lyt >
+  && requires( T_Blk_A A_, T_Blk_B B_, T_Blk_C C_, T_Scalar u )
+{ { (*C_) = u*(*A_)*(*B_) + u*(*C_) }; } )
+constexpr void Mat_MatMul(
+  Trnsp A_trnsp, Trnsp B_trnsp,
+  Size m, Size n, Size k,
+  const T_Scalar &alpha,
+  T_Blk_A A_, Stride A_ld,
+  T_Blk_B B_, Stride B_ld,
+  const T_Scalar &beta,
+  T_Blk_C C_, Stride C_ld )
+{
+  Mat_MatMul< Lyt >( A_trnsp, B_trnsp, m, n, k, alpha,
+    A_, A_ld, B_, B_ld, beta, C_, C_ld, Exec_Seq{} );
+}
+
 }// namespace BLAS
 }// namespace Math
 }// namespace IND
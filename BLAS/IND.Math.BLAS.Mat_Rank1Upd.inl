@@ -18,7 +18,9 @@ template< typename Lyt = ColMajor,
   typename T_Scalar,
   typename T_Vec_x,
   typename T_Vec_y,
-  typename T_Blk_A >
+  typename T_Blk_A,
+  StrideArg T_Stride_x,
+  StrideArg T_Stride_y >
 requires( ! isComplex< T_Scalar >
   && areTheSame< T_Scalar,
   Decay<DerefTypeOf<T_Vec_x>>,
@@ -27,8 +29,8 @@ requires( ! isComplex< T_Scalar >
 constexpr void Mat_Rank1Upd(
   Size m, Size n,
   const T_Scalar &alpha,
-  T_Vec_x x_, Stride x_s,
-  T_Vec_y y_, Stride y_s,
+  T_Vec_x x_, T_Stride_x x_s,
+  T_Vec_y y_, T_Stride_y y_s,
   T_Blk_A A_, Stride A_ld )
 {
   auto x = [&]( auto i ) -> const auto &
@@ -28,7 +28,7 @@ constexpr void Mat_RowSwp(
   if( 0 == n )
   { return; }
 
-  const Stride A_rs = Lyt::RowStride( A_, A_ld );
+  const auto A_rs = Lyt::RowStride( A_, A_ld );
 
   for( Index i = k0; i <= k1; ++i )
   {
@@ -36,11 +36,11 @@ constexpr void Mat_Scale( Side side,
   auto B_Col = [&]( auto i, auto j ) -> auto
   { return Lyt::ColPtr( B_, i, j, A_ld ); };
 
-  const Stride A_rs = Lyt::RowStride( A_, A_ld );
-  const Stride A_cs = Lyt::ColStride( A_, A_ld );
+  const auto A_rs = Lyt::RowStride( A_, A_ld );
+  const auto A_cs = Lyt::ColStride( A_, A_ld );
 
-  const Stride B_rs = Lyt::RowStride( B_, B_ld );
-  const Stride B_cs = Lyt::ColStride( B_, B_ld );
+  const auto B_rs = Lyt::RowStride( B_, B_ld );
+  const auto B_cs = Lyt::ColStride( B_, B_ld );
 
   if( Side::Right == side )
   {
@@ -55,6 +55,67 @@ constexpr void Mat_Scale( Side side,
   }
 }
 
+/// <summary>
+/// B := alpha*A
+/// or B := alpha*(~A)
+/// 
+/// B is m by n
+/// A is m by n
+/// (~A) is n by m
+/// 
+/// The A and B buffers must be distinct. The transposes of whole real
+/// matrices in <see cref="ColMajor"/> or <see cref="RowMajor"/> run in
+/// cache-sized tiles, as in <see cref="Mat_Copy"/>.
+/// </summary>
+template< typename Lyt = ColMajor,
+  typename T_Scalar,
+  typename T_Blk_A,
+  typename T_Blk_B >
+requires( requires( T_Scalar alpha, T_Blk_A A_, T_Blk_B B_ ){ { B_[0] = alpha*A_[0] }; } )
+constexpr void Mat_Scale( Trnsp A_trnsp,
+  Size m, Size n,
+  const T_Scalar &alpha,
+  T_Blk_A A_, Stride A_ld,
+  T_Blk_B B_, Stride B_ld )
+{
+  auto A = [&]( auto i, auto j ) -> const auto &
+  { return Lyt::MatRef( A_, i, j, A_ld ); };
+  auto B = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( B_, i, j, B_ld ); };
+
+  if( Trnsp::No == A_trnsp )
+  {
+    if constexpr ( isColMajor< Lyt > )
+    {
+      for( Index j = 0; j < (Index)n; ++j )
+      {
+        Vec_Scale< Lyt >( m, alpha,
+          Lyt::ColPtr( A_, 0, j, A_ld ), Lyt::ColStride( A_, A_ld ),
+          Lyt::ColPtr( B_, 0, j, B_ld ), Lyt::ColStride( B_, B_ld ) );
+      }
+    }
+    else
+    {
+      for( Index i = 0; i < (Index)m; ++i )
+      {
+        Vec_Scale< Lyt >( n, alpha,
+          Lyt::RowPtr( A_, i, 0, A_ld ), Lyt::RowStride( A_, A_ld ),
+          Lyt::RowPtr( B_, i, 0, B_ld ), Lyt::RowStride( B_, B_ld ) );
+      }
+    }
+    return;
+  }
+
+  if( _n_Impl::_Mat_TrnspKrnl< Lyt >( n, m, alpha, A_, A_ld, {}, B_, B_ld ) )
+  { return; }
+
+  for( Index j = 0; j < (Index)n; ++j )
+  {
+    for( Index i = 0; i < (Index)m; ++i )
+    { B(i,j) = alpha*( ( Trnsp::Conj == A_trnsp ) ? Conj( A(j,i) ) : A(j,i) ); }
+  }
+}
+
 }// namespace BLAS
 }// namespace Math
 }// namespace IND
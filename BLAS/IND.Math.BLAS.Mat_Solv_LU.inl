@@ -65,9 +65,91 @@ void Mat_Solv_LU( Trnsp A_trnsp,
       Tri_Solv_Vec< Lyt >( Half::Lower, A_trnsp, Diag::IsUnit,
         n, A_, A_ld, b_, b_s );
 
-      // Apply row interchanges to the solution vectors.
-      //Mat_RowSwp< Lyt >( 1, b_, b_s, 0, (Index)(n-1), piv_ );
-      Vec_PivSwp< Lyt >( b_,b_s, 0, (Index)(n-1), piv_ );
+      // Apply row interchanges to the solution vectors, last first,
+      // so that P is undone rather than applied a second time.
+      for( Index i = (Index)(n-1); i >= 0; --i )
+      {
+        const Index i1 = piv_[i];
+        if( i != i1 )
+        { Swap( Lyt::VecRef( b_, i, b_s ), Lyt::VecRef( b_, i1, b_s ) ); }
+      }
+    }
+    break;
+  }
+}
+
+/// <summary>
+/// DGETRS solves a system of linear equations
+///   A * X = B  or  (~A)*X = B
+/// with a general N-by-N matrix A using the LU factorization computed
+/// by Mat_Fctr_LU, for the nrhs columns of B at once.
+///
+/// B is overwritten by X on output. The triangular solves are
+/// <see cref="Tri_Solv_Mat_Rec"/>, so with many right hand sides most
+/// of the work runs in <see cref="Mat_MatMul"/>.
+/// </summary>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_piv,
+  typename T_Blk_B
+>
+void Mat_Solv_LU( Trnsp A_trnsp,
+  Size n, Size nrhs,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_piv piv_,
+  T_Blk_B B_, Stride B_ld )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_B>>;
+
+  auto B_Row = [&]( auto i, auto j ) -> auto
+  { return Lyt::RowPtr( B_, i, j, B_ld ); };
+
+  // Quick return if possible
+  if( ( 0 == n ) || ( 0 == nrhs ) )
+  { return; }
+
+  switch( A_trnsp )
+  {
+  default:
+    {}throw BadArgument{ "Mat_Solv_LU", 1 };
+  case Trnsp::No:
+    {
+      // Solve A*X = B.
+
+      // Apply row interchanges to the right hand sides.
+      Mat_RowSwp< Lyt >( nrhs, B_, B_ld, 0, (Index)(n-1), piv_ );
+
+      // Solve L*X = B, overwriting B with X.
+      Tri_Solv_Mat_Rec< Lyt >( Side::Left, Half::Lower, Trnsp::No, Diag::IsUnit,
+        n, nrhs, unit< Scalar >, A_, A_ld, B_, B_ld );
+
+      // Solve U*X = B, overwriting B with X.
+      Tri_Solv_Mat_Rec< Lyt >( Side::Left, Half::Upper, Trnsp::No, Diag::NotUnit,
+        n, nrhs, unit< Scalar >, A_, A_ld, B_, B_ld );
+    }
+    break;
+
+  case Trnsp::Yes:
+  case Trnsp::Conj:
+    {
+      // Solve (~A)*X = B or Conj(~A)*X = B
+
+      // Solve (~U)*X = B, overwriting B with X.
+      Tri_Solv_Mat_Rec< Lyt >( Side::Left, Half::Upper, A_trnsp, Diag::NotUnit,
+        n, nrhs, unit< Scalar >, A_, A_ld, B_, B_ld );
+
+      // Solve L**T *X = B, overwriting B with X.
+      Tri_Solv_Mat_Rec< Lyt >( Side::Left, Half::Lower, A_trnsp, Diag::IsUnit,
+        n, nrhs, unit< Scalar >, A_, A_ld, B_, B_ld );
+
+      // Apply row interchanges to the solution, last first.
+      const auto B_rs = Lyt::RowStride( B_, B_ld );
+      for( Index i = (Index)(n-1); i >= 0; --i )
+      {
+        const Index i1 = piv_[i];
+        if( i != i1 )
+        { Vec_Swap< Lyt >( nrhs, B_Row(i,0), B_rs, B_Row(i1,0), B_rs ); }
+      }
     }
     break;
   }
@@ -0,0 +1,320 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+/// <summary>
+/// Largest number of refinement steps <see cref="Mat_Solv_Refined"/>
+/// takes before it falls back to the factorization in the working
+/// precision.
+/// </summary>
+inline constexpr Size Mat_Solv_Refined_IterMax = 30;
+
+/// <summary>
+/// Size of the workspace, in the working precision, of
+/// <see cref="Mat_Solv_Refined"/>.
+/// </summary>
+inline constexpr Size Mat_Solv_Refined_WorkSize( Size n, Size nrhs ) noexcept
+{ return n*nrhs; }
+
+/// <summary>
+/// Size of the workspace, in the lower precision, of
+/// <see cref="Mat_Solv_Refined"/>.
+/// </summary>
+inline constexpr Size Mat_Solv_Refined_SWorkSize( Size n, Size nrhs ) noexcept
+{ return n*( n+nrhs ); }
+
+struct Mat_Solv_Refined_Result
+{
+  bool success = false;
+
+  // If i >= 0, U(i,i) of the factorization in the working precision
+  // is exactly zero, and X has not been computed.
+  Index i = -1;
+
+  // Whether X came from the factorization in the lower precision,
+  // and the number of refinement steps it took.
+  bool refined = false;
+  Size iterCount = 0;
+
+  constexpr inline operator bool () const noexcept
+  { return this->success; }
+
+  IND_NOTHROW_VITAE( Mat_Solv_Refined_Result );
+
+  constexpr Mat_Solv_Refined_Result( bool success, Index i = -1 ) noexcept
+  : success{ success }, i{ i }
+  {}
+};
+
+namespace _n_Impl {
+
+  // SA := A, rounded to the lower precision; false if an element of
+  // A is out of its range.
+  template< typename Lyt, typename T_Blk_A, typename T_Blk_SA >
+  constexpr bool _Mat_Solv_Refined_Down( Size m, Size n,
+    T_Blk_A A_, Stride A_ld, T_Blk_SA SA_, Stride SA_ld )
+  {
+    using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+    using SScalar = Decay<DerefTypeOf<T_Blk_SA>>;
+
+    const Scalar rmax = (Scalar)maxValue< SScalar >;
+
+    for( Index j = 0; j < (Index)n; ++j )
+    {
+      for( Index i = 0; i < (Index)m; ++i )
+      {
+        const Scalar a = Lyt::MatRef( A_, i, j, A_ld );
+        if( ! ( Abs( a ) <= rmax ) ){ return false; }
+        Lyt::MatRef( SA_, i, j, SA_ld ) = (SScalar)a;
+      }
+    }
+    return true;
+  }
+
+}// namespace _n_Impl
+
+/// <summary>
+/// Computes the solution X of the system of linear equations A*X = B,
+/// for the n by n matrix A and the n by nrhs matrices B and X, with
+/// the LU factorization of A in a lower precision, that of swork,
+/// refined to the working precision, that of A.
+///
+/// A is rounded to the lower precision and factored there with
+/// <see cref="Mat_Fctr_LU"/>, through the execution context exec (see
+/// <see cref="ExecContext"/>), and X is solved for with
+/// <see cref="Mat_Solv_LU"/>. Each refinement step forms the residual
+/// R = B - A*X in the working precision with <see cref="Mat_VecMul"/>,
+/// solves A*D = R in the lower one, and adds D to X, until for each
+/// column
+///
+///    max|R(:,j)| &lt;= max|X(:,j)|*||A||*eps*sqrt(n),
+///
+/// with eps that of the working precision and ||A|| its infinity norm.
+///
+/// If A does not fit the lower precision, its factor there is singular,
+/// or iterMax steps are not enough, A is factored in the working
+/// precision instead, overwritten by L and U, and X is solved for from
+/// them; otherwise A is left as it is. piv holds the pivots of the last
+/// factorization either way.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dsgesv</c>.
+///
+/// The n*n*n part of the work runs in the lower precision, which takes
+/// about half the time and half the memory traffic; each step of the
+/// refinement is n*n*nrhs operations.
+///
+/// work must hold <see cref="Mat_Solv_Refined_WorkSize"/>( n, nrhs )
+/// elements of the working precision, and swork
+/// <see cref="Mat_Solv_Refined_SWorkSize"/>( n, nrhs ) of the lower one.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_piv,
+  typename T_Blk_B,
+  typename T_Blk_X,
+  typename T_Arr_work,
+  typename T_Arr_swork,
+  typename T_Exec >
+requires( ! isTileMajor< Lyt > && ! isPacked< Lyt > && ! isRfp< Lyt >
+         && ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+         && ! isComplex< Decay<DerefTypeOf<T_Arr_swork>> >
+         && isNativeSignedIntegral< Decay<DerefTypeOf<T_Arr_piv>> >
+         && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Blk_B>>,
+  Decay<DerefTypeOf<T_Blk_X>>,
+  Decay<DerefTypeOf<T_Arr_work>> >
+         && ExecContext< Decay<T_Exec> > )
+Mat_Solv_Refined_Result Mat_Solv_Refined(
+  Size n, Size nrhs,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_piv piv_,
+  T_Blk_B B_, Stride B_ld,
+  T_Blk_X X_, Stride X_ld,
+  T_Arr_work work,
+  T_Arr_swork swork,
+  T_Exec &&exec,
+  Size iterMax = Mat_Solv_Refined_IterMax )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+  auto A = [&]( auto i, auto j ) -> const auto &
+  { return Lyt::MatRef( A_, i, j, A_ld ); };
+  auto X = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( X_, i, j, X_ld ); };
+  auto X_Col = [&]( auto i, auto j ) -> auto
+  { return Lyt::ColPtr( X_, i, j, X_ld ); };
+  auto B_Col = [&]( auto i, auto j ) -> auto
+  { return Lyt::ColPtr( B_, i, j, B_ld ); };
+
+  if( A_ld < Lyt::DenseLd( Max( (Size)1, n ), Max( (Size)1, n ) ) )
+  { throw BadArgument{ "Mat_Solv_Refined", 4 }; }
+  if( B_ld < Lyt::DenseLd( Max( (Size)1, n ), Max( (Size)1, nrhs ) ) )
+  { throw BadArgument{ "Mat_Solv_Refined", 7 }; }
+  if( X_ld < Lyt::DenseLd( Max( (Size)1, n ), Max( (Size)1, nrhs ) ) )
+  { throw BadArgument{ "Mat_Solv_Refined", 9 }; }
+
+  // Quick return if possible
+  if( ( 0 == n ) || ( 0 == nrhs ) )
+  { return { true }; }
+
+  const Scalar one = unit< Scalar >;
+
+  const Stride R_ld = Lyt::DenseLd( n, nrhs );
+  const Stride SA_ld = Lyt::DenseLd( n, n );
+  const Stride SX_ld = Lyt::DenseLd( n, nrhs );
+
+  const auto R_ = work;
+  const auto SA_ = swork;
+  const auto SX_ = swork + n*n;
+
+  auto R = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( R_, i, j, R_ld ); };
+  auto R_Col = [&]( auto i, auto j ) -> auto
+  { return Lyt::ColPtr( R_, i, j, R_ld ); };
+  auto SX = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( SX_, i, j, SX_ld ); };
+
+  const auto X_cs = Lyt::ColStride( X_, X_ld );
+  const auto B_cs = Lyt::ColStride( B_, B_ld );
+  const auto R_cs = Lyt::ColStride( R_, R_ld );
+
+  // R := B - A*X; true once every column has converged
+  auto Residual = [&]( const Scalar &cte ) -> bool
+  {
+    bool converged = true;
+    for( Index j = 0; j < (Index)nrhs; ++j )
+    {
+      Vec_Copy< Lyt >( n, B_Col(0,j), B_cs, R_Col(0,j), R_cs );
+      Mat_VecMul< Lyt >( Trnsp::No, n, n, -one, A_, A_ld,
+        X_Col(0,j), X_cs, one, R_Col(0,j), R_cs );
+
+      Scalar xnrm = {}, rnrm = {};
+      for( Index i = 0; i < (Index)n; ++i )
+      {
+        xnrm = Max( xnrm, Abs( X(i,j) ) );
+        rnrm = Max( rnrm, Abs( R(i,j) ) );
+      }
+      if( ! ( rnrm <= xnrm*cte ) ){ converged = false; }
+    }
+    return converged;
+  };
+
+  auto Refined = [&]() -> Mat_Solv_Refined_Result
+  {
+    // ||A||, the largest row sum, with R(:,0) for the sums
+    for( Index i = 0; i < (Index)n; ++i ){ R(i,0) = {}; }
+    for( Index j = 0; j < (Index)n; ++j )
+    {
+      for( Index i = 0; i < (Index)n; ++i )
+      { R(i,0) += Abs( A(i,j) ); }
+    }
+    Scalar anrm = {};
+    for( Index i = 0; i < (Index)n; ++i )
+    { anrm = Max( anrm, R(i,0) ); }
+
+    const Scalar cte = anrm*std::numeric_limits< Scalar >::epsilon()*Sqrt( (Scalar)n );
+
+    if( ! _n_Impl::_Mat_Solv_Refined_Down< Lyt >( n, nrhs, B_, B_ld, SX_, SX_ld ) )
+    { return { false }; }
+    if( ! _n_Impl::_Mat_Solv_Refined_Down< Lyt >( n, n, A_, A_ld, SA_, SA_ld ) )
+    { return { false }; }
+
+    if( const auto lu = Mat_Fctr_LU< Lyt >( n, n, SA_, SA_ld, piv_, exec ); lu.i >= 0 )
+    { return { false }; }
+
+    Mat_Solv_LU< Lyt >( Trnsp::No, n, nrhs, SA_, SA_ld, piv_, SX_, SX_ld );
+    for( Index j = 0; j < (Index)nrhs; ++j )
+    {
+      for( Index i = 0; i < (Index)n; ++i )
+      { X(i,j) = (Scalar)SX(i,j); }
+    }
+
+    for( Size iter = 0; ; ++iter )
+    {
+      if( Residual( cte ) )
+      {
+        Mat_Solv_Refined_Result result{ true };
+        result.refined = true;
+        result.iterCount = iter;
+        return result;
+      }
+      if( iter == iterMax ){ return { false }; }
+
+      // X := X + D, where A*D = R in the lower precision
+      if( ! _n_Impl::_Mat_Solv_Refined_Down< Lyt >( n, nrhs, R_, R_ld, SX_, SX_ld ) )
+      { return { false }; }
+      Mat_Solv_LU< Lyt >( Trnsp::No, n, nrhs, SA_, SA_ld, piv_, SX_, SX_ld );
+      for( Index j = 0; j < (Index)nrhs; ++j )
+      {
+        for( Index i = 0; i < (Index)n; ++i )
+        { X(i,j) += (Scalar)SX(i,j); }
+      }
+    }
+  };
+
+  if( auto result = Refined(); result.success )
+  { return result; }
+
+  // Fall back to the working precision
+  const auto lu = Mat_Fctr_LU< Lyt >( n, n, A_, A_ld, piv_, exec );
+  if( lu.i >= 0 )
+  { return { false, lu.i }; }
+
+  Mat_Copy< Lyt >( Half::Both, Trnsp::No, n, nrhs, B_, B_ld, X_, X_ld );
+  Mat_Solv_LU< Lyt >( Trnsp::No, n, nrhs, A_, A_ld, piv_, X_, X_ld );
+  return { true };
+}
+
+/// <summary>
+/// Solves A*X = B by the LU factorization of A in a lower precision,
+/// refined to the working precision, as the overload above does, on
+/// the calling thread.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dsgesv</c>.
+///
+/// work must hold <see cref="Mat_Solv_Refined_WorkSize"/>( n, nrhs )
+/// elements of the working precision, and swork
+/// <see cref="Mat_Solv_Refined_SWorkSize"/>( n, nrhs ) of the lower one.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_piv,
+  typename T_Blk_B,
+  typename T_Blk_X,
+  typename T_Arr_work,
+  typename T_Arr_swork >
+requires( ! isTileMajor< Lyt > && ! isPacked< Lyt > && ! isRfp< Lyt >
+         && ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+         && ! isComplex< Decay<DerefTypeOf<T_Arr_swork>> >
+         && isNativeSignedIntegral< Decay<DerefTypeOf<T_Arr_piv>> >
+         && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Blk_B>>,
+  Decay<DerefTypeOf<T_Blk_X>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+Mat_Solv_Refined_Result Mat_Solv_Refined(
+  Size n, Size nrhs,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_piv piv_,
+  T_Blk_B B_, Stride B_ld,
+  T_Blk_X X_, Stride X_ld,
+  T_Arr_work work,
+  T_Arr_swork swork,
+  Size iterMax = Mat_Solv_Refined_IterMax )
+{
+  return Mat_Solv_Refined< Lyt >( n, nrhs, A_, A_ld, piv_,
+    B_, B_ld, X_, X_ld, work, swork, Exec_Seq{}, iterMax );
+}
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
@@ -4,6 +4,107 @@ namespace IND {
 namespace Math {
 namespace BLAS {
 
+namespace _n_Impl {
+
+  // Lines (rows or columns) of A that the Mat_VecMul kernels take
+  // together, so each element of x or y is loaded once per group.
+  inline constexpr Size _Mat_VecMul_LineCount = 4;
+
+  // The lines a_c = a + c*a_ls, c in 0:cnt-1, each contiguous over len
+  // elements, and unit-stride x:
+  //
+  //   y(c) += alpha * sum_k op(a_c[k])*x[k]
+  //
+  // Each line keeps a block of independent partial sums, as
+  // _VecKrnl_Dot does, so the loop vectorizes without reassociation.
+  template< Size cnt, bool conj,
+    typename T_Scalar,
+    typename T_Blk_a,
+    typename T_Vec_x,
+    typename T_Vec_y,
+    StrideArg T_Stride_y >
+  constexpr void _Mat_VecMul_Dot( Size len, const T_Scalar &alpha,
+    T_Blk_a a, Stride a_ls, T_Vec_x x, T_Vec_y y, T_Stride_y y_s )
+  {
+    using Scalar = Decay<DerefTypeOf<T_Vec_y>>;
+    constexpr Size W = 4;
+
+    auto op = [&]( const auto &u ) -> auto
+    { if constexpr( conj ){ return Conj( u ); }else{ return u; } };
+
+    Scalar acc[cnt][W] = {};
+
+    Size k = 0;
+    for( ; k + W <= len; k += W )
+    {
+      for( Size c = 0; c < cnt; ++c )
+      {
+        for( Size l = 0; l < W; ++l )
+        { acc[c][l] += op( a[(Index)c*a_ls + (Index)(k+l)] )*x[k+l]; }
+      }
+    }
+
+    for( Size c = 0; c < cnt; ++c )
+    {
+      Scalar sum = ( acc[c][0] + acc[c][1] ) + ( acc[c][2] + acc[c][3] );
+      for( Size kk = k; kk < len; ++kk )
+      { sum += op( a[(Index)c*a_ls + (Index)kk] )*x[kk]; }
+      y[(Index)c*y_s] += alpha*sum;
+    }
+  }
+
+  // The same lines and unit-stride y:
+  //
+  //   y[k] += sum_c ( alpha*x(c) )*op(a_c[k])
+  template< Size cnt, bool conj,
+    typename T_Scalar,
+    typename T_Blk_a,
+    typename T_Vec_x,
+    typename T_Vec_y,
+    StrideArg T_Stride_x >
+  constexpr void _Mat_VecMul_AXPlusY( Size len, const T_Scalar &alpha,
+    T_Blk_a a, Stride a_ls, T_Vec_x x, T_Stride_x x_s, T_Vec_y y )
+  {
+    using Scalar = Decay<DerefTypeOf<T_Vec_y>>;
+
+    auto op = [&]( const auto &u ) -> auto
+    { if constexpr( conj ){ return Conj( u ); }else{ return u; } };
+
+    Scalar ax[cnt];
+    for( Size c = 0; c < cnt; ++c )
+    { ax[c] = alpha*x[(Index)c*x_s]; }
+
+    for( Size k = 0; k < len; ++k )
+    {
+      Scalar u = y[k];
+      for( Size c = 0; c < cnt; ++c )
+      { u += ax[c]*op( a[(Index)c*a_ls + (Index)k] ); }
+      y[k] = u;
+    }
+  }
+
+  // Runs kernel< cnt >( i0 ) over the lines 0:count-1 in groups of
+  // _Mat_VecMul_LineCount, with one narrower group at the end.
+  template< typename T_Fn >
+  constexpr void _Mat_VecMul_Lines( Size count, T_Fn &&kernel )
+  {
+    constexpr Size L = _Mat_VecMul_LineCount;
+
+    Index i0 = 0;
+    for( ; i0 + (Index)L <= (Index)count; i0 += (Index)L )
+    { kernel( std::integral_constant< Size, L >{}, i0 ); }
+
+    switch( count - (Size)i0 )
+    {
+    case 3: kernel( std::integral_constant< Size, 3 >{}, i0 ); break;
+    case 2: kernel( std::integral_constant< Size, 2 >{}, i0 ); break;
+    case 1: kernel( std::integral_constant< Size, 1 >{}, i0 ); break;
+    default: break;
+    }
+  }
+
+}// namespace _n_Impl
+
 /// <summary>
 /// Computes:
 ///
@@ -12,14 +113,25 @@ namespace BLAS {
 ///
 /// For a general m by n matrix A
 /// </summary>
-/// <summary>
+/// <remarks>
 /// Based on the BLAS routine <c>dgemv</c>.
-/// </summary>
+///
+/// For ColMajor and RowMajor the loop order is picked from the layout
+/// at compile time, so A is always read along its contiguous lines:
+/// which of the two products is a set of dot products (over columns,
+/// for ColMajor and Trnsp::Yes) and which a sum of scaled lines (for
+/// ColMajor and Trnsp::No), the other way round for RowMajor. Either
+/// kernel takes 4 lines of A at a time. The kernels need unit-stride x
+/// (dot products) or y (scaled lines); other strides take the plain
+/// loops.
+/// </remarks>
 template< typename Lyt = ColMajor,
   typename T_Scalar,
   typename T_Blk_A,
   typename T_Vec_x,
-  typename T_Vec_y >
+  typename T_Vec_y,
+  StrideArg T_Stride_x,
+  StrideArg T_Stride_y >
 requires( requires( T_Blk_A A_, T_Scalar u, T_Vec_x x, T_Vec_y y )
 { { (*y) = u*(*A_)*(*x) + u*(*y) }; } )
 constexpr void Mat_VecMul(
@@ -27,15 +139,60 @@ constexpr void Mat_VecMul(
   Size m, Size n,
   const T_Scalar &alpha,
   T_Blk_A A_, Stride A_ld,
-  T_Vec_x x_, Stride x_s,
+  T_Vec_x x_, T_Stride_x x_s,
   const T_Scalar &beta,
-  T_Vec_y y_, Stride y_s )
+  T_Vec_y y_, T_Stride_y y_s )
 {
   auto x = [&]( auto i ) -> const auto &
   { return Lyt::VecRef( x_, i, x_s ); };
 
-  const Stride A_rs = Lyt::RowStride( A_, A_ld );
-  const Stride A_cs = Lyt::ColStride( A_, A_ld );
+  const auto A_rs = Lyt::RowStride( A_, A_ld );
+  const auto A_cs = Lyt::ColStride( A_, A_ld );
+
+  if constexpr( isColMajor< Lyt > || isRowMajor< Lyt > )
+  {
+    // Lines of A contiguous in memory: columns for ColMajor, rows for
+    // RowMajor. y := alpha*op(A)*x is a dot product per line when op(A)
+    // has them as rows, a sum of scaled lines otherwise.
+    const bool onLines = ( Trnsp::No == A_trnsp ) == isRowMajor< Lyt >;
+    const Size lineCount = isColMajor< Lyt > ? n : m;
+    const Size lineLen = isColMajor< Lyt > ? m : n;
+    const Size y_n = ( Trnsp::No == A_trnsp ) ? m : n;
+
+    if( onLines ? ( 1 == x_s ) : ( 1 == y_s ) )
+    {
+      // y := beta*y
+      Vec_Scale< Lyt >( y_n, beta, y_, y_s );
+
+      if( IsZero( alpha ) )
+      { return; }
+
+      auto Line = [&]( Index i ) -> auto
+      { return isColMajor< Lyt > ? Lyt::ColPtr( A_, 0, i, A_ld ) : Lyt::RowPtr( A_, i, 0, A_ld ); };
+
+      auto Run = [&]< bool conj >()
+      {
+        _n_Impl::_Mat_VecMul_Lines( lineCount, [&]( auto cnt, Index i0 )
+        {
+          if( onLines )
+          {
+            _n_Impl::_Mat_VecMul_Dot< cnt, conj >( lineLen, alpha,
+              Line( i0 ), A_ld, x_, Lyt::VecPtr( y_, i0, y_s ), y_s );
+          }
+          else
+          {
+            _n_Impl::_Mat_VecMul_AXPlusY< cnt, conj >( lineLen, alpha,
+              Line( i0 ), A_ld, Lyt::VecPtr( x_, i0, x_s ), x_s, y_ );
+          }
+        } );
+      };
+
+      if( Trnsp::Conj == A_trnsp )
+      { Run.template operator()< true >(); }else
+      { Run.template operator()< false >(); }
+      return;
+    }
+  }
 
   switch( A_trnsp )
   {
@@ -92,6 +249,63 @@ constexpr void Mat_VecMul(
   }
 }
 
+/// <summary>
+/// Computes y := alpha*op(A)*x + beta*y, as <see cref="Mat_VecMul"/>
+/// does, for an m by n matrix A with m and n fixed at compile time.
+/// </summary>
+/// <remarks>
+/// The loops have constant trip counts and unroll completely for the
+/// small sizes this is meant for; usable in constant expressions.
+/// </remarks>
+template< Size m, Size n,
+  typename Lyt = ColMajor,
+  typename T_Scalar,
+  typename T_Blk_A,
+  typename T_Vec_x,
+  typename T_Vec_y,
+  StrideArg T_Stride_x,
+  StrideArg T_Stride_y >
+requires( requires( T_Blk_A A_, T_Scalar u, T_Vec_x x, T_Vec_y y )
+{ { (*y) = u*(*A_)*(*x) + u*(*y) }; } )
+constexpr void Mat_VecMul(
+  Trnsp A_trnsp,
+  const T_Scalar &alpha,
+  T_Blk_A A_, Stride A_ld,
+  T_Vec_x x_, T_Stride_x x_s,
+  const T_Scalar &beta,
+  T_Vec_y y_, T_Stride_y y_s )
+{
+  using Scalar = Decay<DerefTypeOf<T_Vec_y>>;
+
+  auto A = [&]( auto i, auto j ) -> const auto &
+  { return Lyt::MatRef( A_, i, j, A_ld ); };
+  auto x = [&]( auto i ) -> const auto &
+  { return Lyt::VecRef( x_, i, x_s ); };
+  auto y = [&]( auto i ) -> auto &
+  { return Lyt::VecRef( y_, i, y_s ); };
+
+  if( Trnsp::No == A_trnsp )
+  {
+    for( Index i = 0; i < (Index)m; ++i )
+    {
+      Scalar u{};
+      for( Index j = 0; j < (Index)n; ++j )
+      { u += A(i,j)*x(j); }
+      y(i) = IsZero( beta ) ? alpha*u : alpha*u + beta*y(i);
+    }
+  }
+  else
+  {
+    for( Index j = 0; j < (Index)n; ++j )
+    {
+      Scalar u{};
+      for( Index i = 0; i < (Index)m; ++i )
+      { u += ( ( Trnsp::Conj == A_trnsp ) ? Conj( A(i,j) ) : A(i,j) )*x(i); }
+      y(j) = IsZero( beta ) ? alpha*u : alpha*u + beta*y(j);
+    }
+  }
+}
+
 }// namespace BLAS
 }// namespace Math
 }// namespace IND
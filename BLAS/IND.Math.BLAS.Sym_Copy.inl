@@ -0,0 +1,81 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+/// <summary>
+/// Copies an n by n symmetric matrix from one storage layout to
+/// another:
+///
+/// B := A
+///
+/// where only the half half_A of A is referenced and only the half
+/// half_B of B is written. When the halves differ, the half of A is
+/// written transposed, which is the same matrix.
+///
+/// Lyt_A and Lyt_B may be any two layouts, dense or packed; for
+/// <see cref="PackedLower"/>, <see cref="PackedUpper"/>,
+/// <see cref="RfpLower"/> and <see cref="RfpUpper"/> the half must be
+/// the stored one and the leading dimension is n.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routines <c>dtrttp</c>, <c>dtpttr</c>,
+/// <c>dtrttf</c>, <c>dtfttr</c>, <c>dtpttf</c> and <c>dtfttp</c>.
+/// </remarks>
+template< typename Lyt_A,
+  typename Lyt_B,
+  typename T_Blk_A,
+  typename T_Blk_B >
+requires( requires( const T_Blk_A A_, const T_Blk_B B_ )
+{ { B_[0] = A_[0] }; } )
+constexpr void Sym_Copy(
+  Half half_A, Half half_B,
+  Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Blk_B B_, Stride B_ld )
+{
+  auto A = [&]( auto i, auto j ) -> const auto &
+  { return Lyt_A::MatRef( A_, i, j, A_ld ); };
+  auto B = [&]( auto i, auto j ) -> auto &
+  { return Lyt_B::MatRef( B_, i, j, B_ld ); };
+
+  if( Half::Both == half_A ){ throw BadArgument{ "Sym_Copy", 1 }; }
+  if( Half::Both == half_B ){ throw BadArgument{ "Sym_Copy", 2 }; }
+
+  if constexpr( isPacked< Lyt_A > || isRfp< Lyt_A > )
+  {
+    if( Lyt_A::half != half_A ){ throw BadArgument{ "Sym_Copy", 1 }; }
+  }
+  if constexpr( isPacked< Lyt_B > || isRfp< Lyt_B > )
+  {
+    if( Lyt_B::half != half_B ){ throw BadArgument{ "Sym_Copy", 2 }; }
+  }
+
+  const bool upper = ( Half::Upper == half_B );
+
+  for( Index j = 0; j < (Index)n; ++j )
+  {
+    const Index i0 = upper ? 0 : j;
+    const Index i1 = upper ? j+1 : (Index)n;
+
+    if( half_A == half_B )
+    {
+      for( Index i = i0; i < i1; ++i )
+      { B(i,j) = A(i,j); }
+    }
+    else
+    {
+      for( Index i = i0; i < i1; ++i )
+      { B(i,j) = A(j,i); }
+    }
+  }
+}
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
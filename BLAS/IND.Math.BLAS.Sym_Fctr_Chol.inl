@@ -0,0 +1,400 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+struct Sym_Fctr_Chol_Result
+{
+  bool success = false;
+
+  // If i >= 0, the leading minor of order i+1 is not positive
+  // definite, and the factorization could not be completed.
+  Index i = -1;
+
+  constexpr inline operator bool () const noexcept
+  { return this->success; }
+
+  IND_NOTHROW_VITAE( Sym_Fctr_Chol_Result );
+
+  constexpr Sym_Fctr_Chol_Result( bool success, Index i = -1 ) noexcept
+  : success{ success }, i{ i }
+  {}
+};
+
+/// <summary>
+/// Tuning parameters for <see cref="Sym_Fctr_Chol_Blk"/> and
+/// <see cref="Sym_Fctr_Chol_Par"/>.
+/// </summary>
+struct Sym_Fctr_Chol_Config
+{
+  // Order of the diagonal blocks factored by the recursive code, and
+  // width of the tiles of the parallel update. If nb < 2, or
+  // nb >= n, the whole matrix is factored recursively.
+  Size nb = 64;
+
+  // Threads used by Sym_Fctr_Chol_Par, counting the caller;
+  // 0 means one per hardware thread.
+  Size threadCount = 0;
+};
+
+/// <summary>
+/// Computes the Cholesky factorization of a real symmetric positive
+/// definite n by n matrix A:
+///
+///    A = (~U)*U, if half = Upper, or
+///    A = L*(~L), if half = Lower,
+///
+/// where U is upper and L lower triangular. Only the given half of A
+/// is referenced, and overwritten by the factor.
+///
+/// The matrix is split in two halves of columns, the first is factored
+/// recursively, the off-diagonal block is solved with
+/// <see cref="Tri_Solv_Mat"/>, the second diagonal block updated with
+/// <see cref="Sym_RankKUpd"/> and factored recursively, so that almost
+/// all of the work runs in matrix products, at any cache size.
+/// </summary>
+///<returns>
+/// A <see cref="Sym_Fctr_Chol_Result"/> describing the status of the factorization.
+/// </returns>
+/// <remarks>
+/// Based on the LAPACK routine <c>dpotrf2</c>.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A >
+requires( ! isTileMajor< Lyt > && ! isPacked< Lyt > && ! isRfp< Lyt >
+         && ! isComplex< Decay<DerefTypeOf<T_Blk_A>> > )
+constexpr Sym_Fctr_Chol_Result Sym_Fctr_Chol( Half half,
+  Size n,
+  T_Blk_A A_, Stride A_ld )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+  auto A = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( A_, i, j, A_ld ); };
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+
+  if( ( Half::Upper != half ) && ( Half::Lower != half ) )
+  { throw BadArgument{ "Sym_Fctr_Chol", 1 }; }
+
+  // Quick return if possible
+  if( 0 == n )
+  { return { true }; }
+
+  if( 1 == n )
+  {
+    // Test for non-positive-definiteness, NaN included
+    if( ! ( A(0,0) > Scalar{} ) )
+    { return { false, 0 }; }
+
+    A(0,0) = Sqrt( A(0,0) );
+    return { true };
+  }
+
+  const Size n1 = n/2;
+  const Size n2 = n - n1;
+
+  // Factor A11
+  const auto Fctr_11 = Sym_Fctr_Chol< Lyt >( half, n1, A_, A_ld );
+  if( ! Fctr_11 )
+  { return Fctr_11; }
+
+  if( Half::Upper == half )
+  {
+    // Solve U12 = ~U11 \ A12, and update A22 -= (~U12)*U12
+    Tri_Solv_Mat< Lyt >( Side::Left, Half::Upper, Trnsp::Yes, Diag::NotUnit,
+      n1, n2, unit< Scalar >,
+      A_, A_ld,
+      A_Blk( 0, n1 ), A_ld );
+    Sym_RankKUpd< Lyt >( Half::Upper, Trnsp::Yes,
+      n2, n1, -unit< Scalar >,
+      A_Blk( 0, n1 ), A_ld, unit< Scalar >,
+      A_Blk( n1, n1 ), A_ld );
+  }
+  else
+  {
+    // Solve L21 = A21 / ~L11, and update A22 -= L21*(~L21)
+    Tri_Solv_Mat< Lyt >( Side::Right, Half::Lower, Trnsp::Yes, Diag::NotUnit,
+      n2, n1, unit< Scalar >,
+      A_, A_ld,
+      A_Blk( n1, 0 ), A_ld );
+    Sym_RankKUpd< Lyt >( Half::Lower, Trnsp::No,
+      n2, n1, -unit< Scalar >,
+      A_Blk( n1, 0 ), A_ld, unit< Scalar >,
+      A_Blk( n1, n1 ), A_ld );
+  }
+
+  // Factor A22
+  const auto Fctr_22 = Sym_Fctr_Chol< Lyt >( half, n2, A_Blk( n1, n1 ), A_ld );
+  if( ! Fctr_22 )
+  { return { false, Fctr_22.i + (Index)n1 }; }
+
+  return { true };
+}
+
+namespace _n_Impl {
+
+  // Steps of the blocked Cholesky factorization, on the panel of
+  // rows and columns j:j+jb-1 of A.
+  template< typename Lyt, typename T_Blk_A >
+  struct _Sym_Fctr_Chol_Steps
+  {
+    using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+    Half half;
+    Size n;
+    T_Blk_A A_;
+    Stride A_ld;
+
+    constexpr auto A_Blk( Index i, Index j ) const
+    { return Lyt::BlkPtr( this->A_, i, j, this->A_ld ); }
+
+    // Factors the diagonal block, with the index of a failure
+    // relative to the whole matrix.
+    constexpr Sym_Fctr_Chol_Result Fctr_Diag( Index j, Size jb ) const
+    {
+      const auto Fctr_jj = Sym_Fctr_Chol< Lyt >( this->half, jb, this->A_Blk(j,j), this->A_ld );
+      if( ! Fctr_jj )
+      { return { false, Fctr_jj.i + j }; }
+      return { true };
+    }
+
+    // Solves the off-diagonal block row (Upper) or column (Lower)
+    // of the panel, rows or columns r0:r0+rn-1 of it.
+    constexpr void Solv_Pnl( Index j, Size jb, Index r0, Size rn ) const
+    {
+      if( Half::Upper == this->half )
+      {
+        Tri_Solv_Mat_Rec< Lyt >( Side::Left, Half::Upper, Trnsp::Yes, Diag::NotUnit,
+          jb, rn, unit< Scalar >,
+          this->A_Blk(j,j), this->A_ld,
+          this->A_Blk(j,r0), this->A_ld );
+      }
+      else
+      {
+        Tri_Solv_Mat_Rec< Lyt >( Side::Right, Half::Lower, Trnsp::Yes, Diag::NotUnit,
+          rn, jb, unit< Scalar >,
+          this->A_Blk(j,j), this->A_ld,
+          this->A_Blk(r0,j), this->A_ld );
+      }
+    }
+
+    // Applies the solved panel to the trailing tile c0:c0+cw-1: its
+    // diagonal block, and the rectangle right of it (Upper) or below
+    // it (Lower).
+    constexpr void Updt_Tile( Index j, Size jb, Index c0, Size cw ) const
+    {
+      const Index c1 = c0+(Index)cw;
+      const Size rest = this->n-(Size)c1;
+
+      if( Half::Upper == this->half )
+      {
+        Sym_RankKUpd< Lyt >( Half::Upper, Trnsp::Yes,
+          cw, jb, -unit< Scalar >,
+          this->A_Blk(j,c0), this->A_ld, unit< Scalar >,
+          this->A_Blk(c0,c0), this->A_ld );
+        if( rest > 0 )
+        {
+          Mat_MatMul< Lyt >( Trnsp::Yes, Trnsp::No,
+            cw, rest, jb, -unit< Scalar >,
+            this->A_Blk(j,c0), this->A_ld,
+            this->A_Blk(j,c1), this->A_ld, unit< Scalar >,
+            this->A_Blk(c0,c1), this->A_ld );
+        }
+      }
+      else
+      {
+        Sym_RankKUpd< Lyt >( Half::Lower, Trnsp::No,
+          cw, jb, -unit< Scalar >,
+          this->A_Blk(c0,j), this->A_ld, unit< Scalar >,
+          this->A_Blk(c0,c0), this->A_ld );
+        if( rest > 0 )
+        {
+          Mat_MatMul< Lyt >( Trnsp::No, Trnsp::Yes,
+            rest, cw, jb, -unit< Scalar >,
+            this->A_Blk(c1,j), this->A_ld,
+            this->A_Blk(c0,j), this->A_ld, unit< Scalar >,
+            this->A_Blk(c1,c0), this->A_ld );
+        }
+      }
+    }
+  };
+
+}// namespace _n_Impl
+
+/// <summary>
+/// Computes the Cholesky factorization of a real symmetric positive
+/// definite n by n matrix A, with the same result as
+/// <see cref="Sym_Fctr_Chol"/>.
+///
+/// Diagonal blocks of config.nb are factored by the recursive code;
+/// each then takes one <see cref="Tri_Solv_Mat_Rec"/> for its
+/// off-diagonal panel and one <see cref="Sym_RankKUpd"/> and
+/// <see cref="Mat_MatMul"/> for the trailing matrix.
+/// </summary>
+///<returns>
+/// A <see cref="Sym_Fctr_Chol_Result"/> describing the status of the factorization.
+/// </returns>
+/// <remarks>
+/// Based on the LAPACK routine <c>dpotrf</c>, right-looking.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A >
+requires( ! isTileMajor< Lyt > && ! isPacked< Lyt > && ! isRfp< Lyt >
+         && ! isComplex< Decay<DerefTypeOf<T_Blk_A>> > )
+constexpr Sym_Fctr_Chol_Result Sym_Fctr_Chol_Blk( Half half,
+  Size n,
+  T_Blk_A A_, Stride A_ld,
+  const Sym_Fctr_Chol_Config &config = {} )
+{
+  IND_MATH_TRACE_SCOPE( "Sym_Fctr_Chol_Blk", n, n, config.nb,
+    (double)n*n*n/3, (double)n*(n+1)*sizeof( *A_ ) );
+
+  const Size nb = config.nb;
+
+  if( ( nb < 2 ) || ( nb >= n ) )
+  { return Sym_Fctr_Chol< Lyt >( half, n, A_, A_ld ); }
+
+  if( ( Half::Upper != half ) && ( Half::Lower != half ) )
+  { throw BadArgument{ "Sym_Fctr_Chol_Blk", 1 }; }
+
+  const _n_Impl::_Sym_Fctr_Chol_Steps< Lyt, T_Blk_A > steps{ half, n, A_, A_ld };
+
+  for( Index j = 0; j < (Index)n; j += (Index)nb )
+  {
+    const Size jb = Min( n-(Size)j, nb );
+    const Index j1 = j+(Index)jb;
+
+    const auto Fctr_jj = steps.Fctr_Diag( j, jb );
+    if( ! Fctr_jj )
+    { return Fctr_jj; }
+
+    if( j1 < (Index)n )
+    {
+      steps.Solv_Pnl( j, jb, j1, n-(Size)j1 );
+      steps.Updt_Tile( j, jb, j1, n-(Size)j1 );
+    }
+  }
+
+  return { true };
+}
+
+/// <summary>
+/// Computes the Cholesky factorization of a real symmetric positive
+/// definite n by n matrix A, with the same result as
+/// <see cref="Sym_Fctr_Chol"/>, with the work split through the
+/// execution context exec (see <see cref="ExecContext"/>).
+///
+/// This is <see cref="Sym_Fctr_Chol_Blk"/> with config.nb, whose
+/// update of the trailing matrix is split into tiles of config.nb
+/// columns (Lower) or rows (Upper), one task each. The caller updates
+/// the tile of the next panel first, and then factors and solves that
+/// panel while the tasks are still running (lookahead of depth 1).
+/// config.threadCount is not used; exec decides.
+/// </summary>
+///<returns>
+/// A <see cref="Sym_Fctr_Chol_Result"/> describing the status of the factorization.
+/// </returns>
+/// <remarks>
+/// Based on the LAPACK routine <c>dpotrf</c>.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Exec >
+requires( ! isTileMajor< Lyt > && ! isPacked< Lyt > && ! isRfp< Lyt >
+         && ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+         && ExecContext< Decay<T_Exec> > )
+constexpr Sym_Fctr_Chol_Result Sym_Fctr_Chol( Half half,
+  Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Exec &&exec,
+  const Sym_Fctr_Chol_Config &config = {} )
+{
+  const Size nb = config.nb;
+
+  if( _n_Impl::_isExecSeq< T_Exec > || ( nb < 2 ) || ( nb >= n ) || ( 1 == exec.ThreadCount() ) )
+  { return Sym_Fctr_Chol_Blk< Lyt >( half, n, A_, A_ld, config ); }
+
+  if( ( Half::Upper != half ) && ( Half::Lower != half ) )
+  { throw BadArgument{ "Sym_Fctr_Chol", 1 }; }
+
+  const _n_Impl::_Sym_Fctr_Chol_Steps< Lyt, T_Blk_A > steps{ half, n, A_, A_ld };
+
+  Sym_Fctr_Chol_Result result = steps.Fctr_Diag( 0, nb );
+  if( ! result )
+  { return result; }
+  steps.Solv_Pnl( 0, nb, (Index)nb, n-nb );
+
+  for( Index j = 0; j < (Index)n; j += (Index)nb )
+  {
+    const Size jb = Min( n-(Size)j, nb );
+    const Index j1 = j+(Index)jb;
+
+    if( j1 >= (Index)n )
+    { break; }
+
+    // The next panel is j1:j2-1; the tasks update the tiles of j2:n-1.
+    const Index j2 = j1+(Index)Min( n-(Size)j1, nb );
+    const Size tileCount = ( n-(Size)j2 + nb-1 )/nb;
+
+    exec.Fork( tileCount, [&, j, jb, j2]( Size t )
+    {
+      const Index c0 = j2+(Index)( t*nb );
+      steps.Updt_Tile( j, jb, c0, Min( nb, n-(Size)c0 ) );
+    } );
+
+    // Lookahead: update, factor and solve the next panel
+    steps.Updt_Tile( j, jb, j1, (Size)(j2-j1) );
+    result = steps.Fctr_Diag( j1, (Size)(j2-j1) );
+    if( result && ( j2 < (Index)n ) )
+    { steps.Solv_Pnl( j1, (Size)(j2-j1), j2, n-(Size)j2 ); }
+
+    exec.Join();
+
+    if( ! result )
+    { break; }
+  }
+
+  return result;
+}
+
+/// <summary>
+/// Computes the Cholesky factorization of a real symmetric positive
+/// definite n by n matrix A, with the same result as
+/// <see cref="Sym_Fctr_Chol"/>.
+///
+/// This is the overload of <see cref="Sym_Fctr_Chol"/> taking an
+/// execution context, on an <see cref="Exec_Par"/> of
+/// config.threadCount threads made for the call.
+/// </summary>
+///<returns>
+/// A <see cref="Sym_Fctr_Chol_Result"/> describing the status of the factorization.
+/// </returns>
+/// <remarks>
+/// Based on the LAPACK routine <c>dpotrf</c>.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A >
+requires( ! isTileMajor< Lyt > && ! isPacked< Lyt > && ! isRfp< Lyt >
+         && ! isComplex< Decay<DerefTypeOf<T_Blk_A>> > )
+Sym_Fctr_Chol_Result Sym_Fctr_Chol_Par( Half half,
+  Size n,
+  T_Blk_A A_, Stride A_ld,
+  const Sym_Fctr_Chol_Config &config = {} )
+{
+  const Size nb = config.nb;
+  if( ( nb < 2 ) || ( nb >= n ) || ( 1 == config.threadCount ) )
+  { return Sym_Fctr_Chol_Blk< Lyt >( half, n, A_, A_ld, config ); }
+
+  Exec_Par exec{ config.threadCount };
+  return Sym_Fctr_Chol< Lyt >( half, n, A_, A_ld, exec, config );
+}
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
@@ -0,0 +1,192 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+namespace _n_Impl {
+
+  // Order of the diagonal blocks of A that Sym_MatMul expands
+  inline constexpr Size _Sym_MatMul_BlkSize = 128;
+
+}// namespace _n_Impl
+
+/// <summary>
+/// Computes:
+///
+/// C := alpha*A*B + beta*C, if side == Side::Left
+/// or C := alpha*B*A + beta*C, if side == Side::Right
+///
+/// For a symmetric matrix A, of which only the half triangle is
+/// referenced; A is m x m for Side::Left, n x n for Side::Right.
+/// B and C are m x n. The work is split through the execution context
+/// exec (see <see cref="ExecContext"/>).
+/// </summary>
+/// <remarks>
+/// Based on the BLAS routine <c>dsymm</c>.
+///
+/// A is taken in blocks of 128 rows (Side::Left) or columns
+/// (Side::Right). The part of each block left of its diagonal block and
+/// the part right of it are stored, as they are or transposed, so each
+/// is one <see cref="Mat_MatMul"/> on the stored half. The diagonal
+/// block is expanded to a full local tile first. All of the work goes
+/// through the general product, and so through its packed engine.
+///
+/// Each block of A makes its own block of rows (Side::Left) or columns
+/// (Side::Right) of C, so the blocks are the tasks of exec.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Scalar,
+  typename T_Blk_A,
+  typename T_Blk_B,
+  typename T_Blk_C,
+  typename T_Exec >
+requires( areTheSame< T_Scalar,
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Blk_B>>,
+  Decay<DerefTypeOf<T_Blk_C>> >
+  && ExecContext< Decay<T_Exec> > )
+constexpr void Sym_MatMul(
+  Side side, Half half,
+  Size m, Size n,
+  const T_Scalar &alpha,
+  T_Blk_A A_, Stride A_ld,
+  T_Blk_B B_, Stride B_ld,
+  const T_Scalar &beta,
+  T_Blk_C C_, Stride C_ld,
+  T_Exec &&exec )
+{
+  auto A = [&]( auto i, auto j ) -> const auto &
+  { return Lyt::MatRef( A_, i, j, A_ld ); };
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+  auto B_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( B_, i, j, B_ld ); };
+  auto C_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( C_, i, j, C_ld ); };
+
+  if( Half::Both == half ){ throw BadArgument{ "Sym_MatMul", 2 }; }
+
+  const Size A_n = ( Side::Left == side ) ? m : n;
+
+  if( A_ld < Lyt::DenseLd( Max( (Size)1, A_n ), Max( (Size)1, A_n ) ) )
+  { throw BadArgument{ "Sym_MatMul", 7 }; }
+  if( B_ld < Lyt::DenseLd( Max( (Size)1, m ), Max( (Size)1, n ) ) )
+  { throw BadArgument{ "Sym_MatMul", 9 }; }
+  if( C_ld < Lyt::DenseLd( Max( (Size)1, m ), Max( (Size)1, n ) ) )
+  { throw BadArgument{ "Sym_MatMul", 12 }; }
+
+  if( ( 0 == m ) || ( 0 == n ) ){ return; }
+
+  constexpr Size nb = _n_Impl::_Sym_MatMul_BlkSize;
+
+  const bool upper = ( Half::Upper == half );
+  const T_Scalar one = unit< T_Scalar >;
+
+  exec.Fork( ( A_n + nb-1 )/nb, [&]( Size t )
+  {
+    const Index k0 = (Index)( t*nb );
+    const Size kb = Min( nb, A_n-(Size)k0 );
+    const Index k1 = k0+(Index)kb;
+    const Size rn = A_n-(Size)k1;
+
+    // D := A(k0:k1-1,k0:k1-1), both halves
+    std::vector< T_Scalar > D( kb*kb );
+    const Stride D_ld = Lyt::DenseLd( kb, kb );
+    for( Index j = 0; j < (Index)kb; ++j )
+    {
+      for( Index i = 0; i < (Index)kb; ++i )
+      {
+        Lyt::MatRef( D.data(), i, j, D_ld ) = ( ( i <= j ) == upper )
+          ? A( k0+i, k0+j ) : A( k0+j, k0+i );
+      }
+    }
+
+    if( Side::Left == side )
+    {
+      // C(K,:) := alpha*A(K,:)*B + beta*C(K,:), where A(K,0:k0-1) is
+      // stored as it is in the lower half and transposed in the upper
+      // one, and A(K,k1:) the other way round.
+      Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, kb, n, kb,
+        alpha, D.data(), D_ld, B_Blk( k0, 0 ), B_ld,
+        beta, C_Blk( k0, 0 ), C_ld );
+
+      if( k0 > 0 )
+      {
+        Mat_MatMul< Lyt >( upper ? Trnsp::Yes : Trnsp::No, Trnsp::No, kb, n, (Size)k0,
+          alpha, upper ? A_Blk( 0, k0 ) : A_Blk( k0, 0 ), A_ld, B_Blk( 0, 0 ), B_ld,
+          one, C_Blk( k0, 0 ), C_ld );
+      }
+      if( rn > 0 )
+      {
+        Mat_MatMul< Lyt >( upper ? Trnsp::No : Trnsp::Yes, Trnsp::No, kb, n, rn,
+          alpha, upper ? A_Blk( k0, k1 ) : A_Blk( k1, k0 ), A_ld, B_Blk( k1, 0 ), B_ld,
+          one, C_Blk( k0, 0 ), C_ld );
+      }
+    }
+    else
+    {
+      // C(:,K) := alpha*B*A(:,K) + beta*C(:,K), where A(0:k0-1,K) is
+      // stored as it is in the upper half and transposed in the lower
+      // one, and A(k1:,K) the other way round.
+      Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, m, kb, kb,
+        alpha, B_Blk( 0, k0 ), B_ld, D.data(), D_ld,
+        beta, C_Blk( 0, k0 ), C_ld );
+
+      if( k0 > 0 )
+      {
+        Mat_MatMul< Lyt >( Trnsp::No, upper ? Trnsp::No : Trnsp::Yes, m, kb, (Size)k0,
+          alpha, B_Blk( 0, 0 ), B_ld, upper ? A_Blk( 0, k0 ) : A_Blk( k0, 0 ), A_ld,
+          one, C_Blk( 0, k0 ), C_ld );
+      }
+      if( rn > 0 )
+      {
+        Mat_MatMul< Lyt >( Trnsp::No, upper ? Trnsp::Yes : Trnsp::No, m, kb, rn,
+          alpha, B_Blk( 0, k1 ), B_ld, upper ? A_Blk( k0, k1 ) : A_Blk( k1, k0 ), A_ld,
+          one, C_Blk( 0, k0 ), C_ld );
+      }
+    }
+  } );
+  exec.Join();
+}
+
+/// <summary>
+/// Computes:
+///
+/// C := alpha*A*B + beta*C, if side == Side::Left
+/// or C := alpha*B*A + beta*C, if side == Side::Right
+///
+/// as the overload above does, on the calling thread.
+/// </summary>
+/// <remarks>
+/// Based on the BLAS routine <c>dsymm</c>.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Scalar,
+  typename T_Blk_A,
+  typename T_Blk_B,
+  typename T_Blk_C >
+requires( areTheSame< T_Scalar,
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Blk_B>>,
+  Decay<DerefTypeOf<T_Blk_C>> > )
+constexpr void Sym_MatMul(
+  Side side, Half half,
+  Size m, Size n,
+  const T_Scalar &alpha,
+  T_Blk_A A_, Stride A_ld,
+  T_Blk_B B_, Stride B_ld,
+  const T_Scalar &beta,
+  T_Blk_C C_, Stride C_ld )
+{
+  Sym_MatMul< Lyt >( side, half, m, n, alpha,
+    A_, A_ld, B_, B_ld, beta, C_, C_ld, Exec_Seq{} );
+}
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
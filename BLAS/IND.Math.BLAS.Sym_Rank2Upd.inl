@@ -13,12 +13,20 @@ namespace BLAS {
 /// </summary>
 /// <remarks>
 /// Based on the BLAS routine <c>dsyr2</c>
+///
+/// Packed layouts (<see cref="PackedLower"/>, <see cref="PackedUpper"/>)
+/// take the same loops through their MatRef, as <c>dspr2</c> does. For
+/// <see cref="RfpLower"/> and <see cref="RfpUpper"/> this is two calls
+/// on the dense diagonal blocks and two <see cref="Mat_Rank1Upd"/> on
+/// the off-diagonal one.
 /// </remarks>
 template< typename Lyt = ColMajor,
   typename T_Scalar,
   typename T_Vec_x,
   typename T_Vec_y,
-  typename T_Blk_A >
+  typename T_Blk_A,
+  StrideArg T_Stride_x,
+  StrideArg T_Stride_y >
 requires( areTheSame< T_Scalar,
   Decay<DerefTypeOf<T_Vec_x>>,
   Decay<DerefTypeOf<T_Vec_y>>,
@@ -26,8 +34,8 @@ requires( areTheSame< T_Scalar,
 constexpr void Sym_Rank2Upd( Half half,
   Size n,
   const T_Scalar &alpha,
-  T_Vec_x x_, Stride x_s,
-  T_Vec_y y_, Stride y_s,
+  T_Vec_x x_, T_Stride_x x_s,
+  T_Vec_y y_, T_Stride_y y_s,
   T_Blk_A A_, Stride A_ld )
 {
   auto x = [&]( auto i ) -> const auto &
@@ -39,10 +47,40 @@ constexpr void Sym_Rank2Upd( Half half,
 
   if( Half::Both == half ){ throw BadArgument{ "Sym_Rank2Upd", 1 }; }
 
+  if constexpr( isPacked< Lyt > || isRfp< Lyt > )
+  {
+    if( Lyt::half != half ){ throw BadArgument{ "Sym_Rank2Upd", 1 }; }
+  }
+
   // A := 0*x*(~y) + 0*y*(~x) + A
   if( IsZero( alpha ) )
   { return; }
 
+  if constexpr( isRfp< Lyt > )
+  {
+    const auto p = Lyt::Parts( n );
+
+    const auto x2 = Lyt::VecPtr( x_, (Index)p.n1, x_s );
+    const auto y2 = Lyt::VecPtr( y_, (Index)p.n1, y_s );
+
+    Sym_Rank2Upd< ColMajor >( p.half1, p.n1, alpha, x_, x_s, y_, y_s, A_ + p.t1, p.ld );
+    Sym_Rank2Upd< ColMajor >( p.half2, p.n2, alpha, x2, x_s, y2, y_s, A_ + p.t2, p.ld );
+
+    if( Half::Lower == half )
+    {
+      // S := alpha*x(n1:n-1)*~y(0:n1-1) + alpha*y(n1:n-1)*~x(0:n1-1) + S
+      Mat_Rank1Upd< ColMajor >( p.n2, p.n1, alpha, x2, x_s, y_, y_s, A_ + p.s, p.ld );
+      Mat_Rank1Upd< ColMajor >( p.n2, p.n1, alpha, y2, y_s, x_, x_s, A_ + p.s, p.ld );
+    }
+    else
+    {
+      // S := alpha*x(0:n1-1)*~y(n1:n-1) + alpha*y(0:n1-1)*~x(n1:n-1) + S
+      Mat_Rank1Upd< ColMajor >( p.n1, p.n2, alpha, x_, x_s, y2, y_s, A_ + p.s, p.ld );
+      Mat_Rank1Upd< ColMajor >( p.n1, p.n2, alpha, y_, y_s, x2, x_s, A_ + p.s, p.ld );
+    }
+    return;
+  }
+
   if( Half::Upper == half )
   {
     for( Index j = 0; j < (Index)n; ++j )
@@ -10,10 +10,17 @@ namespace BLAS {
 /// C := alpha*A*(~B) + alpha*B*(~A) + beta*C
 /// or C := alpha*(~A)*B + alpha*(~B)*A + beta*C
 /// 
-/// For n x k matrices A, B, and n x n symmetric matrix C.
+/// For n x n symmetric matrix C, of which only the half triangle is
+/// referenced. If AB_trnsp == Trnsp::No, A and B are n x k; otherwise
+/// they are k x n.
 /// </summary>
 /// <remarks>
 /// Based on the BLAS routine <c>dsyr2k</c>.
+///
+/// The half of C is split recursively as in <see cref="Sym_RankKUpd"/>:
+/// each off-diagonal rectangle is two <see cref="Mat_MatMul"/> calls,
+/// and so is each diagonal block of order 32 or less, formed whole in a
+/// local tile of which only the half is added to C.
 /// </remarks>
 template< typename Lyt = ColMajor,
   typename T_Scalar,
@@ -33,128 +40,157 @@ constexpr void Sym_Rank2kUpd(
   const T_Scalar &beta,
   T_Blk_C C_, Stride C_ld )
 {
-  auto A = [&]( auto i, auto j ) -> const auto &
-  { return Lyt::MatRef( A_, i, j, A_ld ); };
-  auto B = [&]( auto i, auto j ) -> const auto &
-  { return Lyt::MatRef( B_, i, j, B_ld ); };
+  IND_MATH_TRACE_SCOPE( "Sym_Rank2kUpd", n, n, k,
+    2.0*n*(n+1)*k, ( 2.0*n*k + (double)n*(n+1) )*sizeof( *C_ ) );
+
   auto C = [&]( auto i, auto j ) -> auto &
   { return Lyt::MatRef( C_, i, j, C_ld ); };
 
   if( Half::Both == half ){ throw BadArgument{ "Sym_Rank2kUpd", 1 }; }
 
   if( 0 == n ){ return; }
+  if( ( IsZero( alpha ) || ( 0 == k ) ) && IsUnit( beta ) ){ return; }
 
-  if( IsZero( alpha ) )
+  const auto C_cs = Lyt::ColStride( C_, C_ld );
+
+  // C := beta*C
+  for( Index j = 0; j < (Index)n; ++j )
   {
-    if( Half::Upper == half )
-    {
-      for( Index j = 0; j < n; ++j )
-      { for( Index i = 0; i <= j; ++i )
-      { C(i,j) *= beta; } }
-    }
-    else if( Half::Lower == half )
-    {
-      for( Index j = 0; j < n; ++j )
-      { for( Index i = j; j < n; ++i )
-      { C(i,j) *= beta; } }
-    }
-    return;
+    const Index i0 = ( Half::Upper == half ) ? 0 : j;
+    const Index i1 = ( Half::Upper == half ) ? j+1 : (Index)n;
+    Vec_Scale< Lyt >( i1-i0, beta, Lyt::ColPtr( C_, i0, j, C_ld ), C_cs );
   }
 
-  if( Trnsp::Yes == AB_trnsp )
-  {
-    // C := alpha*A*(~B) + alpha*B*(~A) + C.
-    if( Half::Upper == half )
+  if( IsZero( alpha ) || ( 0 == k ) ){ return; }
+
+  const bool AB_t = ( Trnsp::No != AB_trnsp );
+
+  // The blocks of rows i0: of op(A) and op(B)
+  auto opA_Blk = [&]( Index i0 ) -> auto
+  { return AB_t ? Lyt::BlkPtr( A_, 0, i0, A_ld ) : Lyt::BlkPtr( A_, i0, 0, A_ld ); };
+  auto opB_Blk = [&]( Index i0 ) -> auto
+  { return AB_t ? Lyt::BlkPtr( B_, 0, i0, B_ld ) : Lyt::BlkPtr( B_, i0, 0, B_ld ); };
+
+  const Trnsp T_1 = AB_t ? Trnsp::Yes : Trnsp::No;
+  const Trnsp T_2 = AB_t ? Trnsp::No : Trnsp::Yes;
+  const T_Scalar one = unit< T_Scalar >;
+
+  _n_Impl::_Sym_RankUpd_Rec( half, 0, n,
+    [&]( Index r0, Size nn )
     {
-      for( Index j = 0; j < n; ++j )
+      // The whole diagonal block into D, then its half into C
+      std::array< T_Scalar, _n_Impl::_Sym_RankUpd_LeafSize*_n_Impl::_Sym_RankUpd_LeafSize > D{};
+      const Stride D_ld = Lyt::DenseLd( nn, nn );
+      Mat_MatMul< Lyt >( T_1, T_2, nn, nn, k,
+        alpha, opA_Blk( r0 ), A_ld, opB_Blk( r0 ), B_ld,
+        T_Scalar{}, D.data(), D_ld );
+      Mat_MatMul< Lyt >( T_1, T_2, nn, nn, k,
+        alpha, opB_Blk( r0 ), B_ld, opA_Blk( r0 ), A_ld,
+        one, D.data(), D_ld );
+      for( Index j = 0; j < (Index)nn; ++j )
       {
-        if( IsZero( beta ) )
-        { for( Index i = 0; i <= j; ++i )
-        { C(i,j) = {}; } }
-        else if( ! IsUnit( beta ) )
-        { for( Index i = 0; i <= j; ++j )
-        { C(i,j) *= beta; } }
-        for( Index h = 0; h <= j; ++h )
-        {
-          auto u = A(j,h);
-          auto v = B(j,h);
-          if( ! IsZero( u ) || ! IsZero( v ) )
-          {
-            u *= alpha;
-            v *= alpha;
-            for( Index i = 0; i <= j; ++i )
-            { C(i,j) += A(i,h)*v + B(i,h)*u; }
-          }
-        }
+        const Index i0 = ( Half::Upper == half ) ? 0 : j;
+        const Index i1 = ( Half::Upper == half ) ? j+1 : (Index)nn;
+        for( Index i = i0; i < i1; ++i )
+        { C(r0+i,r0+j) += Lyt::MatRef( D.data(), i, j, D_ld ); }
       }
-    }
-    else if( Half::Lower == half )
+    },
+    [&]( Index i0, Size mi, Index j0, Size nj )
     {
-      for( Index j = 0; j < n; ++j )
-      {
-        if( IsZero( beta ) )
-        { for( Index i = j; i < n; ++i )
-        { C(i,j) = {}; } }
-        else if( ! IsUnit( beta ) )
-        { for( Index i = j; i < n; ++i )
-        { C(i,j) *= beta; } }
-        for( Index h = 0; h < k; ++h )
-        {
-          auto u = A(j,h);
-          auto v = B(j,h);
-          if( ! IsZero( u ) || ! IsZero( v ) )
-          {
-            u *= alpha;
-            v *= alpha;
-            for( Index i = j; i < n; ++i )
-            { C(i,j) += A(i,h)*v + B(i,h)*u; }
-          }
-        }
-      }
-    }
-  }
-  else if( Trnsp::No == AB_trnsp )
+      const auto C_ij = Lyt::BlkPtr( C_, i0, j0, C_ld );
+      Mat_MatMul< Lyt >( T_1, T_2, mi, nj, k,
+        alpha, opA_Blk( i0 ), A_ld, opB_Blk( j0 ), B_ld,
+        one, C_ij, C_ld );
+      Mat_MatMul< Lyt >( T_1, T_2, mi, nj, k,
+        alpha, opB_Blk( i0 ), B_ld, opA_Blk( j0 ), A_ld,
+        one, C_ij, C_ld );
+    } );
+}
+
+/// <summary>
+/// Computes C := alpha*op(A)*~op(B) + alpha*op(B)*~op(A) + beta*C as the
+/// overload above does, with the work split through the execution
+/// context exec (see <see cref="ExecContext"/>).
+/// </summary>
+/// <remarks>
+/// The half of C is cut into blocks of <see cref="Exec_SplitMin"/>
+/// columns, one task each: its diagonal block is the overload above, and
+/// the rectangle beside it two <see cref="Mat_MatMul"/> calls. Blocks
+/// nearer the long side of the half come first, so the dynamic hand-out
+/// of <see cref="Exec_Par"/> keeps the threads even.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Scalar,
+  typename T_Blk_A,
+  typename T_Blk_B,
+  typename T_Blk_C,
+  typename T_Exec >
+requires( areTheSame< T_Scalar,
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Blk_B>>,
+  Decay<DerefTypeOf<T_Blk_C>> >
+  && ExecContext< Decay<T_Exec> > )
+constexpr void Sym_Rank2kUpd(
+  Half half, Trnsp AB_trnsp,
+  Size n, Size k,
+  const T_Scalar &alpha,
+  T_Blk_A A_, Stride A_ld,
+  T_Blk_B B_, Stride B_ld,
+  const T_Scalar &beta,
+  T_Blk_C C_, Stride C_ld,
+  T_Exec &&exec )
+{
+  constexpr Size nb = Exec_SplitMin;
+
+  if( _n_Impl::_isExecSeq< T_Exec > || ( 1 == exec.ThreadCount() ) || ( n < 2*nb )
+    || IsZero( alpha ) || ( 0 == k ) )
   {
-    // C := alpha*(~A)*B + alpha*(~B)*A + C.
-    if( Half::Upper == half )
-    {
-      for( Index j = 0; j < n; ++j )
-      {
-        for( Index i = 0; i <= j; ++i )
-        {
-          T_Scalar u{};
-          T_Scalar v{};
-          for( Index h = 0; h < k; ++h )
-          {
-            u += A(h,i)*B(h,j);
-            v += B(h,i)*A(h,j);
-          }
-          if( IsZero( beta ) )
-          { C(i,j) = alpha*u + alpha*v; }else
-          { C(i,j) = beta*C(i,j) + alpha*u + alpha*v; }
-        }
-      }
-    }
-    else if( Half::Lower == half )
-    {
-      for( Index j = 0; j < n; ++j )
-      {
-        for( Index i = j; i < n; ++i )
-        {
-          T_Scalar u{};
-          T_Scalar v{};
-          for( Index h = 0; h < k; ++h )
-          {
-            u += A(h,i)*B(h,j);
-            v += B(h,i)*A(h,j);
-          }
-          if( IsZero( beta ) )
-          { C(i,j) = alpha*u + alpha*v; }else
-          { C(i,j) = beta*C(i,j) + alpha*u + alpha*v; }
-        }
-      }
-    }
+    return Sym_Rank2kUpd< Lyt >( half, AB_trnsp, n, k, alpha,
+      A_, A_ld, B_, B_ld, beta, C_, C_ld );
   }
+
+  if( Half::Both == half ){ throw BadArgument{ "Sym_Rank2kUpd", 1 }; }
+
+  const bool AB_t = ( Trnsp::No != AB_trnsp );
+  const bool upper = ( Half::Upper == half );
+
+  // The blocks of rows i0: of op(A) and op(B)
+  auto opA_Blk = [&]( Index i0 ) -> auto
+  { return AB_t ? Lyt::BlkPtr( A_, 0, i0, A_ld ) : Lyt::BlkPtr( A_, i0, 0, A_ld ); };
+  auto opB_Blk = [&]( Index i0 ) -> auto
+  { return AB_t ? Lyt::BlkPtr( B_, 0, i0, B_ld ) : Lyt::BlkPtr( B_, i0, 0, B_ld ); };
+
+  const Trnsp T_1 = AB_t ? Trnsp::Yes : Trnsp::No;
+  const Trnsp T_2 = AB_t ? Trnsp::No : Trnsp::Yes;
+  const T_Scalar one = unit< T_Scalar >;
+
+  const Size count = ( n + nb-1 )/nb;
+
+  exec.Fork( count, [&]( Size t )
+  {
+    // Columns j0:j1-1, the last block first for the upper half
+    const Index j0 = (Index)( ( upper ? count-1-t : t )*nb );
+    const Size jb = Min( nb, n-(Size)j0 );
+    const Index j1 = j0+(Index)jb;
+
+    Sym_Rank2kUpd< Lyt >( half, AB_trnsp, jb, k, alpha,
+      opA_Blk( j0 ), A_ld, opB_Blk( j0 ), B_ld,
+      beta, Lyt::BlkPtr( C_, j0, j0, C_ld ), C_ld );
+
+    // C(0:j0-1,j0:j1-1) or C(j1:n-1,j0:j1-1)
+    const Index i0 = upper ? 0 : j1;
+    const Size mi = upper ? (Size)j0 : n-(Size)j1;
+    if( 0 == mi ){ return; }
+
+    const auto C_ij = Lyt::BlkPtr( C_, i0, j0, C_ld );
+    Mat_MatMul< Lyt >( T_1, T_2, mi, jb, k,
+      alpha, opA_Blk( i0 ), A_ld, opB_Blk( j0 ), B_ld,
+      beta, C_ij, C_ld );
+    Mat_MatMul< Lyt >( T_1, T_2, mi, jb, k,
+      alpha, opB_Blk( i0 ), B_ld, opA_Blk( j0 ), A_ld,
+      one, C_ij, C_ld );
+  } );
+  exec.Join();
 }
 
 }// namespace BLAS
@@ -0,0 +1,204 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+namespace _n_Impl {
+
+  // Order of the diagonal blocks of C that Sym_RankKUpd and
+  // Sym_Rank2kUpd form whole in a local tile
+  inline constexpr Size _Sym_RankUpd_LeafSize = 32;
+
+  // Walks the half of the symmetric block C(r0:r0+nn-1,r0:r0+nn-1),
+  // halving it recursively: the off-diagonal rectangle of each split
+  // goes to rect( i0, mi, j0, nj ), meaning C(i0:i0+mi-1,j0:j0+nj-1),
+  // and the diagonal blocks of at most _Sym_RankUpd_LeafSize to
+  // leaf( r0, nn ). Almost all of the work lands in rect, as a few
+  // large products.
+  template< typename T_Fn_Leaf, typename T_Fn_Rect >
+  constexpr void _Sym_RankUpd_Rec( Half half, Index r0, Size nn,
+    T_Fn_Leaf &&leaf, T_Fn_Rect &&rect )
+  {
+    if( nn <= _Sym_RankUpd_LeafSize )
+    {
+      leaf( r0, nn );
+      return;
+    }
+
+    const Size n1 = nn/2;
+    const Size n2 = nn-n1;
+    const Index r1 = r0+(Index)n1;
+
+    _Sym_RankUpd_Rec( half, r0, n1, leaf, rect );
+
+    if( Half::Upper == half )
+    { rect( r0, n1, r1, n2 ); }else
+    { rect( r1, n2, r0, n1 ); }
+
+    _Sym_RankUpd_Rec( half, r1, n2, leaf, rect );
+  }
+
+}// namespace _n_Impl
+
+/// <summary>
+/// Computes:
+///
+/// C := alpha*A*(~A) + beta*C
+/// or C := alpha*(~A)*A + beta*C
+///
+/// For n x n symmetric matrix C, of which only the half triangle is
+/// referenced. If A_trnsp == Trnsp::No, A is n x k; otherwise it is
+/// k x n.
+/// </summary>
+/// <remarks>
+/// Based on the BLAS routine <c>dsyrk</c>.
+///
+/// The half of C is split recursively: each off-diagonal rectangle is
+/// one <see cref="Mat_MatMul"/>, and each diagonal block of order 32 or
+/// less is formed whole in a local tile, of which only the half is
+/// added to C. This takes about half the flops of the general product
+/// and writes only the referenced half.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Scalar,
+  typename T_Blk_A,
+  typename T_Blk_C >
+requires( ! isPacked< Lyt > && ! isRfp< Lyt >
+  && areTheSame< T_Scalar,
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Blk_C>> > )
+constexpr void Sym_RankKUpd(
+  Half half, Trnsp A_trnsp,
+  Size n, Size k,
+  const T_Scalar &alpha,
+  T_Blk_A A_, Stride A_ld,
+  const T_Scalar &beta,
+  T_Blk_C C_, Stride C_ld )
+{
+  IND_MATH_TRACE_SCOPE( "Sym_RankKUpd", n, n, k,
+    (double)n*(n+1)*k, ( (double)n*k + (double)n*(n+1) )*sizeof( *C_ ) );
+
+  auto C = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( C_, i, j, C_ld ); };
+
+  if( Half::Both == half ){ throw BadArgument{ "Sym_RankKUpd", 1 }; }
+
+  if( 0 == n ){ return; }
+  if( ( IsZero( alpha ) || ( 0 == k ) ) && IsUnit( beta ) ){ return; }
+
+  const auto C_cs = Lyt::ColStride( C_, C_ld );
+
+  // C := beta*C
+  for( Index j = 0; j < (Index)n; ++j )
+  {
+    const Index i0 = ( Half::Upper == half ) ? 0 : j;
+    const Index i1 = ( Half::Upper == half ) ? j+1 : (Index)n;
+    Vec_Scale< Lyt >( i1-i0, beta, Lyt::ColPtr( C_, i0, j, C_ld ), C_cs );
+  }
+
+  if( IsZero( alpha ) || ( 0 == k ) ){ return; }
+
+  const bool A_t = ( Trnsp::No != A_trnsp );
+
+  // The block of rows i0: of op(A)
+  auto opA_Blk = [&]( Index i0 ) -> auto
+  { return A_t ? Lyt::BlkPtr( A_, 0, i0, A_ld ) : Lyt::BlkPtr( A_, i0, 0, A_ld ); };
+
+  const Trnsp T_A = A_t ? Trnsp::Yes : Trnsp::No;
+  const Trnsp T_B = A_t ? Trnsp::No : Trnsp::Yes;
+
+  _n_Impl::_Sym_RankUpd_Rec( half, 0, n,
+    [&]( Index r0, Size nn )
+    {
+      // The whole diagonal block into D, then its half into C
+      std::array< T_Scalar, _n_Impl::_Sym_RankUpd_LeafSize*_n_Impl::_Sym_RankUpd_LeafSize > D{};
+      const Stride D_ld = Lyt::DenseLd( nn, nn );
+      Mat_MatMul< Lyt >( T_A, T_B, nn, nn, k,
+        alpha, opA_Blk( r0 ), A_ld, opA_Blk( r0 ), A_ld,
+        T_Scalar{}, D.data(), D_ld );
+      for( Index j = 0; j < (Index)nn; ++j )
+      {
+        const Index i0 = ( Half::Upper == half ) ? 0 : j;
+        const Index i1 = ( Half::Upper == half ) ? j+1 : (Index)nn;
+        for( Index i = i0; i < i1; ++i )
+        { C(r0+i,r0+j) += Lyt::MatRef( D.data(), i, j, D_ld ); }
+      }
+    },
+    [&]( Index i0, Size mi, Index j0, Size nj )
+    {
+      Mat_MatMul< Lyt >( T_A, T_B, mi, nj, k,
+        alpha, opA_Blk( i0 ), A_ld, opA_Blk( j0 ), A_ld,
+        unit< T_Scalar >, Lyt::BlkPtr( C_, i0, j0, C_ld ), C_ld );
+    } );
+}
+
+/// <summary>
+/// Computes C := alpha*op(A)*~op(A) + beta*C as the overload above does,
+/// for C in Rectangular Full Packed storage, <see cref="RfpLower"/> or
+/// <see cref="RfpUpper"/>, of which C_ld is the order n. A is ColMajor.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dsfrk</c>.
+///
+/// The dense diagonal blocks of C take one call of the overload above
+/// each, and the off-diagonal block one <see cref="Mat_MatMul"/>.
+/// </remarks>
+template< typename Lyt,
+  typename T_Scalar,
+  typename T_Blk_A,
+  typename T_Blk_C >
+requires( isRfp< Lyt >
+  && areTheSame< T_Scalar,
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Blk_C>> > )
+constexpr void Sym_RankKUpd(
+  Half half, Trnsp A_trnsp,
+  Size n, Size k,
+  const T_Scalar &alpha,
+  T_Blk_A A_, Stride A_ld,
+  const T_Scalar &beta,
+  T_Blk_C C_, Stride C_ld )
+{
+  if( Lyt::half != half ){ throw BadArgument{ "Sym_RankKUpd", 1 }; }
+
+  if( 0 == n ){ return; }
+  if( ( IsZero( alpha ) || ( 0 == k ) ) && IsUnit( beta ) ){ return; }
+
+  const auto p = Lyt::Parts( n );
+
+  const bool A_t = ( Trnsp::No != A_trnsp );
+
+  // The block of rows i0: of op(A)
+  auto opA_Blk = [&]( Index i0 ) -> auto
+  { return A_t ? ColMajor::BlkPtr( A_, 0, i0, A_ld ) : ColMajor::BlkPtr( A_, i0, 0, A_ld ); };
+
+  Sym_RankKUpd< ColMajor >( p.half1, A_trnsp, p.n1, k,
+    alpha, opA_Blk( 0 ), A_ld, beta, C_ + p.t1, p.ld );
+  Sym_RankKUpd< ColMajor >( p.half2, A_trnsp, p.n2, k,
+    alpha, opA_Blk( (Index)p.n1 ), A_ld, beta, C_ + p.t2, p.ld );
+
+  // The off-diagonal block S is C(n1:n-1,0:n1-1) or C(0:n1-1,n1:n-1)
+  const bool lower = ( Half::Lower == half );
+  const Size S_m = lower ? p.n2 : p.n1;
+  const Size S_n = lower ? p.n1 : p.n2;
+
+  // S := beta*S
+  for( Index j = 0; j < (Index)S_n; ++j )
+  { Vec_Scale< ColMajor >( S_m, beta, ColMajor::ColPtr( C_ + p.s, 0, j, p.ld ), 1 ); }
+
+  if( IsZero( alpha ) || ( 0 == k ) ){ return; }
+
+  Mat_MatMul< ColMajor >( A_t ? Trnsp::Yes : Trnsp::No, A_t ? Trnsp::No : Trnsp::Yes,
+    S_m, S_n, k,
+    alpha, opA_Blk( lower ? (Index)p.n1 : 0 ), A_ld, opA_Blk( lower ? 0 : (Index)p.n1 ), A_ld,
+    unit< T_Scalar >, C_ + p.s, p.ld );
+}
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
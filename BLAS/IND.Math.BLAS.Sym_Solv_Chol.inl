@@ -0,0 +1,101 @@
+#ifdef __IND_MATH_BLAS_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace BLAS {
+
+/// <summary>
+/// DPOTRS solves a system of linear equations
+///   A * X = B
+/// with a symmetric positive definite n by n matrix A using the
+/// Cholesky factorization A = (~U)*U or A = L*(~L) computed by
+/// <see cref="Sym_Fctr_Chol"/>, for the nrhs columns of B at once.
+///
+/// B is overwritten by X on output. The triangular solves are
+/// <see cref="Tri_Solv_Mat_Rec"/>, so with many right hand sides most
+/// of the work runs in <see cref="Mat_MatMul"/>.
+/// </summary>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Blk_B
+>
+void Sym_Solv_Chol( Half half,
+  Size n, Size nrhs,
+  T_Blk_A A_, Stride A_ld,
+  T_Blk_B B_, Stride B_ld )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_B>>;
+
+  // Quick return if possible
+  if( ( 0 == n ) || ( 0 == nrhs ) )
+  { return; }
+
+  switch( half )
+  {
+  default:
+    {}throw BadArgument{ "Sym_Solv_Chol", 1 };
+  case Half::Upper:
+    {
+      // Solve (~U)*U*X = B, overwriting B with X.
+      Tri_Solv_Mat_Rec< Lyt >( Side::Left, Half::Upper, Trnsp::Yes, Diag::NotUnit,
+        n, nrhs, unit< Scalar >, A_, A_ld, B_, B_ld );
+      Tri_Solv_Mat_Rec< Lyt >( Side::Left, Half::Upper, Trnsp::No, Diag::NotUnit,
+        n, nrhs, unit< Scalar >, A_, A_ld, B_, B_ld );
+    }
+    break;
+
+  case Half::Lower:
+    {
+      // Solve L*(~L)*X = B, overwriting B with X.
+      Tri_Solv_Mat_Rec< Lyt >( Side::Left, Half::Lower, Trnsp::No, Diag::NotUnit,
+        n, nrhs, unit< Scalar >, A_, A_ld, B_, B_ld );
+      Tri_Solv_Mat_Rec< Lyt >( Side::Left, Half::Lower, Trnsp::Yes, Diag::NotUnit,
+        n, nrhs, unit< Scalar >, A_, A_ld, B_, B_ld );
+    }
+    break;
+  }
+}
+
+/// <summary>
+/// DPOTRS for one right hand side b, of stride b_s, overwritten by x.
+/// </summary>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Vec_b
+>
+void Sym_Solv_Chol( Half half,
+  Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Vec_b b_, Stride b_s )
+{
+  // Quick return if possible
+  if( 0 == n )
+  { return; }
+
+  switch( half )
+  {
+  default:
+    {}throw BadArgument{ "Sym_Solv_Chol", 1 };
+  case Half::Upper:
+    {
+      Tri_Solv_Vec< Lyt >( Half::Upper, Trnsp::Yes, Diag::NotUnit, n, A_, A_ld, b_, b_s );
+      Tri_Solv_Vec< Lyt >( Half::Upper, Trnsp::No, Diag::NotUnit, n, A_, A_ld, b_, b_s );
+    }
+    break;
+
+  case Half::Lower:
+    {
+      Tri_Solv_Vec< Lyt >( Half::Lower, Trnsp::No, Diag::NotUnit, n, A_, A_ld, b_, b_s );
+      Tri_Solv_Vec< Lyt >( Half::Lower, Trnsp::Yes, Diag::NotUnit, n, A_, A_ld, b_, b_s );
+    }
+    break;
+  }
+}
+
+}// namespace BLAS
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.BLAS.h> instead.
+#endif
\ No newline at end of file
@@ -4,6 +4,78 @@ namespace IND {
 namespace Math {
 namespace BLAS {
 
+namespace _n_Impl {
+
+  // Columns of A per panel in Sym_VecMul
+  inline constexpr Size _Sym_VecMul_PnlSize = 8;
+
+  // y := y + alpha*A*x for symmetric A, read through a( i, j ), of
+  // which the upper or the lower half is referenced, in panels of nb
+  // columns. Each element outside the diagonal blocks is loaded once
+  // for both of its products: the y(i) of its row, kept in a register
+  // across the panel, and the sum v(c) of its column, kept in a register
+  // across the rows.
+  template< Size nb,
+    typename T_Scalar,
+    typename T_Fn_A,
+    typename T_Fn_x,
+    typename T_Fn_y >
+  constexpr void _Sym_VecMul_Pnl( bool upper, Size n, const T_Scalar &alpha,
+    T_Fn_A &&a, T_Fn_x &&x, T_Fn_y &&y )
+  {
+    for( Index j0 = 0; j0 < (Index)n; j0 += (Index)nb )
+    {
+      const Size jb = Min( nb, n-(Size)j0 );
+
+      T_Scalar u[nb]{};
+      T_Scalar v[nb]{};
+      for( Index c = 0; c < (Index)jb; ++c )
+      { u[c] = alpha*x(j0+c); }
+
+      // Diagonal block; (p,q) with p < q is stored as a(p,q) in the
+      // upper half and as a(q,p) in the lower one.
+      for( Index p = 0; p < (Index)jb; ++p )
+      {
+        y(j0+p) += u[p]*a(j0+p,j0+p);
+        for( Index q = p+1; q < (Index)jb; ++q )
+        {
+          const T_Scalar s = upper ? a(j0+p,j0+q) : a(j0+q,j0+p);
+          y(j0+p) += u[q]*s;
+          y(j0+q) += u[p]*s;
+        }
+      }
+
+      // The rows of the panel outside the diagonal block
+      const Index i0 = upper ? 0 : j0+(Index)jb;
+      const Index i1 = upper ? j0 : (Index)n;
+
+      auto Rows = [&]( auto cn )
+      {
+        for( Index i = i0; i < i1; ++i )
+        {
+          const T_Scalar xi = x(i);
+          T_Scalar yi = y(i);
+          for( Index c = 0; c < (Index)(Size)cn; ++c )
+          {
+            const T_Scalar aic = a(i,j0+c);
+            yi += u[c]*aic;
+            v[c] += aic*xi;
+          }
+          y(i) = yi;
+        }
+      };
+
+      if( nb == jb )
+      { Rows( std::integral_constant< Size, nb >{} ); }else
+      { Rows( jb ); }
+
+      for( Index c = 0; c < (Index)jb; ++c )
+      { y(j0+c) += alpha*v[c]; }
+    }
+  }
+
+}// namespace _n_Impl
+
 /// <summary>
 /// Computes:
 ///
@@ -13,12 +85,25 @@ namespace BLAS {
 /// </summary>
 /// <remarks>
 /// Based on the BLAS routine <c>dsymv</c>.
+///
+/// A is read in panels of 8 columns, along its contiguous direction;
+/// in RowMajor layout the half is read as the other half of the
+/// transpose, which is the same matrix. Each element is loaded once
+/// and y(i) is updated once per panel.
+///
+/// Packed layouts (<see cref="PackedLower"/>, <see cref="PackedUpper"/>)
+/// take the same panels through their MatRef, as <c>dspmv</c> does. For
+/// <see cref="RfpLower"/> and <see cref="RfpUpper"/> this is two calls
+/// on the dense diagonal blocks and two <see cref="Mat_VecMul"/> on the
+/// off-diagonal one.
 /// </remarks>
 template< typename Lyt = ColMajor,
   typename T_Scalar,
   typename T_Blk_A,
   typename T_Vec_x,
-  typename T_Vec_y >
+  typename T_Vec_y,
+  StrideArg T_Stride_x,
+  StrideArg T_Stride_y >
 requires( areTheSame< T_Scalar,
   Decay<DerefTypeOf<T_Blk_A>>,
   Decay<DerefTypeOf<T_Vec_x>>,
@@ -27,16 +112,19 @@ constexpr void Sym_VecMul( Half half,
   Size n,
   const T_Scalar &alpha,
   T_Blk_A A_, Stride A_ld,
-  T_Vec_x x_, Stride x_s,
+  T_Vec_x x_, T_Stride_x x_s,
   const T_Scalar &beta,
-  T_Vec_y y_, Stride y_s )
+  T_Vec_y y_, T_Stride_y y_s )
 {
   auto x = [&]( auto i ) -> const auto &
   { return Lyt::VecRef( x_, i, x_s ); };
   auto y = [&]( auto i ) -> auto &
   { return Lyt::VecRef( y_, i, y_s ); };
-  auto A = [&]( auto i, auto j ) -> auto &
-  { return Lyt::MatRef( A_, i, j, A_ld ); };
+
+  if constexpr( isPacked< Lyt > || isRfp< Lyt > )
+  {
+    if( Lyt::half != half ){ throw BadArgument{ "Sym_VecMul", 1 }; }
+  }
 
   if( 0 == n ){ return; }
 
@@ -46,34 +134,48 @@ constexpr void Sym_VecMul( Half half,
   if( IsZero( alpha ) )
   { return; }
 
-  if( Half::Upper == half )
+  if( ( Half::Upper != half ) && ( Half::Lower != half ) )
+  { return; }
+
+  if constexpr( isRfp< Lyt > )
   {
-    for( Index j = 0; j < (Index)n; ++j )
+    const auto p = Lyt::Parts( n );
+    const T_Scalar one = unit< T_Scalar >;
+
+    const auto x2 = Lyt::VecPtr( x_, (Index)p.n1, x_s );
+    const auto y2 = Lyt::VecPtr( y_, (Index)p.n1, y_s );
+
+    Sym_VecMul< ColMajor >( p.half1, p.n1, alpha, A_ + p.t1, p.ld, x_, x_s, one, y_, y_s );
+    Sym_VecMul< ColMajor >( p.half2, p.n2, alpha, A_ + p.t2, p.ld, x2, x_s, one, y2, y_s );
+
+    if( Half::Lower == half )
     {
-      const auto u = alpha*x(j);
-      T_Scalar v{};
-      for( Index i = 0; i < j; ++i )
-      {
-        y(i) += u*A(i,j);
-        v += A(i,j)*x(i);
-      }
-      y(j) += u*A(j,j) + alpha*v;
+      // y(n1:n-1) += alpha*S*x(0:n1-1), y(0:n1-1) += alpha*(~S)*x(n1:n-1)
+      Mat_VecMul< ColMajor >( Trnsp::No, p.n2, p.n1, alpha, A_ + p.s, p.ld, x_, x_s, one, y2, y_s );
+      Mat_VecMul< ColMajor >( Trnsp::Yes, p.n2, p.n1, alpha, A_ + p.s, p.ld, x2, x_s, one, y_, y_s );
     }
-  }
-  else if( Half::Lower == half )
-  {
-    for( Index j = 0; j < (Index)n; ++j )
+    else
     {
-      const auto u = alpha*x(j);
-      T_Scalar v{};
-      y(j) += u*A(j,j);
-      for( Index i = j + 1; i < (Index)n; ++i )
-      {
-        y(i)+= u*A(i,j);
-        v += A(i,j)*x(i);
-      }
-      y(j) += alpha*v;
+      // y(0:n1-1) += alpha*S*x(n1:n-1), y(n1:n-1) += alpha*(~S)*x(0:n1-1)
+      Mat_VecMul< ColMajor >( Trnsp::No, p.n1, p.n2, alpha, A_ + p.s, p.ld, x2, x_s, one, y_, y_s );
+      Mat_VecMul< ColMajor >( Trnsp::Yes, p.n1, p.n2, alpha, A_ + p.s, p.ld, x_, x_s, one, y2, y_s );
     }
+    return;
+  }
+
+  constexpr Size nb = _n_Impl::_Sym_VecMul_PnlSize;
+
+  if constexpr ( isRowMajor< Lyt > )
+  {
+    _n_Impl::_Sym_VecMul_Pnl< nb >( Half::Lower == half, n, alpha,
+      [&]( Index i, Index j ) -> const auto &
+      { return Lyt::MatRef( A_, j, i, A_ld ); }, x, y );
+  }
+  else
+  {
+    _n_Impl::_Sym_VecMul_Pnl< nb >( Half::Upper == half, n, alpha,
+      [&]( Index i, Index j ) -> const auto &
+      { return Lyt::MatRef( A_, i, j, A_ld ); }, x, y );
   }
 }
 
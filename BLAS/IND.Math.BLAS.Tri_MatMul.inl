@@ -4,6 +4,14 @@ namespace IND {
 namespace Math {
 namespace BLAS {
 
+/// <summary>
+/// Order up to which <see cref="Tri_MatMul_Rec"/> and
+/// <see cref="Tri_Solv_Mat_Rec"/> stop splitting the triangle and
+/// run the column loops of <see cref="Tri_MatMul"/> and
+/// <see cref="Tri_Solv_Mat"/>; a triangle of this order fits in L1.
+/// </summary>
+inline constexpr Size Tri_Rec_BlkSize = 32;
+
 /// <summary>
 /// Computes:
 /// 
@@ -31,6 +39,10 @@ constexpr void Tri_MatMul(
   T_Blk_A A_, Stride A_ld,
   T_Blk_B B_, Stride B_ld )
 {
+  IND_MATH_TRACE_SCOPE( "Tri_MatMul", m, n, 0,
+    (double)m*n*( ( Side::Left == side ) ? m : n ),
+    ( 0.5*( ( Side::Left == side ) ? m : n )*( ( Side::Left == side ) ? m : n ) + 2.0*m*n )*sizeof( *B_ ) );
+
   auto A = [&]( auto i, auto j ) -> const auto &
   { return Lyt::MatRef( A_, i, j, A_ld ); };
   auto B = [&]( auto i, auto j ) -> auto &
@@ -42,7 +54,7 @@ constexpr void Tri_MatMul(
 
   if( Half::Both == half ){ throw BadArgument{ "Tri_MatMul", 2 }; }
   if( A_ld < Max(1,A_nrow) ){ throw BadArgument{ "Tri_MatMul", 9 }; }
-  if( B_ld < Max(1,m) ){ throw BadArgument{ "Tri_MatMul", 11 }; }
+  if( B_ld < Lyt::DenseLd( Max( (Size)1, m ), Max( (Size)1, n ) ) ){ throw BadArgument{ "Tri_MatMul", 11 }; }
 
   // Quick return if possible.
 
@@ -332,6 +344,104 @@ constexpr void Tri_MatMul(
   }
 }
 
+/// <summary>
+/// Computes the same products as <see cref="Tri_MatMul"/>, with the
+/// same result up to rounding, by recursive splitting of A:
+///
+///   op( A ) = ( A11 A12 )  or  ( A11  0  ),
+///             (  0  A22 )      ( A21 A22 )
+///
+/// where A11 is of order A_n/2. The two triangles are multiplied
+/// recursively and the coupling block A12 or A21 is applied with one
+/// <see cref="Mat_MatMul"/>, so most of the flops run in the blocked
+/// matrix multiply. Triangles of order nb or less go to the column
+/// loops of <see cref="Tri_MatMul"/>.
+/// </summary>
+/// <remarks>
+/// Based on the BLAS routine <c>dtrmm</c>.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Scalar,
+  typename T_Blk_A,
+  typename T_Blk_B >
+requires( areTheSame< T_Scalar,
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Blk_B>> > )
+constexpr void Tri_MatMul_Rec(
+  Side side, Half half, Trnsp A_trnsp, Diag diag,
+  Size m, Size n,
+  const T_Scalar &alpha,
+  T_Blk_A A_, Stride A_ld,
+  T_Blk_B B_, Stride B_ld,
+  Size nb = Tri_Rec_BlkSize )
+{
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+  auto B_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( B_, i, j, B_ld ); };
+
+  if( Half::Both == half ){ throw BadArgument{ "Tri_MatMul_Rec", 2 }; }
+
+  const Size A_n = ( Side::Left == side ) ? m : n;
+
+  if( ( A_n <= Max( nb, (Size)1 ) ) || ( 0 == m ) || ( 0 == n ) )
+  { return Tri_MatMul< Lyt >( side, half, A_trnsp, diag, m, n, alpha, A_, A_ld, B_, B_ld ); }
+
+  const Size n1 = A_n/2;
+  const Size n2 = A_n-n1;
+
+  // op( A )12 and op( A )21 as stored in A
+  const auto A12 = ( Trnsp::No == A_trnsp ) ? A_Blk( 0, n1 ) : A_Blk( n1, 0 );
+  const auto A21 = ( Trnsp::No == A_trnsp ) ? A_Blk( n1, 0 ) : A_Blk( 0, n1 );
+  const auto A11 = A_Blk( 0, 0 );
+  const auto A22 = A_Blk( n1, n1 );
+
+  // op( A ) is upper triangular if A is upper and not transposed,
+  // or lower and transposed.
+  const bool opUpper = ( Half::Upper == half ) == ( Trnsp::No == A_trnsp );
+
+  if( Side::Left == side )
+  {
+    const auto B1 = B_Blk( 0, 0 );
+    const auto B2 = B_Blk( n1, 0 );
+
+    if( opUpper )
+    {
+      // B1 := alpha*( A11*B1 + A12*B2 ), then B2 := alpha*A22*B2
+      Tri_MatMul_Rec< Lyt >( side, half, A_trnsp, diag, n1, n, alpha, A11, A_ld, B1, B_ld, nb );
+      Mat_MatMul< Lyt >( A_trnsp, Trnsp::No, n1, n, n2, alpha, A12, A_ld, B2, B_ld, unit< T_Scalar >, B1, B_ld );
+      Tri_MatMul_Rec< Lyt >( side, half, A_trnsp, diag, n2, n, alpha, A22, A_ld, B2, B_ld, nb );
+    }
+    else
+    {
+      // B2 := alpha*( A21*B1 + A22*B2 ), then B1 := alpha*A11*B1
+      Tri_MatMul_Rec< Lyt >( side, half, A_trnsp, diag, n2, n, alpha, A22, A_ld, B2, B_ld, nb );
+      Mat_MatMul< Lyt >( A_trnsp, Trnsp::No, n2, n, n1, alpha, A21, A_ld, B1, B_ld, unit< T_Scalar >, B2, B_ld );
+      Tri_MatMul_Rec< Lyt >( side, half, A_trnsp, diag, n1, n, alpha, A11, A_ld, B1, B_ld, nb );
+    }
+  }
+  else // Side::Right == side
+  {
+    const auto B1 = B_Blk( 0, 0 );
+    const auto B2 = B_Blk( 0, n1 );
+
+    if( opUpper )
+    {
+      // B2 := alpha*( B1*A12 + B2*A22 ), then B1 := alpha*B1*A11
+      Tri_MatMul_Rec< Lyt >( side, half, A_trnsp, diag, m, n2, alpha, A22, A_ld, B2, B_ld, nb );
+      Mat_MatMul< Lyt >( Trnsp::No, A_trnsp, m, n2, n1, alpha, B1, B_ld, A12, A_ld, unit< T_Scalar >, B2, B_ld );
+      Tri_MatMul_Rec< Lyt >( side, half, A_trnsp, diag, m, n1, alpha, A11, A_ld, B1, B_ld, nb );
+    }
+    else
+    {
+      // B1 := alpha*( B1*A11 + B2*A21 ), then B2 := alpha*B2*A22
+      Tri_MatMul_Rec< Lyt >( side, half, A_trnsp, diag, m, n1, alpha, A11, A_ld, B1, B_ld, nb );
+      Mat_MatMul< Lyt >( Trnsp::No, A_trnsp, m, n1, n2, alpha, B2, B_ld, A21, A_ld, unit< T_Scalar >, B1, B_ld );
+      Tri_MatMul_Rec< Lyt >( side, half, A_trnsp, diag, m, n2, alpha, A22, A_ld, B2, B_ld, nb );
+    }
+  }
+}
+
 }// namespace BLAS
 }// namespace Math
 }// namespace IND
@@ -16,7 +16,7 @@ namespace BLAS {
 ///   op( A ) = ~A
 ///   op( A ) = Conj(~A)
 ///
-// The matrix X is overwritten on B.
+/// The matrix X is overwritten on B.
 /// </summary>
 /// <remarks>
 /// Based on the BLAS routine <c>dtrsm</c>.
@@ -29,307 +29,299 @@ requires( areTheSame<
   Decay<DerefTypeOf<T_Blk_A>>,
   Decay<DerefTypeOf<T_Blk_B>>,
   T_Alpha > )
-void Tri_Solv_Mat(
+constexpr void Tri_Solv_Mat(
   Side side, Half half, Trnsp A_trnsp, Diag diag,
   Size m, Size n,
   const T_Alpha &alpha,
   T_Blk_A A_, Stride A_ld,
   T_Blk_B B_, Stride B_ld )
 {
+  IND_MATH_TRACE_SCOPE( "Tri_Solv_Mat", m, n, 0,
+    (double)m*n*( ( Side::Left == side ) ? m : n ),
+    ( 0.5*( ( Side::Left == side ) ? m : n )*( ( Side::Left == side ) ? m : n ) + 2.0*m*n )*sizeof( *B_ ) );
+
   using Scalar = T_Alpha;
 
   auto A = [&]( Index i, Index j ) noexcept -> const auto &
   { return Lyt::MatRef( A_, i, j, A_ld ); };
   auto B = [&]( Index i, Index j ) noexcept -> auto &
   { return Lyt::MatRef( B_, i, j, B_ld ); };
-  auto B_Row = [&]( Index i, Index j ) noexcept
-  { return Lyt::RowPtr( B_, i, j, B_ld ); };
+  auto B_Col = [&]( Index i, Index j ) noexcept
+  { return Lyt::ColPtr( B_, i, j, B_ld ); };
 
-  if( Half::Both == half ){ throw BadArgument{ "Tri_Solv_Mat", 2u }; }
+  const Size A_n = ( Side::Left == side ) ? m : n;
 
-  if( Side::Left == side )
-  {
-    if( A_ld < (Stride)Max(1,m) )
-    { throw BadArgument{ "Tri_Solv_Mat", 9 }; }
-  }
-  else
-  {
-    if( A_ld < (Stride)Max(1,n) )
-    { throw BadArgument{ "Tri_Solv_Mat", 9 }; }
-  }
-  if( B_ld < (Stride)Max(1,m) ){ throw BadArgument{ "Tri_Solv_Mat", 11 }; }
+  if( Half::Both == half ){ throw BadArgument{ "Tri_Solv_Mat", 2 }; }
+  if( A_ld < Lyt::DenseLd( Max( (Size)1, A_n ), Max( (Size)1, A_n ) ) )
+  { throw BadArgument{ "Tri_Solv_Mat", 9 }; }
+  if( B_ld < Lyt::DenseLd( Max( (Size)1, m ), Max( (Size)1, n ) ) )
+  { throw BadArgument{ "Tri_Solv_Mat", 11 }; }
 
   // Quick return if possible.
 
   if( ( 0 == m ) || ( 0 == n ) )
   { return; }
 
-  const Stride B_rs = Lyt::RowStride( B_, B_ld );
+  const auto B_cs = Lyt::ColStride( B_, B_ld );
 
   if( IsZero( alpha ) )
   {
     for( Index j = 0; j < (Index)n; ++j )
-    { Vec_Zero< Lyt >( m, B_Row(0,j), B_rs ); }
+    { Vec_Zero< Lyt >( m, B_Col(0,j), B_cs ); }
     return;
   }
 
+  // op( A )(i,j)
+  auto opA = [&]( Index i, Index j ) -> Scalar
+  {
+    if( Trnsp::No == A_trnsp ){ return A(i,j); }
+    if( Trnsp::Yes == A_trnsp ){ return A(j,i); }
+    return Conj( A(j,i) );
+  };
+
+  // op( A ) is upper triangular if A is upper and not transposed,
+  // or lower and transposed.
+  const bool opUpper = ( Half::Upper == half ) == ( Trnsp::No == A_trnsp );
+
   if( Side::Left == side )
   {
-    switch( A_trnsp )
+    const auto A_rs = Lyt::RowStride( A_, A_ld );
+    const auto A_cs = Lyt::ColStride( A_, A_ld );
+
+    // B(i0:i1-1,j) -= B(k,j)*op( A )(i0:i1-1,k)
+    auto Col_Upd = [&]( Index j, Index k, Index i0, Index i1 )
     {
-    case Trnsp::No:
+      const auto B_kj = B(k,j);
+      if( Trnsp::No == A_trnsp )
+      { Vec_AXPlusY< Lyt >( i1-i0, -B_kj, Lyt::ColPtr( A_, i0, k, A_ld ), A_cs, B_Col(i0,j), B_cs ); }
+      else if( Trnsp::Yes == A_trnsp )
+      { Vec_AXPlusY< Lyt >( i1-i0, -B_kj, Lyt::RowPtr( A_, k, i0, A_ld ), A_rs, B_Col(i0,j), B_cs ); }
+      else
       {
-        // Form  B := alpha*Inv( A )*B.
-        if( Half::Upper == half )
-        {
-          for( Index j = 0; j < (Index)n; ++j )
-          {
-            if( unit< Scalar > != alpha )
-            { Vec_Scale< Lyt >( m, alpha, B_Row(0,j), B_rs ); }
-
-            for( Index k = (Index)(m-1); k >= 0; --k )
-            {
-              if( IsZero( B(k,j) ) )
-              { continue; }
-              if( Diag::NotUnit == diag )
-              { B(k,j) /= A(k,k); }
-              for( Index i = 0; i < (k-1); ++i )
-              { B(i,j) -= B(k,j)*A(i,k); }
-            }
-          }
-        }
-        else // Half::Lower == half
-        {
-          for( Index j = 0; j < (Index)n; ++j )
-          {
-            if( unit< Scalar > != alpha )
-            { Vec_Scale< Lyt >( m, alpha, B_Row(0,j), B_rs ); }
-
-            for( Index k = 0; k < (Index)m; ++k )
-            {
-              if( IsZero( B(k,j) ) )
-              { continue; }
-              if( Diag::NotUnit == diag )
-              { B(k,j) /= A(k,k); }
-              for( Index i = k+1; i < (Index)m; ++i )
-              { B(i,j) -= B(k,j)*A(i,k); }
-            }
-          }
-        }
+        for( Index i = i0; i < i1; ++i )
+        { B(i,j) -= B_kj*opA(i,k); }
       }
-      break;
+    };
 
-    case Trnsp::Yes:
+    // Form  B := alpha*Inv( op( A ) )*B, one column of B at a time.
+    for( Index j = 0; j < (Index)n; ++j )
+    {
+      if( ! IsUnit( alpha ) )
+      { Vec_Scale< Lyt >( m, alpha, B_Col(0,j), B_cs ); }
+
+      if( opUpper )
       {
-        // Form  B := alpha*Inv( ~A )*B.
-        if( Half::Upper == half )
-        {
-          for( Index j = 0; j < (Index)n; ++j )
-          {
-            for( Index i = 0; i < (Index)m; ++i )
-            {
-              Scalar tmp = alpha*B(i,j);
-              for( Index k = 0; k < (i-1); ++k )
-              { tmp -= A(k,i)*B(k,j); }
-              if( Diag::NotUnit == diag )
-              { tmp /= A(i,i); }
-              B(i,j) = Move( tmp );
-            }
-          }
-        }
-        else // Half::Lower == half
+        for( Index k = (Index)(m-1); k >= 0; --k )
         {
-          for( Index j = 0; j < (Index)n; ++j )
-          {
-            for( Index i = (Index)(m-1); i >= 0; --i )
-            {
-              Scalar tmp = alpha*B(i,j);
-              for( Index k = i+1; k < (Index)m; ++k )
-              { tmp -= A(k,i)*B(k,j); }
-              if( Diag::NotUnit == diag )
-              { tmp /= A(i,i); }
-              B(i,j) = Move( tmp );
-            }
-          }
+          if( IsZero( B(k,j) ) )
+          { continue; }
+          if( Diag::NotUnit == diag )
+          { B(k,j) /= opA(k,k); }
+          Col_Upd( j, k, 0, k );
         }
       }
-      break;
-
-    case Trnsp::Conj:
+      else
       {
-        // Form  B := alpha*Inv( ~Conj(A) )*B.
-        if( Half::Upper == half )
-        {
-          for( Index j = 0; j < (Index)n; ++j )
-          {
-            for( Index i = 0; i < (Index)m; ++i )
-            {
-              Scalar tmp = alpha*B(i,j);
-              for( Index k = 0; k < (i-1); ++k )
-              { tmp -= Conj(A(k,i))*B(k,j); }
-              if( Diag::NotUnit == diag )
-              { tmp /= Conj(A(i,i)); }
-              B(i,j) = Move( tmp );
-            }
-          }
-        }
-        else // Half::Lower == half
+        for( Index k = 0; k < (Index)m; ++k )
         {
-          for( Index j = 0; j < (Index)n; ++j )
-          {
-            for( Index i = (Index)(m-1); i >= 0; --i )
-            {
-              Scalar tmp = alpha*B(i,j);
-              for( Index k = i+1; k < (Index)m; ++k )
-              { tmp -= Conj(A(k,i))*B(k,j); }
-              if( Diag::NotUnit == diag )
-              { tmp /= Conj(A(i,i)); }
-              B(i,j) = Move( tmp );
-            }
-          }
+          if( IsZero( B(k,j) ) )
+          { continue; }
+          if( Diag::NotUnit == diag )
+          { B(k,j) /= opA(k,k); }
+          Col_Upd( j, k, k+1, (Index)m );
         }
       }
-      break;
     }
   }
   else // Side::Right == side
   {
-    switch( A_trnsp )
+    // Form  B := alpha*B*Inv( op( A ) ), one column of B at a time.
+    auto Solv_Col = [&]( Index j, Index k0, Index k1 )
     {
-    case Trnsp::No:
-      {
-        // Form  B := alpha*B*Inv( A ).
-
-        if( Half::Upper == half )
-        {
-          for( Index j = 0; j < (Index)n; ++j )
-          {
-            if( unit< Scalar > != alpha )
-            { Vec_Scale< Lyt >( m, alpha, B_Row(0,j), B_rs ); }
-
-            for( Index k = 0; k < (j-1); ++j )
-            {
-              const auto A_kj = A(k,j);
-              if( ! IsZero( A_kj ) )
-              { for( Index i = 0; i < (Index)m; ++i )
-              { B(i,j) -= A_kj*B(i,k); } }
-            }
-
-            if( Diag::NotUnit == diag )
-            { Vec_Scale< Lyt >( m, Inv( A(j,j) ), B_Row(0,j), B_rs ); }
-          }
-        }
-        else // Half::Lower == half
-        {
-          for( Index j = (Index)(n-1); j >= 0; --j )
-          {
-            if( unit< Scalar > != alpha )
-            { Vec_Scale< Lyt >( m, alpha, B_Row(0,j), B_rs ); }
-
-            for( Index k = j+1; k < (Index)n; ++k )
-            {
-              const auto A_kj = A(k,j);
-              if( ! IsZero( A_kj ) )
-              { for( Index i = 0; i < (Index)m; ++i )
-              { B(i,j) -= A_kj*B(i,k); } }
-            }
-
-            if( Diag::NotUnit == diag )
-            { Vec_Scale< Lyt >( m, Inv( A(j,j) ), B_Row(0,j), B_rs ); }
-          }
-        }
-      }
-      break;
+      if( ! IsUnit( alpha ) )
+      { Vec_Scale< Lyt >( m, alpha, B_Col(0,j), B_cs ); }
 
-    case Trnsp::Yes:
+      for( Index k = k0; k < k1; ++k )
       {
-        // Form  B := alpha*B*Inv( ~A ).
-        if( Half::Upper == half )
-        {
-          for( Index k = (Index)(n-1); k >= 0; --k )
-          {
-            if( Diag::NotUnit == diag )
-            { Vec_Scale< Lyt >( m, Inv( A(k,k) ), B_Row(0,k), B_rs ); }
-
-            for( Index j = 0; j < (k-1); ++j )
-            {
-              const auto A_jk = A(j,k);
-              if( ! IsZero( A_jk ) )
-              { for( Index i = 0; i < (Index)m; ++i )
-              { B(i,j) -= A_jk*B(i,k); } }
-
-              if( unit< Scalar > != alpha )
-              { Vec_Scale< Lyt >( m, alpha, B_Row(0,k), B_rs ); }
-            }
-          }
-        }
-        else // Half::Lower == half
-        {
-          for( Index k = 0; k < (Index)n; ++k )
-          {
-            if( Diag::NotUnit == diag )
-            { Vec_Scale< Lyt >( m, Inv( A(k,k) ), B_Row(0,k), B_rs ); }
-
-            for( Index j = k+1; j < (Index)n; ++j )
-            {
-              const auto A_jk = A(j,k);
-              if( ! IsZero( A_jk ) )
-              { for( Index j = k+1; j < (Index)n; ++j )
-              { Vec_Scale< Lyt >( m, A_jk, B_Row(0,j), B_rs ); } }
-            }
-
-            if( unit< Scalar > != alpha )
-            { Vec_Scale< Lyt >( m, alpha, B_Row(0,k), B_rs ); }
-          }
-        }
+        const auto A_kj = opA(k,j);
+        if( ! IsZero( A_kj ) )
+        { Vec_AXPlusY< Lyt >( m, -A_kj, B_Col(0,k), B_cs, B_Col(0,j), B_cs ); }
       }
-      break;
 
-    case Trnsp::Conj:
-      {
-        // Form  B := alpha*B*Inv( Conj(~A) ).
+      if( Diag::NotUnit == diag )
+      { Vec_Scale< Lyt >( m, Inv( opA(j,j) ), B_Col(0,j), B_cs ); }
+    };
 
-        if( Half::Upper == half )
-        {
-          for( Index k = (Index)(n-1); k >= 0; --k )
-          {
-            if( Diag::NotUnit == diag )
-            { Vec_Scale< Lyt >( m, Inv( Conj(A(k,k)) ), B_Row(0,k), B_rs ); }
-
-            for( Index j = 0; j < (k-1); ++j )
-            {
-              const auto A_jk = Conj(A(j,k));
-              if( ! IsZero( A_jk ) )
-              { for( Index i = 0; i < (Index)m; ++i )
-              { B(i,j) -= A_jk*B(i,k); } }
-
-              if( unit< Scalar > != alpha )
-              { Vec_Scale< Lyt >( m, alpha, B_Row(0,k), B_rs ); }
-            }
-          }
-        }
-        else // Half::Lower == half
-        {
-          for( Index k = 0; k < (Index)n; ++k )
-          {
-            if( Diag::NotUnit == diag )
-            { Vec_Scale< Lyt >( m, Inv( A(k,k) ), B_Row(0,k), B_rs ); }
-
-            for( Index j = k+1; j < (Index)n; ++j )
-            {
-              const auto A_jk = Conj(A(j,k));
-              if( ! IsZero( A_jk ) )
-              { for( Index j = k+1; j < (Index)n; ++j )
-              { Vec_Scale< Lyt >( m, A_jk, B_Row(0,j), B_rs ); } }
-            }
-
-            if( unit< Scalar > != alpha )
-            { Vec_Scale< Lyt >( m, alpha, B_Row(0,k), B_rs ); }
-          }
-        }
-      }
-      break;
+    if( opUpper )
+    {
+      for( Index j = 0; j < (Index)n; ++j )
+      { Solv_Col( j, 0, j ); }
     }
+    else
+    {
+      for( Index j = (Index)(n-1); j >= 0; --j )
+      { Solv_Col( j, j+1, (Index)n ); }
+    }
+  }
+}
+
+/// <summary>
+/// Solves the same equations as <see cref="Tri_Solv_Mat"/>, with the
+/// same result up to rounding, by recursive splitting of A:
+///
+///   op( A ) = ( A11 A12 )  or  ( A11  0  ),
+///             (  0  A22 )      ( A21 A22 )
+///
+/// where A11 is of order A_n/2. The two triangles are solved
+/// recursively and the coupling block A12 or A21 is eliminated with
+/// one <see cref="Mat_MatMul"/>, so most of the flops run in the
+/// blocked matrix multiply and A is no longer streamed once per
+/// column of B. Triangles of order nb or less go to the column loops
+/// of <see cref="Tri_Solv_Mat"/>.
+/// </summary>
+/// <remarks>
+/// Based on the BLAS routine <c>dtrsm</c>.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Blk_B,
+  typename T_Alpha >
+requires( areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Blk_B>>,
+  T_Alpha > )
+constexpr void Tri_Solv_Mat_Rec(
+  Side side, Half half, Trnsp A_trnsp, Diag diag,
+  Size m, Size n,
+  const T_Alpha &alpha,
+  T_Blk_A A_, Stride A_ld,
+  T_Blk_B B_, Stride B_ld,
+  Size nb = Tri_Rec_BlkSize )
+{
+  using Scalar = T_Alpha;
+
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+  auto B_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( B_, i, j, B_ld ); };
+
+  if( Half::Both == half ){ throw BadArgument{ "Tri_Solv_Mat_Rec", 2 }; }
+
+  const Size A_n = ( Side::Left == side ) ? m : n;
+
+  if( ( A_n <= Max( nb, (Size)1 ) ) || ( 0 == m ) || ( 0 == n ) || IsZero( alpha ) )
+  { return Tri_Solv_Mat< Lyt >( side, half, A_trnsp, diag, m, n, alpha, A_, A_ld, B_, B_ld ); }
+
+  const Size n1 = A_n/2;
+  const Size n2 = A_n-n1;
+
+  // op( A )12 and op( A )21 as stored in A
+  const auto A12 = ( Trnsp::No == A_trnsp ) ? A_Blk( 0, n1 ) : A_Blk( n1, 0 );
+  const auto A21 = ( Trnsp::No == A_trnsp ) ? A_Blk( n1, 0 ) : A_Blk( 0, n1 );
+  const auto A11 = A_Blk( 0, 0 );
+  const auto A22 = A_Blk( n1, n1 );
+
+  // op( A ) is upper triangular if A is upper and not transposed,
+  // or lower and transposed.
+  const bool opUpper = ( Half::Upper == half ) == ( Trnsp::No == A_trnsp );
+
+  const Scalar one = unit< Scalar >;
+
+  if( Side::Left == side )
+  {
+    const auto B1 = B_Blk( 0, 0 );
+    const auto B2 = B_Blk( n1, 0 );
+
+    if( opUpper )
+    {
+      // X2 = alpha*Inv( A22 )*B2, B1 := alpha*B1 - A12*X2, X1 = Inv( A11 )*B1
+      Tri_Solv_Mat_Rec< Lyt >( side, half, A_trnsp, diag, n2, n, alpha, A22, A_ld, B2, B_ld, nb );
+      Mat_MatMul< Lyt >( A_trnsp, Trnsp::No, n1, n, n2, -one, A12, A_ld, B2, B_ld, alpha, B1, B_ld );
+      Tri_Solv_Mat_Rec< Lyt >( side, half, A_trnsp, diag, n1, n, one, A11, A_ld, B1, B_ld, nb );
+    }
+    else
+    {
+      // X1 = alpha*Inv( A11 )*B1, B2 := alpha*B2 - A21*X1, X2 = Inv( A22 )*B2
+      Tri_Solv_Mat_Rec< Lyt >( side, half, A_trnsp, diag, n1, n, alpha, A11, A_ld, B1, B_ld, nb );
+      Mat_MatMul< Lyt >( A_trnsp, Trnsp::No, n2, n, n1, -one, A21, A_ld, B1, B_ld, alpha, B2, B_ld );
+      Tri_Solv_Mat_Rec< Lyt >( side, half, A_trnsp, diag, n2, n, one, A22, A_ld, B2, B_ld, nb );
+    }
+  }
+  else // Side::Right == side
+  {
+    const auto B1 = B_Blk( 0, 0 );
+    const auto B2 = B_Blk( 0, n1 );
+
+    if( opUpper )
+    {
+      // X1 = alpha*B1*Inv( A11 ), B2 := alpha*B2 - X1*A12, X2 = B2*Inv( A22 )
+      Tri_Solv_Mat_Rec< Lyt >( side, half, A_trnsp, diag, m, n1, alpha, A11, A_ld, B1, B_ld, nb );
+      Mat_MatMul< Lyt >( Trnsp::No, A_trnsp, m, n2, n1, -one, B1, B_ld, A12, A_ld, alpha, B2, B_ld );
+      Tri_Solv_Mat_Rec< Lyt >( side, half, A_trnsp, diag, m, n2, one, A22, A_ld, B2, B_ld, nb );
+    }
+    else
+    {
+      // X2 = alpha*B2*Inv( A22 ), B1 := alpha*B1 - X2*A21, X1 = B1*Inv( A11 )
+      Tri_Solv_Mat_Rec< Lyt >( side, half, A_trnsp, diag, m, n2, alpha, A22, A_ld, B2, B_ld, nb );
+      Mat_MatMul< Lyt >( Trnsp::No, A_trnsp, m, n1, n2, -one, B2, B_ld, A21, A_ld, alpha, B1, B_ld );
+      Tri_Solv_Mat_Rec< Lyt >( side, half, A_trnsp, diag, m, n1, one, A11, A_ld, B1, B_ld, nb );
+    }
+  }
+}
+
+/// <summary>
+/// Solves the same equations as <see cref="Tri_Solv_Mat"/>, with the
+/// work split through the execution context exec (see
+/// <see cref="ExecContext"/>).
+/// </summary>
+/// <remarks>
+/// The right-hand sides are independent: the columns of B for
+/// Side::Left, its rows for Side::Right. They are split into one range
+/// per thread of at least <see cref="Exec_SplitMin"/>, each solved by
+/// <see cref="Tri_Solv_Mat_Rec"/>. With <see cref="Exec_Seq"/> this is
+/// the serial recursive form.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Blk_B,
+  typename T_Alpha,
+  typename T_Exec >
+requires( areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Blk_B>>,
+  T_Alpha >
+  && ExecContext< Decay<T_Exec> > )
+constexpr void Tri_Solv_Mat(
+  Side side, Half half, Trnsp A_trnsp, Diag diag,
+  Size m, Size n,
+  const T_Alpha &alpha,
+  T_Blk_A A_, Stride A_ld,
+  T_Blk_B B_, Stride B_ld,
+  T_Exec &&exec )
+{
+  if constexpr ( ! _n_Impl::_isExecSeq< T_Exec > )
+  {
+    if( Side::Left == side )
+    {
+      _n_Impl::_Exec_Split( exec, n, Exec_SplitMin, [&]( Index j0, Size nt )
+      {
+        Tri_Solv_Mat_Rec< Lyt >( side, half, A_trnsp, diag, m, nt, alpha,
+          A_, A_ld, Lyt::BlkPtr( B_, 0, j0, B_ld ), B_ld );
+      } );
+    }
+    else
+    {
+      _n_Impl::_Exec_Split( exec, m, Exec_SplitMin, [&]( Index i0, Size mt )
+      {
+        Tri_Solv_Mat_Rec< Lyt >( side, half, A_trnsp, diag, mt, n, alpha,
+          A_, A_ld, Lyt::BlkPtr( B_, i0, 0, B_ld ), B_ld );
+      } );
+    }
+  }
+  else
+  {
+    Tri_Solv_Mat_Rec< Lyt >( side, half, A_trnsp, diag, m, n, alpha,
+      A_, A_ld, B_, B_ld );
   }
 }
 
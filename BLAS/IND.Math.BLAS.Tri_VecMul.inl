@@ -17,7 +17,8 @@ namespace BLAS {
 /// </remarks>
 template< typename Lyt = ColMajor,
   typename T_Blk_A,
-  typename T_Vec_x >
+  typename T_Vec_x,
+  StrideArg T_Stride_x >
 requires( areTheSame<
   Decay<DerefTypeOf<T_Blk_A>>,
   Decay<DerefTypeOf<T_Vec_x>> > )
@@ -25,7 +26,7 @@ constexpr void Tri_VecMul(
   Half half, Trnsp A_trnsp, Diag diag, 
   Size n,
   T_Blk_A A_, Stride A_ld,
-  T_Vec_x x_, Stride x_s )
+  T_Vec_x x_, T_Stride_x x_s )
 {
   using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
 
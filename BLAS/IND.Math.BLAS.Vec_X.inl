@@ -7,9 +7,9 @@ namespace BLAS {
 /// <summary>
 /// x = 0
 /// </summary>
-template< typename Lyt = Flat, typename T_Vec_x >
+template< typename Lyt = Flat, typename T_Vec_x, StrideArg T_Stride_x >
 requires( requires( T_Vec_x x ){ { *x = {} }; } )
-constexpr void Vec_Zero( Size n, T_Vec_x x, Stride x_s )
+constexpr void Vec_Zero( Size n, T_Vec_x x, T_Stride_x x_s )
 { while( n-- ){ *x = {}; Lyt::VecInc( x, x_s ); } }
 
 /// <summary>
@@ -17,9 +17,10 @@ constexpr void Vec_Zero( Size n, T_Vec_x x, Stride x_s )
 /// </summary>
 template< typename Lyt = Flat,
   typename T_Vec_x,
-  typename T_Scalar = Decay<DerefTypeOf<T_Vec_x>> >
+  typename T_Scalar = Decay<DerefTypeOf<T_Vec_x>>,
+  StrideArg T_Stride_x >
 requires( requires( const T_Scalar &alpha, T_Vec_x x ){ { *x = alpha }; } )
-constexpr void Vec_Fill( Size n, const T_Scalar &alpha, T_Vec_x x, Stride x_s )
+constexpr void Vec_Fill( Size n, const T_Scalar &alpha, T_Vec_x x, T_Stride_x x_s )
 {
   while( n-- )
   {
@@ -32,10 +33,18 @@ constexpr void Vec_Fill( Size n, const T_Scalar &alpha, T_Vec_x x, Stride x_s )
 /// </summary>
 template< typename Lyt = Flat,
   typename T_Vec_x,
-  typename T_Vec_y >
+  typename T_Vec_y,
+  StrideArg T_Stride_x,
+  StrideArg T_Stride_y >
 requires( areTheSame< Decay<DerefTypeOf<T_Vec_x>>, Decay<DerefTypeOf<T_Vec_y>> > )
-constexpr void Vec_Copy( Size n, T_Vec_x x, Stride x_s, T_Vec_y y, Stride y_s )
+constexpr void Vec_Copy( Size n, T_Vec_x x, T_Stride_x x_s, T_Vec_y y, T_Stride_y y_s )
 {
+  if constexpr ( isVecKrnl< Lyt, T_Vec_x, T_Vec_y > )
+  {
+    if( ! std::is_constant_evaluated() && ( 1 == x_s ) && ( 1 == y_s ) )
+    { return _n_Impl::_VecKrnl< Decay<DerefTypeOf<T_Vec_x>> >().Copy( n, x, y ); }
+  }
+
   while( n-- )
   {
     *y = *x;
@@ -49,9 +58,11 @@ constexpr void Vec_Copy( Size n, T_Vec_x x, Stride x_s, T_Vec_y y, Stride y_s )
 /// </summary>
 template< typename Lyt = Flat,
   typename T_Vec_x,
-  typename T_Vec_y >
+  typename T_Vec_y,
+  StrideArg T_Stride_x,
+  StrideArg T_Stride_y >
 requires( requires( T_Vec_x x, T_Vec_y y ){ { *y = Conj(*x) }; } )
-constexpr void Vec_Conj( Size n, T_Vec_x x, Stride x_s, T_Vec_y y, Stride y_s )
+constexpr void Vec_Conj( Size n, T_Vec_x x, T_Stride_x x_s, T_Vec_y y, T_Stride_y y_s )
 {
   while( n-- )
   {
@@ -66,23 +77,32 @@ constexpr void Vec_Conj( Size n, T_Vec_x x, Stride x_s, T_Vec_y y, Stride y_s )
 /// </summary>
 template< typename Lyt = Flat,
   typename T_Vec_x,
-  typename T_Vec_y >
+  typename T_Vec_y,
+  StrideArg T_Stride_x,
+  StrideArg T_Stride_y >
 requires( areTheSame< Decay<DerefTypeOf<T_Vec_x>>, Decay<DerefTypeOf<T_Vec_y>> > )
-constexpr void Vec_Swap( Size n, T_Vec_x x, Stride x_s, T_Vec_y y, Stride y_s )
+constexpr void Vec_Swap( Size n, T_Vec_x x, T_Stride_x x_s, T_Vec_y y, T_Stride_y y_s )
 {
+  if constexpr ( isVecKrnl< Lyt, T_Vec_x, T_Vec_y > )
+  {
+    if( ! std::is_constant_evaluated() && ( 1 == x_s ) && ( 1 == y_s ) )
+    { return _n_Impl::_VecKrnl< Decay<DerefTypeOf<T_Vec_x>> >().Swap( n, x, y ); }
+  }
+
   while( n-- )
   {
     Swap( *x, *y );
-    x += x_s;
-    y += y_s;
+    Lyt::VecInc( x, x_s );
+    Lyt::VecInc( y, y_s );
   }
 }
 
 template< typename Lyt = Flat,
   typename T_Vec_x,
-  typename T_Arr_piv >
+  typename T_Arr_piv,
+  StrideArg T_Stride_x >
 requires( isNativeSignedIntegral< Decay<DerefTypeOf<T_Arr_piv>> > )
-constexpr void Vec_PivSwp( T_Vec_x x, Stride x_s, Index k0, Index k1, T_Arr_piv piv_ )
+constexpr void Vec_PivSwp( T_Vec_x x, T_Stride_x x_s, Index k0, Index k1, T_Arr_piv piv_ )
 {
   for( Index i = k0; i <= k1; ++i )
   {
@@ -97,12 +117,19 @@ constexpr void Vec_PivSwp( T_Vec_x x, Stride x_s, Index k0, Index k1, T_Arr_piv
 /// </summary>
 template< typename Lyt = Flat,
   typename T_Scalar,
-  typename T_Vec_x >
-constexpr void Vec_Scale( Size n, const T_Scalar &alpha, T_Vec_x x, Stride x_s )
+  typename T_Vec_x,
+  StrideArg T_Stride_x >
+constexpr void Vec_Scale( Size n, const T_Scalar &alpha, T_Vec_x x, T_Stride_x x_s )
 {
   if( IsZero( alpha ) ){ Vec_Zero< Lyt >( n, x, x_s ); }
-  if( ! IsUnit( alpha ) )
+  else if( ! IsUnit( alpha ) )
   {
+    if constexpr ( isVecKrnl< Lyt, T_Vec_x > && areTheSame< T_Scalar, Decay<DerefTypeOf<T_Vec_x>> > )
+    {
+      if( ! std::is_constant_evaluated() && ( 1 == x_s ) )
+      { return _n_Impl::_VecKrnl< T_Scalar >().Scale( n, alpha, x ); }
+    }
+
     while( n-- )
     {
       (*x) *= alpha;
@@ -117,14 +144,23 @@ constexpr void Vec_Scale( Size n, const T_Scalar &alpha, T_Vec_x x, Stride x_s )
 template< typename Lyt = Flat,
   typename T_Scalar,
   typename T_Vec_x,
-  typename T_Vec_y >
-constexpr void Vec_Scale( Size n, const T_Scalar &alpha, T_Vec_x x, Stride x_s, T_Vec_y y, Stride y_s )
+  typename T_Vec_y,
+  StrideArg T_Stride_x,
+  StrideArg T_Stride_y >
+constexpr void Vec_Scale( Size n, const T_Scalar &alpha, T_Vec_x x, T_Stride_x x_s, T_Vec_y y, T_Stride_y y_s )
 {
   if( IsZero( alpha ) )
   { Vec_Zero< Lyt >( n, y, y_s ); }
-
-  if( ! IsUnit( alpha ) )
+  else if( IsUnit( alpha ) )
+  { Vec_Copy< Lyt >( n, x, x_s, y, y_s ); }
+  else
   {
+    if constexpr ( isVecKrnl< Lyt, T_Vec_x, T_Vec_y > && areTheSame< T_Scalar, Decay<DerefTypeOf<T_Vec_x>> > )
+    {
+      if( ! std::is_constant_evaluated() && ( 1 == x_s ) && ( 1 == y_s ) )
+      { return _n_Impl::_VecKrnl< T_Scalar >().ScaleTo( n, alpha, x, y ); }
+    }
+
     while( n-- )
     {
       (*y) = alpha*(*x);
@@ -136,12 +172,21 @@ constexpr void Vec_Scale( Size n, const T_Scalar &alpha, T_Vec_x x, Stride x_s,
 
 template< typename Lyt = Flat,
   typename T_Vec_x,
-  typename T_Vec_y >
+  typename T_Vec_y,
+  StrideArg T_Stride_x,
+  StrideArg T_Stride_y >
 requires( requires( T_Vec_x x_, T_Vec_y y_ ){ { Conj(*y_)*(*x_) }; } )
-constexpr Decay<DerefTypeOf<T_Vec_x>> Vec_Dot( Size n, T_Vec_x x, Stride x_s, T_Vec_y y, Stride y_s )
+constexpr Decay<DerefTypeOf<T_Vec_x>> Vec_Dot( Size n, T_Vec_x x, T_Stride_x x_s, T_Vec_y y, T_Stride_y y_s )
 {
   if( 0 == n )
   { return {}; }
+
+  if constexpr ( isVecKrnl< Lyt, T_Vec_x, T_Vec_y > )
+  {
+    if( ! std::is_constant_evaluated() && ( 1 == x_s ) && ( 1 == y_s ) )
+    { return _n_Impl::_VecKrnl< Decay<DerefTypeOf<T_Vec_x>> >().Dot( n, x, y ); }
+  }
+
   auto sum = Conj(*x)*(*y);
   Lyt::VecInc( x, x_s );
   Lyt::VecInc( y, y_s );
@@ -156,12 +201,21 @@ constexpr Decay<DerefTypeOf<T_Vec_x>> Vec_Dot( Size n, T_Vec_x x, Stride x_s, T_
 
 template< typename Lyt = Flat,
   typename T_Vec_x,
-  typename T_Vec_y >
+  typename T_Vec_y,
+  StrideArg T_Stride_x,
+  StrideArg T_Stride_y >
 requires( requires( T_Vec_x x_, T_Vec_y y_ ){ { (*y_)*(*x_) }; } )
-constexpr Decay<DerefTypeOf<T_Vec_x>> Vec_DotU( Size n, T_Vec_x x, Stride x_s, T_Vec_y y, Stride y_s )
+constexpr Decay<DerefTypeOf<T_Vec_x>> Vec_DotU( Size n, T_Vec_x x, T_Stride_x x_s, T_Vec_y y, T_Stride_y y_s )
 {
   if( 0 == n )
   { return {}; }
+
+  if constexpr ( isVecKrnl< Lyt, T_Vec_x, T_Vec_y > )
+  {
+    if( ! std::is_constant_evaluated() && ( 1 == x_s ) && ( 1 == y_s ) )
+    { return _n_Impl::_VecKrnl< Decay<DerefTypeOf<T_Vec_x>> >().Dot( n, x, y ); }
+  }
+
   auto sum = (*x)*(*y);
   Lyt::VecInc( x, x_s );
   Lyt::VecInc( y, y_s );
@@ -179,9 +233,11 @@ constexpr Decay<DerefTypeOf<T_Vec_x>> Vec_DotU( Size n, T_Vec_x x, Stride x_s, T
 /// </summary>
 template< typename Lyt = Flat,
   typename T_Vec_x,
-  typename T_Vec_y >
+  typename T_Vec_y,
+  StrideArg T_Stride_x,
+  StrideArg T_Stride_y >
 requires( requires( T_Vec_x x_, T_Vec_y y_ ){ { (*y_) += (*x_) }; } )
-constexpr void Vec_Add( Size n, T_Vec_x x_, Stride x_s, T_Vec_y y_, Stride y_s )
+constexpr void Vec_Add( Size n, T_Vec_x x_, T_Stride_x x_s, T_Vec_y y_, T_Stride_y y_s )
 {
   while( n-- )
   {
@@ -196,9 +252,11 @@ constexpr void Vec_Add( Size n, T_Vec_x x_, Stride x_s, T_Vec_y y_, Stride y_s )
 /// </summary>
 template< typename Lyt = Flat,
   typename T_Vec_x,
-  typename T_Vec_y >
+  typename T_Vec_y,
+  StrideArg T_Stride_x,
+  StrideArg T_Stride_y >
 requires( requires( T_Vec_x x_, T_Vec_y y_ ){ { (*y_) += Conj(*x_) }; } )
-constexpr void Vec_AddConj( Size n, T_Vec_x x_, Stride x_s, T_Vec_y y_, Stride y_s )
+constexpr void Vec_AddConj( Size n, T_Vec_x x_, T_Stride_x x_s, T_Vec_y y_, T_Stride_y y_s )
 {
   while( n-- )
   {
@@ -213,13 +271,15 @@ constexpr void Vec_AddConj( Size n, T_Vec_x x_, Stride x_s, T_Vec_y y_, Stride y
 /// </summary>
 template< typename Lyt = Flat,
   typename T_Vec_x,
-  typename T_Vec_y >
-requires( requires( T_Vec_x x_, T_Vec_y y_ ){ { (*y_) += (*x_) }; } )
-constexpr void Vec_Sub( Size n, T_Vec_x x_, Stride x_s, T_Vec_y y_, Stride y_s )
+  typename T_Vec_y,
+  StrideArg T_Stride_x,
+  StrideArg T_Stride_y >
+requires( requires( T_Vec_x x_, T_Vec_y y_ ){ { (*y_) -= (*x_) }; } )
+constexpr void Vec_Sub( Size n, T_Vec_x x_, T_Stride_x x_s, T_Vec_y y_, T_Stride_y y_s )
 {
   while( n-- )
   {
-    (*y_) += (*x_);
+    (*y_) -= (*x_);
     Lyt::VecInc( x_, x_s );
     Lyt::VecInc( y_, y_s );
   }
@@ -230,13 +290,15 @@ constexpr void Vec_Sub( Size n, T_Vec_x x_, Stride x_s, T_Vec_y y_, Stride y_s )
 /// </summary>
 template< typename Lyt = Flat,
   typename T_Vec_x,
-  typename T_Vec_y >
-requires( requires( T_Vec_x x_, T_Vec_y y_ ){ { (*y_) += Conj(*x_) }; } )
-constexpr void Vec_SubConj( Size n, T_Vec_x x_, Stride x_s, T_Vec_y y_, Stride y_s )
+  typename T_Vec_y,
+  StrideArg T_Stride_x,
+  StrideArg T_Stride_y >
+requires( requires( T_Vec_x x_, T_Vec_y y_ ){ { (*y_) -= Conj(*x_) }; } )
+constexpr void Vec_SubConj( Size n, T_Vec_x x_, T_Stride_x x_s, T_Vec_y y_, T_Stride_y y_s )
 {
   while( n-- )
   {
-    (*y_) += Conj(*x_);
+    (*y_) -= Conj(*x_);
     Lyt::VecInc( x_, x_s );
     Lyt::VecInc( y_, y_s );
   }
@@ -248,9 +310,17 @@ constexpr void Vec_SubConj( Size n, T_Vec_x x_, Stride x_s, T_Vec_y y_, Stride y
 template< typename Lyt = Flat,
   typename T_Scalar,
   typename T_Vec_x,
-  typename T_Vec_y >
-constexpr auto Vec_AXPlusY( Size n, const T_Scalar &alpha, T_Vec_x x, Stride x_s, T_Vec_y y, Stride y_s )
+  typename T_Vec_y,
+  StrideArg T_Stride_x,
+  StrideArg T_Stride_y >
+constexpr auto Vec_AXPlusY( Size n, const T_Scalar &alpha, T_Vec_x x, T_Stride_x x_s, T_Vec_y y, T_Stride_y y_s )
 {
+  if constexpr ( isVecKrnl< Lyt, T_Vec_x, T_Vec_y > && areTheSame< T_Scalar, Decay<DerefTypeOf<T_Vec_x>> > )
+  {
+    if( ! std::is_constant_evaluated() && ( 1 == x_s ) && ( 1 == y_s ) )
+    { return _n_Impl::_VecKrnl< T_Scalar >().AXPlusY( n, alpha, x, y ); }
+  }
+
   while( n-- )
   {
     *y += alpha*(*x);
@@ -265,8 +335,10 @@ constexpr auto Vec_AXPlusY( Size n, const T_Scalar &alpha, T_Vec_x x, Stride x_s
 template< typename Lyt = Flat,
   typename T_Scalar,
   typename T_Vec_x,
-  typename T_Vec_y >
-constexpr auto Vec_AConjXPlusY( Size n, const T_Scalar &alpha, T_Vec_x x, const Stride x_s, T_Vec_y y, const Stride y_s )
+  typename T_Vec_y,
+  StrideArg T_Stride_x,
+  StrideArg T_Stride_y >
+constexpr auto Vec_AConjXPlusY( Size n, const T_Scalar &alpha, T_Vec_x x, T_Stride_x x_s, T_Vec_y y, T_Stride_y y_s )
 {
   while( n-- )
   {
@@ -276,12 +348,88 @@ constexpr auto Vec_AConjXPlusY( Size n, const T_Scalar &alpha, T_Vec_x x, const
   }
 }
 
+namespace _n_Impl {
+
+  // Adds the squares of the elements of x to ssq = { big, med, sml },
+  // the three sums of Blue's algorithm.
+  template< typename Lyt,
+    typename T_Vec_x,
+    typename T_Scalar,
+    StrideArg T_Stride_x >
+  constexpr void _Vec_Ssq( Size n, T_Vec_x x, T_Stride_x x_s, T_Scalar (&ssq)[3] )
+  {
+    if constexpr ( isVecKrnl< Lyt, T_Vec_x > )
+    {
+      if( ! std::is_constant_evaluated() && ( 1 == x_s ) )
+      { return _VecKrnl< T_Scalar >().Ssq( n, x, ssq ); }
+    }
+
+    while( n-- )
+    {
+      _s_Ssq_Blue< T_Scalar >::Add( Abs( *x ), ssq[0], ssq[1], ssq[2] );
+      Lyt::VecInc( x, x_s );
+    }
+  }
+
+  // Folds the sums of Blue's algorithm into scale and sumsq, so that
+  // scale^2*sumsq is their total; the smaller sums are dropped where
+  // they cannot show in it.
+  template< typename T_Scalar >
+  constexpr void _Vec_SsqFold( const T_Scalar (&ssq)[3], T_Scalar &scale, T_Scalar &sumsq )
+  {
+    using Blue = _s_Ssq_Blue< T_Scalar >;
+
+    const auto &big = ssq[0];
+    const auto &med = ssq[1];
+    const auto &sml = ssq[2];
+
+    if( big > T_Scalar{} )
+    {
+      // Combine big and med, or just big
+      scale = Inv( Blue::sbig );
+      sumsq = big;
+      if( ( med > T_Scalar{} ) || IsUndefined( med ) )
+      { sumsq += ( med*Blue::sbig )*Blue::sbig; }
+    }
+    else if( sml > T_Scalar{} )
+    {
+      if( ( med > T_Scalar{} ) || IsUndefined( med ) )
+      {
+        // Combine med and sml, in the unscaled range
+        const T_Scalar ymed = Sqrt( med );
+        const T_Scalar ysml = Sqrt( sml )/Blue::ssml;
+        const T_Scalar ymin = ( ysml > ymed ) ? ymed : ysml;
+        const T_Scalar ymax = ( ysml > ymed ) ? ysml : ymed;
+        scale = unit< T_Scalar >;
+        sumsq = Sqr( ymax )*( unit< T_Scalar > + Sqr( ymin/ymax ) );
+      }
+      else
+      {
+        scale = Inv( Blue::ssml );
+        sumsq = sml;
+      }
+    }
+    else
+    {
+      scale = unit< T_Scalar >;
+      sumsq = med;
+    }
+  }
+
+}// namespace _n_Impl
+
 /// <summary>
 /// Numerically stable 2-norm of a vector, where applicable.
 /// </summary>
+/// <remarks>
+/// Based on the BLAS routine <c>dnrm2</c> of LAPACK 3.10: one pass,
+/// with the three accumulators of Blue's algorithm, so that it neither
+/// overflows nor underflows, yet has no rescale or Sqrt per element.
+/// </remarks>
 template< typename Lyt = Flat,
-  typename T_Vec_x >
-constexpr Decay<DerefTypeOf<T_Vec_x>> Vec_Norm2( Size n, T_Vec_x x_, Stride x_s )
+  typename T_Vec_x,
+  StrideArg T_Stride_x >
+constexpr Decay<DerefTypeOf<T_Vec_x>> Vec_Norm2( Size n, T_Vec_x x_, T_Stride_x x_s )
 {
   using Scalar = Decay<DerefTypeOf<T_Vec_x>>;
 
@@ -300,27 +448,12 @@ constexpr Decay<DerefTypeOf<T_Vec_x>> Vec_Norm2( Size n, T_Vec_x x_, Stride x_s
   }
   else
   {
-    Scalar scale{};
-    Scalar ssq{ unit<Scalar> };
+    Scalar ssq[3]{};
+    _n_Impl::_Vec_Ssq< Lyt >( n, x_, x_s, ssq );
 
-    while( n-- )
-    {
-      const auto xi = Abs( *x_ );
-      if( ! IsZero( xi ) )
-      {
-        if( scale >= xi )
-        {
-          ssq += Sqr( xi/scale );
-        }
-        else
-        {
-          ssq = unit<Scalar> + ssq*Sqr( scale/xi );
-          scale = xi;
-        }
-      }
-      norm = scale*Sqrt( ssq );
-      Lyt::VecInc( x_, x_s );
-    }
+    Scalar scale, sumsq;
+    _n_Impl::_Vec_SsqFold( ssq, scale, sumsq );
+    norm = scale*Sqrt( sumsq );
   }
 
   return norm;
@@ -336,17 +469,25 @@ constexpr Decay<DerefTypeOf<T_Vec_x>> Vec_Norm2( Size n, T_Vec_x x_, Stride x_s
 template< typename Lyt = Flat,
   typename T_Scalar,
   typename T_Vec_x,
-  typename T_Vec_y >
+  typename T_Vec_y,
+  StrideArg T_Stride_x,
+  StrideArg T_Stride_y >
 requires( ! isComplex< T_Scalar >
   && areTheSame< T_Scalar,
   Decay<DerefTypeOf<T_Vec_x>>,
   Decay<DerefTypeOf<T_Vec_y>> > )
 constexpr void Vec_PlnRot(
   Size n,
-  T_Vec_x x, Stride x_s,
-  T_Vec_y y, Stride y_s,
+  T_Vec_x x, T_Stride_x x_s,
+  T_Vec_y y, T_Stride_y y_s,
   const T_Scalar &c, const T_Scalar &s )
 {
+  if constexpr ( isVecKrnl< Lyt, T_Vec_x, T_Vec_y > )
+  {
+    if( ! std::is_constant_evaluated() && ( 1 == x_s ) && ( 1 == y_s ) )
+    { return _n_Impl::_VecKrnl< T_Scalar >().PlnRot( n, x, y, c, s ); }
+  }
+
   while( n-- )
   {
     T_Scalar &x0 = *x;
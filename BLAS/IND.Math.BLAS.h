@@ -24,6 +24,37 @@
 
 #include <Common.h>
 
+#include <array>
+#include <concepts>
+#include <deque>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+
+#if defined( IND_MATH_TRACE )
+#include <chrono>
+#endif
+
+#if defined( IND_MATH_CUDA )
+#include <cuda_runtime.h>
+#include <cublas_v2.h>
+#endif
+
+#if defined( IND_MATH_MPI )
+#include <mpi.h>
+#endif
+
 #ifdef __IND_MATH_BLAS_H_CONTENTS__
 #error __IND_MATH_BLAS_H_CONTENTS__ is a reserved token.
 #endif
@@ -38,6 +69,27 @@ using Size = UIntSize;
 using Index = IntSize;
 using Stride = Index;
 
+// A stride known at compile time. The layouts return UnitStride for
+// the stride of their contiguous lines, e.g. ColMajor::ColStride, and
+// the vector routines take any stride type, so that a unit stride
+// reaching them this way compiles to a contiguous loop, for any
+// scalar, rather than being tested at run time. It converts to
+// Stride wherever a runtime one is expected.
+template< Stride S >
+using StrideC = std::integral_constant< Stride, S >;
+
+using UnitStride = StrideC< 1 >;
+
+template< typename T_Stride >
+inline constexpr bool isStrideC = false;
+
+template< Stride S >
+inline constexpr bool isStrideC< StrideC< S > > = true;
+
+// Stride, or a StrideC.
+template< typename T_Stride >
+concept StrideArg = std::convertible_to< T_Stride, Stride >;
+
 class BadArgument /*: public System::BadArgument*/
 {
 public:
@@ -87,28 +139,40 @@ public:
 
 struct Flat
 {
-  template< typename T_Vec_x >
-  static constexpr auto &VecRef( const T_Vec_x &x, Index i, Stride x_s )
-  { return x[i*x_s]; }
-
-  template< typename T_Vec_x >
-  static constexpr auto VecPtr( const T_Vec_x &x, Index i, Stride x_s )
-  { return x + i*x_s; }
-
-  template< typename T_Vec_x >
-  static constexpr void VecInc( T_Vec_x &x, Stride x_s )
-  { x += x_s; }
-
-  template< typename T_Vec_x >
-  static constexpr void VecDec( T_Vec_x &x, Stride x_s )
-  { x -= x_s; }
+  template< typename T_Vec_x, StrideArg T_Stride >
+  static constexpr auto &VecRef( const T_Vec_x &x, Index i, T_Stride x_s )
+  {
+    if constexpr( isStrideC< T_Stride > ){ return x[i*T_Stride::value]; }
+    else{ return x[i*x_s]; }
+  }
+
+  template< typename T_Vec_x, StrideArg T_Stride >
+  static constexpr auto VecPtr( const T_Vec_x &x, Index i, T_Stride x_s )
+  {
+    if constexpr( isStrideC< T_Stride > ){ return x + i*T_Stride::value; }
+    else{ return x + i*x_s; }
+  }
+
+  template< typename T_Vec_x, StrideArg T_Stride >
+  static constexpr void VecInc( T_Vec_x &x, T_Stride x_s )
+  {
+    if constexpr( isStrideC< T_Stride > ){ x += T_Stride::value; }
+    else{ x += x_s; }
+  }
+
+  template< typename T_Vec_x, StrideArg T_Stride >
+  static constexpr void VecDec( T_Vec_x &x, T_Stride x_s )
+  {
+    if constexpr( isStrideC< T_Stride > ){ x -= T_Stride::value; }
+    else{ x -= x_s; }
+  }
 };
 
 struct ColMajor : Flat
 {
   template< typename T_Blk_A >
-  static constexpr Stride ColStride( const T_Blk_A &, Stride A_ld )
-  { return 1; }
+  static constexpr UnitStride ColStride( const T_Blk_A &, Stride )
+  { return {}; }
 
   template< typename T_Blk_A >
   static constexpr Stride RowStride( const T_Blk_A &, Stride A_ld )
@@ -137,6 +201,14 @@ struct ColMajor : Flat
   template< typename T_Blk_A >
   static constexpr auto DiagPtr( const T_Blk_A &A_, Index i, Index j, Stride A_ld )
   { return BlkPtr( A_, i, j, A_ld ); }
+
+  // Leading dimension argument of the diagonal block at DiagPtr( A_, i, i ).
+  static constexpr Stride DiagBlkLd( Index /*i*/, Stride A_ld )
+  { return A_ld; }
+
+  // Leading dimension of a contiguous m by n block.
+  static constexpr Stride DenseLd( Size m, Size /*n*/ )
+  { return (Stride)m; }
 };
 
 struct RowMajor : Flat
@@ -146,8 +218,8 @@ struct RowMajor : Flat
   { return A_ld; }
 
   template< typename T_Blk_A >
-  static constexpr Stride RowStride( const T_Blk_A &, Stride A_ld )
-  { return 1; }
+  static constexpr UnitStride RowStride( const T_Blk_A &, Stride )
+  { return {}; }
 
   template< typename T_Blk_A >
   static constexpr Stride DiagStride( const T_Blk_A &, Stride A_ld )
@@ -172,6 +244,113 @@ struct RowMajor : Flat
   template< typename T_Blk_A >
   static constexpr auto DiagPtr( const T_Blk_A &A_, Index i, Index j, Stride A_ld )
   { return BlkPtr( A_, i, j, A_ld ); }
+
+  // Leading dimension argument of the diagonal block at DiagPtr( A_, i, i ).
+  static constexpr Stride DiagBlkLd( Index /*i*/, Stride A_ld )
+  { return A_ld; }
+
+  // Leading dimension of a contiguous m by n block.
+  static constexpr Stride DenseLd( Size /*m*/, Size n )
+  { return (Stride)n; }
+};
+
+// Tile-major storage: the matrix is kept as B by B tiles, each a
+// contiguous ColMajor block of leading dimension B, with the tiles in
+// column-major order. The leading dimension argument is the number of
+// rows rounded up to a multiple of B, DenseLd( m, n ), and the matrix
+// takes DenseSize( m, n ) elements, the edge tiles padded. There is
+// no constant row or column stride. BlkPtr( A_, i, j, A_ld ) is the
+// origin of a TileMajor block with the same leading dimension when i
+// and j are multiples of B.
+template< Size B >
+struct TileMajor : Flat
+{
+  static_assert( B > 0 );
+
+  static constexpr Size tileSize = B;
+
+  // Offset of A(i,j) from A(0,0).
+  static constexpr Index Offset( Index i, Index j, Stride A_ld )
+  {
+    constexpr Index b = (Index)B;
+    return (i/b)*b*b + i%b + (j/b)*b*A_ld + (j%b)*b;
+  }
+
+  template< typename T_Blk_A >
+  static constexpr auto &MatRef( const T_Blk_A &A_, Index i, Index j, Stride A_ld )
+  { return A_[ Offset( i, j, A_ld ) ]; }
+
+  template< typename T_Blk_A >
+  static constexpr auto BlkPtr( const T_Blk_A &A_, Index i, Index j, Stride A_ld )
+  { return A_ + Offset( i, j, A_ld ); }
+
+  // Origin of tile (I,J), that is of A(I*B,J*B).
+  template< typename T_Blk_A >
+  static constexpr auto TilePtr( const T_Blk_A &A_, Index I, Index J, Stride A_ld )
+  { return A_ + ( I*(Index)(B*B) + J*(Index)B*A_ld ); }
+
+  // Leading dimension of a contiguous m by n block.
+  static constexpr Stride DenseLd( Size m, Size /*n*/ )
+  { return (Stride)( (m+B-1)/B*B ); }
+
+  // Elements taken by a contiguous m by n block.
+  static constexpr Size DenseSize( Size m, Size n )
+  { return (Size)DenseLd( m, n )*( (n+B-1)/B*B ); }
+};
+
+// Interleaved storage of groups of W matrices of the same size, one
+// lane per matrix: element (i,j) of lane l is A[(i + j*A_ld)*W + l].
+// A_ is the origin of one lane, the group origin plus l, and the lane
+// is then a ColMajor matrix with element stride W, so routines taking
+// a Lyt work on it as on any other; the batched drivers (e.g.
+// Sym_Eig_Ilv) run the W lanes in lockstep instead, with one SIMD
+// lane per matrix.
+template< Size W >
+struct Interleaved : Flat
+{
+  static_assert( W > 0 );
+
+  static constexpr Size width = W;
+
+  template< typename T_Blk_A >
+  static constexpr StrideC< (Stride)W > ColStride( const T_Blk_A &, Stride )
+  { return {}; }
+
+  template< typename T_Blk_A >
+  static constexpr Stride RowStride( const T_Blk_A &, Stride A_ld )
+  { return A_ld*(Stride)W; }
+
+  template< typename T_Blk_A >
+  static constexpr Stride DiagStride( const T_Blk_A &, Stride A_ld )
+  { return ( A_ld + 1 )*(Stride)W; }
+
+  template< typename T_Blk_A >
+  static constexpr auto &MatRef( const T_Blk_A &A_, Index i, Index j, Stride A_ld )
+  { return A_[ ( i + j*A_ld )*(Index)W ]; }
+
+  template< typename T_Blk_A >
+  static constexpr auto BlkPtr( const T_Blk_A &A_, Index i, Index j, Stride A_ld )
+  { return A_ + ( i + j*A_ld )*(Index)W; }
+
+  template< typename T_Blk_A >
+  static constexpr auto RowPtr( const T_Blk_A &A_, Index i, Index j, Stride A_ld )
+  { return BlkPtr( A_, i, j, A_ld ); }
+
+  template< typename T_Blk_A >
+  static constexpr auto ColPtr( const T_Blk_A &A_, Index i, Index j, Stride A_ld )
+  { return BlkPtr( A_, i, j, A_ld ); }
+
+  template< typename T_Blk_A >
+  static constexpr auto DiagPtr( const T_Blk_A &A_, Index i, Index j, Stride A_ld )
+  { return BlkPtr( A_, i, j, A_ld ); }
+
+  // Leading dimension argument of the diagonal block at DiagPtr( A_, i, i ).
+  static constexpr Stride DiagBlkLd( Index /*i*/, Stride A_ld )
+  { return A_ld; }
+
+  // Leading dimension of a contiguous m by n block.
+  static constexpr Stride DenseLd( Size m, Size /*n*/ )
+  { return (Stride)m; }
 };
 
 template< typename T_Layout >
@@ -180,6 +359,18 @@ inline constexpr bool isColMajor = areTheSame< T_Layout, ColMajor >;
 template< typename T_Layout >
 inline constexpr bool isRowMajor = areTheSame< T_Layout, RowMajor >;
 
+template< typename T_Layout >
+inline constexpr bool isTileMajor = false;
+
+template< Size B >
+inline constexpr bool isTileMajor< TileMajor< B > > = true;
+
+template< typename T_Layout >
+inline constexpr bool isInterleaved = false;
+
+template< Size W >
+inline constexpr bool isInterleaved< Interleaved< W > > = true;
+
 enum class Trnsp
 {
   No = 0,
@@ -206,6 +397,204 @@ enum class Side
   Right
 };
 
+//----------------------------------------------------------------
+// Layouts that keep one half of an n by n symmetric matrix in
+// Sym_PackedSize( n ) elements. For these the leading dimension
+// argument is the order n of the whole matrix, only the stored half
+// Lyt::half may be referenced, and the half argument of a routine
+// must be that one.
+//----------------------------------------------------------------
+
+inline constexpr Size Sym_PackedSize( Size n ) noexcept
+{ return n*(n+1)/2; }
+
+// Column-major packed storage of the lower half, as the LAPACK
+// routines dsp* take it: A(j:n-1,j) is contiguous for each j, so
+// columns have unit stride down from the diagonal, and each trailing
+// diagonal block A(i:n-1,i:n-1) is itself packed, of order n-i.
+struct PackedLower : Flat
+{
+  static constexpr Half half = Half::Lower;
+
+  template< typename T_Blk_A >
+  static constexpr UnitStride ColStride( const T_Blk_A &, Stride )
+  { return {}; }
+
+  template< typename T_Blk_A >
+  static constexpr auto &MatRef( const T_Blk_A &A_, Index i, Index j, Stride A_ld )
+  { return A_[ i + j*A_ld - j*(j+1)/2 ]; }
+
+  template< typename T_Blk_A >
+  static constexpr auto BlkPtr( const T_Blk_A &A_, Index i, Index j, Stride A_ld )
+  { return A_ + ( i + j*A_ld - j*(j+1)/2 ); }
+
+  template< typename T_Blk_A >
+  static constexpr auto ColPtr( const T_Blk_A &A_, Index i, Index j, Stride A_ld )
+  { return BlkPtr( A_, i, j, A_ld ); }
+
+  template< typename T_Blk_A >
+  static constexpr auto DiagPtr( const T_Blk_A &A_, Index i, Index j, Stride A_ld )
+  { return BlkPtr( A_, i, j, A_ld ); }
+
+  // Order of the trailing block at DiagPtr( A_, i, i ).
+  static constexpr Stride DiagBlkLd( Index i, Stride A_ld )
+  { return A_ld - i; }
+};
+
+// Column-major packed storage of the upper half: A(0:j,j) is
+// contiguous for each j, and each leading diagonal block
+// A(0:i-1,0:i-1) is itself packed. Only the leading diagonal blocks
+// keep the DiagBlkLd( 0, A_ld ) of the whole matrix.
+struct PackedUpper : Flat
+{
+  static constexpr Half half = Half::Upper;
+
+  template< typename T_Blk_A >
+  static constexpr UnitStride ColStride( const T_Blk_A &, Stride )
+  { return {}; }
+
+  template< typename T_Blk_A >
+  static constexpr auto &MatRef( const T_Blk_A &A_, Index i, Index j, Stride A_ld )
+  { return A_[ i + j*(j+1)/2 ]; }
+
+  template< typename T_Blk_A >
+  static constexpr auto BlkPtr( const T_Blk_A &A_, Index i, Index j, Stride A_ld )
+  { return A_ + ( i + j*(j+1)/2 ); }
+
+  template< typename T_Blk_A >
+  static constexpr auto ColPtr( const T_Blk_A &A_, Index i, Index j, Stride A_ld )
+  { return BlkPtr( A_, i, j, A_ld ); }
+
+  template< typename T_Blk_A >
+  static constexpr auto DiagPtr( const T_Blk_A &A_, Index i, Index j, Stride A_ld )
+  { return BlkPtr( A_, i, j, A_ld ); }
+
+  static constexpr Stride DiagBlkLd( Index /*i*/, Stride A_ld )
+  { return A_ld; }
+};
+
+namespace _n_Impl {
+
+  // The three dense parts of a matrix of order n in Rectangular Full
+  // Packed storage, as offsets into the column-major rectangle of
+  // leading dimension ld: the diagonal blocks A(0:n1-1,0:n1-1) at t1
+  // and A(n1:n-1,n1:n-1) at t2, each holding the half given, and the
+  // off-diagonal block at s, which is A(n1:n-1,0:n1-1) (n2 by n1) for
+  // the lower half and A(0:n1-1,n1:n-1) (n1 by n2) for the upper one.
+  struct _Rfp_Parts
+  {
+    Size n1, n2;
+    Stride ld;
+    Index t1; Half half1;
+    Index t2; Half half2;
+    Index s;
+  };
+
+}// namespace _n_Impl
+
+// Rectangular Full Packed storage of the lower half, as the LAPACK
+// routines dsf*/dpf* take it with transr = 'N': an (n+1) by n/2
+// column-major rectangle for even n, n by (n+1)/2 for odd n. Its
+// three parts, Parts( n ), are ordinary ColMajor blocks, so the
+// products over it go through the Level-3 kernels; there is no
+// constant column stride.
+struct RfpLower : Flat
+{
+  static constexpr Half half = Half::Lower;
+
+  static constexpr _n_Impl::_Rfp_Parts Parts( Size n )
+  {
+    const Index e = ( 0 == n%2 ) ? 1 : 0;
+    const Size n1 = (n+1)/2;
+    const Stride ld = (Stride)n + e;
+    return { n1, n-n1, ld, e, Half::Lower, (1-e)*ld, Half::Upper, (Index)n1 + e };
+  }
+
+  template< typename T_Blk_A >
+  static constexpr auto &MatRef( const T_Blk_A &A_, Index i, Index j, Stride A_ld )
+  {
+    const Index e = ( 0 == A_ld%2 ) ? 1 : 0;
+    const Index n1 = (A_ld+1)/2;
+    const Stride ld = A_ld + e;
+    return ( j < n1 )
+      ? A_[ (i+e) + j*ld ]
+      : A_[ (j-n1) + (i-n1+1-e)*ld ];
+  }
+
+  template< typename T_Blk_A >
+  static constexpr auto BlkPtr( const T_Blk_A &A_, Index i, Index j, Stride A_ld )
+  { return &MatRef( A_, i, j, A_ld ); }
+};
+
+// Rectangular Full Packed storage of the upper half, with
+// transr = 'N', as for RfpLower.
+struct RfpUpper : Flat
+{
+  static constexpr Half half = Half::Upper;
+
+  static constexpr _n_Impl::_Rfp_Parts Parts( Size n )
+  {
+    const Index e = ( 0 == n%2 ) ? 1 : 0;
+    const Size n1 = n/2;
+    const Stride ld = (Stride)n + e;
+    return { n1, n-n1, ld, (Index)n1+1, Half::Lower, (Index)n1, Half::Upper, 0 };
+  }
+
+  template< typename T_Blk_A >
+  static constexpr auto &MatRef( const T_Blk_A &A_, Index i, Index j, Stride A_ld )
+  {
+    const Index e = ( 0 == A_ld%2 ) ? 1 : 0;
+    const Index n1 = A_ld/2;
+    const Stride ld = A_ld + e;
+    return ( j >= n1 )
+      ? A_[ i + (j-n1)*ld ]
+      : A_[ (j+n1+1) + i*ld ];
+  }
+
+  template< typename T_Blk_A >
+  static constexpr auto BlkPtr( const T_Blk_A &A_, Index i, Index j, Stride A_ld )
+  { return &MatRef( A_, i, j, A_ld ); }
+};
+
+template< typename T_Layout >
+inline constexpr bool isPacked = areTheSame< T_Layout, PackedLower >
+  || areTheSame< T_Layout, PackedUpper >;
+
+template< typename T_Layout >
+inline constexpr bool isRfp = areTheSame< T_Layout, RfpLower >
+  || areTheSame< T_Layout, RfpUpper >;
+
+//----------------------------------------------------------------
+// Band storage, as the LAPACK routines dgb* and dsb* take it: an
+// m by n matrix with kl subdiagonals and ku superdiagonals is kept in
+// a ColMajor array of at least DenseLd( kl, ku ) rows and n columns,
+// with A(i,j) in row ku+i-j of column j, for
+// max(0,j-ku) <= i <= min(m-1,j+kl). The band routines take ku, the
+// row of the diagonal, next to the leading dimension.
+//
+// Moving along a row of A moves A_ld-1 elements in the array, so a
+// block of A that lies inside the band is an ordinary ColMajor block
+// at BlkPtr, of leading dimension BlkLd( A_ld ); that is how the band
+// routines reach the Level-2 kernels.
+//----------------------------------------------------------------
+
+struct Band : Flat
+{
+  template< typename T_Blk_A >
+  static constexpr auto &MatRef( const T_Blk_A &A_, Index i, Index j, Stride A_ld, Size ku )
+  { return A_[ ( (Index)ku+i-j ) + j*A_ld ]; }
+
+  template< typename T_Blk_A >
+  static constexpr auto BlkPtr( const T_Blk_A &A_, Index i, Index j, Stride A_ld, Size ku )
+  { return A_ + ( ( (Index)ku+i-j ) + j*A_ld ); }
+
+  static constexpr Stride BlkLd( Stride A_ld )
+  { return A_ld-1; }
+
+  static constexpr Stride DenseLd( Size kl, Size ku )
+  { return (Stride)( kl+ku+1 ); }
+};
+
 }// namespace BLAS
 }// namespace Math
 }// namespace IND
@@ -224,15 +613,18 @@ enum class Side
 // provide some operational symmetry within the BLAS layer itself.
 //----------------------------------------------------------------
 
+#include <IND.Math.BLAS.Aux_Trace.inl>         // <-------- extension (instrumentation hooks)
+#include <IND.Math.BLAS.Aux_VecKrnl.inl>     // <-------- extension (Level-1 kernel dispatch)
 #include <IND.Math.BLAS.Vec_X.inl>
-#include <IND.Math.BLAS.Sym_Rank2Upd.inl>     // xsyr2
-#include <IND.Math.BLAS.Sym_Rank2kUpd.inl>    // xsyr2k
-#include <IND.Math.BLAS.Sym_VecMul.inl>       // xsymv
+#include <IND.Math.BLAS.Aux_ThrdTeam.inl>     // <-------- extension (fork-join worker team)
+#include <IND.Math.BLAS.Aux_Exec.inl>         // <-------- extension (execution contexts)
+#include <IND.Math.BLAS.Aux_Tuning.inl>       // <-------- extension (tuning file)
+#include <IND.Math.BLAS.Aux_Arena.inl>        // <-------- extension (workspace arena)
+#include <IND.Math.BLAS.Aux_Matrix.inl>       // <-------- extension (aligned matrix container)
+#include <IND.Math.BLAS.Aux_PanelStore.inl>   // <-------- extension (out-of-core panel stores)
 
 #include <IND.Math.BLAS.Tri_VecMul.inl>       // xtrmv
-#include <IND.Math.BLAS.Tri_MatMul.inl>       // xtrmm
 #include <IND.Math.BLAS.Tri_Solv_Vec.inl>     // xtrsv
-#include <IND.Math.BLAS.Tri_Solv_Mat.inl>     // xtrsm
 
 #include <IND.Math.BLAS.Mat_Copy.inl>         // xlacpy with extended functionality
 #include <IND.Math.BLAS.Mat_Scale.inl>        // <-------- extension
@@ -240,11 +632,31 @@ enum class Side
 #include <IND.Math.BLAS.Mat_Rank1Upd.inl>     // xger
 #include <IND.Math.BLAS.Mat_VecMul.inl>       // xgemv
 #include <IND.Math.BLAS.Mat_ConjVecMul.inl>   // <-------- extension
+#include <IND.Math.BLAS.Sym_Rank2Upd.inl>     // xsyr2 | xspr2
+#include <IND.Math.BLAS.Sym_VecMul.inl>       // xsymv | xspmv
+#include <IND.Math.BLAS.Sym_Copy.inl>         // xtrttp | xtpttr | xtrttf | xtfttr
+#include <IND.Math.BLAS.Aux_PkdMatMul.inl>    // <-------- extension (packed xgemm engine)
 #include <IND.Math.BLAS.Mat_MatMul.inl>       // xgemm
+#include <IND.Math.BLAS.Tri_MatMul.inl>       // xtrmm | recursive xtrmm
+#include <IND.Math.BLAS.Tri_Solv_Mat.inl>     // xtrsm | recursive xtrsm
+#include <IND.Math.BLAS.Sym_MatMul.inl>       // xsymm
+#include <IND.Math.BLAS.Sym_RankKUpd.inl>     // xsyrk | xsfrk
+#include <IND.Math.BLAS.Sym_Rank2kUpd.inl>    // xsyr2k
 
 #include <IND.Math.BLAS.Mat_RowSwp.inl>        // xlaswp
+#include <IND.Math.BLAS.Aux_Device.inl>       // <-------- extension (device offload)
+#include <IND.Math.BLAS.Aux_Dist.inl>         // <-------- extension (block-cyclic process grids)
 #include <IND.Math.BLAS.Mat_Fctr_LU.inl>      // xgetrf | xgetrf2
 #include <IND.Math.BLAS.Mat_Solv_LU.inl>      // xgetsv | xgetrs
+#include <IND.Math.BLAS.Mat_Solv_Refined.inl> // dsgesv
+#include <IND.Math.BLAS.Bnd_Fctr_LU.inl>      // xgbtf2
+#include <IND.Math.BLAS.Bnd_Solv_LU.inl>      // xgbtrs
+#include <IND.Math.BLAS.Mat_Fctr_LU_Bat.inl>  // <-------- extension (batched small LU)
+#include <IND.Math.BLAS.Mat_Fctr_LU_OOC.inl>  // <-------- extension (out-of-core LU)
+#include <IND.Math.BLAS.Mat_Fctr_LU_Dev.inl>  // <-------- extension (hybrid host-device LU)
+#include <IND.Math.BLAS.Mat_Fctr_LU_Dst.inl>  // <-------- extension (distributed LU)
+#include <IND.Math.BLAS.Sym_Fctr_Chol.inl>    // xpotrf | xpotrf2
+#include <IND.Math.BLAS.Sym_Solv_Chol.inl>    // xpotrs
 
 #undef __IND_MATH_BLAS_H_CONTENTS__
 
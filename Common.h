@@ -24,6 +24,7 @@
 #include <string>
 #include <type_traits>
 #include <cmath>
+#include <limits>
 #include <memory>
 #include <numeric>
 
@@ -238,34 +239,82 @@ namespace Math {
     return 0;
   }
 
-  inline bool IsUndefined( Float32 x ) noexcept
-  { return std::isnan( x ); }
-  inline bool IsUndefined( Float64 x ) noexcept
-  { return std::isnan( x ); }
+  namespace _n_Impl {
+
+    // Constant-evaluation fallbacks for the functions below, whose
+    // <cmath> counterparts are not constexpr. Results agree with
+    // <cmath> to the last bit or two; signed zeros and NaN payloads
+    // are not preserved.
+
+    template< typename T_Value >
+    constexpr T_Value _ConstAbs( T_Value x ) noexcept
+    { return ( x < 0 ) ? -x : x; }
+
+    template< typename T_Value >
+    constexpr T_Value _ConstSqrt( T_Value x ) noexcept
+    {
+      if( ( x != x ) || ( x == 0 ) || ( x == std::numeric_limits< T_Value >::infinity() ) )
+      { return x; }
+      if( x < 0 )
+      { return std::numeric_limits< T_Value >::quiet_NaN(); }
+
+      // Newton's method from above converges monotonically.
+      T_Value y = ( x > 1 ) ? x : T_Value(1);
+      for( ;; )
+      {
+        const T_Value y1 = ( y + x/y )/2;
+        if( !( y1 < y ) ){ return y; }
+        y = y1;
+      }
+    }
+
+    template< typename T_Value >
+    constexpr T_Value _ConstHypot( T_Value x, T_Value y ) noexcept
+    {
+      x = _ConstAbs( x );
+      y = _ConstAbs( y );
+      const T_Value big = ( x > y ) ? x : y;
+      const T_Value small = ( x > y ) ? y : x;
+      if( ( big == 0 ) || ( big == std::numeric_limits< T_Value >::infinity() ) )
+      { return big; }
+      const T_Value r = small/big;
+      return big*_ConstSqrt( 1 + r*r );
+    }
+
+    template< typename T_Value >
+    constexpr T_Value _ConstCopySign( T_Value to, T_Value from ) noexcept
+    { return ( from < 0 ) ? -_ConstAbs( to ) : _ConstAbs( to ); }
+
+  }// namespace _n_Impl
+
+  inline constexpr bool IsUndefined( Float32 x ) noexcept
+  { return std::is_constant_evaluated() ? ( x != x ) : std::isnan( x ); }
+  inline constexpr bool IsUndefined( Float64 x ) noexcept
+  { return std::is_constant_evaluated() ? ( x != x ) : std::isnan( x ); }
 
   // The version of Abs used in the parent library
   // is based on a branch-free NaN check and bit masking.
-  inline Float32 Abs( Float32 x ) noexcept
-  { return std::abs( x ); }
-  inline Float32 Sqr( Float32 x ) noexcept
+  inline constexpr Float32 Abs( Float32 x ) noexcept
+  { return std::is_constant_evaluated() ? _n_Impl::_ConstAbs( x ) : std::abs( x ); }
+  inline constexpr Float32 Sqr( Float32 x ) noexcept
   { return x*x; }
-  inline Float32 Sqrt( Float32 x ) noexcept
-  { return std::sqrt( x ); }
-  inline Float32 Hypot( Float32 x, Float32 y ) noexcept
-  { return std::hypot( x, y ); }
-  inline Float32 CopySign( Float32 to, Float32 from ) noexcept
-  { return std::copysign( to, from ); }
-
-  inline Float64 Abs( Float64 x ) noexcept
-  { return std::abs( x ); }
-  inline Float64 Sqr( Float64 x ) noexcept
+  inline constexpr Float32 Sqrt( Float32 x ) noexcept
+  { return std::is_constant_evaluated() ? _n_Impl::_ConstSqrt( x ) : std::sqrt( x ); }
+  inline constexpr Float32 Hypot( Float32 x, Float32 y ) noexcept
+  { return std::is_constant_evaluated() ? _n_Impl::_ConstHypot( x, y ) : std::hypot( x, y ); }
+  inline constexpr Float32 CopySign( Float32 to, Float32 from ) noexcept
+  { return std::is_constant_evaluated() ? _n_Impl::_ConstCopySign( to, from ) : std::copysign( to, from ); }
+
+  inline constexpr Float64 Abs( Float64 x ) noexcept
+  { return std::is_constant_evaluated() ? _n_Impl::_ConstAbs( x ) : std::abs( x ); }
+  inline constexpr Float64 Sqr( Float64 x ) noexcept
   { return x*x; }
-  inline Float64 Sqrt( Float64 x ) noexcept
-  { return std::sqrt( x ); }
-  inline Float64 Hypot( Float64 x, Float64 y ) noexcept
-  { return std::hypot( x, y ); }
-  inline Float64 CopySign( Float64 to, Float64 from ) noexcept
-  { return std::copysign( to, from ); }
+  inline constexpr Float64 Sqrt( Float64 x ) noexcept
+  { return std::is_constant_evaluated() ? _n_Impl::_ConstSqrt( x ) : std::sqrt( x ); }
+  inline constexpr Float64 Hypot( Float64 x, Float64 y ) noexcept
+  { return std::is_constant_evaluated() ? _n_Impl::_ConstHypot( x, y ) : std::hypot( x, y ); }
+  inline constexpr Float64 CopySign( Float64 to, Float64 from ) noexcept
+  { return std::is_constant_evaluated() ? _n_Impl::_ConstCopySign( to, from ) : std::copysign( to, from ); }
 
   template< typename T_Value >
   inline constexpr T_Value Inv( const T_Value &x ) noexcept
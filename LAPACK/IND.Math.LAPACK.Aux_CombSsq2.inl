@@ -22,7 +22,7 @@ constexpr void Aux_CombSsq2( T_Scalar (&v1)[2], T_Scalar (&v2)[2] )
   if( v1[0] >= v2[0] )
   {
     if( 0.0 != v1[0] )
-    { v1[1] = v2[1] + Sqr(v2[0]/v1[0])*v2[1]; }else
+    { v1[1] = v1[1] + Sqr(v2[0]/v1[0])*v2[1]; }else
     { v1[1] = v1[1] + v2[1]; }
   }
   else
@@ -0,0 +1,151 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Default panel width for the blocked orthogonal factorizations
+/// (<see cref="Mat_Fctr_QR_Blk"/>, <see cref="Mat_Fctr_LQ_Blk"/>,
+/// <see cref="Mat_Fctr_QL_Blk"/>, <see cref="Mat_Fctr_RQ_Blk"/>),
+/// and for the blocked generators and reductions built on them.
+/// </summary>
+inline constexpr Size Mat_Fctr_BlkSize = 32;
+
+namespace _n_Impl {
+
+  // Workspace of the shared driver: T (nb by nb) followed by the
+  // Rfl_BlkMul workspace, which is w by nb, where w is the extent
+  // of the trailing matrix along the side that is not reflected.
+  inline constexpr Size _Aux_FctrBlk_WorkSize( Size w, Size nb ) noexcept
+  { return nb*nb + Max( w, (Size)1 )*nb; }
+
+  // Panel-factor-then-update driver shared by the blocked QR, LQ,
+  // QL and RQ factorizations. The reflector layout is determined by
+  // direct (which end of A the factorization starts from) and storev
+  // (whether reflectors are stored in columns or in rows):
+  //
+  //   QR: Fwd, ByCol    LQ: Fwd, ByRow
+  //   QL: Bwd, ByCol    RQ: Bwd, ByRow
+  //
+  // pnl( m, n, A_, tau, work ) is the unblocked factorization,
+  // applied to one panel of at most nb reflectors; it may use the
+  // Rfl_BlkMul part of work as its own workspace.
+  template< typename Lyt,
+    typename T_Blk_A,
+    typename T_Arr_tau,
+    typename T_Arr_work,
+    typename T_Fn_Pnl >
+  constexpr void _Aux_FctrBlk(
+    Direct direct, Store storev,
+    Size m, Size n,
+    T_Blk_A A_, Stride A_ld,
+    T_Arr_tau tau,
+    T_Arr_work work,
+    Size nb,
+    T_Fn_Pnl &&pnl )
+  {
+    auto A_Blk = [&]( auto i, auto j ) -> auto
+    { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+
+    const Size k = Min( m, n );
+
+    const bool byCol = ( Store::ByCol == storev );
+
+    // Reflectors in columns are applied to the trailing columns from
+    // the left as ~H; reflectors in rows to the trailing rows from the
+    // right as H.
+    const Side side = byCol ? Side::Left : Side::Right;
+    const Trnsp H_trnsp = byCol ? Trnsp::Yes : Trnsp::No;
+
+    const auto T_ = work;
+    const auto W_ = work + nb*nb;
+
+    const Stride T_ld = Lyt::DenseLd( nb, nb );
+    const Stride W_ld = Lyt::DenseLd( Max( byCol ? n : m, (Size)1 ), nb );
+
+    for( Size b = 0; b < k; b += nb )
+    {
+      const Size ib = Min( k-b, nb );
+
+      // Reflectors i:i+ib-1, taken from the leading end of A for a
+      // forward factorization and from the trailing end otherwise.
+      const Size i = ( Direct::Fwd == direct ) ? b : k-b-ib;
+
+      // (r0,c0) is the diagonal element of the panel's first reflector.
+      const Size r0 = ( Direct::Fwd == direct ) ? i : (m-k)+i;
+      const Size c0 = ( Direct::Fwd == direct ) ? i : (n-k)+i;
+
+      // The panel to factor.
+      Size pnl_m, pnl_n;
+      Index pnl_i, pnl_j;
+
+      // The trailing matrix C the block reflector is applied to.
+      Size C_m, C_n;
+      Index C_i, C_j;
+
+      if( Direct::Fwd == direct )
+      {
+        pnl_i = (Index)r0; pnl_j = (Index)c0;
+        if( byCol )
+        {
+          pnl_m = m-r0; pnl_n = ib;
+          C_i = (Index)r0; C_j = (Index)(c0+ib);
+          C_m = m-r0; C_n = n-(c0+ib);
+        }
+        else
+        {
+          pnl_m = ib; pnl_n = n-c0;
+          C_i = (Index)(r0+ib); C_j = (Index)c0;
+          C_m = m-(r0+ib); C_n = n-c0;
+        }
+      }
+      else
+      {
+        if( byCol )
+        {
+          pnl_i = 0; pnl_j = (Index)c0;
+          pnl_m = r0+ib; pnl_n = ib;
+          C_i = 0; C_j = 0;
+          C_m = r0+ib; C_n = c0;
+        }
+        else
+        {
+          pnl_i = (Index)r0; pnl_j = 0;
+          pnl_m = ib; pnl_n = c0+ib;
+          C_i = 0; C_j = 0;
+          C_m = r0; C_n = c0+ib;
+        }
+      }
+
+      // Factor the panel
+      pnl( pnl_m, pnl_n, A_Blk( pnl_i, pnl_j ), tau + i, W_ );
+
+      if( ( C_m > 0 ) && ( C_n > 0 ) )
+      {
+        const Size order = byCol ? pnl_m : pnl_n;
+
+        // Form the triangular factor of the block reflector
+        Rfl_BlkGen< Lyt >( direct, storev,
+          order, ib, A_Blk( pnl_i, pnl_j ), A_ld, tau + i, T_, T_ld );
+
+        // Apply it to the trailing matrix
+        Rfl_BlkMul< Lyt >( side, H_trnsp, direct, storev,
+          C_m, C_n, ib,
+          A_Blk( pnl_i, pnl_j ), A_ld,
+          T_, T_ld,
+          A_Blk( C_i, C_j ), A_ld,
+          W_, W_ld );
+      }
+    }
+  }
+
+}// namespace _n_Impl
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
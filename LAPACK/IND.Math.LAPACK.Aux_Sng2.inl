@@ -0,0 +1,79 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Singular values of the upper triangular matrix:
+///
+/// [ f g ]
+/// [ 0 h ]
+///
+/// On return, ssmin is the smaller and ssmax the larger singular value.
+/// </summary>
+/// <remarks>
+/// This is based on the LAPACK routine <c>dlas2</c>.
+/// </remarks>
+template< typename T_Scalar >
+requires( ! isComplex< T_Scalar > )
+constexpr void Aux_Sng2(
+  const T_Scalar &f, const T_Scalar &g, const T_Scalar &h,
+  T_Scalar &ssmin, T_Scalar &ssmax )
+{
+  const T_Scalar one = unit<T_Scalar>;
+  const T_Scalar two = one + one;
+
+  const auto fa = Abs( f );
+  const auto ga = Abs( g );
+  const auto ha = Abs( h );
+  const auto fhmn = Min( fa, ha );
+  const auto fhmx = Max( fa, ha );
+
+  if( IsZero( fhmn ) )
+  {
+    ssmin = {};
+    if( IsZero( fhmx ) )
+    { ssmax = ga; }
+    else
+    { ssmax = Max( fhmx, ga )*Sqrt( one + Sqr( Min( fhmx, ga )/Max( fhmx, ga ) ) ); }
+  }
+  else if( ga < fhmx )
+  {
+    const auto as = one + fhmn/fhmx;
+    const auto at = ( fhmx - fhmn )/fhmx;
+    const auto au = Sqr( ga/fhmx );
+    const auto c = two/( Sqrt( as*as + au ) + Sqrt( at*at + au ) );
+    ssmin = fhmn*c;
+    ssmax = fhmx/c;
+  }
+  else
+  {
+    const auto au = fhmx/ga;
+    if( IsZero( au ) )
+    {
+      // Avoid possible harmful underflow if exponent range
+      // asymmetric (true ssmin may not underflow even if au
+      // underflows)
+      ssmin = ( fhmn*fhmx )/ga;
+      ssmax = ga;
+    }
+    else
+    {
+      const auto as = one + fhmn/fhmx;
+      const auto at = ( fhmx - fhmn )/fhmx;
+      const auto c = one/( Sqrt( one + Sqr( as*au ) ) + Sqrt( one + Sqr( at*au ) ) );
+      ssmin = ( fhmn*c )*au;
+      ssmin = ssmin + ssmin;
+      ssmax = ga/( c + c );
+    }
+  }
+}
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
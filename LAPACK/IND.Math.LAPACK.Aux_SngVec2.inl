@@ -0,0 +1,181 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Singular value decomposition of the upper triangular matrix:
+///
+/// [ f g ]
+/// [ 0 h ]
+///
+/// On return, abs(ssmax) is the larger singular value, abs(ssmin) is
+/// the smaller singular value, and (csl,snl) and (csr,snr) are the left
+/// and right singular vectors for abs(ssmax), giving the decomposition
+///
+/// [  csl  snl ] [ f g ] [ csr -snr ]  =  [ ssmax   0   ]
+/// [ -snl  csl ] [ 0 h ] [ snr  csr ]     [  0    ssmin ].
+/// </summary>
+/// <remarks>
+/// This is based on the LAPACK routine <c>dlasv2</c>.
+/// </remarks>
+template< typename T_Scalar >
+requires( ! isComplex< T_Scalar > )
+constexpr void Aux_SngVec2(
+  const T_Scalar &f, const T_Scalar &g, const T_Scalar &h,
+  T_Scalar &ssmin, T_Scalar &ssmax,
+  T_Scalar &snr, T_Scalar &csr,
+  T_Scalar &snl, T_Scalar &csl )
+{
+  using _n_Impl::_oneHalf;
+
+  const T_Scalar one = unit<T_Scalar>;
+  const T_Scalar two = one + one;
+  const T_Scalar four = two + two;
+  const T_Scalar eps = std::numeric_limits< T_Scalar >::epsilon();
+
+  auto ft = f;
+  auto fa = Abs( ft );
+  auto ht = h;
+  auto ha = Abs( h );
+
+  // pmax points to the maximum absolute element of the matrix:
+  // 1 if f, 2 if g, 3 if h.
+  int pmax = 1;
+
+  const bool swap = ( ha > fa );
+  if( swap )
+  {
+    pmax = 3;
+    std::swap( ft, ht );
+    std::swap( fa, ha );
+
+    // Now fa >= ha
+  }
+
+  const auto gt = g;
+  const auto ga = Abs( gt );
+
+  T_Scalar clt{}, crt{}, slt{}, srt{};
+
+  if( IsZero( ga ) )
+  {
+    // Diagonal matrix
+    ssmin = ha;
+    ssmax = fa;
+    clt = one;
+    crt = one;
+    slt = {};
+    srt = {};
+  }
+  else
+  {
+    bool gasmal = true;
+
+    if( ga > fa )
+    {
+      pmax = 2;
+      if( ( fa/ga ) < eps )
+      {
+        // Case of very large ga
+        gasmal = false;
+        ssmax = ga;
+        if( ha > one )
+        { ssmin = fa/( ga/ha ); }
+        else
+        { ssmin = ( fa/ga )*ha; }
+        clt = one;
+        slt = ht/gt;
+        srt = one;
+        crt = ft/gt;
+      }
+    }
+
+    if( gasmal )
+    {
+      // Normal case
+      const auto d = fa - ha;
+
+      // Copes with infinite f or h
+      const auto l = ( d == fa ) ? one : d/fa;
+
+      // Note that 0 <= l <= 1
+      const auto m = gt/ft;
+
+      // Note that abs(m) <= 1/macheps
+      auto t = two - l;
+
+      // Note that t >= 1
+      const auto mm = m*m;
+      const auto tt = t*t;
+      const auto s = Sqrt( tt + mm );
+
+      // Note that 1 <= s <= 1 + 1/macheps
+      const auto r = IsZero( l ) ? Abs( m ) : Sqrt( l*l + mm );
+
+      // Note that 0 <= r <= 1 + 1/macheps
+      const auto a = _oneHalf< T_Scalar >*( s + r );
+
+      // Note that 1 <= a <= 1 + abs(m)
+      ssmin = ha/a;
+      ssmax = fa*a;
+
+      if( IsZero( mm ) )
+      {
+        // Note that m is very tiny
+        if( IsZero( l ) )
+        { t = CopySign( two, ft )*CopySign( one, gt ); }
+        else
+        { t = gt/CopySign( d, ft ) + m/t; }
+      }
+      else
+      {
+        t = ( m/( s + t ) + m/( r + l ) )*( one + a );
+      }
+
+      const auto lt = Sqrt( t*t + four );
+      crt = two/lt;
+      srt = t/lt;
+      clt = ( crt + srt*m )/a;
+      slt = ( ht/ft )*srt/a;
+    }
+  }
+
+  if( swap )
+  {
+    csl = srt;
+    snl = crt;
+    csr = slt;
+    snr = clt;
+  }
+  else
+  {
+    csl = clt;
+    snl = slt;
+    csr = crt;
+    snr = srt;
+  }
+
+  // Correct signs of ssmax and ssmin
+
+  T_Scalar tsign{};
+  switch( pmax )
+  {
+  default:
+  case 1: tsign = CopySign( one, csr )*CopySign( one, csl )*CopySign( one, f ); break;
+  case 2: tsign = CopySign( one, snr )*CopySign( one, csl )*CopySign( one, g ); break;
+  case 3: tsign = CopySign( one, snr )*CopySign( one, snl )*CopySign( one, h ); break;
+  }
+
+  ssmax = CopySign( ssmax, tsign );
+  ssmin = CopySign( ssmin, tsign*CopySign( one, f )*CopySign( one, h ) );
+}
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
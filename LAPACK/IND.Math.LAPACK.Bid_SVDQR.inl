@@ -0,0 +1,591 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Bid_SVDQR"/>.
+/// </summary>
+inline constexpr Size Bid_SVDQR_WorkSize( Size n ) noexcept
+{ return 4*n; }
+
+/// <summary>
+/// Singular value decomposition of a real n by n upper or lower
+/// bidiagonal matrix B = Q*S*(~P), where S is diagonal with the
+/// singular values in decreasing order, and Q and P are orthogonal,
+/// using the implicit zero-shift and shifted QR iterations of Demmel
+/// and Kahan.
+///
+/// When singular vectors are wanted, the nru by n matrix U is replaced
+/// by U*Q and the n by ncvt matrix Vt by (~P)*Vt, so that with U and
+/// Vt holding the vectors from <see cref="Ort_From_Bid"/> they end up
+/// holding the left and right singular vectors of the matrix that was
+/// bidiagonalized.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dbdsqr</c>, without the C argument,
+/// and always computing the singular values to high relative accuracy.
+/// Values-only calls use the same iteration rather than <c>dlasq1</c>.
+/// </remarks>
+template< typename T_Scalar, typename DefaultLyt = ColMajor >
+requires( ! isComplex< T_Scalar > )
+class Bid_SVDQR
+{
+public:
+
+  using Scalar = T_Scalar;
+
+  struct Config
+  {
+    // Iterations allowed per singular value, times n
+    Size maxIterationCount = 6;
+    Scalar zeroTol = std::numeric_limits< T_Scalar >::epsilon();
+  };
+
+private:
+
+  Config _config;
+
+public:
+
+  constexpr const Config &config() const noexcept
+  { return this->_config; }
+  constexpr void SetConfig( const Config &config ) noexcept
+  { this->_config = config; }
+
+  IND_NOTHROW_VITAE( Bid_SVDQR );
+
+  /// <summary>
+  /// Computes the singular values of B, and the singular vectors if
+  /// ncvt or nru is nonzero. B is upper bidiagonal for Half::Upper
+  /// and lower bidiagonal for Half::Lower, with its diagonal in d
+  /// (n elements) and its off-diagonal in e (n-1 elements). On return,
+  /// d holds the singular values, and e is destroyed.
+  ///
+  /// work must hold <see cref="Bid_SVDQR_WorkSize"/>( n ) elements.
+  /// Returns false if the iteration failed to converge.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Blk_Vt,
+    typename T_Blk_U,
+    typename T_Arr_work >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Arr_d> >,
+    Decay< DerefTypeOf<T_Arr_e> >,
+    Decay< DerefTypeOf<T_Blk_Vt> >,
+    Decay< DerefTypeOf<T_Blk_U> >,
+    Decay< DerefTypeOf<T_Arr_work>> >)
+  constexpr bool Solve( Half half, Size n, Size ncvt, Size nru,
+    T_Arr_d d, T_Arr_e e,
+    T_Blk_Vt Vt_, Stride Vt_ld,
+    T_Blk_U U_, Stride U_ld,
+    T_Arr_work work ) const
+  {
+    IND_MATH_TRACE_SCOPE( "Bid_SVDQR", n, ncvt, nru, 0,
+      ( 2.0*( ncvt + nru )*n + 4.0*n )*sizeof( Scalar ) );
+
+    if( ( Half::Upper != half ) && ( Half::Lower != half ) )
+    { throw BadArgument{ "Bid_SVDQR::Solve", 1 }; }
+
+    if( 0 == n ){ return true; }
+
+    auto Vt_Blk = [&]( auto i, auto j ) -> auto
+    { return Lyt::BlkPtr( Vt_, i, j, Vt_ld ); };
+    auto Vt_Row = [&]( auto i, auto j ) -> auto
+    { return Lyt::RowPtr( Vt_, i, j, Vt_ld ); };
+    auto U_Blk = [&]( auto i, auto j ) -> auto
+    { return Lyt::BlkPtr( U_, i, j, U_ld ); };
+    auto U_Col = [&]( auto i, auto j ) -> auto
+    { return Lyt::ColPtr( U_, i, j, U_ld ); };
+
+    const auto Vt_rs = Lyt::RowStride( Vt_, Vt_ld );
+    const auto U_cs = Lyt::ColStride( U_, U_ld );
+
+    const Scalar zero = {};
+    const Scalar one = unit<Scalar>;
+
+    // Rotations of a sweep: (C0,S0) are applied to Vt, (C1,S1) to U,
+    // or the other way around for sweeps from the bottom up
+    const T_Arr_work C0 = work;
+    const T_Arr_work S0 = work + n;
+    const T_Arr_work C1 = work + 2*n;
+    const T_Arr_work S1 = work + 3*n;
+
+    // If the matrix is lower bidiagonal, rotate it to be upper
+    // bidiagonal by applying Givens rotations on the left
+
+    if( Half::Lower == half )
+    {
+      for( Index i = 0; i < (Index)(n-1); ++i )
+      {
+        Scalar cs, sn, r;
+        Aux_PlnRot2( d[i], e[i], cs, sn, r );
+        d[i] = r;
+        e[i] = sn*d[i+1];
+        d[i+1] = cs*d[i+1];
+        C0[i] = cs;
+        S0[i] = sn;
+      }
+
+      if( nru > 0 )
+      { Mat_RotSeq< Lyt >( Side::Right, Pivot::Var, Direct::Fwd, nru, n, C0, S0, U_, U_ld ); }
+    }
+
+    const Scalar eps = this->_config.zeroTol;
+    const Scalar unfl = minValue<Scalar>;
+
+    // tol is the relative accuracy the singular values are computed
+    // to: tolmul*eps, where tolmul = max( 10, min( 100, eps^(-1/8) ) )
+    const Scalar tolmul = Clamp( Inv( Sqrt( Sqrt( Sqrt( eps ) ) ) ), Scalar( 10 ), Scalar( 100 ) );
+    const Scalar tol = tolmul*eps;
+
+    // Compute approximate maximum singular value, and the threshold
+    // below which off-diagonal elements are negligible
+
+    Scalar smax = {};
+    for( Index i = 0; i < (Index)n; ++i )
+    { smax = Max( smax, Abs( d[i] ) ); }
+    for( Index i = 0; i < (Index)(n-1); ++i )
+    { smax = Max( smax, Abs( e[i] ) ); }
+
+    Scalar sminoa = Abs( d[0] );
+    if( ! IsZero( sminoa ) )
+    {
+      Scalar mu = sminoa;
+      for( Index i = 1; i < (Index)n; ++i )
+      {
+        mu = Abs( d[i] )*( mu/( mu + Abs( e[i-1] ) ) );
+        sminoa = Min( sminoa, mu );
+        if( IsZero( sminoa ) ){ break; }
+      }
+    }
+    sminoa = sminoa/Sqrt( Scalar( n ) );
+
+    const Size maxitr = this->_config.maxIterationCount;
+    const Scalar thresh = Max( tol*sminoa, Scalar( maxitr )*( Scalar( n )*( Scalar( n )*unfl ) ) );
+
+    // Prepare for main iteration loop for the singular values
+    // (maxit is the maximum number of passes through the inner
+    // loop permitted before nonconvergence signalled.)
+
+    const Size maxit = maxitr*n*n;
+    Size iter = 0;
+    Index oldll = -1;
+    Index oldm = -1;
+    bool fwd = true;
+
+    // m points to last element of unconverged part of matrix
+
+    Index m = (Index)(n-1);
+
+    while( m > 0 )
+    {
+      if( iter > maxit )
+      {
+        // Failed to converge.
+        return false;
+      }
+
+      // Find diagonal block of matrix to work on
+
+      smax = Abs( d[m] );
+      Index ll = -1;
+      for( Index l = m-1; l >= 0; --l )
+      {
+        const Scalar abss = Abs( d[l] );
+        const Scalar abse = Abs( e[l] );
+        if( abse <= thresh )
+        {
+          ll = l;
+          break;
+        }
+        smax = Max( smax, Max( abss, abse ) );
+      }
+
+      if( ll >= 0 )
+      {
+        e[ll] = zero;
+
+        // Convergence of bottom singular value, return to top of loop
+        if( ll == m-1 )
+        {
+          --m;
+          continue;
+        }
+      }
+      ++ll;
+
+      // B(ll:m,ll:m) is unreduced
+
+      if( ll == m-1 )
+      {
+        // 2 by 2 block, handle separately
+        Scalar sigmn, sigmx, sinr, cosr, sinl, cosl;
+        Aux_SngVec2( d[m-1], e[m-1], d[m], sigmn, sigmx, sinr, cosr, sinl, cosl );
+        d[m-1] = sigmx;
+        e[m-1] = zero;
+        d[m] = sigmn;
+
+        // Compute singular vectors, if desired
+        if( ncvt > 0 )
+        { Vec_PlnRot< Lyt >( ncvt, Vt_Row(m-1,0), Vt_rs, Vt_Row(m,0), Vt_rs, cosr, sinr ); }
+        if( nru > 0 )
+        { Vec_PlnRot< Lyt >( nru, U_Col(0,m-1), U_cs, U_Col(0,m), U_cs, cosl, sinl ); }
+
+        m -= 2;
+        continue;
+      }
+
+      // If working on new submatrix, choose shift direction
+      // (from larger end diagonal element towards smaller)
+
+      if( ( ll > oldm ) || ( m < oldll ) )
+      { fwd = ( Abs( d[ll] ) >= Abs( d[m] ) ); }
+
+      // Apply convergence tests: first the standard test to the
+      // bottom (top) of the matrix, then the relative one, which
+      // also computes a lower bound sminl of the smallest singular
+      // value.
+
+      Scalar sminl = {};
+      bool split = false;
+
+      if( fwd )
+      {
+        if( Abs( e[m-1] ) <= tol*Abs( d[m] ) )
+        {
+          e[m-1] = zero;
+          continue;
+        }
+
+        Scalar mu = Abs( d[ll] );
+        sminl = mu;
+        for( Index l = ll; l <= m-1; ++l )
+        {
+          if( Abs( e[l] ) <= tol*mu )
+          {
+            e[l] = zero;
+            split = true;
+            break;
+          }
+          mu = Abs( d[l+1] )*( mu/( mu + Abs( e[l] ) ) );
+          sminl = Min( sminl, mu );
+        }
+      }
+      else
+      {
+        if( Abs( e[ll] ) <= tol*Abs( d[ll] ) )
+        {
+          e[ll] = zero;
+          continue;
+        }
+
+        Scalar mu = Abs( d[m] );
+        sminl = mu;
+        for( Index l = m-1; l >= ll; --l )
+        {
+          if( Abs( e[l] ) <= tol*mu )
+          {
+            e[l] = zero;
+            split = true;
+            break;
+          }
+          mu = Abs( d[l] )*( mu/( mu + Abs( e[l] ) ) );
+          sminl = Min( sminl, mu );
+        }
+      }
+
+      if( split ){ continue; }
+
+      oldll = ll;
+      oldm = m;
+
+      // Compute shift. First, test if shifting would ruin relative
+      // accuracy, and if so set the shift to zero.
+
+      Scalar shift = {};
+      if( Scalar( n )*tol*( sminl/smax ) > Max( eps, Scalar( 0.01 )*tol ) )
+      {
+        // Compute the shift from 2 by 2 block at end of matrix
+        Scalar sll, r;
+        if( fwd )
+        {
+          sll = Abs( d[ll] );
+          Aux_Sng2( d[m-1], e[m-1], d[m], shift, r );
+        }
+        else
+        {
+          sll = Abs( d[m] );
+          Aux_Sng2( d[ll], e[ll], d[ll+1], shift, r );
+        }
+
+        // Test if shift negligible, and if so set to zero
+        if( ( sll > zero ) && ( Sqr( shift/sll ) < eps ) )
+        { shift = zero; }
+      }
+
+      // Increment iteration count
+
+      iter += (Size)(m - ll);
+
+      const Size nm = (Size)(m - ll) + 1;
+
+      if( IsZero( shift ) )
+      {
+        // Use zero shift
+        Scalar cs = one, sn = {}, r = {};
+        Scalar oldcs = one, oldsn = {};
+
+        if( fwd )
+        {
+          // Chase bulge from top to bottom
+          for( Index i = ll; i <= m-1; ++i )
+          {
+            Aux_PlnRot2( d[i]*cs, e[i], cs, sn, r );
+            if( i > ll )
+            { e[i-1] = oldsn*r; }
+            Aux_PlnRot2( oldcs*r, d[i+1]*sn, oldcs, oldsn, d[i] );
+            C0[i-ll] = cs;
+            S0[i-ll] = sn;
+            C1[i-ll] = oldcs;
+            S1[i-ll] = oldsn;
+          }
+          const Scalar h = d[m]*cs;
+          d[m] = h*oldcs;
+          e[m-1] = h*oldsn;
+
+          // Update singular vectors
+          if( ncvt > 0 )
+          { Mat_RotSeq< Lyt >( Side::Left, Pivot::Var, Direct::Fwd, nm, ncvt, C0, S0, Vt_Blk(ll,0), Vt_ld ); }
+          if( nru > 0 )
+          { Mat_RotSeq< Lyt >( Side::Right, Pivot::Var, Direct::Fwd, nru, nm, C1, S1, U_Blk(0,ll), U_ld ); }
+
+          // Test convergence
+          if( Abs( e[m-1] ) <= thresh )
+          { e[m-1] = zero; }
+        }
+        else
+        {
+          // Chase bulge from bottom to top
+          for( Index i = m; i >= ll+1; --i )
+          {
+            Aux_PlnRot2( d[i]*cs, e[i-1], cs, sn, r );
+            if( i < m )
+            { e[i] = oldsn*r; }
+            Aux_PlnRot2( oldcs*r, d[i-1]*sn, oldcs, oldsn, d[i] );
+            C0[i-ll-1] = cs;
+            S0[i-ll-1] = -sn;
+            C1[i-ll-1] = oldcs;
+            S1[i-ll-1] = -oldsn;
+          }
+          const Scalar h = d[ll]*cs;
+          d[ll] = h*oldcs;
+          e[ll] = h*oldsn;
+
+          // Update singular vectors
+          if( ncvt > 0 )
+          { Mat_RotSeq< Lyt >( Side::Left, Pivot::Var, Direct::Bwd, nm, ncvt, C1, S1, Vt_Blk(ll,0), Vt_ld ); }
+          if( nru > 0 )
+          { Mat_RotSeq< Lyt >( Side::Right, Pivot::Var, Direct::Bwd, nru, nm, C0, S0, U_Blk(0,ll), U_ld ); }
+
+          // Test convergence
+          if( Abs( e[ll] ) <= thresh )
+          { e[ll] = zero; }
+        }
+      }
+      else
+      {
+        // Use nonzero shift
+        Scalar cosr, sinr, cosl, sinl, r;
+
+        if( fwd )
+        {
+          // Chase bulge from top to bottom
+          Scalar f = ( Abs( d[ll] ) - shift )*( CopySign( one, d[ll] ) + shift/d[ll] );
+          Scalar g = e[ll];
+          for( Index i = ll; i <= m-1; ++i )
+          {
+            Aux_PlnRot2( f, g, cosr, sinr, r );
+            if( i > ll )
+            { e[i-1] = r; }
+            f = cosr*d[i] + sinr*e[i];
+            e[i] = cosr*e[i] - sinr*d[i];
+            g = sinr*d[i+1];
+            d[i+1] = cosr*d[i+1];
+            Aux_PlnRot2( f, g, cosl, sinl, r );
+            d[i] = r;
+            f = cosl*e[i] + sinl*d[i+1];
+            d[i+1] = cosl*d[i+1] - sinl*e[i];
+            if( i < m-1 )
+            {
+              g = sinl*e[i+1];
+              e[i+1] = cosl*e[i+1];
+            }
+            C0[i-ll] = cosr;
+            S0[i-ll] = sinr;
+            C1[i-ll] = cosl;
+            S1[i-ll] = sinl;
+          }
+          e[m-1] = f;
+
+          // Update singular vectors
+          if( ncvt > 0 )
+          { Mat_RotSeq< Lyt >( Side::Left, Pivot::Var, Direct::Fwd, nm, ncvt, C0, S0, Vt_Blk(ll,0), Vt_ld ); }
+          if( nru > 0 )
+          { Mat_RotSeq< Lyt >( Side::Right, Pivot::Var, Direct::Fwd, nru, nm, C1, S1, U_Blk(0,ll), U_ld ); }
+
+          // Test convergence
+          if( Abs( e[m-1] ) <= thresh )
+          { e[m-1] = zero; }
+        }
+        else
+        {
+          // Chase bulge from bottom to top
+          Scalar f = ( Abs( d[m] ) - shift )*( CopySign( one, d[m] ) + shift/d[m] );
+          Scalar g = e[m-1];
+          for( Index i = m; i >= ll+1; --i )
+          {
+            Aux_PlnRot2( f, g, cosr, sinr, r );
+            if( i < m )
+            { e[i] = r; }
+            f = cosr*d[i] + sinr*e[i-1];
+            e[i-1] = cosr*e[i-1] - sinr*d[i];
+            g = sinr*d[i-1];
+            d[i-1] = cosr*d[i-1];
+            Aux_PlnRot2( f, g, cosl, sinl, r );
+            d[i] = r;
+            f = cosl*e[i-1] + sinl*d[i-1];
+            d[i-1] = cosl*d[i-1] - sinl*e[i-1];
+            if( i > ll+1 )
+            {
+              g = sinl*e[i-2];
+              e[i-2] = cosl*e[i-2];
+            }
+            C0[i-ll-1] = cosr;
+            S0[i-ll-1] = -sinr;
+            C1[i-ll-1] = cosl;
+            S1[i-ll-1] = -sinl;
+          }
+          e[ll] = f;
+
+          // Test convergence
+          if( Abs( e[ll] ) <= thresh )
+          { e[ll] = zero; }
+
+          // Update singular vectors
+          if( ncvt > 0 )
+          { Mat_RotSeq< Lyt >( Side::Left, Pivot::Var, Direct::Bwd, nm, ncvt, C1, S1, Vt_Blk(ll,0), Vt_ld ); }
+          if( nru > 0 )
+          { Mat_RotSeq< Lyt >( Side::Right, Pivot::Var, Direct::Bwd, nru, nm, C0, S0, U_Blk(0,ll), U_ld ); }
+        }
+      }
+    }
+
+    // All singular values converged, so make them positive
+
+    for( Index i = 0; i < (Index)n; ++i )
+    {
+      if( d[i] < zero )
+      {
+        d[i] = -d[i];
+
+        // Change sign of singular vectors, if desired
+        if( ncvt > 0 )
+        { Vec_Scale< Lyt >( ncvt, -one, Vt_Row(i,0), Vt_rs ); }
+      }
+    }
+
+    // Sort the singular values into decreasing order (insertion sort on
+    // singular values, but only one transposition per singular vector)
+
+    for( Index i = 0; i+1 < (Index)n; ++i )
+    {
+      // Scan for smallest d[j]
+      const Index last = (Index)n-1-i;
+      Index isub = 0;
+      Scalar smin = d[0];
+      for( Index j = 1; j <= last; ++j )
+      {
+        if( d[j] <= smin )
+        {
+          isub = j;
+          smin = d[j];
+        }
+      }
+
+      if( isub != last )
+      {
+        // Swap singular values and vectors
+        d[isub] = d[last];
+        d[last] = smin;
+        if( ncvt > 0 )
+        { Vec_Swap< Lyt >( ncvt, Vt_Row(isub,0), Vt_rs, Vt_Row(last,0), Vt_rs ); }
+        if( nru > 0 )
+        { Vec_Swap< Lyt >( nru, U_Col(0,isub), U_cs, U_Col(0,last), U_cs ); }
+      }
+    }
+
+    return true;
+  }
+
+  /// <summary>
+  /// Computes the singular values of B only, as above.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Arr_work >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Arr_d> >,
+    Decay< DerefTypeOf<T_Arr_e> >,
+    Decay< DerefTypeOf<T_Arr_work>> >)
+  constexpr bool Solve( Half half, Size n, T_Arr_d d, T_Arr_e e, T_Arr_work work ) const
+  {
+    return this->template Solve< Lyt >( half, n, 0, 0, d, e,
+      (Scalar *)nullptr, 1, (Scalar *)nullptr, 1, work );
+  }
+
+  /// <summary>
+  /// Size of the workspace Solve needs for order n under the
+  /// current configuration.
+  /// </summary>
+  constexpr Size WorkSize( Size n ) const noexcept
+  { return Bid_SVDQR_WorkSize( n ); }
+
+  /// <summary>
+  /// Computes the singular values and vectors of B as above, with the
+  /// workspace taken from arena.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Blk_Vt,
+    typename T_Blk_U >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Arr_d> >,
+    Decay< DerefTypeOf<T_Arr_e> >,
+    Decay< DerefTypeOf<T_Blk_Vt> >,
+    Decay< DerefTypeOf<T_Blk_U> > >)
+  bool Solve( Half half, Size n, Size ncvt, Size nru,
+    T_Arr_d d, T_Arr_e e,
+    T_Blk_Vt Vt_, Stride Vt_ld,
+    T_Blk_U U_, Stride U_ld,
+    Aux_Arena< Scalar > &arena ) const
+  {
+    typename Aux_Arena< Scalar >::Frame frame{ arena };
+    return this->template Solve< Lyt >( half, n, ncvt, nru, d, e,
+      Vt_, Vt_ld, U_, U_ld, arena.Take( this->WorkSize( n ) ) );
+  }
+};
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
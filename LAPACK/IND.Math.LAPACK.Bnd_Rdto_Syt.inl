@@ -0,0 +1,281 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+namespace _n_Impl {
+
+  // Reduces the symmetric band matrix of order n with kd off-diagonals,
+  // whose lower half A( i, j ), i >= j, refers to, to tridiagonal form
+  // by plane rotations, and reports each one to rot( p, c, s ), meaning
+  // that the rows and columns p and p+1 were rotated by [ c s; -s c ].
+  //
+  // A(i,j) is zeroed in the plane (i-1,i), from the outermost diagonal
+  // of column j inwards. Each such rotation puts a single element
+  // outside the band, at A(i+kd,i-1), which the next rotation zeroes
+  // in turn one band width further down, until it leaves the matrix;
+  // so only one such element is ever alive and it is kept in g.
+  template< typename T_Scalar, typename T_Fn_A, typename T_Fn_Rot >
+  constexpr void _Bnd_Rdto_Syt_Rot( Size n, Size kd, T_Fn_A &&A, T_Fn_Rot &&rot )
+  {
+    for( Index j = 0; j+2 < (Index)n; ++j )
+    {
+      for( Index i = Min( j+(Index)kd, (Index)n-1 ); i >= j+2; --i )
+      {
+        // The rotation in the plane (p,p+1) zeroes g, which is
+        // A(p+1,k0) in the band at first and a bulge afterwards.
+        Index k0 = j;
+        Index p = i-1;
+        T_Scalar g = A( i, j );
+        A( i, j ) = T_Scalar{};
+
+        while( ! IsZero( g ) )
+        {
+          const Index q = p+1;
+
+          T_Scalar c, s, r;
+          Aux_PlnRot2( A( p, k0 ), g, c, s, r );
+          A( p, k0 ) = r;
+
+          // Rows p and q, left of the diagonal block
+          for( Index k = k0+1; k < p; ++k )
+          {
+            const T_Scalar x = A( p, k );
+            const T_Scalar y = A( q, k );
+            A( p, k ) = c*x + s*y;
+            A( q, k ) = c*y - s*x;
+          }
+
+          // The diagonal block
+          {
+            const T_Scalar a = A( p, p );
+            const T_Scalar b = A( q, p );
+            const T_Scalar d = A( q, q );
+            const T_Scalar cs = c*s;
+            A( p, p ) = c*c*a + 2*cs*b + s*s*d;
+            A( q, q ) = s*s*a - 2*cs*b + c*c*d;
+            A( q, p ) = ( c*c - s*s )*b + cs*( d - a );
+          }
+
+          // Columns p and q, below the diagonal block
+          const Index k1 = Min( (Index)n-1, p+(Index)kd );
+          for( Index k = q+1; k <= k1; ++k )
+          {
+            const T_Scalar x = A( k, p );
+            const T_Scalar y = A( k, q );
+            A( k, p ) = c*x + s*y;
+            A( k, q ) = c*y - s*x;
+          }
+
+          rot( p, c, s );
+
+          // The bulge A(q+kd,p), if it lands in the matrix
+          if( q+(Index)kd >= (Index)n ){ break; }
+
+          const T_Scalar y = A( q+(Index)kd, q );
+          g = s*y;
+          A( q+(Index)kd, q ) = c*y;
+
+          k0 = p;
+          p = q+(Index)kd-1;
+        }
+      }
+    }
+  }
+
+  // Bnd_Rdto_Syt, reporting the rotations to rot
+  template< typename T_Scalar,
+    typename T_Blk_A,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Fn_Rot >
+  constexpr void _Bnd_Rdto_Syt( Half half,
+    Size n, Size kd, T_Blk_A A_, Stride A_ld,
+    T_Arr_d d, T_Arr_e e, T_Fn_Rot &&rot )
+  {
+    const bool upper = ( Half::Upper == half );
+
+    // A(i,j) of the lower half, i >= j, is Band::MatRef( A_, i, j,
+    // A_ld, 0 ) or Band::MatRef( A_, j, i, A_ld, kd ); both are linear
+    // in i and j.
+    const auto A_00 = upper ? Band::BlkPtr( A_, 0, 0, A_ld, kd ) : A_;
+    const Stride A_is = upper ? Band::BlkLd( A_ld ) : 1;
+    const Stride A_js = upper ? 1 : Band::BlkLd( A_ld );
+
+    auto A = [&]( Index i, Index j ) -> T_Scalar &
+    { return A_00[ i*A_is + j*A_js ]; };
+
+    if( Half::Both == half )
+    { throw BadArgument{ "Bnd_Rdto_Syt", 1 }; }
+    if( A_ld < Band::DenseLd( 0, kd ) )
+    { throw BadArgument{ "Bnd_Rdto_Syt", 5 }; }
+
+    // Quick return if possible
+    if( 0 == n ){ return; }
+
+    if( kd > 1 )
+    { _Bnd_Rdto_Syt_Rot< T_Scalar >( n, Min( kd, n-1 ), A, rot ); }
+
+    for( Index j = 0; j < (Index)n; ++j )
+    { d[j] = A( j, j ); }
+    for( Index j = 0; j+1 < (Index)n; ++j )
+    { e[j] = ( kd > 0 ) ? A( j+1, j ) : T_Scalar{}; }
+  }
+
+}// namespace _n_Impl
+
+/// <summary>
+/// Reduces a real symmetric band matrix A of order n, with kd
+/// off-diagonals, to symmetric tridiagonal form T by an orthogonal
+/// similarity transformation: (~Q)*A*Q = T.
+///
+/// A is in <see cref="Band"/> storage of its half: A(i,j) is in row
+/// kd+i-j of column j for Half::Upper, and in row i-j for
+/// Half::Lower; A_ld is at least kd+1. A is overwritten, with the
+/// band of T in the place of its own. d and e take the n diagonal and
+/// n-1 off-diagonal elements of T, ready for <see cref="Syt_EigQR"/>.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dsbtrd</c>, with <c>vect</c> = 'N'.
+///
+/// This is a sequence of plane rotations, each chasing the element it
+/// makes outside the band down the matrix, so it takes O(n*n*kd)
+/// operations and no memory beyond A.
+/// </remarks>
+template< typename T_Blk_A,
+  typename T_Arr_d,
+  typename T_Arr_e >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+    && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_d>>,
+  Decay<DerefTypeOf<T_Arr_e>> > )
+constexpr void Bnd_Rdto_Syt( Half half,
+  Size n, Size kd, T_Blk_A A_, Stride A_ld,
+  T_Arr_d d, T_Arr_e e )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+  _n_Impl::_Bnd_Rdto_Syt< Scalar >( half, n, kd, A_, A_ld, d, e,
+    []( Index, const Scalar &, const Scalar & ){} );
+}
+
+/// <summary>
+/// Reduces a real symmetric band matrix A to symmetric tridiagonal
+/// form T as the overload above does, and updates the n by n matrix Q
+/// to Q*Z, where (~Z)*A*Z = T. The update of Q is split through the
+/// execution context exec (see <see cref="ExecContext"/>).
+///
+/// With Q the identity on entry, Q is Z on exit, and the eigenvectors
+/// of T taken through it are those of A; with Q the Q of
+/// <see cref="Ort_From_Bnd"/>, Q is that of both stages.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dsbtrd</c>, with <c>vect</c> = 'U'.
+///
+/// The rotations are generated on the caller and buffered, a batch of
+/// about 32*n at a time, and each batch is applied to Q in blocks of
+/// 64 rows, so a block of Q is rotated by the whole batch while it is
+/// in cache. The blocks are independent, and so are the tasks of exec;
+/// this is the O(n*n*n) part of the reduction.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_d,
+  typename T_Arr_e,
+  typename T_Blk_Q,
+  typename T_Exec >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+    && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_d>>,
+  Decay<DerefTypeOf<T_Arr_e>>,
+  Decay<DerefTypeOf<T_Blk_Q>> >
+    && ExecContext< Decay<T_Exec> > )
+constexpr void Bnd_Rdto_Syt( Half half,
+  Size n, Size kd, T_Blk_A A_, Stride A_ld,
+  T_Arr_d d, T_Arr_e e,
+  T_Blk_Q Q_, Stride Q_ld,
+  T_Exec &&exec )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+  if( Q_ld < Lyt::DenseLd( Max( (Size)1, n ), Max( (Size)1, n ) ) )
+  { throw BadArgument{ "Bnd_Rdto_Syt", 9 }; }
+
+  const auto Q_cs = Lyt::ColStride( Q_, Q_ld );
+
+  struct Rot
+  {
+    Index p;
+    Scalar c, s;
+  };
+
+  constexpr Size rowBlk = Exec_SplitMin;
+  const Size batchLen = 32*Max( n, (Size)1 );
+
+  std::vector< Rot > batch;
+  batch.reserve( Min( batchLen, n*Max( kd, (Size)1 ) ) );
+
+  // Q := Q*G for the rotations of the batch, in order, on each block
+  // of rows in turn
+  auto Flush = [&]()
+  {
+    if( batch.empty() ){ return; }
+    BLAS::_n_Impl::_Exec_Split( exec, n, rowBlk, [&]( Index i0, Size len )
+    {
+      for( Index r0 = i0; r0 < i0+(Index)len; r0 += (Index)rowBlk )
+      {
+        const Size rn = Min( rowBlk, (Size)( i0+(Index)len-r0 ) );
+        for( const Rot &g : batch )
+        {
+          Vec_PlnRot< Lyt >( rn, Lyt::ColPtr( Q_, r0, g.p, Q_ld ), Q_cs,
+            Lyt::ColPtr( Q_, r0, g.p+1, Q_ld ), Q_cs, g.c, g.s );
+        }
+      }
+    } );
+    batch.clear();
+  };
+
+  _n_Impl::_Bnd_Rdto_Syt< Scalar >( half, n, kd, A_, A_ld, d, e,
+    [&]( Index p, const Scalar &c, const Scalar &s )
+    {
+      batch.push_back( Rot{ p, c, s } );
+      if( batch.size() >= batchLen ){ Flush(); }
+    } );
+  Flush();
+}
+
+/// <summary>
+/// Reduces a real symmetric band matrix A to symmetric tridiagonal
+/// form T, and updates Q to Q*Z, as the overload above does, on the
+/// calling thread.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dsbtrd</c>, with <c>vect</c> = 'U'.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_d,
+  typename T_Arr_e,
+  typename T_Blk_Q >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+    && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_d>>,
+  Decay<DerefTypeOf<T_Arr_e>>,
+  Decay<DerefTypeOf<T_Blk_Q>> > )
+constexpr void Bnd_Rdto_Syt( Half half,
+  Size n, Size kd, T_Blk_A A_, Stride A_ld,
+  T_Arr_d d, T_Arr_e e,
+  T_Blk_Q Q_, Stride Q_ld )
+{ Bnd_Rdto_Syt< Lyt >( half, n, kd, A_, A_ld, d, e, Q_, Q_ld, Exec_Seq{} ); }
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
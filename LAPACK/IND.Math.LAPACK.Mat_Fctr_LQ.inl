@@ -4,12 +4,43 @@ namespace IND {
 namespace Math {
 namespace LAPACK {
 
+inline constexpr Size Mat_Fctr_LQ_WorkSize( Size m, Size n ) noexcept
+{
+  IND_NOT_USED( n );
+  return m;
+}
+
+inline constexpr Size Mat_Fctr_LQ_Blk_WorkSize( Size m, Size n, Size nb = Mat_Fctr_BlkSize ) noexcept
+{
+  IND_NOT_USED( n );
+  return _n_Impl::_Aux_FctrBlk_WorkSize( m, nb );
+}
+
 /// <summary>
 /// LQ factorization of a real m by n matrix A.
-/// FINISH!
+///
+///    A = ( L 0 ) * Q
+///
+/// where:
+///
+///    Q is a n-by-n orthogonal matrix;
+///    L is a lower-triangular m-by-m matrix;
+///    0 is a m-by-(n-m) zero matrix, if m &lt; n.
 /// </summary>
 /// <remarks>
 /// Based on the LAPACK routine <c>dgelq2</c>
+///
+/// The matrix Q is represented as a product of elementary reflectors
+///
+///     Q = H(k) . . . H(2) H(1), where k = min(m,n).
+///
+///  Each H(i) has the form
+///
+///     H(i) = I - tau * v * v**T
+///
+///  where tau is a real scalar, and v is a real vector with
+///  v(0:i-1) = 0 and v(i) = 1; v(i+1:n-1) is stored on exit in A(i,i+1:n-1),
+///  and tau in TAU(i).
 /// </remarks>
 template< typename Lyt = ColMajor,
   typename T_Blk_A,
@@ -28,14 +59,14 @@ constexpr void Mat_Fctr_LQ(
 {
   using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
 
-  auto A = [&]( auto i, auto j ) -> const auto &
+  auto A = [&]( auto i, auto j ) -> auto &
   { return Lyt::MatRef( A_, i, j, A_ld ); };
   auto A_Blk = [&]( auto i, auto j ) -> auto
   { return Lyt::BlkPtr( A_, i, j, A_ld ); };
   auto A_Row = [&]( auto i, auto j ) -> auto
   { return Lyt::RowPtr( A_, i, j, A_ld ); };
 
-  const Stride A_rs = Lyt::RowStride( A_, A_ld );
+  const auto A_rs = Lyt::RowStride( A_, A_ld );
 
   const Size k = Min( m, n );
 
@@ -43,16 +74,16 @@ constexpr void Mat_Fctr_LQ(
   {
     // Generate elementary reflector H(i) to annihilate A(i,i+1:n-1)
 
-    Rfl_VecGen< Lyt >( n-(i+1)+1, A(i,i),
+    Rfl_VecGen< Lyt >( n-i, A(i,i),
       A_Row( i, Min(i+1,(Index)n-1) ), A_rs, tau[i] );
 
-    if( i < (Index)m )
+    if( i+1 < (Index)m )
     {
       // Apply H(i) to A(i+1:m-1,i:n-1) from the right
 
       const auto Aii = A(i,i);
       A(i,i) = unit<Scalar>;
-      Rfl_MatMul< Lyt >( Side::Right, m-(i+1), n-(i+1)+1,
+      Rfl_MatMul< Lyt >( Side::Right, m-(i+1), n-i,
         A_Row( i, i ), A_rs, tau[i],
         A_Blk( i+1, i ), A_ld, work );
       A(i,i) = Aii;
@@ -60,6 +91,41 @@ constexpr void Mat_Fctr_LQ(
   }
 }
 
+/// <summary>
+/// Blocked LQ factorization of a real m by n matrix A, with the same
+/// result as <see cref="Mat_Fctr_LQ"/>.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dgelqf</c>.
+///
+/// work must hold <see cref="Mat_Fctr_LQ_Blk_WorkSize"/>( m, n, nb ) elements.
+/// If nb &lt; 2 or nb &gt;= min(m,n), this is exactly the unblocked code.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr void Mat_Fctr_LQ_Blk(
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Arr_work work,
+  Size nb = Mat_Fctr_BlkSize )
+{
+  if( ( nb < 2 ) || ( nb >= Min( m, n ) ) )
+  { return Mat_Fctr_LQ< Lyt >( m, n, A_, A_ld, tau, work ); }
+
+  _n_Impl::_Aux_FctrBlk< Lyt >( Direct::Fwd, Store::ByRow,
+    m, n, A_, A_ld, tau, work, nb,
+    [&]( Size pnl_m, Size pnl_n, auto pnl_A, auto pnl_tau, auto pnl_work )
+    { Mat_Fctr_LQ< Lyt >( pnl_m, pnl_n, pnl_A, A_ld, pnl_tau, pnl_work ); } );
+}
+
 }// namespace LAPACK
 }// namespace Math
 }// namespace IND
@@ -4,10 +4,44 @@ namespace IND {
 namespace Math {
 namespace LAPACK {
 
+inline constexpr Size Mat_Fctr_QL_WorkSize( Size m, Size n ) noexcept
+{
+  IND_NOT_USED( m );
+  return n;
+}
+
+inline constexpr Size Mat_Fctr_QL_Blk_WorkSize( Size m, Size n, Size nb = Mat_Fctr_BlkSize ) noexcept
+{
+  IND_NOT_USED( m );
+  return _n_Impl::_Aux_FctrBlk_WorkSize( n, nb );
+}
+
 /// <summary>
 /// QL factorization of a real m by n matrix A.
+///
+///    A = Q * ( 0 ),
+///            ( L )
+///
+/// where:
+///
+///    Q is a m-by-m orthogonal matrix;
+///    L is a lower-triangular n-by-n matrix;
+///    0 is a (m-n)-by-n zero matrix, if m &gt; n.
+/// </summary>
 /// <remarks>
-/// Based on the LAPACK routine <c>dgelq2</c>
+/// Based on the LAPACK routine <c>dgeql2</c>
+///
+/// The matrix Q is represented as a product of elementary reflectors
+///
+///     Q = H(k) . . . H(2) H(1), where k = min(m,n).
+///
+///  Each H(i) has the form
+///
+///     H(i) = I - tau * v * v**T
+///
+///  where tau is a real scalar, and v is a real vector with
+///  v(m-k+i+1:m-1) = 0 and v(m-k+i) = 1; v(0:m-k+i-1) is stored on exit
+///  in A(0:m-k+i-1,n-k+i), and tau in TAU(i).
 /// </remarks>
 template< typename Lyt = ColMajor,
   typename T_Blk_A,
@@ -26,39 +60,71 @@ constexpr void Mat_Fctr_QL(
 {
   using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
 
-  auto A = [&]( auto i, auto j ) -> const auto &
+  auto A = [&]( auto i, auto j ) -> auto &
   { return Lyt::MatRef( A_, i, j, A_ld ); };
-  auto A_Row = [&]( auto i, auto j ) -> auto
-  { return Lyt::RowPtr( A_, i, j, A_ld ); };
   auto A_Col = [&]( auto i, auto j ) -> auto
   { return Lyt::ColPtr( A_, i, j, A_ld ); };
 
-  const Stride A_rs = Lyt::RowStride( A_, A_ld );
-  const Stride A_cs = Lyt::ColStride( A_, A_ld );
+  const auto A_cs = Lyt::ColStride( A_, A_ld );
 
   const Size k = Min( m, n );
 
-  for( Index i = (Index)(k-1); i >= 0; ++i )
+  for( Index i = (Index)k-1; i >= 0; --i )
   {
-    // Generate elementary reflector H(i) to annihilate A(0:(m-k)+(i+1)-1-1,(n-k)+(i+1)-1)
-
-    Rfl_VecGen< Lyt >( n-(i+1)+1, A( (m-k)+i, (n-k)+i ),
-      A_Row( 0, (n-k)+i ), A_rs, tau[i] );
-
-    if( i < (Index)m )
-    {
-      // Apply H(i) to A(0:(m-k)+(i+1)-1-1,(n-k)+(i+1)-1) from the left
-
-      const auto Aii = A( (m-k)+i, (n-k)+i );
-      A( (m-k)+i, (n-k)+i ) = unit<Scalar>;
-      Rfl_MatMul< Lyt >( Side::Left, (m-k)+(i+1), (n-k)-(i+1)-1,
-        A_Col( 0, (n-k)+i ), A_cs, tau[i],
-        A_, A_ld, work );
-      A( (m-k)+i, (n-k)+i ) = Aii;
-    }
+    const Index ii = (Index)(m-k) + i;
+    const Index jj = (Index)(n-k) + i;
+
+    // Generate elementary reflector H(i) to annihilate A(0:ii-1,jj)
+
+    Rfl_VecGen< Lyt >( ii+1, A(ii,jj),
+      A_Col( 0, jj ), A_cs, tau[i] );
+
+    // Apply H(i) to A(0:ii,0:jj-1) from the left
+
+    const auto Aii = A(ii,jj);
+    A(ii,jj) = unit<Scalar>;
+    Rfl_MatMul< Lyt >( Side::Left, ii+1, jj,
+      A_Col( 0, jj ), A_cs, tau[i],
+      A_, A_ld, work );
+    A(ii,jj) = Aii;
   }
 }
 
+/// <summary>
+/// Blocked QL factorization of a real m by n matrix A, with the same
+/// result as <see cref="Mat_Fctr_QL"/>.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dgeqlf</c>.
+///
+/// work must hold <see cref="Mat_Fctr_QL_Blk_WorkSize"/>( m, n, nb ) elements.
+/// If nb &lt; 2 or nb &gt;= min(m,n), this is exactly the unblocked code.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr void Mat_Fctr_QL_Blk(
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Arr_work work,
+  Size nb = Mat_Fctr_BlkSize )
+{
+  if( ( nb < 2 ) || ( nb >= Min( m, n ) ) )
+  { return Mat_Fctr_QL< Lyt >( m, n, A_, A_ld, tau, work ); }
+
+  _n_Impl::_Aux_FctrBlk< Lyt >( Direct::Bwd, Store::ByCol,
+    m, n, A_, A_ld, tau, work, nb,
+    [&]( Size pnl_m, Size pnl_n, auto pnl_A, auto pnl_tau, auto pnl_work )
+    { Mat_Fctr_QL< Lyt >( pnl_m, pnl_n, pnl_A, A_ld, pnl_tau, pnl_work ); } );
+}
+
 }// namespace LAPACK
 }// namespace Math
 }// namespace IND
@@ -4,6 +4,18 @@ namespace IND {
 namespace Math {
 namespace LAPACK {
 
+inline constexpr Size Mat_Fctr_QR_WorkSize( Size m, Size n ) noexcept
+{
+  IND_NOT_USED( m );
+  return n;
+}
+
+inline constexpr Size Mat_Fctr_QR_Blk_WorkSize( Size m, Size n, Size nb = Mat_Fctr_BlkSize ) noexcept
+{
+  IND_NOT_USED( m );
+  return _n_Impl::_Aux_FctrBlk_WorkSize( n, nb );
+}
+
 /// <summary>
 /// QR factorization of a real m by n matrix A.
 /// 
@@ -46,16 +58,19 @@ constexpr void Mat_Fctr_QR(
   T_Arr_tau tau,
   T_Arr_work work )
 {
+  IND_MATH_TRACE_SCOPE( "Mat_Fctr_QR", m, n, 0,
+    BLAS::_n_Impl::_Trace_Flops_QR( m, n ), 2.0*m*n*sizeof( *A_ ) );
+
   using Scalar = Decay< DerefTypeOf< T_Blk_A > >;
 
-  auto A = [&]( auto i, auto j ) -> const auto &
+  auto A = [&]( auto i, auto j ) -> auto &
   { return Lyt::MatRef( A_, i, j, A_ld ); };
   auto A_Blk = [&]( auto i, auto j ) -> auto
   { return Lyt::BlkPtr( A_, i, j, A_ld ); };
   auto A_Col = [&]( auto i, auto j ) -> auto
   { return Lyt::ColPtr( A_, i, j, A_ld ); };
 
-  const Stride A_cs = Lyt::ColStride( A_, A_ld );
+  const auto A_cs = Lyt::ColStride( A_, A_ld );
 
   const Size k = Min( m, n );
 
@@ -80,6 +95,51 @@ constexpr void Mat_Fctr_QR(
   }
 }
 
+/// <summary>
+/// Blocked QR factorization of a real m by n matrix A, with the same
+/// result as <see cref="Mat_Fctr_QR"/>.
+///
+/// Each panel of nb columns is factored with the unblocked code, its
+/// reflectors are accumulated into the compact WY form
+///
+///    H(i) H(i+1) . . . H(i+ib-1) = I - V * T * (~V),
+///
+/// and the trailing columns are updated with one block reflector.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dgeqrf</c>.
+///
+/// work must hold <see cref="Mat_Fctr_QR_Blk_WorkSize"/>( m, n, nb ) elements.
+/// If nb &lt; 2 or nb &gt;= min(m,n), this is exactly the unblocked code.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr void Mat_Fctr_QR_Blk(
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Arr_work work,
+  Size nb = Mat_Fctr_BlkSize )
+{
+  IND_MATH_TRACE_SCOPE( "Mat_Fctr_QR_Blk", m, n, nb,
+    BLAS::_n_Impl::_Trace_Flops_QR( m, n ), 2.0*m*n*sizeof( *A_ ) );
+
+  if( ( nb < 2 ) || ( nb >= Min( m, n ) ) )
+  { return Mat_Fctr_QR< Lyt >( m, n, A_, A_ld, tau, work ); }
+
+  _n_Impl::_Aux_FctrBlk< Lyt >( Direct::Fwd, Store::ByCol,
+    m, n, A_, A_ld, tau, work, nb,
+    [&]( Size pnl_m, Size pnl_n, auto pnl_A, auto pnl_tau, auto pnl_work )
+    { Mat_Fctr_QR< Lyt >( pnl_m, pnl_n, pnl_A, A_ld, pnl_tau, pnl_work ); } );
+}
+
 }// namespace LAPACK
 }// namespace Math
 }// namespace IND
@@ -0,0 +1,628 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Default oversampling of the sketch of <see cref="Mat_Fctr_QRP_Rnd"/>:
+/// the number of its rows beyond the panel width.
+/// </summary>
+inline constexpr Size Mat_Fctr_QRP_Oversample = 8;
+
+inline constexpr Size Mat_Fctr_QRP_WorkSize( Size m, Size n ) noexcept
+{
+  IND_NOT_USED( m );
+  return 3*n;
+}
+
+inline constexpr Size Mat_Fctr_QRP_Blk_WorkSize( Size m, Size n, Size nb = Mat_Fctr_BlkSize ) noexcept
+{
+  IND_NOT_USED( m );
+  return 2*n + nb + Max( n, (Size)1 )*nb;
+}
+
+inline constexpr Size Mat_Fctr_QRP_Rnd_WorkSize( Size m, Size n, Size nb = Mat_Fctr_BlkSize,
+  Size p = Mat_Fctr_QRP_Oversample ) noexcept
+{
+  const Size r = nb+p;
+  return 2*r*n + r*m + 2*n + nb*nb + Max( n, (Size)1 )*nb;
+}
+
+namespace _n_Impl {
+
+  // Index of the largest of x[0:n-1], the first one on ties
+  template< typename T_Arr_x >
+  constexpr Index _Mat_Fctr_QRP_Max( Size n, T_Arr_x x )
+  {
+    Index p = 0;
+    for( Index j = 1; j < (Index)n; ++j )
+    {
+      if( x[j] > x[p] ){ p = j; }
+    }
+    return p;
+  }
+
+  // Steps i = 0:kmax-1 of the QR factorization with column pivoting
+  // of the m by n matrix A, whose rows 0:offset-1 are already
+  // factored, one reflector at a time: the column of largest partial
+  // norm vn1 is swapped into place, its reflector generated and
+  // applied, and the partial norms downdated, those that lost too
+  // much being recomputed. vn1 and vn2 hold the partial norms and
+  // their last exact values on entry. swap( p, i ) is called after
+  // columns p and i are swapped, to carry other data along.
+  //
+  // Based on the LAPACK routine dlaqp2.
+  template< typename Lyt,
+    typename T_Blk_A,
+    typename T_Arr_tau,
+    typename T_Arr_vn,
+    typename T_Arr_work,
+    typename T_Fn_Swap >
+  constexpr void _Mat_Fctr_QRP_Unb(
+    Size m, Size n, Size offset, Size kmax,
+    T_Blk_A A_, Stride A_ld,
+    Index *jpvt,
+    T_Arr_tau tau,
+    T_Arr_vn vn1, T_Arr_vn vn2,
+    T_Arr_work work,
+    T_Fn_Swap &&swap )
+  {
+    using Scalar = Decay< DerefTypeOf< T_Blk_A > >;
+
+    auto A = [&]( auto i, auto j ) -> auto &
+    { return Lyt::MatRef( A_, i, j, A_ld ); };
+    auto A_Blk = [&]( auto i, auto j ) -> auto
+    { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+    auto A_Col = [&]( auto i, auto j ) -> auto
+    { return Lyt::ColPtr( A_, i, j, A_ld ); };
+
+    const auto A_cs = Lyt::ColStride( A_, A_ld );
+
+    const Scalar tol3z = Sqrt( std::numeric_limits< Scalar >::epsilon() );
+    const Scalar zero = {}, one = unit< Scalar >;
+
+    const Size mn = Min( Min( m-offset, n ), kmax );
+
+    for( Index i = 0; i < (Index)mn; ++i )
+    {
+      const Index offpi = (Index)offset + i;
+
+      // Determine ith pivot column and swap if necessary
+      const Index pvt = i + _Mat_Fctr_QRP_Max( n-i, vn1 + i );
+      if( pvt != i )
+      {
+        Vec_Swap< Lyt >( m, A_Col(0,pvt), A_cs, A_Col(0,i), A_cs );
+        Swap( jpvt[pvt], jpvt[i] );
+        vn1[pvt] = vn1[i];
+        vn2[pvt] = vn2[i];
+        swap( pvt, i );
+      }
+
+      // Generate elementary reflector H(i)
+      Rfl_VecGen< Lyt >( m-offpi, A(offpi,i),
+        A_Col( Min(offpi+1,(Index)m-1), i ), A_cs, tau[i] );
+
+      if( i+1 < (Index)n )
+      {
+        // Apply H(i)**T to A(offset+i:m-1,i+1:n-1) from the left
+        const auto Aii = A(offpi,i);
+        A(offpi,i) = one;
+        Rfl_MatMul< Lyt >( Side::Left, m-offpi, n-(i+1),
+          A_Col( offpi, i ), A_cs, tau[i],
+          A_Blk( offpi, i+1 ), A_ld, work );
+        A(offpi,i) = Aii;
+      }
+
+      // Update partial column norms
+      for( Index j = i+1; j < (Index)n; ++j )
+      {
+        if( IsZero( vn1[j] ) ){ continue; }
+
+        const Scalar temp = Max( zero, one - Sqr( Abs( A(offpi,j) )/vn1[j] ) );
+        const Scalar temp2 = temp*Sqr( vn1[j]/vn2[j] );
+        if( temp2 <= tol3z )
+        {
+          vn1[j] = ( offpi+1 < (Index)m )
+                 ? Vec_Norm2< Lyt >( m-(offpi+1), A_Col( offpi+1, j ), A_cs ) : zero;
+          vn2[j] = vn1[j];
+        }
+        else
+        {
+          vn1[j] *= Sqrt( temp );
+        }
+      }
+    }
+  }
+
+  // Factors up to nb columns of the m by n matrix A, whose rows
+  // 0:offset-1 are already factored, with column pivoting as
+  // _Mat_Fctr_QRP_Unb does, but deferring the update of the trailing
+  // matrix: it is A := A - V*(~F), with F = (~A) V T accumulated a
+  // column at a time, and only the pivot row is updated at each
+  // step. The panel ends early when a partial norm needs to be
+  // recomputed, and the number of columns factored is returned.
+  //
+  // Based on the LAPACK routine dlaqps.
+  template< typename Lyt,
+    typename T_Blk_A,
+    typename T_Arr_tau,
+    typename T_Arr_vn,
+    typename T_Arr_auxv,
+    typename T_Blk_F >
+  constexpr Size _Mat_Fctr_QRP_Pnl(
+    Size m, Size n, Size offset, Size nb,
+    T_Blk_A A_, Stride A_ld,
+    Index *jpvt,
+    T_Arr_tau tau,
+    T_Arr_vn vn1, T_Arr_vn vn2,
+    T_Arr_auxv auxv,
+    T_Blk_F F_, Stride F_ld )
+  {
+    using Scalar = Decay< DerefTypeOf< T_Blk_A > >;
+
+    auto A = [&]( auto i, auto j ) -> auto &
+    { return Lyt::MatRef( A_, i, j, A_ld ); };
+    auto A_Blk = [&]( auto i, auto j ) -> auto
+    { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+    auto A_Col = [&]( auto i, auto j ) -> auto
+    { return Lyt::ColPtr( A_, i, j, A_ld ); };
+    auto A_Row = [&]( auto i, auto j ) -> auto
+    { return Lyt::RowPtr( A_, i, j, A_ld ); };
+    auto F = [&]( auto i, auto j ) -> auto &
+    { return Lyt::MatRef( F_, i, j, F_ld ); };
+    auto F_Blk = [&]( auto i, auto j ) -> auto
+    { return Lyt::BlkPtr( F_, i, j, F_ld ); };
+    auto F_Col = [&]( auto i, auto j ) -> auto
+    { return Lyt::ColPtr( F_, i, j, F_ld ); };
+    auto F_Row = [&]( auto i, auto j ) -> auto
+    { return Lyt::RowPtr( F_, i, j, F_ld ); };
+
+    const auto A_cs = Lyt::ColStride( A_, A_ld );
+    const auto A_rs = Lyt::RowStride( A_, A_ld );
+    const auto F_cs = Lyt::ColStride( F_, F_ld );
+    const auto F_rs = Lyt::RowStride( F_, F_ld );
+
+    const Scalar tol3z = Sqrt( std::numeric_limits< Scalar >::epsilon() );
+    const Scalar zero = {}, one = unit< Scalar >;
+
+    const Index lastrk = (Index)Min( m, n+offset );
+    bool recompute = false;
+
+    Index k = 0;
+    for( ; ( k < (Index)nb ) && ! recompute; ++k )
+    {
+      const Index rk = (Index)offset + k;
+
+      // Determine kth pivot column and swap if necessary
+      const Index pvt = k + _Mat_Fctr_QRP_Max( n-k, vn1 + k );
+      if( pvt != k )
+      {
+        Vec_Swap< Lyt >( m, A_Col(0,pvt), A_cs, A_Col(0,k), A_cs );
+        Vec_Swap< Lyt >( k, F_Row(pvt,0), F_rs, F_Row(k,0), F_rs );
+        Swap( jpvt[pvt], jpvt[k] );
+        vn1[pvt] = vn1[k];
+        vn2[pvt] = vn2[k];
+      }
+
+      // Apply previous Householder reflectors to column k:
+      // A(rk:m-1,k) := A(rk:m-1,k) - A(rk:m-1,0:k-1)*(~F(k,0:k-1))
+      if( k > 0 )
+      {
+        Mat_VecMul< Lyt >( Trnsp::No, m-rk, k, -one, A_Blk(rk,0), A_ld,
+          F_Row(k,0), F_rs, one, A_Col(rk,k), A_cs );
+      }
+
+      // Generate elementary reflector H(k)
+      Rfl_VecGen< Lyt >( m-rk, A(rk,k),
+        A_Col( Min(rk+1,(Index)m-1), k ), A_cs, tau[k] );
+
+      const auto Akk = A(rk,k);
+      A(rk,k) = one;
+
+      // Compute kth column of F:
+      // F(k+1:n-1,k) := tau(k)*(~A(rk:m-1,k+1:n-1))*A(rk:m-1,k)
+      if( k+1 < (Index)n )
+      {
+        Mat_VecMul< Lyt >( Trnsp::Yes, m-rk, n-(k+1), tau[k], A_Blk(rk,k+1), A_ld,
+          A_Col(rk,k), A_cs, zero, F_Col(k+1,k), F_cs );
+      }
+
+      // Padding F(0:k,k) with zeros
+      for( Index j = 0; j <= k; ++j ){ F(j,k) = zero; }
+
+      // Incremental updating of F:
+      // F(0:n-1,k) := F(0:n-1,k) - tau(k)*F(0:n-1,0:k-1)*(~A(rk:m-1,0:k-1))*A(rk:m-1,k)
+      if( k > 0 )
+      {
+        Mat_VecMul< Lyt >( Trnsp::Yes, m-rk, k, -tau[k], A_Blk(rk,0), A_ld,
+          A_Col(rk,k), A_cs, zero, auxv, 1 );
+        Mat_VecMul< Lyt >( Trnsp::No, n, k, one, F_, F_ld,
+          auxv, 1, one, F_Col(0,k), F_cs );
+      }
+
+      // Update the current row of A:
+      // A(rk,k+1:n-1) := A(rk,k+1:n-1) - A(rk,0:k)*(~F(k+1:n-1,0:k))
+      if( k+1 < (Index)n )
+      {
+        Mat_VecMul< Lyt >( Trnsp::No, n-(k+1), k+1, -one, F_Blk(k+1,0), F_ld,
+          A_Row(rk,0), A_rs, one, A_Row(rk,k+1), A_rs );
+      }
+
+      // Update partial column norms; the ones that lost too much are
+      // flagged by a negative vn2, and end the panel.
+      if( rk+1 < lastrk )
+      {
+        for( Index j = k+1; j < (Index)n; ++j )
+        {
+          if( IsZero( vn1[j] ) ){ continue; }
+
+          const Scalar temp = Max( zero, one - Sqr( Abs( A(rk,j) )/vn1[j] ) );
+          const Scalar temp2 = temp*Sqr( vn1[j]/vn2[j] );
+          if( temp2 <= tol3z )
+          {
+            vn2[j] = -one;
+            recompute = true;
+          }
+          else
+          {
+            vn1[j] *= Sqrt( temp );
+          }
+        }
+      }
+
+      A(rk,k) = Akk;
+    }
+
+    const Size kb = (Size)k;
+    const Index rk = (Index)( offset+kb );
+
+    // Apply the block reflector to the rest of the matrix:
+    // A(rk:m-1,kb:n-1) := A(rk:m-1,kb:n-1) - A(rk:m-1,0:kb-1)*(~F(kb:n-1,0:kb-1))
+    if( kb < Min( n, m-offset ) )
+    {
+      Mat_MatMul< Lyt >( Trnsp::No, Trnsp::Yes, m-rk, n-kb, kb, -one,
+        A_Blk(rk,0), A_ld, F_Blk(kb,0), F_ld, one, A_Blk(rk,kb), A_ld );
+    }
+
+    // Recomputation of difficult columns
+    if( recompute )
+    {
+      for( Index j = (Index)kb; j < (Index)n; ++j )
+      {
+        if( vn2[j] < zero )
+        {
+          vn1[j] = Vec_Norm2< Lyt >( m-rk, A_Col(rk,j), A_cs );
+          vn2[j] = vn1[j];
+        }
+      }
+    }
+
+    return kb;
+  }
+
+  // Column norms of the m by n matrix A, into vn1 and vn2
+  template< typename Lyt,
+    typename T_Blk_A,
+    typename T_Arr_vn >
+  constexpr void _Mat_Fctr_QRP_Norms( Size m, Size n, T_Blk_A A_, Stride A_ld,
+    T_Arr_vn vn1, T_Arr_vn vn2 )
+  {
+    const auto A_cs = Lyt::ColStride( A_, A_ld );
+    for( Index j = 0; j < (Index)n; ++j )
+    {
+      vn1[j] = Vec_Norm2< Lyt >( m, Lyt::ColPtr( A_, 0, j, A_ld ), A_cs );
+      vn2[j] = vn1[j];
+    }
+  }
+
+}// namespace _n_Impl
+
+/// <summary>
+/// QR factorization with column pivoting of a real m by n matrix A.
+///
+///    A * P = Q * R
+///
+/// where P is a permutation matrix, and Q and R are as in
+/// <see cref="Mat_Fctr_QR"/>. At each step the remaining column of
+/// largest norm is taken, so that the diagonal of R is non-increasing
+/// in magnitude and reveals the numerical rank of A.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dgeqp3</c>, unblocked (<c>dlaqp2</c>).
+///
+/// On exit, jpvt[j] holds the column of A that was taken as column j
+/// of A * P. The partial column norms are downdated, and recomputed
+/// when they have lost too much to cancellation.
+///
+/// work must hold <see cref="Mat_Fctr_QRP_WorkSize"/>( m, n ) elements.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr void Mat_Fctr_QRP(
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  Index *jpvt,
+  T_Arr_tau tau,
+  T_Arr_work work )
+{
+  IND_MATH_TRACE_SCOPE( "Mat_Fctr_QRP", m, n, 0,
+    BLAS::_n_Impl::_Trace_Flops_QR( m, n ), 2.0*m*n*sizeof( *A_ ) );
+
+  for( Index j = 0; j < (Index)n; ++j ){ jpvt[j] = j; }
+
+  const Size k = Min( m, n );
+  if( 0 == k ){ return; }
+
+  const auto vn1 = work;
+  const auto vn2 = work + n;
+
+  _n_Impl::_Mat_Fctr_QRP_Norms< Lyt >( m, n, A_, A_ld, vn1, vn2 );
+  _n_Impl::_Mat_Fctr_QRP_Unb< Lyt >( m, n, 0, k, A_, A_ld, jpvt, tau, vn1, vn2,
+    work + 2*n, []( Index, Index ){} );
+}
+
+/// <summary>
+/// Blocked QR factorization with column pivoting of a real m by n
+/// matrix A, with the same result as <see cref="Mat_Fctr_QRP"/> in
+/// exact arithmetic.
+///
+/// The pivots of a panel of nb columns are chosen as in the unblocked
+/// code, but the update of the trailing matrix is deferred to one
+/// matrix product per panel, A := A - V*(~F); only the pivot row and
+/// the partial norms are updated at each step. A panel ends early
+/// when a partial norm has lost too much to cancellation, as it needs
+/// the updated trailing matrix to be recomputed.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dgeqp3</c>, with <c>dlaqps</c>.
+///
+/// Half of the flops are still in matrix-vector products, with the
+/// trailing matrix, to update F; see <see cref="Mat_Fctr_QRP_Rnd"/>
+/// for a variant with nearly all of them in matrix products.
+///
+/// work must hold <see cref="Mat_Fctr_QRP_Blk_WorkSize"/>( m, n, nb ) elements.
+/// If nb &lt; 2 or nb &gt;= min(m,n), this is exactly the unblocked code.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr void Mat_Fctr_QRP_Blk(
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  Index *jpvt,
+  T_Arr_tau tau,
+  T_Arr_work work,
+  Size nb = Mat_Fctr_BlkSize )
+{
+  IND_MATH_TRACE_SCOPE( "Mat_Fctr_QRP_Blk", m, n, nb,
+    BLAS::_n_Impl::_Trace_Flops_QR( m, n ), 2.0*m*n*sizeof( *A_ ) );
+
+  if( ( nb < 2 ) || ( nb >= Min( m, n ) ) )
+  { return Mat_Fctr_QRP< Lyt >( m, n, A_, A_ld, jpvt, tau, work ); }
+
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+
+  for( Index j = 0; j < (Index)n; ++j ){ jpvt[j] = j; }
+
+  const Size k = Min( m, n );
+
+  const auto vn1 = work;
+  const auto vn2 = work + n;
+  const auto auxv = work + 2*n;
+  const auto F_ = work + 2*n + nb;
+  const Stride F_ld = Lyt::DenseLd( n, nb );
+
+  _n_Impl::_Mat_Fctr_QRP_Norms< Lyt >( m, n, A_, A_ld, vn1, vn2 );
+
+  // Panels while more than nb columns remain, then the unblocked code
+  Size j = 0;
+  while( j+nb < k )
+  {
+    j += _n_Impl::_Mat_Fctr_QRP_Pnl< Lyt >( m, n-j, j, nb,
+      A_Blk(0,j), A_ld, jpvt + j, tau + j, vn1 + j, vn2 + j, auxv, F_, F_ld );
+  }
+
+  _n_Impl::_Mat_Fctr_QRP_Unb< Lyt >( m, n-j, j, k-j,
+    A_Blk(0,j), A_ld, jpvt + j, tau + j, vn1 + j, vn2 + j, F_, []( Index, Index ){} );
+}
+
+/// <summary>
+/// QR factorization with column pivoting of a real m by n matrix A,
+/// A * P = Q * R as in <see cref="Mat_Fctr_QRP"/>, with the pivots of
+/// each panel chosen from a random sketch of A.
+///
+/// The sketch Y = G * A, with G a random (nb+p) by m matrix, has the
+/// column norms and rank structure of A in all but a few directions:
+/// the nb pivots of a panel are chosen by the pivoted factorization
+/// of the small Y, and the panel is then factored, again with
+/// pivoting within it, and applied to the trailing matrix as one
+/// block reflector. Y is downdated to a sketch of the trailing matrix
+/// with a matrix product, Y2 := Y2 - Y1 * (R11^-1 R12), so that
+/// nearly all the flops are in matrix products.
+/// </summary>
+/// <remarks>
+/// Based on HQRRP (Martinsson, Quintana-Orti, Heavner and van de
+/// Geijn, Householder QR factorization with randomization for column
+/// pivoting, 2017).
+///
+/// The pivots are not those of <see cref="Mat_Fctr_QRP"/>, but reveal
+/// the rank as well with high probability; the sketch is drawn from a
+/// fixed seed, so that they are reproducible from run to run. When
+/// R11 is numerically singular, the sketch of the trailing matrix is
+/// drawn anew rather than downdated.
+///
+/// work must hold <see cref="Mat_Fctr_QRP_Rnd_WorkSize"/>( m, n, nb, p ) elements.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr void Mat_Fctr_QRP_Rnd(
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  Index *jpvt,
+  T_Arr_tau tau,
+  T_Arr_work work,
+  Size nb = Mat_Fctr_BlkSize,
+  Size p = Mat_Fctr_QRP_Oversample )
+{
+  IND_MATH_TRACE_SCOPE( "Mat_Fctr_QRP_Rnd", m, n, nb,
+    BLAS::_n_Impl::_Trace_Flops_QR( m, n ), 2.0*m*n*sizeof( *A_ ) );
+
+  using Scalar = Decay< DerefTypeOf< T_Blk_A > >;
+
+  if( 0 == nb ){ throw BadArgument{ "Mat_Fctr_QRP_Rnd", 8 }; }
+
+  for( Index j = 0; j < (Index)n; ++j ){ jpvt[j] = j; }
+
+  const Size k = Min( m, n );
+  if( 0 == k ){ return; }
+
+  auto A = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( A_, i, j, A_ld ); };
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+  auto A_Col = [&]( auto i, auto j ) -> auto
+  { return Lyt::ColPtr( A_, i, j, A_ld ); };
+
+  const auto A_cs = Lyt::ColStride( A_, A_ld );
+
+  const Scalar eps = std::numeric_limits< Scalar >::epsilon();
+  const Scalar one = unit< Scalar >;
+
+  // The sketch Y and its copy Yc, r by n; G, r by m; the partial
+  // norms; T and the Rfl_BlkMul workspace, which also holds R11^-1 R12
+  const Size r = nb+p;
+  const auto Y_ = work;
+  const auto Yc_ = Y_ + r*n;
+  const auto G_ = Yc_ + r*n;
+  const auto vn1 = G_ + r*m;
+  const auto vn2 = vn1 + n;
+  const auto T_ = vn2 + n;
+  const auto W_ = T_ + nb*nb;
+
+  const Stride Y_ld = Lyt::DenseLd( r, n );
+  const Stride G_ld = Lyt::DenseLd( r, m );
+  const Stride T_ld = Lyt::DenseLd( nb, nb );
+  const Stride W_ld = Lyt::DenseLd( Max( n, (Size)1 ), nb );
+  const Stride R_ld = Lyt::DenseLd( nb, n );
+
+  auto Y_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( Y_, i, j, Y_ld ); };
+  auto Y_Col = [&]( auto i, auto j ) -> auto
+  { return Lyt::ColPtr( Y_, i, j, Y_ld ); };
+
+  const auto Y_cs = Lyt::ColStride( Y_, Y_ld );
+
+  // Uniform entries in [-1,1), reproducible from run to run
+  std::uint32_t seed = 0x2545F491u;
+  auto Rand = [&]() -> Scalar
+  {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return (Scalar)(std::int32_t)seed/(Scalar)2147483648.0;
+  };
+
+  // Y(:,j:n-1) := G * A(j:m-1,j:n-1), with G drawn anew
+  auto Sketch = [&]( Size j )
+  {
+    for( Index c = 0; c < (Index)( m-j ); ++c )
+    {
+      for( Index i = 0; i < (Index)r; ++i ){ Lyt::MatRef( G_, i, c, G_ld ) = Rand(); }
+    }
+    Mat_Fill< Lyt >( Half::Both, r, n-j, Scalar{}, Scalar{}, Y_Blk(0,j), Y_ld );
+    Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, r, n-j, m-j, one,
+      G_, G_ld, A_Blk(j,j), A_ld, one, Y_Blk(0,j), Y_ld );
+  };
+
+  // Swaps columns a and b of the sketch along with those of A
+  auto SwapY = [&]( Index a, Index b )
+  { Vec_Swap< Lyt >( r, Y_Col(0,a), Y_cs, Y_Col(0,b), Y_cs ); };
+
+  Sketch( 0 );
+
+  for( Size j = 0; j < k; )
+  {
+    const Size b = Min( nb, k-j );
+    const Size nr = n-j;
+
+    // Choose the b pivots from the pivoted factorization of a copy
+    // of the sketch, and move them and their sketch into place
+    Mat_Copy< Lyt, Lyt >( r, nr, Y_Blk(0,j), Y_ld, Yc_, Y_ld );
+    _n_Impl::_Mat_Fctr_QRP_Norms< Lyt >( r, nr, Yc_, Y_ld, vn1, vn2 );
+    _n_Impl::_Mat_Fctr_QRP_Unb< Lyt >( r, nr, 0, b, Yc_, Y_ld, jpvt + j, tau + j,
+      vn1, vn2, W_, [&]( Index a, Index c )
+      {
+        Vec_Swap< Lyt >( m, A_Col(0,j+a), A_cs, A_Col(0,j+c), A_cs );
+        SwapY( (Index)j+a, (Index)j+c );
+      } );
+
+    // Factor the panel, pivoting within it
+    _n_Impl::_Mat_Fctr_QRP_Norms< Lyt >( m-j, b, A_Blk(j,j), A_ld, vn1, vn2 );
+    _n_Impl::_Mat_Fctr_QRP_Unb< Lyt >( m, b, j, b, A_Blk(0,j), A_ld, jpvt + j, tau + j,
+      vn1, vn2, W_, [&]( Index a, Index c ){ SwapY( (Index)j+a, (Index)j+c ); } );
+
+    const Size j1 = j+b;
+    if( j1 >= n ){ break; }
+
+    // A(j:m-1,j1:n-1) := ~(I - V*T*(~V)) * A(j:m-1,j1:n-1)
+    Rfl_BlkGen< Lyt >( Direct::Fwd, Store::ByCol, m-j, b, A_Blk(j,j), A_ld, tau + j, T_, T_ld );
+    Rfl_BlkMul< Lyt >( Side::Left, Trnsp::Yes, Direct::Fwd, Store::ByCol,
+      m-j, n-j1, b, A_Blk(j,j), A_ld, T_, T_ld, A_Blk(j,j1), A_ld, W_, W_ld );
+
+    if( j1 >= k ){ break; }
+
+    // Y(:,j1:n-1) := Y(:,j1:n-1) - Y(:,j:j1-1) * (R11^-1 R12), unless
+    // R11 is numerically singular
+    Scalar rmax = {}, rmin = Abs( A(j,j) );
+    for( Index i = (Index)j; i < (Index)j1; ++i )
+    {
+      rmax = Max( rmax, Abs( A(i,i) ) );
+      rmin = Min( rmin, Abs( A(i,i) ) );
+    }
+
+    if( rmin > eps*(Scalar)Max( m, n )*rmax )
+    {
+      Mat_Copy< Lyt, Lyt >( b, n-j1, A_Blk(j,j1), A_ld, W_, R_ld );
+      Tri_Solv_Mat< Lyt >( Side::Left, Half::Upper, Trnsp::No, Diag::NotUnit,
+        b, n-j1, one, A_Blk(j,j), A_ld, W_, R_ld );
+      Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, r, n-j1, b, -one,
+        Y_Blk(0,j), Y_ld, W_, R_ld, one, Y_Blk(0,j1), Y_ld );
+    }
+    else
+    {
+      Sketch( j1 );
+    }
+
+    j = j1;
+  }
+}
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
@@ -0,0 +1,122 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Calculates the size of the host workspace required for
+/// <see cref="Mat_Fctr_QR_Dev"/>: an m by nb panel and its nb by nb
+/// triangular factor.
+/// </summary>
+inline constexpr Size Mat_Fctr_QR_Dev_WorkSize( Size m, Size nb = Mat_Fctr_Dev_PnlSize ) noexcept
+{ return m*nb + nb*nb + nb; }
+
+/// <summary>
+/// Computes a QR factorization of a real m by n matrix A in the memory
+/// of a device (see <see cref="Device"/>), with the same result as
+/// <see cref="Mat_Fctr_QR"/>; tau is on the host.
+///
+/// The panels of nb columns are factored on the host, with the
+/// triangular factor T of their block reflector, and the rest of A is
+/// updated on the device by <see cref="Rfl_BlkMul"/>, with one
+/// look-ahead as in <see cref="Mat_Fctr_LU_Dev"/>: the next panel is
+/// updated first and downloaded, so that the host factors it while the
+/// device updates the columns past it.
+/// </summary>
+/// <remarks>
+/// Based on the MAGMA routine <c>dgeqrf_gpu</c>, over
+/// <c>dgeqrf</c>.
+///
+/// work must hold <see cref="Mat_Fctr_QR_Dev_WorkSize"/>( m, nb ) elements.
+/// </remarks>
+template< typename T_Device,
+  typename T_Arr_tau >
+requires( Device< T_Device >
+  && ! isComplex< typename T_Device::Scalar >
+  && areTheSame< typename T_Device::Scalar, Decay<DerefTypeOf<T_Arr_tau>> > )
+void Mat_Fctr_QR_Dev(
+  Size m, Size n,
+  Dev_Ptr< T_Device > A_, Stride A_ld,
+  T_Arr_tau tau,
+  typename T_Device::Scalar *work,
+  Size nb = Mat_Fctr_Dev_PnlSize )
+{
+  using Scalar = typename T_Device::Scalar;
+
+  const Size k = Min( m, n );
+
+  IND_MATH_TRACE_SCOPE( "Mat_Fctr_QR_Dev", m, n, nb,
+    BLAS::_n_Impl::_Trace_Flops_QR( m, n ), 2.0*m*n*sizeof( Scalar ) );
+
+  if( 0 == nb ){ throw BadArgument{ "Mat_Fctr_QR_Dev", 7 }; }
+
+  if( 0 == k ){ return; }
+
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return ColMajor::BlkPtr( A_, i, j, A_ld ); };
+
+  T_Device &device = *A_.device;
+
+  // The panel on the host, rows j:m-1 of columns j:j+w-1, and T
+  Scalar *P_ = work;
+  const Stride P_ld = (Stride)m;
+  Scalar *T_ = work + m*nb;
+  const Stride T_ld = (Stride)nb;
+  Scalar *pnl_work = T_ + nb*nb;
+
+  // T and the work block of Rfl_BlkMul on the device
+  const Dev_Buffer< T_Device > T_dev{ device, nb*nb };
+  const Dev_Buffer< T_Device > W_dev{ device, nb*n };
+
+  auto Fctr = [&]( Size j, Size w )
+  {
+    Mat_Fctr_QR< ColMajor >( m-j, w, P_, P_ld, tau + j, pnl_work );
+    Rfl_BlkGen< ColMajor >( Direct::Fwd, Store::ByCol, m-j, w, P_, P_ld, tau + j, T_, T_ld );
+  };
+
+  Mat_Copy< ColMajor, ColMajor >( m, Min( k, nb ), A_, A_ld, P_, P_ld );
+  Fctr( 0, Min( k, nb ) );
+
+  for( Size j = 0; j < k; j += nb )
+  {
+    const Size w = Min( k-j, nb );
+    const Size j1 = j+w;
+
+    Mat_Copy< ColMajor, ColMajor >( m-j, w, P_, P_ld, A_Blk(j,j), A_ld );
+    if( j1 >= n ){ continue; }
+    Mat_Copy< ColMajor, ColMajor >( w, w, T_, T_ld, T_dev.Ptr(), T_ld );
+
+    // (~H)*A(j:m-1,c:c+nc-1), on the columns of the next panel first
+    auto Updt = [&]( Size c, Size nc )
+    {
+      Rfl_BlkMul< ColMajor >( Side::Left, Trnsp::Yes, Direct::Fwd, Store::ByCol,
+        m-j, nc, w,
+        A_Blk(j,j), A_ld,
+        T_dev.Ptr(), T_ld,
+        A_Blk(j,c), A_ld,
+        W_dev.Ptr(), T_ld );
+    };
+
+    const Size w1 = ( j1 < k ) ? Min( k-j1, nb ) : 0;
+
+    Updt( j1, ( w1 > 0 ) ? w1 : n-j1 );
+
+    if( w1 > 0 )
+    {
+      Mat_Copy< ColMajor, ColMajor >( m-j1, w1, A_Blk(j1,j1), A_ld, P_, P_ld );
+      if( j1+w1 < n ){ Updt( j1+w1, n-j1-w1 ); }
+      Fctr( j1, w1 );
+    }
+  }
+
+  device.Sync();
+}
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
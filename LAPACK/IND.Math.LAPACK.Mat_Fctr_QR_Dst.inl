@@ -0,0 +1,270 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Mat_Fctr_QR_Dst"/> on the calling process: two panels of
+/// its local rows with their triangular factors, and its part of a
+/// block row.
+/// </summary>
+template< typename T_Grid, typename T_Scalar >
+Size Mat_Fctr_QR_Dst_WorkSize( const Dst_Matrix< T_Grid, T_Scalar > &A ) noexcept
+{
+  const Size mr = A.LocRows(), nc = A.LocCols(), nb = A.nb;
+  return 2*( mr*nb + nb*nb + nb ) + nb*Max( nc, nb ) + 3*A.grid->Rows();
+}
+
+namespace _n_Impl {
+
+  // Factors columns j:j+jb-1 of A in place, on the processes of their
+  // process column, as Mat_Fctr_QR does with one column at a time:
+  // the norm of each column and its product with the rest of the panel
+  // are summed over the process column.
+  template< typename T_Grid, typename T_Scalar >
+  void _Mat_Fctr_QR_Dst_Pnl( const Dst_Matrix< T_Grid, T_Scalar > &A,
+    Size j, Size jb, T_Scalar *tau, T_Scalar *w, T_Scalar *ssq )
+  {
+    T_Grid &grid = *A.grid;
+    const Size P = grid.Rows(), nb = A.nb;
+    const Index p = grid.Row();
+    const Size mr = A.LocRows();
+    const Size lj = (Size)Dst_LocIdx( (Index)j, nb, grid.Cols() );
+
+    auto A_Blk = [&]( Size li, Size lj ) -> T_Scalar *
+    { return ColMajor::BlkPtr( A.loc, li, lj, A.ld ); };
+
+    const T_Scalar one = unit< T_Scalar >;
+    const T_Scalar safmin = minValue< T_Scalar >;
+
+    for( Size c = 0; c < jb; ++c )
+    {
+      const Index jj = (Index)( j+c );
+      const Size lc = lj+c;
+      const Index p_jj = Dst_Owner( jj, nb, P );
+      const Size r0 = Dst_LocSize( (Size)jj, nb, p, P );
+      const Size r1 = Dst_LocSize( (Size)jj+1, nb, p, P );
+      T_Scalar *A_jj = ( p == p_jj ) ? A_Blk( r0, lc ) : nullptr;
+
+      // Generate elementary reflector H(jj) to annihilate A(jj+1:m-1,jj),
+      // as Rfl_VecGen, with the norm of the column summed in parts
+      T_Scalar part[3] = { T_Scalar{}, T_Scalar{}, ( p == p_jj ) ? *A_jj : T_Scalar{} };
+      Vec_SmSqr< ColMajor >( mr-r1, A_Blk( r1, lc ), 1, part[0], part[1] );
+      grid.AllGather( Dst_Scope::Col, part, 3, ssq );
+
+      T_Scalar sum[2] = {};
+      T_Scalar alpha = ssq[3*p_jj+2];
+      for( Size i = 0; i < P; ++i )
+      {
+        T_Scalar other[2] = { ssq[3*i], ssq[3*i+1] };
+        Aux_CombSsq2( sum, other );
+      }
+      T_Scalar xnorm = sum[0]*Sqrt( sum[1] );
+
+      T_Scalar &tau_jj = tau[c];
+      T_Scalar beta = alpha;
+      if( ( jj+1 >= (Index)A.m ) || IsZero( xnorm ) )
+      { tau_jj = {}; }
+      else
+      {
+        beta = -CopySign( Hypot( alpha, xnorm ), alpha );
+        T_Scalar scale = one;
+        Index knt = 0;
+        while( ( Abs( beta ) < safmin ) && ( knt < 20 ) )
+        {
+          ++knt;
+          const T_Scalar rsafmn = Inv( safmin );
+          scale *= rsafmn;
+          beta *= rsafmn;
+          alpha *= rsafmn;
+          xnorm *= rsafmn;
+        }
+        if( knt > 0 ){ beta = -CopySign( Hypot( alpha, xnorm ), alpha ); }
+
+        tau_jj = ( beta - alpha )/beta;
+        Vec_Scale< ColMajor >( mr-r1, scale*Inv( alpha - beta ), A_Blk( r1, lc ), 1 );
+
+        for( Index i = 0; i < knt; ++i ){ beta *= safmin; }
+      }
+
+      // Apply H(jj) to A(jj:m-1,jj+1:j+jb-1) from the left
+      const Size nr = jb-c-1;
+      if( ( nr > 0 ) && !IsZero( tau_jj ) )
+      {
+        if( p == p_jj ){ *A_jj = one; }
+        std::fill( w, w + nr, T_Scalar{} );
+        Mat_VecMul< ColMajor >( Trnsp::Yes, mr-r0, nr, one, A_Blk( r0, lc+1 ), A.ld,
+          A_Blk( r0, lc ), 1, one, w, 1 );
+        grid.Sum( Dst_Scope::Col, w, nr );
+        Mat_Rank1Upd< ColMajor >( mr-r0, nr, -tau_jj, A_Blk( r0, lc ), 1, w, 1, A_Blk( r0, lc+1 ), A.ld );
+      }
+      if( p == p_jj ){ *A_jj = beta; }
+    }
+  }
+
+}// namespace _n_Impl
+
+/// <summary>
+/// Computes a QR factorization of a real m by n matrix A laid out 2-D
+/// block-cyclically on a grid of processes (see
+/// <see cref="Dst_Matrix"/>), with the same result as
+/// <see cref="Mat_Fctr_QR"/>. Every process of the grid calls it, with
+/// its own A, and gets all of tau.
+///
+/// Each panel of nb columns is factored by its process column, which
+/// also forms the triangular factor T of its block reflector, and is
+/// broadcast along the process rows with it; each process then applies
+/// the block reflector to its local part of the trailing matrix, the
+/// products with the panel summed over the process column. With one
+/// panel of look-ahead as in <see cref="Mat_Fctr_LU_Dst"/>, the process
+/// column of the next panel updates and factors it first, and starts
+/// its broadcast before the rest of its update.
+/// </summary>
+/// <remarks>
+/// Based on the ScaLAPACK routine <c>pdgeqrf</c>.
+///
+/// tau must hold Min( m, n ) elements; work must hold
+/// <see cref="Mat_Fctr_QR_Dst_WorkSize"/>( A ) elements.
+/// </remarks>
+template< typename T_Grid, typename T_Scalar >
+requires( ! isComplex< T_Scalar > )
+void Mat_Fctr_QR_Dst(
+  const Dst_Matrix< T_Grid, T_Scalar > &A,
+  T_Scalar *tau,
+  T_Scalar *work )
+{
+  const Size m = A.m, n = A.n, nb = A.nb;
+  const Size k = Min( m, n );
+
+  IND_MATH_TRACE_SCOPE( "Mat_Fctr_QR_Dst", m, n, nb,
+    BLAS::_n_Impl::_Trace_Flops_QR( m, n ), 2.0*A.LocRows()*A.LocCols()*sizeof( T_Scalar ) );
+
+  if( 0 == nb ){ throw BadArgument{ "Mat_Fctr_QR_Dst", 1 }; }
+
+  if( 0 == k ){ return; }
+
+  T_Grid &grid = *A.grid;
+  const Size P = grid.Rows(), Q = grid.Cols();
+  const Index p = grid.Row(), q = grid.Col();
+  const Size mr = A.LocRows(), nc = A.LocCols();
+
+  const T_Scalar one = unit< T_Scalar >;
+
+  auto RowStart = [&]( Size i ) -> Size { return Dst_LocSize( i, nb, p, P ); };
+  auto ColStart = [&]( Size j ) -> Size { return Dst_LocSize( j, nb, q, Q ); };
+  auto A_Blk = [&]( Size li, Size lj ) -> T_Scalar *
+  { return ColMajor::BlkPtr( A.loc, li, lj, A.ld ); };
+
+  // Two panels, each V, then T, then tau, sent together; W; the parts
+  // of the column norms
+  const Size pnl = mr*nb + nb*nb + nb;
+  T_Scalar *V_[2] = { work, work + pnl };
+  T_Scalar *W_ = work + 2*pnl;
+  T_Scalar *ssq = W_ + nb*Max( nc, nb );
+
+  typename T_Grid::Request requests[2];
+
+  // Factors panel j on its process column, with V made explicit (unit
+  // diagonal, zeros above it) from rows RowStart( j ):mr-1, and T from
+  // the sum over the process column of (~V)*V; then starts their
+  // broadcast along the process rows
+  auto Fctr = [&]( Size j, Size jb, Size s )
+  {
+    const Index q_j = Dst_Owner( (Index)j, nb, Q );
+    const Size r0 = RowStart( j ), V_ld = mr-r0;
+    T_Scalar *V = V_[s];
+    T_Scalar *T = V + V_ld*jb;
+    T_Scalar *tau_s = T + jb*jb;
+    if( q == q_j )
+    {
+      _n_Impl::_Mat_Fctr_QR_Dst_Pnl( A, j, jb, tau_s, W_, ssq );
+
+      Mat_Copy< ColMajor, ColMajor >( V_ld, jb, A_Blk( r0, ColStart( j ) ), A.ld, V, (Stride)V_ld );
+      if( p == Dst_Owner( (Index)j, nb, P ) )
+      {
+        for( Size c = 0; c < jb; ++c )
+        {
+          for( Size i = 0; i < c; ++i ){ ColMajor::MatRef( V, i, c, V_ld ) = T_Scalar{}; }
+          ColMajor::MatRef( V, c, c, V_ld ) = one;
+        }
+      }
+
+      std::fill( T, T + jb*jb, T_Scalar{} );
+      Mat_MatMul< ColMajor >( Trnsp::Yes, Trnsp::No, jb, jb, V_ld, one,
+        V, (Stride)V_ld, V, (Stride)V_ld, one, T, (Stride)jb );
+      grid.Sum( Dst_Scope::Col, T, jb*jb );
+
+      // T(0:c-1,c) := -tau(c) * T(0:c-1,0:c-1) * (~V(:,0:c-1))*V(:,c)
+      for( Size c = 0; c < jb; ++c )
+      {
+        T_Scalar *T_c = T + c*jb;
+        for( Size i = 0; i < c; ++i ){ T_c[i] *= -tau_s[c]; }
+        Tri_VecMul< ColMajor >( Half::Upper, Trnsp::No, Diag::NotUnit, c, T, (Stride)jb, T_c, 1 );
+        T_c[c] = tau_s[c];
+        for( Size i = c+1; i < jb; ++i ){ T_c[i] = T_Scalar{}; }
+      }
+    }
+    requests[s] = grid.IBcast( Dst_Scope::Row, q_j, V, V_ld*jb + jb*jb + jb );
+  };
+
+  Fctr( 0, Min( k, nb ), 0 );
+
+  for( Size j = 0, s = 0; j < k; j += nb, s = 1-s )
+  {
+    const Size jb = Min( k-j, nb );
+    const Size j1 = j+jb;
+
+    grid.Wait( requests[s] );
+
+    const Size r0 = RowStart( j ), V_ld = mr-r0;
+    const T_Scalar *V = V_[s];
+    const T_Scalar *T = V + V_ld*jb;
+    std::copy( T + jb*jb, T + jb*jb + jb, tau + j );
+
+    if( j1 >= n ){ continue; }
+
+    // A(j:m-1,c:c+ncl-1) := (~H)*A(j:m-1,c:c+ncl-1) on local columns
+    const Size c0 = ColStart( j1 );
+    const Size ncr = nc-c0;
+    auto Updt = [&]( Size c, Size ncl )
+    {
+      std::fill( W_, W_ + jb*ncl, T_Scalar{} );
+      Mat_MatMul< ColMajor >( Trnsp::Yes, Trnsp::No, jb, ncl, V_ld, one,
+        V, (Stride)V_ld, A_Blk( r0, c ), A.ld, one, W_, (Stride)jb );
+      grid.Sum( Dst_Scope::Col, W_, jb*ncl );
+      Tri_MatMul< ColMajor >( Side::Left, Half::Upper, Trnsp::Yes, Diag::NotUnit,
+        jb, ncl, one, T, (Stride)jb, W_, (Stride)jb );
+      Mat_MatMul< ColMajor >( Trnsp::No, Trnsp::No, V_ld, ncl, jb, -one,
+        V, (Stride)V_ld, W_, (Stride)jb, one, A_Blk( r0, c ), A.ld );
+    };
+
+    if( j1 >= k )
+    {
+      Updt( c0, ncr );
+      continue;
+    }
+
+    const Size w1 = Min( k-j1, nb );
+    if( q == Dst_Owner( (Index)j1, nb, Q ) )
+    {
+      Updt( c0, w1 );
+      Fctr( j1, w1, 1-s );
+      Updt( c0+w1, ncr-w1 );
+    }
+    else
+    {
+      Fctr( j1, w1, 1-s );
+      Updt( c0, ncr );
+    }
+  }
+}
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
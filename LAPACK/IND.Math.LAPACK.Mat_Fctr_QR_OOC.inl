@@ -0,0 +1,126 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Mat_Fctr_QR_OOC"/>: four m by nb panels, the T factors
+/// of the panels, and the workspace of the in core code.
+/// </summary>
+inline constexpr Size Mat_Fctr_QR_OOC_WorkSize( Size m, Size n,
+  Size nb = Mat_Fctr_OOC_PnlSize, Size nbInner = Mat_Fctr_BlkSize ) noexcept
+{
+  const Size pnls = ( Min( m, n ) + nb-1 )/Max( nb, (Size)1 );
+  return 4*m*nb + ( pnls+1 )*nb*nb + Mat_Fctr_QR_Blk_WorkSize( m, nb, nbInner );
+}
+
+/// <summary>
+/// QR factorization of a real m by n matrix A kept out of core in
+/// store (see <see cref="PanelStore"/>), with the same result as
+/// <see cref="Mat_Fctr_QR"/>: R on and above the diagonal, the
+/// reflectors below it, their scalars in tau.
+///
+/// This is the left-looking variant: the panels of nb columns are
+/// factored in turn, each first updated from the left by the block
+/// reflectors of the panels before it, streamed through memory one at
+/// a time. Only the panel being factored, the panel of reflectors
+/// being applied, and the next ones of each are resident, the next
+/// ones read on another thread while the current ones are used. A
+/// panel is factored in core by <see cref="Mat_Fctr_QR_Blk"/> with
+/// nbInner, and written back once; the T factor of its block
+/// reflector is kept in work.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dgeqrf</c>, reorganized as in the
+/// out-of-core ScaLAPACK codes of D'Azevedo and Dongarra.
+///
+/// Reads about n*n/(2*nb) columns of A in all, against n for an in
+/// core factorization; nb trades memory for traffic.
+///
+/// work must hold <see cref="Mat_Fctr_QR_OOC_WorkSize"/>( m, n, nb, nbInner ) elements.
+/// </remarks>
+template< typename T_Store,
+  typename T_Arr_tau >
+requires( PanelStore< T_Store >
+  && ! isComplex< typename T_Store::Scalar >
+  && areTheSame< typename T_Store::Scalar, Decay<DerefTypeOf<T_Arr_tau>> > )
+void Mat_Fctr_QR_OOC(
+  T_Store &store,
+  T_Arr_tau tau,
+  typename T_Store::Scalar *work,
+  Size nb = Mat_Fctr_OOC_PnlSize,
+  Size nbInner = Mat_Fctr_BlkSize )
+{
+  using Scalar = typename T_Store::Scalar;
+
+  const Size m = store.Rows();
+  const Size n = store.Cols();
+  const Size k = Min( m, n );
+
+  IND_MATH_TRACE_SCOPE( "Mat_Fctr_QR_OOC", m, n, nb,
+    BLAS::_n_Impl::_Trace_Flops_QR( m, n ), 2.0*m*n*sizeof( Scalar ) );
+
+  if( 0 == nb ){ throw BadArgument{ "Mat_Fctr_QR_OOC", 4 }; }
+
+  if( 0 == k ){ return; }
+
+  const Stride ld = (Stride)m;
+  const Stride T_ld = (Stride)nb;
+
+  // The panel being factored, the next one, and two for the
+  // reflectors; then the Rfl_BlkMul workspace, the T factors, and
+  // the workspace of the panel factorization
+  Scalar *P_ = work;
+  Scalar *N_ = work + m*nb;
+  Scalar *V0_ = work + 2*m*nb;
+  Scalar *V1_ = work + 3*m*nb;
+  Scalar *W_ = work + 4*m*nb;
+  Scalar *T_ = W_ + nb*nb;
+  Scalar *pnl_work = T_ + ( k + nb-1 )/nb*nb*nb;
+
+  auto ahead = BLAS::_n_Impl::_Pnl_Fetch( store, 0, Min( n, nb ), P_ );
+
+  for( Size j = 0; j < n; j += nb )
+  {
+    const Size w = Min( n-j, nb );
+
+    // Later columns are not touched before their turn, so the next
+    // panel can be read while this one is factored
+    ahead.get();
+    if( j+nb < n )
+    { ahead = BLAS::_n_Impl::_Pnl_Fetch( store, j+nb, Min( n-j-nb, nb ), N_ ); }
+
+    // Apply ~H of each panel to the left
+    BLAS::_n_Impl::_Pnl_Sweep( store, Min( j, k ), nb, V0_, V1_, [&]( Size c, Size wc, Scalar *V_ )
+    {
+      Rfl_BlkMul< ColMajor >( Side::Left, Trnsp::Yes, Direct::Fwd, Store::ByCol,
+        m-c, w, wc,
+        V_ + c, ld,
+        T_ + (c/nb)*nb*nb, T_ld,
+        P_ + c, ld,
+        W_, (Stride)w );
+    } );
+
+    if( j < k )
+    {
+      Mat_Fctr_QR_Blk< ColMajor >( m-j, w, P_ + j, ld, tau + j, pnl_work, nbInner );
+
+      Rfl_BlkGen< ColMajor >( Direct::Fwd, Store::ByCol,
+        m-j, Min( w, m-j ), P_ + j, ld, tau + j,
+        T_ + (j/nb)*nb*nb, T_ld );
+    }
+
+    store.Write( (Index)j, w, P_, ld );
+    std::swap( P_, N_ );
+  }
+}
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
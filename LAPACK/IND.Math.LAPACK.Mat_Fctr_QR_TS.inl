@@ -0,0 +1,593 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Tuning parameters for <see cref="Mat_Fctr_QR_TS"/>,
+/// <see cref="Ort_MatMul_QR_TS"/> and <see cref="Ort_From_QR_TS"/>.
+/// The same config must be used for the factorization and for
+/// every application of its Q.
+/// </summary>
+struct Mat_Fctr_QR_TS_Config
+{
+  // Rows of the leaf blocks; 0 picks about 32K elements per block,
+  // so that a leaf stays in cache while it is factored. Blocks never
+  // have fewer than 2n rows; the last one takes the remaining rows.
+  Size mb = 0;
+
+  // Panel width of the blocked leaf factorizations.
+  Size nb = Mat_Fctr_BlkSize;
+
+  // Threads, counting the caller; 0 means one per hardware thread.
+  // The overloads taking an execution context run at most this many
+  // tasks at a time, one per slot of the workspace.
+  Size threadCount = 0;
+};
+
+namespace _n_Impl {
+
+  inline constexpr Size _QR_TS_BlkRows( Size n, const Mat_Fctr_QR_TS_Config &config ) noexcept
+  { return Max( ( 0 == config.mb ) ? (Size)32768/Max( n, (Size)1 ) : config.mb, 2*n ); }
+
+  inline constexpr Size _QR_TS_BlkCount( Size m, Size mb ) noexcept
+  { return Max( m/Max( mb, (Size)1 ), (Size)1 ); }
+
+  // Per-thread workspace: a T factor and the Rfl_BlkMul workspace
+  // for w columns, which also covers the unblocked leaf code.
+  inline constexpr Size _QR_TS_SlotSize( Size w, Size nb ) noexcept
+  { return _Aux_FctrBlk_WorkSize( w, Max( nb, (Size)1 ) ); }
+
+  inline Size _QR_TS_SlotCount( Size p, Size threadCount ) noexcept
+  {
+    if( 0 == threadCount )
+    { threadCount = Max( (Size)std::thread::hardware_concurrency(), (Size)1 ); }
+    return Min( p, threadCount );
+  }
+
+  // Slots of workspace a call through exec uses: no more than the
+  // WorkSize of config provides, whatever exec.ThreadCount() is.
+  template< typename T_Exec >
+  inline Size _QR_TS_ExecSlots( Size p, T_Exec &exec, const Mat_Fctr_QR_TS_Config &config ) noexcept
+  { return Max( Min( _QR_TS_SlotCount( p, config.threadCount ), (Size)exec.ThreadCount() ), (Size)1 ); }
+
+  // Runs fn( t, i ) for i in 0:count-1 through exec, where t < slots
+  // is the task's workspace slot.
+  template< typename T_Exec, typename T_Fn >
+  void _QR_TS_ForEach( T_Exec &exec, Size slots, Size count, T_Fn &&fn )
+  {
+    const Size tiles = Min( slots, count );
+    exec.Fork( tiles, [&, tiles]( Size t )
+    {
+      for( Size i = t; i < count; i += tiles )
+      { fn( t, i ); }
+    } );
+    exec.Join();
+  }
+
+  // QR factorization of a 2n by n matrix made of two upper triangles,
+  //
+  //    ( R0 ) = H(0) H(1) . . . H(n-1) * ( R ),
+  //    ( R1 )                            ( 0 )
+  //
+  // (the dtpqrt2 case l = n). R0 is overwritten with R and R1 with
+  // the reflectors: v of H(j) is a unit in row j of R0 followed by
+  // R1(0:j,j).
+  template< typename Lyt,
+    typename T_Blk_R0,
+    typename T_Blk_R1,
+    typename T_Arr_tau >
+  constexpr void _Mat_Fctr_QR_TT(
+    Size n,
+    T_Blk_R0 R0_, Stride R0_ld,
+    T_Blk_R1 R1_, Stride R1_ld,
+    T_Arr_tau tau )
+  {
+    auto R0 = [&]( auto i, auto j ) -> auto &
+    { return Lyt::MatRef( R0_, i, j, R0_ld ); };
+    auto R1_Col = [&]( auto i, auto j ) -> auto
+    { return Lyt::ColPtr( R1_, i, j, R1_ld ); };
+
+    const auto R1_cs = Lyt::ColStride( R1_, R1_ld );
+
+    for( Index j = 0; j < (Index)n; ++j )
+    {
+      // Generate H(j) to annihilate R1(0:j,j)
+      Rfl_VecGen< Lyt >( j+2, R0(j,j), R1_Col( 0, j ), R1_cs, tau[j] );
+
+      if( IsZero( tau[j] ) ){ continue; }
+
+      // Apply H(j) to rows j of R0 and 0:j of R1, columns j+1:n-1
+      for( Index c = j+1; c < (Index)n; ++c )
+      {
+        const auto w = tau[j]*( R0(j,c)
+          + Vec_Dot< Lyt >( j+1, R1_Col( 0, j ), R1_cs, R1_Col( 0, c ), R1_cs ) );
+        R0(j,c) -= w;
+        Vec_AXPlusY< Lyt >( j+1, -w, R1_Col( 0, j ), R1_cs, R1_Col( 0, c ), R1_cs );
+      }
+    }
+  }
+
+  // Applies the Q of _Mat_Fctr_QR_TT, or its transpose, from the left
+  // to the 2n by nc matrix ( C0 ), where C0 and C1 are n by nc.
+  //                        ( C1 )
+  template< typename Lyt,
+    typename T_Blk_V,
+    typename T_Arr_tau,
+    typename T_Blk_C0,
+    typename T_Blk_C1 >
+  constexpr void _Ort_MatMul_QR_TT(
+    Trnsp trnsp,
+    Size n, Size nc,
+    T_Blk_V V_, Stride V_ld,
+    T_Arr_tau tau,
+    T_Blk_C0 C0_, Stride C0_ld,
+    T_Blk_C1 C1_, Stride C1_ld )
+  {
+    auto V_Col = [&]( auto i, auto j ) -> auto
+    { return Lyt::ColPtr( V_, i, j, V_ld ); };
+    auto C0 = [&]( auto i, auto j ) -> auto &
+    { return Lyt::MatRef( C0_, i, j, C0_ld ); };
+    auto C1_Col = [&]( auto i, auto j ) -> auto
+    { return Lyt::ColPtr( C1_, i, j, C1_ld ); };
+
+    const auto V_cs = Lyt::ColStride( V_, V_ld );
+    const auto C1_cs = Lyt::ColStride( C1_, C1_ld );
+
+    for( Index jj = 0; jj < (Index)n; ++jj )
+    {
+      // ~Q = H(n-1) . . . H(0) starts from H(0); Q from H(n-1)
+      const Index j = ( Trnsp::No == trnsp ) ? (Index)n-1-jj : jj;
+
+      if( IsZero( tau[j] ) ){ continue; }
+
+      for( Index c = 0; c < (Index)nc; ++c )
+      {
+        const auto w = tau[j]*( C0(j,c)
+          + Vec_Dot< Lyt >( j+1, V_Col( 0, j ), V_cs, C1_Col( 0, c ), C1_cs ) );
+        C0(j,c) -= w;
+        Vec_AXPlusY< Lyt >( j+1, -w, V_Col( 0, j ), V_cs, C1_Col( 0, c ), C1_cs );
+      }
+    }
+  }
+
+  // Applies Q = H(0) H(1) . . . H(k-1) of a (blocked) QR factorization
+  // of the m by k matrix A, or its transpose, from the left to the
+  // m by n matrix C, nb reflectors at a time. work holds
+  // _QR_TS_SlotSize( n, nb ) elements.
+  template< typename Lyt,
+    typename T_Blk_A,
+    typename T_Arr_tau,
+    typename T_Blk_C,
+    typename T_Arr_work >
+  constexpr void _Ort_MatMul_QR_Blk(
+    Trnsp trnsp,
+    Size m, Size n, Size k,
+    T_Blk_A A_, Stride A_ld,
+    T_Arr_tau tau,
+    T_Blk_C C_, Stride C_ld,
+    T_Arr_work work,
+    Size nb )
+  {
+    auto A_Blk = [&]( auto i, auto j ) -> auto
+    { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+    auto C_Blk = [&]( auto i, auto j ) -> auto
+    { return Lyt::BlkPtr( C_, i, j, C_ld ); };
+
+    if( ( 0 == n ) || ( 0 == k ) ){ return; }
+
+    nb = Max( nb, (Size)1 );
+
+    const auto T_ = work;
+    const auto W_ = work + nb*nb;
+
+    const Stride T_ld = Lyt::DenseLd( nb, nb );
+    const Stride W_ld = Lyt::DenseLd( n, nb );
+
+    const Size blkCount = ( k + nb-1 )/nb;
+
+    for( Size jb = 0; jb < blkCount; ++jb )
+    {
+      const Size b = ( ( Trnsp::No == trnsp ) ? blkCount-1-jb : jb )*nb;
+      const Size ib = Min( k-b, nb );
+
+      Rfl_BlkGen< Lyt >( Direct::Fwd, Store::ByCol,
+        m-b, ib, A_Blk( b, b ), A_ld, tau + b, T_, T_ld );
+
+      Rfl_BlkMul< Lyt >( Side::Left, trnsp, Direct::Fwd, Store::ByCol,
+        m-b, n, ib,
+        A_Blk( b, b ), A_ld,
+        T_, T_ld,
+        C_Blk( b, 0 ), C_ld,
+        W_, W_ld );
+    }
+  }
+
+}// namespace _n_Impl
+
+/// <summary>
+/// Elements of tau for <see cref="Mat_Fctr_QR_TS"/>: n per leaf
+/// block and n per node of the reduction tree.
+/// </summary>
+inline constexpr Size Mat_Fctr_QR_TS_TauSize( Size m, Size n, const Mat_Fctr_QR_TS_Config &config = {} ) noexcept
+{
+  const Size p = _n_Impl::_QR_TS_BlkCount( m, _n_Impl::_QR_TS_BlkRows( n, config ) );
+  return ( 1 == p ) ? Min( m, n ) : ( 2*p-1 )*n;
+}
+
+/// <summary>
+/// Workspace of <see cref="Mat_Fctr_QR_TS"/>; one slot per thread,
+/// so an unset config.threadCount is resolved here.
+/// </summary>
+inline Size Mat_Fctr_QR_TS_WorkSize( Size m, Size n, const Mat_Fctr_QR_TS_Config &config = {} ) noexcept
+{
+  const Size p = _n_Impl::_QR_TS_BlkCount( m, _n_Impl::_QR_TS_BlkRows( n, config ) );
+  return _n_Impl::_QR_TS_SlotCount( p, config.threadCount )*_n_Impl::_QR_TS_SlotSize( n, config.nb );
+}
+
+/// <summary>
+/// Workspace of <see cref="Ort_MatMul_QR_TS"/> for a C with nc columns.
+/// </summary>
+inline Size Ort_MatMul_QR_TS_WorkSize( Size m, Size n, Size nc, const Mat_Fctr_QR_TS_Config &config = {} ) noexcept
+{
+  const Size p = _n_Impl::_QR_TS_BlkCount( m, _n_Impl::_QR_TS_BlkRows( n, config ) );
+  return _n_Impl::_QR_TS_SlotCount( p, config.threadCount )*_n_Impl::_QR_TS_SlotSize( nc, config.nb );
+}
+
+/// <summary>
+/// Workspace of <see cref="Ort_From_QR_TS"/>.
+/// </summary>
+inline Size Ort_From_QR_TS_WorkSize( Size m, Size n, const Mat_Fctr_QR_TS_Config &config = {} ) noexcept
+{ return Ort_MatMul_QR_TS_WorkSize( m, n, n, config ); }
+
+/// <summary>
+/// Tall-skinny QR factorization of a real m by n matrix A,
+///
+///    A = Q * ( R ),
+///            ( 0 )
+///
+/// with the work split through the execution context exec (see
+/// <see cref="ExecContext"/>).
+///
+/// The rows are split into p blocks of config.mb rows (the last
+/// block takes the remaining rows), and each block is factored
+/// independently by <see cref="Mat_Fctr_QR_Blk"/>, one task per
+/// block. The p triangles are then combined pairwise up a binary
+/// tree: at level s = 1, 2, 4, ... the R of block c+s is stacked
+/// below the R of block c, for c a multiple of 2s, and the pair is
+/// factored again, one task per pair. R ends up in the leading n rows
+/// of A. There are at most config.threadCount tasks at a time, so
+/// the workspace of config is enough for any exec.
+/// </summary>
+/// <remarks>
+/// Based on the TSQR algorithm of Demmel, Grigori, Hoemmen and
+/// Langou, with the LAPACK routine <c>dtpqrt2</c> at the nodes.
+///
+/// Q is kept implicitly, as the product of the leaf and node
+/// reflectors:
+///
+///    Q = diag( Q(0), . . ., Q(p-1) ) * Q(level 1) * Q(level 2) . . .
+///
+/// Each leaf keeps its reflectors below its diagonal, as
+/// <see cref="Mat_Fctr_QR"/> does, with tau( c*n : c*n+n-1 ); the
+/// node that consumes the R of block q keeps its reflectors in that
+/// R's triangle, with tau( (p+q-1)*n : (p+q)*n-1 ). Apply Q with
+/// <see cref="Ort_MatMul_QR_TS"/>, or form it explicitly with
+/// <see cref="Ort_From_QR_TS"/>, passing the same config.
+///
+/// If A is a single block this is <see cref="Mat_Fctr_QR_Blk"/>.
+/// tau must hold <see cref="Mat_Fctr_QR_TS_TauSize"/>( m, n, config )
+/// elements, and work <see cref="Mat_Fctr_QR_TS_WorkSize"/>( m, n, config ).
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Arr_work,
+  typename T_Exec >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> >
+  && ExecContext< Decay<T_Exec> > )
+void Mat_Fctr_QR_TS(
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Arr_work work,
+  T_Exec &&exec,
+  const Mat_Fctr_QR_TS_Config &config = {} )
+{
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+
+  const Size mb = _n_Impl::_QR_TS_BlkRows( n, config );
+  const Size p = _n_Impl::_QR_TS_BlkCount( m, mb );
+
+  if( 1 == p )
+  { return Mat_Fctr_QR_Blk< Lyt >( m, n, A_, A_ld, tau, work, config.nb ); }
+
+  const Size slots = _n_Impl::_QR_TS_ExecSlots( p, exec, config );
+  const Size slotSize = _n_Impl::_QR_TS_SlotSize( n, config.nb );
+
+  // Leaves
+  _n_Impl::_QR_TS_ForEach( exec, slots, p, [&]( Size t, Size c )
+  {
+    const Size rows = ( c+1 == p ) ? m-c*mb : mb;
+    Mat_Fctr_QR_Blk< Lyt >( rows, n, A_Blk( c*mb, 0 ), A_ld,
+      tau + c*n, work + t*slotSize, config.nb );
+  } );
+
+  // Tree
+  for( Size s = 1; s < p; s *= 2 )
+  {
+    _n_Impl::_QR_TS_ForEach( exec, slots, ( p-s + 2*s-1 )/( 2*s ), [&, s]( Size, Size i )
+    {
+      const Size c = 2*s*i, q = c+s;
+      _n_Impl::_Mat_Fctr_QR_TT< Lyt >( n,
+        A_Blk( c*mb, 0 ), A_ld,
+        A_Blk( q*mb, 0 ), A_ld,
+        tau + ( p+q-1 )*n );
+    } );
+  }
+}
+
+/// <summary>
+/// Tall-skinny QR factorization of a real m by n matrix A, as the
+/// overload above, on an <see cref="Exec_Par"/> of config.threadCount
+/// threads made for the call.
+/// </summary>
+/// <remarks>
+/// tau must hold <see cref="Mat_Fctr_QR_TS_TauSize"/>( m, n, config )
+/// elements, and work <see cref="Mat_Fctr_QR_TS_WorkSize"/>( m, n, config ).
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+void Mat_Fctr_QR_TS(
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Arr_work work,
+  const Mat_Fctr_QR_TS_Config &config = {} )
+{
+  const Size p = _n_Impl::_QR_TS_BlkCount( m, _n_Impl::_QR_TS_BlkRows( n, config ) );
+  const Size slots = _n_Impl::_QR_TS_SlotCount( p, config.threadCount );
+
+  if( 1 == slots )
+  { return Mat_Fctr_QR_TS< Lyt >( m, n, A_, A_ld, tau, work, Exec_Seq{}, config ); }
+
+  Exec_Par exec{ slots };
+  Mat_Fctr_QR_TS< Lyt >( m, n, A_, A_ld, tau, work, exec, config );
+}
+
+/// <summary>
+/// Overwrites the real m by nc matrix C with
+///
+///    Q * C  if trnsp == Trnsp::No, or
+///    ~Q * C if trnsp == Trnsp::Yes,
+///
+/// where Q is the m by m orthogonal matrix of a
+/// <see cref="Mat_Fctr_QR_TS"/> of the m by n matrix A, with the work
+/// split through the execution context exec (see
+/// <see cref="ExecContext"/>).
+/// </summary>
+/// <remarks>
+/// C is split into the same row blocks as A. For ~Q the leaves are
+/// applied first, one task per block, and then the tree bottom-up,
+/// one task per node of a level; for Q the tree top-down and the
+/// leaves last.
+///
+/// config must be the one given to the factorization. work must hold
+/// <see cref="Ort_MatMul_QR_TS_WorkSize"/>( m, n, nc, config ) elements.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Blk_C,
+  typename T_Arr_work,
+  typename T_Exec >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Blk_C>>,
+  Decay<DerefTypeOf<T_Arr_work>> >
+  && ExecContext< Decay<T_Exec> > )
+void Ort_MatMul_QR_TS(
+  Trnsp trnsp,
+  Size m, Size n, Size nc,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Blk_C C_, Stride C_ld,
+  T_Arr_work work,
+  T_Exec &&exec,
+  const Mat_Fctr_QR_TS_Config &config = {} )
+{
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+  auto C_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( C_, i, j, C_ld ); };
+
+  const Size mb = _n_Impl::_QR_TS_BlkRows( n, config );
+  const Size p = _n_Impl::_QR_TS_BlkCount( m, mb );
+
+  const Size slots = _n_Impl::_QR_TS_ExecSlots( p, exec, config );
+  const Size slotSize = _n_Impl::_QR_TS_SlotSize( nc, config.nb );
+
+  auto Leaf = [&]( Size t, Size c )
+  {
+    const Size rows = ( c+1 == p ) ? m-c*mb : mb;
+    _n_Impl::_Ort_MatMul_QR_Blk< Lyt >( trnsp, rows, nc, Min( rows, n ),
+      A_Blk( c*mb, 0 ), A_ld, tau + c*n,
+      C_Blk( c*mb, 0 ), C_ld,
+      work + t*slotSize, config.nb );
+  };
+
+  if( 1 == p )
+  { return Leaf( 0, 0 ); }
+
+  auto Level = [&]( Size s )
+  {
+    _n_Impl::_QR_TS_ForEach( exec, slots, ( p-s + 2*s-1 )/( 2*s ), [&, s]( Size, Size i )
+    {
+      const Size c = 2*s*i, q = c+s;
+      _n_Impl::_Ort_MatMul_QR_TT< Lyt >( trnsp, n, nc,
+        A_Blk( q*mb, 0 ), A_ld, tau + ( p+q-1 )*n,
+        C_Blk( c*mb, 0 ), C_ld,
+        C_Blk( q*mb, 0 ), C_ld );
+    } );
+  };
+
+  Size top = 1;
+  while( 2*top < p ){ top *= 2; }
+
+  if( Trnsp::No == trnsp )
+  {
+    for( Size s = top; s > 0; s /= 2 ){ Level( s ); }
+    _n_Impl::_QR_TS_ForEach( exec, slots, p, Leaf );
+  }
+  else
+  {
+    _n_Impl::_QR_TS_ForEach( exec, slots, p, Leaf );
+    for( Size s = 1; s <= top; s *= 2 ){ Level( s ); }
+  }
+}
+
+/// <summary>
+/// Overwrites the real m by nc matrix C with Q * C or ~Q * C, as the
+/// overload above, on an <see cref="Exec_Par"/> of config.threadCount
+/// threads made for the call.
+/// </summary>
+/// <remarks>
+/// config must be the one given to the factorization. work must hold
+/// <see cref="Ort_MatMul_QR_TS_WorkSize"/>( m, n, nc, config ) elements.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Blk_C,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Blk_C>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+void Ort_MatMul_QR_TS(
+  Trnsp trnsp,
+  Size m, Size n, Size nc,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Blk_C C_, Stride C_ld,
+  T_Arr_work work,
+  const Mat_Fctr_QR_TS_Config &config = {} )
+{
+  const Size p = _n_Impl::_QR_TS_BlkCount( m, _n_Impl::_QR_TS_BlkRows( n, config ) );
+  const Size slots = _n_Impl::_QR_TS_SlotCount( p, config.threadCount );
+
+  if( 1 == slots )
+  { return Ort_MatMul_QR_TS< Lyt >( trnsp, m, n, nc, A_, A_ld, tau, C_, C_ld, work, Exec_Seq{}, config ); }
+
+  Exec_Par exec{ slots };
+  Ort_MatMul_QR_TS< Lyt >( trnsp, m, n, nc, A_, A_ld, tau, C_, C_ld, work, exec, config );
+}
+
+/// <summary>
+/// Generates the real m by n matrix Q with orthonormal columns, the
+/// leading n columns of the orthogonal matrix of a
+/// <see cref="Mat_Fctr_QR_TS"/> of the m by n matrix A, with the work
+/// split through the execution context exec (see
+/// <see cref="ExecContext"/>).
+/// </summary>
+/// <remarks>
+/// Q is formed by applying <see cref="Ort_MatMul_QR_TS"/> to the
+/// leading n columns of the identity, so it may not overlap A.
+///
+/// config must be the one given to the factorization. work must hold
+/// <see cref="Ort_From_QR_TS_WorkSize"/>( m, n, config ) elements.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Blk_Q,
+  typename T_Arr_work,
+  typename T_Exec >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Blk_Q>>,
+  Decay<DerefTypeOf<T_Arr_work>> >
+  && ExecContext< Decay<T_Exec> > )
+void Ort_From_QR_TS(
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Blk_Q Q_, Stride Q_ld,
+  T_Arr_work work,
+  T_Exec &&exec,
+  const Mat_Fctr_QR_TS_Config &config = {} )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+  if( n > m ){ throw BadArgument{ "Ort_From_QR_TS", 2 }; }
+
+  Mat_Fill< Lyt >( Half::Both, m, n, Scalar{}, unit< Scalar >, Q_, Q_ld );
+
+  Ort_MatMul_QR_TS< Lyt >( Trnsp::No, m, n, n,
+    A_, A_ld, tau, Q_, Q_ld, work, exec, config );
+}
+
+/// <summary>
+/// Generates the Q of a <see cref="Mat_Fctr_QR_TS"/> as the overload
+/// above, on an <see cref="Exec_Par"/> of config.threadCount threads
+/// made for the call.
+/// </summary>
+/// <remarks>
+/// config must be the one given to the factorization. work must hold
+/// <see cref="Ort_From_QR_TS_WorkSize"/>( m, n, config ) elements.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Blk_Q,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Blk_Q>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+void Ort_From_QR_TS(
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Blk_Q Q_, Stride Q_ld,
+  T_Arr_work work,
+  const Mat_Fctr_QR_TS_Config &config = {} )
+{
+  const Size p = _n_Impl::_QR_TS_BlkCount( m, _n_Impl::_QR_TS_BlkRows( n, config ) );
+  const Size slots = _n_Impl::_QR_TS_SlotCount( p, config.threadCount );
+
+  if( 1 == slots )
+  { return Ort_From_QR_TS< Lyt >( m, n, A_, A_ld, tau, Q_, Q_ld, work, Exec_Seq{}, config ); }
+
+  Exec_Par exec{ slots };
+  Ort_From_QR_TS< Lyt >( m, n, A_, A_ld, tau, Q_, Q_ld, work, exec, config );
+}
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
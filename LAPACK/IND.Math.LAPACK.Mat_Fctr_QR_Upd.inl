@@ -0,0 +1,362 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+// Updates of a QR factorization A = Q*R by Givens rotations, for A
+// changing by one row or one column, in O(n^2) (O(mn) with Q) against
+// O(mn^2) for factoring anew.
+//
+// The row updates change R alone, as least squares with a sliding
+// window needs: R is n by nc upper trapezoidal, nc >= n, so that the
+// right-hand sides ~Q*b may ride along as columns n:nc-1 of R, and the
+// matching entries of b as elements n:nc-1 of the row.
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Mat_Fctr_QR_RowDel"/>.
+/// </summary>
+inline constexpr Size Mat_Fctr_QR_RowDel_WorkSize( Size n ) noexcept
+{ return 2*n; }
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Mat_Fctr_QR_ColIns"/>.
+/// </summary>
+inline constexpr Size Mat_Fctr_QR_ColIns_WorkSize( Size n ) noexcept
+{ return 2*n+1; }
+
+/// <summary>
+/// Updates R to the R factor of A with the row x appended, so that
+/// (~R)*R gains x*(~x). x has nc elements, of stride x_s, and is
+/// destroyed: on return x(n:nc-1) holds the parts of the new
+/// right-hand sides that add to the residual.
+/// </summary>
+/// <remarks>
+/// Based on the LINPACK routine <c>dchud</c>.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_R,
+  typename T_Vec_x >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_R>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_R>>,
+  Decay<DerefTypeOf<T_Vec_x>> > )
+constexpr void Mat_Fctr_QR_RowIns(
+  Size n, Size nc,
+  T_Blk_R R_, Stride R_ld,
+  T_Vec_x x_, Stride x_s )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_R>>;
+
+  if( nc < n ){ throw BadArgument{ "Mat_Fctr_QR_RowIns", 2 }; }
+
+  auto R = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( R_, i, j, R_ld ); };
+  auto x = [&]( auto i ) -> auto &
+  { return Lyt::VecRef( x_, i, x_s ); };
+
+  const auto R_rs = Lyt::RowStride( R_, R_ld );
+
+  for( Index j = 0; j < (Index)n; ++j )
+  {
+    Scalar c = {}, s = {}, r = {};
+    Aux_PlnRot2( R(j,j), x(j), c, s, r );
+    R(j,j) = r;
+    x(j) = {};
+
+    if( j+1 < (Index)nc )
+    {
+      Vec_PlnRot< Lyt >( nc-(j+1),
+        Lyt::RowPtr( R_, j, j+1, R_ld ), R_rs,
+        Lyt::VecPtr( x_, j+1, x_s ), x_s, c, s );
+    }
+  }
+}
+
+/// <summary>
+/// Updates R to the R factor of A with the row x removed, so that
+/// (~R)*R loses x*(~x). x has nc elements, of stride x_s, and is not
+/// changed.
+///
+/// work must hold <see cref="Mat_Fctr_QR_RowDel_WorkSize"/>( n ) elements.
+/// Returns false, with R unchanged, if the downdated matrix would not
+/// be positive definite, i.e. x is not a row of A to within rounding.
+/// </summary>
+/// <remarks>
+/// Based on the LINPACK routine <c>dchdd</c>. Downdating is less
+/// stable than updating; its error grows as the returned R nears
+/// singularity.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_R,
+  typename T_Vec_x,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_R>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_R>>,
+  Decay<DerefTypeOf<T_Vec_x>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr bool Mat_Fctr_QR_RowDel(
+  Size n, Size nc,
+  T_Blk_R R_, Stride R_ld,
+  T_Vec_x x_, Stride x_s,
+  T_Arr_work work )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_R>>;
+
+  if( nc < n ){ throw BadArgument{ "Mat_Fctr_QR_RowDel", 2 }; }
+
+  if( 0 == n ){ return true; }
+
+  auto R = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( R_, i, j, R_ld ); };
+  auto x = [&]( auto i ) -> auto &
+  { return Lyt::VecRef( x_, i, x_s ); };
+
+  const Scalar one = unit< Scalar >;
+
+  // (~R)*a = x(0:n-1), then a turns into the sines in place
+  const auto s = work;
+  const auto c = work + n;
+
+  for( Index i = 0; i < (Index)n; ++i )
+  { s[i] = x(i); }
+  Tri_Solv_Vec< Lyt >( Half::Upper, Trnsp::Yes, Diag::NotUnit, n, R_, R_ld, s, 1 );
+
+  const Scalar norm = Vec_Norm2< Lyt >( n, s, 1 );
+  if( norm >= one ){ return false; }
+
+  // Rotations that take ( a, alpha ) to ( 0, 1 ), last element first
+  Scalar alpha = Sqrt( ( one - norm )*( one + norm ) );
+  for( Index i = (Index)n-1; i >= 0; --i )
+  {
+    const Scalar scale = alpha + Abs( s[i] );
+    const Scalar p = alpha/scale;
+    const Scalar q = s[i]/scale;
+    const Scalar h = Sqrt( p*p + q*q );
+    c[i] = p/h;
+    s[i] = q/h;
+    alpha = scale*h;
+  }
+
+  // Applied to the columns of R, which give back x(0:n-1) ...
+  for( Index j = 0; j < (Index)n; ++j )
+  {
+    Scalar xx = {};
+    for( Index i = j; i >= 0; --i )
+    {
+      const Scalar t = c[i]*xx + s[i]*R(i,j);
+      R(i,j) = c[i]*R(i,j) - s[i]*xx;
+      xx = t;
+    }
+  }
+
+  // ... and to the right-hand sides, with x(j) for their own
+  for( Index j = (Index)n; j < (Index)nc; ++j )
+  {
+    Scalar zeta = x(j);
+    for( Index i = 0; i < (Index)n; ++i )
+    {
+      R(i,j) = ( R(i,j) - s[i]*zeta )/c[i];
+      zeta = c[i]*zeta - s[i]*R(i,j);
+    }
+  }
+
+  return true;
+}
+
+/// <summary>
+/// Updates the R factor of A, n by nc as for the row updates, to that
+/// of A with column k removed. Columns k+1:nc-1 move left by one, and
+/// the leading n-1 by n-1 part of R is upper triangular again; row
+/// n-1 keeps the parts of the right-hand sides that now add to the
+/// residual. If Q_ is not null, the m by n Q is updated along.
+/// </summary>
+/// <remarks>
+/// Based on the routine <c>dqrdec</c> of qrupdate.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_R,
+  typename T_Blk_Q >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_R>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_R>>,
+  Decay<DerefTypeOf<T_Blk_Q>> > )
+constexpr void Mat_Fctr_QR_ColDel(
+  Size n, Size nc,
+  T_Blk_R R_, Stride R_ld,
+  Index k,
+  Size m, T_Blk_Q Q_, Stride Q_ld )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_R>>;
+
+  if( nc < n ){ throw BadArgument{ "Mat_Fctr_QR_ColDel", 2 }; }
+  if( ( k < 0 ) || ( k >= (Index)nc ) )
+  { throw BadArgument{ "Mat_Fctr_QR_ColDel", 5 }; }
+
+  auto R = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( R_, i, j, R_ld ); };
+
+  const auto R_rs = Lyt::RowStride( R_, R_ld );
+  const auto R_cs = Lyt::ColStride( R_, R_ld );
+  const auto Q_cs = Lyt::ColStride( Q_, Q_ld );
+
+  // Shift the columns right of k, the upper trapezoid of each
+  for( Index j = k; j+1 < (Index)nc; ++j )
+  {
+    Vec_Copy< Lyt >( Min( (Size)j+2, n ),
+      Lyt::ColPtr( R_, 0, j+1, R_ld ), R_cs,
+      Lyt::ColPtr( R_, 0, j, R_ld ), R_cs );
+  }
+
+  // Zero the subdiagonal left in columns k:n-2
+  for( Index j = k; j+1 < (Index)n && j+1 < (Index)nc; ++j )
+  {
+    Scalar c = {}, s = {}, r = {};
+    Aux_PlnRot2( R(j,j), R(j+1,j), c, s, r );
+    R(j,j) = r;
+    R(j+1,j) = {};
+
+    if( j+2 < (Index)nc )
+    {
+      Vec_PlnRot< Lyt >( nc-(j+2),
+        Lyt::RowPtr( R_, j, j+1, R_ld ), R_rs,
+        Lyt::RowPtr( R_, j+1, j+1, R_ld ), R_rs, c, s );
+    }
+
+    if( nullptr != Q_ )
+    {
+      Vec_PlnRot< Lyt >( m,
+        Lyt::ColPtr( Q_, 0, j, Q_ld ), Q_cs,
+        Lyt::ColPtr( Q_, 0, j+1, Q_ld ), Q_cs, c, s );
+    }
+  }
+}
+
+/// <summary>
+/// Updates the R factor as above, without Q.
+/// </summary>
+template< typename Lyt = ColMajor,
+  typename T_Blk_R >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_R>> > )
+constexpr void Mat_Fctr_QR_ColDel(
+  Size n, Size nc,
+  T_Blk_R R_, Stride R_ld,
+  Index k )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_R>>;
+  Mat_Fctr_QR_ColDel< Lyt >( n, nc, R_, R_ld, k, 0, (Scalar *)nullptr, 1 );
+}
+
+/// <summary>
+/// Updates the thin factorization A = Q*R of an m by n matrix, n &lt; m,
+/// to that of A with the column a inserted before column k, so that
+/// it becomes column k of the m by n+1 result. Q must have room for
+/// column n, and R for row and column n; a has m elements, of stride
+/// a_s.
+///
+/// work must hold <see cref="Mat_Fctr_QR_ColIns_WorkSize"/>( n ) elements.
+/// Returns false if a lies in the range of Q to within rounding, i.e.
+/// the part of it orthogonal to Q is below m*eps*||a||, in which case
+/// the new R would be singular; R is then left as on entry, and only
+/// column n of Q is overwritten.
+/// </summary>
+/// <remarks>
+/// Based on the routine <c>dqrinc</c> of qrupdate. The new column of
+/// Q is orthogonalized against the others twice (classical
+/// Gram-Schmidt with reorthogonalization).
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_Q,
+  typename T_Blk_R,
+  typename T_Vec_a,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_R>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_R>>,
+  Decay<DerefTypeOf<T_Blk_Q>>,
+  Decay<DerefTypeOf<T_Vec_a>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr bool Mat_Fctr_QR_ColIns(
+  Size m, Size n,
+  T_Blk_Q Q_, Stride Q_ld,
+  T_Blk_R R_, Stride R_ld,
+  Index k,
+  T_Vec_a a_, Stride a_s,
+  T_Arr_work work )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_R>>;
+
+  if( n >= m ){ throw BadArgument{ "Mat_Fctr_QR_ColIns", 2 }; }
+  if( ( k < 0 ) || ( k > (Index)n ) )
+  { throw BadArgument{ "Mat_Fctr_QR_ColIns", 7 }; }
+
+  auto R = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( R_, i, j, R_ld ); };
+
+  const Scalar one = unit< Scalar >;
+  const Scalar zero = {};
+
+  const auto R_rs = Lyt::RowStride( R_, R_ld );
+  const auto R_cs = Lyt::ColStride( R_, R_ld );
+  const auto Q_cs = Lyt::ColStride( Q_, Q_ld );
+
+  const auto r = work;
+  const auto t = work + n+1;
+  const auto w = Lyt::ColPtr( Q_, 0, (Index)n, Q_ld );
+
+  // r = ~Q*a, w = a - Q*r, twice
+  Vec_Copy< Lyt >( m, a_, a_s, w, Q_cs );
+  Mat_VecMul< Lyt >( Trnsp::Yes, m, n, one, Q_, Q_ld, w, Q_cs, zero, r, 1 );
+  Mat_VecMul< Lyt >( Trnsp::No, m, n, -one, Q_, Q_ld, r, 1, one, w, Q_cs );
+  Mat_VecMul< Lyt >( Trnsp::Yes, m, n, one, Q_, Q_ld, w, Q_cs, zero, t, 1 );
+  Mat_VecMul< Lyt >( Trnsp::No, m, n, -one, Q_, Q_ld, t, 1, one, w, Q_cs );
+  Vec_AXPlusY< Lyt >( n, one, t, 1, r, 1 );
+
+  // What is left of a in range(Q) is rounding, not a new direction
+  const Scalar eps = std::numeric_limits< Scalar >::epsilon();
+  const Scalar rho = Vec_Norm2< Lyt >( m, w, Q_cs );
+  if( rho <= (Scalar)m*eps*Vec_Norm2< Lyt >( m, a_, a_s ) ){ return false; }
+
+  Vec_Scale< Lyt >( m, Inv( rho ), w, Q_cs );
+  r[n] = rho;
+
+  // Row n is zero left of the new column; shift columns k:n-1 right
+  for( Index j = 0; j < (Index)n; ++j )
+  { R( (Index)n, j ) = zero; }
+  for( Index j = (Index)n-1; j >= k; --j )
+  {
+    Vec_Copy< Lyt >( Min( (Size)j+2, n+1 ),
+      Lyt::ColPtr( R_, 0, j, R_ld ), R_cs,
+      Lyt::ColPtr( R_, 0, j+1, R_ld ), R_cs );
+  }
+  Vec_Copy< Lyt >( n+1, r, 1, Lyt::ColPtr( R_, 0, k, R_ld ), R_cs );
+
+  // Zero column k below the diagonal, from the bottom
+  for( Index i = (Index)n-1; i >= k; --i )
+  {
+    Scalar c = {}, s = {}, h = {};
+    Aux_PlnRot2( R(i,k), R(i+1,k), c, s, h );
+    R(i,k) = h;
+    R(i+1,k) = zero;
+
+    Vec_PlnRot< Lyt >( n-(Size)k,
+      Lyt::RowPtr( R_, i, k+1, R_ld ), R_rs,
+      Lyt::RowPtr( R_, i+1, k+1, R_ld ), R_rs, c, s );
+    Vec_PlnRot< Lyt >( m,
+      Lyt::ColPtr( Q_, 0, i, Q_ld ), Q_cs,
+      Lyt::ColPtr( Q_, 0, i+1, Q_ld ), Q_cs, c, s );
+  }
+
+  return true;
+}
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
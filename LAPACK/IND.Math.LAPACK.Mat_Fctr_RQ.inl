@@ -4,11 +4,43 @@ namespace IND {
 namespace Math {
 namespace LAPACK {
 
+inline constexpr Size Mat_Fctr_RQ_WorkSize( Size m, Size n ) noexcept
+{
+  IND_NOT_USED( n );
+  return m;
+}
+
+inline constexpr Size Mat_Fctr_RQ_Blk_WorkSize( Size m, Size n, Size nb = Mat_Fctr_BlkSize ) noexcept
+{
+  IND_NOT_USED( n );
+  return _n_Impl::_Aux_FctrBlk_WorkSize( m, nb );
+}
+
 /// <summary>
 /// RQ factorization of a real m by n matrix A.
+///
+///    A = ( 0 R ) * Q
+///
+/// where:
+///
+///    Q is a n-by-n orthogonal matrix;
+///    R is an upper-triangular m-by-m matrix;
+///    0 is a m-by-(n-m) zero matrix, if m &lt; n.
 /// </summary>
 /// <remarks>
 /// Based on the LAPACK routine <c>dgerq2</c>
+///
+/// The matrix Q is represented as a product of elementary reflectors
+///
+///     Q = H(0) H(1) . . . H(k-1), where k = min(m,n).
+///
+///  Each H(i) has the form
+///
+///     H(i) = I - tau * v * v**T
+///
+///  where tau is a real scalar, and v is a real vector with
+///  v(n-k+i+1:n-1) = 0 and v(n-k+i) = 1; v(0:n-k+i-1) is stored on exit
+///  in A(m-k+i,0:n-k+i-1), and tau in TAU(i).
 /// </remarks>
 template< typename Lyt = ColMajor,
   typename T_Blk_A,
@@ -27,32 +59,71 @@ constexpr void Mat_Fctr_RQ(
 {
   using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
 
-  auto A = [&]( auto i, auto j ) -> const auto &
+  auto A = [&]( auto i, auto j ) -> auto &
   { return Lyt::MatRef( A_, i, j, A_ld ); };
   auto A_Row = [&]( auto i, auto j ) -> auto
   { return Lyt::RowPtr( A_, i, j, A_ld ); };
 
-  const Stride A_rs = Lyt::RowStride( A_, A_ld );
+  const auto A_rs = Lyt::RowStride( A_, A_ld );
 
   const Size k = Min( m, n );
 
-  for( Index i = (Index)(k-1); i >= 0; --i )
+  for( Index i = (Index)k-1; i >= 0; --i )
   {
-    // Generate elementary reflector H(i) to annihilate A( (m-k)+i, 0:(n-k)+i-1 )
+    const Index ii = (Index)(m-k) + i;
+    const Index jj = (Index)(n-k) + i;
+
+    // Generate elementary reflector H(i) to annihilate A(ii,0:jj-1)
 
-    Rfl_VecGen< Lyt >( (n-k)+(i+1), A( (m-k)+i, (n-k)+i ),
-      A_Row( (m-k)+i, 0 ), A_rs, tau[i] );
+    Rfl_VecGen< Lyt >( jj+1, A(ii,jj),
+      A_Row( ii, 0 ), A_rs, tau[i] );
 
-    // Apply H(i) to A( 0:(m-k)+i-1, 0:(n-k)+i ) from the right
+    // Apply H(i) to A(0:ii-1,0:jj) from the right
 
-    const auto Aii = A( (m-k)+i, (n-k)+i );
-    Rfl_MatMul< Lyt >( Side::Right, (m-k)+(i+1)-1, (n-k)+(i+1),
-      A_Row( (m-k)+i, 0 ), A_rs, tau[i],
+    const auto Aii = A(ii,jj);
+    A(ii,jj) = unit<Scalar>;
+    Rfl_MatMul< Lyt >( Side::Right, ii, jj+1,
+      A_Row( ii, 0 ), A_rs, tau[i],
       A_, A_ld, work );
-    A( (m-k)+i, (n-k)+i ) = Aii;
+    A(ii,jj) = Aii;
   }
 }
 
+/// <summary>
+/// Blocked RQ factorization of a real m by n matrix A, with the same
+/// result as <see cref="Mat_Fctr_RQ"/>.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dgerqf</c>.
+///
+/// work must hold <see cref="Mat_Fctr_RQ_Blk_WorkSize"/>( m, n, nb ) elements.
+/// If nb &lt; 2 or nb &gt;= min(m,n), this is exactly the unblocked code.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr void Mat_Fctr_RQ_Blk(
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Arr_work work,
+  Size nb = Mat_Fctr_BlkSize )
+{
+  if( ( nb < 2 ) || ( nb >= Min( m, n ) ) )
+  { return Mat_Fctr_RQ< Lyt >( m, n, A_, A_ld, tau, work ); }
+
+  _n_Impl::_Aux_FctrBlk< Lyt >( Direct::Bwd, Store::ByRow,
+    m, n, A_, A_ld, tau, work, nb,
+    [&]( Size pnl_m, Size pnl_n, auto pnl_A, auto pnl_tau, auto pnl_work )
+    { Mat_Fctr_RQ< Lyt >( pnl_m, pnl_n, pnl_A, A_ld, pnl_tau, pnl_work ); } );
+}
+
 }// namespace LAPACK
 }// namespace Math
 }// namespace IND
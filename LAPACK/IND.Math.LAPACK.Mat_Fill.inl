@@ -32,7 +32,7 @@ constexpr void Mat_Fill( Half half,
       // Set the strictly upper triangular or
       // trapezoidal part of the array to ALPHA.
       for( Index j = 1; j < (Index)n; ++j )
-      { for( Index i = 0; i < Min(j-1,(Index)(m-1)); ++i )
+      { for( Index i = 0; i < Min(j,(Index)m); ++i )
       { A(i,j) = alpha; } }
     }
     break;
@@ -0,0 +1,126 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Computes the value of the one norm, or the Frobenius norm, or
+/// the infinity norm, or the element of largest absolute value of
+/// a real m by n matrix A.
+///
+/// work is referenced only by NormType::Inf, and must then hold m
+/// elements.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dlange</c>.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && ! isPacked< Lyt > && ! isRfp< Lyt > && ! isTileMajor< Lyt >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr Decay<DerefTypeOf<T_Blk_A>> Mat_Norm(
+  NormType normType,
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_work work )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+  auto A = [&]( auto i, auto j ) -> const auto &
+  { return Lyt::MatRef( A_, i, j, A_ld ); };
+
+  // Quick return if possible.
+
+  if( ( 0 == m ) || ( 0 == n ) ){ return {}; }
+
+  auto value = undefined< Scalar >;
+
+  switch( normType )
+  {
+  default: break;
+  case NormType::Max:
+    {
+      // Find max(abs(A(i,j))).
+
+      value = {};
+      for( Index j = 0; j < (Index)n; ++j )
+      {
+        for( Index i = 0; i < (Index)m; ++i )
+        {
+          const auto aij = Abs( A(i,j) );
+          if( ( value < aij ) || IsUndefined(aij) )
+          { value = aij; }
+        }
+      }
+    }
+    break;
+
+  case NormType::One:
+    {
+      // Find norm1(A).
+
+      value = {};
+      for( Index j = 0; j < (Index)n; ++j )
+      {
+        Scalar sum{};
+        for( Index i = 0; i < (Index)m; ++i )
+        { sum += Abs( A(i,j) ); }
+        if( ( value < sum ) || IsUndefined(sum) )
+        { value = sum; }
+      }
+    }
+    break;
+
+  case NormType::Inf:
+    {
+      // Find normI(A).
+
+      for( Index i = 0; i < (Index)m; ++i )
+      { work[i] = {}; }
+      for( Index j = 0; j < (Index)n; ++j )
+      {
+        for( Index i = 0; i < (Index)m; ++i )
+        { work[i] += Abs( A(i,j) ); }
+      }
+      value = {};
+      for( Index i = 0; i < (Index)m; ++i )
+      {
+        const auto &u = work[i];
+        if( ( value < u ) || IsUndefined(u) )
+        { value = u; }
+      }
+    }
+    break;
+
+  case NormType::Frob:
+    {
+      // Find normF(A).
+      // Vec_SmSqr keeps one sum accurate across all the columns,
+      // so they need not be summed separately and combined.
+
+      Scalar scale{};
+      Scalar sum{ unit<Scalar> };
+
+      const auto A_cs = Lyt::ColStride( A_, A_ld );
+      for( Index j = 0; j < (Index)n; ++j )
+      { Vec_SmSqr< Lyt >( m, Lyt::ColPtr( A_, 0, j, A_ld ), A_cs, scale, sum ); }
+      value = scale*Sqrt( sum );
+    }
+    break;
+  }
+
+  return value;
+}
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
@@ -0,0 +1,204 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+inline constexpr Size Mat_RCond_LU_WorkSize( Size n ) noexcept
+{ return 3*n; }
+
+namespace _n_Impl {
+
+  // Estimates the one norm of the n by n matrix B, which is known
+  // only through apply( x, trnsp ), overwriting x with B*x, or with
+  // (~B)*x when trnsp is true. v, x and isgn take n elements each;
+  // on return v is B*w for the w of unit norm that attains the
+  // estimate. This takes four to eleven products, mostly five.
+  template< typename T_Scalar, typename T_Arr, typename T_Fn_Apply >
+  constexpr T_Scalar _Aux_NormEst1( Size n, T_Arr v, T_Arr x, T_Arr isgn,
+    T_Fn_Apply &&apply )
+  {
+    constexpr Size iterMax = 5;
+
+    const T_Scalar one = unit< T_Scalar >;
+
+    auto Norm1 = [&]( T_Arr y ) -> T_Scalar
+    {
+      T_Scalar s = {};
+      for( Index i = 0; i < (Index)n; ++i ){ s += Abs( y[i] ); }
+      return s;
+    };
+    auto IdxMaxAbs = [&]() -> Index
+    {
+      Index j = 0;
+      for( Index i = 1; i < (Index)n; ++i )
+      {
+        if( Abs( x[j] ) < Abs( x[i] ) ){ j = i; }
+      }
+      return j;
+    };
+    auto Sign = [&]( const T_Scalar &a ) -> T_Scalar
+    { return ( a >= T_Scalar{} ) ? one : -one; };
+
+    for( Index i = 0; i < (Index)n; ++i )
+    { x[i] = one/(T_Scalar)n; }
+    apply( x, false );
+
+    if( 1 == n )
+    {
+      v[0] = x[0];
+      return Abs( v[0] );
+    }
+
+    T_Scalar est = Norm1( x );
+    for( Index i = 0; i < (Index)n; ++i )
+    {
+      x[i] = Sign( x[i] );
+      isgn[i] = x[i];
+    }
+    apply( x, true );
+    Index j = IdxMaxAbs();
+
+    for( Size iter = 2; ; ++iter )
+    {
+      // Main loop: x := B*e(j)
+      for( Index i = 0; i < (Index)n; ++i ){ x[i] = {}; }
+      x[j] = one;
+      apply( x, false );
+      for( Index i = 0; i < (Index)n; ++i ){ v[i] = x[i]; }
+
+      const T_Scalar estold = est;
+      est = Norm1( v );
+
+      // Repeated sign vector, or no progress: converged
+      bool same = true;
+      for( Index i = 0; i < (Index)n; ++i )
+      {
+        if( Sign( x[i] ) != isgn[i] ){ same = false; break; }
+      }
+      if( same || ( est <= estold ) ){ break; }
+
+      for( Index i = 0; i < (Index)n; ++i )
+      {
+        x[i] = Sign( x[i] );
+        isgn[i] = x[i];
+      }
+      apply( x, true );
+
+      const Index jlast = j;
+      j = IdxMaxAbs();
+      if( ( Abs( x[jlast] ) == Abs( x[j] ) ) || ( iter >= iterMax ) )
+      { break; }
+    }
+
+    // Iteration complete; final stage, with the alternating-sign
+    // vector of Higham guarding against the worst cases of the above
+    T_Scalar altsgn = one;
+    for( Index i = 0; i < (Index)n; ++i )
+    {
+      x[i] = altsgn*( one + (T_Scalar)i/(T_Scalar)( n-1 ) );
+      altsgn = -altsgn;
+    }
+    apply( x, false );
+    const T_Scalar temp = 2*( Norm1( x )/(T_Scalar)( 3*n ) );
+    if( temp > est )
+    {
+      for( Index i = 0; i < (Index)n; ++i ){ v[i] = x[i]; }
+      est = temp;
+    }
+
+    return est;
+  }
+
+}// namespace _n_Impl
+
+/// <summary>
+/// Estimates the reciprocal of the condition number of a real n by n
+/// matrix A, in either the one norm or the infinity norm, from its LU
+/// factorization as computed by <see cref="Mat_Fctr_LU"/>:
+///
+///    rcond = 1 / ( norm(A) * norm(inv(A)) ),
+///
+/// where anorm is norm(A) of the matrix before it was factored, as
+/// <see cref="Mat_Norm"/> returns it for the same normType.
+///
+/// norm(inv(A)) is estimated by the method of Hager and Higham from a
+/// few solves with L and U, so the estimate takes O(n*n) operations,
+/// against O(n*n*n) for the factorization itself: cheap enough to
+/// decide from at run time, e.g. whether the lower precision of
+/// <see cref="Mat_Solv_Refined"/> is safe, which it is while rcond
+/// stays well above the epsilon of that precision.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dgecon</c>, with <c>dlacn2</c>.
+///
+/// The solves are <see cref="Tri_Solv_Vec"/> without the scaling of
+/// <c>dlatrs</c>; if norm(inv(A)) overflows, rcond is zero. The pivots
+/// are not needed, as they do not change either norm.
+///
+/// work must hold <see cref="Mat_RCond_LU_WorkSize"/>( n ) elements.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && ! isPacked< Lyt > && ! isRfp< Lyt > && ! isTileMajor< Lyt >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr Decay<DerefTypeOf<T_Blk_A>> Mat_RCond_LU(
+  NormType normType,
+  Size n,
+  T_Blk_A A_, Stride A_ld,
+  const Decay<DerefTypeOf<T_Blk_A>> &anorm,
+  T_Arr_work work )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+  if( ( NormType::One != normType ) && ( NormType::Inf != normType ) )
+  { throw BadArgument{ "Mat_RCond_LU", 1 }; }
+  if( A_ld < Lyt::DenseLd( Max( (Size)1, n ), Max( (Size)1, n ) ) )
+  { throw BadArgument{ "Mat_RCond_LU", 4 }; }
+  if( anorm < Scalar{} )
+  { throw BadArgument{ "Mat_RCond_LU", 5 }; }
+
+  // Quick return if possible
+  if( 0 == n ){ return unit< Scalar >; }
+  if( IsZero( anorm ) || IsUndefined( anorm ) ){ return {}; }
+
+  // The one norm of inv(A) is estimated as it is; the infinity norm
+  // as the one norm of inv(~A).
+  const bool onenrm = ( NormType::One == normType );
+
+  // x := inv(A)*x = inv(U)*inv(L)*x, or x := inv(~A)*x
+  auto apply = [&]( auto x, bool trnsp )
+  {
+    if( trnsp != ! onenrm )
+    {
+      Tri_Solv_Vec< Lyt >( Half::Upper, Trnsp::Yes, Diag::NotUnit, n, A_, A_ld, x, 1 );
+      Tri_Solv_Vec< Lyt >( Half::Lower, Trnsp::Yes, Diag::IsUnit, n, A_, A_ld, x, 1 );
+    }
+    else
+    {
+      Tri_Solv_Vec< Lyt >( Half::Lower, Trnsp::No, Diag::IsUnit, n, A_, A_ld, x, 1 );
+      Tri_Solv_Vec< Lyt >( Half::Upper, Trnsp::No, Diag::NotUnit, n, A_, A_ld, x, 1 );
+    }
+  };
+
+  const Scalar ainvnm = _n_Impl::_Aux_NormEst1< Scalar >( n,
+    work, work + n, work + 2*n, apply );
+
+  // Compute the estimate of the reciprocal condition number.
+  if( IsZero( ainvnm ) || ! ( ainvnm <= maxValue< Scalar > ) )
+  { return {}; }
+
+  return ( unit< Scalar >/ainvnm )/anorm;
+}
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
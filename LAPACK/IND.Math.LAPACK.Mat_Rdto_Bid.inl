@@ -83,6 +83,9 @@ constexpr void Mat_Rdto_Bid(
   T_Arr_P_tau P_tau,
   T_Arr_work work )
 {
+  IND_MATH_TRACE_SCOPE( "Mat_Rdto_Bid", m, n, 0,
+    BLAS::_n_Impl::_Trace_Flops_Bid( m, n ), 2.0*m*n*sizeof( *A_ ) );
+
   using Scalar = Decay< DerefTypeOf< T_Blk_A > >;
 
   auto A = [&]( auto i, auto j ) -> auto &
@@ -94,8 +97,8 @@ constexpr void Mat_Rdto_Bid(
   auto A_Col = [&]( auto i, auto j ) -> auto
   { return Lyt::ColPtr( A_, i, j, A_ld ); };
 
-  const Stride A_cs = Lyt::ColStride( A_, A_ld );
-  const Stride A_rs = Lyt::RowStride( A_, A_ld );
+  const auto A_cs = Lyt::ColStride( A_, A_ld );
+  const auto A_rs = Lyt::RowStride( A_, A_ld );
 
   const Scalar one = unit<Scalar>;
   const Scalar zero = {};
@@ -187,6 +190,306 @@ constexpr void Mat_Rdto_Bid(
   }
 }
 
+namespace _n_Impl {
+
+  // Reduces the first nb rows and columns of the m by n matrix A to
+  // upper or lower bidiagonal form, and returns the m by nb matrix X
+  // and the n by nb matrix Y needed to apply the transformation to
+  // the unreduced part of A as
+  //
+  //    A := A - V*(~Y) - X*(~U),
+  //
+  // where V and U hold the vectors of H(0:nb-1) and G(0:nb-1).
+  // Based on dlabrd.
+  template< typename Lyt,
+    typename T_Blk_A,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Arr_Q_tau,
+    typename T_Arr_P_tau,
+    typename T_Blk_X,
+    typename T_Blk_Y >
+  constexpr void _Mat_Rdto_Bid_Pnl(
+    Size m, Size n, Size nb,
+    T_Blk_A A_, Stride A_ld,
+    T_Arr_d d, T_Arr_e e,
+    T_Arr_Q_tau Q_tau,
+    T_Arr_P_tau P_tau,
+    T_Blk_X X_, Stride X_ld,
+    T_Blk_Y Y_, Stride Y_ld )
+  {
+    using Scalar = Decay< DerefTypeOf< T_Blk_A > >;
+
+    auto A = [&]( auto i, auto j ) -> auto &
+    { return Lyt::MatRef( A_, i, j, A_ld ); };
+    auto A_Blk = [&]( auto i, auto j ) -> auto
+    { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+    auto A_Row = [&]( auto i, auto j ) -> auto
+    { return Lyt::RowPtr( A_, i, j, A_ld ); };
+    auto A_Col = [&]( auto i, auto j ) -> auto
+    { return Lyt::ColPtr( A_, i, j, A_ld ); };
+    auto X_Blk = [&]( auto i, auto j ) -> auto
+    { return Lyt::BlkPtr( X_, i, j, X_ld ); };
+    auto X_Row = [&]( auto i, auto j ) -> auto
+    { return Lyt::RowPtr( X_, i, j, X_ld ); };
+    auto X_Col = [&]( auto i, auto j ) -> auto
+    { return Lyt::ColPtr( X_, i, j, X_ld ); };
+    auto Y_Blk = [&]( auto i, auto j ) -> auto
+    { return Lyt::BlkPtr( Y_, i, j, Y_ld ); };
+    auto Y_Row = [&]( auto i, auto j ) -> auto
+    { return Lyt::RowPtr( Y_, i, j, Y_ld ); };
+    auto Y_Col = [&]( auto i, auto j ) -> auto
+    { return Lyt::ColPtr( Y_, i, j, Y_ld ); };
+
+    const auto A_cs = Lyt::ColStride( A_, A_ld );
+    const auto A_rs = Lyt::RowStride( A_, A_ld );
+    const auto X_cs = Lyt::ColStride( X_, X_ld );
+    const auto X_rs = Lyt::RowStride( X_, X_ld );
+    const auto Y_cs = Lyt::ColStride( Y_, Y_ld );
+    const auto Y_rs = Lyt::RowStride( Y_, Y_ld );
+
+    const Scalar one = unit<Scalar>;
+    const Scalar zero = {};
+
+    if( m >= n )
+    {
+      // Reduce to upper bidiagonal form
+
+      for( Index i = 0; i < (Index)nb; ++i )
+      {
+        // Update A(i:m-1,i)
+        Mat_VecMul< Lyt >( Trnsp::No, m-i, i, -one,
+          A_Blk(i,0), A_ld, Y_Row(i,0), Y_rs, one, A_Col(i,i), A_cs );
+        Mat_VecMul< Lyt >( Trnsp::No, m-i, i, -one,
+          X_Blk(i,0), X_ld, A_Col(0,i), A_cs, one, A_Col(i,i), A_cs );
+
+        // Generate reflection H(i) to annihilate A(i+1:m-1,i)
+        Rfl_VecGen< Lyt >( m-i, A(i,i),
+          A_Col( Min(i+1,(Index)m-1 ), i ), A_cs,
+          Q_tau[i] );
+        d[i] = A(i,i);
+
+        if( i < (Index)(n-1) )
+        {
+          const Size r = n-(i+1);
+
+          A(i,i) = one;
+
+          // Compute Y(i+1:n-1,i)
+          Mat_VecMul< Lyt >( Trnsp::Yes, m-i, r, one,
+            A_Blk(i,i+1), A_ld, A_Col(i,i), A_cs, zero, Y_Col(i+1,i), Y_cs );
+          Mat_VecMul< Lyt >( Trnsp::Yes, m-i, i, one,
+            A_Blk(i,0), A_ld, A_Col(i,i), A_cs, zero, Y_Col(0,i), Y_cs );
+          Mat_VecMul< Lyt >( Trnsp::No, r, i, -one,
+            Y_Blk(i+1,0), Y_ld, Y_Col(0,i), Y_cs, one, Y_Col(i+1,i), Y_cs );
+          Mat_VecMul< Lyt >( Trnsp::Yes, m-i, i, one,
+            X_Blk(i,0), X_ld, A_Col(i,i), A_cs, zero, Y_Col(0,i), Y_cs );
+          Mat_VecMul< Lyt >( Trnsp::Yes, i, r, -one,
+            A_Blk(0,i+1), A_ld, Y_Col(0,i), Y_cs, one, Y_Col(i+1,i), Y_cs );
+          Vec_Scale< Lyt >( r, Q_tau[i], Y_Col(i+1,i), Y_cs );
+
+          // Update A(i,i+1:n-1)
+          Mat_VecMul< Lyt >( Trnsp::No, r, i+1, -one,
+            Y_Blk(i+1,0), Y_ld, A_Row(i,0), A_rs, one, A_Row(i,i+1), A_rs );
+          Mat_VecMul< Lyt >( Trnsp::Yes, i, r, -one,
+            A_Blk(0,i+1), A_ld, X_Row(i,0), X_rs, one, A_Row(i,i+1), A_rs );
+
+          // Generate reflection G(i) to annihilate A(i,i+2:n-1)
+          Rfl_VecGen< Lyt >( r, A(i,i+1),
+            A_Row( i, Min(i+2,(Index)n-1) ), A_rs,
+            P_tau[i] );
+          e[i] = A(i,i+1);
+          A(i,i+1) = one;
+
+          // Compute X(i+1:m-1,i)
+          Mat_VecMul< Lyt >( Trnsp::No, m-(i+1), r, one,
+            A_Blk(i+1,i+1), A_ld, A_Row(i,i+1), A_rs, zero, X_Col(i+1,i), X_cs );
+          Mat_VecMul< Lyt >( Trnsp::Yes, r, i+1, one,
+            Y_Blk(i+1,0), Y_ld, A_Row(i,i+1), A_rs, zero, X_Col(0,i), X_cs );
+          Mat_VecMul< Lyt >( Trnsp::No, m-(i+1), i+1, -one,
+            A_Blk(i+1,0), A_ld, X_Col(0,i), X_cs, one, X_Col(i+1,i), X_cs );
+          Mat_VecMul< Lyt >( Trnsp::No, i, r, one,
+            A_Blk(0,i+1), A_ld, A_Row(i,i+1), A_rs, zero, X_Col(0,i), X_cs );
+          Mat_VecMul< Lyt >( Trnsp::No, m-(i+1), i, -one,
+            X_Blk(i+1,0), X_ld, X_Col(0,i), X_cs, one, X_Col(i+1,i), X_cs );
+          Vec_Scale< Lyt >( m-(i+1), P_tau[i], X_Col(i+1,i), X_cs );
+        }
+      }
+    }
+    else
+    {
+      // Reduce to lower bidiagonal form
+
+      for( Index i = 0; i < (Index)nb; ++i )
+      {
+        // Update A(i,i:n-1)
+        Mat_VecMul< Lyt >( Trnsp::No, n-i, i, -one,
+          Y_Blk(i,0), Y_ld, A_Row(i,0), A_rs, one, A_Row(i,i), A_rs );
+        Mat_VecMul< Lyt >( Trnsp::Yes, i, n-i, -one,
+          A_Blk(0,i), A_ld, X_Row(i,0), X_rs, one, A_Row(i,i), A_rs );
+
+        // Generate reflection G(i) to annihilate A(i,i+1:n-1)
+        Rfl_VecGen< Lyt >( n-i, A(i,i),
+          A_Row( i, Min(i+1,(Index)n-1 ) ), A_rs,
+          P_tau[i] );
+        d[i] = A(i,i);
+
+        if( i < (Index)(m-1) )
+        {
+          const Size r = m-(i+1);
+
+          A(i,i) = one;
+
+          // Compute X(i+1:m-1,i)
+          Mat_VecMul< Lyt >( Trnsp::No, r, n-i, one,
+            A_Blk(i+1,i), A_ld, A_Row(i,i), A_rs, zero, X_Col(i+1,i), X_cs );
+          Mat_VecMul< Lyt >( Trnsp::Yes, n-i, i, one,
+            Y_Blk(i,0), Y_ld, A_Row(i,i), A_rs, zero, X_Col(0,i), X_cs );
+          Mat_VecMul< Lyt >( Trnsp::No, r, i, -one,
+            A_Blk(i+1,0), A_ld, X_Col(0,i), X_cs, one, X_Col(i+1,i), X_cs );
+          Mat_VecMul< Lyt >( Trnsp::No, i, n-i, one,
+            A_Blk(0,i), A_ld, A_Row(i,i), A_rs, zero, X_Col(0,i), X_cs );
+          Mat_VecMul< Lyt >( Trnsp::No, r, i, -one,
+            X_Blk(i+1,0), X_ld, X_Col(0,i), X_cs, one, X_Col(i+1,i), X_cs );
+          Vec_Scale< Lyt >( r, P_tau[i], X_Col(i+1,i), X_cs );
+
+          // Update A(i+1:m-1,i)
+          Mat_VecMul< Lyt >( Trnsp::No, r, i, -one,
+            A_Blk(i+1,0), A_ld, Y_Row(i,0), Y_rs, one, A_Col(i+1,i), A_cs );
+          Mat_VecMul< Lyt >( Trnsp::No, r, i+1, -one,
+            X_Blk(i+1,0), X_ld, A_Col(0,i), A_cs, one, A_Col(i+1,i), A_cs );
+
+          // Generate reflection H(i) to annihilate A(i+2:m-1,i)
+          Rfl_VecGen< Lyt >( r, A(i+1,i),
+            A_Col( Min(i+2,(Index)m-1), i ), A_cs,
+            Q_tau[i] );
+          e[i] = A(i+1,i);
+          A(i+1,i) = one;
+
+          // Compute Y(i+1:n-1,i)
+          Mat_VecMul< Lyt >( Trnsp::Yes, r, n-(i+1), one,
+            A_Blk(i+1,i+1), A_ld, A_Col(i+1,i), A_cs, zero, Y_Col(i+1,i), Y_cs );
+          Mat_VecMul< Lyt >( Trnsp::Yes, r, i, one,
+            A_Blk(i+1,0), A_ld, A_Col(i+1,i), A_cs, zero, Y_Col(0,i), Y_cs );
+          Mat_VecMul< Lyt >( Trnsp::No, n-(i+1), i, -one,
+            Y_Blk(i+1,0), Y_ld, Y_Col(0,i), Y_cs, one, Y_Col(i+1,i), Y_cs );
+          Mat_VecMul< Lyt >( Trnsp::Yes, r, i+1, one,
+            X_Blk(i+1,0), X_ld, A_Col(i+1,i), A_cs, zero, Y_Col(0,i), Y_cs );
+          Mat_VecMul< Lyt >( Trnsp::Yes, i+1, n-(i+1), -one,
+            A_Blk(0,i+1), A_ld, Y_Col(0,i), Y_cs, one, Y_Col(i+1,i), Y_cs );
+          Vec_Scale< Lyt >( n-(i+1), Q_tau[i], Y_Col(i+1,i), Y_cs );
+        }
+      }
+    }
+  }
+
+}// namespace _n_Impl
+
+inline constexpr Size Mat_Rdto_Bid_Blk_WorkSize( Size m, Size n, Size nb = Mat_Fctr_BlkSize ) noexcept
+{ return Max( (m+n)*nb, Mat_Rdto_Bid_WorkSize( m, n ) ); }
+
+/// <summary>
+/// Blocked reduction of a general real m by n matrix A to bidiagonal
+/// form, with the same result as <see cref="Mat_Rdto_Bid"/>.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dgebrd</c>.
+///
+/// Each panel of nb rows and columns is reduced with Level-2
+/// operations while the update of the rest of the matrix is
+/// accumulated in an m by nb matrix X and an n by nb matrix Y,
+/// which are then applied with two <see cref="Mat_MatMul"/> calls.
+///
+/// work must hold <see cref="Mat_Rdto_Bid_Blk_WorkSize"/>( m, n, nb ) elements.
+/// If nb &lt; 2 or nb &gt;= min(m,n), this is exactly the unblocked code.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_d,
+  typename T_Arr_e,
+  typename T_Arr_Q_tau,
+  typename T_Arr_P_tau,
+  typename T_Arr_work >
+requires( areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_d>>,
+  Decay<DerefTypeOf<T_Arr_e>>,
+  Decay<DerefTypeOf<T_Arr_Q_tau>>,
+  Decay<DerefTypeOf<T_Arr_P_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr void Mat_Rdto_Bid_Blk(
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_d d, T_Arr_e e,
+  T_Arr_Q_tau Q_tau,
+  T_Arr_P_tau P_tau,
+  T_Arr_work work,
+  Size nb = Mat_Fctr_BlkSize )
+{
+  IND_MATH_TRACE_SCOPE( "Mat_Rdto_Bid_Blk", m, n, nb,
+    BLAS::_n_Impl::_Trace_Flops_Bid( m, n ), 2.0*m*n*sizeof( *A_ ) );
+
+  using Scalar = Decay< DerefTypeOf< T_Blk_A > >;
+
+  auto A = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( A_, i, j, A_ld ); };
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+
+  const Size k = Min( m, n );
+
+  if( ( nb < 2 ) || ( nb >= k ) )
+  { return Mat_Rdto_Bid< Lyt >( m, n, A_, A_ld, d, e, Q_tau, P_tau, work ); }
+
+  const Scalar one = unit<Scalar>;
+
+  const auto X_ = work;
+  const auto Y_ = work + m*nb;
+
+  const Stride X_ld = Lyt::DenseLd( m, nb );
+  const Stride Y_ld = Lyt::DenseLd( n, nb );
+
+  auto X_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( X_, i, j, X_ld ); };
+  auto Y_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( Y_, i, j, Y_ld ); };
+
+  Index i = 0;
+  for( ; i+(Index)nb < (Index)k; i += (Index)nb )
+  {
+    const Size pnl_m = m-i;
+    const Size pnl_n = n-i;
+
+    // Reduce rows and columns i:i+nb-1 to bidiagonal form and return
+    // the matrices X and Y which are needed to update the unreduced
+    // part of the matrix
+    _n_Impl::_Mat_Rdto_Bid_Pnl< Lyt >( pnl_m, pnl_n, nb,
+      A_Blk(i,i), A_ld, d+i, e+i, Q_tau+i, P_tau+i,
+      X_, X_ld, Y_, Y_ld );
+
+    // Update the trailing submatrix A(i+nb:m-1,i+nb:n-1), using an
+    // update of the form:  A := A - V*(~Y) - X*(~U)
+    Mat_MatMul< Lyt >( Trnsp::No, Trnsp::Yes, pnl_m-nb, pnl_n-nb, nb,
+      -one, A_Blk(i+nb,i), A_ld, Y_Blk(nb,0), Y_ld,
+      one, A_Blk(i+nb,i+nb), A_ld );
+    Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, pnl_m-nb, pnl_n-nb, nb,
+      -one, X_Blk(nb,0), X_ld, A_Blk(i,i+nb), A_ld,
+      one, A_Blk(i+nb,i+nb), A_ld );
+
+    // Copy diagonal and off-diagonal elements of B back into A
+    for( Index j = i; j < i+(Index)nb; ++j )
+    {
+      A(j,j) = d[j];
+      if( m >= n ){ A(j,j+1) = e[j]; }else
+      { A(j+1,j) = e[j]; }
+    }
+  }
+
+  // Use unblocked code to reduce the remainder of the matrix
+  Mat_Rdto_Bid< Lyt >( m-i, n-i, A_Blk(i,i), A_ld,
+    d+i, e+i, Q_tau+i, P_tau+i, work );
+}
+
 }// namespace LAPACK
 }// namespace Math
 }// namespace IND
@@ -97,6 +97,10 @@ constexpr void Mat_RotSeq(
   c_Ptr_t c, s_Ptr_t s,
   T_Blk_A A_, Stride A_ld )
 {
+  IND_MATH_TRACE_SCOPE( "Mat_RotSeq", m, n, 0,
+    ( Side::Left == side ) ? 6.0*( m ? m-1 : 0 )*n : 6.0*m*( n ? n-1 : 0 ),
+    ( 2.0*m*n + 2.0*( ( Side::Left == side ) ? m : n ) )*sizeof( *A_ ) );
+
   auto A = [&]( auto i, auto j ) -> auto &
   { return Lyt::MatRef( A_, i, j, A_ld ); };
 
@@ -119,7 +123,7 @@ constexpr void Mat_RotSeq(
           {
             const auto &cj = c[j];
             const auto &sj = s[j];
-            if( ! IsUnit( cj ) || ! IsUnit( sj ) )
+            if( ! IsUnit( cj ) || ! IsZero( sj ) )
             {
               for( Index i = 0; i < (Index)n; ++i )
               {
@@ -136,7 +140,7 @@ constexpr void Mat_RotSeq(
           {
             const auto &cj = c[j];
             const auto &sj = s[j];
-            if( ! IsUnit( cj ) || ! IsUnit( sj ) )
+            if( ! IsUnit( cj ) || ! IsZero( sj ) )
             {
               for( Index i = 0; i < (Index)n; ++i )
               {
@@ -158,7 +162,7 @@ constexpr void Mat_RotSeq(
           {
             const auto &cj = c[j-1];
             const auto &sj = s[j-1];
-            if( ! IsUnit( cj ) || ! IsUnit( sj ) )
+            if( ! IsUnit( cj ) || ! IsZero( sj ) )
             {
               for( Index i = 0; i < (Index)n; ++i )
               {
@@ -175,7 +179,7 @@ constexpr void Mat_RotSeq(
           {
             const auto &cj = c[j-1];
             const auto &sj = s[j-1];
-            if( ! IsUnit( cj ) || ! IsUnit( sj ) )
+            if( ! IsUnit( cj ) || ! IsZero( sj ) )
             {
               for( Index i = 0; i < (Index)n; ++i )
               {
@@ -197,7 +201,7 @@ constexpr void Mat_RotSeq(
             {
               const auto &cj = c[j];
               const auto &sj = s[j];
-              if( ! IsUnit( cj ) || ! IsUnit( sj ) )
+              if( ! IsUnit( cj ) || ! IsZero( sj ) )
               {
                 for( Index i = 0; i < (Index)n; ++i )
                 {
@@ -214,7 +218,7 @@ constexpr void Mat_RotSeq(
             {
               const auto &cj = c[j];
               const auto &sj = s[j];
-              if( ! IsUnit( cj ) || ! IsUnit( sj ) )
+              if( ! IsUnit( cj ) || ! IsZero( sj ) )
               {
                 for( Index i = 0; i < (Index)n; ++i )
                 {
@@ -244,7 +248,7 @@ constexpr void Mat_RotSeq(
           {
             const auto &cj = c[j];
             const auto &sj = s[j];
-            if( ! IsUnit( cj ) || ! IsUnit( sj ) )
+            if( ! IsUnit( cj ) || ! IsZero( sj ) )
             {
               for( Index i = 0; i < (Index)m; ++i )
               {
@@ -261,7 +265,7 @@ constexpr void Mat_RotSeq(
           {
             const auto &cj = c[j];
             const auto &sj = s[j];
-            if( ! IsUnit( cj ) || ! IsUnit( sj ) )
+            if( ! IsUnit( cj ) || ! IsZero( sj ) )
             {
               for( Index i = 0; i < (Index)m; ++i )
               {
@@ -283,7 +287,7 @@ constexpr void Mat_RotSeq(
           {
             const auto &cj = c[j-1];
             const auto &sj = s[j-1];
-            if( ! IsUnit( cj ) || ! IsUnit( sj ) )
+            if( ! IsUnit( cj ) || ! IsZero( sj ) )
             {
               for( Index i = 0; i < (Index)m; ++i )
               {
@@ -300,7 +304,7 @@ constexpr void Mat_RotSeq(
           {
             const auto &cj = c[j-1];
             const auto &sj = s[j-1];
-            if( ! IsUnit( cj ) || ! IsUnit( sj ) )
+            if( ! IsUnit( cj ) || ! IsZero( sj ) )
             {
               for( Index i = 0; i < (Index)m; ++i )
               {
@@ -322,13 +326,13 @@ constexpr void Mat_RotSeq(
           {
             const auto &cj = c[j];
             const auto &sj = s[j];
-            if( ! IsUnit( cj ) || ! IsUnit( sj ) )
+            if( ! IsUnit( cj ) || ! IsZero( sj ) )
             {
               for( Index i = 0; i < (Index)m; ++i )
               {
                 const auto aij = A(i,j);
                 A(i,j) = sj*A(i,n-1) + cj*aij;
-                A(i,n-1) = cj*A(i,n) - sj*aij;
+                A(i,n-1) = cj*A(i,n-1) - sj*aij;
               }
             }
           }
@@ -339,7 +343,7 @@ constexpr void Mat_RotSeq(
           {
             const auto &cj = c[j];
             const auto &sj = s[j];
-            if( ! IsUnit( cj ) || ! IsUnit( sj ) )
+            if( ! IsUnit( cj ) || ! IsZero( sj ) )
             {
               for( Index i = 0; i < (Index)m; ++i )
               {
@@ -356,6 +360,144 @@ constexpr void Mat_RotSeq(
   }
 }
 
+/// <summary>
+/// Default block extent of <see cref="Mat_RotSeq_Wave"/>: the number of
+/// rows (Side::Right) or columns (Side::Left) of A swept through all
+/// queued rotation sequences at a time.
+/// </summary>
+inline constexpr Size Mat_RotSeq_BlkSize = 256;
+
+/// <summary>
+/// Applies k sequences of plane rotations to a real m by n matrix A,
+/// each as in <see cref="Mat_RotSeq"/>, in turn:
+///
+///    A := P(k-1) * ... * P(1) * P(0) * A      (Side::Left)
+///    A := A * ~P(0) * ~P(1) * ... * ~P(k-1)   (Side::Right)
+///
+/// Sequence p is read from c + p*cs_ld and s + p*cs_ld, and all of them
+/// share side, pivot and direct. Rotations with c = 1 and s = 0 are
+/// skipped, so shorter sequences can be queued by padding with those.
+///
+/// The result is that of k successive calls to Mat_RotSeq, rounding
+/// included, but A is traversed once in blocks of nb rows (Side::Right)
+/// or columns (Side::Left) instead of k times in full.
+/// </summary>
+/// <remarks>
+/// Rotations from the right only mix columns, so every row of A can be
+/// carried through all k sequences independently, and likewise for the
+/// columns with rotations from the left. With Pivot::Var, a block is
+/// swept as a wavefront: step t applies rotation t-2p of sequence p for
+/// each p, so that the rotations of one step touch disjoint vector pairs
+/// and only vectors near the front are live. See Van Zee, van de Geijn
+/// and Quintana-Orti, "Restructuring the tridiagonal and bidiagonal QR
+/// algorithms for performance".
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename c_Ptr_t,
+  typename s_Ptr_t,
+  typename T_Blk_A >
+requires( ! isComplex< Decay<DerefTypeOf<c_Ptr_t>> >
+  && areTheSame<
+  Decay<DerefTypeOf<c_Ptr_t>>,
+  Decay<DerefTypeOf<s_Ptr_t>>,
+  Decay<DerefTypeOf<T_Blk_A>> > )
+constexpr void Mat_RotSeq_Wave(
+  Side side, Pivot pivot, Direct direct,
+  Size m, Size n, Size k,
+  c_Ptr_t c, s_Ptr_t s, Stride cs_ld,
+  T_Blk_A A_, Stride A_ld,
+  Size nb = Mat_RotSeq_BlkSize )
+{
+  IND_MATH_TRACE_SCOPE( "Mat_RotSeq_Wave", m, n, k,
+    ( Side::Left == side ) ? 6.0*( m ? m-1 : 0 )*n*k : 6.0*m*( n ? n-1 : 0 )*k,
+    ( 2.0*m*n + 2.0*( ( Side::Left == side ) ? m : n )*k )*sizeof( *A_ ) );
+
+  auto A = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( A_, i, j, A_ld ); };
+
+  const bool left = ( Side::Left == side );
+
+  // z is the order of the rotations, w the extent they leave alone
+  const Size z = left ? m : n;
+  const Size w = left ? n : m;
+
+  // Quick return if possible
+
+  if( z < 2 || 0 == w || 0 == k ){ return; }
+
+  if( 0 == nb ){ nb = w; }
+
+  const Size r = z-1;
+
+  for( Size b0 = 0; b0 < w; b0 += nb )
+  {
+    const Index i0 = (Index)b0;
+    const Index i1 = (Index)Min( b0+nb, w );
+
+    // Applies the q-th rotation (in order of application) of sequence p
+    // to the current block
+    auto Rot = [&]( Size p, Size q )
+    {
+      const Index j = ( Direct::Fwd == direct ) ? (Index)q : (Index)(r-1-q);
+
+      const auto &cj = c[(Index)p*cs_ld + j];
+      const auto &sj = s[(Index)p*cs_ld + j];
+      if( IsUnit( cj ) && IsZero( sj ) ){ return; }
+
+      // The rotation acts on the plane (lo,hi)
+      Index lo, hi;
+      switch( pivot )
+      {
+      default:
+      case Pivot::Var: lo = j; hi = j+1; break;
+      case Pivot::Top: lo = 0; hi = j+1; break;
+      case Pivot::Btm: lo = j; hi = (Index)(z-1); break;
+      }
+
+      if( left )
+      {
+        for( Index i = i0; i < i1; ++i )
+        {
+          const auto ahi = A(hi,i);
+          A(hi,i) = cj*ahi - sj*A(lo,i);
+          A(lo,i) = sj*ahi + cj*A(lo,i);
+        }
+      }
+      else
+      {
+        for( Index i = i0; i < i1; ++i )
+        {
+          const auto aih = A(i,hi);
+          A(i,hi) = cj*aih - sj*A(i,lo);
+          A(i,lo) = sj*aih + cj*A(i,lo);
+        }
+      }
+    };
+
+    if( Pivot::Var == pivot )
+    {
+      // Rotation q of sequence p depends on rotations q-1, q and q+1
+      // of sequence p-1, all of which are applied by step t = q+2p.
+      for( Size t = 0; t < r + 2*(k-1); ++t )
+      {
+        for( Size p = 0; p < k && 2*p <= t; ++p )
+        {
+          if( t-2*p < r ){ Rot( p, t-2*p ); }
+        }
+      }
+    }
+    else
+    {
+      // Every rotation shares the pivot vector, so there is no
+      // wavefront to exploit; the block still stays resident.
+      for( Size p = 0; p < k; ++p )
+      {
+        for( Size q = 0; q < r; ++q ){ Rot( p, q ); }
+      }
+    }
+  }
+}
+
 }// namespace LAPACK
 }// namespace Math
 }// namespace IND
@@ -0,0 +1,347 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+namespace _n_Impl {
+
+  // Whether Mat_SVD first reduces A to its R factor (tall A) or
+  // its L factor (wide A), rather than bidiagonalizing it directly.
+  // This is the crossover of dgesvd, max(m,n) >= 1.6*min(m,n).
+  inline constexpr bool _Mat_SVD_Tall( Size m, Size n ) noexcept
+  { return ( m >= n ) && ( 5*m >= 8*n ); }
+  inline constexpr bool _Mat_SVD_Wide( Size m, Size n ) noexcept
+  { return ( n > m ) && ( 5*n >= 8*m ); }
+
+}// namespace _n_Impl
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Mat_SVD"/>.
+/// </summary>
+inline constexpr Size Mat_SVD_WorkSize( Job job, Size m, Size n ) noexcept
+{
+  const Size k = Min( m, n );
+  if( 0 == k ){ return 0; }
+
+  const bool thin = ( Job::Thin == job );
+
+  // e, tauq and taup
+  Size size = 3*k;
+  Size rest = Bid_SVDQR_WorkSize( k );
+
+  if( _n_Impl::_Mat_SVD_Tall( m, n ) || _n_Impl::_Mat_SVD_Wide( m, n ) )
+  {
+    // tau of the QR or LQ factorization, and its k by k triangle
+    size += k + ( thin ? k*k : 0 );
+    rest = Max( rest, Mat_Rdto_Bid_Blk_WorkSize( k, k ) );
+
+    if( m >= n )
+    {
+      rest = Max( rest, Mat_Fctr_QR_Blk_WorkSize( m, n ) );
+      if( thin ){ rest = Max( rest, Ort_From_QR_Blk_WorkSize( m, n, n ) ); }
+    }
+    else
+    {
+      rest = Max( rest, Mat_Fctr_LQ_Blk_WorkSize( m, n ) );
+      if( thin ){ rest = Max( rest, Ort_From_LQ_Blk_WorkSize( m, n, m ) ); }
+    }
+
+    if( thin )
+    {
+      rest = Max( rest, Ort_From_Bid_Blk_WorkSize( Vect::Q, k, k, k ) );
+      rest = Max( rest, Ort_From_Bid_Blk_WorkSize( Vect::Pt, k, k, k ) );
+    }
+  }
+  else
+  {
+    rest = Max( rest, Mat_Rdto_Bid_Blk_WorkSize( m, n ) );
+
+    if( thin )
+    {
+      rest = Max( rest, Ort_From_Bid_Blk_WorkSize( Vect::Q, m, k, n ) );
+      rest = Max( rest, Ort_From_Bid_Blk_WorkSize( Vect::Pt, k, n, m ) );
+    }
+  }
+
+  return size + rest;
+}
+
+/// <summary>
+/// Singular value decomposition of a real m by n matrix A:
+///
+///    A = U*S*Vt
+///
+/// where S is k by k diagonal, k = min(m,n), with the singular values
+/// of A in decreasing order, U is m by k with orthonormal columns and
+/// Vt is k by n with orthonormal rows.
+///
+/// With Job::None only the singular values are computed, and U and Vt
+/// are not referenced; with Job::Thin the k left and right singular
+/// vectors are returned in U and Vt as well. A is destroyed.
+///
+/// A is bidiagonalized with <see cref="Mat_Rdto_Bid_Blk"/>, and the
+/// bidiagonal SVD taken with <see cref="Bid_SVDQR"/>. When m is
+/// much larger than n (or n much larger than m), A is first reduced to
+/// its triangular QR (or LQ) factor, so that the bidiagonal reduction,
+/// and the rotations of the singular vectors, are only k by k.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dgesvd</c>, with JOBU = JOBVT = 'N'
+/// or 'S'.
+/// </remarks>
+template< typename T_Scalar, typename DefaultLyt = ColMajor >
+requires( ! isComplex< T_Scalar > )
+class Mat_SVD
+{
+public:
+
+  using Scalar = T_Scalar;
+
+  struct Config
+  {
+    typename Bid_SVDQR< Scalar, DefaultLyt >::Config bid = {};
+  };
+
+private:
+
+  Config _config;
+
+public:
+
+  constexpr const Config &config() const noexcept
+  { return this->_config; }
+  constexpr void SetConfig( const Config &config ) noexcept
+  { this->_config = config; }
+
+  IND_NOTHROW_VITAE( Mat_SVD );
+
+  /// <summary>
+  /// Computes the singular values of A into s (min(m,n) elements),
+  /// and for Job::Thin the singular vectors into U and Vt.
+  ///
+  /// work must hold <see cref="Mat_SVD_WorkSize"/>( job, m, n ) elements.
+  /// Returns false if the bidiagonal SVD failed to converge.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Blk_A,
+    typename T_Arr_s,
+    typename T_Blk_U,
+    typename T_Blk_Vt,
+    typename T_Arr_work >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Blk_A> >,
+    Decay< DerefTypeOf<T_Arr_s> >,
+    Decay< DerefTypeOf<T_Blk_U> >,
+    Decay< DerefTypeOf<T_Blk_Vt> >,
+    Decay< DerefTypeOf<T_Arr_work>> >)
+  constexpr bool Solve( Job job,
+    Size m, Size n,
+    T_Blk_A A_, Stride A_ld,
+    T_Arr_s s,
+    T_Blk_U U_, Stride U_ld,
+    T_Blk_Vt Vt_, Stride Vt_ld,
+    T_Arr_work work ) const
+  {
+    IND_MATH_TRACE_SCOPE( "Mat_SVD", m, n, 0, 0, 2.0*m*n*sizeof( Scalar ) );
+
+    if( ( Job::None != job ) && ( Job::Thin != job ) )
+    { throw BadArgument{ "Mat_SVD::Solve", 1 }; }
+
+    const Size k = Min( m, n );
+    if( 0 == k ){ return true; }
+
+    auto A_Blk = [&]( auto i, auto j ) -> auto
+    { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+
+    const Scalar zero = {};
+    const Scalar one = unit<Scalar>;
+
+    const bool thin = ( Job::Thin == job );
+
+    Bid_SVDQR< Scalar, DefaultLyt > BD{};
+    BD.SetConfig( this->_config.bid );
+
+    const T_Arr_work e = work;
+    const T_Arr_work tauq = e + k;
+    const T_Arr_work taup = tauq + k;
+
+    if( _n_Impl::_Mat_SVD_Tall( m, n ) || _n_Impl::_Mat_SVD_Wide( m, n ) )
+    {
+      const bool tall = ( m >= n );
+
+      const T_Arr_work tau = taup + k;
+      const T_Arr_work W_ = tau + k;
+      const T_Arr_work rest = thin ? W_ + k*k : W_;
+
+      const Stride W_ld = Lyt::DenseLd( k, k );
+      auto W_Blk = [&]( auto i, auto j ) -> auto
+      { return Lyt::BlkPtr( W_, i, j, W_ld ); };
+
+      // A = Q*R or A = L*Q
+      if( tall )
+      { Mat_Fctr_QR_Blk< Lyt >( m, n, A_, A_ld, tau, rest ); }
+      else
+      { Mat_Fctr_LQ_Blk< Lyt >( m, n, A_, A_ld, tau, rest ); }
+
+      if( ! thin )
+      {
+        // Zero out the reflectors, and bidiagonalize the triangle in A
+        if( k > 1 )
+        {
+          if( tall )
+          { Mat_Fill< Lyt >( Half::Lower, k-1, k-1, zero, zero, A_Blk(1,0), A_ld ); }
+          else
+          { Mat_Fill< Lyt >( Half::Upper, k-1, k-1, zero, zero, A_Blk(0,1), A_ld ); }
+        }
+
+        Mat_Rdto_Bid_Blk< Lyt >( k, k, A_, A_ld, s, e, tauq, taup, rest );
+        return BD.template Solve< Lyt >( Half::Upper, k, s, e, rest );
+      }
+
+      // Copy the triangle to W, and form the k orthonormal vectors of
+      // the factorization in A
+      if( tall )
+      {
+        Mat_Copy< Lyt >( Half::Upper, Trnsp::No, k, k, A_, A_ld, W_, W_ld );
+        if( k > 1 )
+        { Mat_Fill< Lyt >( Half::Lower, k-1, k-1, zero, zero, W_Blk(1,0), W_ld ); }
+        Ort_From_QR_Blk< Lyt >( m, n, n, A_, A_ld, tau, rest );
+      }
+      else
+      {
+        Mat_Copy< Lyt >( Half::Lower, Trnsp::No, k, k, A_, A_ld, W_, W_ld );
+        if( k > 1 )
+        { Mat_Fill< Lyt >( Half::Upper, k-1, k-1, zero, zero, W_Blk(0,1), W_ld ); }
+        Ort_From_LQ_Blk< Lyt >( m, n, m, A_, A_ld, tau, rest );
+      }
+
+      // SVD of the k by k triangle in W. For tall A, its right vectors
+      // are those of A, and its left vectors are formed in W and then
+      // multiplied by Q; for wide A, the other way around.
+      Mat_Rdto_Bid_Blk< Lyt >( k, k, W_, W_ld, s, e, tauq, taup, rest );
+
+      if( tall )
+      {
+        Mat_Copy< Lyt >( Half::Upper, Trnsp::No, k, k, W_, W_ld, Vt_, Vt_ld );
+        Ort_From_Bid_Blk< Lyt >( Vect::Pt, k, k, k, Vt_, Vt_ld, taup, rest );
+        Ort_From_Bid_Blk< Lyt >( Vect::Q, k, k, k, W_, W_ld, tauq, rest );
+
+        if( ! BD.template Solve< Lyt >( Half::Upper, k, k, k, s, e, Vt_, Vt_ld, W_, W_ld, rest ) )
+        { return false; }
+
+        // U = Q*W
+        Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, m, k, k, one, A_, A_ld, W_, W_ld, zero, U_, U_ld );
+      }
+      else
+      {
+        Mat_Copy< Lyt >( Half::Lower, Trnsp::No, k, k, W_, W_ld, U_, U_ld );
+        Ort_From_Bid_Blk< Lyt >( Vect::Q, k, k, k, U_, U_ld, tauq, rest );
+        Ort_From_Bid_Blk< Lyt >( Vect::Pt, k, k, k, W_, W_ld, taup, rest );
+
+        if( ! BD.template Solve< Lyt >( Half::Upper, k, k, k, s, e, W_, W_ld, U_, U_ld, rest ) )
+        { return false; }
+
+        // Vt = W*Q
+        Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, k, n, k, one, W_, W_ld, A_, A_ld, zero, Vt_, Vt_ld );
+      }
+
+      return true;
+    }
+
+    // Bidiagonalize A directly; B is upper bidiagonal if m >= n
+    // and lower bidiagonal otherwise
+    const T_Arr_work rest = taup + k;
+    const Half half = ( m >= n ) ? Half::Upper : Half::Lower;
+
+    Mat_Rdto_Bid_Blk< Lyt >( m, n, A_, A_ld, s, e, tauq, taup, rest );
+
+    if( ! thin )
+    { return BD.template Solve< Lyt >( half, k, s, e, rest ); }
+
+    // Form the m by k Q in U and the k by n P**T in Vt
+    Mat_Copy< Lyt >( Half::Lower, Trnsp::No, m, k, A_, A_ld, U_, U_ld );
+    Ort_From_Bid_Blk< Lyt >( Vect::Q, m, k, n, U_, U_ld, tauq, rest );
+
+    Mat_Copy< Lyt >( Half::Upper, Trnsp::No, k, n, A_, A_ld, Vt_, Vt_ld );
+    Ort_From_Bid_Blk< Lyt >( Vect::Pt, k, n, m, Vt_, Vt_ld, taup, rest );
+
+    return BD.template Solve< Lyt >( half, k, n, m, s, e, Vt_, Vt_ld, U_, U_ld, rest );
+  }
+
+  /// <summary>
+  /// Computes the singular values of A only, as above.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Blk_A,
+    typename T_Arr_s,
+    typename T_Arr_work >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Blk_A> >,
+    Decay< DerefTypeOf<T_Arr_s> >,
+    Decay< DerefTypeOf<T_Arr_work>> >)
+  constexpr bool Solve( Size m, Size n, T_Blk_A A_, Stride A_ld, T_Arr_s s, T_Arr_work work ) const
+  {
+    return this->template Solve< Lyt >( Job::None, m, n, A_, A_ld, s,
+      (Scalar *)nullptr, 1, (Scalar *)nullptr, 1, work );
+  }
+
+  /// <summary>
+  /// Size of the workspace Solve needs for job on an m by n matrix under the
+  /// current configuration.
+  /// </summary>
+  constexpr Size WorkSize( Job job, Size m, Size n ) const noexcept
+  { return Mat_SVD_WorkSize( job, m, n ); }
+
+  /// <summary>
+  /// Computes the SVD of A as above, with the workspace taken from
+  /// arena.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Blk_A,
+    typename T_Arr_s,
+    typename T_Blk_U,
+    typename T_Blk_Vt >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Blk_A> >,
+    Decay< DerefTypeOf<T_Arr_s> >,
+    Decay< DerefTypeOf<T_Blk_U> >,
+    Decay< DerefTypeOf<T_Blk_Vt> > >)
+  bool Solve( Job job,
+    Size m, Size n,
+    T_Blk_A A_, Stride A_ld,
+    T_Arr_s s,
+    T_Blk_U U_, Stride U_ld,
+    T_Blk_Vt Vt_, Stride Vt_ld,
+    Aux_Arena< Scalar > &arena ) const
+  {
+    typename Aux_Arena< Scalar >::Frame frame{ arena };
+    return this->template Solve< Lyt >( job, m, n, A_, A_ld, s,
+      U_, U_ld, Vt_, Vt_ld, arena.Take( this->WorkSize( job, m, n ) ) );
+  }
+
+  /// <summary>
+  /// Computes the singular values of A only, with the workspace taken
+  /// from arena.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Blk_A,
+    typename T_Arr_s >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Blk_A> >,
+    Decay< DerefTypeOf<T_Arr_s> > >)
+  bool Solve( Size m, Size n, T_Blk_A A_, Stride A_ld, T_Arr_s s, Aux_Arena< Scalar > &arena ) const
+  {
+    return this->template Solve< Lyt >( Job::None, m, n, A_, A_ld, s,
+      (Scalar *)nullptr, 1, (Scalar *)nullptr, 1, arena );
+  }
+};
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
@@ -0,0 +1,422 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Columns added to the sketch of <see cref="Mat_SVD_Rnd"/> and
+/// <see cref="Sym_Eig_Rnd"/> beyond those asked for, unless configured.
+/// </summary>
+inline constexpr Size Mat_SVD_Rnd_Oversample = 10;
+
+/// <summary>
+/// Power iterations of <see cref="Mat_SVD_Rnd"/> and
+/// <see cref="Sym_Eig_Rnd"/>, unless configured.
+/// </summary>
+inline constexpr Size Mat_SVD_Rnd_PowerIts = 2;
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Mat_SVD_Rnd"/> on an m by n matrix held in memory, for
+/// k singular triplets with p columns of oversampling.
+/// </summary>
+inline constexpr Size Mat_SVD_Rnd_WorkSize( Size m, Size n, Size k,
+  Size p = Mat_SVD_Rnd_Oversample ) noexcept
+{
+  const Size l = Min( k+p, Min( m, n ) );
+  if( 0 == l ){ return 0; }
+
+  // Q, the sketch of ~A, the vectors of its SVD, tau and its values
+  Size rest = Mat_SVD_WorkSize( Job::Thin, n, l );
+  rest = Max( rest, Mat_Fctr_QR_Blk_WorkSize( m, l ) );
+  rest = Max( rest, Ort_From_QR_Blk_WorkSize( m, l, l ) );
+  rest = Max( rest, Mat_Fctr_QR_Blk_WorkSize( n, l ) );
+  rest = Max( rest, Ort_From_QR_Blk_WorkSize( n, l, l ) );
+  return m*l + 2*n*l + l*l + 2*l + rest;
+}
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Mat_SVD_Rnd"/> on a matrix kept out of core in a store
+/// of r rows and c columns, read nb columns at a time, as the matrix
+/// or as its transpose.
+/// </summary>
+inline constexpr Size Mat_SVD_Rnd_OOC_WorkSize( Size r, Size c, Size k,
+  Size p = Mat_SVD_Rnd_Oversample, Size nb = Mat_Fctr_OOC_PnlSize ) noexcept
+{
+  return 2*r*nb + Max( Mat_SVD_Rnd_WorkSize( r, c, k, p ), Mat_SVD_Rnd_WorkSize( c, r, k, p ) );
+}
+
+namespace _n_Impl {
+
+  // Fills the m by n block X with independent standard normal entries,
+  // by Box-Muller on an xorshift stream started from seed.
+  template< typename Lyt, typename T_Blk_X >
+  void _Rnd_Gauss( Size m, Size n, T_Blk_X X_, Stride X_ld, std::uint32_t seed )
+  {
+    using Scalar = Decay< DerefTypeOf< T_Blk_X > >;
+
+    if( 0 == seed ){ seed = 0x2545F491u; }
+    auto Uniform = [&]() -> double
+    {
+      seed ^= seed << 13;
+      seed ^= seed >> 17;
+      seed ^= seed << 5;
+      return ( (double)( seed >> 8 ) + 1.0 )/16777216.0;
+    };
+
+    const double twoPi = 6.283185307179586;
+    for( Index j = 0; j < (Index)n; ++j )
+    {
+      for( Index i = 0; i < (Index)m; ++i )
+      {
+        const double r = std::sqrt( -2.0*std::log( Uniform() ) );
+        Lyt::MatRef( X_, i, j, X_ld ) = (Scalar)( r*std::cos( twoPi*Uniform() ) );
+      }
+    }
+  }
+
+  // Range finder of the randomized drivers. On output the m by l Y
+  // holds orthonormal columns Q spanning, approximately, the leading
+  // l left singular vectors of the m by n matrix A, seen only through
+  // AX( X_, Y_ ), Y := A*X for n by l X, and AtY( Y_, Z_ ), Z := (~A)*Y.
+  // Z, n by l, is overwritten; tau holds l elements and rest the
+  // workspace of the QR factorizations of both.
+  template< typename Lyt, typename T_Scalar, typename T_AX, typename T_AtY >
+  void _Rnd_Range( Size m, Size n, Size l, Size q, std::uint32_t seed,
+    T_Scalar *Y_, Stride Y_ld, T_Scalar *Z_, Stride Z_ld,
+    T_Scalar *tau, T_Scalar *rest, T_AX &&AX, T_AtY &&AtY )
+  {
+    auto Orth = [&]( Size r, T_Scalar *Q_, Stride Q_ld )
+    {
+      Mat_Fctr_QR_Blk< Lyt >( r, l, Q_, Q_ld, tau, rest );
+      Ort_From_QR_Blk< Lyt >( r, l, l, Q_, Q_ld, tau, rest );
+    };
+
+    _Rnd_Gauss< Lyt >( n, l, Z_, Z_ld, seed );
+    AX( Z_, Y_ );
+
+    // Each pass multiplies by A*(~A), re-orthonormalizing in between
+    // so that the smaller directions are not lost to rounding
+    for( Size it = 0; it < q; ++it )
+    {
+      Orth( m, Y_, Y_ld );
+      AtY( Y_, Z_ );
+      Orth( n, Z_, Z_ld );
+      AX( Z_, Y_ );
+    }
+
+    Orth( m, Y_, Y_ld );
+  }
+
+}// namespace _n_Impl
+
+/// <summary>
+/// Truncated singular value decomposition of a real m by n matrix A
+/// by random sketching:
+///
+///    A ~ U*S*Vt
+///
+/// where S is k by k diagonal with the k leading singular values of A
+/// in decreasing order, U is m by k and Vt is k by n, with orthonormal
+/// columns and rows.
+///
+/// A is multiplied by an n by l Gaussian matrix, l = k+config().p, and
+/// config().q power iterations with A*(~A) sharpen the sketch, each
+/// product re-orthonormalized with <see cref="Mat_Fctr_QR_Blk"/> and
+/// <see cref="Ort_From_QR_Blk"/>. The orthonormal basis Q of the
+/// sketch then gives the l by n B = (~Q)*A, whose SVD is taken
+/// with <see cref="Mat_SVD"/> and mapped back through Q. A is only
+/// touched by <see cref="Mat_MatMul"/>, 2*q+2 times in all, and is
+/// not modified.
+///
+/// The matrix may instead be kept out of core in a
+/// <see cref="PanelStore"/>, which is then read panel by panel in
+/// each of the products, the next panel on another thread while the
+/// current one is used; with the store holding ~A, its panels are
+/// row blocks of A, so that a tall A is streamed through memory a
+/// few rows at a time.
+/// </summary>
+/// <remarks>
+/// Based on the randomized range finder with power iterations and the
+/// direct SVD of Halko, Martinsson and Tropp, "Finding Structure with
+/// Randomness" (2011), algorithms 4.4 and 5.1.
+///
+/// The error is close to that of the best rank k approximation when
+/// the singular values decay past k; with slow decay, raising q helps
+/// more than raising p. The Gaussian matrix is drawn from
+/// config().seed, so that the results are reproducible.
+/// </remarks>
+template< typename T_Scalar, typename DefaultLyt = ColMajor >
+requires( ! isComplex< T_Scalar > )
+class Mat_SVD_Rnd
+{
+public:
+
+  using Scalar = T_Scalar;
+
+  struct Config
+  {
+    // Oversampling, and power iterations
+    Size p = Mat_SVD_Rnd_Oversample;
+    Size q = Mat_SVD_Rnd_PowerIts;
+    // Columns of an out of core matrix read at a time
+    Size nb = Mat_Fctr_OOC_PnlSize;
+    std::uint32_t seed = 0x2545F491u;
+    typename Mat_SVD< Scalar, DefaultLyt >::Config svd = {};
+  };
+
+private:
+
+  Config _config;
+
+  // The common part of both Solve: the range finder, then the SVD of
+  // ~B = (~A)*Q, n by l, whose left vectors are the right ones of A
+  template< typename Lyt, typename T_Arr_s, typename T_Blk_U, typename T_Blk_Vt,
+    typename T_AX, typename T_AtY >
+  bool _Solve( Job job, Size m, Size n, Size k,
+    T_Arr_s s, T_Blk_U U_, Stride U_ld, T_Blk_Vt Vt_, Stride Vt_ld,
+    Scalar *work, T_AX &&AX, T_AtY &&AtY ) const
+  {
+    const Scalar zero = {};
+    const Scalar one = unit<Scalar>;
+
+    const Size l = Min( k + this->_config.p, Min( m, n ) );
+
+    const Stride Y_ld = Lyt::DenseLd( m, l );
+    const Stride Z_ld = Lyt::DenseLd( n, l );
+    const Stride Vb_ld = Lyt::DenseLd( l, l );
+
+    Scalar *Y_ = work;
+    Scalar *Z_ = Y_ + m*l;
+    Scalar *Ub_ = Z_ + n*l;
+    Scalar *Vb_ = Ub_ + n*l;
+    Scalar *sl = Vb_ + l*l;
+    Scalar *tau = sl + l;
+    Scalar *rest = tau + l;
+
+    _n_Impl::_Rnd_Range< Lyt >( m, n, l, this->_config.q, this->_config.seed,
+      Y_, Y_ld, Z_, Z_ld, tau, rest, AX, AtY );
+    AtY( Y_, Z_ );
+
+    Mat_SVD< Scalar, DefaultLyt > SVD{};
+    SVD.SetConfig( this->_config.svd );
+    if( ! SVD.template Solve< Lyt >( job, n, l, Z_, Z_ld, sl, Ub_, Z_ld, Vb_, Vb_ld, rest ) )
+    { return false; }
+
+    for( Index i = 0; i < (Index)k; ++i ){ s[i] = sl[i]; }
+    if( Job::None == job ){ return true; }
+
+    // (~B) = Ub*S*Vb, so A ~ Q*B = (Q*(~Vb))*S*(~Ub)
+    Mat_Copy< Lyt >( Half::Both, Trnsp::Yes, n, k, Ub_, Z_ld, Vt_, Vt_ld );
+    Mat_MatMul< Lyt >( Trnsp::No, Trnsp::Yes, m, k, l, one, Y_, Y_ld, Vb_, Vb_ld, zero, U_, U_ld );
+    return true;
+  }
+
+public:
+
+  constexpr const Config &config() const noexcept
+  { return this->_config; }
+  constexpr void SetConfig( const Config &config ) noexcept
+  { this->_config = config; }
+
+  IND_NOTHROW_VITAE( Mat_SVD_Rnd );
+
+  /// <summary>
+  /// Size of the workspace Solve needs for k triplets of an m by n
+  /// matrix in memory under the current configuration.
+  /// </summary>
+  constexpr Size WorkSize( Size m, Size n, Size k ) const noexcept
+  { return Mat_SVD_Rnd_WorkSize( m, n, k, this->_config.p ); }
+
+  /// <summary>
+  /// Size of the workspace Solve needs for k triplets of the matrix in
+  /// store under the current configuration.
+  /// </summary>
+  template< typename T_Store >
+  requires( PanelStore< T_Store > )
+  constexpr Size WorkSize( const T_Store &store, Size k ) const noexcept
+  { return Mat_SVD_Rnd_OOC_WorkSize( store.Rows(), store.Cols(), k, this->_config.p, this->_config.nb ); }
+
+  /// <summary>
+  /// Computes the k leading singular values of A into s, and for
+  /// Job::Thin the singular vectors into the m by k U and the k by n
+  /// Vt. A is not modified.
+  ///
+  /// work must hold <see cref="WorkSize"/>( m, n, k ) elements.
+  /// Returns false if the SVD of the sketch failed to converge.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Blk_A,
+    typename T_Arr_s,
+    typename T_Blk_U,
+    typename T_Blk_Vt >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Blk_A> >,
+    Decay< DerefTypeOf<T_Arr_s> >,
+    Decay< DerefTypeOf<T_Blk_U> >,
+    Decay< DerefTypeOf<T_Blk_Vt> > >)
+  bool Solve( Job job,
+    Size m, Size n, Size k,
+    T_Blk_A A_, Stride A_ld,
+    T_Arr_s s,
+    T_Blk_U U_, Stride U_ld,
+    T_Blk_Vt Vt_, Stride Vt_ld,
+    Scalar *work ) const
+  {
+    const Size l = Min( k + this->_config.p, Min( m, n ) );
+
+    IND_MATH_TRACE_SCOPE( "Mat_SVD_Rnd", m, n, k,
+      ( 4.0*this->_config.q + 4.0 )*m*n*l, ( 2.0*this->_config.q + 2.0 )*m*n*sizeof( Scalar ) );
+
+    if( ( Job::None != job ) && ( Job::Thin != job ) )
+    { throw BadArgument{ "Mat_SVD_Rnd::Solve", 1 }; }
+    if( k > Min( m, n ) )
+    { throw BadArgument{ "Mat_SVD_Rnd::Solve", 4 }; }
+
+    if( 0 == k ){ return true; }
+
+    const Scalar zero = {};
+    const Scalar one = unit<Scalar>;
+
+    const Stride Y_ld = Lyt::DenseLd( m, l );
+    const Stride Z_ld = Lyt::DenseLd( n, l );
+
+    return this->template _Solve< Lyt >( job, m, n, k, s, U_, U_ld, Vt_, Vt_ld, work,
+      [&]( const Scalar *X_, Scalar *Y_ )
+      { Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, m, l, n, one, A_, A_ld, X_, Z_ld, zero, Y_, Y_ld ); },
+      [&]( const Scalar *Y_, Scalar *Z_ )
+      { Mat_MatMul< Lyt >( Trnsp::Yes, Trnsp::No, n, l, m, one, A_, A_ld, Y_, Y_ld, zero, Z_, Z_ld ); } );
+  }
+
+  /// <summary>
+  /// Computes the k leading singular triplets, as above, of the matrix
+  /// A kept out of core in store: A is the matrix of the store for
+  /// Trnsp::No, and its transpose for Trnsp::Yes, in which case the
+  /// panels of config().nb columns of the store are row blocks of A.
+  /// U and Vt are <see cref="ColMajor"/>.
+  ///
+  /// work must hold <see cref="WorkSize"/>( store, k ) elements.
+  /// </summary>
+  template< typename T_Store,
+    typename T_Arr_s,
+    typename T_Blk_U,
+    typename T_Blk_Vt >
+  requires( PanelStore< T_Store >
+    && areTheSame< Scalar,
+    typename T_Store::Scalar,
+    Decay< DerefTypeOf<T_Arr_s> >,
+    Decay< DerefTypeOf<T_Blk_U> >,
+    Decay< DerefTypeOf<T_Blk_Vt> > >)
+  bool Solve( Job job, Trnsp trnsp,
+    T_Store &store, Size k,
+    T_Arr_s s,
+    T_Blk_U U_, Stride U_ld,
+    T_Blk_Vt Vt_, Stride Vt_ld,
+    Scalar *work ) const
+  {
+    const Size r = store.Rows(), c = store.Cols();
+    const bool t = ( Trnsp::No != trnsp );
+    const Size m = t ? c : r;
+    const Size n = t ? r : c;
+    const Size l = Min( k + this->_config.p, Min( m, n ) );
+    const Size nb = this->_config.nb;
+
+    IND_MATH_TRACE_SCOPE( "Mat_SVD_Rnd", m, n, k,
+      ( 4.0*this->_config.q + 4.0 )*m*n*l, ( 2.0*this->_config.q + 2.0 )*m*n*sizeof( Scalar ) );
+
+    if( ( Job::None != job ) && ( Job::Thin != job ) )
+    { throw BadArgument{ "Mat_SVD_Rnd::Solve", 1 }; }
+    if( k > Min( m, n ) )
+    { throw BadArgument{ "Mat_SVD_Rnd::Solve", 4 }; }
+    if( 0 == nb )
+    { throw BadArgument{ "Mat_SVD_Rnd::Solve", 3 }; }
+
+    if( 0 == k ){ return true; }
+
+    const Scalar zero = {};
+    const Scalar one = unit<Scalar>;
+
+    // The two panels of the store, then the workspace of _Solve
+    Scalar *P0_ = work;
+    Scalar *P1_ = P0_ + r*nb;
+    Scalar *rest = P1_ + r*nb;
+    const Stride P_ld = (Stride)r;
+
+    // With M the matrix of the store, and V of l columns,
+    // Gather: W := (~M)*V, each panel making its own rows of W;
+    // Scatter: W := M*V, summed over the panels.
+    auto Gather = [&]( const Scalar *V_, Scalar *W_ )
+    {
+      BLAS::_n_Impl::_Pnl_Sweep( store, c, nb, P0_, P1_, [&]( Size j, Size w, Scalar *P_ )
+      {
+        Mat_MatMul< ColMajor >( Trnsp::Yes, Trnsp::No, w, l, r, one,
+          P_, P_ld, V_, (Stride)r, zero, W_ + j, (Stride)c );
+      } );
+    };
+    auto Scatter = [&]( const Scalar *V_, Scalar *W_ )
+    {
+      Mat_Fill< ColMajor >( Half::Both, r, l, zero, zero, W_, (Stride)r );
+      BLAS::_n_Impl::_Pnl_Sweep( store, c, nb, P0_, P1_, [&]( Size j, Size w, Scalar *P_ )
+      {
+        Mat_MatMul< ColMajor >( Trnsp::No, Trnsp::No, r, l, w, one,
+          P_, P_ld, V_ + j, (Stride)c, one, W_, (Stride)r );
+      } );
+    };
+
+    if( t )
+    { return this->template _Solve< ColMajor >( job, m, n, k, s, U_, U_ld, Vt_, Vt_ld, rest, Gather, Scatter ); }
+    return this->template _Solve< ColMajor >( job, m, n, k, s, U_, U_ld, Vt_, Vt_ld, rest, Scatter, Gather );
+  }
+
+  /// <summary>
+  /// Computes the k leading singular values of A only, as above.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Blk_A,
+    typename T_Arr_s >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Blk_A> >,
+    Decay< DerefTypeOf<T_Arr_s> > >)
+  bool Solve( Size m, Size n, Size k, T_Blk_A A_, Stride A_ld, T_Arr_s s, Scalar *work ) const
+  {
+    return this->template Solve< Lyt >( Job::None, m, n, k, A_, A_ld, s,
+      (Scalar *)nullptr, 1, (Scalar *)nullptr, 1, work );
+  }
+
+  /// <summary>
+  /// Computes the k leading singular triplets of A in memory, as
+  /// above, with the workspace taken from arena.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Blk_A,
+    typename T_Arr_s,
+    typename T_Blk_U,
+    typename T_Blk_Vt >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Blk_A> >,
+    Decay< DerefTypeOf<T_Arr_s> >,
+    Decay< DerefTypeOf<T_Blk_U> >,
+    Decay< DerefTypeOf<T_Blk_Vt> > >)
+  bool Solve( Job job,
+    Size m, Size n, Size k,
+    T_Blk_A A_, Stride A_ld,
+    T_Arr_s s,
+    T_Blk_U U_, Stride U_ld,
+    T_Blk_Vt Vt_, Stride Vt_ld,
+    Aux_Arena< Scalar > &arena ) const
+  {
+    typename Aux_Arena< Scalar >::Frame frame{ arena };
+    return this->template Solve< Lyt >( job, m, n, k, A_, A_ld, s,
+      U_, U_ld, Vt_, Vt_ld, arena.Take( this->WorkSize( m, n, k ) ) );
+  }
+};
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
@@ -0,0 +1,284 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Mat_Fctr_LS"/>.
+/// </summary>
+inline constexpr Size Mat_Fctr_LS_WorkSize( Size m, Size n, Size nb = Mat_Fctr_BlkSize ) noexcept
+{ return ( m >= n ) ? Mat_Fctr_QR_Blk_WorkSize( m, n, nb ) : Mat_Fctr_LQ_Blk_WorkSize( m, n, nb ); }
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Mat_Solv_LS"/> with nrhs right-hand sides.
+/// </summary>
+inline constexpr Size Mat_Solv_LS_WorkSize( Size m, Size n, Size nrhs, Size nb = Mat_Fctr_BlkSize ) noexcept
+{ return Ort_MatMul_QR_WorkSize( Side::Left, Max( m, n ), nrhs, nb ); }
+
+/// <summary>
+/// Factors the real m by n matrix A for <see cref="Mat_Solv_LS"/>:
+/// A = Q*R with <see cref="Mat_Fctr_QR_Blk"/> if m &gt;= n, and
+/// A = L*Q with <see cref="Mat_Fctr_LQ_Blk"/> otherwise. tau must
+/// hold min(m,n) elements.
+///
+/// work must hold <see cref="Mat_Fctr_LS_WorkSize"/>( m, n, nb ) elements.
+/// Returns false if A is not of full rank, i.e. a diagonal element
+/// of R or L is exactly zero.
+/// </summary>
+/// <remarks>
+/// Based on the factorization step of the LAPACK routine <c>dgels</c>.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr bool Mat_Fctr_LS(
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Arr_work work,
+  Size nb = Mat_Fctr_BlkSize )
+{
+  auto A = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( A_, i, j, A_ld ); };
+
+  if( m >= n )
+  { Mat_Fctr_QR_Blk< Lyt >( m, n, A_, A_ld, tau, work, nb ); }
+  else
+  { Mat_Fctr_LQ_Blk< Lyt >( m, n, A_, A_ld, tau, work, nb ); }
+
+  for( Index i = 0; i < (Index)Min( m, n ); ++i )
+  {
+    if( IsZero( A(i,i) ) ){ return false; }
+  }
+  return true;
+}
+
+/// <summary>
+/// Solves the least squares problem min | B - A*X | for m &gt;= n,
+/// or the minimum norm problem min | X | with A*X = B for m &lt; n,
+/// for the nrhs columns of B, with A and tau as returned by
+/// <see cref="Mat_Fctr_LS"/>. A must be of full rank.
+///
+/// B is max(m,n) by nrhs; on input its first m rows hold the
+/// right-hand sides, on output its first n rows hold X. For m &gt; n
+/// the sum of squares of rows n:m-1 of column j is the squared
+/// residual of the j-th solution.
+///
+/// work must hold <see cref="Mat_Solv_LS_WorkSize"/>( m, n, nrhs, nb ) elements.
+/// </summary>
+/// <remarks>
+/// Based on the solution step of the LAPACK routine <c>dgels</c>
+/// with TRANS = 'N'. Q is applied from its reflectors with
+/// <see cref="Ort_MatMul_QR"/> or <see cref="Ort_MatMul_LQ"/>, so that
+/// each batch of right-hand sides costs O(mn) per column, against the
+/// O(mn^2) of the factorization.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Blk_B,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Blk_B>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr void Mat_Solv_LS(
+  Size m, Size n, Size nrhs,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Blk_B B_, Stride B_ld,
+  T_Arr_work work,
+  Size nb = Mat_Fctr_BlkSize )
+{
+  IND_MATH_TRACE_SCOPE( "Mat_Solv_LS", m, n, nrhs,
+    2.0*nrhs*( 2.0*Max( m, n )*Min( m, n ) - 0.5*Min( m, n )*Min( m, n ) ),
+    ( (double)m*n + 2.0*Max( m, n )*nrhs )*sizeof( *B_ ) );
+
+  using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+  auto B_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( B_, i, j, B_ld ); };
+
+  // Quick return if possible
+
+  if( ( 0 == m ) || ( 0 == n ) || ( 0 == nrhs ) )
+  {
+    if( n > 0 ){ Mat_Fill< Lyt >( Half::Both, n, nrhs, Scalar{}, Scalar{}, B_, B_ld ); }
+    return;
+  }
+
+  const Scalar one = unit<Scalar>;
+  const Scalar zero = {};
+
+  if( m >= n )
+  {
+    // B(0:m-1,:) = (~Q)*B(0:m-1,:), then R*X = B(0:n-1,:)
+    Ort_MatMul_QR< Lyt >( Side::Left, Trnsp::Yes, m, nrhs, n,
+      A_, A_ld, tau, B_, B_ld, work, nb );
+    Tri_Solv_Mat< Lyt >( Side::Left, Half::Upper, Trnsp::No, Diag::NotUnit,
+      n, nrhs, one, A_, A_ld, B_, B_ld );
+  }
+  else
+  {
+    // L*Y = B(0:m-1,:), then X = (~Q)*( Y, 0 )
+    Tri_Solv_Mat< Lyt >( Side::Left, Half::Lower, Trnsp::No, Diag::NotUnit,
+      m, nrhs, one, A_, A_ld, B_, B_ld );
+    Mat_Fill< Lyt >( Half::Both, n-m, nrhs, zero, zero, B_Blk(m,0), B_ld );
+    Ort_MatMul_LQ< Lyt >( Side::Left, Trnsp::Yes, n, nrhs, m,
+      A_, A_ld, tau, B_, B_ld, work, nb );
+  }
+}
+
+/// <summary>
+/// Least squares solver for a real m by n matrix A of full rank that
+/// is solved against many batches of right-hand sides.
+///
+/// Factor copies A and factors it once with <see cref="Mat_Fctr_LS"/>;
+/// each Solve then applies <see cref="Mat_Solv_LS"/> to a batch, at
+/// O(mn) per right-hand side. The workspace is either passed in, sized
+/// by <see cref="WorkSize"/>, or taken from an <see cref="Aux_Arena"/>
+/// held by the solver, so that repeated batches do not allocate.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dgels</c>, with TRANS = 'N'.
+/// The factors are kept in a <see cref="Matrix"/>, so DefaultLyt is
+/// ColMajor or RowMajor.
+/// </remarks>
+template< typename T_Scalar, typename DefaultLyt = ColMajor >
+requires( ! isComplex< T_Scalar > )
+class Mat_LS
+{
+public:
+
+  using Scalar = T_Scalar;
+
+  struct Config
+  {
+    // Panel width of the factorization and block width of the
+    // application of Q
+    Size nb = Mat_Fctr_BlkSize;
+  };
+
+private:
+
+  Config _config;
+
+  Matrix< Scalar, DefaultLyt > _A;
+  std::vector< Scalar > _tau;
+
+  Aux_Arena< Scalar > _arena;
+
+  bool _fullRank = false;
+
+public:
+
+  constexpr const Config &config() const noexcept
+  { return this->_config; }
+  constexpr void SetConfig( const Config &config ) noexcept
+  { this->_config = config; }
+
+  Mat_LS() = default;
+  Mat_LS( const Mat_LS & ) = default;
+  Mat_LS( Mat_LS && ) noexcept = default;
+  Mat_LS &operator = ( const Mat_LS & ) = default;
+  Mat_LS &operator = ( Mat_LS && ) noexcept = default;
+  ~Mat_LS() = default;
+
+  Size Rows() const noexcept
+  { return this->_A.Rows(); }
+  Size Cols() const noexcept
+  { return this->_A.Cols(); }
+
+  /// <summary>
+  /// Whether the last factored matrix was of full rank, which Solve
+  /// requires.
+  /// </summary>
+  bool IsFullRank() const noexcept
+  { return this->_fullRank; }
+
+  /// <summary>
+  /// Size of the workspace Solve needs for nrhs right-hand sides.
+  /// </summary>
+  Size WorkSize( Size nrhs ) const noexcept
+  { return Mat_Solv_LS_WorkSize( this->Rows(), this->Cols(), nrhs, this->_config.nb ); }
+
+  /// <summary>
+  /// Copies the m by n matrix A, stored in layout Lyt, and factors it,
+  /// replacing any earlier factorization. Returns false if A is not of
+  /// full rank.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Blk_A >
+  requires( areTheSame< Scalar, Decay< DerefTypeOf<T_Blk_A> > > )
+  bool Factor( Size m, Size n, T_Blk_A A_, Stride A_ld )
+  {
+    this->_A = Matrix< Scalar, DefaultLyt >{ m, n };
+    this->_tau.assign( Min( m, n ), Scalar{} );
+
+    Mat_Copy< Lyt, DefaultLyt >( m, n, A_, A_ld, this->_A.Ptr(), this->_A.Ld() );
+
+    typename Aux_Arena< Scalar >::Frame frame{ this->_arena };
+    this->_fullRank = Mat_Fctr_LS< DefaultLyt >( m, n,
+      this->_A.Ptr(), this->_A.Ld(), this->_tau.data(),
+      this->_arena.Take( Mat_Fctr_LS_WorkSize( m, n, this->_config.nb ) ), this->_config.nb );
+    return this->_fullRank;
+  }
+
+  /// <summary>
+  /// Overwrites the first Cols() rows of the max(Rows(),Cols()) by
+  /// nrhs matrix B with the solutions for its first Rows() rows, as
+  /// <see cref="Mat_Solv_LS"/> does.
+  ///
+  /// work must hold <see cref="WorkSize"/>( nrhs ) elements.
+  /// Returns false, with B unchanged, if there is no factorization of
+  /// full rank.
+  /// </summary>
+  /// <remarks>
+  /// Not const: the application of Q writes to the factors and
+  /// restores them, so one solver must not be shared between threads.
+  /// </remarks>
+  template< typename T_Blk_B,
+    typename T_Arr_work >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Blk_B> >,
+    Decay< DerefTypeOf<T_Arr_work> > > )
+  bool Solve( Size nrhs, T_Blk_B B_, Stride B_ld, T_Arr_work work )
+  {
+    if( ! this->_fullRank ){ return false; }
+
+    Mat_Solv_LS< DefaultLyt >( this->Rows(), this->Cols(), nrhs,
+      this->_A.Ptr(), this->_A.Ld(), this->_tau.data(),
+      B_, B_ld, work, this->_config.nb );
+    return true;
+  }
+
+  /// <summary>
+  /// Solves as above, with the workspace taken from the solver's arena.
+  /// </summary>
+  template< typename T_Blk_B >
+  requires( areTheSame< Scalar, Decay< DerefTypeOf<T_Blk_B> > > )
+  bool Solve( Size nrhs, T_Blk_B B_, Stride B_ld )
+  {
+    typename Aux_Arena< Scalar >::Frame frame{ this->_arena };
+    return this->Solve( nrhs, B_, B_ld, this->_arena.Take( this->WorkSize( nrhs ) ) );
+  }
+};
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
@@ -4,6 +4,51 @@ namespace IND {
 namespace Math {
 namespace LAPACK {
 
+namespace _n_Impl {
+
+  // For Vect::Q with m < k, shifts the vectors which define the
+  // elementary reflectors one column to the right, and sets the first
+  // row and column of Q to those of the unit matrix; for Vect::Pt with
+  // k >= n, shifts them one row downward, and sets the first row and
+  // column of P**T to those of the unit matrix. In either case the
+  // matrix is n by n, and the reflectors are then those of the QR or
+  // LQ factorization of A(1:n-1,1:n-1).
+  template< typename Lyt,
+    typename T_Blk_A >
+  constexpr void _Ort_From_Bid_Shift( Vect vect, Size n, T_Blk_A A_, Stride A_ld )
+  {
+    using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+    auto A = [&]( auto i, auto j ) -> auto &
+    { return Lyt::MatRef( A_, i, j, A_ld ); };
+    auto A_Row = [&]( auto i, auto j ) -> auto
+    { return Lyt::RowPtr( A_, i, j, A_ld ); };
+    auto A_Col = [&]( auto i, auto j ) -> auto
+    { return Lyt::ColPtr( A_, i, j, A_ld ); };
+
+    const auto A_rs = Lyt::RowStride( A_, A_ld );
+    const auto A_cs = Lyt::ColStride( A_, A_ld );
+
+    A(0,0) = unit<Scalar>;
+    if( n > 1 )
+    {
+      if( Vect::Q == vect )
+      {
+        for( Index j = (Index)(n-1); j >= 1; --j )
+        { Vec_Copy< Lyt >( n-(j+1), A_Col(j+1,j-1), A_cs, A_Col(j+1,j), A_cs ); }
+      }
+      else
+      {
+        for( Index i = (Index)(n-1); i >= 1; --i )
+        { Vec_Copy< Lyt >( n-(i+1), A_Row(i-1,i+1), A_rs, A_Row(i,i+1), A_rs ); }
+      }
+      Vec_Zero< Lyt >( n-1, A_Row(0,1), A_rs );
+      Vec_Zero< Lyt >( n-1, A_Col(1,0), A_cs );
+    }
+  }
+
+}// namespace _n_Impl
+
 inline constexpr Size Ort_From_Bid_WorkSize( Vect vect, Size m, Size n, Size k ) noexcept
 {
   if( Vect::Q == vect )
@@ -35,22 +80,8 @@ constexpr void Ort_From_Bid( Vect vect,
   T_Arr_tau tau,
   T_Arr_work work )
 {
-   using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
-
-   auto A = [&]( auto i, auto j ) -> auto &
-   { return Lyt::MatRef( A_, i, j, A_ld ); };
    auto A_Blk = [&]( auto i, auto j ) -> auto
    { return Lyt::BlkPtr( A_, i, j, A_ld ); };
-   auto A_Row = [&]( auto i, auto j ) -> auto
-   { return Lyt::RowPtr( A_, i, j, A_ld ); };
-   auto A_Col = [&]( auto i, auto j ) -> auto
-   { return Lyt::ColPtr( A_, i, j, A_ld ); };
-
-   const Scalar zero = {};
-   const Scalar one = unit<Scalar>;
-
-   const Stride A_rs = Lyt::RowStride( A_, A_ld );
-   const Stride A_cs = Lyt::ColStride( A_, A_ld );
 
    switch( vect )
    {
@@ -74,15 +105,9 @@ constexpr void Ort_From_Bid( Vect vect,
          // column to the right, and set the first row and column of Q
          // to those of the unit matrix.
 
-         A(0,0) = one;
+         _n_Impl::_Ort_From_Bid_Shift< Lyt >( vect, m, A_, A_ld );
          if( m > 1 )
-         {
-           for( Index j = (Index)(m-1); j >= 1; --j )
-           { Vec_Copy< Lyt >( m-(j+1), A_Col(j+1,j-1), A_cs, A_Col(j+1,j), A_cs ); }
-           Vec_Zero< Lyt >( m-1, A_Row(0,1), A_rs );
-           Vec_Zero< Lyt >( m-1, A_Col(1,0), A_cs );
-           Ort_From_QR< Lyt >( m-1, m-1, m-1, A_Blk(1,1), A_ld, tau, work );
-         }
+         { Ort_From_QR< Lyt >( m-1, m-1, m-1, A_Blk(1,1), A_ld, tau, work ); }
        }
      }
      break;
@@ -101,21 +126,92 @@ constexpr void Ort_From_Bid( Vect vect,
          // row downward, and set the first row and column of P**T to
          // those of the unit matrix.
 
-         A(0,0) = one;
+         _n_Impl::_Ort_From_Bid_Shift< Lyt >( vect, n, A_, A_ld );
          if( n > 1 )
-         {
-           for( Index i = (Index)(n-1); i >= 1; --i )
-           { Vec_Copy< Lyt >( n-(i+1), A_Row(i-1,i+1), A_rs, A_Row(i,i+1), A_rs ); }
-           Vec_Zero< Lyt >( n-1, A_Row(0,1), A_rs );
-           Vec_Zero< Lyt >( n-1, A_Col(1,0), A_cs );
-           Ort_From_LQ< Lyt >( n-1, n-1, n-1, A_Blk(1,1), A_ld, tau, work );
-         }
+         { Ort_From_LQ< Lyt >( n-1, n-1, n-1, A_Blk(1,1), A_ld, tau, work ); }
        }
      }
      break;
    }
 }
 
+inline constexpr Size Ort_From_Bid_Blk_WorkSize( Vect vect, Size m, Size n, Size k, Size nb = Mat_Fctr_BlkSize ) noexcept
+{
+  if( Vect::Q == vect )
+  { return Ort_From_QR_Blk_WorkSize( m, n, k, nb ); }
+  else if( Vect::Pt == vect )
+  { return Ort_From_LQ_Blk_WorkSize( m, n, k, nb ); }
+
+  return 0;
+}
+
+/// <summary>
+/// Blocked generation of Q or P**T, with the same result as
+/// <see cref="Ort_From_Bid"/>.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dorgbr</c>, on top of
+/// <see cref="Ort_From_QR_Blk"/> and <see cref="Ort_From_LQ_Blk"/>.
+///
+/// work must hold <see cref="Ort_From_Bid_Blk_WorkSize"/>( vect, m, n, k, nb ) elements.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+ && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr void Ort_From_Bid_Blk( Vect vect,
+  Size m, Size n, Size k,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Arr_work work,
+  Size nb = Mat_Fctr_BlkSize )
+{
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+
+  switch( vect )
+  {
+  default:
+    {
+      throw BadArgument{ "Ort_From_Bid_Blk", 1 };
+    }
+    break;
+
+  case Vect::Q:
+    {
+      if( m >= k )
+      { Ort_From_QR_Blk< Lyt >( m, n, k, A_, A_ld, tau, work, nb ); }
+      else
+      {
+        // If m < k, assume m = n
+        _n_Impl::_Ort_From_Bid_Shift< Lyt >( vect, m, A_, A_ld );
+        if( m > 1 )
+        { Ort_From_QR_Blk< Lyt >( m-1, m-1, m-1, A_Blk(1,1), A_ld, tau, work, nb ); }
+      }
+    }
+    break;
+
+  case Vect::Pt:
+    {
+      if( k < n )
+      { Ort_From_LQ_Blk< Lyt >( m, n, k, A_, A_ld, tau, work, nb ); }
+      else
+      {
+        // If k >= n, assume m = n
+        _n_Impl::_Ort_From_Bid_Shift< Lyt >( vect, n, A_, A_ld );
+        if( n > 1 )
+        { Ort_From_LQ_Blk< Lyt >( n-1, n-1, n-1, A_Blk(1,1), A_ld, tau, work, nb ); }
+      }
+    }
+    break;
+  }
+}
+
 }// namespace LAPACK
 }// namespace Math
 }// namespace IND
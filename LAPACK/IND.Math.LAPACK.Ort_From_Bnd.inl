@@ -0,0 +1,114 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+inline constexpr Size Ort_From_Bnd_WorkSize( Size n, Size kd, Size nb = Mat_Fctr_BlkSize ) noexcept
+{ return _n_Impl::_Aux_FctrBlk_WorkSize( n-Min( n, kd ), nb ); }
+
+/// <summary>
+/// Generates the real orthogonal matrix Q of order n which is defined
+/// as the product of n-kd elementary reflectors, as returned by
+/// <see cref="Sym_Rdto_Bnd"/>:
+///
+///    Q = H(0) H(1) . . . H(n-kd-1).
+///
+/// The reflectors are shifted kd columns to the right, the first kd
+/// rows and columns of Q are set to those of the unit matrix, and
+/// Q(kd:n-1,kd:n-1) is generated by <see cref="Ort_From_QR_Blk"/>
+/// through the execution context exec (see <see cref="ExecContext"/>).
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dorgtr</c>.
+///
+/// work must hold <see cref="Ort_From_Bnd_WorkSize"/>( n, kd, nb ) elements.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Arr_work,
+  typename T_Exec >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> >
+  && ExecContext< Decay<T_Exec> > )
+constexpr void Ort_From_Bnd(
+  Size n, Size kd,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Arr_work work,
+  T_Exec &&exec,
+  Size nb = Mat_Fctr_BlkSize )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+  auto A = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( A_, i, j, A_ld ); };
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+
+  if( 0 == kd ){ throw BadArgument{ "Ort_From_Bnd", 2 }; }
+
+  // Quick return if possible
+  if( 0 == n ){ return; }
+
+  const Scalar zero = {};
+  const Scalar one = unit<Scalar>;
+
+  kd = Min( kd, n );
+
+  // Shift the vectors which define the elementary reflectors kd
+  // columns to the right, and set the first kd rows and columns of Q
+  // to those of the unit matrix
+  for( Index j = (Index)(n-1); j >= (Index)kd; --j )
+  {
+    for( Index i = 0; i < (Index)kd; ++i ){ A(i,j) = zero; }
+    for( Index i = j+1; i < (Index)n; ++i )
+    { A(i,j) = A(i,j-(Index)kd); }
+  }
+  for( Index j = 0; j < (Index)kd; ++j )
+  {
+    for( Index i = 0; i < (Index)n; ++i ){ A(i,j) = zero; }
+    A(j,j) = one;
+  }
+
+  const Size nq = n-kd;
+  Ort_From_QR_Blk< Lyt >( nq, nq, nq, A_Blk(kd,kd), A_ld, tau, work, exec, nb );
+}
+
+/// <summary>
+/// Generates the orthogonal matrix Q of <see cref="Sym_Rdto_Bnd"/> as
+/// the overload above does, on the calling thread.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dorgtr</c>.
+///
+/// work must hold <see cref="Ort_From_Bnd_WorkSize"/>( n, kd, nb ) elements.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr void Ort_From_Bnd(
+  Size n, Size kd,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Arr_work work,
+  Size nb = Mat_Fctr_BlkSize )
+{ Ort_From_Bnd< Lyt >( n, kd, A_, A_ld, tau, work, Exec_Seq{}, nb ); }
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
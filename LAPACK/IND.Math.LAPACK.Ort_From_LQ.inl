@@ -55,13 +55,13 @@ constexpr void Ort_From_LQ(
   const Scalar one = unit<Scalar>;
   const Scalar zero = {};
 
-  const Stride A_rs = Lyt::RowStride( A_, A_ld );
+  const auto A_rs = Lyt::RowStride( A_, A_ld );
 
-  // Initialise rows k+1:m-1 to rows of the unit matrix
+  // Initialise rows k:m-1 to rows of the unit matrix
 
   for( Index j = 0; j < (Index)n; ++j )
   {
-    for( Index h = k+1; h < (Index)m; ++h )
+    for( Index h = (Index)k; h < (Index)m; ++h )
     { A(h,j) = zero; }
     if( ( j > (Index)(k-1) ) && ( j < (Index)m ) )
     { A(j,j) = one; }
@@ -86,6 +86,90 @@ constexpr void Ort_From_LQ(
   }
 }
 
+inline constexpr Size Ort_From_LQ_Blk_WorkSize( Size m, Size n, Size k, Size nb = Mat_Fctr_BlkSize ) noexcept
+{
+  IND_NOT_USED( n );
+  IND_NOT_USED( k );
+  return _n_Impl::_Aux_FctrBlk_WorkSize( m, nb );
+}
+
+/// <summary>
+/// Blocked generation of the m by n matrix Q, with the same result
+/// as <see cref="Ort_From_LQ"/>.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dorglq</c>.
+///
+/// work must hold <see cref="Ort_From_LQ_Blk_WorkSize"/>( m, n, k, nb ) elements.
+/// If nb &lt; 2 or nb &gt;= k, this is exactly the unblocked code.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr void Ort_From_LQ_Blk(
+  Size m, Size n, Size k,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Arr_work work,
+  Size nb = Mat_Fctr_BlkSize )
+{
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+  auto A_Row = [&]( auto i, auto j ) -> auto
+  { return Lyt::RowPtr( A_, i, j, A_ld ); };
+
+  if( n < m ){ throw BadArgument{ "Ort_From_LQ_Blk", 2 }; }
+  if( k > m ){ throw BadArgument{ "Ort_From_LQ_Blk", 3 }; }
+
+  if( ( nb < 2 ) || ( nb >= k ) )
+  { return Ort_From_LQ< Lyt >( m, n, k, A_, A_ld, tau, work ); }
+
+  const auto A_rs = Lyt::RowStride( A_, A_ld );
+
+  const auto T_ = work;
+  const auto W_ = work + nb*nb;
+
+  const Stride T_ld = Lyt::DenseLd( nb, nb );
+  const Stride W_ld = Lyt::DenseLd( m, nb );
+
+  // Rows k:m-1 are rows of the unit matrix
+  Ort_From_LQ< Lyt >( m-k, n-k, 0, A_Blk(k,k), A_ld, tau, W_ );
+  for( Index i = (Index)k; i < (Index)m; ++i )
+  { Vec_Zero< Lyt >( k, A_Row(i,0), A_rs ); }
+
+  // Use blocked code, starting from the last panel
+  for( Index i = (Index)(((k-1)/nb)*nb); i >= 0; i -= (Index)nb )
+  {
+    const Size ib = Min( nb, k-(Size)i );
+
+    if( (Size)i+ib < m )
+    {
+      // Apply ~H(i:i+ib-1) to A(i+ib:m-1,i:n-1) from the right
+      Rfl_BlkGen< Lyt >( Direct::Fwd, Store::ByRow,
+        n-i, ib, A_Blk(i,i), A_ld, tau + i, T_, T_ld );
+      Rfl_BlkMul< Lyt >( Side::Right, Trnsp::Yes, Direct::Fwd, Store::ByRow,
+        m-(i+ib), n-i, ib,
+        A_Blk(i,i), A_ld,
+        T_, T_ld,
+        A_Blk(i+ib,i), A_ld,
+        W_, W_ld );
+    }
+
+    // Apply ~H(i:i+ib-1) to columns i:n-1 of the panel itself
+    Ort_From_LQ< Lyt >( ib, n-i, ib, A_Blk(i,i), A_ld, tau + i, W_ );
+
+    // Set columns 0:i-1 of the panel to zero
+    for( Index h = i; h < i+(Index)ib; ++h )
+    { Vec_Zero< Lyt >( i, A_Row(h,0), A_rs ); }
+  }
+}
+
 }// namespace LAPACK
 }// namespace Math
 }// namespace IND
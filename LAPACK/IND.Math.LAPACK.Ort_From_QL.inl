@@ -7,16 +7,16 @@ namespace LAPACK {
 inline constexpr Size Ort_From_QL_WorkSize( Size m, Size n, Size k ) noexcept
 {
   IND_NOT_USED( m );
-  IND_NOT_USED( n );
-  return k;
+  IND_NOT_USED( k );
+  return n;
 }
 
 /// <summary>
 /// Generates an m by n real matrix Q with orthonormal columns,
-/// which is defined as the first n columns of a product of k elementary
+/// which is defined as the last n columns of a product of k elementary
 /// reflectors of order m.
 ///
-///       Q  =  H(1) H(2) . . . H(k)
+///       Q  =  H(k) . . . H(2) H(1)
 /// </summary>
 /// <remarks>
 /// Based on the LAPACK routine <c>dorg2l</c>.
@@ -53,9 +53,9 @@ constexpr void Ort_From_QL(
   const Scalar zero = {};
   const Scalar one = unit<Scalar>;
 
-  const Stride A_cs = Lyt::ColStride( A_, A_ld );
+  const auto A_cs = Lyt::ColStride( A_, A_ld );
 
-  // Initialise columns 0:n-k to columns of the unit matrix
+  // Initialise columns 0:n-k-1 to columns of the unit matrix
 
   for( Index j = 0; j < (Index)(n-k); ++j )
   {
@@ -66,17 +66,108 @@ constexpr void Ort_From_QL(
 
   for( Index i = 0; i < (Index)k; ++i )
   {
-    Index ii = n-k+i;
+    const Index ii = (Index)(n-k) + i;
+    const Index jj = (Index)(m-n) + ii;
 
-    // Apply H(i) to A(0:(m-k+(i+1))-1,1:(n-k+(i+1))-1) from the left
-    A( m-n+ii, ii ) = one;
-    Rfl_MatMul< Lyt >( Side::Left, i+1, ii,
+    // Apply H(i) to A(0:jj,0:ii-1) from the left
+    A( jj, ii ) = one;
+    Rfl_MatMul< Lyt >( Side::Left, jj+1, ii,
       A_Col( 0, ii ), A_cs, tau[i],
       A_, A_ld, work );
-    Vec_Scale< Lyt >( i, -tau[i], A_Col( 0, ii ), A_cs );
-    A( i, ii ) = one - tau[i];
-    if( i < (Index)(m-1) )
-    { Vec_Zero< Lyt >( m-(i+1), A_Col( i+1, ii ), A_cs ); }
+    Vec_Scale< Lyt >( jj, -tau[i], A_Col( 0, ii ), A_cs );
+    A( jj, ii ) = one - tau[i];
+
+    // Set A(jj+1:m-1,ii) to zero
+    Vec_Zero< Lyt >( m-(jj+1), A_Col( jj+1, ii ), A_cs );
+  }
+}
+
+inline constexpr Size Ort_From_QL_Blk_WorkSize( Size m, Size n, Size k, Size nb = Mat_Fctr_BlkSize ) noexcept
+{
+  IND_NOT_USED( m );
+  IND_NOT_USED( k );
+  return _n_Impl::_Aux_FctrBlk_WorkSize( n, nb );
+}
+
+/// <summary>
+/// Blocked generation of the m by n matrix Q, with the same result
+/// as <see cref="Ort_From_QL"/>.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dorgql</c>.
+///
+/// work must hold <see cref="Ort_From_QL_Blk_WorkSize"/>( m, n, k, nb ) elements.
+/// If nb &lt; 2 or nb &gt;= k, this is exactly the unblocked code.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr void Ort_From_QL_Blk(
+  Size m, Size n, Size k,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Arr_work work,
+  Size nb = Mat_Fctr_BlkSize )
+{
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+  auto A_Col = [&]( auto i, auto j ) -> auto
+  { return Lyt::ColPtr( A_, i, j, A_ld ); };
+
+  if( n > m ){ throw BadArgument{ "Ort_From_QL_Blk", 2 }; }
+  if( k > n ){ throw BadArgument{ "Ort_From_QL_Blk", 3 }; }
+
+  if( ( nb < 2 ) || ( nb >= k ) )
+  { return Ort_From_QL< Lyt >( m, n, k, A_, A_ld, tau, work ); }
+
+  const auto A_cs = Lyt::ColStride( A_, A_ld );
+
+  const auto T_ = work;
+  const auto W_ = work + nb*nb;
+
+  const Stride T_ld = Lyt::DenseLd( nb, nb );
+  const Stride W_ld = Lyt::DenseLd( n, nb );
+
+  // Columns 0:n-k-1 are the last columns of the unit matrix
+  Ort_From_QL< Lyt >( m-k, n-k, 0, A_, A_ld, tau, W_ );
+  for( Index j = 0; j < (Index)(n-k); ++j )
+  { Vec_Zero< Lyt >( k, A_Col(m-k,j), A_cs ); }
+
+  // Use blocked code, starting from the first panel,
+  // which holds the reflectors applied last
+  for( Index i = 0; i < (Index)k; i += (Index)nb )
+  {
+    const Size ib = Min( nb, k-(Size)i );
+
+    // The panel is A(0:r-1,c:c+ib-1)
+    const Size r = m-k+i+ib;
+    const Size c = n-k+i;
+
+    if( c > 0 )
+    {
+      // Apply H(i:i+ib-1) to A(0:r-1,0:c-1) from the left
+      Rfl_BlkGen< Lyt >( Direct::Bwd, Store::ByCol,
+        r, ib, A_Blk(0,c), A_ld, tau + i, T_, T_ld );
+      Rfl_BlkMul< Lyt >( Side::Left, Trnsp::No, Direct::Bwd, Store::ByCol,
+        r, c, ib,
+        A_Blk(0,c), A_ld,
+        T_, T_ld,
+        A_, A_ld,
+        W_, W_ld );
+    }
+
+    // Apply H(i:i+ib-1) to rows 0:r-1 of the panel itself
+    Ort_From_QL< Lyt >( r, ib, ib, A_Blk(0,c), A_ld, tau + i, W_ );
+
+    // Set rows r:m-1 of the panel to zero
+    for( Index j = (Index)c; j < (Index)(c+ib); ++j )
+    { Vec_Zero< Lyt >( m-r, A_Col(r,j), A_cs ); }
   }
 }
 
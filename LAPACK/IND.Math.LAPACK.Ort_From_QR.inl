@@ -51,12 +51,12 @@ constexpr void Ort_From_QR(
 
   if( 0 == n ){ return; }
 
-  const Stride A_cs = Lyt::ColStride( A_, A_ld );
+  const auto A_cs = Lyt::ColStride( A_, A_ld );
 
   const Scalar zero = {};
   const Scalar one = unit<Scalar>;
 
-  // Initialise columns k+1:n-1 to columns of the unit matrix
+  // Initialise columns k:n-1 to columns of the unit matrix
 
   for( Index j = (Index)k; j < (Index)n; ++j )
   {
@@ -82,6 +82,126 @@ constexpr void Ort_From_QR(
   }
 }
 
+inline constexpr Size Ort_From_QR_Blk_WorkSize( Size m, Size n, Size k, Size nb = Mat_Fctr_BlkSize ) noexcept
+{
+  IND_NOT_USED( m );
+  IND_NOT_USED( k );
+  return _n_Impl::_Aux_FctrBlk_WorkSize( n, nb );
+}
+
+/// <summary>
+/// Blocked generation of the m by n matrix Q, with the same result
+/// as <see cref="Ort_From_QR"/>, and each block reflector applied
+/// through the execution context exec (see <see cref="ExecContext"/>).
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dorgqr</c>.
+///
+/// The panels themselves are formed on the caller; the trailing
+/// columns take the exec overload of <see cref="Rfl_BlkMul"/>.
+///
+/// work must hold <see cref="Ort_From_QR_Blk_WorkSize"/>( m, n, k, nb ) elements.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Arr_work,
+  typename T_Exec >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> >
+  && ExecContext< Decay<T_Exec> > )
+constexpr void Ort_From_QR_Blk(
+  Size m, Size n, Size k,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Arr_work work,
+  T_Exec &&exec,
+  Size nb = Mat_Fctr_BlkSize )
+{
+  IND_MATH_TRACE_SCOPE( "Ort_From_QR_Blk", m, n, k,
+    4.0*m*n*k - 2.0*( m + n )*k*k + 4.0/3.0*k*k*k, 2.0*m*n*sizeof( *A_ ) );
+
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+  auto A_Col = [&]( auto i, auto j ) -> auto
+  { return Lyt::ColPtr( A_, i, j, A_ld ); };
+
+  if( n > m ){ throw BadArgument{ "Ort_From_QR_Blk", 2 }; }
+  if( k > n ){ throw BadArgument{ "Ort_From_QR_Blk", 3 }; }
+
+  if( ( nb < 2 ) || ( nb >= k ) )
+  { return Ort_From_QR< Lyt >( m, n, k, A_, A_ld, tau, work ); }
+
+  const auto A_cs = Lyt::ColStride( A_, A_ld );
+
+  const auto T_ = work;
+  const auto W_ = work + nb*nb;
+
+  const Stride T_ld = Lyt::DenseLd( nb, nb );
+  const Stride W_ld = Lyt::DenseLd( n, nb );
+
+  // Columns k:n-1 are columns of the unit matrix
+  Ort_From_QR< Lyt >( m-k, n-k, 0, A_Blk(k,k), A_ld, tau, W_ );
+  for( Index j = (Index)k; j < (Index)n; ++j )
+  { Vec_Zero< Lyt >( k, A_Col(0,j), A_cs ); }
+
+  // Use blocked code, starting from the last panel
+  for( Index i = (Index)(((k-1)/nb)*nb); i >= 0; i -= (Index)nb )
+  {
+    const Size ib = Min( nb, k-(Size)i );
+
+    if( (Size)i+ib < n )
+    {
+      // Apply H(i:i+ib-1) to A(i:m-1,i+ib:n-1) from the left
+      Rfl_BlkGen< Lyt >( Direct::Fwd, Store::ByCol,
+        m-i, ib, A_Blk(i,i), A_ld, tau + i, T_, T_ld );
+      Rfl_BlkMul< Lyt >( Side::Left, Trnsp::No, Direct::Fwd, Store::ByCol,
+        m-i, n-(i+ib), ib,
+        A_Blk(i,i), A_ld,
+        T_, T_ld,
+        A_Blk(i,i+ib), A_ld,
+        W_, W_ld, exec );
+    }
+
+    // Apply H(i:i+ib-1) to rows i:m-1 of the panel itself
+    Ort_From_QR< Lyt >( m-i, ib, ib, A_Blk(i,i), A_ld, tau + i, W_ );
+
+    // Set rows 0:i-1 of the panel to zero
+    for( Index j = i; j < i+(Index)ib; ++j )
+    { Vec_Zero< Lyt >( i, A_Col(0,j), A_cs ); }
+  }
+}
+
+/// <summary>
+/// Blocked generation of the m by n matrix Q, with the same result
+/// as <see cref="Ort_From_QR"/>.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dorgqr</c>.
+///
+/// work must hold <see cref="Ort_From_QR_Blk_WorkSize"/>( m, n, k, nb ) elements.
+/// If nb &lt; 2 or nb &gt;= k, this is exactly the unblocked code.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr void Ort_From_QR_Blk(
+  Size m, Size n, Size k,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Arr_work work,
+  Size nb = Mat_Fctr_BlkSize )
+{ Ort_From_QR_Blk< Lyt >( m, n, k, A_, A_ld, tau, work, Exec_Seq{}, nb ); }
+
 }// namespace LAPACK
 }// namespace Math
 }// namespace IND
@@ -55,7 +55,7 @@ constexpr void Ort_From_RQ(
   const Scalar one = unit<Scalar>;
   const Scalar zero = {};
 
-  const Stride A_rs = Lyt::RowStride( A_, A_ld );
+  const auto A_rs = Lyt::RowStride( A_, A_ld );
 
   if( k < (Index)m )
   {
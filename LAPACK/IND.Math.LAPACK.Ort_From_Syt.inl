@@ -7,6 +7,70 @@ namespace LAPACK {
 inline constexpr Size Ort_From_Syt_WorkSize( Size n ) noexcept
 { return n-1; }
 
+inline constexpr Size Ort_From_Syt_Blk_WorkSize( Size n, Size nb = Mat_Fctr_BlkSize ) noexcept
+{ return _n_Impl::_Aux_FctrBlk_WorkSize( n-1, nb ); }
+
+namespace _n_Impl {
+
+  // Shifts the vectors which define the elementary reflectors, as
+  // returned by Sym_Rdto_Syt, into the positions expected by the
+  // QL (Upper) or QR (Lower) generators, and sets the remaining row
+  // and column of Q to those of the unit matrix.
+  template< typename Lyt, typename T_Blk_A >
+  constexpr void _Ort_From_Syt_Shift( Half half,
+    Size n,
+    T_Blk_A A_, Stride A_ld )
+  {
+    using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+    auto A = [&]( auto i, auto j ) -> auto &
+    { return Lyt::MatRef( A_, i, j, A_ld ); };
+    auto A_Row = [&]( auto i, auto j ) -> auto
+    { return Lyt::RowPtr( A_, i, j, A_ld ); };
+    auto A_Col = [&]( auto i, auto j ) -> auto
+    { return Lyt::ColPtr( A_, i, j, A_ld ); };
+
+    const auto A_rs = Lyt::RowStride( A_, A_ld );
+    const auto A_cs = Lyt::ColStride( A_, A_ld );
+
+    const Scalar zero = {};
+    const Scalar one = unit<Scalar>;
+
+    if( Half::Upper == half )
+    {
+      // Q was determined by a call to DSYTRD with UPLO = 'Upper'
+      //
+      // Shift the vectors which define the elementary reflectors one
+      // column to the left, and set the last row and column of Q to
+      // those of the unit matrix
+
+      for( Index j = 0; j < (Index)(n-1); ++j )
+      { Vec_Copy< Lyt >( j, A_Col(0,j+1), A_cs, A_Col(0,j), A_cs ); }
+      Vec_Zero< Lyt >( n-1, A_Row(n-1,0), A_rs );
+      Vec_Zero< Lyt >( n-1, A_Col(0,n-1), A_cs );
+      A(n-1,n-1) = one;
+    }
+    else if( Half::Lower == half )
+    {
+      // Q was determined by a call to DSYTRD with UPLO = 'Lower'.
+      //
+      // Shift the vectors which define the elementary reflectors one
+      // column to the right, and set the first row and column of Q to
+      // those of the unit matrix
+
+      for( Index j = (Index)(n-1); j >= 1; --j )
+      {
+        A(0,j) = zero;
+        for( Index i = j+1; i < (Index)n; ++i )
+        { A(i,j) = A(i,j-1); }
+      }
+      A(0,0) = one;
+      Vec_Zero< Lyt >( n-1, A_Col(1,0), A_cs );
+    }
+  }
+
+}// namespace _n_Impl
+
 /// <summary>
 /// Generates a real orthogonal matrix Q which is defined as the
 /// product of n-1 elementary reflectors of order N, as returned by
@@ -36,74 +100,65 @@ constexpr void Ort_From_Syt( Half half,
   T_Arr_tau tau,
   T_Arr_work work )
 {
-  using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
-
-  auto A = [&]( auto i, auto j ) -> auto &
-  { return Lyt::MatRef( A_, i, j, A_ld ); };
   auto A_Blk = [&]( auto i, auto j ) -> auto
   { return Lyt::BlkPtr( A_, i, j, A_ld ); };
-  auto A_Row = [&]( auto i, auto j ) -> auto
-  { return Lyt::RowPtr( A_, i, j, A_ld ); };
-  auto A_Col = [&]( auto i, auto j ) -> auto
-  { return Lyt::ColPtr( A_, i, j, A_ld ); };
-
-  const Stride A_rs = Lyt::RowStride( A_, A_ld );
-  const Stride A_cs = Lyt::ColStride( A_, A_ld );
-
-  const Scalar zero = {};
-  const Scalar one = unit<Scalar>;
 
   // Quick return if possible
 
   if( 0 == n ){ return; }
 
+  _n_Impl::_Ort_From_Syt_Shift< Lyt >( half, n, A_, A_ld );
+
+  // Generate Q(0:n-2,0:n-2) or Q(1:n-1,1:n-1)
   if( Half::Upper == half )
-  {
-    // Q was determined by a call to DSYTRD with UPLO = 'Upper'
-    //
-    // Shift the vectors which define the elementary reflectors one
-    // column to the left, and set the last row and column of Q to
-    // those of the unit matrix
-
-    for( Index j = 0; j < (Index)(n-1); ++j )
-    { Vec_Copy< Lyt >( j, A_Col(0,j+1), A_cs, A_Col(0,j), A_cs ); }
-    Vec_Zero< Lyt >( n-1, A_Row(n-1,0), A_rs );
-    Vec_Zero< Lyt >( n-1, A_Col(0,n-1), A_cs );
-    A(n-1,n-1) = one;
-
-    // Generate Q(0:n-2,0:n-2)
-    Ort_From_QL< Lyt >( n-1, n-1, n-1, A_, A_ld, tau, work );
-  }
+  { Ort_From_QL< Lyt >( n-1, n-1, n-1, A_, A_ld, tau, work ); }
   else if( Half::Lower == half )
-  {
-    // Q was determined by a call to DSYTRD with UPLO = 'Lower'.
-    //
-    // Shift the vectors which define the elementary reflectors one
-    // column to the right, and set the first row and column of Q to
-    // those of the unit matrix
+  { Ort_From_QR< Lyt >( n-1, n-1, n-1, A_Blk(1,1), A_ld, tau, work ); }
+}
 
-    for( Index j = (Index)(n-1); j >= 1; --j )
-    {
-      A(0,j) = zero;
-      for( Index i = j+1; i < (Index)n; ++i )
-      { A(i,j) = A(i,j-1); }
-    }
-    A(0,0) = one;
-    Vec_Zero< Lyt >( n-1, A_Col(1,0), A_cs );
-#if 0
-    for( Index j = (Index)(n-1); j >= 1; --j )
-    {
-      for( Index i = j+1; i < (Index)n; ++i )
-      { A(i,j) = A(i,j-1); }
-    }
-    A(0,0) = one;
-    Vec_Zero< Lyt >( n-1, A_Row(0,1), A_rs );
-    Vec_Zero< Lyt >( n-1, A_Col(1,0), A_cs );
-#endif
+/// <summary>
+/// Blocked generation of the orthogonal matrix Q, with the same result
+/// as <see cref="Ort_From_Syt"/>.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dorgtr</c>, on top of
+/// <see cref="Ort_From_QL_Blk"/> and <see cref="Ort_From_QR_Blk"/>.
+///
+/// work must hold <see cref="Ort_From_Syt_Blk_WorkSize"/>( n, nb ) elements.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr void Ort_From_Syt_Blk( Half half,
+  Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Arr_work work,
+  Size nb = Mat_Fctr_BlkSize )
+{
+  IND_MATH_TRACE_SCOPE( "Ort_From_Syt_Blk", n, n, nb,
+    4.0/3.0*n*n*n, 2.0*n*n*sizeof( *A_ ) );
 
-    // Generate Q(0:n-2,0:n-2)
-    Ort_From_QR< Lyt >( n-1, n-1, n-1, A_Blk(1,1), A_ld, tau, work );
-  }
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+
+  // Quick return if possible
+
+  if( 0 == n ){ return; }
+
+  _n_Impl::_Ort_From_Syt_Shift< Lyt >( half, n, A_, A_ld );
+
+  // Generate Q(0:n-2,0:n-2) or Q(1:n-1,1:n-1)
+  if( Half::Upper == half )
+  { Ort_From_QL_Blk< Lyt >( n-1, n-1, n-1, A_, A_ld, tau, work, nb ); }
+  else if( Half::Lower == half )
+  { Ort_From_QR_Blk< Lyt >( n-1, n-1, n-1, A_Blk(1,1), A_ld, tau, work, nb ); }
 }
 
 }// namespace LAPACK
@@ -0,0 +1,109 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Ort_MatMul_Bid"/> on an m by n matrix C.
+/// </summary>
+inline constexpr Size Ort_MatMul_Bid_WorkSize( Side side, Size m, Size n, Size nb = Mat_Fctr_BlkSize ) noexcept
+{ return Ort_MatMul_QR_WorkSize( side, m, n, nb ); }
+
+/// <summary>
+/// Overwrites the real m by n matrix C with Q*C, (~Q)*C, C*Q or
+/// C*(~Q) for vect = Q, or with P*C, (~P)*C, C*P or C*(~P) for
+/// vect = Pt, where Q and ~P are the orthogonal matrices of the
+/// reduction of an nq by k matrix (Vect::Q) or a k by nq matrix
+/// (Vect::Pt) to bidiagonal form by <see cref="Mat_Rdto_Bid"/>,
+/// held in A and tau. nq is m for Side::Left and n for Side::Right.
+///
+/// Neither matrix is formed; use <see cref="Ort_From_Bid"/> for them.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dormbr</c>, on top of
+/// <see cref="Ort_MatMul_QR"/> and <see cref="Ort_MatMul_LQ"/>.
+///
+/// Note that vect = Pt with trnsp = No applies P, the transpose of
+/// the ~P that <see cref="Ort_From_Bid"/> forms.
+///
+/// work must hold <see cref="Ort_MatMul_Bid_WorkSize"/>( side, m, n, nb ) elements.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Blk_C,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+ && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Blk_C>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr void Ort_MatMul_Bid( Vect vect, Side side, Trnsp trnsp,
+  Size m, Size n, Size k,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Blk_C C_, Stride C_ld,
+  T_Arr_work work,
+  Size nb = Mat_Fctr_BlkSize )
+{
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+  auto C_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( C_, i, j, C_ld ); };
+
+  const bool left = ( Side::Left == side );
+
+  // Order of Q or P
+  const Size nq = left ? m : n;
+
+  // Quick return if possible
+
+  if( ( 0 == m ) || ( 0 == n ) ){ return; }
+
+  // For the reflectors shifted by one, C without its first row
+  // (Side::Left) or column (Side::Right)
+  const Size mi = left ? m-1 : m;
+  const Size ni = left ? n : n-1;
+  const auto C1 = left ? C_Blk(1,0) : C_Blk(0,1);
+
+  switch( vect )
+  {
+  default:
+    {
+      throw BadArgument{ "Ort_MatMul_Bid", 1 };
+    }
+    break;
+
+  case Vect::Q:
+    {
+      if( nq >= k )
+      { Ort_MatMul_QR< Lyt >( side, trnsp, m, n, k, A_, A_ld, tau, C_, C_ld, work, nb ); }
+      else if( nq > 1 )
+      { Ort_MatMul_QR< Lyt >( side, trnsp, mi, ni, nq-1, A_Blk(1,0), A_ld, tau, C1, C_ld, work, nb ); }
+    }
+    break;
+
+  case Vect::Pt:
+    {
+      // P = ~( H(k) . . . H(1) ) is the Q of the LQ reflectors transposed
+      const Trnsp Q_trnsp = ( Trnsp::No == trnsp ) ? Trnsp::Yes : Trnsp::No;
+
+      if( nq > k )
+      { Ort_MatMul_LQ< Lyt >( side, Q_trnsp, m, n, k, A_, A_ld, tau, C_, C_ld, work, nb ); }
+      else if( nq > 1 )
+      { Ort_MatMul_LQ< Lyt >( side, Q_trnsp, mi, ni, nq-1, A_Blk(0,1), A_ld, tau, C1, C_ld, work, nb ); }
+    }
+    break;
+  }
+}
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
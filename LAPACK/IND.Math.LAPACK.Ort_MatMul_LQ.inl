@@ -0,0 +1,136 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Ort_MatMul_LQ"/> on an m by n matrix C.
+/// </summary>
+inline constexpr Size Ort_MatMul_LQ_WorkSize( Side side, Size m, Size n, Size nb = Mat_Fctr_BlkSize ) noexcept
+{ return Ort_MatMul_QR_WorkSize( side, m, n, nb ); }
+
+/// <summary>
+/// Overwrites the real m by n matrix C with Q*C, (~Q)*C, C*Q or
+/// C*(~Q), where Q is the product of k elementary reflectors
+///
+///       Q  =  H(k) . . . H(2) H(1)
+///
+/// as returned by <see cref="Mat_Fctr_LQ"/> in the rows of A and in
+/// tau. A is k by m for Side::Left and k by n for Side::Right; Q is
+/// never formed.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routines <c>dormlq</c> and <c>dorml2</c>.
+///
+/// work must hold <see cref="Ort_MatMul_LQ_WorkSize"/>( side, m, n, nb ) elements.
+/// If nb &lt; 2 or nb &gt;= k, the reflectors are applied one by one.
+/// The diagonal of A is modified but restored on exit.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Blk_C,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Blk_C>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr void Ort_MatMul_LQ( Side side, Trnsp trnsp,
+  Size m, Size n, Size k,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Blk_C C_, Stride C_ld,
+  T_Arr_work work,
+  Size nb = Mat_Fctr_BlkSize )
+{
+  IND_MATH_TRACE_SCOPE( "Ort_MatMul_LQ", m, n, k,
+    ( Side::Left == side ) ? 2.0*n*k*( 2.0*m - k ) : 2.0*m*k*( 2.0*n - k ),
+    ( 2.0*m*n + ( ( Side::Left == side ) ? m : n )*(double)k )*sizeof( *C_ ) );
+
+  using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+  auto A = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( A_, i, j, A_ld ); };
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+  auto A_Row = [&]( auto i, auto j ) -> auto
+  { return Lyt::RowPtr( A_, i, j, A_ld ); };
+  auto C_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( C_, i, j, C_ld ); };
+
+  const bool left = ( Side::Left == side );
+
+  // Order of Q
+  const Size nq = left ? m : n;
+
+  if( k > nq ){ throw BadArgument{ "Ort_MatMul_LQ", 5 }; }
+
+  // Quick return if possible
+
+  if( ( 0 == m ) || ( 0 == n ) || ( 0 == k ) ){ return; }
+
+  const auto A_rs = Lyt::RowStride( A_, A_ld );
+
+  // H(1) is applied first for Q*C and C*(~Q), H(k) first otherwise
+  const bool fwd = ( left == ( Trnsp::No == trnsp ) );
+
+  if( ( nb < 2 ) || ( nb >= k ) )
+  {
+    for( Index h = 0; h < (Index)k; ++h )
+    {
+      const Index i = fwd ? h : (Index)k-1-h;
+
+      // Apply H(i) to C(i:m-1,0:n-1) or C(0:m-1,i:n-1)
+      const auto aii = A(i,i);
+      A(i,i) = unit<Scalar>;
+      Rfl_MatMul< Lyt >( side, left ? m-i : m, left ? n : n-i,
+        A_Row(i,i), A_rs, tau[i],
+        left ? C_Blk(i,0) : C_Blk(0,i), C_ld, work );
+      A(i,i) = aii;
+    }
+    return;
+  }
+
+  const auto T_ = work;
+  const auto W_ = work + nb*nb;
+
+  const Stride T_ld = Lyt::DenseLd( nb, nb );
+  const Stride W_ld = Lyt::DenseLd( left ? n : m, nb );
+
+  // The block reflector of the rows is H(i) H(i+1) . . . , the
+  // transpose of its part of Q
+  const Trnsp H_trnsp = ( Trnsp::No == trnsp ) ? Trnsp::Yes : Trnsp::No;
+
+  const Index i0 = fwd ? 0 : (Index)(((k-1)/nb)*nb);
+  const Index di = fwd ? (Index)nb : -(Index)nb;
+
+  for( Index i = i0; ( i >= 0 ) && ( i < (Index)k ); i += di )
+  {
+    const Size ib = Min( nb, k-(Size)i );
+
+    // Form the triangular factor of the block reflector
+    // H = H(i) H(i+1) . . . H(i+ib-1)
+    Rfl_BlkGen< Lyt >( Direct::Fwd, Store::ByRow,
+      nq-i, ib, A_Blk(i,i), A_ld, tau + i, T_, T_ld );
+
+    // Apply H or ~H to C(i:m-1,0:n-1) or C(0:m-1,i:n-1)
+    Rfl_BlkMul< Lyt >( side, H_trnsp, Direct::Fwd, Store::ByRow,
+      left ? m-i : m, left ? n : n-i, ib,
+      A_Blk(i,i), A_ld,
+      T_, T_ld,
+      left ? C_Blk(i,0) : C_Blk(0,i), C_ld,
+      W_, W_ld );
+  }
+}
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
@@ -0,0 +1,93 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Ort_MatMul_Syt"/> on an m by n matrix C.
+/// </summary>
+inline constexpr Size Ort_MatMul_Syt_WorkSize( Side side, Size m, Size n, Size nb = Mat_Fctr_BlkSize ) noexcept
+{ return Ort_MatMul_QR_WorkSize( side, m, n, nb ); }
+
+/// <summary>
+/// Overwrites the real m by n matrix C with Q*C, (~Q)*C, C*Q or
+/// C*(~Q), where Q is the orthogonal matrix of order nq, m for
+/// Side::Left and n for Side::Right, defined by the n-1 elementary
+/// reflectors returned by <see cref="Sym_Rdto_Syt"/> in A and tau:
+///
+/// if half = Upper, Q = H(n-1) . . . H(2) H(1),
+///
+/// if half = Lower, Q = H(1) H(2) . . . H(n-1).
+///
+/// Q is never formed; use <see cref="Ort_From_Syt"/> for it.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dormtr</c>, on top of
+/// <see cref="Ort_MatMul_QL"/> and <see cref="Ort_MatMul_QR"/>.
+///
+/// work must hold <see cref="Ort_MatMul_Syt_WorkSize"/>( side, m, n, nb ) elements.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_tau,
+  typename T_Blk_C,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Blk_C>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr void Ort_MatMul_Syt( Side side, Half half, Trnsp trnsp,
+  Size m, Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_tau tau,
+  T_Blk_C C_, Stride C_ld,
+  T_Arr_work work,
+  Size nb = Mat_Fctr_BlkSize )
+{
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+  auto C_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( C_, i, j, C_ld ); };
+
+  const bool left = ( Side::Left == side );
+
+  // Order of Q
+  const Size nq = left ? m : n;
+
+  // Quick return if possible
+
+  if( ( 0 == m ) || ( 0 == n ) || ( nq < 2 ) ){ return; }
+
+  // Q acts as the unit matrix on the last (Upper) or first (Lower)
+  // row or column of C
+  const Size mi = left ? m-1 : m;
+  const Size ni = left ? n : n-1;
+
+  if( Half::Upper == half )
+  {
+    // Q was determined by a call to Sym_Rdto_Syt with half = Upper
+    Ort_MatMul_QL< Lyt >( side, trnsp, mi, ni, nq-1,
+      A_Blk(0,1), A_ld, tau, C_, C_ld, work, nb );
+  }
+  else if( Half::Lower == half )
+  {
+    // Q was determined by a call to Sym_Rdto_Syt with half = Lower
+    Ort_MatMul_QR< Lyt >( side, trnsp, mi, ni, nq-1,
+      A_Blk(1,0), A_ld, tau,
+      left ? C_Blk(1,0) : C_Blk(0,1), C_ld, work, nb );
+  }
+  else
+  { throw BadArgument{ "Ort_MatMul_Syt", 2 }; }
+}
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
@@ -36,23 +36,32 @@ requires( ! isComplex< Decay<DerefTypeOf<T_Blk_V>> >
   Decay<DerefTypeOf<T_Blk_T>> > )
 constexpr void Rfl_BlkGen(
   Direct direct, Store storev,
-  Size n, Size k, T_Blk_V V_, Size V_ld,
+  Size n, Size k, T_Blk_V V_, Stride V_ld,
   T_Arr_tau tau,
-  T_Blk_T T_, Size T_ld )
+  T_Blk_T T_, Stride T_ld )
 {
+  IND_MATH_TRACE_SCOPE( "Rfl_BlkGen", n, k, 0,
+    (double)n*k*k, ( (double)n*k + (double)k*k + k )*sizeof( *T_ ) );
+
   using Scalar = Decay<DerefTypeOf<T_Blk_V>>;
 
-  auto V = [&]( auto i, auto j ) -> auto &
+  auto V = [&]( auto i, auto j ) -> const auto &
   { return Lyt::MatRef( V_, i, j, V_ld ); };
+  auto V_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( V_, i, j, V_ld ); };
   auto T = [&]( auto i, auto j ) -> auto &
   { return Lyt::MatRef( T_, i, j, T_ld ); };
+  auto T_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( T_, i, j, T_ld ); };
 
   // Quick return if possible
   if( 0 == n ){ return; }
 
-  Index lastv;
-  const Stride T_cs = Lyt::ColStride( T_, T_ld );
-  const Stride V_cs = Lyt::ColStride( V_, V_ld );
+  const auto T_cs = Lyt::ColStride( T_, T_ld );
+  const auto V_cs = Lyt::ColStride( V_, V_ld );
+  const auto V_rs = Lyt::RowStride( V_, V_ld );
+
+  Index lastv = 0;
 
   if( Direct::Fwd == direct )
   {
@@ -73,49 +82,44 @@ constexpr void Rfl_BlkGen(
         if( Store::ByCol == storev )
         {
           // Skip any trailing zeros.
-          
-          for( lastv = (Index)(n-1); lastv >= i+1; --lastv )
+          for( lastv = (Index)(n-1); lastv > i; --lastv )
           { if( ! IsZero( V(lastv,i) ) ){ break; } }
 
-          for( Index j = 0; j <= i-1; ++j )
+          for( Index j = 0; j < i; ++j )
           { T(j,i) = -tau[i]*V(i,j); }
 
-          auto j = Min( lastv, prevlastv );
+          const Index j = Min( lastv, prevlastv );
 
-          // T(0:i-1,i) := - tau(i) * (~V(i:j,0:i-1)) * V(i:j,i)
-          const auto V_blk = Lyt::BlkPtr( V_, i+1, 0, V_ld );
-          const auto V_col = Lyt::BlkPtr( V_, i+1, i, V_ld );
-          const auto T_col = Lyt::BlkPtr( T_, 0, i, T_ld );
-          Mat_VecMul< Lyt >( Trnsp::Yes,
-            j-i, (i-1)+1, -tau[i], V_blk, V_ld,
-            V_col, V_cs, unit<Scalar>, T_col, T_cs );
+          // T(0:i-1,i) := T(0:i-1,i) - tau(i) * (~V(i+1:j,0:i-1)) * V(i+1:j,i)
+          Mat_VecMul< Lyt >( Trnsp::Yes, (Size)(j-i), (Size)i,
+            -tau[i], V_Blk( i+1, 0 ), V_ld,
+            V_Blk( i+1, i ), V_cs,
+            unit<Scalar>, T_Blk( 0, i ), T_cs );
         }
         else if( Store::ByRow == storev )
         {
           // Skip any trailing zeros.
-          for( lastv = (Index)(n-1); lastv >= i+1; --lastv )
+          for( lastv = (Index)(n-1); lastv > i; --lastv )
           { if( ! IsZero( V(i,lastv) ) ){ break; } }
 
-          for( Index j = 0; j <= i-1; ++j )
+          for( Index j = 0; j < i; ++j )
           { T(j,i) = -tau[i]*V(j,i); }
 
-          auto j = Min( lastv, prevlastv );
+          const Index j = Min( lastv, prevlastv );
 
-          // T(0:i-1,i) := - tau(i) * V(0:i-1,i:j) * (~V(i,i:j))
-          const auto pV_sub = Lyt::BlkPtr( V_, 0, i+1, V_ld );
-          const auto V_row = Lyt::BlkPtr( V_, i, i+1, V_ld );
-          const auto T_col = Lyt::BlkPtr( T_, 0, i, T_ld );
-          Mat_VecMul< Lyt >( Trnsp::No,
-            (i-1)+1, j-i, -tau[i], pV_sub, V_ld,
-            V_row, V_ld, unit<Scalar>, T_col, T_cs );
+          // T(0:i-1,i) := T(0:i-1,i) - tau(i) * V(0:i-1,i+1:j) * (~V(i,i+1:j))
+          Mat_VecMul< Lyt >( Trnsp::No, (Size)i, (Size)(j-i),
+            -tau[i], V_Blk( 0, i+1 ), V_ld,
+            V_Blk( i, i+1 ), V_rs,
+            unit<Scalar>, T_Blk( 0, i ), T_cs );
         }
 
-        // T(0:i-1,i) := T(0:i-1,1:i-1) * T(0:i-1,i)
-        const auto T_col = Lyt::BlkPtr( T_, 0, i, T_ld );
+        // T(0:i-1,i) := T(0:i-1,0:i-1) * T(0:i-1,i)
         Tri_VecMul< Lyt >( Half::Upper, Trnsp::No, Diag::NotUnit,
-          (i-1)+1, T_, T_ld, T_col, T_cs );
+          (Size)i, T_, T_ld, T_Blk( 0, i ), T_cs );
 
         T(i,i) = tau[i];
+
         if( i > 0 )
         { prevlastv = Max( prevlastv, lastv ); }else
         { prevlastv = lastv; }
@@ -131,59 +135,56 @@ constexpr void Rfl_BlkGen(
       {
         // H(i) = I
         for( Index j = i; j < (Index)k; ++j )
-        { T(j,i) = 0.0; }
+        { T(j,i) = {}; }
       }
       else
       {
         // General case
-        if( i < k )
+        if( i < (Index)(k-1) )
         {
+          // The unit element of H(i) is at position n-k+i.
+          const Index iv = (Index)(n-k) + i;
+
           if( Store::ByCol == storev )
           {
             // Skip any leading zeros.
-            for( lastv = 0; lastv <= i-1; ++lastv )
+            for( lastv = 0; lastv < i; ++lastv )
             { if( ! IsZero( V(lastv,i) ) ){ break; } }
 
             for( Index j = i+1; j < (Index)k; ++j )
-            { T(j,i) = -tau[i]*V((n-k+(i+1))-1,j); }
+            { T(j,i) = -tau[i]*V(iv,j); }
 
-            auto j = Max( lastv, prevlastv );
+            const Index j = Max( lastv, prevlastv );
 
-            // T(i+1:k-1,i) = -tau(i) * (~V(j:n-k+i-1,i+1:k-1))*V(j:n-k+i-1,i)
-            const auto V_blk = Lyt::BlkPtr( V_, j, i+1, V_ld );
-            const auto V_col = Lyt::BlkPtr( V_, j, i, V_ld );
-            const auto T_col = Lyt::BlkPtr( T_, i+1, i, T_ld );
-            Mat_VecMul< Lyt >( Trnsp::Yes,
-              (n-k+(i+1)-(j+1))-1, k-(i+1), -tau[i], V_blk, V_ld,
-              V_col, V_cs, unit<Scalar>, T_col, T_cs );
+            // T(i+1:k-1,i) := T(i+1:k-1,i) - tau(i) * (~V(j:iv-1,i+1:k-1)) * V(j:iv-1,i)
+            Mat_VecMul< Lyt >( Trnsp::Yes, (Size)(iv-j), k-(i+1),
+              -tau[i], V_Blk( j, i+1 ), V_ld,
+              V_Blk( j, i ), V_cs,
+              unit<Scalar>, T_Blk( i+1, i ), T_cs );
           }
           else if( Store::ByRow == storev )
           {
             // Skip any leading zeros.
-            for( lastv = 0; lastv <= i-1; ++lastv )
+            for( lastv = 0; lastv < i; ++lastv )
             { if( ! IsZero( V(i,lastv) ) ){ break; } }
 
             for( Index j = i+1; j < (Index)k; ++j )
-            { T(j,i) = -tau[i]*V(j,(n-k+(i+1))-1); }
+            { T(j,i) = -tau[i]*V(j,iv); }
 
-            auto j = Max( lastv, prevlastv );
+            const Index j = Max( lastv, prevlastv );
 
-            // T(i+1:k-1,i) = -tau(i) * V(i+1:k-1,j:(n-k+(i+1))-1) * (~V(i,j:(n-k+(i+1))-1))
-            const auto V_blk = Lyt::BlkPtr( V_, i+1, j, V_ld );
-            const auto V_row = Lyt::BlkPtr( V_, i, j, V_ld );
-            const auto T_col = Lyt::BlkPtr( T_, i+1, i, T_ld );
-            Mat_VecMul< Lyt >( Trnsp::No,
-              k-(i+1), (n-k+(i+1)-(j+1))-1, -tau[i], V_blk, V_ld,
-              V_row, V_ld, unit<Scalar>, T_col, T_cs );
+            // T(i+1:k-1,i) := T(i+1:k-1,i) - tau(i) * V(i+1:k-1,j:iv-1) * (~V(i,j:iv-1))
+            Mat_VecMul< Lyt >( Trnsp::No, k-(i+1), (Size)(iv-j),
+              -tau[i], V_Blk( i+1, j ), V_ld,
+              V_Blk( i, j ), V_rs,
+              unit<Scalar>, T_Blk( i+1, i ), T_cs );
           }
 
           // T(i+1:k-1,i) := T(i+1:k-1,i+1:k-1) * T(i+1:k-1,i)
-          const auto T_blk = Lyt::BlkPtr( T_, i+1, i+1, T_ld );
-          const auto T_col = Lyt::BlkPtr( T_, i+1, i, T_ld );
           Tri_VecMul< Lyt >( Half::Lower, Trnsp::No, Diag::NotUnit,
-            k-(i+1), T_blk, T_ld, T_col, T_cs );
+            k-(i+1), T_Blk( i+1, i+1 ), T_ld, T_Blk( i+1, i ), T_cs );
 
-          if( i > 1 )
+          if( i > 0 )
           { prevlastv = Min( prevlastv, lastv ); }else
           { prevlastv = lastv; }
         }
@@ -4,6 +4,13 @@ namespace IND {
 namespace Math {
 namespace LAPACK {
 
+/// <summary>
+/// Number of elements of the work block W of <see cref="Rfl_BlkMul"/>,
+/// n by k for Side::Left and m by k for Side::Right, held compactly.
+/// </summary>
+inline constexpr Size Rfl_BlkMul_WorkSize( Side side, Size m, Size n, Size k ) noexcept
+{ return ( ( Side::Left == side ) ? n : m )*k; }
+
 /// <summary>
 /// Applies a real block reflector H or its transpose (~H) to a
 /// real m by n matrix C, from either the left or the right.
@@ -48,11 +55,14 @@ requires( ! isComplex< Decay<DerefTypeOf<T_Blk_V>> >
 constexpr void Rfl_BlkMul(
   Side side, Trnsp H_trnsp, Direct direct, Store storev,
   Size m, Size n, Size k,
-  T_Blk_V V_, Size V_ld,
-  T_Blk_T T_, Size T_ld,
+  T_Blk_V V_, Stride V_ld,
+  T_Blk_T T_, Stride T_ld,
   T_Blk_C C_, Stride C_ld,
-  T_Blk_W W_, Size W_ld )
+  T_Blk_W W_, Stride W_ld )
 {
+  IND_MATH_TRACE_SCOPE( "Rfl_BlkMul", m, n, k,
+    4.0*m*n*k, ( 2.0*m*n + ( ( Side::Left == side ) ? m : n )*(double)k + (double)k*k )*sizeof( *C_ ) );
+
   using Scalar = Decay<DerefTypeOf<T_Blk_V>>;
 
   auto T = [&]( auto i, auto j ) -> const auto &
@@ -79,18 +89,12 @@ constexpr void Rfl_BlkMul(
   auto V_Col = [&]( auto i, auto j ) -> auto
   { return Lyt::ColPtr( V_, i, j, V_ld ); };
 
-  if( Trnsp::Conj == H_trnsp ){ throw BadArgument{ "Aux_BlkReflMul", 2 }; }
+  if( Trnsp::Conj == H_trnsp ){ throw BadArgument{ "Rfl_BlkMul", 2 }; }
 
   // Quick return if possible
 
   if( (0 == m) || (0 == n) ){ return; }
 
-  const Stride C_rs = Lyt::RowStride( C_, C_ld );
-  const Stride C_cs = Lyt::ColStride( C_, C_ld );
-
-  const Stride W_rs = Lyt::RowStride( W_, W_ld );
-  const Stride W_cs = Lyt::ColStride( W_, W_ld );
-
   const Trnsp T_trnsp = ( Trnsp::No == H_trnsp ) ? Trnsp::Yes : Trnsp::No;
 
   if( Store::ByCol == storev )
@@ -110,42 +114,41 @@ constexpr void Rfl_BlkMul(
         // W := (~C)*V = ((~C1)*V1 + (~C2)*V2)  (stored in WORK)
         //
         // W := (~C1)
-        Mat_Copy< Lyt >( Half::Both, Trnsp::Yes, n, k, C_, C_ld, W_, W_ld );
+        Mat_Copy< Lyt >( Half::Both, Trnsp::Yes, k, n, C_, C_ld, W_, W_ld );
 
         // W := W*V1
 
-        Tri_MatMul< Lyt >( Side::Right, Half::Lower, Trnsp::No, Diag::IsUnit,
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Lower, Trnsp::No, Diag::IsUnit,
           n, k, unit<Scalar>, V_, V_ld, W_, W_ld );
 
+        // W := W + (~C2)*V2
         if( m > k )
         {
-          // W := W + (~C2)*V2
           Mat_MatMul< Lyt >( Trnsp::Yes, Trnsp::No, n, k, m-k,
             unit<Scalar>, C_Blk(k,0), C_ld,
             V_Blk(k,0), V_ld,
             unit<Scalar>, W_, W_ld );
+        }
 
-          // W := W*(~T)  or  W*T
-          Tri_MatMul< Lyt >( Side::Right, Half::Upper, T_trnsp, Diag::NotUnit,
-            n, k, unit<Scalar>, T_, T_ld, W_, W_ld );
-
-          // C := C - V*(~W)
+        // W := W*(~T)  or  W*T
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Upper, T_trnsp, Diag::NotUnit,
+          n, k, unit<Scalar>, T_, T_ld, W_, W_ld );
 
-          if( m > k )
-          {
-            Mat_MatMul< Lyt >( Trnsp::No, Trnsp::Yes, m-k, n, k,
-              -unit<Scalar>, V_Blk(k,0), V_ld,
-              W_, W_ld,
-              unit<Scalar>, C_Blk(k,0), C_ld );
-          }
+        // C := C - V*(~W)
+        if( m > k )
+        {
+          Mat_MatMul< Lyt >( Trnsp::No, Trnsp::Yes, m-k, n, k,
+            -unit<Scalar>, V_Blk(k,0), V_ld,
+            W_, W_ld,
+            unit<Scalar>, C_Blk(k,0), C_ld );
+        }
 
-          // W := W*(~V1)
-          Tri_MatMul< Lyt >( Side::Right, Half::Lower, Trnsp::Yes, Diag::IsUnit,
-            n, k, unit<Scalar>, V_, V_ld, W_, W_ld );
+        // W := W*(~V1)
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Lower, Trnsp::Yes, Diag::IsUnit,
+          n, k, unit<Scalar>, V_, V_ld, W_, W_ld );
 
-          // C1 := C1 - (~W)
-          Mat_Sub< Lyt >( Trnsp::Yes, k, n, W_, W_ld, C_, C_ld );
-        }
+        // C1 := C1 - (~W)
+        Mat_Sub< Lyt >( Trnsp::Yes, k, n, W_, W_ld, C_, C_ld );
       }
       else if( Side::Right == side )
       {
@@ -157,7 +160,7 @@ constexpr void Rfl_BlkMul(
         Mat_Copy< Lyt >( Half::Both, Trnsp::No, m, k, C_, C_ld, W_, W_ld );
 
         // W := W*V1
-        Tri_MatMul< Lyt >( Side::Right, Half::Lower, Trnsp::No, Diag::IsUnit,
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Lower, Trnsp::No, Diag::IsUnit,
           m, k, unit<Scalar>, V_, V_ld, W_, W_ld );
 
         // W := W + C2*V2
@@ -170,7 +173,7 @@ constexpr void Rfl_BlkMul(
         }
 
         // W := W*T  or  W*(~T)
-        Tri_MatMul< Lyt >( Side::Right, Half::Upper, H_trnsp, Diag::NotUnit,
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Upper, H_trnsp, Diag::NotUnit,
           m, k, unit<Scalar>, T_, T_ld, W_, W_ld );
 
         // C := C - W*(~V)
@@ -184,7 +187,7 @@ constexpr void Rfl_BlkMul(
         }
 
         // W := W*(~V1)
-        Tri_MatMul< Lyt >( Side::Right, Half::Lower, Trnsp::Yes, Diag::IsUnit,
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Lower, Trnsp::Yes, Diag::IsUnit,
           m, k, unit<Scalar>, V_, V_ld, W_, W_ld );
 
         // C1 := C1 - W
@@ -206,10 +209,10 @@ constexpr void Rfl_BlkMul(
         // W := (~C)*V = ((~C1)*V1 + (~C2)*V2)  (stored in WORK)
 
         // W := (~C2)
-        Mat_Copy< Lyt >( Half::Both, Trnsp::Yes, n, k, C_Blk(m-k,0), C_ld, W_, W_ld );
+        Mat_Copy< Lyt >( Half::Both, Trnsp::Yes, k, n, C_Blk(m-k,0), C_ld, W_, W_ld );
 
         // W := W*V2
-        Tri_MatMul< Lyt >( Side::Right, Half::Upper, Trnsp::No, Diag::IsUnit,
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Upper, Trnsp::No, Diag::IsUnit,
           n, k, unit<Scalar>, V_Blk(m-k, 0), V_ld, W_, W_ld );
 
         // W := W + (~C1)*V1
@@ -222,7 +225,7 @@ constexpr void Rfl_BlkMul(
         }
 
         // W := W*(~T) or W*T
-        Tri_MatMul< Lyt >( Side::Right, Half::Lower, T_trnsp, Diag::NotUnit,
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Lower, T_trnsp, Diag::NotUnit,
           n, k, unit<Scalar>, T_, T_ld, W_, W_ld );
 
         // C := C - V*(~W)
@@ -235,7 +238,7 @@ constexpr void Rfl_BlkMul(
         }
 
         // W := W*(~V2)
-        Tri_MatMul< Lyt >( Side::Right, Half::Upper, Trnsp::Yes, Diag::IsUnit,
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Upper, Trnsp::Yes, Diag::IsUnit,
           n, k, unit<Scalar>, V_Blk(m-k,0), V_ld, W_, W_ld );
 
         // C2 := C2 - (~W)
@@ -251,7 +254,7 @@ constexpr void Rfl_BlkMul(
         Mat_Copy< Lyt >( Half::Both, Trnsp::No, m, k, C_Blk(0,n-k), C_ld, W_, W_ld );
 
         // W := W*V2
-        Tri_MatMul< Lyt >( Side::Right, Half::Upper, Trnsp::No, Diag::IsUnit,
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Upper, Trnsp::No, Diag::IsUnit,
           m, k, unit<Scalar>, V_Blk(n-k,0), V_ld, W_, W_ld );
 
         // W := W + C1*V1
@@ -264,7 +267,7 @@ constexpr void Rfl_BlkMul(
         }
 
         // W := W*T or W*(~T)
-        Tri_MatMul< Lyt >( Side::Right, Half::Lower, H_trnsp, Diag::NotUnit,
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Lower, H_trnsp, Diag::NotUnit,
           m, k, unit<Scalar>, T_, T_ld, W_, W_ld );
 
         // C := C - W*(~V)
@@ -277,7 +280,7 @@ constexpr void Rfl_BlkMul(
         }
 
         // W := W*(~V2)
-        Tri_MatMul< Lyt >( Side::Right, Half::Upper, Trnsp::Yes, Diag::IsUnit,
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Upper, Trnsp::Yes, Diag::IsUnit,
           m, k, unit<Scalar>, V_Blk(n-k,0), V_ld, W_, W_ld );
 
         // C2 := C2 - W
@@ -300,10 +303,10 @@ constexpr void Rfl_BlkMul(
         // W := (~C)*(~V) = ((~C1)*(~V1) + (~C2)*(~V2)) (stored in WORK)
 
         // W := (~C1)
-        Mat_Copy< Lyt >( Half::Both, Trnsp::Yes, n, k, C_, C_ld, W_, W_ld );
+        Mat_Copy< Lyt >( Half::Both, Trnsp::Yes, k, n, C_, C_ld, W_, W_ld );
 
         // W := W*(~V1)
-        Tri_MatMul< Lyt >( Side::Right, Half::Upper, Trnsp::Yes, Diag::IsUnit,
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Upper, Trnsp::Yes, Diag::IsUnit,
           n, k, unit<Scalar>, V_, V_ld, W_, W_ld );
 
         // W := W + (~C2)*(~V2)
@@ -316,7 +319,7 @@ constexpr void Rfl_BlkMul(
         }
 
         // W := W*(~T) or W*T
-        Tri_MatMul< Lyt >( Side::Right, Half::Upper, T_trnsp, Diag::NotUnit,
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Upper, T_trnsp, Diag::NotUnit,
           n, k, unit<Scalar>, T_, T_ld, W_, W_ld );
 
         // C := C - (~V)*(~W)
@@ -330,7 +333,7 @@ constexpr void Rfl_BlkMul(
         }
 
         // W := W*V1
-        Tri_MatMul< Lyt >( Side::Right, Half::Upper, Trnsp::No, Diag::IsUnit,
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Upper, Trnsp::No, Diag::IsUnit,
           n, k, unit<Scalar>, V_, V_ld, W_, W_ld );
 
         // C1 := C1 - (~W)
@@ -346,7 +349,7 @@ constexpr void Rfl_BlkMul(
         Mat_Copy< Lyt >( Half::Both, Trnsp::No, m, k, C_, C_ld, W_, W_ld );
 
         // W := W*(~V1)
-        Tri_MatMul< Lyt >( Side::Right, Half::Upper, Trnsp::Yes, Diag::IsUnit,
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Upper, Trnsp::Yes, Diag::IsUnit,
           m, k, unit<Scalar>, V_, V_ld, W_, W_ld );
 
         // W := W + C2*(~V2)
@@ -359,7 +362,7 @@ constexpr void Rfl_BlkMul(
         }
 
         // W := W*T or W*(~T)
-        Tri_MatMul< Lyt >( Side::Right, Half::Upper, H_trnsp, Diag::NotUnit,
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Upper, H_trnsp, Diag::NotUnit,
           m, k, unit<Scalar>, T_, T_ld, W_, W_ld );
 
         // C := C - W*V2
@@ -372,7 +375,7 @@ constexpr void Rfl_BlkMul(
         }
 
         // W := W*V1
-        Tri_MatMul< Lyt >( Side::Right, Half::Upper, Trnsp::No, Diag::IsUnit,
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Upper, Trnsp::No, Diag::IsUnit,
           m, k, unit<Scalar>, V_, V_ld, W_, W_ld );
 
         // C1 := C1 - W
@@ -393,10 +396,10 @@ constexpr void Rfl_BlkMul(
         // W := (~C)*(~V) = ((~C1)*(~V1) + (~C2)*(~V2)) (stored in WORK)
 
         // W := (~C2)
-        Mat_Copy< Lyt >( Half::Both, Trnsp::Yes, n, k, C_Blk(m-k,0), C_ld, W_, W_ld );
+        Mat_Copy< Lyt >( Half::Both, Trnsp::Yes, k, n, C_Blk(m-k,0), C_ld, W_, W_ld );
 
         // W := W*(~V2)
-        Tri_MatMul< Lyt >( Side::Right, Half::Lower, Trnsp::Yes, Diag::IsUnit,
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Lower, Trnsp::Yes, Diag::IsUnit,
           n, k, unit<Scalar>, V_Blk(0,m-k), V_ld, W_, W_ld );
 
         // W := W + (~C1)*(~V1)
@@ -408,7 +411,7 @@ constexpr void Rfl_BlkMul(
         }
 
         // W := W*(~T) or W*T
-        Tri_MatMul< Lyt >( Side::Right, Half::Lower, T_trnsp, Diag::NotUnit,
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Lower, T_trnsp, Diag::NotUnit,
           n, k, unit<Scalar>, T_, T_ld, W_, W_ld );
 
         // C := C - (~V)*(~W)
@@ -420,7 +423,7 @@ constexpr void Rfl_BlkMul(
         }
 
         // W := W*V2
-        Tri_MatMul< Lyt >( Side::Right, Half::Lower, Trnsp::No, Diag::IsUnit,
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Lower, Trnsp::No, Diag::IsUnit,
           n, k, unit<Scalar>, V_Blk(0,m-k), V_ld, W_, W_ld );
 
         // C2 := C2 - (~W)
@@ -436,7 +439,7 @@ constexpr void Rfl_BlkMul(
         Mat_Copy< Lyt >( Half::Both, Trnsp::No, m, k, C_Blk(0,n-k), C_ld, W_, W_ld );
 
         // W := W*(~V2)
-        Tri_MatMul< Lyt >( Side::Right, Half::Lower, Trnsp::Yes, Diag::IsUnit,
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Lower, Trnsp::Yes, Diag::IsUnit,
           m, k, unit<Scalar>, V_Blk(0,n-k), V_ld, W_, W_ld );
 
         // W := W + C1*(~V1)
@@ -449,7 +452,7 @@ constexpr void Rfl_BlkMul(
         }
 
         // W := W*T or W*(~T)
-        Tri_MatMul< Lyt >( Side::Right, Half::Lower, H_trnsp, Diag::NotUnit,
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Lower, H_trnsp, Diag::NotUnit,
           m, k, unit<Scalar>, T_, T_ld, W_, W_ld );
 
         // C := C - W*V1
@@ -462,8 +465,8 @@ constexpr void Rfl_BlkMul(
         }
 
         // W := W*V2
-        Tri_MatMul< Lyt >( Side::Right, Half::Lower, Trnsp::No, Diag::IsUnit,
-          m, n, unit<Scalar>, V_Blk(0,n-k), V_ld, W_, W_ld );
+        Tri_MatMul_Rec< Lyt >( Side::Right, Half::Lower, Trnsp::No, Diag::IsUnit,
+          m, k, unit<Scalar>, V_Blk(0,n-k), V_ld, W_, W_ld );
 
         // C1 := C1 - W
         Mat_Sub< Lyt >( Trnsp::No, m, k, W_, W_ld, C_Blk(0,n-k), C_ld );
@@ -471,6 +474,157 @@ constexpr void Rfl_BlkMul(
     }
   }
 }
+
+/// <summary>
+/// Applies H or ~H to C as <see cref="Rfl_BlkMul"/> does, with the work
+/// split through the execution context exec (see
+/// <see cref="ExecContext"/>).
+/// </summary>
+/// <remarks>
+/// The columns of C are independent for Side::Left, its rows for
+/// Side::Right; they are split into one range per thread of at least
+/// <see cref="Exec_SplitMin"/>, each applied with the matching rows
+/// of W. V and T are only read.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_V,
+  typename T_Blk_T,
+  typename T_Blk_C,
+  typename T_Blk_W,
+  typename T_Exec >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_V>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_V>>,
+  Decay<DerefTypeOf<T_Blk_T>>,
+  Decay<DerefTypeOf<T_Blk_C>>,
+  Decay<DerefTypeOf<T_Blk_W>> >
+  && ExecContext< Decay<T_Exec> > )
+constexpr void Rfl_BlkMul(
+  Side side, Trnsp H_trnsp, Direct direct, Store storev,
+  Size m, Size n, Size k,
+  T_Blk_V V_, Stride V_ld,
+  T_Blk_T T_, Stride T_ld,
+  T_Blk_C C_, Stride C_ld,
+  T_Blk_W W_, Stride W_ld,
+  T_Exec &&exec )
+{
+  if constexpr ( ! BLAS::_n_Impl::_isExecSeq< T_Exec > )
+  {
+    if( Side::Left == side )
+    {
+      BLAS::_n_Impl::_Exec_Split( exec, n, Exec_SplitMin, [&]( Index j0, Size nt )
+      {
+        Rfl_BlkMul< Lyt >( side, H_trnsp, direct, storev, m, nt, k,
+          V_, V_ld, T_, T_ld,
+          Lyt::BlkPtr( C_, 0, j0, C_ld ), C_ld,
+          Lyt::BlkPtr( W_, j0, 0, W_ld ), W_ld );
+      } );
+    }
+    else
+    {
+      BLAS::_n_Impl::_Exec_Split( exec, m, Exec_SplitMin, [&]( Index i0, Size mt )
+      {
+        Rfl_BlkMul< Lyt >( side, H_trnsp, direct, storev, mt, n, k,
+          V_, V_ld, T_, T_ld,
+          Lyt::BlkPtr( C_, i0, 0, C_ld ), C_ld,
+          Lyt::BlkPtr( W_, i0, 0, W_ld ), W_ld );
+      } );
+    }
+  }
+  else
+  {
+    Rfl_BlkMul< Lyt >( side, H_trnsp, direct, storev, m, n, k,
+      V_, V_ld, T_, T_ld, C_, C_ld, W_, W_ld );
+  }
+}
+
+/// <summary>
+/// Applies H or ~H to C as <see cref="Rfl_BlkMul"/> does, with V, T,
+/// C and W in the memory of a device (see <see cref="Device"/>), in
+/// the Level-3 routines of the device.
+///
+/// Only direct == Direct::Fwd with storev == Store::ByCol, the
+/// reflectors of QR, is supported. W is k by n for Side::Left, and m
+/// by k for Side::Right.
+/// </summary>
+template< typename Lyt = ColMajor,
+  typename T_Device >
+requires( Device< T_Device > && isColMajor< Lyt > )
+void Rfl_BlkMul(
+  Side side, Trnsp H_trnsp, Direct direct, Store storev,
+  Size m, Size n, Size k,
+  Dev_Ptr< T_Device > V_, Stride V_ld,
+  Dev_Ptr< T_Device > T_, Stride T_ld,
+  Dev_Ptr< T_Device > C_, Stride C_ld,
+  Dev_Ptr< T_Device > W_, Stride W_ld )
+{
+  using Scalar = typename T_Device::Scalar;
+
+  auto V_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( V_, i, j, V_ld ); };
+  auto C_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( C_, i, j, C_ld ); };
+
+  if( Direct::Fwd != direct ){ throw BadArgument{ "Rfl_BlkMul", 3 }; }
+  if( Store::ByCol != storev ){ throw BadArgument{ "Rfl_BlkMul", 4 }; }
+
+  if( ( 0 == m ) || ( 0 == n ) || ( 0 == k ) ){ return; }
+
+  const Scalar one = unit< Scalar >;
+
+  // H = I - V*T*(~V), so ~H takes ~T
+  const Trnsp T_trnsp = ( Trnsp::No == H_trnsp ) ? Trnsp::No : Trnsp::Yes;
+
+  if( Side::Left == side )
+  {
+    // W := (~V)*C = (~V1)*C1 + (~V2)*C2
+    Mat_Copy< Lyt, Lyt >( k, n, C_, C_ld, W_, W_ld );
+    Tri_MatMul< Lyt >( Side::Left, Half::Lower, Trnsp::Yes, Diag::IsUnit,
+      k, n, one, V_, V_ld, W_, W_ld );
+    if( m > k )
+    {
+      Mat_MatMul< Lyt >( Trnsp::Yes, Trnsp::No, k, n, m-k,
+        one, V_Blk(k,0), V_ld, C_Blk(k,0), C_ld, one, W_, W_ld );
+    }
+
+    // W := op(T)*W, then C := C - V*W
+    Tri_MatMul< Lyt >( Side::Left, Half::Upper, T_trnsp, Diag::NotUnit,
+      k, n, one, T_, T_ld, W_, W_ld );
+    if( m > k )
+    {
+      Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, m-k, n, k,
+        -one, V_Blk(k,0), V_ld, W_, W_ld, one, C_Blk(k,0), C_ld );
+    }
+    Tri_MatMul< Lyt >( Side::Left, Half::Lower, Trnsp::No, Diag::IsUnit,
+      k, n, one, V_, V_ld, W_, W_ld );
+    Mat_Add< Lyt >( Trnsp::No, k, n, -one, W_, W_ld, C_, C_ld );
+  }
+  else
+  {
+    // W := C*V = C1*V1 + C2*V2
+    Mat_Copy< Lyt, Lyt >( m, k, C_, C_ld, W_, W_ld );
+    Tri_MatMul< Lyt >( Side::Right, Half::Lower, Trnsp::No, Diag::IsUnit,
+      m, k, one, V_, V_ld, W_, W_ld );
+    if( n > k )
+    {
+      Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, m, k, n-k,
+        one, C_Blk(0,k), C_ld, V_Blk(k,0), V_ld, one, W_, W_ld );
+    }
+
+    // W := W*op(T), then C := C - W*(~V)
+    Tri_MatMul< Lyt >( Side::Right, Half::Upper, T_trnsp, Diag::NotUnit,
+      m, k, one, T_, T_ld, W_, W_ld );
+    if( n > k )
+    {
+      Mat_MatMul< Lyt >( Trnsp::No, Trnsp::Yes, m, n-k, k,
+        -one, W_, W_ld, V_Blk(k,0), V_ld, one, C_Blk(0,k), C_ld );
+    }
+    Tri_MatMul< Lyt >( Side::Right, Half::Lower, Trnsp::Yes, Diag::IsUnit,
+      m, k, one, V_, V_ld, W_, W_ld );
+    Mat_Add< Lyt >( Trnsp::No, m, k, -one, W_, W_ld, C_, C_ld );
+  }
+}
+
 }// namespace LAPACK
 }// namespace Math
 }// namespace IND
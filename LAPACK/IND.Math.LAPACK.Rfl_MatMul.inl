@@ -6,8 +6,8 @@ namespace LAPACK {
 
 inline constexpr Size Rfl_MatMul_WorkSize( Size m, Size n ) noexcept
 {
-  IND_NOT_USED( m );
-  return n;
+  // n when applied from the left, m from the right.
+  return Max( m, n );
 }
 
 /// <summary>
@@ -43,6 +43,9 @@ constexpr void Rfl_MatMul( Side side,
   T_Blk_C C_, Stride C_ld,
   T_Arr_work work )
 {
+  IND_MATH_TRACE_SCOPE( "Rfl_MatMul", m, n, 0,
+    4.0*m*n, ( 2.0*m*n + ( ( Side::Left == side ) ? m : n ) )*sizeof( *C_ ) );
+
   // Quick return if possible.
   if(  IsZero( tau ) ){ return; }
 
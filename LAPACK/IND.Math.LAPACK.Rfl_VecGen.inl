@@ -29,9 +29,10 @@ namespace LAPACK {
 /// </remarks>
 template< typename Lyt = Flat,
   typename T_Scalar,
-  typename T_Vec_x >
+  typename T_Vec_x,
+  StrideArg T_Stride_x >
 requires( ! isComplex< T_Scalar > && areTheSame< T_Scalar, Decay<DerefTypeOf<T_Vec_x>> > )
-constexpr void Rfl_VecGen( Size n, T_Scalar &alpha, T_Vec_x x_, Stride x_s, T_Scalar &tau ) noexcept
+constexpr void Rfl_VecGen( Size n, T_Scalar &alpha, T_Vec_x x_, T_Stride_x x_s, T_Scalar &tau ) noexcept
 {
   if( 0 == n ){ return; }
 
@@ -0,0 +1,306 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Order from which <see cref="Sym_Eig"/> solves the tridiagonal
+/// eigenproblem with <see cref="Syt_EigVecDC"/> rather than with
+/// <see cref="Syt_EigVecQR"/>.
+/// </summary>
+inline constexpr Size Sym_Eig_DCMin = 32;
+
+/// <summary>
+/// Order from which <see cref="Sym_Eig"/> reduces A to tridiagonal
+/// form in two stages, through a band matrix, rather than directly,
+/// when it runs on more than one thread. A placeholder default, not
+/// a measured crossover: bench --tune searches it for a machine, into
+/// <see cref="Aux_Tuned"/>.
+/// </summary>
+inline constexpr Size Sym_Eig_TwoStageMin = 5000;
+
+/// <summary>
+/// Number of off-diagonals of the band matrix of the two-stage
+/// reduction of <see cref="Sym_Eig"/>. A placeholder default, as
+/// <see cref="Sym_Eig_TwoStageMin"/> is.
+/// </summary>
+inline constexpr Size Sym_Eig_TwoStageBand = 32;
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Sym_Eig"/>, where dcMin, batch, twoStageMin, kd and nb
+/// are the <c>dcMin</c>, <c>qr.sweepBatch</c>, <c>twoStageMin</c>,
+/// <c>kd</c> and <c>nb</c> of its configuration.
+/// </summary>
+inline constexpr Size Sym_Eig_WorkSize( Size n, Size dcMin = Sym_Eig_DCMin, Size batch = 1,
+  Size twoStageMin = Sym_Eig_TwoStageMin, Size kd = Sym_Eig_TwoStageBand,
+  Size nb = Mat_Fctr_BlkSize ) noexcept
+{
+  if( 0 == n ){ return 0; }
+
+  const Size eig = ( n >= dcMin ) ? Syt_EigVecDC_WorkSize( n ) : Syt_EigVecQR_WorkSize( n, batch );
+
+  // e and tau, then the workspace of the stages
+  const Size rdto = Max( Sym_Rdto_Syt_Blk_WorkSize( n, nb ), Ort_From_Syt_Blk_WorkSize( n, nb ) );
+  const Size one = 2*n + Max( rdto, eig );
+
+  // As the two stages depend on the thread count too, enough for
+  // either: e and tau, the band matrix, then the workspace of the stages
+  if( n >= twoStageMin )
+  {
+    const Size rdto2 = Max( Sym_Rdto_Bnd_WorkSize( n, kd ), Ort_From_Bnd_WorkSize( n, kd ) );
+    return Max( one, 2*n + ( kd+1 )*n + Max( rdto2, eig ) );
+  }
+
+  return one;
+}
+
+/// <summary>
+/// Eigensystem solver for real Symmetric matrices.
+///
+/// A is reduced to tridiagonal form, the orthogonal matrix of the
+/// reduction is formed in place of A, and the tridiagonal eigenproblem
+/// is solved with <see cref="Syt_EigVecDC"/> from order config().dcMin
+/// on, and with <see cref="Syt_EigVecQR"/> below it.
+///
+/// From order config().twoStageMin on, when the execution context has
+/// more than one thread, the reduction takes two stages:
+/// <see cref="Sym_Rdto_Bnd"/> to a band of config().kd off-diagonals,
+/// all in matrix products, then <see cref="Bnd_Rdto_Syt"/> to
+/// tridiagonal form, whose rotations are applied to the orthogonal
+/// matrix of the first stage, formed by <see cref="Ort_From_Bnd"/>.
+/// This moves the half of the flops of the one-stage reduction that
+/// are matrix-vector products into matrix-matrix ones, at the price of
+/// a second pass over the eigenvectors, which only the threads repay:
+/// on one, the rotations cost more than the matrix products save.
+///
+/// Only the first stage is blocked. The second is a serial Givens
+/// bulge chase on the caller, not pipelined sweeps, and its
+/// back-transformation applies the rotations one by one to row blocks
+/// of Q, split through exec, rather than as blocked Householder
+/// products.
+///
+/// The workspace is either passed in, sized by <see cref="WorkSize"/>,
+/// or taken from an <see cref="Aux_Arena"/>, the caller's or one held
+/// by the solver, which is allocated on first use and only grows, so
+/// that repeated calls of the same order do not allocate.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dsyevd</c>.
+/// </remarks>
+template< typename T_Scalar, typename DefaultLyt = ColMajor >
+requires( ! isComplex< T_Scalar > )
+class Sym_Eig
+{
+public:
+
+  using Scalar = T_Scalar;
+
+  struct Config
+  {
+    Size dcMin = Sym_Eig_DCMin;
+    Size twoStageMin = Sym_Eig_TwoStageMin;
+    Size kd = Sym_Eig_TwoStageBand;
+    // Panel width of the one-stage reduction and of the forming of
+    // its orthogonal matrix
+    Size nb = Mat_Fctr_BlkSize;
+    typename Syt_EigVecQR< Scalar, DefaultLyt >::Config qr = {};
+    typename Syt_EigVecDC< Scalar, DefaultLyt >::Config dc = {};
+
+    // The defaults, overridden by the keys Sym_Eig.dcMin,
+    // .twoStageMin, .kd and .nb of Aux_Tuned(), with the tuned
+    // configurations of the tridiagonal solvers.
+    static Config Tuned()
+    {
+      const auto &t = Aux_Tuned();
+
+      Config config{};
+      config.dcMin = t.Get< Scalar >( "Sym_Eig.dcMin", config.dcMin );
+      config.twoStageMin = t.Get< Scalar >( "Sym_Eig.twoStageMin", config.twoStageMin );
+      config.kd = t.Get< Scalar >( "Sym_Eig.kd", config.kd );
+      config.nb = t.Get< Scalar >( "Sym_Eig.nb", config.nb );
+      config.qr = Syt_EigVecQR< Scalar, DefaultLyt >::Config::Tuned();
+      config.dc = Syt_EigVecDC< Scalar, DefaultLyt >::Config::Tuned();
+      return config;
+    }
+  };
+
+private:
+
+  Config _config;
+
+  Aux_Arena< Scalar > _arena;
+
+public:
+
+  constexpr const Config &config() const noexcept
+  { return this->_config; }
+  constexpr void SetConfig( const Config &config ) noexcept
+  { this->_config = config; }
+
+  Sym_Eig() = default;
+  Sym_Eig( const Sym_Eig & ) = default;
+  Sym_Eig( Sym_Eig && ) noexcept = default;
+  Sym_Eig &operator = ( const Sym_Eig & ) = default;
+  Sym_Eig &operator = ( Sym_Eig && ) noexcept = default;
+  ~Sym_Eig() = default;
+
+  /// <summary>
+  /// Size of the workspace Solve needs for order n under the
+  /// current configuration.
+  /// </summary>
+  constexpr Size WorkSize( Size n ) const noexcept
+  {
+    return Sym_Eig_WorkSize( n, this->_config.dcMin, this->_config.qr.sweepBatch,
+      this->_config.twoStageMin, this->_config.kd, this->_config.nb );
+  }
+
+  /// <summary>
+  /// Computes all eigenvalues and eigenvectors of the n by n symmetric
+  /// matrix A, of which only the given half is referenced. On output
+  /// w holds the eigenvalues in increasing order, and column i of A
+  /// the normalized eigenvector of w[i].
+  ///
+  /// work must hold <see cref="WorkSize"/>( n ) elements.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Blk_A,
+    typename T_Arr_w,
+    typename T_Arr_work >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Blk_A> >,
+    Decay< DerefTypeOf<T_Arr_w> >,
+    Decay< DerefTypeOf<T_Arr_work>> >)
+  constexpr bool Solve( Half half, Size n, T_Blk_A A_, Stride A_ld, T_Arr_w w, T_Arr_work work ) const
+  { return this->template Solve< Lyt >( half, n, A_, A_ld, w, work, Exec_Seq{} ); }
+
+  /// <summary>
+  /// Solves as above, with the tridiagonal eigenproblem and its
+  /// eigenvectors split through the execution context exec (see
+  /// <see cref="ExecContext"/>). The one-stage reduction and the
+  /// forming of its orthogonal matrix stay on the caller; the products
+  /// of the two-stage one, and the back-transformation of both of its
+  /// stages, go through exec as well.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Blk_A,
+    typename T_Arr_w,
+    typename T_Arr_work,
+    typename T_Exec >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Blk_A> >,
+    Decay< DerefTypeOf<T_Arr_w> >,
+    Decay< DerefTypeOf<T_Arr_work>> >
+    && ExecContext< Decay<T_Exec> > )
+  constexpr bool Solve( Half half, Size n, T_Blk_A A_, Stride A_ld, T_Arr_w w, T_Arr_work work, T_Exec &&exec ) const
+  {
+    IND_MATH_TRACE_SCOPE( "Sym_Eig", n, n, 0, 0, ( 2.0*n*n + 2.0*n )*sizeof( Scalar ) );
+
+    if( 0 == n ){ return true; }
+
+    const T_Arr_work e = work;
+    const T_Arr_work tau = work + n;
+    T_Arr_work rest = work + 2*n;
+
+    const Size kd = Min( this->_config.kd, n-1 );
+    if( ( n >= this->_config.twoStageMin ) && ( kd > 1 ) && ( exec.ThreadCount() > 1 ) )
+    {
+      // AB, the band of the first stage
+      const T_Arr_work AB_ = rest;
+      const Stride AB_ld = Band::DenseLd( 0, kd );
+      rest += ( this->_config.kd+1 )*n;
+
+      // A = Q1*B*(~Q1), then B = Q2*T*(~Q2), with Q1*Q2 formed in A
+      Sym_Rdto_Bnd< Lyt >( half, n, kd, A_, A_ld, AB_, AB_ld, tau, rest, exec );
+      Ort_From_Bnd< Lyt >( n, kd, A_, A_ld, tau, rest, exec );
+      Bnd_Rdto_Syt< Lyt >( Half::Lower, n, kd, AB_, AB_ld, w, e, A_, A_ld, exec );
+    }
+    else
+    {
+      Sym_Rdto_Syt_Blk< Lyt >( half, n, A_, A_ld, w, e, tau, rest, this->_config.nb );
+      Ort_From_Syt_Blk< Lyt >( half, n, A_, A_ld, tau, rest, this->_config.nb );
+    }
+
+    if( n >= this->_config.dcMin )
+    {
+      Syt_EigVecDC< Scalar, DefaultLyt > DC{};
+      DC.SetConfig( this->_config.dc );
+      return DC.template Solve< Lyt >( n, w, e, A_, A_ld, rest, exec );
+    }
+
+    Syt_EigVecQR< Scalar, DefaultLyt > QR{};
+    QR.SetConfig( this->_config.qr );
+    if( ! QR.template Solve< Lyt >( n, w, e, A_, A_ld, rest, exec ) )
+    { return false; }
+
+    _n_Impl::_Syt_EigSort< Lyt >( n, n, w, A_, A_ld );
+    return true;
+  }
+
+  /// <summary>
+  /// Solves as above, with the workspace taken from arena.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Blk_A,
+    typename T_Arr_w >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Blk_A> >,
+    Decay< DerefTypeOf<T_Arr_w>> >)
+  bool Solve( Half half, Size n, T_Blk_A A_, Stride A_ld, T_Arr_w w, Aux_Arena< Scalar > &arena ) const
+  { return this->template Solve< Lyt >( half, n, A_, A_ld, w, arena, Exec_Seq{} ); }
+
+  /// <summary>
+  /// Solves as above through exec, with the workspace taken from
+  /// arena.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Blk_A,
+    typename T_Arr_w,
+    typename T_Exec >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Blk_A> >,
+    Decay< DerefTypeOf<T_Arr_w>> >
+    && ExecContext< Decay<T_Exec> > )
+  bool Solve( Half half, Size n, T_Blk_A A_, Stride A_ld, T_Arr_w w, Aux_Arena< Scalar > &arena, T_Exec &&exec ) const
+  {
+    typename Aux_Arena< Scalar >::Frame frame{ arena };
+    return this->template Solve< Lyt >( half, n, A_, A_ld, w, arena.Take( this->WorkSize( n ) ), exec );
+  }
+
+  /// <summary>
+  /// Solves as above, with the workspace taken from the arena held by
+  /// the solver.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Blk_A,
+    typename T_Arr_w >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Blk_A> >,
+    Decay< DerefTypeOf<T_Arr_w>> >)
+  bool Solve( Half half, Size n, T_Blk_A A_, Stride A_ld, T_Arr_w w )
+  { return this->template Solve< Lyt >( half, n, A_, A_ld, w, this->_arena, Exec_Seq{} ); }
+
+  /// <summary>
+  /// Solves as above through exec, with the workspace taken from the
+  /// arena held by the solver.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Blk_A,
+    typename T_Arr_w,
+    typename T_Exec >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Blk_A> >,
+    Decay< DerefTypeOf<T_Arr_w>> >
+    && ExecContext< Decay<T_Exec> > )
+  bool Solve( Half half, Size n, T_Blk_A A_, Stride A_ld, T_Arr_w w, T_Exec &&exec )
+  { return this->template Solve< Lyt >( half, n, A_, A_ld, w, this->_arena, exec ); }
+};
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
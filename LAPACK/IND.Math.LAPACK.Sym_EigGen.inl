@@ -0,0 +1,271 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Eigensystem solver for the real symmetric-definite generalized
+/// eigenproblem
+///
+///    A*x = lambda*B*x
+///
+/// with A symmetric and B symmetric positive definite.
+///
+/// B is factored with <see cref="Sym_Fctr_Chol_Blk"/>, the problem
+/// reduced to the standard one C*y = lambda*y with
+/// <see cref="Sym_Rdto_Std_Blk"/>, whose eigensystem is taken with
+/// <see cref="Sym_Eig"/>, and the eigenvectors mapped back, x = inv(U)*y
+/// or x = inv(~L)*y, with <see cref="Tri_Solv_Mat"/>. They are
+/// B-orthonormal: (~X)*B*X = I.
+///
+/// The factor of B can be kept by the solver, with
+/// <see cref="Factor"/>, for a sequence of problems that share B; each
+/// of them then only takes the reduction, the eigensystem and the
+/// back-transformation. The workspace is passed in or taken from an
+/// <see cref="Aux_Arena"/>, as for <see cref="Sym_Eig"/>.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dsygvd</c>, with ITYPE = 1.
+/// </remarks>
+template< typename T_Scalar, typename DefaultLyt = ColMajor >
+requires( ! isComplex< T_Scalar > )
+class Sym_EigGen
+{
+public:
+
+  using Scalar = T_Scalar;
+
+  struct Config
+  {
+    // Panel width of the reduction to standard form
+    Size nb = Mat_Fctr_BlkSize;
+    Sym_Fctr_Chol_Config chol = {};
+    typename Sym_Eig< Scalar, DefaultLyt >::Config eig = {};
+  };
+
+private:
+
+  Config _config;
+
+  // The factor of B kept by Factor, in the given half of a dense
+  // DefaultLyt matrix of order _n; empty if there is none
+  std::vector< Scalar > _B;
+  Size _n = 0;
+  Half _half = Half::Lower;
+
+  Aux_Arena< Scalar > _arena;
+
+  // Reduces, solves and back-transforms, with B factored
+  template< typename Lyt, typename T_Blk_A, typename T_Blk_B, typename T_Arr_w >
+  Sym_Fctr_Chol_Result _Solve( Half half, Size n, T_Blk_A A_, Stride A_ld,
+    T_Blk_B B_, Stride B_ld, T_Arr_w w, Scalar *work ) const
+  {
+    Sym_Rdto_Std_Blk< Lyt >( half, n, A_, A_ld, B_, B_ld, this->_config.nb );
+
+    Sym_Eig< Scalar, DefaultLyt > EIG{};
+    EIG.SetConfig( this->_config.eig );
+    if( ! EIG.template Solve< Lyt >( half, n, A_, A_ld, w, work ) )
+    { return { false }; }
+
+    if( Half::Upper == half )
+    {
+      Tri_Solv_Mat< Lyt >( Side::Left, Half::Upper, Trnsp::No, Diag::NotUnit,
+        n, n, unit<Scalar>, B_, B_ld, A_, A_ld );
+    }
+    else
+    {
+      Tri_Solv_Mat< Lyt >( Side::Left, Half::Lower, Trnsp::Yes, Diag::NotUnit,
+        n, n, unit<Scalar>, B_, B_ld, A_, A_ld );
+    }
+
+    return { true };
+  }
+
+public:
+
+  constexpr const Config &config() const noexcept
+  { return this->_config; }
+  constexpr void SetConfig( const Config &config ) noexcept
+  { this->_config = config; }
+
+  Sym_EigGen() = default;
+  Sym_EigGen( const Sym_EigGen & ) = default;
+  Sym_EigGen( Sym_EigGen && ) noexcept = default;
+  Sym_EigGen &operator = ( const Sym_EigGen & ) = default;
+  Sym_EigGen &operator = ( Sym_EigGen && ) noexcept = default;
+  ~Sym_EigGen() = default;
+
+  /// <summary>
+  /// Size of the workspace Solve needs for order n under the
+  /// current configuration.
+  /// </summary>
+  Size WorkSize( Size n ) const
+  {
+    Sym_Eig< Scalar, DefaultLyt > EIG{};
+    EIG.SetConfig( this->_config.eig );
+    return EIG.WorkSize( n );
+  }
+
+  /// <summary>
+  /// Order of the factor of B kept by <see cref="Factor"/>, or 0 if
+  /// there is none.
+  /// </summary>
+  Size FactorOrder() const noexcept
+  { return this->_n; }
+
+  /// <summary>
+  /// Computes all eigenvalues and eigenvectors of A*x = lambda*B*x,
+  /// for n by n A and B, of which only the given half is referenced.
+  /// On output w holds the eigenvalues in increasing order, column i
+  /// of A the eigenvector of w[i], and B its Cholesky factor, as from
+  /// <see cref="Sym_Fctr_Chol"/>.
+  ///
+  /// work must hold <see cref="WorkSize"/>( n ) elements.
+  /// </summary>
+  /// <returns>
+  /// A <see cref="Sym_Fctr_Chol_Result"/>: its i is that of the
+  /// factorization of B, if B is not positive definite; it fails with
+  /// i &lt; 0 if the eigensolver failed to converge.
+  /// </returns>
+  template< typename Lyt = DefaultLyt,
+    typename T_Blk_A,
+    typename T_Blk_B,
+    typename T_Arr_w >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Blk_A> >,
+    Decay< DerefTypeOf<T_Blk_B> >,
+    Decay< DerefTypeOf<T_Arr_w> > >)
+  Sym_Fctr_Chol_Result Solve( Half half, Size n,
+    T_Blk_A A_, Stride A_ld,
+    T_Blk_B B_, Stride B_ld,
+    T_Arr_w w,
+    Scalar *work ) const
+  {
+    IND_MATH_TRACE_SCOPE( "Sym_EigGen", n, n, 0, 0, ( 4.0*n*n + 2.0*n )*sizeof( Scalar ) );
+
+    if( ( Half::Upper != half ) && ( Half::Lower != half ) )
+    { throw BadArgument{ "Sym_EigGen::Solve", 1 }; }
+
+    if( 0 == n ){ return { true }; }
+
+    const auto chol = Sym_Fctr_Chol_Blk< Lyt >( half, n, B_, B_ld, this->_config.chol );
+    if( ! chol ){ return chol; }
+
+    return this->template _Solve< Lyt >( half, n, A_, A_ld, B_, B_ld, w, work );
+  }
+
+  /// <summary>
+  /// Solves as above, with the workspace taken from arena.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Blk_A,
+    typename T_Blk_B,
+    typename T_Arr_w >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Blk_A> >,
+    Decay< DerefTypeOf<T_Blk_B> >,
+    Decay< DerefTypeOf<T_Arr_w> > >)
+  Sym_Fctr_Chol_Result Solve( Half half, Size n,
+    T_Blk_A A_, Stride A_ld,
+    T_Blk_B B_, Stride B_ld,
+    T_Arr_w w,
+    Aux_Arena< Scalar > &arena ) const
+  {
+    typename Aux_Arena< Scalar >::Frame frame{ arena };
+    return this->template Solve< Lyt >( half, n, A_, A_ld, B_, B_ld, w, arena.Take( this->WorkSize( n ) ) );
+  }
+
+  /// <summary>
+  /// Factors the n by n B, of which only the given half is referenced,
+  /// and keeps the factor, in place of any kept before, for the Solve
+  /// overloads that take no B. B is not modified. If B is not positive
+  /// definite, no factor is kept.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Blk_B >
+  requires( areTheSame< Scalar, Decay< DerefTypeOf<T_Blk_B> > > )
+  Sym_Fctr_Chol_Result Factor( Half half, Size n, T_Blk_B B_, Stride B_ld )
+  {
+    if( ( Half::Upper != half ) && ( Half::Lower != half ) )
+    { throw BadArgument{ "Sym_EigGen::Factor", 1 }; }
+
+    const Stride ld = DefaultLyt::DenseLd( n, n );
+
+    this->_B.resize( n*n );
+    for( Index j = 0; j < (Index)n; ++j )
+    {
+      const Index i0 = ( Half::Upper == half ) ? 0 : j;
+      const Index i1 = ( Half::Upper == half ) ? j+1 : (Index)n;
+      for( Index i = i0; i < i1; ++i )
+      { DefaultLyt::MatRef( this->_B.data(), i, j, ld ) = Lyt::MatRef( B_, i, j, B_ld ); }
+    }
+
+    const auto chol = Sym_Fctr_Chol_Blk< DefaultLyt >( half, n, this->_B.data(), ld, this->_config.chol );
+    this->_n = chol ? n : 0;
+    this->_half = half;
+    if( ! chol ){ this->_B.clear(); }
+    return chol;
+  }
+
+  /// <summary>
+  /// Computes all eigenvalues and eigenvectors of A*x = lambda*B*x as
+  /// above, with the factor of B kept by <see cref="Factor"/>. A is
+  /// of its order, in DefaultLyt, and in the half B was given in.
+  ///
+  /// work must hold <see cref="WorkSize"/>( <see cref="FactorOrder"/>() )
+  /// elements. Throws <see cref="InternalError"/> if no factor is kept.
+  /// </summary>
+  template< typename T_Blk_A,
+    typename T_Arr_w >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Blk_A> >,
+    Decay< DerefTypeOf<T_Arr_w> > >)
+  Sym_Fctr_Chol_Result Solve( T_Blk_A A_, Stride A_ld, T_Arr_w w, Scalar *work ) const
+  {
+    const Size n = this->_n;
+
+    IND_MATH_TRACE_SCOPE( "Sym_EigGen", n, n, 0, 0, ( 2.0*n*n + 2.0*n )*sizeof( Scalar ) );
+
+    if( this->_B.empty() )
+    { throw InternalError{ "Sym_EigGen::Solve: no factor of B" }; }
+
+    return this->template _Solve< DefaultLyt >( this->_half, n, A_, A_ld,
+      (const Scalar *)this->_B.data(), DefaultLyt::DenseLd( n, n ), w, work );
+  }
+
+  /// <summary>
+  /// Solves as above with the kept factor of B, with the workspace
+  /// taken from arena.
+  /// </summary>
+  template< typename T_Blk_A,
+    typename T_Arr_w >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Blk_A> >,
+    Decay< DerefTypeOf<T_Arr_w> > >)
+  Sym_Fctr_Chol_Result Solve( T_Blk_A A_, Stride A_ld, T_Arr_w w, Aux_Arena< Scalar > &arena ) const
+  {
+    typename Aux_Arena< Scalar >::Frame frame{ arena };
+    return this->Solve( A_, A_ld, w, arena.Take( this->WorkSize( this->_n ) ) );
+  }
+
+  /// <summary>
+  /// Solves as above with the kept factor of B, with the workspace
+  /// taken from the arena held by the solver.
+  /// </summary>
+  template< typename T_Blk_A,
+    typename T_Arr_w >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Blk_A> >,
+    Decay< DerefTypeOf<T_Arr_w> > >)
+  Sym_Fctr_Chol_Result Solve( T_Blk_A A_, Stride A_ld, T_Arr_w w )
+  { return this->Solve( A_, A_ld, w, this->_arena ); }
+};
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
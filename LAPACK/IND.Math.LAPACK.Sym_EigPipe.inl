@@ -0,0 +1,246 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Pipelined eigensystem solver for a stream of independent symmetric
+/// matrices: each goes through <see cref="Sym_Rdto_Syt_Blk"/>,
+/// <see cref="Ort_From_Syt_Blk"/> and <see cref="Syt_EigVecQR"/>,
+/// each stage on threads of its own, so that consecutive matrices are
+/// in different stages at once.
+///
+/// Submit queues a matrix and returns at once; the result is the same
+/// as that of <see cref="Sym_Eig"/>, delivered through the returned
+/// future and, if given, the completion callback.
+/// </summary>
+/// <remarks>
+/// A matrix moves on as soon as the next stage is free, so the
+/// throughput is that of the slowest stage, usually the QR iteration,
+/// which config.solveThreads can spread over several threads. Each
+/// thread keeps an <see cref="Aux_Arena"/> for its workspace, so that
+/// a stream of matrices of the same order does not allocate beyond e
+/// and tau of each. The destructor finishes the matrices submitted.
+/// </remarks>
+template< typename T_Scalar, typename DefaultLyt = ColMajor >
+requires( ! isComplex< T_Scalar > )
+class Sym_EigPipe
+{
+public:
+
+  using Scalar = T_Scalar;
+
+  struct Config
+  {
+    // Panel width of the reduction and of the forming of Q
+    Size nb = Mat_Fctr_BlkSize;
+
+    typename Syt_EigVecQR< Scalar, DefaultLyt >::Config qr = {};
+
+    // Threads of the QR iteration stage; the others have one each
+    Size solveThreads = 1;
+  };
+
+  // Called with the result of a matrix on the thread that finished
+  // it, before its future is ready, exactly once: false also if a
+  // stage threw, the exception going to the future. Must not throw.
+  using Callback = std::function< void( bool ) >;
+
+private:
+
+  static constexpr Size _stageCount = 3;
+
+  struct _Job
+  {
+    Half half;
+    Size n;
+    Scalar *A_;
+    Stride A_ld;
+    Scalar *w;
+
+    std::vector< Scalar > e, tau;
+    std::promise< bool > promise;
+    Callback done;
+  };
+
+  using _JobPtr = std::unique_ptr< _Job >;
+
+  struct _Queue
+  {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque< _JobPtr > jobs;
+    bool closed = false;
+
+    void Push( _JobPtr job )
+    {
+      {
+        std::lock_guard< std::mutex > lock{ this->mutex };
+        this->jobs.push_back( std::move( job ) );
+      }
+      this->cv.notify_one();
+    }
+
+    // The next job, or none once closed and empty
+    _JobPtr Pop()
+    {
+      std::unique_lock< std::mutex > lock{ this->mutex };
+      this->cv.wait( lock, [this]{ return this->closed || ! this->jobs.empty(); } );
+      if( this->jobs.empty() ){ return {}; }
+
+      auto job = std::move( this->jobs.front() );
+      this->jobs.pop_front();
+      return job;
+    }
+
+    void Close()
+    {
+      {
+        std::lock_guard< std::mutex > lock{ this->mutex };
+        this->closed = true;
+      }
+      this->cv.notify_all();
+    }
+  };
+
+  Config _config;
+  _Queue _queues[ _stageCount ];
+  std::vector< std::thread > _threads[ _stageCount ];
+
+  static void _Finish( _Job &job, bool success, std::exception_ptr error = {} )
+  {
+    if( job.done ){ job.done( success ); }
+    if( error ){ job.promise.set_exception( error ); }
+    else { job.promise.set_value( success ); }
+  }
+
+  bool _Stage( Size stage, _Job &job, Aux_Arena< Scalar > &arena ) const
+  {
+    using Lyt = DefaultLyt;
+
+    const Size n = job.n;
+    const Size nb = this->_config.nb;
+
+    if( 0 == stage )
+    {
+      Sym_Rdto_Syt_Blk< Lyt >( job.half, n, job.A_, job.A_ld, job.w, job.e.data(), job.tau.data(),
+        arena.Take( Sym_Rdto_Syt_Blk_WorkSize( n, nb ) ), nb );
+      return true;
+    }
+
+    if( 1 == stage )
+    {
+      Ort_From_Syt_Blk< Lyt >( job.half, n, job.A_, job.A_ld, job.tau.data(),
+        arena.Take( Ort_From_Syt_Blk_WorkSize( n, nb ) ), nb );
+      return true;
+    }
+
+    Syt_EigVecQR< Scalar, DefaultLyt > QR{};
+    QR.SetConfig( this->_config.qr );
+    if( ! QR.template Solve< Lyt >( n, job.w, job.e.data(), job.A_, job.A_ld, arena ) )
+    { return false; }
+
+    _n_Impl::_Syt_EigSort< Lyt >( n, n, job.w, job.A_, job.A_ld );
+    return true;
+  }
+
+  void _Run( Size stage )
+  {
+    Aux_Arena< Scalar > arena{};
+
+    while( auto job = this->_queues[ stage ].Pop() )
+    {
+      bool success;
+      try
+      {
+        typename Aux_Arena< Scalar >::Frame frame{ arena };
+        success = this->_Stage( stage, *job, arena );
+      }
+      catch( ... )
+      {
+        _Finish( *job, false, std::current_exception() );
+        continue;
+      }
+
+      if( success && ( stage+1 < _stageCount ) )
+      { this->_queues[ stage+1 ].Push( std::move( job ) ); }
+      else
+      { _Finish( *job, success ); }
+    }
+  }
+
+public:
+
+  explicit Sym_EigPipe( const Config &config = {} )
+  : _config{ config }
+  {
+    for( Size s = 0; s < _stageCount; ++s )
+    {
+      const Size count = ( s+1 == _stageCount ) ? Max( config.solveThreads, (Size)1 ) : 1;
+      for( Size t = 0; t < count; ++t )
+      { this->_threads[s].emplace_back( [this, s]{ this->_Run( s ); } ); }
+    }
+  }
+
+  Sym_EigPipe( const Sym_EigPipe & ) = delete;
+  Sym_EigPipe &operator=( const Sym_EigPipe & ) = delete;
+
+  ~Sym_EigPipe()
+  {
+    // Stage by stage, so that each drains into the next before it closes
+    for( Size s = 0; s < _stageCount; ++s )
+    {
+      this->_queues[s].Close();
+      for( auto &thread : this->_threads[s] ){ thread.join(); }
+    }
+  }
+
+  const Config &config() const noexcept
+  { return this->_config; }
+
+  /// <summary>
+  /// Queues the n by n symmetric matrix A, of which only the given
+  /// half is referenced, and returns at once. Once the future is
+  /// ready, w holds the eigenvalues in increasing order and column i
+  /// of A the normalized eigenvector of w[i], as for
+  /// <see cref="Sym_Eig"/>; its value is false if the QR iteration
+  /// failed to converge. If a stage throws, the future holds the
+  /// exception and done gets false. A and w must stay untouched until
+  /// then.
+  /// </summary>
+  std::future< bool > Submit( Half half, Size n, Scalar *A_, Stride A_ld, Scalar *w, Callback done = {} )
+  {
+    if( ( Half::Upper != half ) && ( Half::Lower != half ) )
+    { throw BadArgument{ "Sym_EigPipe::Submit", 1 }; }
+
+    auto job = std::make_unique< _Job >();
+    job->half = half;
+    job->n = n;
+    job->A_ = A_;
+    job->A_ld = A_ld;
+    job->w = w;
+    job->done = std::move( done );
+
+    auto future = job->promise.get_future();
+
+    if( 0 == n )
+    {
+      _Finish( *job, true );
+      return future;
+    }
+
+    job->e.resize( n );
+    job->tau.resize( n );
+    this->_queues[0].Push( std::move( job ) );
+    return future;
+  }
+};
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
@@ -0,0 +1,360 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Default cap on the Jacobi sweeps of <see cref="Sym_EigSmall"/>
+/// and its batched forms; orders up to 8 take fewer than 10.
+/// </summary>
+inline constexpr Size Sym_EigSmall_SweepMax = 32;
+
+namespace _n_Impl {
+
+  // Cyclic Jacobi on W symmetric N by N matrices side by side: element
+  // (i,j) of lane l is a[(i + j*N)*W + l], and both halves are kept up
+  // to date. On exit a is diagonal and v holds the eigenvectors in
+  // the same layout.
+  //
+  // The rotation for (p,q) is computed from
+  //
+  //    t = sign(tau)*2*a(p,q)/( |tau| + sqrt( tau*tau + 4*a(p,q)**2 ) ),
+  //
+  // tau = a(q,q) - a(p,p), which needs no division by a(p,q), and
+  // a lane skips it (t = 0, an exact no-op) once a(p,q) is negligible
+  // relative to sqrt(|a(p,p)*a(q,q)|). The lane loops therefore carry
+  // no branches and vectorize. Returns false if some lane still rotated
+  // in the last of sweepMax sweeps.
+  template< Size N, Size W, typename T_Scalar >
+  constexpr bool _Sym_EigSmall_Jac(
+    T_Scalar *__restrict a,
+    T_Scalar *__restrict v,
+    Size sweepMax )
+  {
+    auto A = [&]( Index i, Index j ) -> T_Scalar *
+    { return a + ( i + j*(Index)N )*(Index)W; };
+    auto V = [&]( Index i, Index j ) -> T_Scalar *
+    { return v + ( i + j*(Index)N )*(Index)W; };
+
+    constexpr T_Scalar eps = std::numeric_limits< T_Scalar >::epsilon();
+    constexpr T_Scalar one = unit< T_Scalar >;
+
+    for( Index j = 0; j < (Index)N; ++j )
+    {
+      for( Index i = 0; i < (Index)N; ++i )
+      {
+        for( Size l = 0; l < W; ++l )
+        { V(i,j)[l] = ( i == j ) ? one : T_Scalar{}; }
+      }
+    }
+
+    for( Size sweep = 0; sweep < sweepMax; ++sweep )
+    {
+      bool rotated = false;
+
+      for( Index p = 0; p+1 < (Index)N; ++p )
+      {
+        for( Index q = p+1; q < (Index)N; ++q )
+        {
+          T_Scalar c[W], s[W], t[W];
+          Size active = 0;
+
+          for( Size l = 0; l < W; ++l )
+          {
+            const T_Scalar apq = A(p,q)[l];
+            const T_Scalar tau = A(q,q)[l] - A(p,p)[l];
+            const bool skip = ( apq*apq <= eps*eps*Abs( A(p,p)[l]*A(q,q)[l] ) );
+            const T_Scalar den = Abs( tau ) + Sqrt( tau*tau + 4*apq*apq ) + ( skip ? one : T_Scalar{} );
+            const T_Scalar tl = skip ? T_Scalar{} : ( ( tau < 0 ) ? -2*apq : 2*apq )/den;
+            const T_Scalar cl = one/Sqrt( one + tl*tl );
+            t[l] = tl;
+            c[l] = cl;
+            s[l] = tl*cl;
+            active += skip ? 0 : 1;
+          }
+
+          if( 0 == active ){ continue; }
+          rotated = true;
+
+          for( Size l = 0; l < W; ++l )
+          {
+            const T_Scalar apq = A(p,q)[l];
+            A(p,p)[l] -= t[l]*apq;
+            A(q,q)[l] += t[l]*apq;
+            A(p,q)[l] = T_Scalar{};
+            A(q,p)[l] = T_Scalar{};
+          }
+
+          auto Rot = [&]( Index r )
+          {
+            for( Size l = 0; l < W; ++l )
+            {
+              const T_Scalar x = A(r,p)[l];
+              const T_Scalar y = A(r,q)[l];
+              A(r,p)[l] = c[l]*x - s[l]*y;
+              A(r,q)[l] = s[l]*x + c[l]*y;
+              A(p,r)[l] = A(r,p)[l];
+              A(q,r)[l] = A(r,q)[l];
+            }
+          };
+
+          // r runs round p and q in three ranges, keeping branches out
+          // of the loops.
+          for( Index r = 0; r < p; ++r ){ Rot( r ); }
+          for( Index r = p+1; r < q; ++r ){ Rot( r ); }
+          for( Index r = q+1; r < (Index)N; ++r ){ Rot( r ); }
+
+          for( Index r = 0; r < (Index)N; ++r )
+          {
+            for( Size l = 0; l < W; ++l )
+            {
+              const T_Scalar x = V(r,p)[l];
+              const T_Scalar y = V(r,q)[l];
+              V(r,p)[l] = c[l]*x - s[l]*y;
+              V(r,q)[l] = s[l]*x + c[l]*y;
+            }
+          }
+        }
+      }
+
+      if( ! rotated ){ return true; }
+    }
+
+    return false;
+  }
+
+  // Sorts the eigenvalues w in ascending order, with the columns of v,
+  // lane by lane; w(k) of lane l is w[k*W + l]. Odd-even transposition
+  // with selects, so the lane loops stay branch-free.
+  template< Size N, Size W, typename T_Scalar >
+  constexpr void _Sym_EigSmall_SortW(
+    T_Scalar *__restrict v,
+    T_Scalar *__restrict w )
+  {
+    for( Index pass = 0; pass < (Index)N; ++pass )
+    {
+      for( Index k = pass%2; k+1 < (Index)N; k += 2 )
+      {
+        bool swp[W];
+        for( Size l = 0; l < W; ++l )
+        {
+          const T_Scalar w0 = w[k*W + l], w1 = w[(k+1)*W + l];
+          swp[l] = ( w1 < w0 );
+          w[k*W + l] = swp[l] ? w1 : w0;
+          w[(k+1)*W + l] = swp[l] ? w0 : w1;
+        }
+
+        for( Index r = 0; r < (Index)N; ++r )
+        {
+          T_Scalar *v0 = v + ( r + k*(Index)N )*(Index)W;
+          T_Scalar *v1 = v + ( r + (k+1)*(Index)N )*(Index)W;
+          for( Size l = 0; l < W; ++l )
+          {
+            const T_Scalar x = v0[l], y = v1[l];
+            v0[l] = swp[l] ? y : x;
+            v1[l] = swp[l] ? x : y;
+          }
+        }
+      }
+    }
+  }
+
+  // Sorts the eigenvalues on the diagonal of a into w, as above.
+  template< Size N, Size W, typename T_Scalar >
+  constexpr void _Sym_EigSmall_Sort(
+    const T_Scalar *__restrict a,
+    T_Scalar *__restrict v,
+    T_Scalar *__restrict w )
+  {
+    for( Index k = 0; k < (Index)N; ++k )
+    {
+      for( Size l = 0; l < W; ++l )
+      { w[k*W + l] = a[( k + k*(Index)N )*(Index)W + l]; }
+    }
+
+    _Sym_EigSmall_SortW< N, W >( v, w );
+  }
+
+}// namespace _n_Impl
+
+/// <summary>
+/// Computes all eigenvalues and eigenvectors of a real symmetric
+/// matrix A of order N fixed at compile time, by cyclic Jacobi.
+///
+/// Only the half of A given by half is referenced. On exit w holds the
+/// eigenvalues in ascending order and A the orthonormal eigenvectors,
+/// column k for w(k), as for <see cref="Sym_Eig"/>.
+/// </summary>
+///<returns>
+/// false if the iteration did not settle in sweepMax sweeps.
+/// </returns>
+/// <remarks>
+/// Meant for N from 2 to about 8 (3 by 3 tensors in particular), where
+/// the tridiagonal chain of <see cref="Sym_Eig"/> costs more in
+/// reflectors and workspace than the arithmetic it saves. The matrix
+/// and the vectors live in local arrays, and with N fixed every loop
+/// has a constant trip count. Jacobi also yields small eigenvalues to
+/// high relative accuracy.
+///
+/// The rotations square the entries of A, so they must be below
+/// sqrt( maxValue )/2 in magnitude. For many matrices see
+/// <see cref="Sym_EigSmall_Bat"/> and <see cref="Sym_EigSmall_Ilv"/>.
+/// </remarks>
+template< Size N,
+  typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_w >
+requires( ( N > 0 ) && ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_w>> > )
+constexpr bool Sym_EigSmall( Half half,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_w w,
+  Size sweepMax = Sym_EigSmall_SweepMax )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+  auto A = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( A_, i, j, A_ld ); };
+
+  if( Half::Both == half ){ throw BadArgument{ "Sym_EigSmall", 1 }; }
+
+  std::array< Scalar, N*N > a{}, v{};
+  std::array< Scalar, N > d{};
+
+  const bool upper = ( Half::Upper == half );
+  for( Index j = 0; j < (Index)N; ++j )
+  {
+    for( Index i = 0; i < (Index)N; ++i )
+    { a[i + j*N] = ( ( i <= j ) == upper ) ? A(i,j) : A(j,i); }
+  }
+
+  const bool converged = _n_Impl::_Sym_EigSmall_Jac< N, 1 >( a.data(), v.data(), sweepMax );
+  _n_Impl::_Sym_EigSmall_Sort< N, 1 >( a.data(), v.data(), d.data() );
+
+  for( Index j = 0; j < (Index)N; ++j )
+  {
+    w[j] = d[j];
+    for( Index i = 0; i < (Index)N; ++i )
+    { A(i,j) = v[i + j*N]; }
+  }
+
+  return converged;
+}
+
+/// <summary>
+/// Computes the eigensystems of count symmetric N-by-N matrices by
+/// <see cref="Sym_EigSmall"/>; matrix b is stored at A_ + b*A_bs with
+/// leading dimension A_ld, and its eigenvalues at w_ + b*w_bs.
+/// </summary>
+///<returns>
+/// false if the iteration did not settle for some matrix.
+/// </returns>
+template< Size N,
+  typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_w >
+requires( ( N > 0 ) && ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_w>> > )
+constexpr bool Sym_EigSmall_Bat( Half half,
+  Size count,
+  T_Blk_A A_, Stride A_ld, Stride A_bs,
+  T_Arr_w w_, Stride w_bs,
+  Size sweepMax = Sym_EigSmall_SweepMax )
+{
+  if( Half::Both == half ){ throw BadArgument{ "Sym_EigSmall_Bat", 1 }; }
+  if( A_ld < Lyt::DenseLd( N, N ) )
+  { throw BadArgument{ "Sym_EigSmall_Bat", 4 }; }
+  if( A_bs < (Stride)(N*N) )
+  { throw BadArgument{ "Sym_EigSmall_Bat", 5 }; }
+  if( w_bs < (Stride)N )
+  { throw BadArgument{ "Sym_EigSmall_Bat", 7 }; }
+
+  bool converged = true;
+  for( Index b = 0; b < (Index)count; ++b )
+  {
+    converged = Sym_EigSmall< N, Lyt >( half,
+      A_ + b*A_bs, A_ld, w_ + b*w_bs, sweepMax ) && converged;
+  }
+  return converged;
+}
+
+/// <summary>
+/// Computes the eigensystems of count symmetric N-by-N matrices stored
+/// interleaved as for <see cref="Mat_Fctr_LU_Ilv"/>: with
+/// W = Mat_LU_Ilv_Width&lt;T_Scalar&gt;, element (i,j) of matrix b is
+///
+///   A[(b/W)*N*N*W + (i + j*N)*W + b%W]
+///
+/// and eigenvalue k of matrix b is w[(b/W)*N*W + k*W + b%W]. On exit
+/// A holds the eigenvectors in the same layout, as for
+/// <see cref="Sym_EigSmall"/>.
+///
+/// The W matrices of a group run the Jacobi sweeps in lockstep, one
+/// lane per matrix; a lane whose rotation is negligible applies an
+/// exact identity instead of branching, so the arithmetic runs at full
+/// SIMD width. A group stops when none of its lanes rotates.
+/// </summary>
+///<returns>
+/// false if the iteration did not settle for some group.
+/// </returns>
+/// <remarks>
+/// A and w must be sized for whole groups (see
+/// <see cref="Mat_LU_Ilv_Size"/>); lanes past count are computed
+/// too, so their contents must be finite. GCC and Clang vectorize the
+/// square roots of the rotations only under -fno-math-errno.
+/// </remarks>
+template< Size N,
+  typename T_Scalar >
+requires( ( N > 0 ) && ! isComplex< T_Scalar > )
+constexpr bool Sym_EigSmall_Ilv( Half half,
+  Size count,
+  T_Scalar *A,
+  T_Scalar *w,
+  Size sweepMax = Sym_EigSmall_SweepMax )
+{
+  if( Half::Both == half ){ throw BadArgument{ "Sym_EigSmall_Ilv", 1 }; }
+
+  constexpr Size W = Mat_LU_Ilv_Width< T_Scalar >;
+
+  const bool upper = ( Half::Upper == half );
+
+  bool converged = true;
+
+  for( Size g = 0; g*W < count; ++g )
+  {
+    T_Scalar *A_g = A + g*N*N*W;
+
+    T_Scalar a[N*N*W], v[N*N*W];
+
+    for( Size j = 0; j < N; ++j )
+    {
+      for( Size i = 0; i < N; ++i )
+      {
+        const T_Scalar *src = ( ( i <= j ) == upper ) ? A_g + ( i + j*N )*W : A_g + ( j + i*N )*W;
+        for( Size l = 0; l < W; ++l )
+        { a[( i + j*N )*W + l] = src[l]; }
+      }
+    }
+
+    converged = _n_Impl::_Sym_EigSmall_Jac< N, W >( a, v, sweepMax ) && converged;
+    _n_Impl::_Sym_EigSmall_Sort< N, W >( a, v, w + g*N*W );
+
+    for( Size k = 0; k < N*N*W; ++k )
+    { A_g[k] = v[k]; }
+  }
+
+  return converged;
+}
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
@@ -0,0 +1,251 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Calculates the size of the host workspace required for
+/// <see cref="Sym_Rdto_Syt_Dev"/>: the panel and its W, n by nb each.
+/// </summary>
+inline constexpr Size Sym_Rdto_Syt_Dev_WorkSize( Size n, Size nb = Mat_Fctr_Dev_PnlSize ) noexcept
+{ return 2*Max( n, (Size)1 )*nb; }
+
+/// <summary>
+/// Tridiagonal reduction of a real symmetric matrix A in the memory of
+/// a device (see <see cref="Device"/>), with the same result as
+/// <see cref="Sym_Rdto_Syt"/>; d, e and tau are on the host.
+///
+/// Each panel of nb columns is reduced on the host as in
+/// <see cref="Sym_Rdto_Syt_Blk"/>, but for its products with the
+/// unreduced part of A, which run on the device; the rest of A is then
+/// updated on the device by one <see cref="Sym_Rank2kUpd"/>. The last
+/// columns, fewer than nb, are reduced on the host.
+/// </summary>
+/// <remarks>
+/// Based on the MAGMA routine <c>dsytrd_gpu</c>, over <c>dsytrd</c>.
+///
+/// Only half == Half::Lower is supported. Each column of a panel moves
+/// one vector each way, and the panel itself once each way.
+///
+/// work must hold <see cref="Sym_Rdto_Syt_Dev_WorkSize"/>( n, nb ) elements.
+/// </remarks>
+template< typename T_Device,
+  typename T_Arr_d,
+  typename T_Arr_e,
+  typename T_Arr_tau >
+requires( Device< T_Device >
+  && ! isComplex< typename T_Device::Scalar >
+  && areTheSame< typename T_Device::Scalar,
+  Decay<DerefTypeOf<T_Arr_d>>,
+  Decay<DerefTypeOf<T_Arr_e>>,
+  Decay<DerefTypeOf<T_Arr_tau>> > )
+void Sym_Rdto_Syt_Dev( Half half,
+  Size n,
+  Dev_Ptr< T_Device > A_, Stride A_ld,
+  T_Arr_d d, T_Arr_e e, T_Arr_tau tau,
+  typename T_Device::Scalar *work,
+  Size nb = Mat_Fctr_Dev_PnlSize )
+{
+  using Scalar = typename T_Device::Scalar;
+
+  IND_MATH_TRACE_SCOPE( "Sym_Rdto_Syt_Dev", n, n, nb,
+    4.0/3.0*n*n*n, (double)n*(n+1)*sizeof( Scalar ) );
+
+  if( Half::Lower != half ){ throw BadArgument{ "Sym_Rdto_Syt_Dev", 1 }; }
+  if( 0 == nb ){ throw BadArgument{ "Sym_Rdto_Syt_Dev", 9 }; }
+
+  if( 0 == n ){ return; }
+
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return ColMajor::BlkPtr( A_, i, j, A_ld ); };
+
+  T_Device &device = *A_.device;
+
+  const Scalar one = unit< Scalar >;
+
+  // The panel, rows i:n-1 of columns i:i+nb-1, and W on the host
+  Scalar *P_ = work;
+  Scalar *W_ = work + n*nb;
+  const Stride P_ld = (Stride)n;
+
+  auto P = [&]( auto i, auto j ) -> auto &
+  { return ColMajor::MatRef( P_, i, j, P_ld ); };
+
+  // W, and the vectors of the products, on the device
+  const Dev_Buffer< T_Device > W_dev{ device, n*nb };
+  const Dev_Buffer< T_Device > v_dev{ device, n };
+  const Dev_Buffer< T_Device > w_dev{ device, n };
+
+  Size i = 0;
+  for( ; i+nb < n; i += nb )
+  {
+    Mat_Copy< ColMajor, ColMajor >( n-i, nb, A_Blk(i,i), A_ld, P_, P_ld );
+
+    _n_Impl::_Sym_Rdto_Syt_Pnl< ColMajor >( Half::Lower, n-i, nb,
+      P_, P_ld, e+i, tau+i, W_, P_ld,
+      [&]( Index i0, Size r, Scalar *v, Scalar *w )
+      {
+        Mat_Copy< ColMajor, ColMajor >( r, 1, v, (Stride)r, v_dev.Ptr(), (Stride)r );
+        Sym_VecMul< ColMajor >( Half::Lower, r, one, A_Blk(i+i0,i+i0), A_ld,
+          v_dev.Ptr(), 1, Scalar{}, w_dev.Ptr(), 1 );
+        Mat_Copy< ColMajor, ColMajor >( r, 1, w_dev.Ptr(), (Stride)r, w, (Stride)r );
+      } );
+
+    // The subdiagonal back in the panel but for its last element,
+    // whose 1 the update takes as part of V
+    for( Size j = 0; j < nb; ++j )
+    {
+      d[i+j] = P(j,j);
+      if( j+1 < nb ){ P(j+1,j) = e[i+j]; }
+    }
+
+    Mat_Copy< ColMajor, ColMajor >( n-i, nb, P_, P_ld, A_Blk(i,i), A_ld );
+    Mat_Copy< ColMajor, ColMajor >( n-i-nb, nb, W_ + nb, P_ld, W_dev.Ptr(), P_ld );
+
+    // A := A - V*(~W) - W*(~V) on A(i+nb:n-1,i+nb:n-1)
+    Sym_Rank2kUpd< ColMajor >( Half::Lower, Trnsp::No, n-(i+nb), nb, -one,
+      A_Blk(i+nb,i), A_ld, W_dev.Ptr(), P_ld, one, A_Blk(i+nb,i+nb), A_ld );
+
+    Mat_Copy< ColMajor, ColMajor >( 1, 1, e + (i+nb-1), 1, A_Blk(i+nb,i+nb-1), A_ld );
+  }
+
+  Mat_Copy< ColMajor, ColMajor >( n-i, n-i, A_Blk(i,i), A_ld, P_, P_ld );
+  Sym_Rdto_Syt< ColMajor >( Half::Lower, n-i, P_, P_ld, d+i, e+i, tau+i );
+  Mat_Copy< ColMajor, ColMajor >( n-i, n-i, P_, P_ld, A_Blk(i,i), A_ld );
+
+  device.Sync();
+}
+
+/// <summary>
+/// Calculates the size of the host workspace required for
+/// <see cref="Sym_Eig_Dev"/>.
+/// </summary>
+inline constexpr Size Sym_Eig_Dev_WorkSize( Size n, Size nb = Mat_Fctr_Dev_PnlSize,
+  Size dcMin = Sym_Eig_DCMin ) noexcept
+{
+  if( 0 == n ){ return 0; }
+
+  const Size eig = ( n >= dcMin ) ? Syt_EigVecDC_WorkSize( n ) : Syt_EigVecQR_WorkSize( n );
+
+  // e, tau and Z, then the workspace of the stages
+  return 2*n + n*n + Max( Max( Sym_Rdto_Syt_Dev_WorkSize( n, nb ), eig ), n*nb + nb*nb );
+}
+
+/// <summary>
+/// Computes all eigenvalues and eigenvectors of the n by n symmetric
+/// matrix A in the memory of a device (see <see cref="Device"/>), of
+/// which only the lower half is referenced, as
+/// <see cref="Sym_Eig"/> does: on output w, on the host, holds the
+/// eigenvalues in increasing order, and column i of A the normalized
+/// eigenvector of w[i].
+///
+/// A is reduced to tridiagonal form by <see cref="Sym_Rdto_Syt_Dev"/>;
+/// the tridiagonal eigenproblem is solved on the host, with
+/// <see cref="Syt_EigVecDC"/> from order dcMin on and with
+/// <see cref="Syt_EigVecQR"/> below it; and its eigenvectors are
+/// uploaded and multiplied by the orthogonal matrix of the reduction
+/// on the device, in block reflectors of nb columns.
+/// </summary>
+///<returns>
+/// false if the tridiagonal eigenproblem did not converge.
+/// </returns>
+/// <remarks>
+/// Based on the MAGMA routine <c>dsyevd_gpu</c>.
+///
+/// Needs n*n + n*nb elements of device memory besides A.
+/// work must hold <see cref="Sym_Eig_Dev_WorkSize"/>( n, nb, dcMin ) elements.
+/// </remarks>
+template< typename T_Device,
+  typename T_Arr_w >
+requires( Device< T_Device >
+  && ! isComplex< typename T_Device::Scalar >
+  && areTheSame< typename T_Device::Scalar, Decay<DerefTypeOf<T_Arr_w>> > )
+bool Sym_Eig_Dev( Half half,
+  Size n,
+  Dev_Ptr< T_Device > A_, Stride A_ld,
+  T_Arr_w w,
+  typename T_Device::Scalar *work,
+  Size nb = Mat_Fctr_Dev_PnlSize,
+  Size dcMin = Sym_Eig_DCMin )
+{
+  using Scalar = typename T_Device::Scalar;
+
+  IND_MATH_TRACE_SCOPE( "Sym_Eig_Dev", n, n, nb, 0, ( 2.0*n*n + 2.0*n )*sizeof( Scalar ) );
+
+  if( Half::Lower != half ){ throw BadArgument{ "Sym_Eig_Dev", 1 }; }
+  if( 0 == nb ){ throw BadArgument{ "Sym_Eig_Dev", 7 }; }
+
+  if( 0 == n ){ return true; }
+
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return ColMajor::BlkPtr( A_, i, j, A_ld ); };
+
+  T_Device &device = *A_.device;
+
+  const Scalar one = unit< Scalar >;
+
+  Scalar *e = work;
+  Scalar *tau = work + n;
+  Scalar *Z_ = work + 2*n;
+  Scalar *rest = Z_ + n*n;
+  const Stride Z_ld = (Stride)n;
+
+  Sym_Rdto_Syt_Dev( Half::Lower, n, A_, A_ld, w, e, tau, rest, nb );
+
+  Mat_Fill< ColMajor >( Half::Both, n, n, Scalar{}, one, Z_, Z_ld );
+
+  if( n >= dcMin )
+  {
+    if( ! Syt_EigVecDC< Scalar >{}.template Solve< ColMajor >( n, w, e, Z_, Z_ld, rest ) )
+    { return false; }
+  }
+  else
+  {
+    if( ! Syt_EigVecQR< Scalar >{}.template Solve< ColMajor >( n, w, e, Z_, Z_ld, rest ) )
+    { return false; }
+    _n_Impl::_Syt_EigSort< ColMajor >( n, n, w, Z_, Z_ld );
+  }
+
+  // Z := Q*Z, Q = H(0) H(1) . . . H(n-2) with the vectors of H(i) in
+  // A(i+1:n-1,i), last block first
+  const Dev_Buffer< T_Device > Z_dev{ device, n*n };
+  const Dev_Buffer< T_Device > T_dev{ device, nb*nb };
+  const Dev_Buffer< T_Device > W_dev{ device, nb*n };
+
+  Mat_Copy< ColMajor, ColMajor >( n, n, Z_, Z_ld, Z_dev.Ptr(), Z_ld );
+
+  Scalar *V_ = rest;
+  Scalar *T_ = rest + n*nb;
+  const Stride T_ld = (Stride)nb;
+
+  for( Index i = (Index)( ( Max( n, (Size)2 )-2 )/nb*nb ); ( i >= 0 ) && ( n > 1 ); i -= (Index)nb )
+  {
+    const Size ib = Min( nb, n-1-(Size)i );
+    const Size mi = n-1-(Size)i;
+
+    Mat_Copy< ColMajor, ColMajor >( mi, ib, A_Blk(i+1,i), A_ld, V_, Z_ld );
+    Rfl_BlkGen< ColMajor >( Direct::Fwd, Store::ByCol, mi, ib, V_, Z_ld, tau + i, T_, T_ld );
+    Mat_Copy< ColMajor, ColMajor >( ib, ib, T_, T_ld, T_dev.Ptr(), T_ld );
+
+    Rfl_BlkMul< ColMajor >( Side::Left, Trnsp::No, Direct::Fwd, Store::ByCol,
+      mi, n, ib,
+      A_Blk(i+1,i), A_ld,
+      T_dev.Ptr(), T_ld,
+      ColMajor::BlkPtr( Z_dev.Ptr(), i+1, 0, Z_ld ), Z_ld,
+      W_dev.Ptr(), T_ld );
+  }
+
+  Mat_Copy< ColMajor, ColMajor >( n, n, Z_dev.Ptr(), Z_ld, A_, A_ld );
+  device.Sync();
+
+  return true;
+}
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
@@ -0,0 +1,426 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Sym_Rdto_Syt_Dst"/> on the calling process: the panel
+/// and its W for all rows, and their local rows and columns.
+/// </summary>
+template< typename T_Grid, typename T_Scalar >
+Size Sym_Rdto_Syt_Dst_WorkSize( const Dst_Matrix< T_Grid, T_Scalar > &A ) noexcept
+{
+  const Size n = A.n, nb = A.nb, mr = A.LocRows(), nc = A.LocCols();
+  return 2*n*nb + 2*n + nb + 2*( mr+nc )*nb + mr + nc;
+}
+
+namespace _n_Impl {
+
+  // The indices of the local rows (for Dst_Scope::Col) or columns of A
+  template< typename T_Grid, typename T_Scalar >
+  std::vector< Index > _Dst_GlbIdx( const Dst_Matrix< T_Grid, T_Scalar > &A, Dst_Scope scope )
+  {
+    const bool rows = ( Dst_Scope::Col == scope );
+    const Size P = rows ? A.grid->Rows() : A.grid->Cols();
+    const Index p = rows ? A.grid->Row() : A.grid->Col();
+
+    std::vector< Index > glb( rows ? A.LocRows() : A.LocCols() );
+    for( Size l = 0; l < glb.size(); ++l ){ glb[l] = Dst_GlbIdx( (Index)l, A.nb, p, P ); }
+    return glb;
+  }
+
+}// namespace _n_Impl
+
+/// <summary>
+/// Reduces a real symmetric matrix A laid out 2-D block-cyclically on a
+/// grid of processes (see <see cref="Dst_Matrix"/>), of which only the
+/// lower half is referenced, to symmetric tridiagonal form, with the
+/// same result as <see cref="Sym_Rdto_Syt"/>. Every process of the grid
+/// calls it, with its own A, and gets all of d, e and tau.
+///
+/// Each panel of nb columns is reduced as in
+/// <see cref="Sym_Rdto_Syt_Blk"/>, with its vectors, V and W, held
+/// whole by every process: each column is summed over the grid from its
+/// parts, and so is the product of the unreduced part of A with each
+/// vector, of which each process does its local part. The rest of A is
+/// then updated by each process on its local part, with no further
+/// communication.
+/// </summary>
+/// <remarks>
+/// Based on the ScaLAPACK routine <c>pdsytrd</c>.
+///
+/// Only half == Half::Lower is supported. Each column costs two sums
+/// over the process rows and columns of vectors of order n, where
+/// <c>pdsytrd</c> sends vectors of orders n/P and n/Q.
+///
+/// work must hold <see cref="Sym_Rdto_Syt_Dst_WorkSize"/>( A ) elements.
+/// </remarks>
+template< typename T_Grid, typename T_Scalar >
+requires( ! isComplex< T_Scalar > )
+void Sym_Rdto_Syt_Dst( Half half,
+  const Dst_Matrix< T_Grid, T_Scalar > &A,
+  T_Scalar *d, T_Scalar *e, T_Scalar *tau,
+  T_Scalar *work )
+{
+  const Size n = A.n, nb = A.nb;
+
+  IND_MATH_TRACE_SCOPE( "Sym_Rdto_Syt_Dst", n, n, nb,
+    4.0/3.0*n*n*n, (double)A.LocRows()*A.LocCols()*sizeof( T_Scalar ) );
+
+  if( Half::Lower != half ){ throw BadArgument{ "Sym_Rdto_Syt_Dst", 1 }; }
+  if( ( A.m != n ) || ( 0 == nb ) ){ throw BadArgument{ "Sym_Rdto_Syt_Dst", 2 }; }
+
+  if( 0 == n ){ return; }
+
+  T_Grid &grid = *A.grid;
+  const Size P = grid.Rows(), Q = grid.Cols();
+  const Index p = grid.Row(), q = grid.Col();
+  const Size mr = A.LocRows(), nc = A.LocCols();
+
+  const T_Scalar one = unit< T_Scalar >;
+  const T_Scalar half_ = one/2;
+
+  auto RowStart = [&]( Size i ) -> Size { return Dst_LocSize( i, nb, p, P ); };
+  auto ColStart = [&]( Size j ) -> Size { return Dst_LocSize( j, nb, q, Q ); };
+  auto A_ = [&]( Size li, Size lj ) -> T_Scalar &
+  { return ColMajor::MatRef( A.loc, li, lj, A.ld ); };
+  auto A_Blk = [&]( Size li, Size lj ) -> T_Scalar *
+  { return ColMajor::BlkPtr( A.loc, li, lj, A.ld ); };
+
+  const std::vector< Index > glbRow = _n_Impl::_Dst_GlbIdx( A, Dst_Scope::Col );
+  const std::vector< Index > glbCol = _n_Impl::_Dst_GlbIdx( A, Dst_Scope::Row );
+
+  // V and W of the panel and the vectors of a column, of order n; the
+  // local rows and columns of V and W; the local parts of A*v
+  const Stride V_ld = (Stride)n;
+  T_Scalar *V_ = work;
+  T_Scalar *W_ = V_ + n*nb;
+  T_Scalar *a = W_ + n*nb;
+  T_Scalar *y = a + n;
+  T_Scalar *t = y + n;
+  T_Scalar *V_r = t + nb;
+  T_Scalar *W_r = V_r + mr*nb;
+  T_Scalar *V_c = W_r + mr*nb;
+  T_Scalar *W_c = V_c + nc*nb;
+  T_Scalar *y_r = W_c + nc*nb;
+  T_Scalar *y_c = y_r + mr;
+
+  auto V = [&]( auto i, auto j ) -> T_Scalar & { return ColMajor::MatRef( V_, i, j, V_ld ); };
+  auto W = [&]( auto i, auto j ) -> T_Scalar & { return ColMajor::MatRef( W_, i, j, V_ld ); };
+
+  // x(i0:n-1) := the sum over the grid of x(i0:n-1)
+  auto SumAll = [&]( T_Scalar *x, Size i0 )
+  {
+    grid.Sum( Dst_Scope::Row, x + i0, n-i0 );
+    grid.Sum( Dst_Scope::Col, x + i0, n-i0 );
+  };
+
+  for( Size i = 0; i+1 < n; i += nb )
+  {
+    const Size w = Min( nb, n-1-i );
+
+    std::fill( V_, V_ + n*w, T_Scalar{} );
+    std::fill( W_, W_ + n*w, T_Scalar{} );
+
+    for( Size c = 0; c < w; ++c )
+    {
+      const Size k = i+c;
+      const Index q_k = Dst_Owner( (Index)k, nb, Q );
+
+      // a := A(k:n-1,k), less the updates of the panel so far
+      std::fill( a + k, a + n, T_Scalar{} );
+      if( q == q_k )
+      {
+        const Size lc = (Size)Dst_LocIdx( (Index)k, nb, Q );
+        for( Size lr = RowStart( k ); lr < mr; ++lr ){ a[glbRow[lr]] = A_( lr, lc ); }
+      }
+      SumAll( a, k );
+
+      Mat_VecMul< ColMajor >( Trnsp::No, n-k, c, -one, &V( k, 0 ), V_ld, &W( k, 0 ), V_ld, one, a + k, 1 );
+      Mat_VecMul< ColMajor >( Trnsp::No, n-k, c, -one, &W( k, 0 ), V_ld, &V( k, 0 ), V_ld, one, a + k, 1 );
+
+      // Generate elementary reflector H(k) = I - tau * v * (~v)
+      // to annihilate A(k+2:n-1,k)
+      d[k] = a[k];
+      T_Scalar alpha = a[k+1];
+      Rfl_VecGen( n-k-1, alpha, a + k+2, 1, tau[k] );
+      e[k] = alpha;
+      a[k+1] = one;
+      std::copy( a + k+1, a + n, &V( k+1, c ) );
+
+      if( q == q_k )
+      {
+        const Size lc = (Size)Dst_LocIdx( (Index)k, nb, Q );
+        for( Size lr = RowStart( k ); lr < mr; ++lr )
+        {
+          const Size g = (Size)glbRow[lr];
+          A_( lr, lc ) = ( g == k ) ? d[k] : ( ( g == k+1 ) ? e[k] : a[g] );
+        }
+      }
+
+      // y := A(k+1:n-1,k+1:n-1)*v on the local part of the lower half
+      const T_Scalar *v = &V( 0, c );
+      const Size r1 = RowStart( k+1 ), c1 = ColStart( k+1 );
+      std::fill( y_r, y_r + mr, T_Scalar{} );
+      std::fill( y_c, y_c + nc, T_Scalar{} );
+      for( Size lc = c1; lc < nc; ++lc )
+      {
+        const Size g = (Size)glbCol[lc];
+        const T_Scalar v_g = v[g];
+        Size lr = RowStart( g );
+        if( ( lr < mr ) && ( (Size)glbRow[lr] == g ) )
+        {
+          y_r[lr] += A_( lr, lc )*v_g;
+          ++lr;
+        }
+        T_Scalar sum{};
+        for( ; lr < mr; ++lr )
+        {
+          const T_Scalar A_rc = A_( lr, lc );
+          y_r[lr] += A_rc*v_g;
+          sum += A_rc*v[glbRow[lr]];
+        }
+        y_c[lc] += sum;
+      }
+      std::fill( y + k+1, y + n, T_Scalar{} );
+      for( Size lr = r1; lr < mr; ++lr ){ y[glbRow[lr]] += y_r[lr]; }
+      for( Size lc = c1; lc < nc; ++lc ){ y[glbCol[lc]] += y_c[lc]; }
+      SumAll( y, k+1 );
+
+      // y -= V*(~W)*v + W*(~V)*v, the updates of the panel so far
+      if( c > 0 )
+      {
+        Mat_VecMul< ColMajor >( Trnsp::Yes, n-k-1, c, one, &W( k+1, 0 ), V_ld, v + k+1, 1, T_Scalar{}, t, 1 );
+        Mat_VecMul< ColMajor >( Trnsp::No, n-k-1, c, -one, &V( k+1, 0 ), V_ld, t, 1, one, y + k+1, 1 );
+        Mat_VecMul< ColMajor >( Trnsp::Yes, n-k-1, c, one, &V( k+1, 0 ), V_ld, v + k+1, 1, T_Scalar{}, t, 1 );
+        Mat_VecMul< ColMajor >( Trnsp::No, n-k-1, c, -one, &W( k+1, 0 ), V_ld, t, 1, one, y + k+1, 1 );
+      }
+
+      // w := tau*y - 1/2 tau^2 ((~y)*v) v
+      T_Scalar *w_ = &W( 0, c );
+      for( Size r = k+1; r < n; ++r ){ w_[r] = tau[k]*y[r]; }
+      T_Scalar wv{};
+      for( Size r = k+1; r < n; ++r ){ wv += w_[r]*v[r]; }
+      const T_Scalar alpha2 = -half_*tau[k]*wv;
+      for( Size r = k+1; r < n; ++r ){ w_[r] += alpha2*v[r]; }
+    }
+
+    // A := A - V*(~W) - W*(~V) on the local part of the lower half of
+    // A(i+w:n-1,i+w:n-1), a block column at a time
+    const Size t0 = i+w;
+    const Size rt = RowStart( t0 ), ct = ColStart( t0 );
+    const Stride r_ld = (Stride)Max( mr-rt, (Size)1 );
+    const Stride c_ld = (Stride)Max( nc-ct, (Size)1 );
+    for( Size c = 0; c < w; ++c )
+    {
+      for( Size lr = rt; lr < mr; ++lr )
+      {
+        ColMajor::MatRef( V_r, lr-rt, c, r_ld ) = V( glbRow[lr], c );
+        ColMajor::MatRef( W_r, lr-rt, c, r_ld ) = W( glbRow[lr], c );
+      }
+      for( Size lc = ct; lc < nc; ++lc )
+      {
+        ColMajor::MatRef( V_c, lc-ct, c, c_ld ) = V( glbCol[lc], c );
+        ColMajor::MatRef( W_c, lc-ct, c, c_ld ) = W( glbCol[lc], c );
+      }
+    }
+
+    for( Size lc = ct; lc < nc; )
+    {
+      const Size g = (Size)glbCol[lc];
+      const Size bs = Min( nb - g%nb, nc-lc );
+      Size lr = RowStart( g );
+      if( ( lr < mr ) && ( (Size)glbRow[lr] == g ) )
+      {
+        Sym_Rank2kUpd< ColMajor >( Half::Lower, Trnsp::No, bs, w, -one,
+          ColMajor::BlkPtr( V_r, lr-rt, 0, r_ld ), r_ld,
+          ColMajor::BlkPtr( W_r, lr-rt, 0, r_ld ), r_ld,
+          one, A_Blk( lr, lc ), A.ld );
+        lr += bs;
+      }
+      Mat_MatMul< ColMajor >( Trnsp::No, Trnsp::Yes, mr-lr, bs, w, -one,
+        ColMajor::BlkPtr( V_r, lr-rt, 0, r_ld ), r_ld,
+        ColMajor::BlkPtr( W_c, lc-ct, 0, c_ld ), c_ld,
+        one, A_Blk( lr, lc ), A.ld );
+      Mat_MatMul< ColMajor >( Trnsp::No, Trnsp::Yes, mr-lr, bs, w, -one,
+        ColMajor::BlkPtr( W_r, lr-rt, 0, r_ld ), r_ld,
+        ColMajor::BlkPtr( V_c, lc-ct, 0, c_ld ), c_ld,
+        one, A_Blk( lr, lc ), A.ld );
+      lc += bs;
+    }
+  }
+
+  // The last diagonal element, after all the updates
+  T_Scalar d_last{};
+  if( ( p == Dst_Owner( (Index)n-1, nb, P ) ) && ( q == Dst_Owner( (Index)n-1, nb, Q ) ) )
+  { d_last = A_( (Size)Dst_LocIdx( (Index)n-1, nb, P ), (Size)Dst_LocIdx( (Index)n-1, nb, Q ) ); }
+  grid.Sum( Dst_Scope::Row, &d_last, 1 );
+  grid.Sum( Dst_Scope::Col, &d_last, 1 );
+  d[n-1] = d_last;
+}
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Sym_Eig_Dst"/> on the calling process.
+/// </summary>
+template< typename T_Grid, typename T_Scalar >
+Size Sym_Eig_Dst_WorkSize( const Dst_Matrix< T_Grid, T_Scalar > &A ) noexcept
+{
+  const Size n = A.n, nb = A.nb, mr = A.LocRows(), nc = A.LocCols();
+
+  // e, tau and the local rows of Z, then the workspace of the stages
+  return 2*n + Max( mr, (Size)1 )*n
+    + Max( Max( Sym_Rdto_Syt_Dst_WorkSize( A ), Syt_EigVecQR_WorkSize( n ) ),
+      n*nb + nb*nb + mr*nb + nb*nc );
+}
+
+/// <summary>
+/// Computes all eigenvalues and eigenvectors of the n by n symmetric
+/// matrix A laid out 2-D block-cyclically on a grid of processes (see
+/// <see cref="Dst_Matrix"/>), of which only the lower half is
+/// referenced, as <see cref="Sym_Eig"/> does: on output w, on every
+/// process, holds the eigenvalues in increasing order, and column i of
+/// A the normalized eigenvector of w[i].
+///
+/// A is reduced to tridiagonal form by <see cref="Sym_Rdto_Syt_Dst"/>.
+/// Every process then runs the QL/QR iteration of
+/// <see cref="Syt_EigVecQR"/> on the whole tridiagonal matrix, applying
+/// its rotations to its own rows of the eigenvectors only (see
+/// <see cref="Syt_EigVecQR::SolveRows"/>), and keeps its local columns
+/// of them. The eigenvectors are finally multiplied by the orthogonal
+/// matrix of the reduction in block reflectors of nb columns, each
+/// summed over the grid once and applied locally.
+/// </summary>
+///<returns>
+/// false if the tridiagonal eigenproblem did not converge.
+/// </returns>
+/// <remarks>
+/// Based on the ScaLAPACK routine <c>pdsyev</c>, whose <c>pdsteqr2</c>
+/// also splits the rows of the eigenvectors over the processes.
+///
+/// Only half == Half::Lower is supported. Each process holds all n
+/// columns of its local rows of the eigenvectors while they are
+/// computed.
+///
+/// work must hold <see cref="Sym_Eig_Dst_WorkSize"/>( A ) elements.
+/// </remarks>
+template< typename T_Grid, typename T_Scalar >
+requires( ! isComplex< T_Scalar > )
+bool Sym_Eig_Dst( Half half,
+  const Dst_Matrix< T_Grid, T_Scalar > &A,
+  T_Scalar *w,
+  T_Scalar *work )
+{
+  const Size n = A.n, nb = A.nb;
+
+  IND_MATH_TRACE_SCOPE( "Sym_Eig_Dst", n, n, nb, 0,
+    2.0*A.LocRows()*A.LocCols()*sizeof( T_Scalar ) );
+
+  if( Half::Lower != half ){ throw BadArgument{ "Sym_Eig_Dst", 1 }; }
+  if( ( A.m != n ) || ( 0 == nb ) ){ throw BadArgument{ "Sym_Eig_Dst", 2 }; }
+
+  if( 0 == n ){ return true; }
+
+  T_Grid &grid = *A.grid;
+  const Size P = grid.Rows();
+  const Index p = grid.Row();
+  const Size mr = A.LocRows(), nc = A.LocCols();
+
+  const T_Scalar one = unit< T_Scalar >;
+
+  const std::vector< Index > glbRow = _n_Impl::_Dst_GlbIdx( A, Dst_Scope::Col );
+  const std::vector< Index > glbCol = _n_Impl::_Dst_GlbIdx( A, Dst_Scope::Row );
+
+  T_Scalar *e = work;
+  T_Scalar *tau = work + n;
+  T_Scalar *Z_ = work + 2*n;
+  const Stride Z_ld = (Stride)Max( mr, (Size)1 );
+  T_Scalar *rest = Z_ + Z_ld*n;
+
+  Sym_Rdto_Syt_Dst( Half::Lower, A, w, e, tau, rest );
+
+  // The local rows of Z, all n columns of them, from those of I
+  std::fill( Z_, Z_ + Z_ld*n, T_Scalar{} );
+  for( Size lr = 0; lr < mr; ++lr ){ ColMajor::MatRef( Z_, lr, glbRow[lr], Z_ld ) = one; }
+
+  if( ! Syt_EigVecQR< T_Scalar >{}.template SolveRows< ColMajor >( n, mr, w, e, Z_, Z_ld, rest ) )
+  { return false; }
+  _n_Impl::_Syt_EigSort< ColMajor >( mr, n, w, Z_, Z_ld );
+
+  // Keep the local columns, in place: glbCol[lc] >= lc
+  for( Size lc = 0; lc < nc; ++lc )
+  {
+    if( (Size)glbCol[lc] != lc )
+    { std::copy( Z_ + glbCol[lc]*Z_ld, Z_ + glbCol[lc]*Z_ld + mr, Z_ + lc*Z_ld ); }
+  }
+
+  // Z := Q*Z, Q = H(0) H(1) . . . H(n-2) with the vectors of H(i) in
+  // A(i+1:n-1,i), last block first
+  T_Scalar *V_ = rest;
+  T_Scalar *T_ = V_ + n*nb;
+  T_Scalar *V_r = T_ + nb*nb;
+  T_Scalar *W_ = V_r + mr*nb;
+  const Stride T_ld = (Stride)nb;
+
+  for( Index i = (Index)( ( Max( n, (Size)2 )-2 )/nb*nb ); ( i >= 0 ) && ( n > 1 ); i -= (Index)nb )
+  {
+    const Size ib = Min( nb, n-1-(Size)i );
+    const Size mi = n-1-(Size)i;
+    const Stride V_ld = (Stride)mi;
+    const Size r1 = Dst_LocSize( (Size)i+1, nb, p, P );
+
+    // V(0:mi-1,0:ib-1) := A(i+1:n-1,i:i+ib-1), unit lower trapezoidal,
+    // summed over the grid from the processes that hold it
+    std::fill( V_, V_ + mi*ib, T_Scalar{} );
+    if( grid.Col() == Dst_Owner( i, nb, grid.Cols() ) )
+    {
+      const Size lc0 = (Size)Dst_LocIdx( i, nb, grid.Cols() );
+      for( Size c = 0; c < ib; ++c )
+      {
+        for( Size lr = r1; lr < mr; ++lr )
+        {
+          const Size r = (Size)glbRow[lr] - (Size)i - 1;
+          if( r > c ){ ColMajor::MatRef( V_, r, c, V_ld ) = ColMajor::MatRef( A.loc, lr, lc0+c, A.ld ); }
+        }
+      }
+    }
+    grid.Sum( Dst_Scope::Row, V_, mi*ib );
+    grid.Sum( Dst_Scope::Col, V_, mi*ib );
+    for( Size c = 0; c < ib; ++c ){ ColMajor::MatRef( V_, c, c, V_ld ) = one; }
+
+    Rfl_BlkGen< ColMajor >( Direct::Fwd, Store::ByCol, mi, ib, V_, V_ld, tau + i, T_, T_ld );
+
+    // Z(i+1:n-1,:) -= V*T*(~V)*Z(i+1:n-1,:), (~V)*Z summed over the
+    // process column
+    const Size mz = mr-r1;
+    const Stride Vr_ld = (Stride)Max( mz, (Size)1 );
+    for( Size c = 0; c < ib; ++c )
+    {
+      for( Size lr = r1; lr < mr; ++lr )
+      { ColMajor::MatRef( V_r, lr-r1, c, Vr_ld ) = ColMajor::MatRef( V_, (Size)glbRow[lr]-(Size)i-1, c, V_ld ); }
+    }
+
+    std::fill( W_, W_ + T_ld*nc, T_Scalar{} );
+    Mat_MatMul< ColMajor >( Trnsp::Yes, Trnsp::No, ib, nc, mz, one,
+      V_r, Vr_ld, Z_ + r1, Z_ld, one, W_, T_ld );
+    grid.Sum( Dst_Scope::Col, W_, ib*nc );
+    Tri_MatMul< ColMajor >( Side::Left, Half::Upper, Trnsp::No, Diag::NotUnit,
+      ib, nc, one, T_, T_ld, W_, T_ld );
+    Mat_MatMul< ColMajor >( Trnsp::No, Trnsp::No, mz, nc, ib, -one,
+      V_r, Vr_ld, W_, T_ld, one, Z_ + r1, Z_ld );
+  }
+
+  Mat_Copy< ColMajor, ColMajor >( mr, nc, Z_, Z_ld, A.loc, A.ld );
+
+  return true;
+}
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
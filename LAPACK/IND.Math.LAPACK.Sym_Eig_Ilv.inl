@@ -0,0 +1,439 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Configuration of <see cref="Sym_Eig_Ilv"/>.
+/// </summary>
+struct Sym_Eig_Ilv_Config
+{
+  // Cap on the QR sweeps per eigenvalue, as in dsteqr.
+  Size iterMax = 30;
+
+  // Number of lanes of a group still iterating at or below which the
+  // group leaves the lockstep iteration and finishes them one by one;
+  // 0 for a quarter of the group.
+  Size stragglers = 0;
+};
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Sym_Eig_Ilv"/> on matrices of order n.
+/// </summary>
+template< typename T_Scalar >
+inline constexpr Size Sym_Eig_Ilv_WorkSize( Size n ) noexcept
+{
+  constexpr Size W = Mat_LU_Ilv_Width< T_Scalar >;
+  return n*n*W + 2*n*W + 2*n + Syt_EigVecQR_WorkSize( n );
+}
+
+namespace _n_Impl {
+
+  // Reduces W symmetric N by N matrices side by side to tridiagonal
+  // form, as dsytd2 does with the lower half, one lane per matrix:
+  // element (i,j) of lane l is a[(i + j*N)*W + l]. On exit d and e hold
+  // the tridiagonals and tau and the lower half of a the reflectors.
+  // A lane whose column is already reduced gets tau = 0 by selects, so
+  // the lane loops carry no branches.
+  template< Size N, Size W, typename T_Scalar >
+  constexpr void _Sym_Rdto_Syt_Ilv(
+    T_Scalar *__restrict a,
+    T_Scalar *__restrict d,
+    T_Scalar *__restrict e,
+    T_Scalar *__restrict tau )
+  {
+    auto A = [&]( Index i, Index j ) -> T_Scalar *
+    { return a + ( i + j*(Index)N )*(Index)W; };
+
+    constexpr T_Scalar one = unit< T_Scalar >;
+
+    T_Scalar v[N*W], x[N*W];
+
+    for( Index i = 0; i+1 < (Index)N; ++i )
+    {
+      // The reflector H(i) = I - tau*v*v' annihilating A(i+2:N,i)
+      T_Scalar t[W], h[W];
+      for( Size l = 0; l < W; ++l ){ h[l] = T_Scalar{}; }
+      for( Index r = i+2; r < (Index)N; ++r )
+      {
+        for( Size l = 0; l < W; ++l ){ h[l] += Sqr( A(r,i)[l] ); }
+      }
+
+      for( Size l = 0; l < W; ++l )
+      {
+        const T_Scalar alpha = A(i+1,i)[l];
+        const bool none = ( T_Scalar{} == h[l] );
+        const T_Scalar norm = Sqrt( alpha*alpha + h[l] );
+        const T_Scalar beta = none ? alpha : ( ( alpha < 0 ) ? norm : -norm );
+        t[l] = none ? T_Scalar{} : ( beta - alpha )/beta;
+        h[l] = none ? one : one/( alpha - beta );
+        e[i*W + l] = beta;
+        tau[i*W + l] = t[l];
+        v[( i+1 )*W + l] = one;
+      }
+
+      for( Index r = i+2; r < (Index)N; ++r )
+      {
+        for( Size l = 0; l < W; ++l )
+        {
+          A(r,i)[l] *= h[l];
+          v[r*W + l] = A(r,i)[l];
+        }
+      }
+
+      // x := tau*A22*v, then x -= (tau/2)*(x'*v)*v and the rank-2
+      // update A22 -= v*x' + x*v' of the lower half
+      for( Index r = i+1; r < (Index)N; ++r )
+      {
+        for( Size l = 0; l < W; ++l ){ x[r*W + l] = T_Scalar{}; }
+      }
+
+      for( Index c = i+1; c < (Index)N; ++c )
+      {
+        for( Size l = 0; l < W; ++l ){ x[c*W + l] += A(c,c)[l]*v[c*W + l]; }
+        for( Index r = c+1; r < (Index)N; ++r )
+        {
+          for( Size l = 0; l < W; ++l )
+          {
+            x[r*W + l] += A(r,c)[l]*v[c*W + l];
+            x[c*W + l] += A(r,c)[l]*v[r*W + l];
+          }
+        }
+      }
+
+      for( Size l = 0; l < W; ++l ){ h[l] = T_Scalar{}; }
+      for( Index r = i+1; r < (Index)N; ++r )
+      {
+        for( Size l = 0; l < W; ++l )
+        {
+          x[r*W + l] *= t[l];
+          h[l] += x[r*W + l]*v[r*W + l];
+        }
+      }
+
+      for( Size l = 0; l < W; ++l ){ h[l] *= -t[l]/2; }
+      for( Index r = i+1; r < (Index)N; ++r )
+      {
+        for( Size l = 0; l < W; ++l ){ x[r*W + l] += h[l]*v[r*W + l]; }
+      }
+
+      for( Index c = i+1; c < (Index)N; ++c )
+      {
+        for( Index r = c; r < (Index)N; ++r )
+        {
+          for( Size l = 0; l < W; ++l )
+          { A(r,c)[l] -= v[r*W + l]*x[c*W + l] + x[r*W + l]*v[c*W + l]; }
+        }
+      }
+
+      for( Size l = 0; l < W; ++l ){ d[i*W + l] = A(i,i)[l]; }
+    }
+
+    for( Size l = 0; l < W; ++l ){ d[( N-1 )*W + l] = A(N-1,N-1)[l]; }
+  }
+
+  // Forms into z the orthogonal matrices Q = H(0)*...*H(N-2) of
+  // _Sym_Rdto_Syt_Ilv, as dorgtr does, lane by lane.
+  template< Size N, Size W, typename T_Scalar >
+  constexpr void _Ort_From_Syt_Ilv(
+    const T_Scalar *__restrict a,
+    const T_Scalar *__restrict tau,
+    T_Scalar *__restrict z )
+  {
+    auto A = [&]( Index i, Index j ) -> const T_Scalar *
+    { return a + ( i + j*(Index)N )*(Index)W; };
+    auto Z = [&]( Index i, Index j ) -> T_Scalar *
+    { return z + ( i + j*(Index)N )*(Index)W; };
+
+    constexpr T_Scalar one = unit< T_Scalar >;
+
+    for( Index j = 0; j < (Index)N; ++j )
+    {
+      for( Index i = 0; i < (Index)N; ++i )
+      {
+        for( Size l = 0; l < W; ++l )
+        { Z(i,j)[l] = ( i == j ) ? one : T_Scalar{}; }
+      }
+    }
+
+    // H(i) touches rows and columns i+1 to N-1 only, which the later
+    // reflectors have left as identity in column i+1.
+    for( Index i = (Index)N-2; i >= 0; --i )
+    {
+      for( Index j = i+1; j < (Index)N; ++j )
+      {
+        T_Scalar s[W];
+        for( Size l = 0; l < W; ++l ){ s[l] = Z(i+1,j)[l]; }
+        for( Index r = i+2; r < (Index)N; ++r )
+        {
+          for( Size l = 0; l < W; ++l ){ s[l] += A(r,i)[l]*Z(r,j)[l]; }
+        }
+
+        for( Size l = 0; l < W; ++l )
+        {
+          s[l] *= tau[i*W + l];
+          Z(i+1,j)[l] -= s[l];
+        }
+        for( Index r = i+2; r < (Index)N; ++r )
+        {
+          for( Size l = 0; l < W; ++l ){ Z(r,j)[l] -= s[l]*A(r,i)[l]; }
+        }
+      }
+    }
+  }
+
+  // Implicit QR with Wilkinson shifts on W symmetric tridiagonals side
+  // by side, d(k) of lane l at d[k*W + l] and e(k) at e[k*W + l], with
+  // the rotations applied to the columns of z.
+  //
+  // Each lane keeps its own unreduced block lo(l) to hi(l), found
+  // after every sweep by the deflation test of dsteqr. The sweep chases
+  // the bulge over the union of the blocks, and a lane outside its
+  // block at step k rotates by the identity (c = 1, s = 0), which is
+  // exact, so the lanes stay in lockstep without branching. Stops once
+  // stragglers or fewer lanes still iterate, or after sweepMax sweeps,
+  // leaving hi(l) > 0 for the lanes not done.
+  template< Size N, Size W, typename T_Scalar >
+  constexpr void _Syt_EigVecQR_Ilv(
+    T_Scalar *__restrict d,
+    T_Scalar *__restrict e,
+    T_Scalar *__restrict z,
+    Size stragglers,
+    Size sweepMax,
+    Index *__restrict hi )
+  {
+    auto Z = [&]( Index i, Index j ) -> T_Scalar *
+    { return z + ( i + j*(Index)N )*(Index)W; };
+
+    constexpr T_Scalar eps = std::numeric_limits< T_Scalar >::epsilon();
+    constexpr T_Scalar safmin = std::numeric_limits< T_Scalar >::min();
+    constexpr T_Scalar one = unit< T_Scalar >;
+
+    Index lo[W];
+    for( Size l = 0; l < W; ++l ){ hi[l] = (Index)N-1; }
+
+    for( Size sweep = 0; ; ++sweep )
+    {
+      // The trailing unreduced block of each lane, with its negligible
+      // off-diagonals set to zero
+      auto Tiny = [&]( Index k, Size l )
+      {
+        return Sqr( e[k*W + l] ) <= eps*eps*Abs( d[k*W + l]*d[( k+1 )*W + l] ) + safmin;
+      };
+
+      Size active = 0;
+      Index kMin = (Index)N, kMax = 0;
+      for( Size l = 0; l < W; ++l )
+      {
+        while( hi[l] > 0 && Tiny( hi[l]-1, l ) )
+        {
+          e[( hi[l]-1 )*W + l] = T_Scalar{};
+          --hi[l];
+        }
+
+        lo[l] = hi[l];
+        while( lo[l] > 0 && ! Tiny( lo[l]-1, l ) ){ --lo[l]; }
+        if( lo[l] > 0 ){ e[( lo[l]-1 )*W + l] = T_Scalar{}; }
+
+        if( hi[l] > 0 )
+        {
+          ++active;
+          kMin = Min( kMin, lo[l] );
+          kMax = Max( kMax, hi[l] );
+        }
+      }
+
+      if( active <= stragglers || sweep >= sweepMax ){ return; }
+
+      // The Wilkinson shift of each lane, from its trailing 2 by 2
+      T_Scalar mu[W], x[W], b[W];
+      for( Size l = 0; l < W; ++l )
+      {
+        const Index h = Max( hi[l], (Index)1 );
+        const T_Scalar eh = e[( h-1 )*W + l];
+        const T_Scalar g = ( d[( h-1 )*W + l] - d[h*W + l] )/( 2*eh + ( ( T_Scalar{} == eh ) ? one : T_Scalar{} ) );
+        const T_Scalar r = Sqrt( g*g + one );
+        mu[l] = d[h*W + l] - eh/( g + ( ( g < 0 ) ? -r : r ) );
+        x[l] = T_Scalar{};
+        b[l] = T_Scalar{};
+      }
+
+      for( Index k = kMin; k < kMax; ++k )
+      {
+        T_Scalar c[W], s[W];
+        for( Size l = 0; l < W; ++l )
+        {
+          const bool act = ( lo[l] <= k && k < hi[l] );
+          const bool first = ( k == lo[l] );
+          const T_Scalar xk = first ? d[k*W + l] - mu[l] : x[l];
+          const T_Scalar bk = first ? e[k*W + l] : b[l];
+          const T_Scalar r = Sqrt( xk*xk + bk*bk );
+          const bool rot = act && ( T_Scalar{} != r );
+          const T_Scalar rInv = one/( rot ? r : one );
+          c[l] = rot ? xk*rInv : one;
+          s[l] = rot ? bk*rInv : T_Scalar{};
+
+          if( k > 0 )
+          { e[( k-1 )*W + l] = ( act && ! first ) ? r : e[( k-1 )*W + l]; }
+
+          const T_Scalar dk = d[k*W + l], dk1 = d[( k+1 )*W + l], ek = e[k*W + l];
+          const T_Scalar cc = c[l]*c[l], ss = s[l]*s[l], cs = c[l]*s[l];
+          d[k*W + l] = cc*dk + 2*cs*ek + ss*dk1;
+          d[( k+1 )*W + l] = ss*dk - 2*cs*ek + cc*dk1;
+          e[k*W + l] = cs*( dk1 - dk ) + ( cc - ss )*ek;
+          x[l] = e[k*W + l];
+        }
+
+        if( k+2 < (Index)N )
+        {
+          for( Size l = 0; l < W; ++l )
+          {
+            b[l] = s[l]*e[( k+1 )*W + l];
+            e[( k+1 )*W + l] *= c[l];
+          }
+        }
+
+        for( Index r = 0; r < (Index)N; ++r )
+        {
+          T_Scalar *z0 = Z(r,k), *z1 = Z(r,k+1);
+          for( Size l = 0; l < W; ++l )
+          {
+            const T_Scalar u = z0[l], t = z1[l];
+            z0[l] = c[l]*u + s[l]*t;
+            z1[l] = c[l]*t - s[l]*u;
+          }
+        }
+      }
+    }
+  }
+
+}// namespace _n_Impl
+
+/// <summary>
+/// Computes all eigenvalues and eigenvectors of count symmetric N-by-N
+/// matrices stored interleaved as for <see cref="Sym_EigSmall_Ilv"/>:
+/// with W = Mat_LU_Ilv_Width&lt;T_Scalar&gt;, element (i,j) of matrix
+/// b is
+///
+///   A[(b/W)*N*N*W + (i + j*N)*W + b%W]
+///
+/// that is, each group of W matrices is an
+/// <see cref="Interleaved"/>&lt;W&gt; block with leading dimension N,
+/// and eigenvalue k of matrix b is w[(b/W)*N*W + k*W + b%W].
+///
+/// Only the half of A given by half is referenced. On exit w holds the
+/// eigenvalues of each matrix in ascending order and A the orthonormal
+/// eigenvectors in the same layout, column k for w(k), as for
+/// <see cref="Sym_Eig"/>.
+///
+/// The W matrices of a group run the chain of <see cref="Sym_Eig"/> in
+/// lockstep, one SIMD lane per matrix: tridiagonal reduction, forming
+/// Q, and implicit QR on the tridiagonals, where each lane deflates on
+/// its own and rotates by the identity outside its unreduced block.
+/// Once config.stragglers or fewer lanes of a group still iterate, they
+/// are finished one by one by <see cref="Syt_EigVecQR"/>, through the
+/// Interleaved&lt;W&gt; layout, so that a slow lane does not hold the
+/// whole group.
+/// </summary>
+///<returns>
+/// false if the iteration did not converge for some matrix.
+/// </returns>
+/// <remarks>
+/// Meant for many matrices of order about 16 to 64, above the reach of
+/// <see cref="Sym_EigSmall_Ilv"/>; work must hold
+/// <see cref="Sym_Eig_Ilv_WorkSize"/>(N) elements.
+///
+/// A and w must be sized for whole groups (see
+/// <see cref="Mat_LU_Ilv_Size"/>); lanes past count are computed too,
+/// so their contents must be finite. The reflector norms are plain sums
+/// of squares, so the entries of A must be below sqrt( maxValue )/N in
+/// magnitude. GCC and Clang vectorize the square roots only under
+/// -fno-math-errno.
+/// </remarks>
+template< Size N,
+  typename T_Scalar >
+requires( ( N > 0 ) && ! isComplex< T_Scalar > )
+bool Sym_Eig_Ilv( Half half,
+  Size count,
+  T_Scalar *A,
+  T_Scalar *w,
+  T_Scalar *work,
+  const Sym_Eig_Ilv_Config &config = {} )
+{
+  if( Half::Both == half ){ throw BadArgument{ "Sym_Eig_Ilv", 1 }; }
+
+  constexpr Size W = Mat_LU_Ilv_Width< T_Scalar >;
+  using Ilv = Interleaved< W >;
+
+  IND_MATH_TRACE_SCOPE( "Sym_Eig_Ilv", N, N, count, 0, ( 2.0*N*N + 2.0*N )*count*sizeof( T_Scalar ) );
+
+  const Size stragglers = ( 0 == config.stragglers ) ? Max( W/4, (Size)1 ) : config.stragglers;
+
+  T_Scalar *z = work;
+  T_Scalar *e = z + N*N*W;
+  T_Scalar *tau = e + N*W;
+  T_Scalar *dl = tau + N*W;
+  T_Scalar *el = dl + N;
+  T_Scalar *qrWork = el + N;
+
+  const Syt_EigVecQR< T_Scalar, Ilv > solver{};
+
+  bool converged = true;
+
+  for( Size g = 0; g*W < count; ++g )
+  {
+    T_Scalar *A_g = A + g*N*N*W;
+    T_Scalar *w_g = w + g*N*W;
+
+    if( Half::Upper == half )
+    {
+      for( Size j = 1; j < N; ++j )
+      {
+        for( Size i = 0; i < j; ++i )
+        {
+          for( Size l = 0; l < W; ++l )
+          { A_g[( j + i*N )*W + l] = A_g[( i + j*N )*W + l]; }
+        }
+      }
+    }
+
+    _n_Impl::_Sym_Rdto_Syt_Ilv< N, W >( A_g, w_g, e, tau );
+    _n_Impl::_Ort_From_Syt_Ilv< N, W >( A_g, tau, z );
+
+    Index hi[W];
+    _n_Impl::_Syt_EigVecQR_Ilv< N, W >( w_g, e, z, stragglers, config.iterMax*N, hi );
+
+    for( Size l = 0; l < W; ++l )
+    {
+      if( 0 == hi[l] ){ continue; }
+
+      for( Size k = 0; k < N; ++k )
+      {
+        dl[k] = w_g[k*W + l];
+        el[k] = ( k+1 < N ) ? e[k*W + l] : T_Scalar{};
+      }
+
+      converged = solver.template Solve< Ilv >( N, dl, el, z + l, (Stride)N, qrWork ) && converged;
+
+      for( Size k = 0; k < N; ++k )
+      { w_g[k*W + l] = dl[k]; }
+    }
+
+    _n_Impl::_Sym_EigSmall_SortW< N, W >( z, w_g );
+
+    for( Size k = 0; k < N*N*W; ++k )
+    { A_g[k] = z[k]; }
+  }
+
+  return converged;
+}
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
@@ -0,0 +1,191 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Sym_Eig_Rnd"/> on an n by n matrix, for k eigenpairs with
+/// p columns of oversampling, where eig is that of the solver of the
+/// small problem, <see cref="Sym_Eig_WorkSize"/>( Min( k+p, n ) ) by
+/// default.
+/// </summary>
+inline constexpr Size Sym_Eig_Rnd_WorkSize( Size n, Size k,
+  Size p = Mat_SVD_Rnd_Oversample, Size eig = 0 ) noexcept
+{
+  const Size l = Min( k+p, n );
+  if( 0 == l ){ return 0; }
+  if( 0 == eig ){ eig = Sym_Eig_WorkSize( l ); }
+
+  // Q, A*Q, the projection of A and its eigenvalues, and tau
+  Size rest = eig;
+  rest = Max( rest, Mat_Fctr_QR_Blk_WorkSize( n, l ) );
+  rest = Max( rest, Ort_From_QR_Blk_WorkSize( n, l, l ) );
+  return 2*n*l + l*l + 2*l + rest;
+}
+
+/// <summary>
+/// Truncated eigendecomposition of a real symmetric n by n matrix A
+/// by random sketching: the k eigenvalues of A of largest magnitude,
+/// and their eigenvectors.
+///
+/// The range of A is found as by <see cref="Mat_SVD_Rnd"/>, from an
+/// n by l Gaussian sketch, l = k+config().p, sharpened by config().q
+/// power iterations with A*A. A is projected on its orthonormal basis
+/// Q, T = (~Q)*A*Q, l by l, and the eigenvectors of T from
+/// <see cref="Sym_Eig"/> mapped back through Q. A is only touched by
+/// <see cref="Sym_MatMul"/>, 2*q+2 times in all, and is not modified.
+/// </summary>
+/// <remarks>
+/// Based on Halko, Martinsson and Tropp, "Finding Structure with
+/// Randomness" (2011), algorithms 4.4 and 5.3.
+/// </remarks>
+template< typename T_Scalar, typename DefaultLyt = ColMajor >
+requires( ! isComplex< T_Scalar > )
+class Sym_Eig_Rnd
+{
+public:
+
+  using Scalar = T_Scalar;
+
+  struct Config
+  {
+    // Oversampling, and power iterations
+    Size p = Mat_SVD_Rnd_Oversample;
+    Size q = Mat_SVD_Rnd_PowerIts;
+    std::uint32_t seed = 0x2545F491u;
+    typename Sym_Eig< Scalar, DefaultLyt >::Config eig = {};
+  };
+
+private:
+
+  Config _config;
+
+public:
+
+  constexpr const Config &config() const noexcept
+  { return this->_config; }
+  constexpr void SetConfig( const Config &config ) noexcept
+  { this->_config = config; }
+
+  IND_NOTHROW_VITAE( Sym_Eig_Rnd );
+
+  /// <summary>
+  /// Size of the workspace Solve needs for k eigenpairs of order n
+  /// under the current configuration.
+  /// </summary>
+  Size WorkSize( Size n, Size k ) const
+  {
+    Sym_Eig< Scalar, DefaultLyt > EIG{};
+    EIG.SetConfig( this->_config.eig );
+    return Sym_Eig_Rnd_WorkSize( n, k, this->_config.p,
+      EIG.WorkSize( Min( k + this->_config.p, n ) ) );
+  }
+
+  /// <summary>
+  /// Computes the k eigenvalues of largest magnitude of the n by n
+  /// symmetric matrix A, of which only the given half is referenced,
+  /// into w, in decreasing order of magnitude, and their normalized
+  /// eigenvectors into the columns of the n by k U.
+  ///
+  /// work must hold <see cref="WorkSize"/>( n, k ) elements.
+  /// Returns false if the eigensolver of the projection failed to
+  /// converge.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Blk_A,
+    typename T_Arr_w,
+    typename T_Blk_U >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Blk_A> >,
+    Decay< DerefTypeOf<T_Arr_w> >,
+    Decay< DerefTypeOf<T_Blk_U> > >)
+  bool Solve( Half half, Size n, Size k,
+    T_Blk_A A_, Stride A_ld,
+    T_Arr_w w,
+    T_Blk_U U_, Stride U_ld,
+    Scalar *work ) const
+  {
+    const Size l = Min( k + this->_config.p, n );
+
+    IND_MATH_TRACE_SCOPE( "Sym_Eig_Rnd", n, n, k,
+      ( 4.0*this->_config.q + 4.0 )*n*n*l, ( 2.0*this->_config.q + 2.0 )*n*n*sizeof( Scalar ) );
+
+    if( k > n ){ throw BadArgument{ "Sym_Eig_Rnd::Solve", 3 }; }
+
+    if( 0 == k ){ return true; }
+
+    const Scalar zero = {};
+    const Scalar one = unit<Scalar>;
+
+    const Stride Y_ld = Lyt::DenseLd( n, l );
+    const Stride T_ld = Lyt::DenseLd( l, l );
+
+    Scalar *Y_ = work;
+    Scalar *Z_ = Y_ + n*l;
+    Scalar *T_ = Z_ + n*l;
+    Scalar *wl = T_ + l*l;
+    Scalar *tau = wl + l;
+    Scalar *rest = tau + l;
+
+    auto AX = [&]( const Scalar *X_, Scalar *W_ )
+    { Sym_MatMul< Lyt >( Side::Left, half, n, l, one, A_, A_ld, X_, Y_ld, zero, W_, Y_ld ); };
+
+    _n_Impl::_Rnd_Range< Lyt >( n, n, l, this->_config.q, this->_config.seed,
+      Y_, Y_ld, Z_, Y_ld, tau, rest, AX, AX );
+
+    // T = (~Q)*A*Q, and its eigenvectors in T
+    AX( Y_, Z_ );
+    Mat_MatMul< Lyt >( Trnsp::Yes, Trnsp::No, l, l, n, one, Y_, Y_ld, Z_, Y_ld, zero, T_, T_ld );
+
+    Sym_Eig< Scalar, DefaultLyt > EIG{};
+    EIG.SetConfig( this->_config.eig );
+    if( ! EIG.template Solve< Lyt >( Half::Lower, l, T_, T_ld, wl, rest ) )
+    { return false; }
+
+    // wl is increasing, so the largest in magnitude are taken from
+    // either end; their vectors are gathered in Z, l by k
+    const Stride V_ld = Lyt::DenseLd( l, k );
+    for( Index c = 0, lo = 0, hi = (Index)l-1; c < (Index)k; ++c )
+    {
+      const Index i = ( Abs( wl[hi] ) >= Abs( wl[lo] ) ) ? hi-- : lo++;
+      w[c] = wl[i];
+      for( Index r = 0; r < (Index)l; ++r )
+      { Lyt::MatRef( Z_, r, c, V_ld ) = Lyt::MatRef( T_, r, i, T_ld ); }
+    }
+
+    Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, n, k, l, one, Y_, Y_ld, Z_, V_ld, zero, U_, U_ld );
+    return true;
+  }
+
+  /// <summary>
+  /// Solves as above, with the workspace taken from arena.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Blk_A,
+    typename T_Arr_w,
+    typename T_Blk_U >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Blk_A> >,
+    Decay< DerefTypeOf<T_Arr_w> >,
+    Decay< DerefTypeOf<T_Blk_U> > >)
+  bool Solve( Half half, Size n, Size k,
+    T_Blk_A A_, Stride A_ld,
+    T_Arr_w w,
+    T_Blk_U U_, Stride U_ld,
+    Aux_Arena< Scalar > &arena ) const
+  {
+    typename Aux_Arena< Scalar >::Frame frame{ arena };
+    return this->template Solve< Lyt >( half, n, k, A_, A_ld, w, U_, U_ld,
+      arena.Take( this->WorkSize( n, k ) ) );
+  }
+};
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
@@ -11,6 +11,10 @@ namespace LAPACK {
 /// </summary>
 /// <remarks>
 /// Based on the LAPACK routine <c>dlansy</c>.
+///
+/// Also takes the packed layouts, as <c>dlansp</c> and <c>dlansf</c> do:
+/// <see cref="PackedLower"/>, <see cref="PackedUpper"/>,
+/// <see cref="RfpLower"/> and <see cref="RfpUpper"/>.
 /// </remarks>
 template< typename Lyt = ColMajor,
   typename T_Blk_A,
@@ -36,13 +40,30 @@ constexpr Decay<DerefTypeOf<T_Blk_A>> Sym_Norm(
 
   auto value = undefined< Scalar >;
 
-  const Stride A_cs = Lyt::ColStride( A_, A_ld );
-  const Stride A_rs = Lyt::RowStride( A_, A_ld );
-  const Stride A_ds = Lyt::DiagStride( A_, A_ld );
-
   if( Half::Both == half )
   { return value; }
 
+  if constexpr( isPacked< Lyt > || isRfp< Lyt > )
+  {
+    if( Lyt::half != half ){ throw BadArgument{ "Sym_Norm", 2 }; }
+  }
+
+  // Adds the squares of A(i0:i1-1,j) to scale^2*sum, along the column
+  // when the layout has a constant column stride
+  auto ColSsq = [&]( Index i0, Index i1, Index j, Scalar &scale, Scalar &sum )
+  {
+    if constexpr( isRfp< Lyt > )
+    {
+      for( Index i = i0; i < i1; ++i )
+      { Vec_SmSqr( 1, &A(i,j), 1, scale, sum ); }
+    }
+    else
+    {
+      const auto A_col = Lyt::ColPtr( A_, i0, j, A_ld );
+      Vec_SmSqr< Lyt >( i1-i0, A_col, Lyt::ColStride( A_, A_ld ), scale, sum );
+    }
+  };
+
   switch( normType )
   {
   default: break;
@@ -127,49 +148,41 @@ constexpr Decay<DerefTypeOf<T_Blk_A>> Sym_Norm(
   case NormType::Frob:
     {
       // Find normF(A).
-      // SSQ(1) is scale
-      // SSQ(2) is sum-of-squares
-      // For better accuracy, sum each column separately.
+      // Vec_SmSqr keeps one sum accurate across all the columns,
+      // so they need not be summed separately and combined.
 
-      Scalar ssq[2]{ {}, unit<Scalar> };
-      Scalar colssq[2];
+      Scalar scale{};
+      Scalar sum{ unit<Scalar> };
 
       // Sum off-diagonals
 
       if( Half::Upper == half )
       {
         for( Index j = 1; j < (Index)n; ++j )
-        {
-          colssq[0] = {};
-          colssq[1] = unit<Scalar>;
-          const auto A_col = Lyt::ColPtr( A_, 0, j, A_ld );
-          Vec_SmSqr< Lyt >( (j-1)+1, A_col, A_cs, colssq[0], colssq[1] );
-          Aux_CombSsq2( ssq, colssq );
-        }
+        { ColSsq( 0, j, j, scale, sum ); }
       }
       else
       {
         for( Index j = 0; j < (Index)(n-1); ++j )
-        {
-          colssq[0] = {};
-          colssq[1] = unit<Scalar>;
-          const auto A_col = Lyt::ColPtr( A_, j+1, j, A_ld );
-          Vec_SmSqr< Lyt >( n-(j+1), A_col, A_cs, colssq[0], colssq[1] );
-          Aux_CombSsq2( ssq, colssq );
-        }
+        { ColSsq( j+1, (Index)n, j, scale, sum ); }
       }
 
-      ssq[1] += ssq[1];
+      sum += sum;
 
       // Sum diagonal
 
-      const auto pA_diag = Lyt::DiagPtr( A_, 0, 0, A_ld );
-
-      colssq[0] = {};
-      colssq[1] = unit<Scalar>;
-      Vec_SmSqr( n, pA_diag, A_ds, colssq[0], colssq[1] );
-      Aux_CombSsq2( ssq, colssq );
-      value = ssq[0]*Sqrt( ssq[1] );
+      if constexpr( isPacked< Lyt > || isRfp< Lyt > )
+      {
+        // No constant diagonal stride
+        for( Index j = 0; j < (Index)n; ++j )
+        { Vec_SmSqr( 1, &A(j,j), 1, scale, sum ); }
+      }
+      else
+      {
+        const auto pA_diag = Lyt::DiagPtr( A_, 0, 0, A_ld );
+        Vec_SmSqr( n, pA_diag, Lyt::DiagStride( A_, A_ld ), scale, sum );
+      }
+      value = scale*Sqrt( sum );
     }
     break;
   }
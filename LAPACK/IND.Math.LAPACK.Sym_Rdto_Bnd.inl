@@ -0,0 +1,211 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Sym_Rdto_Bnd"/> of order n to kd off-diagonals.
+/// </summary>
+inline constexpr Size Sym_Rdto_Bnd_WorkSize( Size n, Size kd ) noexcept
+{
+  // V and Y, n by kd; T and M, kd by kd; then the panel QR
+  return 2*Max( n, (Size)1 )*kd + 2*kd*kd + Mat_Fctr_QR_Blk_WorkSize( n, kd );
+}
+
+/// <summary>
+/// Reduces a real symmetric matrix A of order n to a symmetric band
+/// matrix B with kd off-diagonals by an orthogonal similarity
+/// transformation: (~Q)*A*Q = B, the first stage of the two-stage
+/// tridiagonal reduction.
+///
+/// B is written to AB in <see cref="Band"/> storage of its lower half:
+/// B(i,j), i >= j, is in row i-j of column j, and AB_ld is at least
+/// kd+1. <see cref="Bnd_Rdto_Syt"/> takes it on from there.
+///
+/// Q is represented as a product of n-kd elementary reflectors,
+///
+///    Q = H(0) H(1) . . . H(n-kd-1),
+///
+/// where H(i) = I - tau*v*(~v), with v(0:i+kd-1) = 0, v(i+kd) = 1, and
+/// v(i+kd+1:n-1) stored on exit in A(i+kd+1:n-1,i); tau takes n-kd
+/// elements. <see cref="Ort_From_Bnd"/> forms Q from them. For
+/// Half::Upper, the upper half of A is copied over the lower one first,
+/// so the reflectors are in the lower half either way.
+///
+/// The work is split through the execution context exec (see
+/// <see cref="ExecContext"/>).
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dsytrd_sy2sb</c>.
+///
+/// Each panel of kd columns below the band is one blocked QR, the
+/// compact WY form I - V*T*(~V) of its kd reflectors is built with
+/// <see cref="Rfl_BlkGen"/>, and the trailing matrix A2 is updated
+/// from both sides at once with
+///
+///    Y := A2*V*T,   Y := Y - (1/2)*V*((~T)*(~V)*Y),
+///    A2 := A2 - V*(~Y) - Y*(~V),
+///
+/// one <see cref="Sym_MatMul"/> and one <see cref="Sym_Rank2kUpd"/>,
+/// which are all but a kd/n part of the flops. No step is Level 2, as
+/// it is for half of the flops of <see cref="Sym_Rdto_Syt_Blk"/>.
+///
+/// work must hold <see cref="Sym_Rdto_Bnd_WorkSize"/>( n, kd ) elements.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Blk_AB,
+  typename T_Arr_tau,
+  typename T_Arr_work,
+  typename T_Exec >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+    && ! isPacked< Lyt > && ! isRfp< Lyt >
+    && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Blk_AB>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> >
+    && ExecContext< Decay<T_Exec> > )
+constexpr void Sym_Rdto_Bnd( Half half,
+  Size n, Size kd,
+  T_Blk_A A_, Stride A_ld,
+  T_Blk_AB AB_, Stride AB_ld,
+  T_Arr_tau tau,
+  T_Arr_work work,
+  T_Exec &&exec )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+  auto A = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( A_, i, j, A_ld ); };
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+
+  if( Half::Both == half ){ throw BadArgument{ "Sym_Rdto_Bnd", 1 }; }
+  if( 0 == kd ){ throw BadArgument{ "Sym_Rdto_Bnd", 3 }; }
+  if( AB_ld < Band::DenseLd( 0, kd ) ){ throw BadArgument{ "Sym_Rdto_Bnd", 7 }; }
+
+  // Quick return if possible
+  if( 0 == n ){ return; }
+
+  if( Half::Upper == half )
+  {
+    for( Index j = 0; j < (Index)n; ++j )
+    {
+      for( Index i = j+1; i < (Index)n; ++i )
+      { A(i,j) = A(j,i); }
+    }
+  }
+
+  const Scalar one = unit<Scalar>;
+  const Scalar zero = {};
+
+  const Stride V_ld = Lyt::DenseLd( n, kd );
+  const Stride T_ld = Lyt::DenseLd( kd, kd );
+
+  const auto V_ = work;
+  const auto Y_ = V_ + Max( n, (Size)1 )*kd;
+  const auto T_ = Y_ + Max( n, (Size)1 )*kd;
+  const auto M_ = T_ + kd*kd;
+  const auto rest = M_ + kd*kd;
+
+  auto V = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( V_, i, j, V_ld ); };
+
+  // Copies the band of columns j0:j1-1 of A into AB
+  auto Copy_Band = [&]( Index j0, Index j1 )
+  {
+    for( Index j = j0; j < j1; ++j )
+    {
+      const Index i1 = Min( (Index)n-1, j+(Index)kd );
+      for( Index i = j; i <= i1; ++i )
+      { Band::MatRef( AB_, i, j, AB_ld, 0 ) = A(i,j); }
+    }
+  };
+
+  Index i = 0;
+  for( ; i+(Index)kd < (Index)n; i += (Index)kd )
+  {
+    // The panel A(i+kd:n-1,i:i+kd-1) and the trailing A2 below it,
+    // both of m2 rows
+    const Index i2 = i+(Index)kd;
+    const Size m2 = n-(Size)i2;
+    const Size k = Min( m2, kd );
+
+    // Factor the panel: R is the band below the diagonal block
+    Mat_Fctr_QR_Blk< Lyt >( m2, kd, A_Blk(i2,i), A_ld, tau+i, rest );
+
+    Copy_Band( i, i2 );
+
+    // V, the reflectors with their unit diagonal and zeros above
+    for( Index j = 0; j < (Index)k; ++j )
+    {
+      for( Index r = 0; r < j; ++r ){ V(r,j) = zero; }
+      V(j,j) = one;
+      for( Index r = j+1; r < (Index)m2; ++r ){ V(r,j) = A(i2+r,i+j); }
+    }
+
+    Rfl_BlkGen< Lyt >( Direct::Fwd, Store::ByCol,
+      m2, k, V_, V_ld, tau+i, T_, T_ld );
+
+    // Y := A2*V*T
+    Sym_MatMul< Lyt >( Side::Left, Half::Lower, m2, k,
+      one, A_Blk(i2,i2), A_ld, V_, V_ld, zero, Y_, V_ld, exec );
+    Tri_MatMul_Rec< Lyt >( Side::Right, Half::Upper, Trnsp::No, Diag::NotUnit,
+      m2, k, one, T_, T_ld, Y_, V_ld );
+
+    // M := (~T)*(~V)*Y, then Y := Y - (1/2)*V*M
+    Mat_MatMul< Lyt >( Trnsp::Yes, Trnsp::No, k, k, m2,
+      one, V_, V_ld, Y_, V_ld, zero, M_, T_ld );
+    Tri_MatMul_Rec< Lyt >( Side::Left, Half::Upper, Trnsp::Yes, Diag::NotUnit,
+      k, k, one, T_, T_ld, M_, T_ld );
+    Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, m2, k, k,
+      -_n_Impl::_oneHalf<Scalar>, V_, V_ld, M_, T_ld, one, Y_, V_ld );
+
+    // A2 := A2 - V*(~Y) - Y*(~V)
+    Sym_Rank2kUpd< Lyt >( Half::Lower, Trnsp::No, m2, k,
+      -one, V_, V_ld, Y_, V_ld, one, A_Blk(i2,i2), A_ld, exec );
+  }
+
+  // The last diagonal block is band already
+  Copy_Band( i, (Index)n );
+}
+
+/// <summary>
+/// Reduces a real symmetric matrix A to a symmetric band matrix as the
+/// overload above does, on the calling thread.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dsytrd_sy2sb</c>.
+///
+/// work must hold <see cref="Sym_Rdto_Bnd_WorkSize"/>( n, kd ) elements.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Blk_AB,
+  typename T_Arr_tau,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+    && ! isPacked< Lyt > && ! isRfp< Lyt >
+    && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Blk_AB>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr void Sym_Rdto_Bnd( Half half,
+  Size n, Size kd,
+  T_Blk_A A_, Stride A_ld,
+  T_Blk_AB AB_, Stride AB_ld,
+  T_Arr_tau tau,
+  T_Arr_work work )
+{ Sym_Rdto_Bnd< Lyt >( half, n, kd, A_, A_ld, AB_, AB_ld, tau, work, Exec_Seq{} ); }
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
@@ -0,0 +1,191 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Reduces the real symmetric-definite generalized eigenproblem
+///
+///    A*x = lambda*B*x
+///
+/// to the standard form C*y = lambda*y, with B already factored by
+/// <see cref="Sym_Fctr_Chol"/>: C = inv(~U)*A*inv(U), y = U*x, if
+/// half = Upper, and C = inv(L)*A*inv(~L), y = (~L)*x, if half = Lower.
+/// Only the given half of A is referenced, and overwritten by C; B
+/// holds the factor in the same half.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dsygs2</c>, with ITYPE = 1.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Blk_B >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Blk_B>> > )
+constexpr void Sym_Rdto_Std( Half half,
+  Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Blk_B B_, Stride B_ld )
+{
+  IND_MATH_TRACE_SCOPE( "Sym_Rdto_Std", n, n, 0,
+    (double)n*n*n, (double)n*(n+1)*sizeof( *A_ ) );
+
+  using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+  auto A = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( A_, i, j, A_ld ); };
+  auto B = [&]( auto i, auto j ) -> const auto &
+  { return Lyt::MatRef( B_, i, j, B_ld ); };
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+  auto B_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( B_, i, j, B_ld ); };
+
+  if( ( Half::Upper != half ) && ( Half::Lower != half ) )
+  { throw BadArgument{ "Sym_Rdto_Std", 1 }; }
+
+  const Scalar one = unit<Scalar>;
+
+  for( Index k = 0; k < (Index)n; ++k )
+  {
+    // Update the diagonal element
+    const Scalar bkk = B(k,k);
+    const Scalar akk = A(k,k)/( bkk*bkk );
+    A(k,k) = akk;
+
+    const Size r = n-(Size)k-1;
+    if( 0 == r ){ continue; }
+
+    const Scalar ct = -akk/2;
+
+    // Update the row (Upper) or column (Lower) of A right of or
+    // below the diagonal, and the trailing matrix
+    if( Half::Upper == half )
+    {
+      const auto A_rs = Lyt::RowStride( A_, A_ld );
+      const auto B_rs = Lyt::RowStride( B_, B_ld );
+      const auto a = Lyt::RowPtr( A_, k, k+1, A_ld );
+      const auto b = Lyt::RowPtr( B_, k, k+1, B_ld );
+
+      Vec_Scale< Lyt >( r, Inv( bkk ), a, A_rs );
+      Vec_AXPlusY< Lyt >( r, ct, b, B_rs, a, A_rs );
+      Sym_Rank2Upd< Lyt >( Half::Upper, r, -one, a, A_rs, b, B_rs, A_Blk(k+1,k+1), A_ld );
+      Vec_AXPlusY< Lyt >( r, ct, b, B_rs, a, A_rs );
+      Tri_Solv_Vec< Lyt >( Half::Upper, Trnsp::Yes, Diag::NotUnit, r, B_Blk(k+1,k+1), B_ld, a, A_rs );
+    }
+    else
+    {
+      const auto A_cs = Lyt::ColStride( A_, A_ld );
+      const auto B_cs = Lyt::ColStride( B_, B_ld );
+      const auto a = Lyt::ColPtr( A_, k+1, k, A_ld );
+      const auto b = Lyt::ColPtr( B_, k+1, k, B_ld );
+
+      Vec_Scale< Lyt >( r, Inv( bkk ), a, A_cs );
+      Vec_AXPlusY< Lyt >( r, ct, b, B_cs, a, A_cs );
+      Sym_Rank2Upd< Lyt >( Half::Lower, r, -one, a, A_cs, b, B_cs, A_Blk(k+1,k+1), A_ld );
+      Vec_AXPlusY< Lyt >( r, ct, b, B_cs, a, A_cs );
+      Tri_Solv_Vec< Lyt >( Half::Lower, Trnsp::No, Diag::NotUnit, r, B_Blk(k+1,k+1), B_ld, a, A_cs );
+    }
+  }
+}
+
+/// <summary>
+/// Blocked reduction of the real symmetric-definite generalized
+/// eigenproblem to standard form, with the same result as
+/// <see cref="Sym_Rdto_Std"/>.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dsygst</c>, with ITYPE = 1.
+///
+/// Each diagonal block of nb is reduced by the unblocked code; its
+/// off-diagonal panel then takes two <see cref="Tri_Solv_Mat"/> and
+/// two <see cref="Sym_MatMul"/>, and the trailing matrix one
+/// <see cref="Sym_Rank2kUpd"/>, so that almost all of the work runs
+/// in matrix products. If nb &lt; 2 or nb &gt;= n, this is exactly
+/// the unblocked code.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Blk_B >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+  && ! isPacked< Lyt > && ! isRfp< Lyt >
+  && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Blk_B>> > )
+constexpr void Sym_Rdto_Std_Blk( Half half,
+  Size n,
+  T_Blk_A A_, Stride A_ld,
+  T_Blk_B B_, Stride B_ld,
+  Size nb = Mat_Fctr_BlkSize )
+{
+  IND_MATH_TRACE_SCOPE( "Sym_Rdto_Std_Blk", n, n, nb,
+    (double)n*n*n, (double)n*(n+1)*sizeof( *A_ ) );
+
+  using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+  auto B_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( B_, i, j, B_ld ); };
+
+  if( ( Half::Upper != half ) && ( Half::Lower != half ) )
+  { throw BadArgument{ "Sym_Rdto_Std_Blk", 1 }; }
+
+  if( ( nb < 2 ) || ( nb >= n ) )
+  { return Sym_Rdto_Std< Lyt >( half, n, A_, A_ld, B_, B_ld ); }
+
+  const Scalar one = unit<Scalar>;
+  const Scalar mhalf = -one/2;
+
+  for( Size k = 0; k < n; k += nb )
+  {
+    const Size kb = Min( n-k, nb );
+    const Size k1 = k+kb;
+    const Size r = n-k1;
+
+    Sym_Rdto_Std< Lyt >( half, kb, A_Blk(k,k), A_ld, B_Blk(k,k), B_ld );
+    if( 0 == r ){ continue; }
+
+    if( Half::Upper == half )
+    {
+      // A12 := inv(~U11)*A12 - A11*U12/2, A22 -= (~A12)*U12 + (~U12)*A12,
+      // A12 := (A12 - A11*U12/2)*inv(U22)
+      Tri_Solv_Mat< Lyt >( Side::Left, Half::Upper, Trnsp::Yes, Diag::NotUnit,
+        kb, r, one, B_Blk(k,k), B_ld, A_Blk(k,k1), A_ld );
+      Sym_MatMul< Lyt >( Side::Left, Half::Upper, kb, r, mhalf,
+        A_Blk(k,k), A_ld, B_Blk(k,k1), B_ld, one, A_Blk(k,k1), A_ld );
+      Sym_Rank2kUpd< Lyt >( Half::Upper, Trnsp::Yes, r, kb, -one,
+        A_Blk(k,k1), A_ld, B_Blk(k,k1), B_ld, one, A_Blk(k1,k1), A_ld );
+      Sym_MatMul< Lyt >( Side::Left, Half::Upper, kb, r, mhalf,
+        A_Blk(k,k), A_ld, B_Blk(k,k1), B_ld, one, A_Blk(k,k1), A_ld );
+      Tri_Solv_Mat< Lyt >( Side::Right, Half::Upper, Trnsp::No, Diag::NotUnit,
+        kb, r, one, B_Blk(k1,k1), B_ld, A_Blk(k,k1), A_ld );
+    }
+    else
+    {
+      // A21 := A21*inv(~L11) - L21*A11/2, A22 -= A21*(~L21) + L21*(~A21),
+      // A21 := inv(L22)*(A21 - L21*A11/2)
+      Tri_Solv_Mat< Lyt >( Side::Right, Half::Lower, Trnsp::Yes, Diag::NotUnit,
+        r, kb, one, B_Blk(k,k), B_ld, A_Blk(k1,k), A_ld );
+      Sym_MatMul< Lyt >( Side::Right, Half::Lower, r, kb, mhalf,
+        A_Blk(k,k), A_ld, B_Blk(k1,k), B_ld, one, A_Blk(k1,k), A_ld );
+      Sym_Rank2kUpd< Lyt >( Half::Lower, Trnsp::No, r, kb, -one,
+        A_Blk(k1,k), A_ld, B_Blk(k1,k), B_ld, one, A_Blk(k1,k1), A_ld );
+      Sym_MatMul< Lyt >( Side::Right, Half::Lower, r, kb, mhalf,
+        A_Blk(k,k), A_ld, B_Blk(k1,k), B_ld, one, A_Blk(k1,k), A_ld );
+      Tri_Solv_Mat< Lyt >( Side::Left, Half::Lower, Trnsp::No, Diag::NotUnit,
+        r, kb, one, B_Blk(k1,k1), B_ld, A_Blk(k1,k), A_ld );
+    }
+  }
+}
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
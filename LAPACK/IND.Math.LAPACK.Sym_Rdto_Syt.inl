@@ -49,13 +49,17 @@ namespace LAPACK {
 /// </summary>
 /// <remarks>
 /// Based on the LAPACK routine <c>dsytd2</c>.
+///
+/// With <see cref="PackedLower"/> or <see cref="PackedUpper"/> storage
+/// this is <c>dsptrd</c>, and the reflectors are kept in the packed
+/// columns as they would be in the dense ones.
 /// </remarks>
 template< typename Lyt = ColMajor,
   typename T_Blk_A,
   typename T_Arr_d,
   typename T_Arr_e,
   typename T_Arr_tau >
-requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> > && ! isRfp< Lyt >
     && areTheSame<
   Decay<DerefTypeOf<T_Blk_A>>,
   Decay<DerefTypeOf<T_Arr_d>>,
@@ -65,6 +69,9 @@ constexpr void Sym_Rdto_Syt( Half half,
   Size n, T_Blk_A A_, Stride A_ld,
   T_Arr_d d, T_Arr_e e, T_Arr_tau tau )
 {
+  IND_MATH_TRACE_SCOPE( "Sym_Rdto_Syt", n, n, 0,
+    4.0/3.0*n*n*n, (double)n*(n+1)*sizeof( *A_ ) );
+
   using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
 
   auto A = [&]( auto i, auto j ) -> auto &
@@ -75,7 +82,7 @@ constexpr void Sym_Rdto_Syt( Half half,
 
   const auto overTwo = Inv( 2*unit<Scalar> );
 
-  const Stride A_cs = Lyt::ColStride( A_, A_ld );
+  const auto A_cs = Lyt::ColStride( A_, A_ld );
 
   if( Half::Upper == half )
   {
@@ -142,8 +149,9 @@ constexpr void Sym_Rdto_Syt( Half half,
         v[0] = unit<Scalar>;
 
         const T_Blk_A pA_sub = Lyt::BlkPtr( A_, i+1, i+1, A_ld );
+        const Stride sub_ld = Lyt::DiagBlkLd( i+1, A_ld );
         Sym_VecMul< Lyt >( Half::Lower, n-(i+1), taui,
-          pA_sub, A_ld, v, A_cs, {}, tau+i, 1 );
+          pA_sub, sub_ld, v, A_cs, {}, tau+i, 1 );
 
         // Compute  w := x - ((1/2) * tau*dot(x,v)) * v
         const auto alpha = -overTwo*taui*Vec_Dot< Lyt >( n-(i+1), tau+i, 1, v, A_cs );
@@ -152,7 +160,7 @@ constexpr void Sym_Rdto_Syt( Half half,
         // Apply the transformation as a rank-2 update:
         // A := A - v*(~w) - w*(~v)
         Sym_Rank2Upd< Lyt >( Half::Lower, n-(i+1), -unit<Scalar>,
-          v, A_cs, tau+i, 1, pA_sub, A_ld );
+          v, A_cs, tau+i, 1, pA_sub, sub_ld );
         v[0] = e[i];
       }
       d[i] = A(i,i);
@@ -162,6 +170,416 @@ constexpr void Sym_Rdto_Syt( Half half,
   }
 }
 
+namespace _n_Impl {
+
+  // Reduces nb rows and columns of the n by n symmetric matrix A
+  // to tridiagonal form, and returns the n by nb matrix W needed to
+  // apply the transformation to the unreduced part of A as
+  //
+  //    A := A - V*(~W) - W*(~V).
+  //
+  // If half == Half::Upper, the last nb columns are reduced and V is
+  // stored in A(0:n-1,n-nb:n-1); otherwise the first nb columns are
+  // reduced and V is stored in A(0:n-1,0:nb-1). Based on dlatrd.
+  //
+  // The products with the unreduced part of A go through
+  // symv( i0, r, v, w ), which must set w := S*v for the symmetric
+  // S = A(i0:i0+r-1,i0:i0+r-1) as it was on entry, from the given half;
+  // Sym_Rdto_Syt_Dev hands them to the device that holds A.
+  template< typename Lyt,
+    typename T_Blk_A,
+    typename T_Arr_e,
+    typename T_Arr_tau,
+    typename T_Blk_W,
+    typename T_Fn_SymVecMul >
+  constexpr void _Sym_Rdto_Syt_Pnl( Half half,
+    Size n, Size nb,
+    T_Blk_A A_, Stride A_ld,
+    T_Arr_e e, T_Arr_tau tau,
+    T_Blk_W W_, Stride W_ld,
+    T_Fn_SymVecMul &&symv )
+  {
+    using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+    auto A = [&]( auto i, auto j ) -> auto &
+    { return Lyt::MatRef( A_, i, j, A_ld ); };
+    auto A_Blk = [&]( auto i, auto j ) -> auto
+    { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+    auto A_Col = [&]( auto i, auto j ) -> auto
+    { return Lyt::ColPtr( A_, i, j, A_ld ); };
+    auto A_Row = [&]( auto i, auto j ) -> auto
+    { return Lyt::RowPtr( A_, i, j, A_ld ); };
+    auto W_Blk = [&]( auto i, auto j ) -> auto
+    { return Lyt::BlkPtr( W_, i, j, W_ld ); };
+    auto W_Col = [&]( auto i, auto j ) -> auto
+    { return Lyt::ColPtr( W_, i, j, W_ld ); };
+    auto W_Row = [&]( auto i, auto j ) -> auto
+    { return Lyt::RowPtr( W_, i, j, W_ld ); };
+
+    const auto A_cs = Lyt::ColStride( A_, A_ld );
+    const auto A_rs = Lyt::RowStride( A_, A_ld );
+    const auto W_cs = Lyt::ColStride( W_, W_ld );
+    const auto W_rs = Lyt::RowStride( W_, W_ld );
+
+    const Scalar zero = {};
+    const Scalar one = unit<Scalar>;
+    const auto overTwo = Inv( 2*one );
+
+    if( Half::Upper == half )
+    {
+      // Reduce last nb columns of upper triangle
+
+      for( Index i = (Index)(n-1); i >= (Index)(n-nb); --i )
+      {
+        const Index iw = i-(Index)(n-nb);
+        const Size r = n-1-i;
+
+        if( r > 0 )
+        {
+          // Update A(0:i,i)
+          Mat_VecMul< Lyt >( Trnsp::No, i+1, r, -one,
+            A_Blk(0,i+1), A_ld, W_Row(i,iw+1), W_rs, one, A_Col(0,i), A_cs );
+          Mat_VecMul< Lyt >( Trnsp::No, i+1, r, -one,
+            W_Blk(0,iw+1), W_ld, A_Row(i,i+1), A_rs, one, A_Col(0,i), A_cs );
+        }
+
+        if( i > 0 )
+        {
+          // Generate elementary reflector H(i-1) to annihilate
+          // A(0:i-2,i)
+          Rfl_VecGen< Lyt >( i, A(i-1,i), A_Col(0,i), A_cs, tau[i-1] );
+          e[i-1] = A(i-1,i);
+          A(i-1,i) = one;
+
+          const auto v = A_Col(0,i);
+          const auto w = W_Col(0,iw);
+          const auto t = W_Col(i+1,iw);
+
+          // Compute W(0:i-1,iw)
+          symv( 0, (Size)i, v, w );
+          if( r > 0 )
+          {
+            Mat_VecMul< Lyt >( Trnsp::Yes, i, r, one,
+              W_Blk(0,iw+1), W_ld, v, A_cs, zero, t, W_cs );
+            Mat_VecMul< Lyt >( Trnsp::No, i, r, -one,
+              A_Blk(0,i+1), A_ld, t, W_cs, one, w, W_cs );
+            Mat_VecMul< Lyt >( Trnsp::Yes, i, r, one,
+              A_Blk(0,i+1), A_ld, v, A_cs, zero, t, W_cs );
+            Mat_VecMul< Lyt >( Trnsp::No, i, r, -one,
+              W_Blk(0,iw+1), W_ld, t, W_cs, one, w, W_cs );
+          }
+          Vec_Scale< Lyt >( i, tau[i-1], w, W_cs );
+          const auto alpha = -overTwo*tau[i-1]*Vec_Dot< Lyt >( i, w, W_cs, v, A_cs );
+          Vec_AXPlusY< Lyt >( i, alpha, v, A_cs, w, W_cs );
+        }
+      }
+    }
+    else if( Half::Lower == half )
+    {
+      // Reduce first nb columns of lower triangle
+
+      for( Index i = 0; i < (Index)nb; ++i )
+      {
+        if( i > 0 )
+        {
+          // Update A(i:n-1,i)
+          Mat_VecMul< Lyt >( Trnsp::No, n-i, i, -one,
+            A_Blk(i,0), A_ld, W_Row(i,0), W_rs, one, A_Col(i,i), A_cs );
+          Mat_VecMul< Lyt >( Trnsp::No, n-i, i, -one,
+            W_Blk(i,0), W_ld, A_Row(i,0), A_rs, one, A_Col(i,i), A_cs );
+        }
+
+        if( i < (Index)(n-1) )
+        {
+          const Size r = n-(i+1);
+
+          // Generate elementary reflector H(i) to annihilate
+          // A(i+2:n-1,i)
+          Rfl_VecGen< Lyt >( r, A(i+1,i),
+            A_Col( Min( i+2, (Index)(n-1) ), i ), A_cs, tau[i] );
+          e[i] = A(i+1,i);
+          A(i+1,i) = one;
+
+          const auto v = A_Col(i+1,i);
+          const auto w = W_Col(i+1,i);
+          const auto t = W_Col(0,i);
+
+          // Compute W(i+1:n-1,i)
+          symv( i+1, r, v, w );
+          if( i > 0 )
+          {
+            Mat_VecMul< Lyt >( Trnsp::Yes, r, i, one,
+              W_Blk(i+1,0), W_ld, v, A_cs, zero, t, W_cs );
+            Mat_VecMul< Lyt >( Trnsp::No, r, i, -one,
+              A_Blk(i+1,0), A_ld, t, W_cs, one, w, W_cs );
+            Mat_VecMul< Lyt >( Trnsp::Yes, r, i, one,
+              A_Blk(i+1,0), A_ld, v, A_cs, zero, t, W_cs );
+            Mat_VecMul< Lyt >( Trnsp::No, r, i, -one,
+              W_Blk(i+1,0), W_ld, t, W_cs, one, w, W_cs );
+          }
+          Vec_Scale< Lyt >( r, tau[i], w, W_cs );
+          const auto alpha = -overTwo*tau[i]*Vec_Dot< Lyt >( r, w, W_cs, v, A_cs );
+          Vec_AXPlusY< Lyt >( r, alpha, v, A_cs, w, W_cs );
+        }
+      }
+    }
+  }
+
+}// namespace _n_Impl
+
+inline constexpr Size Sym_Rdto_Syt_Blk_WorkSize( Size n, Size nb = Mat_Fctr_BlkSize ) noexcept
+{ return Max( n, (Size)1 )*nb; }
+
+/// <summary>
+/// Blocked tridiagonal reduction of a real symmetric matrix, with the
+/// same result as <see cref="Sym_Rdto_Syt"/>.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dsytrd</c>.
+///
+/// Each panel of nb columns is reduced with Level-2 operations while
+/// the update of the rest of the matrix is accumulated in an n by nb
+/// matrix W, which is then applied with one <see cref="Sym_Rank2kUpd"/>.
+///
+/// work must hold <see cref="Sym_Rdto_Syt_Blk_WorkSize"/>( n, nb ) elements.
+/// If nb &lt; 2 or nb &gt;= n, this is exactly the unblocked code.
+/// Packed storage goes through <see cref="Sym_Rdto_Syt"/> instead.
+/// </remarks>
+template< typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_d,
+  typename T_Arr_e,
+  typename T_Arr_tau,
+  typename T_Arr_work >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+    && ! isPacked< Lyt > && ! isRfp< Lyt >
+    && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_d>>,
+  Decay<DerefTypeOf<T_Arr_e>>,
+  Decay<DerefTypeOf<T_Arr_tau>>,
+  Decay<DerefTypeOf<T_Arr_work>> > )
+constexpr void Sym_Rdto_Syt_Blk( Half half,
+  Size n, T_Blk_A A_, Stride A_ld,
+  T_Arr_d d, T_Arr_e e, T_Arr_tau tau,
+  T_Arr_work work,
+  Size nb = Mat_Fctr_BlkSize )
+{
+  IND_MATH_TRACE_SCOPE( "Sym_Rdto_Syt_Blk", n, n, nb,
+    4.0/3.0*n*n*n, (double)n*(n+1)*sizeof( *A_ ) );
+
+  using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+  auto A = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( A_, i, j, A_ld ); };
+  auto A_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( A_, i, j, A_ld ); };
+
+  if( Half::Both == half ){ throw BadArgument{ "Sym_Rdto_Syt_Blk", 1 }; }
+
+  if( ( nb < 2 ) || ( nb >= n ) )
+  { return Sym_Rdto_Syt< Lyt >( half, n, A_, A_ld, d, e, tau ); }
+
+  const Stride W_ld = Lyt::DenseLd( n, nb );
+
+  auto W_Blk = [&]( auto i, auto j ) -> auto
+  { return Lyt::BlkPtr( work, i, j, W_ld ); };
+
+  const Scalar one = unit<Scalar>;
+
+  if( Half::Upper == half )
+  {
+    // Columns kk:n-1 are reduced by the blocked code, last panel
+    // first; A(0:kk-1,0:kk-1) is then reduced by the unblocked code.
+    const Size kk = n - ( (n-1)/nb )*nb;
+
+    for( Index i = (Index)(n-nb); i >= (Index)kk; i -= (Index)nb )
+    {
+      // Reduce columns i:i+nb-1 to tridiagonal form and form the
+      // matrix W which is needed to update the unreduced part of
+      // the matrix
+      _n_Impl::_Sym_Rdto_Syt_Pnl< Lyt >( Half::Upper, i+nb, nb,
+        A_, A_ld, e, tau, work, W_ld,
+        [&]( Index i0, Size r, auto v, auto w )
+        {
+          Sym_VecMul< Lyt >( Half::Upper, r, one, A_Blk(i0,i0), A_ld,
+            v, Lyt::ColStride( A_, A_ld ), Scalar{}, w, Lyt::ColStride( work, W_ld ) );
+        } );
+
+      // Update the unreduced submatrix A(0:i-1,0:i-1), using an
+      // update of the form:  A := A - V*(~W) - W*(~V)
+      Sym_Rank2kUpd< Lyt >( Half::Upper, Trnsp::No, i, nb, -one,
+        A_Blk(0,i), A_ld, work, W_ld, one, A_, A_ld );
+
+      // Copy superdiagonal elements back into A, and diagonal
+      // elements into d
+      for( Index j = i; j < i+(Index)nb; ++j )
+      {
+        A(j-1,j) = e[j-1];
+        d[j] = A(j,j);
+      }
+    }
+
+    Sym_Rdto_Syt< Lyt >( Half::Upper, kk, A_, A_ld, d, e, tau );
+  }
+  else
+  {
+    // Columns 0:i-1 are reduced by the blocked code; the trailing
+    // A(i:n-1,i:n-1) is then reduced by the unblocked code.
+    Index i = 0;
+    for( ; i+(Index)nb < (Index)n; i += (Index)nb )
+    {
+      // Reduce columns i:i+nb-1 to tridiagonal form and form the
+      // matrix W which is needed to update the unreduced part of
+      // the matrix
+      _n_Impl::_Sym_Rdto_Syt_Pnl< Lyt >( Half::Lower, n-i, nb,
+        A_Blk(i,i), A_ld, e+i, tau+i, work, W_ld,
+        [&]( Index i0, Size r, auto v, auto w )
+        {
+          Sym_VecMul< Lyt >( Half::Lower, r, one, A_Blk(i+i0,i+i0), A_ld,
+            v, Lyt::ColStride( A_, A_ld ), Scalar{}, w, Lyt::ColStride( work, W_ld ) );
+        } );
+
+      // Update the unreduced submatrix A(i+nb:n-1,i+nb:n-1), using
+      // an update of the form:  A := A - V*(~W) - W*(~V)
+      Sym_Rank2kUpd< Lyt >( Half::Lower, Trnsp::No, n-(i+nb), nb, -one,
+        A_Blk(i+nb,i), A_ld, W_Blk(nb,0), W_ld, one, A_Blk(i+nb,i+nb), A_ld );
+
+      // Copy subdiagonal elements back into A, and diagonal
+      // elements into d
+      for( Index j = i; j < i+(Index)nb; ++j )
+      {
+        A(j+1,j) = e[j];
+        d[j] = A(j,j);
+      }
+    }
+
+    Sym_Rdto_Syt< Lyt >( Half::Lower, n-i, A_Blk(i,i), A_ld, d+i, e+i, tau+i );
+  }
+}
+
+/// <summary>
+/// Tridiagonal reduction of a real symmetric matrix of order n fixed
+/// at compile time, with the same output as <see cref="Sym_Rdto_Syt"/>.
+///
+/// The symmetric matrix-vector product and the rank-2 update are
+/// written out with constant bounds, on reflector vectors kept on
+/// the stack, so for the small orders this is meant for (3, 4) the
+/// loops unroll and the reduction can be evaluated at compile time.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routine <c>dsytd2</c>.
+/// </remarks>
+template< Size n,
+  typename Lyt = ColMajor,
+  typename T_Blk_A,
+  typename T_Arr_d,
+  typename T_Arr_e,
+  typename T_Arr_tau >
+requires( ! isComplex< Decay<DerefTypeOf<T_Blk_A>> >
+    && areTheSame<
+  Decay<DerefTypeOf<T_Blk_A>>,
+  Decay<DerefTypeOf<T_Arr_d>>,
+  Decay<DerefTypeOf<T_Arr_e>>,
+  Decay<DerefTypeOf<T_Arr_tau>> > )
+constexpr void Sym_Rdto_Syt( Half half,
+  T_Blk_A A_, Stride A_ld,
+  T_Arr_d d, T_Arr_e e, T_Arr_tau tau )
+{
+  using Scalar = Decay<DerefTypeOf<T_Blk_A>>;
+
+  auto A = [&]( auto i, auto j ) -> auto &
+  { return Lyt::MatRef( A_, i, j, A_ld ); };
+
+  if constexpr ( 0 == n ){ return; }
+  else
+  {
+    const auto overTwo = Inv( 2*unit<Scalar> );
+
+    const auto A_cs = Lyt::ColStride( A_, A_ld );
+
+    // v of the current reflector, and x, then w, of the update
+    std::array< Scalar, n > v{}, w{};
+
+    // Applies H = I - taui*v*(~v) from both sides to A(i0:i1-1,i0:i1-1),
+    // the half of which is referenced by a( r, c ) for r <= c.
+    auto Apply = [&]( Index i0, Index i1, Scalar taui, auto &&a )
+    {
+      // x := taui*A*v
+      for( Index r = i0; r < i1; ++r )
+      {
+        Scalar u{};
+        for( Index c = i0; c < i1; ++c )
+        { u += ( ( r <= c ) ? a( r, c ) : a( c, r ) )*v[c]; }
+        w[r] = taui*u;
+      }
+
+      // w := x - ( (1/2)*taui*dot(x,v) )*v
+      Scalar xv{};
+      for( Index r = i0; r < i1; ++r )
+      { xv += w[r]*v[r]; }
+      const auto alpha = -overTwo*taui*xv;
+      for( Index r = i0; r < i1; ++r )
+      { w[r] += alpha*v[r]; }
+
+      // A := A - v*(~w) - w*(~v)
+      for( Index c = i0; c < i1; ++c )
+      {
+        for( Index r = i0; r <= c; ++r )
+        { a( r, c ) -= v[r]*w[c] + w[r]*v[c]; }
+      }
+    };
+
+    if( Half::Upper == half )
+    {
+      // Reduce the upper triangle of A
+      for( Index i = (Index)n-2; i >= 0; --i )
+      {
+        // Generate H(i) to annihilate A(0:i-1,i+1)
+        Scalar taui;
+        Rfl_VecGen< Lyt >( i+1, A(i,i+1), Lyt::ColPtr( A_, 0, i+1, A_ld ), A_cs, taui );
+        e[i] = A(i,i+1);
+
+        if( ! IsZero( taui ) )
+        {
+          for( Index r = 0; r < i; ++r )
+          { v[r] = A(r,i+1); }
+          v[i] = unit<Scalar>;
+
+          Apply( 0, i+1, taui, [&]( Index r, Index c ) -> Scalar & { return A(r,c); } );
+        }
+        d[i+1] = A(i+1,i+1);
+        tau[i] = taui;
+      }
+      d[0] = A(0,0);
+    }
+    else if( Half::Lower == half )
+    {
+      // Reduce the lower triangle of A
+      for( Index i = 0; i < (Index)n-1; ++i )
+      {
+        // Generate H(i) to annihilate A(i+2:n-1,i)
+        Scalar taui;
+        Rfl_VecGen< Lyt >( n-(i+1), A(i+1,i),
+          Lyt::BlkPtr( A_, Min( i+2, (Index)n-1 ), i, A_ld ), A_cs, taui );
+        e[i] = A(i+1,i);
+
+        if( ! IsZero( taui ) )
+        {
+          v[i+1] = unit<Scalar>;
+          for( Index r = i+2; r < (Index)n; ++r )
+          { v[r] = A(r,i); }
+
+          Apply( i+1, (Index)n, taui, [&]( Index r, Index c ) -> Scalar & { return A(c,r); } );
+        }
+        d[i] = A(i,i);
+        tau[i] = taui;
+      }
+      d[n-1] = A(n-1,n-1);
+    }
+  }
+}
+
 }// namespace LAPACK
 }// namespace Math
 }// namespace IND
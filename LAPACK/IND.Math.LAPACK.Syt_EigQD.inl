@@ -0,0 +1,995 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Syt_EigQD"/>.
+/// </summary>
+inline constexpr Size Syt_EigQD_WorkSize( Size n ) noexcept
+{ return 4*n; }
+
+/// <summary>
+/// Eigenvalue solver for Symmetric Tridiagonal matrices, by the dqds
+/// algorithm.
+///
+/// Each unreduced block is shifted by its Gershgorin lower bound
+/// sigma, so that T - sigma I is positive definite, and factored as
+/// L D (~L); dqds then computes the eigenvalues of L D (~L) to high
+/// relative accuracy, and sigma is added back. On output d holds the
+/// eigenvalues in increasing order; e is destroyed.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routines <c>dlasq2</c> to <c>dlasq6</c>, applied
+/// to a shifted factorization as in <c>dlarre</c>.
+///
+/// Faster than <see cref="Syt_EigQR"/> for values only, as each dqds
+/// step takes no square roots; its eigenvalues carry an error of a few
+/// ulps of the norm of their block, as those of Syt_EigQR do.
+///
+/// work must hold <see cref="Syt_EigQD_WorkSize"/>( n ) elements.
+/// </remarks>
+template< typename T_Scalar, typename DefaultLyt = Flat >
+requires( ! isComplex< T_Scalar > )
+class Syt_EigQD
+{
+public:
+
+  using Scalar = T_Scalar;
+
+  struct Config
+  {
+    // dqds steps allowed per eigenvalue.
+    Size maxIterationCount = 100;
+    Scalar zeroTol = std::numeric_limits< T_Scalar >::epsilon();
+  };
+
+private:
+
+  Config _config;
+
+  // The state of dqds carried between its steps, as dlasq3 has it.
+  struct _State
+  {
+    Scalar dmin = {}, dmin1 = {}, dmin2 = {};
+    Scalar dn = {}, dn1 = {}, dn2 = {};
+    Scalar g = {}, tau = {};
+    Scalar sigma = {}, desig = {};
+    Index ttype = 0;
+  };
+
+  // The qd array, z(1:4*n) with the indices of dlasq2
+  struct _Z
+  {
+    Scalar *z;
+    constexpr Scalar &operator()( Index i ) const noexcept
+    { return z[i-1]; }
+  };
+
+  // Reverses the qd array i0:n0 of the ping-pong pair.
+  static constexpr void _Flip( const _Z &Z, Index i0, Index n0 ) noexcept
+  {
+    const Index ipn4 = 4*( i0+n0 );
+    for( Index j4 = 4*i0; j4 <= 2*( i0+n0-1 ); j4 += 4 )
+    {
+      Swap( Z( j4-3 ), Z( ipn4-j4-3 ) );
+      Swap( Z( j4-2 ), Z( ipn4-j4-2 ) );
+      Swap( Z( j4-1 ), Z( ipn4-j4-5 ) );
+      Swap( Z( j4 ), Z( ipn4-j4-4 ) );
+    }
+  }
+
+  // One dqds step with shift tau on i0:n0, as dlasq5 does in IEEE
+  // arithmetic; small d are set to zero when tau is.
+  constexpr void _Dqds( const _Z &Z, Index i0, Index n0, Index pp, _State &st ) const
+  {
+    if( n0-i0-1 <= 0 ){ return; }
+
+    const Scalar eps = this->_config.zeroTol;
+    const Scalar dthresh = eps*( st.sigma + st.tau );
+    if( st.tau < dthresh/2 ){ st.tau = {}; }
+    const Scalar tau = st.tau;
+    const bool clip = IsZero( tau );
+
+    Index j4 = 4*i0 + pp - 3;
+    Scalar emin = Z( j4+4 );
+    Scalar d = Z( j4 ) - tau;
+    st.dmin = d;
+    st.dmin1 = -Z( j4 );
+
+    for( j4 = 4*i0; j4 <= 4*( n0-3 ); j4 += 4 )
+    {
+      if( 0 == pp )
+      {
+        Z( j4-2 ) = d + Z( j4-1 );
+        const Scalar temp = Z( j4+1 )/Z( j4-2 );
+        d = d*temp - tau;
+        if( clip && ( d < dthresh ) ){ d = {}; }
+        st.dmin = Min( st.dmin, d );
+        Z( j4 ) = Z( j4-1 )*temp;
+        emin = Min( Z( j4 ), emin );
+      }
+      else
+      {
+        Z( j4-3 ) = d + Z( j4 );
+        const Scalar temp = Z( j4+2 )/Z( j4-3 );
+        d = d*temp - tau;
+        if( clip && ( d < dthresh ) ){ d = {}; }
+        st.dmin = Min( st.dmin, d );
+        Z( j4-1 ) = Z( j4 )*temp;
+        emin = Min( Z( j4-1 ), emin );
+      }
+    }
+
+    // Unroll last two steps.
+    st.dn2 = d;
+    st.dmin2 = st.dmin;
+    j4 = 4*( n0-2 ) - pp;
+    Index j4p2 = j4 + 2*pp - 1;
+    Z( j4-2 ) = st.dn2 + Z( j4p2 );
+    Z( j4 ) = Z( j4p2+2 )*( Z( j4p2 )/Z( j4-2 ) );
+    st.dn1 = Z( j4p2+2 )*( st.dn2/Z( j4-2 ) ) - tau;
+    st.dmin = Min( st.dmin, st.dn1 );
+
+    st.dmin1 = st.dmin;
+    j4 += 4;
+    j4p2 = j4 + 2*pp - 1;
+    Z( j4-2 ) = st.dn1 + Z( j4p2 );
+    Z( j4 ) = Z( j4p2+2 )*( Z( j4p2 )/Z( j4-2 ) );
+    st.dn = Z( j4p2+2 )*( st.dn1/Z( j4-2 ) ) - tau;
+    st.dmin = Min( st.dmin, st.dn );
+
+    Z( j4+2 ) = st.dn;
+    Z( 4*n0-pp ) = emin;
+  }
+
+  // One dqd step without shift on i0:n0, guarded against underflow,
+  // as dlasq6 does.
+  static constexpr void _Dqd( const _Z &Z, Index i0, Index n0, Index pp, _State &st ) noexcept
+  {
+    if( n0-i0-1 <= 0 ){ return; }
+
+    const Scalar safmin = minValue< Scalar >;
+
+    // z(jn) := z(jq)*( z(je)/z(jd) ) and d := z(jq)*( d/z(jd) ),
+    // avoiding underflow where possible; true if z(jd) is zero.
+    auto Div = [&]( Index jd, Index jn, Index je, Index jq, Scalar &d ) -> bool
+    {
+      if( IsZero( Z( jd ) ) )
+      {
+        Z( jn ) = {};
+        d = Z( jq );
+        return true;
+      }
+      if( ( safmin*Z( jq ) < Z( jd ) ) && ( safmin*Z( jd ) < Z( jq ) ) )
+      {
+        const Scalar temp = Z( jq )/Z( jd );
+        Z( jn ) = Z( je )*temp;
+        d *= temp;
+      }
+      else
+      {
+        Z( jn ) = Z( jq )*( Z( je )/Z( jd ) );
+        d = Z( jq )*( d/Z( jd ) );
+      }
+      return false;
+    };
+
+    Index j4 = 4*i0 + pp - 3;
+    Scalar emin = Z( j4+4 );
+    Scalar d = Z( j4 );
+    st.dmin = d;
+
+    for( j4 = 4*i0; j4 <= 4*( n0-3 ); j4 += 4 )
+    {
+      const Index jd = ( 0 == pp ) ? j4-2 : j4-3;
+      const Index jn = ( 0 == pp ) ? j4 : j4-1;
+      const Index je = ( 0 == pp ) ? j4-1 : j4;
+      const Index jq = ( 0 == pp ) ? j4+1 : j4+2;
+      Z( jd ) = d + Z( je );
+      if( Div( jd, jn, je, jq, d ) )
+      {
+        st.dmin = d;
+        emin = {};
+      }
+      st.dmin = Min( st.dmin, d );
+      emin = Min( emin, Z( jn ) );
+    }
+
+    // Unroll last two steps.
+    st.dn2 = d;
+    st.dmin2 = st.dmin;
+    j4 = 4*( n0-2 ) - pp;
+    Index j4p2 = j4 + 2*pp - 1;
+    Z( j4-2 ) = st.dn2 + Z( j4p2 );
+    st.dn1 = st.dn2;
+    if( Div( j4-2, j4, j4p2, j4p2+2, st.dn1 ) )
+    {
+      st.dmin = st.dn1;
+      emin = {};
+    }
+    st.dmin = Min( st.dmin, st.dn1 );
+
+    st.dmin1 = st.dmin;
+    j4 += 4;
+    j4p2 = j4 + 2*pp - 1;
+    Z( j4-2 ) = st.dn1 + Z( j4p2 );
+    st.dn = st.dn1;
+    if( Div( j4-2, j4, j4p2, j4p2+2, st.dn ) )
+    {
+      st.dmin = st.dn;
+      emin = {};
+    }
+    st.dmin = Min( st.dmin, st.dn );
+
+    Z( j4+2 ) = st.dn;
+    Z( 4*n0-pp ) = emin;
+  }
+
+  // Chooses the shift tau of the next step from the last one, as
+  // dlasq4 does.
+  static constexpr void _Shift( const _Z &Z, Index i0, Index n0, Index pp, Index n0in, _State &st ) noexcept
+  {
+    const Scalar cnst1 = Scalar( 0.563 ), cnst2 = Scalar( 1.01 ), cnst3 = Scalar( 1.05 );
+    const Scalar qurtr = Scalar( 0.25 ), third = Scalar( 0.333 ), half = Scalar( 0.5 );
+    const Scalar zero = {}, one = unit< Scalar >, hundrd = Scalar( 100 );
+
+    // A negative dmin forces the shift to take that absolute value;
+    // ttype records the type of shift.
+    if( st.dmin <= zero )
+    {
+      st.tau = -st.dmin;
+      st.ttype = -1;
+      return;
+    }
+
+    const Index nn = 4*n0 + pp;
+    Scalar s = {}, a2 = {}, b1 = {}, b2 = {}, gam = {}, gap1 = {}, gap2 = {};
+
+    // Sums the ratios z(i4)/z(i4-2) from np down, into a2 with the
+    // last term in b2, until they stop mattering; false if one of
+    // them exceeds 1, when s is kept as it is.
+    auto Tail = [&]( Index np ) -> bool
+    {
+      for( Index i4 = np; i4 >= 4*i0 - 1 + pp; i4 -= 4 )
+      {
+        if( IsZero( b2 ) ){ break; }
+        b1 = b2;
+        if( Z( i4 ) > Z( i4-2 ) ){ return false; }
+        b2 *= Z( i4 )/Z( i4-2 );
+        a2 += b2;
+        if( ( hundrd*Max( b2, b1 ) < a2 ) || ( cnst1 < a2 ) ){ break; }
+      }
+      a2 *= cnst3;
+      return true;
+    };
+
+    if( n0in == n0 )
+    {
+      // No eigenvalues deflated.
+      if( ( st.dmin == st.dn ) || ( st.dmin == st.dn1 ) )
+      {
+        b1 = Sqrt( Z( nn-3 ) )*Sqrt( Z( nn-5 ) );
+        b2 = Sqrt( Z( nn-7 ) )*Sqrt( Z( nn-9 ) );
+        a2 = Z( nn-7 ) + Z( nn-5 );
+
+        if( ( st.dmin == st.dn ) && ( st.dmin1 == st.dn1 ) )
+        {
+          // Cases 2 and 3.
+          gap2 = st.dmin2 - a2 - st.dmin2*qurtr;
+          if( ( gap2 > zero ) && ( gap2 > b2 ) )
+          { gap1 = a2 - st.dn - ( b2/gap2 )*b2; }
+          else
+          { gap1 = a2 - st.dn - ( b1+b2 ); }
+
+          if( ( gap1 > zero ) && ( gap1 > b1 ) )
+          {
+            s = Max( st.dn - ( b1/gap1 )*b1, half*st.dmin );
+            st.ttype = -2;
+          }
+          else
+          {
+            s = zero;
+            if( st.dn > b1 ){ s = st.dn - b1; }
+            if( a2 > ( b1+b2 ) ){ s = Min( s, a2 - ( b1+b2 ) ); }
+            s = Max( s, third*st.dmin );
+            st.ttype = -3;
+          }
+        }
+        else
+        {
+          // Case 4.
+          st.ttype = -4;
+          s = qurtr*st.dmin;
+          Index np = 0;
+          if( st.dmin == st.dn )
+          {
+            gam = st.dn;
+            a2 = zero;
+            if( Z( nn-5 ) > Z( nn-7 ) ){ st.tau = s; return; }
+            b2 = Z( nn-5 )/Z( nn-7 );
+            np = nn - 9;
+          }
+          else
+          {
+            np = nn - 2*pp;
+            gam = st.dn1;
+            if( Z( np-4 ) > Z( np-2 ) ){ st.tau = s; return; }
+            a2 = Z( np-4 )/Z( np-2 );
+            if( Z( nn-9 ) > Z( nn-11 ) ){ st.tau = s; return; }
+            b2 = Z( nn-9 )/Z( nn-11 );
+            np = nn - 13;
+          }
+
+          // Approximate contribution to norm squared from i < nn-1.
+          a2 += b2;
+          if( ! Tail( np ) ){ st.tau = s; return; }
+
+          // Rayleigh quotient residual bound.
+          if( a2 < cnst1 ){ s = gam*( one - Sqrt( a2 ) )/( one + a2 ); }
+        }
+      }
+      else if( st.dmin == st.dn2 )
+      {
+        // Case 5.
+        st.ttype = -5;
+        s = qurtr*st.dmin;
+
+        // Compute contribution to norm squared from i > nn-2.
+        const Index np = nn - 2*pp;
+        b1 = Z( np-2 );
+        b2 = Z( np-6 );
+        gam = st.dn2;
+        if( ( Z( np-8 ) > b2 ) || ( Z( np-4 ) > b1 ) ){ st.tau = s; return; }
+        a2 = ( Z( np-8 )/b2 )*( one + Z( np-4 )/b1 );
+
+        // Approximate contribution to norm squared from i < nn-2.
+        if( n0-i0 > 2 )
+        {
+          b2 = Z( nn-13 )/Z( nn-15 );
+          a2 += b2;
+          if( ! Tail( nn-17 ) ){ st.tau = s; return; }
+        }
+
+        if( a2 < cnst1 ){ s = gam*( one - Sqrt( a2 ) )/( one + a2 ); }
+      }
+      else
+      {
+        // Case 6, no information to guide us.
+        if( -6 == st.ttype ){ st.g += third*( one - st.g ); }
+        else if( -18 == st.ttype ){ st.g = qurtr*third; }
+        else { st.g = qurtr; }
+        s = st.g*st.dmin;
+        st.ttype = -6;
+      }
+    }
+    else if( n0in == n0+1 )
+    {
+      // One eigenvalue just deflated. Use dmin1, dn1 for dmin and dn.
+      if( ( st.dmin1 == st.dn1 ) && ( st.dmin2 == st.dn2 ) )
+      {
+        // Cases 7 and 8.
+        st.ttype = -7;
+        s = third*st.dmin1;
+        if( Z( nn-5 ) > Z( nn-7 ) ){ st.tau = s; return; }
+        b1 = Z( nn-5 )/Z( nn-7 );
+        b2 = b1;
+        if( ! IsZero( b2 ) )
+        {
+          for( Index i4 = 4*n0 - 9 + pp; i4 >= 4*i0 - 1 + pp; i4 -= 4 )
+          {
+            a2 = b1;
+            if( Z( i4 ) > Z( i4-2 ) ){ st.tau = s; return; }
+            b1 *= Z( i4 )/Z( i4-2 );
+            b2 += b1;
+            if( hundrd*Max( b1, a2 ) < b2 ){ break; }
+          }
+        }
+        b2 = Sqrt( cnst3*b2 );
+        a2 = st.dmin1/( one + Sqr( b2 ) );
+        gap2 = half*st.dmin2 - a2;
+        if( ( gap2 > zero ) && ( gap2 > b2*a2 ) )
+        { s = Max( s, a2*( one - cnst2*a2*( b2/gap2 )*b2 ) ); }
+        else
+        {
+          s = Max( s, a2*( one - cnst2*b2 ) );
+          st.ttype = -8;
+        }
+      }
+      else
+      {
+        // Case 9.
+        s = qurtr*st.dmin1;
+        if( st.dmin1 == st.dn1 ){ s = half*st.dmin1; }
+        st.ttype = -9;
+      }
+    }
+    else if( n0in == n0+2 )
+    {
+      // Two eigenvalues deflated. Use dmin2, dn2 for dmin and dn.
+      if( ( st.dmin2 == st.dn2 ) && ( 2*Z( nn-5 ) < Z( nn-7 ) ) )
+      {
+        // Cases 10 and 11.
+        st.ttype = -10;
+        s = third*st.dmin2;
+        if( Z( nn-5 ) > Z( nn-7 ) ){ st.tau = s; return; }
+        b1 = Z( nn-5 )/Z( nn-7 );
+        b2 = b1;
+        if( ! IsZero( b2 ) )
+        {
+          for( Index i4 = 4*n0 - 9 + pp; i4 >= 4*i0 - 1 + pp; i4 -= 4 )
+          {
+            if( Z( i4 ) > Z( i4-2 ) ){ st.tau = s; return; }
+            b1 *= Z( i4 )/Z( i4-2 );
+            b2 += b1;
+            if( hundrd*b1 < b2 ){ break; }
+          }
+        }
+        b2 = Sqrt( cnst3*b2 );
+        a2 = st.dmin2/( one + Sqr( b2 ) );
+        gap2 = Z( nn-7 ) + Z( nn-9 ) - Sqrt( Z( nn-11 ) )*Sqrt( Z( nn-9 ) ) - a2;
+        if( ( gap2 > zero ) && ( gap2 > b2*a2 ) )
+        { s = Max( s, a2*( one - cnst2*a2*( b2/gap2 )*b2 ) ); }
+        else
+        { s = Max( s, a2*( one - cnst2*b2 ) ); }
+      }
+      else
+      {
+        s = qurtr*st.dmin2;
+        st.ttype = -11;
+      }
+    }
+    else
+    {
+      // Case 12, more than two eigenvalues deflated. No information.
+      s = zero;
+      st.ttype = -12;
+    }
+
+    st.tau = s;
+  }
+
+  // Deflates what it can from the bottom of i0:n0, then takes one
+  // good dqds step, as dlasq3 does; the eigenvalues found are left in
+  // z(4k-3), with sigma added back.
+  constexpr void _Iterate( const _Z &Z, Index i0, Index &n0, Index &pp, Scalar &qmax, _State &st ) const
+  {
+    const Scalar cbias = Scalar( 1.5 );
+    const Scalar eps = this->_config.zeroTol;
+    const Scalar tol = 100*eps;
+    const Scalar tol2 = Sqr( tol );
+    const Scalar zero = {}, one = unit< Scalar >, half = Scalar( 0.5 );
+
+    const Index n0in = n0;
+
+    // Check for deflation.
+    for( ;; )
+    {
+      if( n0 < i0 ){ return; }
+      const Index nn = 4*n0 + pp;
+
+      bool two = ( n0 == i0+1 );
+      if( ( n0 != i0 ) && ! two )
+      {
+        // Check whether e(n0-1) is negligible, 1 eigenvalue.
+        if( ( Z( nn-5 ) > tol2*( st.sigma + Z( nn-3 ) ) )
+          && ( Z( nn-2*pp-4 ) > tol2*Z( nn-7 ) ) )
+        {
+          // Check whether e(n0-2) is negligible, 2 eigenvalues.
+          if( ( Z( nn-9 ) > tol2*st.sigma )
+            && ( Z( nn-2*pp-8 ) > tol2*Z( nn-11 ) ) )
+          { break; }
+          two = true;
+        }
+      }
+
+      if( ! two )
+      {
+        Z( 4*n0-3 ) = Z( 4*n0+pp-3 ) + st.sigma;
+        --n0;
+        continue;
+      }
+
+      if( Z( nn-3 ) > Z( nn-7 ) ){ Swap( Z( nn-3 ), Z( nn-7 ) ); }
+      const Scalar t = half*( ( Z( nn-7 ) - Z( nn-3 ) ) + Z( nn-5 ) );
+      if( ( Z( nn-5 ) > Z( nn-3 )*tol2 ) && ! IsZero( t ) )
+      {
+        Scalar s = Z( nn-3 )*( Z( nn-5 )/t );
+        if( s <= t )
+        { s = Z( nn-3 )*( Z( nn-5 )/( t*( one + Sqrt( one + s/t ) ) ) ); }
+        else
+        { s = Z( nn-3 )*( Z( nn-5 )/( t + Sqrt( t )*Sqrt( t+s ) ) ); }
+        const Scalar u = Z( nn-7 ) + ( s + Z( nn-5 ) );
+        Z( nn-3 ) *= Z( nn-7 )/u;
+        Z( nn-7 ) = u;
+      }
+      Z( 4*n0-7 ) = Z( nn-7 ) + st.sigma;
+      Z( 4*n0-3 ) = Z( nn-3 ) + st.sigma;
+      n0 -= 2;
+    }
+
+    if( 2 == pp ){ pp = 0; }
+
+    // Reverse the qd-array, if warranted.
+    if( ( st.dmin <= zero ) || ( n0 < n0in ) )
+    {
+      if( cbias*Z( 4*i0+pp-3 ) < Z( 4*n0+pp-3 ) )
+      {
+        _Flip( Z, i0, n0 );
+        if( n0-i0 <= 4 )
+        {
+          Z( 4*n0+pp-1 ) = Z( 4*i0+pp-1 );
+          Z( 4*n0-pp ) = Z( 4*i0-pp );
+        }
+        st.dmin2 = Min( st.dmin2, Z( 4*n0+pp-1 ) );
+        Z( 4*n0+pp-1 ) = Min( Min( Z( 4*n0+pp-1 ), Z( 4*i0+pp-1 ) ), Z( 4*i0+pp+3 ) );
+        Z( 4*n0-pp ) = Min( Min( Z( 4*n0-pp ), Z( 4*i0-pp ) ), Z( 4*i0-pp+4 ) );
+        qmax = Max( Max( qmax, Z( 4*i0+pp-3 ) ), Z( 4*i0+pp+1 ) );
+        st.dmin = -zero;
+      }
+    }
+
+    // Choose a shift, and call dqds until dmin > 0.
+    _Shift( Z, i0, n0, pp, n0in, st );
+
+    bool safe = false;
+    for( ;; )
+    {
+      this->_Dqds( Z, i0, n0, pp, st );
+
+      if( ( st.dmin >= zero ) && ( st.dmin1 >= zero ) )
+      {
+        // Success.
+        break;
+      }
+      else if( ( st.dmin < zero ) && ( st.dmin1 > zero )
+        && ( Z( 4*( n0-1 )-pp ) < tol*( st.sigma + st.dn1 ) )
+        && ( Abs( st.dn ) < tol*st.sigma ) )
+      {
+        // Convergence hidden by negative dn.
+        Z( 4*( n0-1 )-pp+2 ) = zero;
+        st.dmin = zero;
+        break;
+      }
+      else if( st.dmin < zero )
+      {
+        // tau too big. Select new tau and try again.
+        if( st.ttype < -22 )
+        {
+          // Failed twice. Play it safe.
+          st.tau = zero;
+        }
+        else if( st.dmin1 > zero )
+        {
+          // Late failure. Gives excellent shift.
+          st.tau = ( st.tau + st.dmin )*( one - 2*eps );
+          st.ttype -= 11;
+        }
+        else
+        {
+          // Early failure. Divide by 4.
+          st.tau /= 4;
+          st.ttype -= 12;
+        }
+      }
+      else if( IsUndefined( st.dmin ) && ! IsZero( st.tau ) )
+      {
+        st.tau = zero;
+      }
+      else
+      {
+        // NaN with no shift, or possible underflow. Play it safe.
+        safe = true;
+        break;
+      }
+    }
+
+    if( safe )
+    {
+      _Dqd( Z, i0, n0, pp, st );
+      st.tau = zero;
+    }
+
+    // sigma += tau, compensated in desig
+    if( st.tau < st.sigma )
+    {
+      st.desig += st.tau;
+      const Scalar t = st.sigma + st.desig;
+      st.desig -= t - st.sigma;
+      st.sigma = t;
+    }
+    else
+    {
+      const Scalar t = st.sigma + st.tau;
+      st.desig = st.sigma + ( st.desig - ( t - st.tau ) );
+      st.sigma = t;
+    }
+  }
+
+  // The eigenvalues of the positive semidefinite tridiagonal matrix of
+  // the qd array q(0:n-1), e(0:n-2) in z(1), z(3), ... z(2n-1) and
+  // z(2), z(4), ... z(2n-2), as dlasq2 computes them; they are
+  // returned in z(1:n), unsorted.
+  constexpr bool _Solve( Size n_, const _Z &Z ) const
+  {
+    const Index n = (Index)n_;
+    const Scalar cbias = Scalar( 1.5 );
+    const Scalar eps = this->_config.zeroTol;
+    const Scalar safmin = minValue< Scalar >;
+    const Scalar tol = 100*eps;
+    const Scalar tol2 = Sqr( tol );
+    const Scalar zero = {}, half = Scalar( 0.5 );
+
+    Z( 2*n ) = zero;
+    Scalar dsum = {}, esum = {};
+    for( Index k = 1; k <= 2*( n-1 ); k += 2 )
+    {
+      dsum += Z( k );
+      esum += Z( k+1 );
+    }
+    dsum += Z( 2*n-1 );
+
+    // Check for diagonality, and for zero data.
+    if( IsZero( esum ) )
+    {
+      for( Index k = 2; k <= n; ++k ){ Z( k ) = Z( 2*k-1 ); }
+      return true;
+    }
+    if( IsZero( dsum + esum ) )
+    {
+      for( Index k = 1; k <= n; ++k ){ Z( k ) = zero; }
+      return true;
+    }
+
+    // Rearrange data for locality: z = (q1,qq1,e1,ee1,q2,qq2,e2,ee2,...).
+    for( Index k = 2*n; k >= 2; k -= 2 )
+    {
+      Z( 2*k ) = zero;
+      Z( 2*k-1 ) = Z( k );
+      Z( 2*k-2 ) = zero;
+      Z( 2*k-3 ) = Z( k-1 );
+    }
+
+    Index i0 = 1;
+    Index n0 = n;
+
+    // Reverse the qd-array, if warranted.
+    if( cbias*Z( 4*i0-3 ) < Z( 4*n0-3 ) )
+    {
+      const Index ipn4 = 4*( i0+n0 );
+      for( Index i4 = 4*i0; i4 <= 2*( i0+n0-1 ); i4 += 4 )
+      {
+        Swap( Z( i4-3 ), Z( ipn4-i4-3 ) );
+        Swap( Z( i4-1 ), Z( ipn4-i4-5 ) );
+      }
+    }
+
+    // Initial split checking via dqd and Li's test.
+    Index pp = 0;
+    Scalar qmax = {};
+    for( Index k = 0; k < 2; ++k )
+    {
+      Scalar d = Z( 4*n0+pp-3 );
+      for( Index i4 = 4*( n0-1 ) + pp; i4 >= 4*i0 + pp; i4 -= 4 )
+      {
+        if( Z( i4-1 ) <= tol2*d )
+        {
+          Z( i4-1 ) = -zero;
+          d = Z( i4-3 );
+        }
+        else
+        { d = Z( i4-3 )*( d/( d + Z( i4-1 ) ) ); }
+      }
+
+      // dqd maps z to zz plus Li's test.
+      d = Z( 4*i0+pp-3 );
+      for( Index i4 = 4*i0 + pp; i4 <= 4*( n0-1 ) + pp; i4 += 4 )
+      {
+        Z( i4-2*pp-2 ) = d + Z( i4-1 );
+        if( Z( i4-1 ) <= tol2*d )
+        {
+          Z( i4-1 ) = -zero;
+          Z( i4-2*pp-2 ) = d;
+          Z( i4-2*pp ) = zero;
+          d = Z( i4+1 );
+        }
+        else if( ( safmin*Z( i4+1 ) < Z( i4-2*pp-2 ) )
+          && ( safmin*Z( i4-2*pp-2 ) < Z( i4+1 ) ) )
+        {
+          const Scalar temp = Z( i4+1 )/Z( i4-2*pp-2 );
+          Z( i4-2*pp ) = Z( i4-1 )*temp;
+          d *= temp;
+        }
+        else
+        {
+          Z( i4-2*pp ) = Z( i4+1 )*( Z( i4-1 )/Z( i4-2*pp-2 ) );
+          d = Z( i4+1 )*( d/Z( i4-2*pp-2 ) );
+        }
+      }
+      Z( 4*n0-pp-2 ) = d;
+
+      // Now find qmax.
+      qmax = Z( 4*i0-pp-2 );
+      for( Index i4 = 4*i0-pp+2; i4 <= 4*n0-pp-2; i4 += 4 )
+      { qmax = Max( qmax, Z( i4 ) ); }
+
+      pp = 1-pp;
+    }
+
+    _State st{};
+    st.dmin = zero;
+
+    for( Index iwhila = 1; iwhila <= n+1; ++iwhila )
+    {
+      if( n0 < 1 )
+      {
+        // Move q's to the front.
+        for( Index k = 2; k <= n; ++k ){ Z( k ) = Z( 4*k-3 ); }
+        return true;
+      }
+
+      // While array unfinished do: e(n0) holds the value of sigma when
+      // submatrix in i0:n0 splits from the rest of the array, but is
+      // negated.
+      st.desig = zero;
+      st.sigma = ( n0 == n ) ? zero : -Z( 4*n0-1 );
+      if( st.sigma < zero ){ return false; }
+
+      // Find last unreduced submatrix's top index i0, find qmax and
+      // emin. Find Gershgorin-type bound if q's much greater than e's.
+      Scalar emax = zero;
+      Scalar qmin = Z( 4*n0-3 );
+      qmax = qmin;
+      Index i4 = 4*n0;
+      for( ; i4 >= 8; i4 -= 4 )
+      {
+        if( Z( i4-5 ) <= zero ){ break; }
+        if( qmin >= 4*emax )
+        {
+          qmin = Min( qmin, Z( i4-3 ) );
+          emax = Max( emax, Z( i4-5 ) );
+        }
+        qmax = Max( qmax, Z( i4-7 ) + Z( i4-5 ) );
+      }
+      i0 = i4/4;
+      pp = 0;
+
+      if( n0-i0 > 1 )
+      {
+        Scalar dee = Z( 4*i0-3 );
+        Scalar deemin = dee;
+        Index kmin = i0;
+        for( Index j4 = 4*i0+1; j4 <= 4*n0-3; j4 += 4 )
+        {
+          dee = Z( j4 )*( dee/( dee + Z( j4-2 ) ) );
+          if( dee <= deemin )
+          {
+            deemin = dee;
+            kmin = ( j4+3 )/4;
+          }
+        }
+        if( ( ( kmin-i0 )*2 < n0-kmin ) && ( deemin <= half*Z( 4*n0-3 ) ) )
+        {
+          _Flip( Z, i0, n0 );
+          pp = 2;
+        }
+      }
+
+      // Put -(initial shift) into dmin.
+      st.dmin = -Max( zero, qmin - 2*Sqrt( qmin )*Sqrt( emax ) );
+
+      // Now i0:n0 is unreduced. pp = 0 for ping, pp = 1 for pong;
+      // pp = 2 says the array was flipped, so that the tests for
+      // deflation on entry of _Iterate are not to be performed.
+      const Size nbig = this->_config.maxIterationCount*(Size)( n0-i0+1 );
+      bool done = false;
+      for( Size iwhilb = 0; iwhilb < nbig; ++iwhilb )
+      {
+        if( i0 > n0 ){ done = true; break; }
+
+        // While submatrix unfinished take a good dqds step.
+        this->_Iterate( Z, i0, n0, pp, qmax, st );
+        pp = 1-pp;
+
+        // When emin is very small check for splits.
+        if( ( 0 == pp ) && ( n0-i0 >= 3 ) )
+        {
+          if( ( Z( 4*n0 ) <= tol2*qmax ) || ( Z( 4*n0-1 ) <= tol2*st.sigma ) )
+          {
+            Index splt = i0-1;
+            qmax = Z( 4*i0-3 );
+            Scalar emin = Z( 4*i0-1 );
+            Scalar oldemn = Z( 4*i0 );
+            for( Index j4 = 4*i0; j4 <= 4*( n0-3 ); j4 += 4 )
+            {
+              if( ( Z( j4 ) <= tol2*Z( j4-3 ) ) || ( Z( j4-1 ) <= tol2*st.sigma ) )
+              {
+                Z( j4-1 ) = -st.sigma;
+                splt = j4/4;
+                qmax = zero;
+                emin = Z( j4+3 );
+                oldemn = Z( j4+4 );
+              }
+              else
+              {
+                qmax = Max( qmax, Z( j4+1 ) );
+                emin = Min( emin, Z( j4-1 ) );
+                oldemn = Min( oldemn, Z( j4 ) );
+              }
+            }
+            Z( 4*n0-1 ) = emin;
+            Z( 4*n0 ) = oldemn;
+            i0 = splt+1;
+          }
+        }
+      }
+
+      // Maximum number of iterations exceeded.
+      if( ! done && ( i0 <= n0 ) ){ return false; }
+    }
+
+    return false;
+  }
+
+public:
+
+  constexpr const Config &config() const noexcept
+  { return this->_config; }
+  constexpr void SetConfig( const Config &config ) noexcept
+  { this->_config = config; }
+
+  IND_NOTHROW_VITAE( Syt_EigQD );
+
+  /// <summary>
+  /// Computes all eigenvalues of the Symmetric Tridiagonal matrix of
+  /// diagonal d and off-diagonal e, into d in increasing order.
+  /// </summary>
+  ///<returns>
+  /// false if dqds did not converge.
+  /// </returns>
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Arr_work >
+  requires( areTheSame< Scalar,
+    Decay<DerefTypeOf<T_Arr_d>>,
+    Decay<DerefTypeOf<T_Arr_e>>,
+    Decay<DerefTypeOf<T_Arr_work>> > )
+  constexpr bool Solve( Size n, T_Arr_d d, T_Arr_e e, T_Arr_work work ) const
+  {
+    IND_MATH_TRACE_SCOPE( "Syt_EigQD", n, 0, 0, 0, 4.0*n*sizeof( Scalar ) );
+
+    if( 0 == n ){ return true; }
+
+    const Scalar eps = this->_config.zeroTol;
+    const Scalar eps2 = Sqr( eps );
+    const Scalar safmin = minValue<Scalar>;
+    const Scalar safmax = Inv( safmin );
+    const Scalar ssfmin = Sqrt( safmin )/eps2;
+    const Scalar ssfmax = Sqrt( safmax )/3;
+
+    const _Z Z{ &work[0] };
+
+    Index k = 0;
+    while( k < (Index)n )
+    {
+      // Find the end of the unreduced block k:kend
+      Index kend = k;
+      for( ; kend < (Index)(n-1); ++kend )
+      {
+        const Scalar errk = eps*Sqrt( Abs(d[kend]) )*Sqrt( Abs(d[kend+1]) );
+        if( Abs( e[kend] ) <= errk )
+        {
+          e[kend] = {};
+          break;
+        }
+      }
+
+      const Size m = (Size)( kend-k+1 );
+      const Index k0 = k;
+      k = kend+1;
+
+      if( 1 == m ){ continue; }
+      if( 2 == m )
+      {
+        Aux_Eig2( d[k0], e[k0], d[k0+1], d[k0], d[k0+1] );
+        continue;
+      }
+
+      // Scale the block, if it is out of range
+      const auto anorm = Syt_Norm< Lyt >( NormType::Max, m, d+k0, e+k0 );
+      if( IsZero( anorm ) ){ continue; }
+
+      const auto scale = Clamp( anorm, ssfmin, ssfmax );
+      const bool rescl = ( scale != anorm );
+      if( rescl )
+      {
+        Vec_Rescl< Lyt >( anorm, scale, m, d+k0, 1 );
+        Vec_Rescl< Lyt >( anorm, scale, m-1, e+k0, 1 );
+      }
+
+      // The Gershgorin interval [gl,gu] of the block
+      Scalar gl = d[k0], gu = d[k0];
+      for( Index i = 0; i < (Index)m; ++i )
+      {
+        const Scalar r = ( ( i > 0 ) ? Abs( e[k0+i-1] ) : Scalar{} )
+                       + ( ( i+1 < (Index)m ) ? Abs( e[k0+i] ) : Scalar{} );
+        gl = Min( gl, d[k0+i] - r );
+        gu = Max( gu, d[k0+i] + r );
+      }
+
+      // L D (~L) = T - sigma I, with sigma moved down until all of D
+      // is positive: q(i) = D(i), and e(i) = L(i)^2 D(i).
+      const Scalar spdiam = gu - gl;
+      Scalar delta = 2*eps*Max( spdiam, Max( Abs( gl ), Abs( gu ) ) ) + 2*safmin;
+      Scalar sigma = gl - delta;
+      bool factored = false;
+      for( Size tries = 0; ( tries < 64 ) && ! factored; ++tries )
+      {
+        factored = true;
+        Scalar dd = d[k0] - sigma;
+        for( Index i = 0; i < (Index)m; ++i )
+        {
+          if( !( dd > Scalar{} ) ){ factored = false; break; }
+          Z( 2*i+1 ) = dd;
+          if( i+1 < (Index)m )
+          {
+            const Scalar l = e[k0+i]/dd;
+            Z( 2*i+2 ) = l*e[k0+i];
+            dd = d[k0+i+1] - sigma - Z( 2*i+2 );
+          }
+        }
+        if( ! factored )
+        {
+          delta *= 2;
+          sigma = gl - delta;
+        }
+      }
+      if( ! factored ){ return false; }
+
+      if( ! this->_Solve( m, Z ) ){ return false; }
+
+      // Back to T
+      for( Index i = 0; i < (Index)m; ++i )
+      { d[k0+i] = Z( i+1 ) + sigma; }
+
+      if( rescl )
+      { Vec_Rescl< Lyt >( scale, anorm, m, d+k0, 1 ); }
+    }
+
+    std::sort( d, d+n );
+    return true;
+  }
+
+  /// <summary>
+  /// Size of the workspace Solve needs for order n under the
+  /// current configuration.
+  /// </summary>
+  constexpr Size WorkSize( Size n ) const noexcept
+  { return Syt_EigQD_WorkSize( n ); }
+
+  /// <summary>
+  /// Eigenvalues as above, with the workspace taken from arena.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Arr_e >
+  requires( areTheSame< Scalar,
+    Decay<DerefTypeOf<T_Arr_d>>,
+    Decay<DerefTypeOf<T_Arr_e>> > )
+  bool Solve( Size n, T_Arr_d d, T_Arr_e e, Aux_Arena< Scalar > &arena ) const
+  {
+    typename Aux_Arena< Scalar >::Frame frame{ arena };
+    return this->template Solve< Lyt >( n, d, e, arena.Take( this->WorkSize( n ) ) );
+  }
+};
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
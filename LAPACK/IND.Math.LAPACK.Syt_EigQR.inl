@@ -10,6 +10,10 @@ namespace LAPACK {
 /// <remarks>
 /// Based on the LAPACK routine <c>dsterf</c>, and corrected
 /// to use the logic in <c>dsteqr</c> (more accurate).
+///
+/// For a sequence of slowly changing matrices, Solve can take the
+/// spectrum of the previous one as the first shift of each eigenvalue;
+/// see also <see cref="Syt_EigQD"/>.
 /// </remarks>
 template< typename T_Scalar, typename DefaultLyt = Flat >
 requires( ! isComplex< T_Scalar > )
@@ -29,22 +33,16 @@ private:
 
   Config _config;
 
-public:
-
-  constexpr const Config &config() const noexcept
-  { return this->_config; }
-  constexpr void SetConfig( const Config &config ) noexcept
-  { this->_config = config; }
-
-  IND_NOTHROW_VITAE( Syt_EigQR );
-
-  template< typename Lyt = DefaultLyt,
+  // The solver; with warm, w0 holds a spectrum in increasing order,
+  // whose nearest value replaces the first shift of each eigenvalue
+  // if it lies within the coupling of the 2 by 2 block the shift is
+  // taken from.
+  template< typename Lyt,
+    bool warm,
     typename T_Arr_d,
-    typename T_Arr_e >
-  requires( areTheSame< Scalar,
-    Decay<DerefTypeOf<T_Arr_d>>,
-    Decay<DerefTypeOf<T_Arr_e>> > )
-  constexpr bool Solve( Size n, T_Arr_d d, T_Arr_e e ) const
+    typename T_Arr_e,
+    typename T_Arr_w >
+  constexpr bool _Solve( Size n, T_Arr_d d, T_Arr_e e, T_Arr_w w0 ) const
   {
     if( 0 == n ){ return true; }
 
@@ -108,10 +106,33 @@ public:
       if( IsZero( anorm ) )
       { continue; }
 
+      // Most blocks are already within range, and need no scaling
       const auto scale = Clamp( anorm, ssfmin, ssfmax );
+      const bool rescl = ( scale != anorm );
+
+      if( rescl )
+      {
+        Vec_Rescl< Lyt >( anorm, scale, kend-k+1, d+k, 1 );
+        Vec_Rescl< Lyt >( anorm, scale, kend-k, e+k, 1 );
+      }
 
-      Vec_Rescl< Lyt >( anorm, scale, kend-k+1, d+k, 1 );
-      Vec_Rescl< Lyt >( anorm, scale, kend-k, e+k, 1 );
+      // The value of w0 nearest sigma, if within tol of it, else sigma
+      auto WarmShift = [&]( const Scalar &sigma, const Scalar &tol ) -> Scalar
+      {
+        const Scalar u = rescl ? sigma*( anorm/scale ) : sigma;
+        Index lo = 0, hi = (Index)n;
+        while( lo < hi )
+        {
+          const Index mid = ( lo+hi )/2;
+          if( w0[mid] < u ){ lo = mid+1; } else { hi = mid; }
+        }
+        Scalar w = ( lo < (Index)n ) ? w0[lo] : w0[n-1];
+        if( ( lo > 0 ) && ( Abs( w0[lo-1] - u ) < Abs( w - u ) ) ){ w = w0[lo-1]; }
+
+        const Scalar ws = rescl ? w*( scale/anorm ) : w;
+        return ( Abs( ws - sigma ) <= tol ) ? ws : sigma;
+      };
+      bool fresh = true;
 
       // Choose between QL and QR iteration
 
@@ -150,6 +171,7 @@ public:
           {
             // Eigenvalue found.
             ++k;
+            fresh = true;
             continue;
           }
 
@@ -161,6 +183,7 @@ public:
             Aux_Eig2( d[k], e[k], d[k+1], d[k], d[k+1] );
             e[k] = {};
             k += 2;
+            fresh = true;
             continue;
           }
 
@@ -175,6 +198,12 @@ public:
           Scalar f = ( d[k+1] - d[k] )/( 2*e[k] );
           Scalar r = Hypot( f, one );
           Scalar g = d[k0] - d[k] + ( e[k]/( f + CopySign(r,f) ) );
+          if constexpr( warm )
+          {
+            if( fresh )
+            { g = d[k0] - WarmShift( d[k] - ( e[k]/( f + CopySign(r,f) ) ), Abs( e[k+1] ) ); }
+          }
+          fresh = false;
           Scalar c = one;
           Scalar s = one;
           Scalar p = {};
@@ -225,6 +254,7 @@ public:
           {
             // Eigenvalue found.
             --k;
+            fresh = true;
             continue;
           }
 
@@ -236,6 +266,7 @@ public:
             Aux_Eig2( d[k-1], e[k-1], d[k], d[k-1], d[k] );
             e[k-1] = {};
             k -= 2;
+            fresh = true;
             continue;
           }
 
@@ -251,6 +282,12 @@ public:
           Scalar f = ( d[k-1] - d[k] )/( 2*e[k-1] );
           Scalar r = Hypot( f, one );
           Scalar g = d[k0] - d[k] + ( e[k-1]/( f + CopySign(r,f) ) );
+          if constexpr( warm )
+          {
+            if( fresh )
+            { g = d[k0] - WarmShift( d[k] - ( e[k-1]/( f + CopySign(r,f) ) ), Abs( e[k-2] ) ); }
+          }
+          fresh = false;
           Scalar c = one;
           Scalar s = one;
           Scalar p = {};
@@ -276,13 +313,58 @@ public:
       }
       // End of QL block
 
-      Vec_Rescl< Lyt >( scale, anorm, (kend_prev+1)-(k1_prev+1)+1, d+k1_prev, 1 );
+      if( rescl )
+      { Vec_Rescl< Lyt >( scale, anorm, (kend_prev+1)-(k1_prev+1)+1, d+k1_prev, 1 ); }
     }
     // while( count < maxCount )
 
     // Converged.
     return true;
   }
+
+public:
+
+  constexpr const Config &config() const noexcept
+  { return this->_config; }
+  constexpr void SetConfig( const Config &config ) noexcept
+  { this->_config = config; }
+
+  IND_NOTHROW_VITAE( Syt_EigQR );
+
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Arr_e >
+  requires( areTheSame< Scalar,
+    Decay<DerefTypeOf<T_Arr_d>>,
+    Decay<DerefTypeOf<T_Arr_e>> > )
+  constexpr bool Solve( Size n, T_Arr_d d, T_Arr_e e ) const
+  {
+    IND_MATH_TRACE_SCOPE( "Syt_EigQR", n, 0, 0, 0, 4.0*n*sizeof( Scalar ) );
+
+    return this->template _Solve< Lyt, false >( n, d, e, (const Scalar *)nullptr );
+  }
+
+  /// <summary>
+  /// Eigenvalues as above, warm-started from w0, the n eigenvalues in
+  /// increasing order of a nearby matrix, such as the previous one of
+  /// a slowly changing sequence: the value of w0 nearest to the first
+  /// shift of each eigenvalue is taken instead of it, when close
+  /// enough, so that most converge in one iteration less.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Arr_w >
+  requires( areTheSame< Scalar,
+    Decay<DerefTypeOf<T_Arr_d>>,
+    Decay<DerefTypeOf<T_Arr_e>>,
+    Decay<DerefTypeOf<T_Arr_w>> > )
+  constexpr bool Solve( Size n, T_Arr_d d, T_Arr_e e, T_Arr_w w0 ) const
+  {
+    IND_MATH_TRACE_SCOPE( "Syt_EigQR", n, 0, 0, 0, 5.0*n*sizeof( Scalar ) );
+
+    return this->template _Solve< Lyt, true >( n, d, e, w0 );
+  }
 };
 
 }// namespace LAPACK
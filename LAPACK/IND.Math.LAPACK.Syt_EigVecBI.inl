@@ -0,0 +1,561 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Syt_EigVecBI"/>.
+/// </summary>
+inline constexpr Size Syt_EigVecBI_WorkSize( Size n ) noexcept
+{ return 6*n; }
+
+/// <summary>
+/// Eigensystem solver for a subset of the eigenpairs of a Symmetric
+/// Tridiagonal matrix, by bisection and inverse iteration.
+///
+/// The eigenvalues are selected by index, il..iu counted from zero in
+/// increasing order, or by the interval [vl,vu). They are returned in
+/// increasing order in w, with their eigenvectors in the columns of
+/// the n by (iu-il+1) matrix Z; d and e are not modified.
+///
+/// The eigenvectors are those of the tridiagonal matrix; the ones of
+/// the matrix it was reduced from are Q*Z.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routines <c>dstebz</c> and <c>dstein</c>.
+///
+/// Each eigenvalue takes O(n) Sturm counts and each eigenvector O(n)
+/// work per iteration, so k eigenpairs cost O(nk) time and memory,
+/// plus the reorthogonalization within clusters of close eigenvalues.
+/// </remarks>
+template< typename T_Scalar, typename DefaultLyt = ColMajor >
+requires( ! isComplex< T_Scalar > )
+class Syt_EigVecBI
+{
+public:
+
+  using Scalar = T_Scalar;
+
+  struct Config
+  {
+    // Inverse iterations allowed per eigenvector.
+    Size maxIterationCount = 5;
+    Scalar zeroTol = std::numeric_limits< T_Scalar >::epsilon();
+  };
+
+private:
+
+  Config _config;
+
+  // True if e(i) is negligible, splitting T between rows i and i+1.
+  template< typename T_Arr_d,
+    typename T_Arr_e >
+  constexpr bool _Splits( T_Arr_d d, T_Arr_e e, Index i ) const
+  {
+    const Scalar eps = this->_config.zeroTol;
+    return Sqr( e[i] ) <= Sqr( eps )*Abs( d[i]*d[i+1] ) + minValue< Scalar >;
+  }
+
+  // Sturm count: the number of eigenvalues less than x, with the
+  // negligible elements of e taken as zero.
+  template< typename T_Arr_d,
+    typename T_Arr_e >
+  constexpr Size _Count( Size n, T_Arr_d d, T_Arr_e e,
+    const Scalar &pivmin, const Scalar &x ) const
+  {
+    Size count = 0;
+    Scalar q = d[0] - x;
+    if( Abs( q ) <= pivmin ){ q = -pivmin; }
+    if( q < 0 ){ ++count; }
+
+    for( Index i = 1; i < (Index)n; ++i )
+    {
+      q = ( this->_Splits( d, e, i-1 ) ) ? d[i] - x
+        : ( d[i] - x ) - Sqr( e[i-1] )/q;
+      if( Abs( q ) <= pivmin ){ q = -pivmin; }
+      if( q < 0 ){ ++count; }
+    }
+
+    return count;
+  }
+
+  // Gershgorin interval, widened to cover rounding in the Sturm
+  // counts, and the pivot threshold they use.
+  template< typename T_Arr_d,
+    typename T_Arr_e >
+  constexpr void _Bounds( Size n, T_Arr_d d, T_Arr_e e,
+    Scalar &gl, Scalar &gu, Scalar &pivmin ) const
+  {
+    const Scalar eps = this->_config.zeroTol;
+    const Scalar one = unit< Scalar >;
+
+    Scalar emax2 = {};
+    gl = d[0];
+    gu = d[0];
+    for( Index i = 0; i < (Index)n; ++i )
+    {
+      const Scalar r = ( ( i > 0 ) ? Abs( e[i-1] ) : Scalar{} )
+                     + ( ( i+1 < (Index)n ) ? Abs( e[i] ) : Scalar{} );
+      gl = Min( gl, d[i] - r );
+      gu = Max( gu, d[i] + r );
+      if( i+1 < (Index)n )
+      { emax2 = Max( emax2, Sqr( e[i] ) ); }
+    }
+
+    pivmin = minValue< Scalar >*Max( one, emax2 );
+
+    const Scalar tnorm = Max( Abs( gl ), Abs( gu ) );
+    const Scalar fudge = Scalar{21}/10;
+    gl -= fudge*( tnorm*eps*n + 2*pivmin );
+    gu += fudge*( tnorm*eps*n + 2*pivmin );
+  }
+
+  // Eigenvalue j, counted from zero in increasing order, by bisection.
+  template< typename T_Arr_d,
+    typename T_Arr_e >
+  constexpr Scalar _Bisect( Size n, T_Arr_d d, T_Arr_e e,
+    Scalar lo, Scalar hi, const Scalar &pivmin, Size j ) const
+  {
+    const Scalar eps = this->_config.zeroTol;
+
+    // Invariant: count(lo) <= j < count(hi)
+    for( ;; )
+    {
+      const Scalar mid = ( lo + hi )/2;
+      if( ( hi - lo ) <= 2*eps*Max( Abs( lo ), Abs( hi ) ) + pivmin
+       || ( mid <= lo ) || ( mid >= hi ) )
+      { return mid; }
+
+      if( this->_Count( n, d, e, pivmin, mid ) > j ){ hi = mid; }else
+      { lo = mid; }
+    }
+  }
+
+  // Eigenvectors of the eigenvalues w(0:k-1), in increasing order,
+  // into the columns of Z.
+  template< typename Lyt,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Arr_w,
+    typename T_Blk_Z,
+    typename T_Arr_work >
+  constexpr bool _Vectors( Size n, T_Arr_d d, T_Arr_e e,
+    Size k, T_Arr_w w, T_Blk_Z Z_, Stride Z_ld, T_Arr_work work ) const
+  {
+    auto Z = [&]( auto i, auto j ) -> auto &
+    { return Lyt::MatRef( Z_, i, j, Z_ld ); };
+    auto Z_Col = [&]( auto i, auto j ) -> auto
+    { return Lyt::ColPtr( Z_, i, j, Z_ld ); };
+
+    const auto Z_cs = Lyt::ColStride( Z_, Z_ld );
+    const Scalar eps = this->_config.zeroTol;
+    const Scalar one = unit< Scalar >;
+    const Scalar zero = {};
+
+    // LU factors of T - lambda*I with partial pivoting: U has the
+    // diagonals a, b, c; L the multipliers l; swp(i) = 1 if rows i
+    // and i+1 were interchanged.
+    const auto a   = work;
+    const auto b   = a + n;
+    const auto c   = b + n;
+    const auto l   = c + n;
+    const auto swp = l + n;
+    const auto x   = swp + n;
+
+    if( 1 == n )
+    {
+      Z(0,0) = one;
+      return true;
+    }
+
+    // One norm of T, for the cluster and perturbation tolerances.
+    Scalar onenrm = Abs( d[0] ) + Abs( e[0] );
+    onenrm = Max( onenrm, Abs( d[n-1] ) + Abs( e[n-2] ) );
+    for( Index i = 1; i < (Index)(n-1); ++i )
+    { onenrm = Max( onenrm, Abs( d[i] ) + Abs( e[i-1] ) + Abs( e[i] ) ); }
+
+    const Scalar ortol = onenrm/1000;
+    const Scalar dtpcrt = Sqrt( Inv( Scalar{10}*n ) );
+
+    // Starting vectors (dlarnv's role), reproducible from run to run.
+    std::uint32_t seed = 0x2545F491u;
+    auto Rand = [&]() -> Scalar
+    {
+      seed ^= seed << 13;
+      seed ^= seed >> 17;
+      seed ^= seed << 5;
+      return (Scalar)(std::int32_t)seed/(Scalar)2147483648.0;
+    };
+
+    bool converged = true;
+    Index j1 = 0;
+    Scalar xjm = {};
+
+    for( Index j = 0; j < (Index)k; ++j )
+    {
+      Scalar xj = w[j];
+
+      // Separate close eigenvalues, and start a new cluster when far
+      // enough from the last one.
+      if( j > 0 )
+      {
+        const Scalar pertol = 10*Abs( eps*xj );
+        if( xj - xjm < pertol ){ xj = xjm + pertol; }
+        if( xj - xjm > ortol ){ j1 = j; }
+      }
+      xjm = xj;
+
+      // Factor T - xj*I. Rows are interchanged as in dgttrf, on the
+      // magnitudes alone: dlagtf's scaled test can keep a pivot of the
+      // size of e and so leave U with two small pivots instead of one.
+      for( Index i = 0; i < (Index)n; ++i )
+      {
+        a[i] = d[i] - xj;
+        if( i+1 < (Index)n ){ b[i] = e[i]; l[i] = e[i]; }
+        c[i] = zero;
+      }
+      for( Index i = 0; i+1 < (Index)n; ++i )
+      {
+        if( Abs( a[i] ) >= Abs( l[i] ) )
+        {
+          swp[i] = zero;
+          if( ! IsZero( l[i] ) )
+          {
+            l[i] /= a[i];
+            a[i+1] -= l[i]*b[i];
+          }
+        }
+        else
+        {
+          swp[i] = one;
+          const Scalar mult = a[i]/l[i];
+          const Scalar temp = a[i+1];
+          a[i] = l[i];
+          a[i+1] = b[i] - mult*temp;
+          if( i+2 < (Index)n )
+          {
+            c[i] = b[i+1];
+            b[i+1] = -mult*c[i];
+          }
+          b[i] = temp;
+          l[i] = mult;
+        }
+      }
+
+      // Tolerance for perturbing small pivots of U (dlagts, job -1).
+      Scalar tol = {};
+      for( Index i = 0; i < (Index)n; ++i )
+      {
+        tol = Max( tol, Abs( a[i] ) );
+        if( i+1 < (Index)n ){ tol = Max( tol, Abs( b[i] ) ); }
+        if( i+2 < (Index)n ){ tol = Max( tol, Abs( c[i] ) ); }
+      }
+      tol *= eps;
+      if( IsZero( tol ) ){ tol = eps; }
+
+      for( Index i = 0; i < (Index)n; ++i )
+      { x[i] = Rand(); }
+
+      // Inverse iteration; stop two iterations after the growth of
+      // x first shows convergence.
+      Size check = 0;
+      Size count = 0;
+      for( ; count < this->_config.maxIterationCount; ++count )
+      {
+        // Scale to avoid overflow in the solve.
+        Scalar asum = {};
+        for( Index i = 0; i < (Index)n; ++i )
+        { asum += Abs( x[i] ); }
+        const Scalar scl = n*onenrm*Max( eps, Abs( a[n-1] ) )/asum;
+        for( Index i = 0; i < (Index)n; ++i )
+        { x[i] *= scl; }
+
+        // x := Inv( T - xj*I )*x
+        for( Index i = 0; i+1 < (Index)n; ++i )
+        {
+          if( IsZero( swp[i] ) )
+          { x[i+1] -= l[i]*x[i]; }
+          else
+          {
+            const Scalar temp = x[i];
+            x[i] = x[i+1];
+            x[i+1] = temp - l[i]*x[i];
+          }
+        }
+        for( Index i = (Index)n-1; i >= 0; --i )
+        {
+          Scalar temp = x[i];
+          if( i+1 < (Index)n ){ temp -= b[i]*x[i+1]; }
+          if( i+2 < (Index)n ){ temp -= c[i]*x[i+2]; }
+          Scalar ak = a[i];
+          if( Abs( ak ) < tol ){ ak = CopySign( tol, ak ); }
+          x[i] = temp/ak;
+        }
+
+        // Reorthogonalize against the cluster
+        for( Index jr = j1; jr < j; ++jr )
+        {
+          Scalar ztr = {};
+          for( Index i = 0; i < (Index)n; ++i )
+          { ztr += x[i]*Z(i,jr); }
+          for( Index i = 0; i < (Index)n; ++i )
+          { x[i] -= ztr*Z(i,jr); }
+        }
+
+        Scalar xmax = {};
+        for( Index i = 0; i < (Index)n; ++i )
+        { xmax = Max( xmax, Abs( x[i] ) ); }
+
+        // Continue if the growth of x is not yet sufficient.
+        if( xmax < dtpcrt ){ continue; }
+        if( ++check >= 3 ){ break; }
+      }
+      if( check < 3 )
+      { converged = false; }
+
+      // Normalize and store
+      const Scalar nrm = Inv( Vec_Norm2( n, x, 1 ) );
+      const auto Z_col = Z_Col( 0, j );
+      for( Index i = 0; i < (Index)n; ++i )
+      { Lyt::VecRef( Z_col, i, Z_cs ) = nrm*x[i]; }
+    }
+
+    return converged;
+  }
+
+public:
+
+  constexpr const Config &config() const noexcept
+  { return this->_config; }
+  constexpr void SetConfig( const Config &config ) noexcept
+  { this->_config = config; }
+
+  IND_NOTHROW_VITAE( Syt_EigVecBI );
+
+  /// <summary>
+  /// Number of eigenvalues in [vl,vu).
+  /// </summary>
+  template< typename T_Arr_d,
+    typename T_Arr_e >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Arr_d> >,
+    Decay< DerefTypeOf<T_Arr_e> > >)
+  constexpr Size Count( Size n, T_Arr_d d, T_Arr_e e, const Scalar &vl, const Scalar &vu ) const
+  {
+    if( 0 == n || !( vl < vu ) ){ return 0; }
+
+    Scalar gl = {}, gu = {}, pivmin = {};
+    this->_Bounds( n, d, e, gl, gu, pivmin );
+
+    return this->_Count( n, d, e, pivmin, vu ) - this->_Count( n, d, e, pivmin, vl );
+  }
+
+  /// <summary>
+  /// Eigenpairs il..iu, counted from zero in increasing order.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Arr_w,
+    typename T_Blk_Z,
+    typename T_Arr_work >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Arr_d> >,
+    Decay< DerefTypeOf<T_Arr_e> >,
+    Decay< DerefTypeOf<T_Arr_w> >,
+    Decay< DerefTypeOf<T_Blk_Z> >,
+    Decay< DerefTypeOf<T_Arr_work>> >)
+  constexpr bool Solve( Size n, T_Arr_d d, T_Arr_e e,
+    Index il, Index iu,
+    T_Arr_w w, T_Blk_Z Z_, Stride Z_ld, T_Arr_work work ) const
+  {
+    if( ( il < 0 ) || ( il > (Index)n ) )
+    { throw BadArgument{ "Syt_EigVecBI::Solve", 4 }; }
+    if( ( iu < il-1 ) || ( iu >= (Index)n ) )
+    { throw BadArgument{ "Syt_EigVecBI::Solve", 5 }; }
+
+    const Size k = (Size)(iu - il + 1);
+    if( 0 == k ){ return true; }
+
+    Scalar gl = {}, gu = {}, pivmin = {};
+    this->_Bounds( n, d, e, gl, gu, pivmin );
+
+    auto Z_Blk = [&]( auto i, auto j ) -> auto
+    { return Lyt::BlkPtr( Z_, i, j, Z_ld ); };
+
+    const Scalar eps = this->_config.zeroTol;
+
+    // The end points, widened by the bisection tolerance; the window
+    // [xl,xu) holds eigenvalues il..iu and possibly ties beyond them.
+    const Scalar wl = this->_Bisect( n, d, e, gl, gu, pivmin, (Size)il );
+    const Scalar wu = this->_Bisect( n, d, e, wl, gu, pivmin, (Size)iu );
+    const Scalar tl = 2*( 2*eps*Abs( wl ) + pivmin );
+    const Scalar tu = 2*( 2*eps*Abs( wu ) + pivmin );
+    const Scalar xl = wl - tl;
+    const Scalar xu = wu + tu;
+
+    const Size cl = this->_Count( n, d, e, pivmin, xl );
+    const Size cu = this->_Count( n, d, e, pivmin, xu );
+    Size dropL = ( cl < (Size)il ) ? (Size)il - cl : 0;
+    Size dropU = ( cu > (Size)(iu+1) ) ? cu - (Size)(iu+1) : 0;
+
+    // Solve each unreduced block on its own, so that eigenvectors of
+    // different blocks are exactly orthogonal. Ties with the end
+    // points are dropped from the first blocks that have them.
+    Size pos = 0;
+    Index s = 0;
+    while( s < (Index)n )
+    {
+      Index t = s;
+      while( ( t < (Index)(n-1) ) && ! this->_Splits( d, e, t ) )
+      { ++t; }
+
+      const Size nb = (Size)(t - s) + 1;
+      const auto d_b = d + s;
+      const auto e_b = e + s;
+
+      Size lb = this->_Count( nb, d_b, e_b, pivmin, xl );
+      Size ub = this->_Count( nb, d_b, e_b, pivmin, xu );
+      if( dropL > 0 )
+      {
+        const Size c = Min( dropL, Min( this->_Count( nb, d_b, e_b, pivmin, wl + tl ), ub ) - lb );
+        lb += c;
+        dropL -= c;
+      }
+      if( dropU > 0 )
+      {
+        const Size c = Min( dropU, ub - Max( this->_Count( nb, d_b, e_b, pivmin, wu - tu ), lb ) );
+        ub -= c;
+        dropU -= c;
+      }
+
+      const Size kb = ub - lb;
+      if( kb > 0 )
+      {
+        if( pos + kb > k )
+        { return false; }
+
+        Scalar lo = xl;
+        for( Size r = 0; r < kb; ++r )
+        {
+          const Scalar wr = this->_Bisect( nb, d_b, e_b, lo, xu, pivmin, lb + r );
+          w[pos + r] = wr;
+          lo = Max( xl, wr - 2*pivmin - 2*eps*Abs( wr ) );
+        }
+
+        // Z is zero outside the rows of the block.
+        if( s > 0 )
+        { Mat_Fill< Lyt >( Half::Both, (Size)s, kb, Scalar{}, Scalar{}, Z_Blk( 0, (Index)pos ), Z_ld ); }
+        if( t+1 < (Index)n )
+        { Mat_Fill< Lyt >( Half::Both, n-(Size)(t+1), kb, Scalar{}, Scalar{}, Z_Blk( t+1, (Index)pos ), Z_ld ); }
+
+        if( ! this->template _Vectors< Lyt >( nb, d_b, e_b, kb, w + pos,
+          Z_Blk( s, (Index)pos ), Z_ld, work ) )
+        { return false; }
+
+        pos += kb;
+      }
+
+      s = t+1;
+    }
+
+    if( pos != k )
+    { return false; }
+
+    _n_Impl::_Syt_EigSort< Lyt >( n, k, w, Z_, Z_ld );
+    return true;
+  }
+
+  /// <summary>
+  /// Eigenpairs with eigenvalues in [vl,vu); m returns their number,
+  /// which <see cref="Count"/> gives in advance for sizing w and Z.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Arr_w,
+    typename T_Blk_Z,
+    typename T_Arr_work >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Arr_d> >,
+    Decay< DerefTypeOf<T_Arr_e> >,
+    Decay< DerefTypeOf<T_Arr_w> >,
+    Decay< DerefTypeOf<T_Blk_Z> >,
+    Decay< DerefTypeOf<T_Arr_work>> >)
+  constexpr bool Solve( Size n, T_Arr_d d, T_Arr_e e,
+    const Scalar &vl, const Scalar &vu, Size &m,
+    T_Arr_w w, T_Blk_Z Z_, Stride Z_ld, T_Arr_work work ) const
+  {
+    m = 0;
+    if( 0 == n || !( vl < vu ) ){ return true; }
+
+    Scalar gl = {}, gu = {}, pivmin = {};
+    this->_Bounds( n, d, e, gl, gu, pivmin );
+
+    const Index il = (Index)this->_Count( n, d, e, pivmin, vl );
+    const Index iu = (Index)this->_Count( n, d, e, pivmin, vu ) - 1;
+    m = (Size)(iu - il + 1);
+
+    return this->template Solve< Lyt >( n, d, e, il, iu, w, Z_, Z_ld, work );
+  }
+
+  /// <summary>
+  /// Size of the workspace Solve needs for order n under the
+  /// current configuration.
+  /// </summary>
+  constexpr Size WorkSize( Size n ) const noexcept
+  { return Syt_EigVecBI_WorkSize( n ); }
+
+  /// <summary>
+  /// Eigenpairs il..iu as above, with the workspace taken from arena.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Arr_w,
+    typename T_Blk_Z >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Arr_d> >,
+    Decay< DerefTypeOf<T_Arr_e> >,
+    Decay< DerefTypeOf<T_Arr_w> >,
+    Decay< DerefTypeOf<T_Blk_Z> > >)
+  bool Solve( Size n, T_Arr_d d, T_Arr_e e,
+    Index il, Index iu,
+    T_Arr_w w, T_Blk_Z Z_, Stride Z_ld, Aux_Arena< Scalar > &arena ) const
+  {
+    typename Aux_Arena< Scalar >::Frame frame{ arena };
+    return this->template Solve< Lyt >( n, d, e, il, iu, w, Z_, Z_ld, arena.Take( this->WorkSize( n ) ) );
+  }
+
+  /// <summary>
+  /// Eigenpairs with eigenvalues in [vl,vu) as above, with the
+  /// workspace taken from arena.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Arr_w,
+    typename T_Blk_Z >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Arr_d> >,
+    Decay< DerefTypeOf<T_Arr_e> >,
+    Decay< DerefTypeOf<T_Arr_w> >,
+    Decay< DerefTypeOf<T_Blk_Z> > >)
+  bool Solve( Size n, T_Arr_d d, T_Arr_e e,
+    const Scalar &vl, const Scalar &vu, Size &m,
+    T_Arr_w w, T_Blk_Z Z_, Stride Z_ld, Aux_Arena< Scalar > &arena ) const
+  {
+    typename Aux_Arena< Scalar >::Frame frame{ arena };
+    return this->template Solve< Lyt >( n, d, e, vl, vu, m, w, Z_, Z_ld, arena.Take( this->WorkSize( n ) ) );
+  }
+};
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
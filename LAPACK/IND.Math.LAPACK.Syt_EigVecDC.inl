@@ -0,0 +1,916 @@
+#ifdef __IND_MATH_LAPACK_H_CONTENTS__
+
+namespace IND {
+namespace Math {
+namespace LAPACK {
+
+namespace _n_Impl {
+
+  // Sorts d into increasing order, carrying the columns of the m by n
+  // matrix Z along. At most n-1 columns are swapped.
+  template< typename Lyt,
+    typename T_Arr_d,
+    typename T_Blk_Z >
+  constexpr void _Syt_EigSort( Size m, Size n, T_Arr_d d, T_Blk_Z Z_, Stride Z_ld )
+  {
+    auto Z_Col = [&]( auto i, auto j ) -> auto
+    { return Lyt::ColPtr( Z_, i, j, Z_ld ); };
+
+    const auto Z_cs = Lyt::ColStride( Z_, Z_ld );
+
+    for( Index i = 0; i+1 < (Index)n; ++i )
+    {
+      Index k = i;
+      auto p = d[i];
+      for( Index j = i+1; j < (Index)n; ++j )
+      {
+        if( d[j] < p )
+        { k = j; p = d[j]; }
+      }
+
+      if( k != i )
+      {
+        d[k] = d[i];
+        d[i] = p;
+        Vec_Swap< Lyt >( m, Z_Col(0,i), Z_cs, Z_Col(0,k), Z_cs );
+      }
+    }
+  }
+
+}// namespace _n_Impl
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Syt_EigVecDC"/>.
+/// </summary>
+inline constexpr Size Syt_EigVecDC_WorkSize( Size n ) noexcept
+{ return 3*n*n + 9*n; }
+
+/// <summary>
+/// Calculates the size of the workspace required for
+/// <see cref="Syt_EigVecDC::Update"/>.
+/// </summary>
+inline constexpr Size Syt_EigVecDC_UpdWorkSize( Size n ) noexcept
+{ return 2*n*n + 7*n; }
+
+/// <summary>
+/// Eigensystem solver for Symmetric Tridiagonal matrices,
+/// using Cuppen's divide and conquer method.
+///
+/// On input Z holds an orthogonal matrix, usually the one formed by
+/// <see cref="Ort_From_Syt"/>; on output it is multiplied by the
+/// eigenvectors of the tridiagonal matrix, and d holds the eigenvalues
+/// in increasing order.
+/// </summary>
+/// <remarks>
+/// Based on the LAPACK routines <c>dstedc</c>, <c>dlaed0</c>-<c>dlaed4</c>.
+///
+/// Subproblems of at most Config::leafSize rows are solved by
+/// <see cref="Syt_EigVecQR"/>. Each merge solves the secular equation
+/// for the eigenvalues of a rank one update, recomputes the update
+/// vector from them (Gu and Eisenstat) so the new eigenvectors are
+/// orthogonal to working precision, and forms them with two
+/// <see cref="Mat_MatMul"/> calls, one per half of the rows.
+///
+/// The index arrays of a merge are kept in the Scalar workspace,
+/// holding exact integer values.
+/// </remarks>
+template< typename T_Scalar, typename DefaultLyt = ColMajor >
+requires( ! isComplex< T_Scalar > )
+class Syt_EigVecDC
+{
+public:
+
+  using Scalar = T_Scalar;
+
+  struct Config
+  {
+    Size maxIterationCount = 64;
+    Scalar zeroTol = std::numeric_limits< T_Scalar >::epsilon();
+
+    // Order at and below which subproblems are solved by Syt_EigVecQR.
+    Size leafSize = 25;
+
+    // The defaults, with leafSize overridden by the key
+    // Syt_EigVecDC.leafSize of Aux_Tuned().
+    static Config Tuned()
+    {
+      Config config{};
+      config.leafSize = Aux_Tuned().Get< Scalar >( "Syt_EigVecDC.leafSize", config.leafSize );
+      return config;
+    }
+  };
+
+private:
+
+  Config _config;
+
+  // Finds root i of the secular equation
+  //
+  //   1/rho + sum_j z(j)^2/( dl(j) - lambda ) = 0
+  //
+  // of diag(dl) + rho*z*~z, with dl strictly increasing and rho > 0.
+  // The root is returned as lambda = dl(org) + tau, where dl(org) is
+  // the nearer pole, so that every dl(j) - lambda can be formed as
+  // ( dl(j) - dl(org) ) - tau without cancellation.
+  template< typename T_Arr >
+  constexpr bool _Secular( Size K, Index i,
+    T_Arr dl, T_Arr z, const Scalar &rho,
+    Index &org, Scalar &tau ) const
+  {
+    const Scalar eps = this->_config.zeroTol;
+    const Scalar rhoinv = Inv( rho );
+    const bool last = ( (Index)(K-1) == i );
+
+    // f, the derivatives of the terms with poles left (df_L) and
+    // right (df_R) of the root, and a bound on the rounding in f.
+    Scalar f = {}, df_L = {}, df_R = {}, err = {};
+    auto Eval = [&]( const Scalar &t )
+    {
+      f = rhoinv; df_L = {}; df_R = {}; err = rhoinv;
+      for( Index j = 0; j < (Index)K; ++j )
+      {
+        const Scalar del = ( dl[j] - dl[org] ) - t;
+        const Scalar w = z[j]/del;
+        const Scalar term = z[j]*w;
+        f += term;
+        err += Abs( term );
+        if( j <= i ){ df_L += w*w; }else
+        { df_R += w*w; }
+      }
+      err += Abs( t )*( df_L + df_R );
+    };
+
+    // Bracket the root; f increases between consecutive poles.
+    Scalar lo = {}, hi = {};
+    if( last )
+    {
+      Scalar zz = {};
+      for( Index j = 0; j < (Index)K; ++j )
+      { zz += Sqr( z[j] ); }
+
+      org = i;
+      hi = rho*zz;
+    }
+    else
+    {
+      const Scalar gap = dl[i+1] - dl[i];
+
+      org = i;
+      Eval( gap/2 );
+      if( f >= 0 )
+      { hi = gap/2; }else
+      { org = i+1; lo = -gap/2; }
+    }
+
+    Scalar t = ( lo + hi )/2;
+    for( Size count = 0; count < this->_config.maxIterationCount; ++count )
+    {
+      Eval( t );
+      if( Abs( f ) <= 8*eps*err )
+      { tau = t; return true; }
+
+      if( f > 0 ){ hi = t; }else
+      { lo = t; }
+
+      if( ( hi - lo ) <= 2*eps*Max( Abs( lo ), Abs( hi ) ) )
+      { tau = t; return true; }
+
+      // Model f by c + s/(a-x) + S/(b-x), matching the value and the
+      // two partial derivatives at t, with a and b the distances to
+      // the poles; x is the step to the model's root between them.
+      const Scalar a = ( dl[i] - dl[org] ) - t;
+      const Scalar s = a*a*df_L;
+
+      bool ok = false;
+      Scalar x = {};
+      if( last )
+      {
+        const Scalar c = f - a*df_L;
+        if( c > 0 )
+        { x = a + s/c; ok = true; }
+      }
+      else
+      {
+        const Scalar b = ( dl[i+1] - dl[org] ) - t;
+        const Scalar S = b*b*df_R;
+        const Scalar c = f - a*df_L - b*df_R;
+
+        // c*x^2 + qb*x + qc = 0
+        const Scalar qb = -( c*(a + b) + s + S );
+        const Scalar qc = c*a*b + s*b + S*a;
+        if( IsZero( c ) )
+        {
+          if( ! IsZero( qb ) )
+          { x = -qc/qb; ok = true; }
+        }
+        else
+        {
+          const Scalar disc = qb*qb - 4*c*qc;
+          if( disc >= 0 )
+          {
+            // The model has one root between its poles; when rounding
+            // puts both in, the far one sits on a pole, so take the
+            // one nearer t.
+            const Scalar q = -( qb + CopySign( Sqrt( disc ), qb ) )/2;
+            const Scalar x1 = q/c;
+            if( IsZero( q ) ){ x = x1; }else
+            {
+              const Scalar x2 = qc/q;
+              const bool in1 = ( a < x1 ) && ( x1 < b );
+              const bool in2 = ( a < x2 ) && ( x2 < b );
+              x = ( in1 && ( ! in2 || ( Abs( x1 ) <= Abs( x2 ) ) ) ) ? x1 : x2;
+            }
+            ok = true;
+          }
+        }
+      }
+
+      // Fall back to bisection if the step leaves the bracket.
+      const Scalar tn = t + x;
+      t = ( ok && ( lo < tn ) && ( tn < hi ) ) ? tn : ( lo + hi )/2;
+    }
+
+    // Failed to converge.
+    return false;
+  }
+
+  // Merges the eigensystems of the two halves of an m by m tridiagonal
+  // matrix cut after row k, whose coupling element was beta. On entry
+  // d(0:k-1), d(k:m-1) hold the eigenvalues of each half in increasing
+  // order and Q = blockdiag( Q1, Q2 ) their eigenvectors.
+  template< typename Lyt,
+    typename T_Arr_d,
+    typename T_Blk_Q,
+    typename T_Arr_work,
+    typename T_Exec >
+  constexpr bool _Merge( Size m, Size k, const Scalar &beta,
+    T_Arr_d d, T_Blk_Q Q_, Stride Q_ld, T_Arr_work work, T_Exec &exec ) const
+  {
+    auto Q = [&]( auto i, auto j ) -> auto &
+    { return Lyt::MatRef( Q_, i, j, Q_ld ); };
+    auto Q_Blk = [&]( auto i, auto j ) -> auto
+    { return Lyt::BlkPtr( Q_, i, j, Q_ld ); };
+    auto Q_Col = [&]( auto i, auto j ) -> auto
+    { return Lyt::ColPtr( Q_, i, j, Q_ld ); };
+
+    const auto Q_cs = Lyt::ColStride( Q_, Q_ld );
+    const Scalar eps = this->_config.zeroTol;
+    const Scalar one = unit< Scalar >;
+    const Scalar zero = {};
+
+    // Gathered columns of Q, and the eigenvectors of the update.
+    const auto G_ = work;
+    const Stride G_ld = Lyt::DenseLd( m, m );
+    const auto U_ = G_ + m*m;
+
+    auto G_Blk = [&]( auto i, auto j ) -> auto
+    { return Lyt::BlkPtr( G_, i, j, G_ld ); };
+    auto G_Col = [&]( auto i, auto j ) -> auto
+    { return Lyt::ColPtr( G_, i, j, G_ld ); };
+
+    const auto z    = U_ + m*m;
+    const auto dl   = z + m;
+    const auto zh   = dl + m;
+    const auto tau  = zh + m;
+    const auto org  = tau + m;
+    const auto perm = org + m;
+    const auto type = perm + m;
+    const auto ord  = type + m;
+    const auto grp  = ord + m;
+
+    auto Ix = [&]( const Scalar &v ) -> Index
+    { return (Index)v; };
+
+    // z := ~Q*( e(k-1) + sign(beta)*e(k) )/sqrt(2), so |z| = 1 and
+    // T = blockdiag( T1, T2 ) + rho*u*~u with rho = 2*|beta|.
+    // Columns are of type 1 (nonzero in the first k rows only),
+    // 3 (in the last m-k rows only) or 2 (in both).
+    const Scalar rho = 2*Abs( beta );
+    const Scalar r2 = Inv( Sqrt( Scalar{2} ) );
+    for( Index j = 0; j < (Index)k; ++j )
+    { z[j] = r2*Q( (Index)(k-1), j ); type[j] = 1; }
+    for( Index j = (Index)k; j < (Index)m; ++j )
+    { z[j] = CopySign( r2, beta )*Q( (Index)k, j ); type[j] = 3; }
+
+    // Merge the two increasing runs of d.
+    {
+      Index p = 0, q = (Index)k;
+      for( Index j = 0; j < (Index)m; ++j )
+      {
+        const bool left = ( q >= (Index)m ) || ( ( p < (Index)k ) && ( d[p] <= d[q] ) );
+        perm[j] = (Scalar)( left ? p++ : q++ );
+      }
+    }
+
+    Scalar dmax = {}, zmax = {};
+    for( Index j = 0; j < (Index)m; ++j )
+    {
+      dmax = Max( dmax, Abs( d[j] ) );
+      zmax = Max( zmax, Abs( z[j] ) );
+    }
+    const Scalar tol = 8*eps*Max( dmax, zmax );
+
+    // Deflate: components of z that are negligible, and pairs of
+    // close eigenvalues, which a rotation reduces to one component.
+    // Nondeflated columns go to ord(0:K-1) in increasing order of d,
+    // deflated ones to perm(0:nd-1), behind the merge being read.
+    Size K = 0, nd = 0;
+    if( rho*zmax > tol )
+    {
+      Index pj = -1;
+      for( Index jj = 0; jj < (Index)m; ++jj )
+      {
+        const Index nj = Ix( perm[jj] );
+        if( rho*Abs( z[nj] ) <= tol )
+        { perm[nd++] = (Scalar)nj; continue; }
+
+        if( pj >= 0 )
+        {
+          Scalar s = z[pj];
+          Scalar c = z[nj];
+          const Scalar r = Hypot( c, s );
+          const Scalar t = d[nj] - d[pj];
+          c /= r;
+          s = -s/r;
+          if( Abs( t*c*s ) <= tol )
+          {
+            z[nj] = r;
+            z[pj] = zero;
+            if( type[pj] != type[nj] )
+            { type[nj] = 2; }
+            Vec_PlnRot< Lyt >( m, Q_Col(0,pj), Q_cs, Q_Col(0,nj), Q_cs, c, s );
+            const Scalar dp = d[pj]*c*c + d[nj]*s*s;
+            d[nj] = d[pj]*s*s + d[nj]*c*c;
+            d[pj] = dp;
+            perm[nd++] = (Scalar)pj;
+          }
+          else
+          { ord[K++] = (Scalar)pj; }
+        }
+        pj = nj;
+      }
+      if( pj >= 0 )
+      { ord[K++] = (Scalar)pj; }
+    }
+    else
+    {
+      for( Index j = 0; j < (Index)m; ++j )
+      { perm[nd++] = perm[j]; }
+    }
+
+    if( K > 0 )
+    {
+      for( Index i = 0; i < (Index)K; ++i )
+      {
+        dl[i] = d[Ix( ord[i] )];
+        zh[i] = z[Ix( ord[i] )];
+      }
+
+      // Solve the secular equation
+      for( Index i = 0; i < (Index)K; ++i )
+      {
+        Index o = 0;
+        if( ! this->_Secular( K, i, dl, zh, rho, o, tau[i] ) )
+        { return false; }
+        org[i] = (Scalar)o;
+      }
+
+      // Recompute z from the computed eigenvalues (Loewner), into z.
+      for( Index i = 0; i < (Index)K; ++i )
+      {
+        Scalar w = ( dl[i] - dl[Ix( org[i] )] ) - tau[i];
+        for( Index j = 0; j < (Index)K; ++j )
+        {
+          if( j != i )
+          { w *= ( ( dl[i] - dl[Ix( org[j] )] ) - tau[j] )/( dl[i] - dl[j] ); }
+        }
+        z[i] = CopySign( Sqrt( -w ), zh[i] );
+      }
+
+      // Order the nondeflated columns by type: 1, 2, 3.
+      Size n1 = 0, n2 = 0;
+      {
+        Size r = 0;
+        for( Scalar ty = 1; ty <= 3; ty += 1 )
+        {
+          for( Index i = 0; i < (Index)K; ++i )
+          {
+            if( type[Ix( ord[i] )] == ty )
+            { grp[r++] = (Scalar)i; }
+          }
+          if( 1 == ty ){ n1 = r; }
+          if( 2 == ty ){ n2 = r - n1; }
+        }
+      }
+
+      // U(r,j) = z(g(r))/( dl(g(r)) - lambda(j) ), normalized by columns.
+      const Stride U_ld = Lyt::DenseLd( K, K );
+      auto U = [&]( auto i, auto j ) -> auto &
+      { return Lyt::MatRef( U_, i, j, U_ld ); };
+      auto U_Blk = [&]( auto i, auto j ) -> auto
+      { return Lyt::BlkPtr( U_, i, j, U_ld ); };
+
+      for( Index j = 0; j < (Index)K; ++j )
+      {
+        const Scalar dl_o = dl[Ix( org[j] )];
+        for( Index r = 0; r < (Index)K; ++r )
+        {
+          const Index i = Ix( grp[r] );
+          U(r,j) = z[i]/( ( dl[i] - dl_o ) - tau[j] );
+        }
+        const auto U_col = Lyt::ColPtr( U_, 0, j, U_ld );
+        const auto U_cs = Lyt::ColStride( U_, U_ld );
+        Vec_Scale< Lyt >( K, Inv( Vec_Norm2< Lyt >( K, U_col, U_cs ) ), U_col, U_cs );
+      }
+
+      // Gather the columns: nondeflated by type, then deflated.
+      for( Index r = 0; r < (Index)K; ++r )
+      { Vec_Copy< Lyt >( m, Q_Col(0,Ix( ord[Ix( grp[r] )] )), Q_cs, G_Col(0,r), Lyt::ColStride( G_, G_ld ) ); }
+      for( Index t = 0; t < (Index)nd; ++t )
+      { Vec_Copy< Lyt >( m, Q_Col(0,Ix( perm[t] )), Q_cs, G_Col(0,(Index)K+t), Lyt::ColStride( G_, G_ld ) ); }
+
+      // Eigenvalues, in the same column order.
+      for( Index t = 0; t < (Index)nd; ++t )
+      { zh[t] = d[Ix( perm[t] )]; }
+      for( Index j = 0; j < (Index)K; ++j )
+      { d[j] = dl[Ix( org[j] )] + tau[j]; }
+      for( Index t = 0; t < (Index)nd; ++t )
+      { d[(Index)K+t] = zh[t]; }
+
+      // Q(0:k-1,0:K-1) := G(0:k-1,types 1,2)*U(types 1,2,:)
+      const Size n12 = n1 + n2;
+      const Size n23 = K - n1;
+      if( n12 > 0 )
+      {
+        Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, k, K, n12, one,
+          G_, G_ld, U_, U_ld, zero, Q_, Q_ld, exec );
+      }
+      else
+      { Mat_Fill< Lyt >( Half::Both, k, K, zero, zero, Q_, Q_ld ); }
+
+      // Q(k:m-1,0:K-1) := G(k:m-1,types 2,3)*U(types 2,3,:)
+      if( n23 > 0 )
+      {
+        Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, m-k, K, n23, one,
+          G_Blk( (Index)k, (Index)n1 ), G_ld, U_Blk( (Index)n1, 0 ), U_ld, zero,
+          Q_Blk( (Index)k, 0 ), Q_ld, exec );
+      }
+      else
+      { Mat_Fill< Lyt >( Half::Both, m-k, K, zero, zero, Q_Blk( (Index)k, 0 ), Q_ld ); }
+
+      // The deflated columns are unchanged.
+      Mat_Copy< Lyt >( Half::Both, Trnsp::No, m, nd,
+        G_Blk( 0, (Index)K ), G_ld, Q_Blk( 0, (Index)K ), Q_ld );
+    }
+
+    _n_Impl::_Syt_EigSort< Lyt >( m, m, d, Q_, Q_ld );
+    return true;
+  }
+
+  // Computes the eigensystem of the m by m tridiagonal (d,e) into Q,
+  // which must hold the identity on entry.
+  template< typename Lyt,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Blk_Q,
+    typename T_Arr_work,
+    typename T_Exec >
+  constexpr bool _Solve( Size m, T_Arr_d d, T_Arr_e e,
+    T_Blk_Q Q_, Stride Q_ld, T_Arr_work work, T_Exec &exec ) const
+  {
+    if( m <= Max( this->_config.leafSize, (Size)2 ) )
+    {
+      Syt_EigVecQR< Scalar, DefaultLyt > QR{};
+      QR.SetConfig( { this->_config.maxIterationCount, this->_config.zeroTol } );
+      if( ! QR.template Solve< Lyt >( m, d, e, Q_, Q_ld, work ) )
+      { return false; }
+
+      _n_Impl::_Syt_EigSort< Lyt >( m, m, d, Q_, Q_ld );
+      return true;
+    }
+
+    // Divide: T = blockdiag( T1, T2 ) + |beta|*u*~u
+    const Size k = m/2;
+    const Scalar beta = e[k-1];
+    d[k-1] -= Abs( beta );
+    d[k] -= Abs( beta );
+
+    if( ! this->template _Solve< Lyt >( k, d, e, Q_, Q_ld, work, exec ) )
+    { return false; }
+    if( ! this->template _Solve< Lyt >( m-k, d+k, e+k,
+      Lyt::BlkPtr( Q_, (Index)k, (Index)k, Q_ld ), Q_ld, work, exec ) )
+    { return false; }
+
+    // Conquer
+    return this->template _Merge< Lyt >( m, k, beta, d, Q_, Q_ld, work, exec );
+  }
+
+public:
+
+  constexpr const Config &config() const noexcept
+  { return this->_config; }
+  constexpr void SetConfig( const Config &config ) noexcept
+  { this->_config = config; }
+
+  IND_NOTHROW_VITAE( Syt_EigVecDC );
+
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Blk_Z,
+    typename T_Arr_work >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Arr_d> >,
+    Decay< DerefTypeOf<T_Arr_e> >,
+    Decay< DerefTypeOf<T_Blk_Z> >,
+    Decay< DerefTypeOf<T_Arr_work>> >)
+  constexpr bool Solve( Size n, T_Arr_d d, T_Arr_e e, T_Blk_Z Z_, Stride Z_ld, T_Arr_work work ) const
+  { return this->template Solve< Lyt >( n, d, e, Z_, Z_ld, work, Exec_Seq{} ); }
+
+  /// <summary>
+  /// Solves as above, with the products that form the eigenvectors of
+  /// each merge, and Z*Q, split through the execution context exec
+  /// (see <see cref="ExecContext"/>); the rest stays on the caller.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Blk_Z,
+    typename T_Arr_work,
+    typename T_Exec >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Arr_d> >,
+    Decay< DerefTypeOf<T_Arr_e> >,
+    Decay< DerefTypeOf<T_Blk_Z> >,
+    Decay< DerefTypeOf<T_Arr_work>> >
+    && ExecContext< Decay<T_Exec> > )
+  constexpr bool Solve( Size n, T_Arr_d d, T_Arr_e e, T_Blk_Z Z_, Stride Z_ld, T_Arr_work work, T_Exec &&exec ) const
+  {
+    IND_MATH_TRACE_SCOPE( "Syt_EigVecDC", n, n, 0, 0, ( 2.0*n*n + 4.0*n )*sizeof( Scalar ) );
+
+    if( 0 == n ){ return true; }
+
+    const Scalar eps = this->_config.zeroTol;
+    const Scalar one = unit< Scalar >;
+    const Scalar zero = {};
+
+    auto Z_Blk = [&]( auto i, auto j ) -> auto
+    { return Lyt::BlkPtr( Z_, i, j, Z_ld ); };
+
+    if( n <= this->_config.leafSize )
+    {
+      Syt_EigVecQR< Scalar, DefaultLyt > QR{};
+      QR.SetConfig( { this->_config.maxIterationCount, this->_config.zeroTol } );
+      if( ! QR.template Solve< Lyt >( n, d, e, Z_, Z_ld, work ) )
+      { return false; }
+
+      _n_Impl::_Syt_EigSort< Lyt >( n, n, d, Z_, Z_ld );
+      return true;
+    }
+
+    // Solve each unreduced block on its own.
+    Index s = 0;
+    while( s < (Index)n )
+    {
+      Index t = s;
+      for( ; t < (Index)(n-1); ++t )
+      {
+        const Scalar tiny = eps*Sqrt( Abs( d[t] ) )*Sqrt( Abs( d[t+1] ) );
+        if( Abs( e[t] ) <= tiny )
+        {
+          e[t] = zero;
+          break;
+        }
+      }
+
+      const Size m = (Size)(t - s) + 1;
+      if( m > 1 )
+      {
+        // Scale
+        const auto anorm = Syt_Norm< Lyt >( NormType::Max, m, d+s, e+s );
+        if( ! IsZero( anorm ) )
+        {
+          Vec_Rescl< Lyt >( anorm, one, m, d+s, 1 );
+          Vec_Rescl< Lyt >( anorm, one, m-1, e+s, 1 );
+
+          const auto Q_ = work;
+          const Stride Q_ld = Lyt::DenseLd( m, m );
+          Mat_Fill< Lyt >( Half::Both, m, m, zero, one, Q_, Q_ld );
+
+          if( ! this->template _Solve< Lyt >( m, d+s, e+s, Q_, Q_ld, work + m*m, exec ) )
+          { return false; }
+
+          Vec_Rescl< Lyt >( one, anorm, m, d+s, 1 );
+
+          // Z(:,s:t) := Z(:,s:t)*Q
+          const auto W_ = work + m*m;
+          const Stride W_ld = Lyt::DenseLd( n, m );
+          Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, n, m, m, one,
+            Z_Blk( 0, s ), Z_ld, Q_, Q_ld, zero, W_, W_ld, exec );
+          Mat_Copy< Lyt >( Half::Both, Trnsp::No, n, m,
+            W_, W_ld, Z_Blk( 0, s ), Z_ld );
+        }
+      }
+
+      s = t+1;
+    }
+
+    _n_Impl::_Syt_EigSort< Lyt >( n, n, d, Z_, Z_ld );
+    return true;
+  }
+
+  /// <summary>
+  /// Size of the workspace Solve needs for order n under the
+  /// current configuration.
+  /// </summary>
+  constexpr Size WorkSize( Size n ) const noexcept
+  { return Syt_EigVecDC_WorkSize( n ); }
+
+  /// <summary>
+  /// Solves as above, with the workspace taken from arena.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Blk_Z >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Arr_d> >,
+    Decay< DerefTypeOf<T_Arr_e> >,
+    Decay< DerefTypeOf<T_Blk_Z> > >)
+  bool Solve( Size n, T_Arr_d d, T_Arr_e e, T_Blk_Z Z_, Stride Z_ld, Aux_Arena< Scalar > &arena ) const
+  { return this->template Solve< Lyt >( n, d, e, Z_, Z_ld, arena, Exec_Seq{} ); }
+
+  /// <summary>
+  /// Solves as above through exec, with the workspace taken from
+  /// arena.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Blk_Z,
+    typename T_Exec >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Arr_d> >,
+    Decay< DerefTypeOf<T_Arr_e> >,
+    Decay< DerefTypeOf<T_Blk_Z> > >
+    && ExecContext< Decay<T_Exec> > )
+  bool Solve( Size n, T_Arr_d d, T_Arr_e e, T_Blk_Z Z_, Stride Z_ld, Aux_Arena< Scalar > &arena, T_Exec &&exec ) const
+  {
+    typename Aux_Arena< Scalar >::Frame frame{ arena };
+    return this->template Solve< Lyt >( n, d, e, Z_, Z_ld, arena.Take( this->WorkSize( n ) ), exec );
+  }
+
+  /// <summary>
+  /// Updates the eigendecomposition Z*diag(d)*(~Z) of a symmetric n by
+  /// n matrix A to that of A + rho*v*(~v), in place: d holds the
+  /// eigenvalues in increasing order and Z the orthonormal
+  /// eigenvectors, on entry and on return. v has n elements, of
+  /// stride v_s.
+  ///
+  /// work must hold <see cref="Syt_EigVecDC_UpdWorkSize"/>( n ) elements.
+  /// Returns false if the secular equation failed to converge.
+  /// </summary>
+  /// <remarks>
+  /// Based on the LAPACK routine <c>dlaed1</c>: the merge of the divide
+  /// and conquer solver with z = (~Z)*v, the same deflation, secular
+  /// equation and Gu-Eisenstat vectors. The eigenvalues take O(n^2)
+  /// work; forming Z*U takes one <see cref="Mat_MatMul"/> of n by K by
+  /// K, K the number of nondeflated columns, so an update is as cheap
+  /// as the structure of v allows, and never more than about 2n^3
+  /// flops against some 9n^3 for solving anew. rho &lt; 0 is solved as
+  /// the update of -A by -rho.
+  /// </remarks>
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Blk_Z,
+    typename T_Vec_v,
+    typename T_Arr_work >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Arr_d> >,
+    Decay< DerefTypeOf<T_Blk_Z> >,
+    Decay< DerefTypeOf<T_Vec_v> >,
+    Decay< DerefTypeOf<T_Arr_work>> >)
+  constexpr bool Update( Size n, T_Arr_d d, T_Blk_Z Z_, Stride Z_ld,
+    const Scalar &rho, T_Vec_v v, Stride v_s, T_Arr_work work ) const
+  {
+    IND_MATH_TRACE_SCOPE( "Syt_EigVecDC::Update", n, n, 0, 2.0*n*n*n, ( n*n + 2.0*n )*sizeof( Scalar ) );
+
+    auto Z_Blk = [&]( auto i, auto j ) -> auto
+    { return Lyt::BlkPtr( Z_, i, j, Z_ld ); };
+    auto Z_Col = [&]( auto i, auto j ) -> auto
+    { return Lyt::ColPtr( Z_, i, j, Z_ld ); };
+
+    const auto Z_cs = Lyt::ColStride( Z_, Z_ld );
+    const Scalar eps = this->_config.zeroTol;
+    const Scalar one = unit< Scalar >;
+    const Scalar zero = {};
+
+    if( ( 0 == n ) || IsZero( rho ) ){ return true; }
+
+    // Gathered columns of Z, and the eigenvectors of the update.
+    const auto G_ = work;
+    const Stride G_ld = Lyt::DenseLd( n, n );
+    const auto U_ = G_ + n*n;
+
+    auto G_Blk = [&]( auto i, auto j ) -> auto
+    { return Lyt::BlkPtr( G_, i, j, G_ld ); };
+    auto G_Col = [&]( auto i, auto j ) -> auto
+    { return Lyt::ColPtr( G_, i, j, G_ld ); };
+
+    const auto z    = U_ + n*n;
+    const auto dl   = z + n;
+    const auto zh   = dl + n;
+    const auto tau  = zh + n;
+    const auto org  = tau + n;
+    const auto perm = org + n;
+    const auto ord  = perm + n;
+
+    auto Ix = [&]( const Scalar &x ) -> Index
+    { return (Index)x; };
+
+    // -A = Z*diag(-d)*(~Z) - rho*v*(~v), with -d increasing once the
+    // columns are reversed.
+    const bool flip = ( rho < zero );
+    auto Flip = [&]()
+    {
+      for( Index j = 0; j < (Index)n; ++j )
+      { d[j] = -d[j]; }
+      for( Index j = 0, l = (Index)n-1; j < l; ++j, --l )
+      {
+        const Scalar t = d[j]; d[j] = d[l]; d[l] = t;
+        Vec_Swap< Lyt >( n, Z_Col(0,j), Z_cs, Z_Col(0,l), Z_cs );
+      }
+    };
+
+    if( flip ){ Flip(); }
+    _n_Impl::_Syt_EigSort< Lyt >( n, n, d, Z_, Z_ld );
+
+    // z := (~Z)*v/|v'|, rho := |rho|*|(~Z)*v|^2, so |z| = 1
+    Mat_VecMul< Lyt >( Trnsp::Yes, n, n, one, Z_, Z_ld, v, v_s, zero, z, 1 );
+    const Scalar zn = Vec_Norm2< Lyt >( n, z, 1 );
+    if( IsZero( zn ) )
+    {
+      if( flip ){ Flip(); }
+      return true;
+    }
+    Vec_Scale< Lyt >( n, Inv( zn ), z, 1 );
+    const Scalar r = Abs( rho )*zn*zn;
+
+    Scalar dmax = {}, zmax = {};
+    for( Index j = 0; j < (Index)n; ++j )
+    {
+      dmax = Max( dmax, Abs( d[j] ) );
+      zmax = Max( zmax, Abs( z[j] ) );
+    }
+    const Scalar tol = 8*eps*Max( dmax, zmax );
+
+    // Deflate as the merge does. Nondeflated columns go to ord(0:K-1)
+    // in increasing order of d, deflated ones to perm(0:nd-1).
+    Size K = 0, nd = 0;
+    {
+      Index pj = -1;
+      for( Index nj = 0; nj < (Index)n; ++nj )
+      {
+        if( r*Abs( z[nj] ) <= tol )
+        { perm[nd++] = (Scalar)nj; continue; }
+
+        if( pj >= 0 )
+        {
+          Scalar s = z[pj];
+          Scalar c = z[nj];
+          const Scalar h = Hypot( c, s );
+          const Scalar t = d[nj] - d[pj];
+          c /= h;
+          s = -s/h;
+          if( Abs( t*c*s ) <= tol )
+          {
+            z[nj] = h;
+            z[pj] = zero;
+            Vec_PlnRot< Lyt >( n, Z_Col(0,pj), Z_cs, Z_Col(0,nj), Z_cs, c, s );
+            const Scalar dp = d[pj]*c*c + d[nj]*s*s;
+            d[nj] = d[pj]*s*s + d[nj]*c*c;
+            d[pj] = dp;
+            perm[nd++] = (Scalar)pj;
+          }
+          else
+          { ord[K++] = (Scalar)pj; }
+        }
+        pj = nj;
+      }
+      if( pj >= 0 )
+      { ord[K++] = (Scalar)pj; }
+    }
+
+    if( K > 0 )
+    {
+      for( Index i = 0; i < (Index)K; ++i )
+      {
+        dl[i] = d[Ix( ord[i] )];
+        zh[i] = z[Ix( ord[i] )];
+      }
+
+      // Solve the secular equation
+      for( Index i = 0; i < (Index)K; ++i )
+      {
+        Index o = 0;
+        if( ! this->_Secular( K, i, dl, zh, r, o, tau[i] ) )
+        {
+          if( flip ){ Flip(); }
+          return false;
+        }
+        org[i] = (Scalar)o;
+      }
+
+      // Recompute z from the computed eigenvalues (Loewner), into z.
+      for( Index i = 0; i < (Index)K; ++i )
+      {
+        Scalar w = ( dl[i] - dl[Ix( org[i] )] ) - tau[i];
+        for( Index j = 0; j < (Index)K; ++j )
+        {
+          if( j != i )
+          { w *= ( ( dl[i] - dl[Ix( org[j] )] ) - tau[j] )/( dl[i] - dl[j] ); }
+        }
+        z[i] = CopySign( Sqrt( -w ), zh[i] );
+      }
+
+      // U(i,j) = z(i)/( dl(i) - lambda(j) ), normalized by columns.
+      const Stride U_ld = Lyt::DenseLd( K, K );
+      auto U = [&]( auto i, auto j ) -> auto &
+      { return Lyt::MatRef( U_, i, j, U_ld ); };
+
+      for( Index j = 0; j < (Index)K; ++j )
+      {
+        const Scalar dl_o = dl[Ix( org[j] )];
+        for( Index i = 0; i < (Index)K; ++i )
+        { U(i,j) = z[i]/( ( dl[i] - dl_o ) - tau[j] ); }
+        const auto U_col = Lyt::ColPtr( U_, 0, j, U_ld );
+        const auto U_cs = Lyt::ColStride( U_, U_ld );
+        Vec_Scale< Lyt >( K, Inv( Vec_Norm2< Lyt >( K, U_col, U_cs ) ), U_col, U_cs );
+      }
+
+      // Gather the columns: nondeflated, then deflated.
+      for( Index i = 0; i < (Index)K; ++i )
+      { Vec_Copy< Lyt >( n, Z_Col(0,Ix( ord[i] )), Z_cs, G_Col(0,i), Lyt::ColStride( G_, G_ld ) ); }
+      for( Index t = 0; t < (Index)nd; ++t )
+      { Vec_Copy< Lyt >( n, Z_Col(0,Ix( perm[t] )), Z_cs, G_Col(0,(Index)K+t), Lyt::ColStride( G_, G_ld ) ); }
+
+      // Eigenvalues, in the same column order.
+      for( Index t = 0; t < (Index)nd; ++t )
+      { zh[t] = d[Ix( perm[t] )]; }
+      for( Index j = 0; j < (Index)K; ++j )
+      { d[j] = dl[Ix( org[j] )] + tau[j]; }
+      for( Index t = 0; t < (Index)nd; ++t )
+      { d[(Index)K+t] = zh[t]; }
+
+      // Z(:,0:K-1) := G(:,0:K-1)*U; the deflated columns are unchanged.
+      Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, n, K, K, one,
+        G_, G_ld, U_, U_ld, zero, Z_, Z_ld );
+      Mat_Copy< Lyt >( Half::Both, Trnsp::No, n, nd,
+        G_Blk( 0, (Index)K ), G_ld, Z_Blk( 0, (Index)K ), Z_ld );
+
+      _n_Impl::_Syt_EigSort< Lyt >( n, n, d, Z_, Z_ld );
+    }
+
+    if( flip ){ Flip(); }
+    return true;
+  }
+
+  /// <summary>
+  /// Updates the eigendecomposition as above to that of
+  /// A + V*diag(rho)*(~V), for the n by k matrix V, as k updates of
+  /// rank one, one per column.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Blk_Z,
+    typename T_Arr_rho,
+    typename T_Blk_V,
+    typename T_Arr_work >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Arr_d> >,
+    Decay< DerefTypeOf<T_Blk_Z> >,
+    Decay< DerefTypeOf<T_Arr_rho> >,
+    Decay< DerefTypeOf<T_Blk_V> >,
+    Decay< DerefTypeOf<T_Arr_work>> >)
+  constexpr bool Update( Size n, Size k, T_Arr_d d, T_Blk_Z Z_, Stride Z_ld,
+    T_Arr_rho rho, T_Blk_V V_, Stride V_ld, T_Arr_work work ) const
+  {
+    const auto V_cs = Lyt::ColStride( V_, V_ld );
+    for( Index j = 0; j < (Index)k; ++j )
+    {
+      if( ! this->template Update< Lyt >( n, d, Z_, Z_ld, rho[j],
+        Lyt::ColPtr( V_, 0, j, V_ld ), V_cs, work ) )
+      { return false; }
+    }
+    return true;
+  }
+};
+
+}// namespace LAPACK
+}// namespace Math
+}// namespace IND
+
+#else
+#error This file must not be included directly. #include <IND.Math.LAPACK.h> instead.
+#endif
\ No newline at end of file
@@ -6,10 +6,11 @@ namespace LAPACK {
 
 /// <summary>
 /// Calculates the size of the workspace required for
-/// <see cref="Syt_EigVecQR"/>.
+/// <see cref="Syt_EigVecQR"/>, where batch is the
+/// <c>sweepBatch</c> of its configuration.
 /// </summary>
-inline constexpr Size Syt_EigVecQR_WorkSize( Size n ) noexcept
-{ return 2*n; }
+inline constexpr Size Syt_EigVecQR_WorkSize( Size n, Size batch = 1 ) noexcept
+{ return ( batch > 1 ) ? 2*n + 2*batch*n : 2*n; }
 
 /// <summary>
 /// Eigensystem solver for Symmetric Tridiagonal matrices.
@@ -29,33 +30,37 @@ public:
   {
     Size maxIterationCount = 64;
     Scalar zeroTol = std::numeric_limits< T_Scalar >::epsilon();//Epsilon< Scalar >();
+    // Number of QL/QR sweeps queued before their rotations are applied
+    // to Z together by Mat_RotSeq_Wave; 1 applies every sweep at once.
+    Size sweepBatch = 1;
+
+    // The defaults, with sweepBatch overridden by the key
+    // Syt_EigVecQR.sweepBatch of Aux_Tuned().
+    static Config Tuned()
+    {
+      Config config{};
+      config.sweepBatch = Max( Aux_Tuned().Get< Scalar >( "Syt_EigVecQR.sweepBatch", config.sweepBatch ), (Size)1 );
+      return config;
+    }
   };
 
 private:
 
   Config _config;
 
-public:
-
-  constexpr const Config &config() const noexcept
-  { return this->_config; }
-  constexpr void SetConfig( const Config &config ) noexcept
-  { this->_config = config; }
-
-  IND_NOTHROW_VITAE( Syt_EigVecQR );
-
-  template< typename Lyt = DefaultLyt,
+  // The QL/QR iteration. Z itself is only updated through
+  // apply( direct, k, j, nn, c, s, cs_ld ), which must apply the k
+  // rotation sequences held in c and s by Mat_RotSeq_Wave to columns
+  // j to j+nn-1 of Z.
+  template< typename Lyt,
     typename T_Arr_d,
     typename T_Arr_e,
-    typename T_Blk_Z,
-    typename T_Arr_work >
-  requires( areTheSame< Scalar,
-    Decay< DerefTypeOf<T_Arr_d> >,
-    Decay< DerefTypeOf<T_Arr_e> >,
-    Decay< DerefTypeOf<T_Blk_Z> >,
-    Decay< DerefTypeOf<T_Arr_work>> >)
-  constexpr bool Solve( Size n, T_Arr_d d, T_Arr_e e, T_Blk_Z Z_, Stride Z_ld, T_Arr_work work ) const
+    typename T_Arr_work,
+    typename T_Fn_Apply >
+  constexpr bool _Solve( Size n, T_Arr_d d, T_Arr_e e, T_Arr_work work, T_Fn_Apply &&apply ) const
   {
+    IND_MATH_TRACE_SCOPE( "Syt_EigVecQR", n, n, 0, 0, ( 2.0*n*n + 4.0*n )*sizeof( Scalar ) );
+
     if( 0 == n ){ return true; }
 
     Size count = 0;
@@ -65,6 +70,16 @@ public:
     const T_Arr_work C = work;
     const T_Arr_work S = work + n;
 
+    // Queued sweeps, each padded with identity rotations to order n
+    const Size batch = Max( this->_config.sweepBatch, (Size)1 );
+    const T_Arr_work QC = work + 2*n;
+    const T_Arr_work QS = QC + batch*n;
+    Size queued = 0;
+    Direct queuedDirect = Direct::Fwd;
+    // Columns q0 to q1-1 of Z are touched by the queued sweeps
+    Index q0 = 0;
+    Index q1 = 0;
+
     const Scalar eps2 = Sqr( this->_config.zeroTol );
     const Scalar safmin = minValue<Scalar>;
     const Scalar safmax = Inv( safmin );
@@ -74,8 +89,51 @@ public:
     const Scalar zero = {};
     const Scalar one = unit<Scalar>;
 
-    auto Z_Blk = [&]( auto i, auto j ) -> auto
-    { return Lyt::BlkPtr( Z_, i, j, Z_ld ); };
+    auto Flush = [&]()
+    {
+      if( queued > 0 )
+      {
+        apply( queuedDirect, queued, q0, (Size)(q1-q0), QC+q0, QS+q0, (Stride)n );
+        queued = 0;
+      }
+    };
+
+    // Applies the rotations of a sweep to columns j to j+nn-1 of Z,
+    // or queues them.
+    auto Rotate = [&]( Direct direct, Index j, Size nn, T_Arr_work cj, T_Arr_work sj )
+    {
+      if( 1 == batch )
+      {
+        apply( direct, 1, j, nn, cj, sj, (Stride)n );
+        return;
+      }
+
+      if( direct != queuedDirect )
+      {
+        Flush();
+        queuedDirect = direct;
+      }
+
+      if( 0 == queued )
+      {
+        q0 = j;
+        q1 = j + (Index)nn;
+      }
+      else
+      {
+        q0 = Min( q0, j );
+        q1 = Max( q1, j + (Index)nn );
+      }
+
+      const T_Arr_work qc = QC + queued*n;
+      const T_Arr_work qs = QS + queued*n;
+      Vec_Fill< Lyt >( n-1, one, qc, 1 );
+      Vec_Fill< Lyt >( n-1, zero, qs, 1 );
+      Vec_Copy< Lyt >( nn-1, cj, 1, qc+j, 1 );
+      Vec_Copy< Lyt >( nn-1, sj, 1, qs+j, 1 );
+
+      if( ++queued == batch ){ Flush(); }
+    };
 
     while( count < maxCount )
     {
@@ -124,10 +182,15 @@ public:
       if( IsZero( anorm ) )
       { continue; }
 
+      // Most blocks are already within range, and need no scaling
       const auto scale = Clamp( anorm, ssfmin, ssfmax );
+      const bool rescl = ( scale != anorm );
 
-      Vec_Rescl< Lyt >( anorm, scale, kend-k+1, d+k, 1 );
-      Vec_Rescl< Lyt >( anorm, scale, kend-k, e+k, 1 );
+      if( rescl )
+      {
+        Vec_Rescl< Lyt >( anorm, scale, kend-k+1, d+k, 1 );
+        Vec_Rescl< Lyt >( anorm, scale, kend-k, e+k, 1 );
+      }
 
       // Choose between QL and QR iteration
 
@@ -175,8 +238,7 @@ public:
           if( k0 == k+1 )
           {
             Aux_EigVec2( d[k], e[k], d[k+1], d[k], d[k+1], C[k], S[k] );
-            Mat_RotSeq< Lyt >( Side::Right, Pivot::Var, Direct::Bwd,
-              n, 2, C+k, S+k, Z_Blk(0,k), Z_ld );
+            Rotate( Direct::Bwd, k, 2, C+k, S+k );
             e[k] = {};
             k += 2;
             continue;
@@ -185,6 +247,7 @@ public:
           if( count == maxCount )
           {
             // Failed to converge.
+            Flush();
             return false;
           }
           ++count;
@@ -218,8 +281,7 @@ public:
           e[k] = g;
 
           const Size nn = (Size)(k0 - k) + 1;
-          Mat_RotSeq< Lyt >( Side::Right, Pivot::Var, Direct::Bwd,
-            n, nn, C+k, S+k, Z_Blk(0,k), Z_ld );
+          Rotate( Direct::Bwd, k, nn, C+k, S+k );
         }
         // while( g <= gend )
       }
@@ -259,8 +321,7 @@ public:
           if( k0 == k-1 )
           {
             Aux_EigVec2( d[k-1], e[k-1], d[k], d[k-1], d[k], C[k], S[k] );
-            Mat_RotSeq< Lyt >( Side::Right, Pivot::Var, Direct::Fwd,
-              n, 2, C+k, S+k, Z_Blk(0,k-1), Z_ld );
+            Rotate( Direct::Fwd, k-1, 2, C+k, S+k );
             e[k-1] = {};
             k -= 2;
             continue;
@@ -269,6 +330,7 @@ public:
           if( count == maxCount )
           {
             // Failed to converge.
+            Flush();
             return false;
           }
           ++count;
@@ -303,20 +365,214 @@ public:
           e[k-1] = g;
 
           const Size nn = (Size)(k - k0) + 1;
-          Mat_RotSeq< Lyt >( Side::Right, Pivot::Var, Direct::Fwd,
-            n, nn, C+k0, S+k0, Z_Blk(0,k0), Z_ld );
+          Rotate( Direct::Fwd, k0, nn, C+k0, S+k0 );
         }
         // while( g >= gend )
       }
       // End of QL block
 
-      Vec_Rescl< Lyt >( scale, anorm, (kend_prev+1)-(k1_prev+1)+1, d+k1_prev, 1 );
+      if( rescl )
+      { Vec_Rescl< Lyt >( scale, anorm, (kend_prev+1)-(k1_prev+1)+1, d+k1_prev, 1 ); }
     }
     // while( count < maxCount )
 
+    Flush();
+
     // Converged.
     return true;
   }
+
+public:
+
+  constexpr const Config &config() const noexcept
+  { return this->_config; }
+  constexpr void SetConfig( const Config &config ) noexcept
+  { this->_config = config; }
+
+  IND_NOTHROW_VITAE( Syt_EigVecQR );
+
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Blk_Z,
+    typename T_Arr_work >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Arr_d> >,
+    Decay< DerefTypeOf<T_Arr_e> >,
+    Decay< DerefTypeOf<T_Blk_Z> >,
+    Decay< DerefTypeOf<T_Arr_work>> >)
+  constexpr bool Solve( Size n, T_Arr_d d, T_Arr_e e, T_Blk_Z Z_, Stride Z_ld, T_Arr_work work ) const
+  {
+    return this->template _Solve< Lyt >( n, d, e, work,
+      [&]( Direct direct, Size k, Index j, Size nn, T_Arr_work c, T_Arr_work s, Stride cs_ld )
+      {
+        if( 1 == k )
+        {
+          Mat_RotSeq< Lyt >( Side::Right, Pivot::Var, direct,
+            n, nn, c, s, Lyt::BlkPtr( Z_, 0, j, Z_ld ), Z_ld );
+        }
+        else
+        {
+          Mat_RotSeq_Wave< Lyt >( Side::Right, Pivot::Var, direct,
+            n, nn, k, c, s, cs_ld, Lyt::BlkPtr( Z_, 0, j, Z_ld ), Z_ld );
+        }
+      } );
+  }
+
+  /// <summary>
+  /// Solves as above for an order n fixed at compile time, with the
+  /// workspace on the stack; usable in constant expressions. Sweeps
+  /// are applied one at a time whatever config().sweepBatch is.
+  /// </summary>
+  template< Size n,
+    typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Blk_Z >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Arr_d> >,
+    Decay< DerefTypeOf<T_Arr_e> >,
+    Decay< DerefTypeOf<T_Blk_Z> > >)
+  constexpr bool Solve( T_Arr_d d, T_Arr_e e, T_Blk_Z Z_, Stride Z_ld ) const
+  {
+    Syt_EigVecQR solver = *this;
+    Config config = this->_config;
+    config.sweepBatch = 1;
+    solver.SetConfig( config );
+
+    std::array< Scalar, Max( Syt_EigVecQR_WorkSize( n ), (Size)1 ) > work{};
+    return solver.template Solve< Lyt >( n, d, e, Z_, Z_ld, work.data() );
+  }
+
+  /// <summary>
+  /// Solves as above, with the work on Z split through the execution
+  /// context exec (see <see cref="ExecContext"/>), with the same result.
+  ///
+  /// The QL/QR iteration on d and e stays on the calling thread. Each
+  /// sweep, or each batch of config().sweepBatch sweeps, is handed to
+  /// one task per tile of rows of Z.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Blk_Z,
+    typename T_Arr_work,
+    typename T_Exec >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Arr_d> >,
+    Decay< DerefTypeOf<T_Arr_e> >,
+    Decay< DerefTypeOf<T_Blk_Z> >,
+    Decay< DerefTypeOf<T_Arr_work>> >
+    && ExecContext< Decay<T_Exec> > )
+  constexpr bool Solve( Size n, T_Arr_d d, T_Arr_e e, T_Blk_Z Z_, Stride Z_ld, T_Arr_work work, T_Exec &&exec ) const
+  {
+    // Rows of Z per tile, at least
+    constexpr Size rowMin = Exec_SplitMin;
+
+    if( BLAS::_n_Impl::_isExecSeq< T_Exec > || ( 1 == exec.ThreadCount() ) || ( n < 2*rowMin ) )
+    { return this->template Solve< Lyt >( n, d, e, Z_, Z_ld, work ); }
+
+    return this->template _Solve< Lyt >( n, d, e, work,
+      [&]( Direct direct, Size k, Index j, Size nn, T_Arr_work c, T_Arr_work s, Stride cs_ld )
+      {
+        BLAS::_n_Impl::_Exec_Split( exec, n, rowMin, [&]( Index i0, Size mt )
+        {
+          if( 1 == k )
+          {
+            Mat_RotSeq< Lyt >( Side::Right, Pivot::Var, direct,
+              mt, nn, c, s, Lyt::BlkPtr( Z_, i0, j, Z_ld ), Z_ld );
+          }
+          else
+          {
+            Mat_RotSeq_Wave< Lyt >( Side::Right, Pivot::Var, direct,
+              mt, nn, k, c, s, cs_ld, Lyt::BlkPtr( Z_, i0, j, Z_ld ), Z_ld );
+          }
+        } );
+      } );
+  }
+
+  /// <summary>
+  /// Solves as above, on an <see cref="Exec_Par"/> of threadCount threads
+  /// counting the caller (0 means one per hardware thread), made for
+  /// the call.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Blk_Z,
+    typename T_Arr_work >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Arr_d> >,
+    Decay< DerefTypeOf<T_Arr_e> >,
+    Decay< DerefTypeOf<T_Blk_Z> >,
+    Decay< DerefTypeOf<T_Arr_work>> >)
+  bool Solve( Size n, T_Arr_d d, T_Arr_e e, T_Blk_Z Z_, Stride Z_ld, T_Arr_work work, Size threadCount ) const
+  {
+    if( ( 1 == threadCount ) || ( n < 2*Exec_SplitMin ) )
+    { return this->template Solve< Lyt >( n, d, e, Z_, Z_ld, work ); }
+
+    Exec_Par exec{ threadCount };
+    return this->template Solve< Lyt >( n, d, e, Z_, Z_ld, work, exec );
+  }
+
+  /// <summary>
+  /// Size of the workspace Solve needs for order n under the
+  /// current configuration.
+  /// </summary>
+  constexpr Size WorkSize( Size n ) const noexcept
+  { return Syt_EigVecQR_WorkSize( n, this->_config.sweepBatch ); }
+
+  /// <summary>
+  /// Solves as above, with the workspace taken from arena.
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Blk_Z >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Arr_d> >,
+    Decay< DerefTypeOf<T_Arr_e> >,
+    Decay< DerefTypeOf<T_Blk_Z> > >)
+  bool Solve( Size n, T_Arr_d d, T_Arr_e e, T_Blk_Z Z_, Stride Z_ld, Aux_Arena< Scalar > &arena ) const
+  {
+    typename Aux_Arena< Scalar >::Frame frame{ arena };
+    return this->template Solve< Lyt >( n, d, e, Z_, Z_ld, arena.Take( this->WorkSize( n ) ) );
+  }
+
+  /// <summary>
+  /// Solves as the first Solve, with Z of m rows only. The rotations
+  /// act on each row of Z alone, so Z may be any m rows of the n by n
+  /// matrix, e.g. those one process holds of a distributed one (see
+  /// <see cref="Sym_Eig_Dst"/>).
+  /// </summary>
+  template< typename Lyt = DefaultLyt,
+    typename T_Arr_d,
+    typename T_Arr_e,
+    typename T_Blk_Z,
+    typename T_Arr_work >
+  requires( areTheSame< Scalar,
+    Decay< DerefTypeOf<T_Arr_d> >,
+    Decay< DerefTypeOf<T_Arr_e> >,
+    Decay< DerefTypeOf<T_Blk_Z> >,
+    Decay< DerefTypeOf<T_Arr_work>> >)
+  constexpr bool SolveRows( Size n, Size m, T_Arr_d d, T_Arr_e e, T_Blk_Z Z_, Stride Z_ld, T_Arr_work work ) const
+  {
+    return this->template _Solve< Lyt >( n, d, e, work,
+      [&]( Direct direct, Size k, Index j, Size nn, T_Arr_work c, T_Arr_work s, Stride cs_ld )
+      {
+        if( 0 == m ){ return; }
+        if( 1 == k )
+        {
+          Mat_RotSeq< Lyt >( Side::Right, Pivot::Var, direct,
+            m, nn, c, s, Lyt::BlkPtr( Z_, 0, j, Z_ld ), Z_ld );
+        }
+        else
+        {
+          Mat_RotSeq_Wave< Lyt >( Side::Right, Pivot::Var, direct,
+            m, nn, k, c, s, cs_ld, Lyt::BlkPtr( Z_, 0, j, Z_ld ), Z_ld );
+        }
+      } );
+  }
 };
 
 }// namespace LAPACK
@@ -10,46 +10,78 @@ namespace LAPACK {
 ///    ( scl**2 )*smsq = x( 1 )^2 +...+ x( n )^2 + ( scale^2 )*sumsq,
 ///
 /// where  x( i ) = X( 1 + ( i - 1 )*INCX ). The value of  sumsq  is
-/// assumed to be non-negative and  scl  returns the value
-///
-///    scl = max( scale, abs( x( i ) ) ).
+/// assumed to be non-negative.
 ///
 /// scale and sumsq must be supplied in SCALE and SUMSQ and
 /// scl and smsq are overwritten on SCALE and SUMSQ respectively.
+/// scl is a power of the radix, 1 unless the sum would overflow or
+/// underflow, and no longer max( scale, abs( x( i ) ) ).
 ///
-/// The routine makes only one pass through the vector x.
+/// The routine makes only one pass through the vector x, with the
+/// three accumulators of Blue's algorithm.
 /// </summary>
 /// <remarks>
-/// Based on the LAPACK routine <c>dlassq</c>.
+/// Based on the LAPACK routine <c>dlassq</c> of LAPACK 3.10.
 /// </remarks>
 template< typename Lyt = Flat,
   typename T_Scalar,
-  typename T_Vec_x >
+  typename T_Vec_x,
+  StrideArg T_Stride_x >
 requires( ! isComplex< T_Scalar >
   && areTheSame< T_Scalar,
   Decay<DerefTypeOf<T_Vec_x>> > )
 constexpr void Vec_SmSqr(
-  Size n, T_Vec_x x, Stride x_s,
+  Size n, T_Vec_x x, T_Stride_x x_s,
   T_Scalar &scale, T_Scalar &sumsq )
 {
+  using Blue = BLAS::_n_Impl::_s_Ssq_Blue< T_Scalar >;
+
+  if( IsUndefined( scale ) || IsUndefined( sumsq ) ){ return; }
   if( 0 == n ){ return; }
 
-  for( Index i = 0; i < (Index)n; ++i )
+  if( IsZero( sumsq ) ){ scale = unit<T_Scalar>; }
+  if( IsZero( scale ) )
   {
-    const auto absxi = Abs( Lyt::VecRef( x, i, x_s ) );
-    if( ( IntSignOrZero( absxi ) > 0 ) || IsUndefined( absxi ) )
+    scale = unit<T_Scalar>;
+    sumsq = {};
+  }
+
+  T_Scalar ssq[3]{};
+  BLAS::_n_Impl::_Vec_Ssq< Lyt >( n, x, x_s, ssq );
+
+  // Put the existing sum of squares into the accumulator it belongs to
+  if( sumsq > T_Scalar{} )
+  {
+    const T_Scalar ax = scale*Sqrt( sumsq );
+    if( ax > Blue::tbig )
     {
-      if( scale < absxi )
+      // Scale before squaring, so that neither overflows
+      if( scale > unit<T_Scalar> )
       {
-        sumsq = unit<T_Scalar> + sumsq*Sqr( scale / absxi );
-        scale = absxi;
+        scale *= Blue::sbig;
+        ssq[0] += scale*( scale*sumsq );
       }
       else
+      { ssq[0] += scale*( scale*( Blue::sbig*( Blue::sbig*sumsq ) ) ); }
+    }
+    else if( ax < Blue::tsml )
+    {
+      if( IsZero( ssq[0] ) )
       {
-        sumsq += Sqr( absxi / scale );
+        if( scale < unit<T_Scalar> )
+        {
+          scale *= Blue::ssml;
+          ssq[2] += scale*( scale*sumsq );
+        }
+        else
+        { ssq[2] += scale*( scale*( Blue::ssml*( Blue::ssml*sumsq ) ) ); }
       }
     }
+    else
+    { ssq[1] += scale*( scale*sumsq ); }
   }
+
+  BLAS::_n_Impl::_Vec_SsqFold( ssq, scale, sumsq );
 }
 
 }// namespace LAPACK
@@ -80,6 +80,12 @@ enum class Vect
   Pt
 };
 
+enum class Job
+{
+  None,  // values only
+  Thin   // values, and the leading min(m,n) vectors
+};
+
 namespace _n_Impl {
 
 // Simple and readable, without syntactical
@@ -103,6 +109,8 @@ inline constexpr T_Scalar _oneHalf = Inv( T_Scalar{2} );
 #include <IND.Math.LAPACK.Aux_PlnRot2.inl>   // xlartg
 #include <IND.Math.LAPACK.Aux_Eig2.inl>      // xlae2
 #include <IND.Math.LAPACK.Aux_EigVec2.inl>   // xlaev2
+#include <IND.Math.LAPACK.Aux_Sng2.inl>      // xlas2
+#include <IND.Math.LAPACK.Aux_SngVec2.inl>   // xlasv2
 
 #include <IND.Math.LAPACK.Vec_Rescl.inl>     // <-------- extension
 #include <IND.Math.LAPACK.Vec_SmSqr.inl>     // xlassq
@@ -111,30 +119,67 @@ inline constexpr T_Scalar _oneHalf = Inv( T_Scalar{2} );
 #include <IND.Math.LAPACK.Rfl_BlkGen.inl>    // xlarft
 #include <IND.Math.LAPACK.Rfl_BlkMul.inl>    // xlarb
 #include <IND.Math.LAPACK.Rfl_MatMul.inl>    // xlarf
+#include <IND.Math.LAPACK.Aux_FctrBlk.inl>   // <-------- extension (shared xgeqrf/xgelqf/xgeqlf/xgerqf driver)
 
 #include <IND.Math.LAPACK.Mat_RotSeq.inl>    // xlasr
 #include <IND.Math.LAPACK.Mat_Fill.inl>      // xlaset
 #include <IND.Math.LAPACK.Mat_Rescl.inl>     // xlascl
-#include <IND.Math.LAPACK.Mat_Rdto_Bid.inl>  // xgebrd
-#include <IND.Math.LAPACK.Mat_Fctr_QL.inl>   // xgeql2
-#include <IND.Math.LAPACK.Mat_Fctr_QR.inl>   // xgeqr2
-#include <IND.Math.LAPACK.Mat_Fctr_LQ.inl>   // xgelq2
-#include <IND.Math.LAPACK.Mat_Fctr_RQ.inl>   // xgerq2
-
+#include <IND.Math.LAPACK.Mat_Rdto_Bid.inl>  // xgebd2 | xgebrd
+#include <IND.Math.LAPACK.Mat_Fctr_QL.inl>   // xgeql2 | xgeqlf
+#include <IND.Math.LAPACK.Mat_Fctr_QR.inl>   // xgeqr2 | xgeqrf
+#include <IND.Math.LAPACK.Mat_Fctr_QRP.inl>  // xgeqp3 | xlaqps | xlaqp2 <- and HQRRP
+#include <IND.Math.LAPACK.Mat_Fctr_LQ.inl>   // xgelq2 | xgelqf
+#include <IND.Math.LAPACK.Mat_Fctr_RQ.inl>   // xgerq2 | xgerqf
+#include <IND.Math.LAPACK.Mat_Fctr_QR_TS.inl> // <-------- extension (TSQR, parallel tree)
+#include <IND.Math.LAPACK.Mat_Fctr_QR_OOC.inl> // <-------- extension (out-of-core QR)
+#include <IND.Math.LAPACK.Mat_Fctr_QR_Dev.inl> // <-------- extension (hybrid host-device QR)
+#include <IND.Math.LAPACK.Mat_Fctr_QR_Dst.inl> // <-------- extension (distributed QR)
+#include <IND.Math.LAPACK.Mat_Fctr_QR_Upd.inl> // <-------- extension (QR update and downdate)
+
+#include <IND.Math.LAPACK.Mat_Norm.inl>      // xlange
+#include <IND.Math.LAPACK.Mat_RCond_LU.inl>  // xgecon
 #include <IND.Math.LAPACK.Sym_Norm.inl>      // xlansy
 #include <IND.Math.LAPACK.Sym_Rdto_Syt.inl>  // xsytd2 | xsytrd
+#include <IND.Math.LAPACK.Sym_Rdto_Bnd.inl>  // xsytrd_sy2sb
+#include <IND.Math.LAPACK.Sym_Rdto_Std.inl>  // xsygs2 | xsygst
+#include <IND.Math.LAPACK.Bnd_Rdto_Syt.inl>  // xsbtrd
 
 #include <IND.Math.LAPACK.Syt_Norm.inl>      // xlanst
 #include <IND.Math.LAPACK.Syt_EigQR.inl>     // xsterf
+#include <IND.Math.LAPACK.Syt_EigQD.inl>     // xlasq2 <- on a shifted L D (~L)
 #include <IND.Math.LAPACK.Syt_EigVecQR.inl>  // xsteqr
+#include <IND.Math.LAPACK.Syt_EigVecDC.inl>  // xstedc
+#include <IND.Math.LAPACK.Syt_EigVecBI.inl>  // xstebz + xstein
+
+#include <IND.Math.LAPACK.Bid_SVDQR.inl>     // xbdsqr
 
-#include <IND.Math.LAPACK.Ort_From_LQ.inl>   // xorgl2
+#include <IND.Math.LAPACK.Ort_From_LQ.inl>   // xorgl2 | xorglq
 #include <IND.Math.LAPACK.Ort_From_RQ.inl>   // xorgr2
-#include <IND.Math.LAPACK.Ort_From_QL.inl>   // xorg2l
-#include <IND.Math.LAPACK.Ort_From_QR.inl>   // xorg2l
+#include <IND.Math.LAPACK.Ort_From_QL.inl>   // xorg2l | xorgql
+#include <IND.Math.LAPACK.Ort_From_QR.inl>   // xorg2r | xorgqr
 #include <IND.Math.LAPACK.Ort_From_Syt.inl>  // xorgtr
+#include <IND.Math.LAPACK.Ort_From_Bnd.inl>  // xorgtr <- after xsytrd_sy2sb
 #include <IND.Math.LAPACK.Ort_From_Bid.inl>  // xorgbr <- simplified
 
+#include <IND.Math.LAPACK.Ort_MatMul_QR.inl>    // xorm2r | xormqr
+#include <IND.Math.LAPACK.Ort_MatMul_QL.inl>    // xorm2l | xormql
+#include <IND.Math.LAPACK.Ort_MatMul_LQ.inl>    // xorml2 | xormlq
+#include <IND.Math.LAPACK.Ort_MatMul_Syt.inl>   // xormtr
+#include <IND.Math.LAPACK.Ort_MatMul_Bid.inl>   // xormbr
+
+#include <IND.Math.LAPACK.Mat_Solv_LS.inl>   // xgels
+
+#include <IND.Math.LAPACK.Sym_Eig.inl>       // xsyevd
+#include <IND.Math.LAPACK.Sym_EigSmall.inl>  // <-------- extension (Jacobi, fixed small order)
+#include <IND.Math.LAPACK.Sym_Eig_Ilv.inl>   // <-------- extension (interleaved batch, lockstep QR)
+#include <IND.Math.LAPACK.Sym_Eig_Dev.inl>   // <-------- extension (hybrid host-device xsytrd | xsyevd)
+#include <IND.Math.LAPACK.Sym_Eig_Dst.inl>   // <-------- extension (distributed xsytrd | xsyev)
+#include <IND.Math.LAPACK.Sym_EigPipe.inl>   // <-------- extension (pipelined stream of problems)
+#include <IND.Math.LAPACK.Mat_SVD.inl>       // xgesvd
+#include <IND.Math.LAPACK.Mat_SVD_Rnd.inl>   // <-------- extension (randomized truncated SVD)
+#include <IND.Math.LAPACK.Sym_Eig_Rnd.inl>   // <-------- extension (randomized truncated xsyevd)
+#include <IND.Math.LAPACK.Sym_EigGen.inl>    // xsygvd
+
 #undef __IND_MATH_LAPACK_H_CONTENTS__
 
 #endif //__IND_MATH_LAPACK_H__
\ No newline at end of file
@@ -0,0 +1,1297 @@
+/*
+LAPACK Sample
+
+Copyright (C) 2024 Christopher Gary
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Benchmark harness: times the main BLAS and LAPACK routines over a
+// sweep of sizes, for Float32 and Float64, ColMajor and RowMajor, and
+// writes one record per run as CSV or JSON.
+//
+//   bench [--sizes 64,128,...] [--aspect a] [--reps r]
+//         [--only name] [--scalar float|double] [--layout col|row]
+//         [--json] [--out file] [--tune file]
+//         [--check] [--tol t] [--baseline file] [--threshold f] [--suite]
+//
+// n is swept; for the routines with a second extent, m = a*n (default
+// a = 1), and Mat_MatMul takes k = n. Each record is the best of reps
+// runs on fresh copies of the same input: the wall time, the nominal
+// flop count of LAPACK Working Note 41 as GFLOP/s, and the bytes of
+// the operands read and written once, as a lower bound on the memory
+// traffic.
+//
+// Built with IND_BENCH_SYSLIB defined, and linked against a system
+// BLAS/LAPACK with the Fortran interface (e.g. -lopenblas, or
+// -llapack -lblas), the ColMajor runs are repeated with the system
+// routines, as impl "sys", next to impl "ind".
+//
+// With --check, the result of the last run of each routine is probed
+// with a random vector x, as the round-trip checks of main.cpp do, and
+// its record gets the scaled residual
+//
+//   resid = ||A0*x - F*x|| / ( Max(m,n)*||A0||*||x||*eps ),
+//
+// with F the factors of A0 multiplied back, and the orthogonal factors
+// Q also ||(~Q)*Q*x - x|| / ( m*||x||*eps ), so the probes are matrix-
+// vector products and cost little next to the runs. The eigenvalues of
+// Syt_EigQR and Syt_EigQD, and of the system sterf, are compared with
+// those of Syt_EigVecQR instead. Mat_Solv_LS is checked on
+// ||(~A0)*(b - A0*x)||, as the least squares residual itself need not
+// be small. Syt_EigVecBI, for the lowest tenth of the eigenpairs, and
+// Mat_SVD_Rnd, on an A0 of rank n/8, are probed on the pairs and
+// triplets they return.
+// Mat_Fctr_QR_TS takes a 16n by 32 panel, so its leaves are split.
+// Records not checked have resid = -1.
+// A resid above the tolerance (--tol, default 30, the threshold of the
+// LAPACK test suite) fails the run.
+//
+// With --baseline, each record is compared with the one of the same
+// routine, impl, scalar, layout and extents in a file written before
+// by bench as CSV, and the run fails if its throughput, the inverse of
+// its time per call, dropped by more than a fraction (--threshold,
+// default 0.1) of the baseline's. Failures are written to stderr, and
+// bench then exits with 1.
+//
+// --suite is the regression suite: the sizes 256 to 8192, with
+// --check, e.g.
+//
+//   bench --suite --out base.csv
+//   bench --suite --baseline base.csv
+//
+// With --tune, nothing is benchmarked: the block sizes and crossovers
+// of Aux_Tuning are searched for instead, at the largest of the sizes,
+// and written to the tuning file, which the library reads at startup
+// from the path in the environment variable IND_MATH_TUNING.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <IND.Math.LAPACK.h>
+
+using namespace IND;
+using namespace IND::Math;
+using namespace IND::Math::LAPACK;
+
+#ifdef IND_BENCH_SYSLIB
+extern "C"
+{
+  void sgemm_( const char *, const char *, const int *, const int *, const int *, const float *, const float *, const int *, const float *, const int *, const float *, float *, const int * );
+  void dgemm_( const char *, const char *, const int *, const int *, const int *, const double *, const double *, const int *, const double *, const int *, const double *, double *, const int * );
+  void sgetrf_( const int *, const int *, float *, const int *, int *, int * );
+  void dgetrf_( const int *, const int *, double *, const int *, int *, int * );
+  void sgeqrf_( const int *, const int *, float *, const int *, float *, float *, const int *, int * );
+  void dgeqrf_( const int *, const int *, double *, const int *, double *, double *, const int *, int * );
+  void sorgqr_( const int *, const int *, const int *, float *, const int *, const float *, float *, const int *, int * );
+  void dorgqr_( const int *, const int *, const int *, double *, const int *, const double *, double *, const int *, int * );
+  void ssytrd_( const char *, const int *, float *, const int *, float *, float *, float *, float *, const int *, int * );
+  void dsytrd_( const char *, const int *, double *, const int *, double *, double *, double *, double *, const int *, int * );
+  void sorgtr_( const char *, const int *, float *, const int *, const float *, float *, const int *, int * );
+  void dorgtr_( const char *, const int *, double *, const int *, const double *, double *, const int *, int * );
+  void ssterf_( const int *, float *, float *, int * );
+  void dsterf_( const int *, double *, double *, int * );
+  void ssteqr_( const char *, const int *, float *, float *, float *, const int *, float *, int * );
+  void dsteqr_( const char *, const int *, double *, double *, double *, const int *, double *, int * );
+  void sgebrd_( const int *, const int *, float *, const int *, float *, float *, float *, float *, float *, const int *, int * );
+  void dgebrd_( const int *, const int *, double *, const int *, double *, double *, double *, double *, double *, const int *, int * );
+}
+
+// Overloads on the scalar type, and the workspace queries
+namespace Sys {
+
+  template< typename T > struct Fn;
+
+  template<> struct Fn< Float32 >
+  {
+    static constexpr auto gemm = sgemm_; static constexpr auto getrf = sgetrf_;
+    static constexpr auto geqrf = sgeqrf_; static constexpr auto orgqr = sorgqr_;
+    static constexpr auto sytrd = ssytrd_; static constexpr auto orgtr = sorgtr_;
+    static constexpr auto sterf = ssterf_; static constexpr auto steqr = ssteqr_;
+    static constexpr auto gebrd = sgebrd_;
+  };
+
+  template<> struct Fn< Float64 >
+  {
+    static constexpr auto gemm = dgemm_; static constexpr auto getrf = dgetrf_;
+    static constexpr auto geqrf = dgeqrf_; static constexpr auto orgqr = dorgqr_;
+    static constexpr auto sytrd = dsytrd_; static constexpr auto orgtr = dorgtr_;
+    static constexpr auto sterf = dsterf_; static constexpr auto steqr = dsteqr_;
+    static constexpr auto gebrd = dgebrd_;
+  };
+
+  // The lwork a routine asks for with lwork = -1
+  template< typename Scalar, typename T_Fn >
+  int QueryWork( T_Fn &&query )
+  {
+    Scalar w{};
+    query( &w, -1 );
+    return Max( (int)w, 1 );
+  }
+
+}// namespace Sys
+#endif
+
+struct Options
+{
+  std::vector< Size > sizes{ 64, 128, 256, 512, 1024 };
+  Size aspect = 1;
+  Size reps = 3;
+  std::string only;
+  bool float32 = true, float64 = true;
+  bool colMajor = true, rowMajor = true;
+  bool json = false;
+  std::string out;
+  std::string tune;
+  bool check = false;
+  double tol = 30;
+  std::string baseline;
+  double threshold = 0.1;
+};
+
+struct Record
+{
+  std::string routine;
+  const char *impl;
+  const char *scalar;
+  const char *layout;
+  Size m, n, k;
+  double seconds;
+  double flops;
+  double bytes;
+  double resid;
+};
+
+template< typename T > inline constexpr const char *scalarName = "";
+template<> inline constexpr const char *scalarName< Float32 > = "float";
+template<> inline constexpr const char *scalarName< Float64 > = "double";
+
+template< typename Lyt > inline constexpr const char *layoutName = "";
+template<> inline constexpr const char *layoutName< ColMajor > = "ColMajor";
+template<> inline constexpr const char *layoutName< RowMajor > = "RowMajor";
+
+// Best wall time of reps runs of body, each after setup, which is not
+// timed.
+template< typename T_Fn_Setup, typename T_Fn_Body >
+double BestTime( Size reps, T_Fn_Setup &&setup, T_Fn_Body &&body )
+{
+  double best = 0;
+  for( Size r = 0; r < Max( reps, (Size)1 ); ++r )
+  {
+    setup();
+    const auto t0 = std::chrono::steady_clock::now();
+    body();
+    const auto t1 = std::chrono::steady_clock::now();
+    const double t = std::chrono::duration< double >( t1 - t0 ).count();
+    if( ( 0 == r ) || ( t < best ) ){ best = t; }
+  }
+  return best;
+}
+
+template< typename Scalar, typename Lyt >
+void Run( const Options &opt, std::vector< Record > &records )
+{
+  std::mt19937 gen{ 1 };
+  std::uniform_real_distribution< Scalar > dist{ -1, 1 };
+
+  auto Random = [&]( Size count )
+  {
+    std::vector< Scalar > v( count );
+    for( auto &x : v ){ x = dist( gen ); }
+    return v;
+  };
+
+  auto RandomSym = [&]( Size n )
+  {
+    auto A = Random( n*n );
+    for( Index j = 0; j < (Index)n; ++j )
+    {
+      for( Index i = j+1; i < (Index)n; ++i )
+      { A[ i + j*n ] = A[ j + i*n ]; }
+    }
+    return A;
+  };
+
+  constexpr double sz = sizeof( Scalar );
+
+  auto Wanted = [&]( const char *routine )
+  { return opt.only.empty() || ( std::string{ routine }.find( opt.only ) != std::string::npos ); };
+
+  auto Add = [&]( const char *routine, const char *impl, Size m, Size n, Size k,
+    double seconds, double flops, double bytes, double resid = -1 )
+  {
+    records.push_back( { routine, impl, scalarName< Scalar >, layoutName< Lyt >,
+      m, n, k, seconds, flops, bytes, opt.check ? resid : -1 } );
+  };
+
+  // The checks of --check, on the result of the last run; the probes x
+  // have their own generator, so the inputs do not depend on --check.
+  std::mt19937 probeGen{ 2 };
+  const double eps = std::numeric_limits< Scalar >::epsilon();
+  const Scalar one = 1, zero = 0;
+
+  auto Probe = [&]( Size count )
+  {
+    std::vector< Scalar > x( count );
+    for( auto &v : x ){ v = dist( probeGen ); }
+    return x;
+  };
+
+  auto Norm = [&]( Size count, const Scalar *x ) -> double
+  { return Vec_Norm2( count, x, 1 ); };
+
+  auto Ratio = [&]( const std::vector< Scalar > &r, Size m, Size n, const Scalar *A0, const std::vector< Scalar > &x )
+  { return Norm( r.size(), r.data() )/( (double)Max( m, n )*Norm( m*n, A0 )*Norm( x.size(), x.data() )*eps ); };
+
+  // ||(~Q)*Q*x - x|| for the m by n Q
+  auto OrtRatio = [&]( Size m, Size n, const Scalar *Q, Stride ld )
+  {
+    const auto x = Probe( n );
+    std::vector< Scalar > u( m ), r = x;
+    Mat_VecMul< Lyt >( Trnsp::No, m, n, one, Q, ld, x.data(), 1, zero, u.data(), 1 );
+    Mat_VecMul< Lyt >( Trnsp::Yes, m, n, one, Q, ld, u.data(), 1, -one, r.data(), 1 );
+    return Norm( n, r.data() )/( (double)m*Norm( n, x.data() )*eps );
+  };
+
+  // A0 = P'*L*U, with L and U in F, and P of the interchanges piv
+  auto CheckLU = [&]( Size n, const Scalar *A0, const Scalar *F, Stride ld, const Index *piv )
+  {
+    const auto x = Probe( n );
+    auto r = x;
+    Tri_VecMul< Lyt >( Half::Upper, Trnsp::No, Diag::NotUnit, n, F, ld, r.data(), 1 );
+    Tri_VecMul< Lyt >( Half::Lower, Trnsp::No, Diag::IsUnit, n, F, ld, r.data(), 1 );
+    for( Index i = (Index)n-1; i >= 0; --i )
+    { Swap( r[i], r[ piv[i] ] ); }
+    Mat_VecMul< Lyt >( Trnsp::No, n, n, one, A0, ld, x.data(), 1, -one, r.data(), 1 );
+    return Ratio( r, n, n, A0, x );
+  };
+
+  // A0*P = Q*R, with R in the upper half of F, and P of jpvt, if any
+  auto CheckQR = [&]( Size m, Size n, const Scalar *A0, const Scalar *F, const Scalar *Q, Stride ld,
+    const Index *jpvt )
+  {
+    const auto x = Probe( n );
+    auto xp = x, z = x;
+    if( jpvt ){ for( Size j = 0; j < n; ++j ){ xp[ jpvt[j] ] = x[j]; } }
+    std::vector< Scalar > r( m );
+    Tri_VecMul< Lyt >( Half::Upper, Trnsp::No, Diag::NotUnit, n, F, ld, z.data(), 1 );
+    Mat_VecMul< Lyt >( Trnsp::No, m, n, one, A0, ld, xp.data(), 1, zero, r.data(), 1 );
+    Mat_VecMul< Lyt >( Trnsp::No, m, n, -one, Q, ld, z.data(), 1, one, r.data(), 1 );
+    return Max( Ratio( r, m, n, A0, x ), OrtRatio( m, n, Q, ld ) );
+  };
+
+  // A0 = Q*T*(~Q), T symmetric tridiagonal with diagonal d and off-
+  // diagonal e, or diagonal if e is null, as from the eigensolvers
+  auto CheckSym = [&]( Size n, const Scalar *A0, const Scalar *Q, Stride ld, const Scalar *d, const Scalar *e )
+  {
+    const auto x = Probe( n );
+    std::vector< Scalar > u( n ), v( n ), r( n );
+    Mat_VecMul< Lyt >( Trnsp::Yes, n, n, one, Q, ld, x.data(), 1, zero, u.data(), 1 );
+    for( Size i = 0; i < n; ++i )
+    {
+      v[i] = d[i]*u[i];
+      if( e && ( i > 0 ) ){ v[i] += e[i-1]*u[i-1]; }
+      if( e && ( i+1 < n ) ){ v[i] += e[i]*u[i+1]; }
+    }
+    Mat_VecMul< Lyt >( Trnsp::No, n, n, one, A0, ld, x.data(), 1, zero, r.data(), 1 );
+    Mat_VecMul< Lyt >( Trnsp::No, n, n, -one, Q, ld, v.data(), 1, one, r.data(), 1 );
+    return Max( Ratio( r, n, n, A0, x ), OrtRatio( n, n, Q, ld ) );
+  };
+
+  // A0 = Q*B*(~P), B upper bidiagonal with diagonal d and superdiagonal
+  // e, for m >= n
+  auto CheckBid = [&]( Size m, Size n, const Scalar *A0, const Scalar *Q, const Scalar *Pt, Stride ld,
+    const Scalar *d, const Scalar *e )
+  {
+    const auto x = Probe( n );
+    std::vector< Scalar > u( n ), v( n ), r( m );
+    Mat_VecMul< Lyt >( Trnsp::No, n, n, one, Pt, ld, x.data(), 1, zero, u.data(), 1 );
+    for( Size i = 0; i < n; ++i )
+    { v[i] = d[i]*u[i] + ( ( i+1 < n ) ? e[i]*u[i+1] : zero ); }
+    Mat_VecMul< Lyt >( Trnsp::No, m, n, one, A0, ld, x.data(), 1, zero, r.data(), 1 );
+    Mat_VecMul< Lyt >( Trnsp::No, m, n, -one, Q, ld, v.data(), 1, one, r.data(), 1 );
+    return Max( Max( Ratio( r, m, n, A0, x ), OrtRatio( m, n, Q, ld ) ), OrtRatio( n, n, Pt, ld ) );
+  };
+
+  // A0 = L*(~L), with L in the lower half of F
+  auto CheckChol = [&]( Size n, const Scalar *A0, const Scalar *F, Stride ld )
+  {
+    const auto x = Probe( n );
+    auto r = x;
+    Tri_VecMul< Lyt >( Half::Lower, Trnsp::Yes, Diag::NotUnit, n, F, ld, r.data(), 1 );
+    Tri_VecMul< Lyt >( Half::Lower, Trnsp::No, Diag::NotUnit, n, F, ld, r.data(), 1 );
+    Mat_VecMul< Lyt >( Trnsp::No, n, n, one, A0, ld, x.data(), 1, -one, r.data(), 1 );
+    return Ratio( r, n, n, A0, x );
+  };
+
+  // A0 = U*S*Vt, for the m by k U, the k by n Vt and the k singular
+  // values s; Vt must have orthonormal rows as U has columns
+  auto CheckSVD = [&]( Size m, Size n, Size k, const Scalar *A0, Stride ld,
+    const Scalar *U, Stride U_ld, const Scalar *s, const Scalar *Vt, Stride Vt_ld )
+  {
+    const auto x = Probe( n );
+    std::vector< Scalar > u( k ), r( m );
+    Mat_VecMul< Lyt >( Trnsp::No, k, n, one, Vt, Vt_ld, x.data(), 1, zero, u.data(), 1 );
+    for( Size i = 0; i < k; ++i ){ u[i] *= s[i]; }
+    Mat_VecMul< Lyt >( Trnsp::No, m, n, one, A0, ld, x.data(), 1, zero, r.data(), 1 );
+    Mat_VecMul< Lyt >( Trnsp::No, m, k, -one, U, U_ld, u.data(), 1, one, r.data(), 1 );
+
+    const auto y = Probe( k );
+    std::vector< Scalar > v( n ), z = y;
+    Mat_VecMul< Lyt >( Trnsp::Yes, k, n, one, Vt, Vt_ld, y.data(), 1, zero, v.data(), 1 );
+    Mat_VecMul< Lyt >( Trnsp::No, k, n, one, Vt, Vt_ld, v.data(), 1, -one, z.data(), 1 );
+    const double rows = Norm( k, z.data() )/( (double)n*Norm( k, y.data() )*eps );
+
+    return Max( Max( Ratio( r, m, n, A0, x ), OrtRatio( m, k, U, U_ld ) ), rows );
+  };
+
+  // Difference of the eigenvalues w from those of w0, in any order
+  auto DiffEig = [&]( std::vector< Scalar > w, std::vector< Scalar > w0 )
+  {
+    std::sort( w.begin(), w.end() );
+    std::sort( w0.begin(), w0.end() );
+    double diff = 0, norm = 0;
+    for( Size i = 0; i < w0.size(); ++i )
+    {
+      diff = Max( diff, (double)Abs( w[i] - w0[i] ) );
+      norm = Max( norm, (double)Abs( w0[i] ) );
+    }
+    return diff/( (double)w0.size()*norm*eps );
+  };
+
+#ifdef IND_BENCH_SYSLIB
+  constexpr bool sys = isColMajor< Lyt >;
+  using F = Sys::Fn< Scalar >;
+#endif
+
+  for( const Size n : opt.sizes )
+  {
+    const Size m = opt.aspect*n;
+    const double dm = (double)m, dn = (double)n;
+
+    // Working copies, refreshed before each run
+    std::vector< Scalar > A, W;
+
+    if( Wanted( "Mat_MatMul" ) )
+    {
+      const Size k = n;
+      const auto A0 = Random( m*k ), B0 = Random( k*n );
+      std::vector< Scalar > C( m*n );
+      const double flops = 2*dm*dn*(double)k;
+      const double bytes = sz*( (double)( m*k + k*n ) + 2*dm*dn );
+
+      const double t = BestTime( opt.reps, []{}, [&]
+      {
+        Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, m, n, k, Scalar{ 1 },
+          A0.data(), Lyt::DenseLd( m, k ), B0.data(), Lyt::DenseLd( k, n ),
+          Scalar{}, C.data(), Lyt::DenseLd( m, n ) );
+      } );
+      auto Check = [&]
+      {
+        // A0*(B0*x) - C*x
+        const auto x = Probe( n );
+        std::vector< Scalar > u( k ), r( m );
+        Mat_VecMul< Lyt >( Trnsp::No, k, n, one, B0.data(), Lyt::DenseLd( k, n ), x.data(), 1, zero, u.data(), 1 );
+        Mat_VecMul< Lyt >( Trnsp::No, m, k, one, A0.data(), Lyt::DenseLd( m, k ), u.data(), 1, zero, r.data(), 1 );
+        Mat_VecMul< Lyt >( Trnsp::No, m, n, -one, C.data(), Lyt::DenseLd( m, n ), x.data(), 1, one, r.data(), 1 );
+        return Norm( m, r.data() )/( (double)k*Norm( m*k, A0.data() )*Norm( k*n, B0.data() )*Norm( n, x.data() )*eps );
+      };
+      Add( "Mat_MatMul", "ind", m, n, k, t, flops, bytes, opt.check ? Check() : -1 );
+
+#ifdef IND_BENCH_SYSLIB
+      if constexpr( sys )
+      {
+        const int im = (int)m, in = (int)n, ik = (int)k;
+        const Scalar one = 1, zero = 0;
+        const double ts = BestTime( opt.reps, []{}, [&]
+        { F::gemm( "N", "N", &im, &in, &ik, &one, A0.data(), &im, B0.data(), &ik, &zero, C.data(), &im ); } );
+        Add( "Mat_MatMul", "sys", m, n, k, ts, flops, bytes, opt.check ? Check() : -1 );
+      }
+#endif
+    }
+
+    if( Wanted( "Mat_Fctr_LU" ) )
+    {
+      const auto A0 = Random( n*n );
+      std::vector< Index > piv( n );
+      const double flops = 2.0/3.0*dn*dn*dn;
+      const double bytes = sz*2*dn*dn;
+      const Stride ld = Lyt::DenseLd( n, n );
+
+      const double t = BestTime( opt.reps, [&]{ A = A0; }, [&]
+      { Mat_Fctr_LU< Lyt >( n, n, A.data(), ld, piv.data(), Exec_Seq{} ); } );
+      Add( "Mat_Fctr_LU", "ind", n, n, 0, t, flops, bytes,
+        opt.check ? CheckLU( n, A0.data(), A.data(), ld, piv.data() ) : -1 );
+
+#ifdef IND_BENCH_SYSLIB
+      if constexpr( sys )
+      {
+        const int in = (int)n;
+        std::vector< int > ipiv( n );
+        int info = 0;
+        const double ts = BestTime( opt.reps, [&]{ A = A0; }, [&]
+        { F::getrf( &in, &in, A.data(), &in, ipiv.data(), &info ); } );
+        for( Size i = 0; i < n; ++i ){ piv[i] = ipiv[i]-1; }
+        Add( "Mat_Fctr_LU", "sys", n, n, 0, ts, flops, bytes,
+          opt.check ? CheckLU( n, A0.data(), A.data(), ld, piv.data() ) : -1 );
+      }
+#endif
+    }
+
+    if( Wanted( "Sym_Fctr_Chol" ) )
+    {
+      // Diagonally dominant, so positive definite
+      auto A0 = RandomSym( n );
+      for( Size i = 0; i < n; ++i ){ A0[ i + i*n ] += (Scalar)n; }
+      const Stride ld = Lyt::DenseLd( n, n );
+      const double flops = 1.0/3.0*dn*dn*dn;
+      const double bytes = sz*dn*dn;
+
+      auto Time = [&]( const char *routine, auto &&fctr )
+      {
+        const double t = BestTime( opt.reps, [&]{ A = A0; }, fctr );
+        Add( routine, "ind", n, n, 0, t, flops, bytes,
+          opt.check ? CheckChol( n, A0.data(), A.data(), ld ) : -1 );
+      };
+
+      Time( "Sym_Fctr_Chol", [&]{ Sym_Fctr_Chol< Lyt >( Half::Lower, n, A.data(), ld ); } );
+      Time( "Sym_Fctr_Chol_Blk", [&]{ Sym_Fctr_Chol_Blk< Lyt >( Half::Lower, n, A.data(), ld ); } );
+      Time( "Sym_Fctr_Chol_Par", [&]{ Sym_Fctr_Chol_Par< Lyt >( Half::Lower, n, A.data(), ld ); } );
+    }
+
+    if( Wanted( "Mat_Solv_Refined" ) )
+    {
+      // Factored in Float32 whatever Scalar is, so for Float32 the
+      // refinement has nothing to gain
+      const auto A0 = Random( n*n ), b = Random( n );
+      std::vector< Scalar > x( n );
+      std::vector< Float32 > SW( Mat_Solv_Refined_SWorkSize( n, 1 ) );
+      std::vector< Index > piv( n );
+      W.resize( Mat_Solv_Refined_WorkSize( n, 1 ) );
+      const Stride ld = Lyt::DenseLd( n, n ), b_ld = Lyt::DenseLd( n, 1 );
+      const double flops = 2.0/3.0*dn*dn*dn;
+      const double bytes = sz*2*dn*dn;
+
+      const double t = BestTime( opt.reps, [&]{ A = A0; }, [&]
+      {
+        Mat_Solv_Refined< Lyt >( n, 1, A.data(), ld, piv.data(),
+          b.data(), b_ld, x.data(), b_ld, W.data(), SW.data() );
+      } );
+      auto Check = [&]
+      {
+        // A0*x - b
+        std::vector< Scalar > r = b;
+        Mat_VecMul< Lyt >( Trnsp::No, n, n, one, A0.data(), ld, x.data(), 1, -one, r.data(), 1 );
+        return Ratio( r, n, n, A0.data(), x );
+      };
+      Add( "Mat_Solv_Refined", "ind", n, n, 0, t, flops, bytes, opt.check ? Check() : -1 );
+    }
+
+    if( Wanted( "Mat_Fctr_QR" ) || Wanted( "Ort_From_QR" ) )
+    {
+      const auto A0 = Random( m*n );
+      std::vector< Scalar > tau( n );
+      W.resize( Max( Mat_Fctr_QR_Blk_WorkSize( m, n ), Ort_From_QR_Blk_WorkSize( m, n, n ) ) );
+      const Stride ld = Lyt::DenseLd( m, n );
+      const double flops = 2*dm*dn*dn - 2.0/3.0*dn*dn*dn;
+      const double bytes = sz*2*dm*dn;
+
+      const double t = BestTime( opt.reps, [&]{ A = A0; }, [&]
+      { Mat_Fctr_QR_Blk< Lyt >( m, n, A.data(), ld, tau.data(), W.data() ); } );
+
+      // A holds the reflectors of the last run
+      const auto QR0 = A;
+      const double qflops = 4*dm*dn*dn - 2*( dm + dn )*dn*dn + 4.0/3.0*dn*dn*dn;
+      const double tq = BestTime( opt.reps, [&]{ A = QR0; }, [&]
+      { Ort_From_QR_Blk< Lyt >( m, n, n, A.data(), ld, tau.data(), W.data() ); } );
+
+      const double resid = opt.check ? CheckQR( m, n, A0.data(), QR0.data(), A.data(), ld, nullptr ) : -1;
+      if( Wanted( "Mat_Fctr_QR" ) )
+      { Add( "Mat_Fctr_QR_Blk", "ind", m, n, 0, t, flops, bytes, resid ); }
+      if( Wanted( "Ort_From_QR" ) )
+      { Add( "Ort_From_QR_Blk", "ind", m, n, n, tq, qflops, bytes, resid ); }
+
+#ifdef IND_BENCH_SYSLIB
+      if constexpr( sys )
+      {
+        const int im = (int)m, in = (int)n;
+        int info = 0;
+        const int lw = Max( Sys::QueryWork< Scalar >( [&]( Scalar *w, int l )
+          { F::geqrf( &im, &in, A.data(), &im, tau.data(), w, &l, &info ); } ),
+          Sys::QueryWork< Scalar >( [&]( Scalar *w, int l )
+          { F::orgqr( &im, &in, &in, A.data(), &im, tau.data(), w, &l, &info ); } ) );
+        std::vector< Scalar > sw( lw );
+
+        const double ts = BestTime( opt.reps, [&]{ A = A0; }, [&]
+        { F::geqrf( &im, &in, A.data(), &im, tau.data(), sw.data(), &lw, &info ); } );
+
+        const auto SQR0 = A;
+        const double tsq = BestTime( opt.reps, [&]{ A = SQR0; }, [&]
+        { F::orgqr( &im, &in, &in, A.data(), &im, tau.data(), sw.data(), &lw, &info ); } );
+
+        const double sresid = opt.check ? CheckQR( m, n, A0.data(), SQR0.data(), A.data(), ld, nullptr ) : -1;
+        if( Wanted( "Mat_Fctr_QR" ) )
+        { Add( "Mat_Fctr_QR_Blk", "sys", m, n, 0, ts, flops, bytes, sresid ); }
+        if( Wanted( "Ort_From_QR" ) )
+        { Add( "Ort_From_QR_Blk", "sys", m, n, n, tsq, qflops, bytes, sresid ); }
+      }
+#endif
+    }
+
+    if( Wanted( "Mat_Solv_LS" ) )
+    {
+      const auto A0 = Random( m*n ), b = Random( m );
+      std::vector< Scalar > tau( n ), B;
+      W.resize( Max( Mat_Fctr_LS_WorkSize( m, n ), Mat_Solv_LS_WorkSize( m, n, 1 ) ) );
+      const Stride ld = Lyt::DenseLd( m, n ), B_ld = Lyt::DenseLd( m, 1 );
+      const double flops = 2*dm*dn*dn - 2.0/3.0*dn*dn*dn;
+      const double bytes = sz*2*dm*dn;
+
+      const double t = BestTime( opt.reps, [&]{ A = A0; B = b; }, [&]
+      {
+        Mat_Fctr_LS< Lyt >( m, n, A.data(), ld, tau.data(), W.data() );
+        Mat_Solv_LS< Lyt >( m, n, 1, A.data(), ld, tau.data(), B.data(), B_ld, W.data() );
+      } );
+      auto Check = [&]
+      {
+        // The residual of the least squares solution need not be
+        // small, but it is orthogonal to the columns of A0:
+        // ||(~A0)*( b - A0*x )|| / ( Max(m,n)*||A0||*( ||A0||*||x|| + ||b|| )*eps )
+        const std::vector< Scalar > x( B.begin(), B.begin() + n );
+        std::vector< Scalar > r = b, g( n );
+        Mat_VecMul< Lyt >( Trnsp::No, m, n, -one, A0.data(), ld, x.data(), 1, one, r.data(), 1 );
+        Mat_VecMul< Lyt >( Trnsp::Yes, m, n, one, A0.data(), ld, r.data(), 1, zero, g.data(), 1 );
+        const double a = Norm( m*n, A0.data() );
+        return Norm( n, g.data() )/( dm*a*( a*Norm( n, x.data() ) + Norm( m, b.data() ) )*eps );
+      };
+      Add( "Mat_Solv_LS", "ind", m, n, 0, t, flops, bytes, opt.check ? Check() : -1 );
+    }
+
+    if( Wanted( "Mat_Fctr_QR_TS" ) )
+    {
+      // A tall-skinny panel, 16n by 32, so the leaves are split at all
+      // but the smallest sizes
+      const Size mt = 16*n, nt = Min( n, (Size)32 );
+      const double dmt = (double)mt, dnt = (double)nt;
+      const auto A0 = Random( mt*nt );
+      std::vector< Scalar > tau( Mat_Fctr_QR_TS_TauSize( mt, nt ) ), Q( mt*nt );
+      W.resize( Max( Mat_Fctr_QR_TS_WorkSize( mt, nt ), Ort_From_QR_TS_WorkSize( mt, nt ) ) );
+      const Stride ld = Lyt::DenseLd( mt, nt );
+      const double flops = 2*dmt*dnt*dnt - 2.0/3.0*dnt*dnt*dnt;
+      const double bytes = sz*2*dmt*dnt;
+
+      const double t = BestTime( opt.reps, [&]{ A = A0; }, [&]
+      { Mat_Fctr_QR_TS< Lyt >( mt, nt, A.data(), ld, tau.data(), W.data() ); } );
+      auto Check = [&]
+      {
+        Ort_From_QR_TS< Lyt >( mt, nt, A.data(), ld, tau.data(), Q.data(), ld, W.data() );
+        return CheckQR( mt, nt, A0.data(), A.data(), Q.data(), ld, nullptr );
+      };
+      Add( "Mat_Fctr_QR_TS", "ind", mt, nt, 0, t, flops, bytes, opt.check ? Check() : -1 );
+    }
+
+    if( Wanted( "Mat_Fctr_QRP" ) )
+    {
+      const auto A0 = Random( m*n );
+      std::vector< Scalar > tau( Min( m, n ) );
+      std::vector< Index > jpvt( n );
+      W.resize( Max( Max( Mat_Fctr_QRP_Blk_WorkSize( m, n ), Mat_Fctr_QRP_Rnd_WorkSize( m, n ) ),
+        Ort_From_QR_Blk_WorkSize( m, n, n ) ) );
+      const Stride ld = Lyt::DenseLd( m, n );
+      const double flops = 2*dm*dn*dn - 2.0/3.0*dn*dn*dn;
+      const double bytes = sz*2*dm*dn;
+
+      const double tb = BestTime( opt.reps, [&]{ A = A0; }, [&]
+      { Mat_Fctr_QRP_Blk< Lyt >( m, n, A.data(), ld, jpvt.data(), tau.data(), W.data() ); } );
+      // Q of the factors in A, for the check
+      auto Check = [&]
+      {
+        auto Q = A;
+        Ort_From_QR_Blk< Lyt >( m, n, n, Q.data(), ld, tau.data(), W.data() );
+        return CheckQR( m, n, A0.data(), A.data(), Q.data(), ld, jpvt.data() );
+      };
+      Add( "Mat_Fctr_QRP_Blk", "ind", m, n, 0, tb, flops, bytes, opt.check ? Check() : -1 );
+
+      const double tr = BestTime( opt.reps, [&]{ A = A0; }, [&]
+      { Mat_Fctr_QRP_Rnd< Lyt >( m, n, A.data(), ld, jpvt.data(), tau.data(), W.data() ); } );
+      Add( "Mat_Fctr_QRP_Rnd", "ind", m, n, 0, tr, flops, bytes, opt.check ? Check() : -1 );
+    }
+
+    if( Wanted( "Sym_Rdto_Syt" ) || Wanted( "Ort_From_Syt" ) || Wanted( "Syt_Eig" ) )
+    {
+      const auto A0 = RandomSym( n );
+      std::vector< Scalar > d( n ), e( n ), tau( n );
+      W.resize( Max( Sym_Rdto_Syt_Blk_WorkSize( n ), Ort_From_Syt_Blk_WorkSize( n ) ) );
+      const Stride ld = Lyt::DenseLd( n, n );
+      const double flops = 4.0/3.0*dn*dn*dn;
+      const double bytes = sz*2*dn*dn;
+
+      const double t = BestTime( opt.reps, [&]{ A = A0; }, [&]
+      { Sym_Rdto_Syt_Blk< Lyt >( Half::Lower, n, A.data(), ld, d.data(), e.data(), tau.data(), W.data() ); } );
+
+      const auto T0 = A;
+      const auto d0 = d, e0 = e;
+      const double tq = BestTime( opt.reps, [&]{ A = T0; }, [&]
+      { Ort_From_Syt_Blk< Lyt >( Half::Lower, n, A.data(), ld, tau.data(), W.data() ); } );
+
+      const double resid = opt.check ? CheckSym( n, A0.data(), A.data(), ld, d0.data(), e0.data() ) : -1;
+      if( Wanted( "Sym_Rdto_Syt" ) )
+      { Add( "Sym_Rdto_Syt_Blk", "ind", n, n, 0, t, flops, bytes, resid ); }
+      if( Wanted( "Ort_From_Syt" ) )
+      { Add( "Ort_From_Syt_Blk", "ind", n, n, 0, tq, flops, bytes, resid ); }
+
+      // The tridiagonal eigenproblems, on d0 and e0; the flop counts
+      // are nominal, as the work depends on the convergence. The
+      // eigenvalues alone are checked against those with the vectors.
+      const auto Q0 = A;
+      Syt_EigQR< Scalar > QR{};
+      const double te = BestTime( opt.reps, [&]{ d = d0; e = e0; }, [&]
+      { QR.template Solve< Lyt >( n, d.data(), e.data() ); } );
+      const auto wQR = d;
+
+      Syt_EigQD< Scalar > QD{};
+      std::vector< Scalar > DW( Syt_EigQD_WorkSize( n ) );
+      const double td = BestTime( opt.reps, [&]{ d = d0; e = e0; }, [&]
+      { QD.template Solve< Lyt >( n, d.data(), e.data(), DW.data() ); } );
+      const auto wQD = d;
+
+      Syt_EigVecQR< Scalar > VQR{};
+      std::vector< Scalar > VW( Syt_EigVecQR_WorkSize( n ) );
+      const double tv = BestTime( opt.reps, [&]{ d = d0; e = e0; A = Q0; }, [&]
+      { VQR.template Solve< Lyt >( n, d.data(), e.data(), A.data(), ld, VW.data() ); } );
+      const auto w0 = d;
+
+      if( Wanted( "Syt_EigQR" ) )
+      { Add( "Syt_EigQR", "ind", n, n, 0, te, 30*dn*dn, sz*4*dn, opt.check ? DiffEig( wQR, w0 ) : -1 ); }
+      if( Wanted( "Syt_EigQD" ) )
+      { Add( "Syt_EigQD", "ind", n, n, 0, td, 30*dn*dn, sz*6*dn, opt.check ? DiffEig( wQD, w0 ) : -1 ); }
+      if( Wanted( "Syt_EigVecQR" ) )
+      {
+        Add( "Syt_EigVecQR", "ind", n, n, 0, tv, 6*dn*dn*dn, sz*( 2*dn*dn + 4*dn ),
+          opt.check ? CheckSym( n, A0.data(), A.data(), ld, w0.data(), nullptr ) : -1 );
+      }
+
+      // Divide and conquer onto Q0, as Sym_Eig uses it; the flops are
+      // those of the merges without deflation
+      if( Wanted( "Syt_EigVecDC" ) )
+      {
+        Syt_EigVecDC< Scalar > DC{};
+        std::vector< Scalar > CW( Syt_EigVecDC_WorkSize( n ) );
+        const double tc = BestTime( opt.reps, [&]{ d = d0; e = e0; A = Q0; }, [&]
+        { DC.template Solve< Lyt >( n, d.data(), e.data(), A.data(), ld, CW.data() ); } );
+        Add( "Syt_EigVecDC", "ind", n, n, 0, tc, 4.0/3.0*dn*dn*dn, sz*( 2*dn*dn + 4*dn ),
+          opt.check ? CheckSym( n, A0.data(), A.data(), ld, d.data(), nullptr ) : -1 );
+      }
+
+      // Bisection and inverse iteration for the lowest tenth of the
+      // spectrum, its use; the pairs are probed through Q0 as
+      // A0*Q0*Z = Q0*Z*diag(w), for the n by k Z
+      if( Wanted( "Syt_EigVecBI" ) )
+      {
+        const Size k = Max( n/10, (Size)1 );
+        const double dk = (double)k;
+        Syt_EigVecBI< Scalar > BI{};
+        std::vector< Scalar > w( k ), Z( n*k ), BW( Syt_EigVecBI_WorkSize( n ) );
+        const Stride Z_ld = Lyt::DenseLd( n, k );
+        const double tb = BestTime( opt.reps, []{}, [&]
+        { BI.template Solve< Lyt >( n, d0.data(), e0.data(), 0, (Index)k-1, w.data(), Z.data(), Z_ld, BW.data() ); } );
+        auto Check = [&]
+        {
+          const auto x = Probe( k );
+          std::vector< Scalar > u( n ), v( n ), wx( k ), r( n );
+          for( Size i = 0; i < k; ++i ){ wx[i] = w[i]*x[i]; }
+          Mat_VecMul< Lyt >( Trnsp::No, n, k, one, Z.data(), Z_ld, x.data(), 1, zero, u.data(), 1 );
+          Mat_VecMul< Lyt >( Trnsp::No, n, n, one, Q0.data(), ld, u.data(), 1, zero, v.data(), 1 );
+          Mat_VecMul< Lyt >( Trnsp::No, n, n, one, A0.data(), ld, v.data(), 1, zero, r.data(), 1 );
+          Mat_VecMul< Lyt >( Trnsp::No, n, k, one, Z.data(), Z_ld, wx.data(), 1, zero, u.data(), 1 );
+          Mat_VecMul< Lyt >( Trnsp::No, n, n, -one, Q0.data(), ld, u.data(), 1, one, r.data(), 1 );
+          return Max( Ratio( r, n, n, A0.data(), x ), OrtRatio( n, k, Z.data(), Z_ld ) );
+        };
+        Add( "Syt_EigVecBI", "ind", n, n, k, tb, 30*dn*dk, sz*( dn*dk + 6*dn ), opt.check ? Check() : -1 );
+      }
+
+#ifdef IND_BENCH_SYSLIB
+      if constexpr( sys )
+      {
+        // LAPACK's lower half is our upper one, for the same data
+        const int in = (int)n;
+        int info = 0;
+        const int lw = Max( Sys::QueryWork< Scalar >( [&]( Scalar *w, int l )
+          { F::sytrd( "L", &in, A.data(), &in, d.data(), e.data(), tau.data(), w, &l, &info ); } ),
+          Sys::QueryWork< Scalar >( [&]( Scalar *w, int l )
+          { F::orgtr( "L", &in, A.data(), &in, tau.data(), w, &l, &info ); } ) );
+        std::vector< Scalar > sw( Max( lw, (int)( 2*n ) ) );
+
+        const double ts = BestTime( opt.reps, [&]{ A = A0; }, [&]
+        { F::sytrd( "L", &in, A.data(), &in, d.data(), e.data(), tau.data(), sw.data(), &lw, &info ); } );
+
+        const auto ST0 = A;
+        const double tsq = BestTime( opt.reps, [&]{ A = ST0; }, [&]
+        { F::orgtr( "L", &in, A.data(), &in, tau.data(), sw.data(), &lw, &info ); } );
+
+        const double sresid = opt.check ? CheckSym( n, A0.data(), A.data(), ld, d.data(), e.data() ) : -1;
+        if( Wanted( "Sym_Rdto_Syt" ) )
+        { Add( "Sym_Rdto_Syt_Blk", "sys", n, n, 0, ts, flops, bytes, sresid ); }
+        if( Wanted( "Ort_From_Syt" ) )
+        { Add( "Ort_From_Syt_Blk", "sys", n, n, 0, tsq, flops, bytes, sresid ); }
+
+        // The eigenvalues of the reference, against ours
+        const double tse = BestTime( opt.reps, [&]{ d = d0; e = e0; }, [&]
+        { F::sterf( &in, d.data(), e.data(), &info ); } );
+        if( Wanted( "Syt_EigQR" ) )
+        { Add( "Syt_EigQR", "sys", n, n, 0, tse, 30*dn*dn, sz*4*dn, opt.check ? DiffEig( d, w0 ) : -1 ); }
+
+        const double tsv = BestTime( opt.reps, [&]{ d = d0; e = e0; A = Q0; }, [&]
+        { F::steqr( "V", &in, d.data(), e.data(), A.data(), &in, sw.data(), &info ); } );
+        if( Wanted( "Syt_EigVecQR" ) )
+        {
+          Add( "Syt_EigVecQR", "sys", n, n, 0, tsv, 6*dn*dn*dn, sz*( 2*dn*dn + 4*dn ),
+            opt.check ? CheckSym( n, A0.data(), A.data(), ld, d.data(), nullptr ) : -1 );
+        }
+      }
+#endif
+    }
+
+    if( Wanted( "Sym_Eig" ) )
+    {
+      // The flops are nominal: the reduction, its Q, and the merges
+      // of Syt_EigVecDC without deflation
+      const auto A0 = RandomSym( n );
+      std::vector< Scalar > w( n );
+      const Stride ld = Lyt::DenseLd( n, n );
+      const double flops = 4*dn*dn*dn;
+      const double bytes = sz*2*dn*dn;
+
+      Sym_Eig< Scalar > eig{};
+      W.resize( eig.WorkSize( n ) );
+      const double t = BestTime( opt.reps, [&]{ A = A0; }, [&]
+      { eig.template Solve< Lyt >( Half::Lower, n, A.data(), ld, w.data(), W.data() ); } );
+      Add( "Sym_Eig", "ind", n, n, 0, t, flops, bytes,
+        opt.check ? CheckSym( n, A0.data(), A.data(), ld, w.data(), nullptr ) : -1 );
+
+      // The two-stage reduction at every order, on all the threads;
+      // on one thread Sym_Eig falls back to the one-stage reduction
+      typename Sym_Eig< Scalar >::Config config{};
+      config.twoStageMin = 0;
+      eig.SetConfig( config );
+      W.resize( eig.WorkSize( n ) );
+      Exec_Par exec{};
+      const double t2 = BestTime( opt.reps, [&]{ A = A0; }, [&]
+      { eig.template Solve< Lyt >( Half::Lower, n, A.data(), ld, w.data(), W.data(), exec ); } );
+      Add( "Sym_Eig_TwoStage", "ind", n, n, 0, t2, flops, bytes,
+        opt.check ? CheckSym( n, A0.data(), A.data(), ld, w.data(), nullptr ) : -1 );
+    }
+
+    if( Wanted( "Mat_Rdto_Bid" ) || Wanted( "Ort_From_Bid" ) )
+    {
+      const auto A0 = Random( m*n );
+      std::vector< Scalar > d( n ), e( n ), tauq( n ), taup( n );
+      W.resize( Max( Mat_Rdto_Bid_Blk_WorkSize( m, n ), Max( Ort_From_Bid_Blk_WorkSize( Vect::Q, m, n, n ),
+        Ort_From_Bid_Blk_WorkSize( Vect::Pt, n, n, m ) ) ) );
+      const Stride ld = Lyt::DenseLd( m, n );
+      const double flops = 4*dm*dn*dn - 4.0/3.0*dn*dn*dn;
+      const double bytes = sz*2*dm*dn;
+
+      const double t = BestTime( opt.reps, [&]{ A = A0; }, [&]
+      { Mat_Rdto_Bid_Blk< Lyt >( m, n, A.data(), ld, d.data(), e.data(), tauq.data(), taup.data(), W.data() ); } );
+
+      // Q of the bidiagonal reduction, as dorgbr with vect = 'Q'
+      const auto B0 = A;
+      const double qflops = 4*dm*dn*dn - 2*( dm + dn )*dn*dn + 4.0/3.0*dn*dn*dn;
+      const double tq = BestTime( opt.reps, [&]{ A = B0; }, [&]
+      { Ort_From_Bid_Blk< Lyt >( Vect::Q, m, n, n, A.data(), ld, tauq.data(), W.data() ); } );
+
+      // P**T, in the leading n by n block of a copy, for the check
+      auto Check = [&]
+      {
+        auto Pt = B0;
+        Ort_From_Bid_Blk< Lyt >( Vect::Pt, n, n, m, Pt.data(), ld, taup.data(), W.data() );
+        return CheckBid( m, n, A0.data(), A.data(), Pt.data(), ld, d.data(), e.data() );
+      };
+      const double resid = opt.check ? Check() : -1;
+      if( Wanted( "Mat_Rdto_Bid" ) )
+      { Add( "Mat_Rdto_Bid_Blk", "ind", m, n, 0, t, flops, bytes, resid ); }
+      if( Wanted( "Ort_From_Bid" ) )
+      { Add( "Ort_From_Bid_Blk", "ind", m, n, n, tq, qflops, bytes, resid ); }
+
+#ifdef IND_BENCH_SYSLIB
+      if constexpr( sys )
+      {
+        const int im = (int)m, in = (int)n;
+        int info = 0;
+        const int lw = Sys::QueryWork< Scalar >( [&]( Scalar *w, int l )
+          { F::gebrd( &im, &in, A.data(), &im, d.data(), e.data(), tauq.data(), taup.data(), w, &l, &info ); } );
+        std::vector< Scalar > sw( lw );
+
+        const double ts = BestTime( opt.reps, [&]{ A = A0; }, [&]
+        { F::gebrd( &im, &in, A.data(), &im, d.data(), e.data(), tauq.data(), taup.data(), sw.data(), &lw, &info ); } );
+        if( Wanted( "Mat_Rdto_Bid" ) )
+        { Add( "Mat_Rdto_Bid_Blk", "sys", m, n, 0, ts, flops, bytes ); }
+      }
+#endif
+    }
+
+    if( Wanted( "Mat_SVD" ) )
+    {
+      // Thin, for m >= n; the flops are those of the R-SVD with U and
+      // V in Golub and Van Loan
+      const auto A0 = Random( m*n );
+      std::vector< Scalar > s( n ), U( m*n ), Vt( n*n );
+      W.resize( Mat_SVD_WorkSize( Job::Thin, m, n ) );
+      const Stride ld = Lyt::DenseLd( m, n ), Vt_ld = Lyt::DenseLd( n, n );
+      const double flops = 6*dm*dn*dn + 20*dn*dn*dn;
+      const double bytes = sz*( 2*dm*dn + dn*dn );
+
+      Mat_SVD< Scalar > SVD{};
+      const double t = BestTime( opt.reps, [&]{ A = A0; }, [&]
+      { SVD.template Solve< Lyt >( Job::Thin, m, n, A.data(), ld, s.data(), U.data(), ld, Vt.data(), Vt_ld, W.data() ); } );
+      Add( "Mat_SVD", "ind", m, n, 0, t, flops, bytes,
+        opt.check ? CheckSVD( m, n, n, A0.data(), ld, U.data(), ld, s.data(), Vt.data(), Vt_ld ) : -1 );
+    }
+
+    if( Wanted( "Mat_SVD_Rnd" ) )
+    {
+      // A0 of rank k = n/8, the product of random m by k and k by n
+      // matrices, so its rank-k approximation is exact; the flops are
+      // nominal, those of the two passes over A0
+      const Size k = Max( n/8, (Size)1 );
+      const double dk = (double)k;
+      const auto G = Random( m*k ), H = Random( k*n );
+      std::vector< Scalar > A0( m*n ), s( k ), U( m*k ), Vt( k*n );
+      const Stride ld = Lyt::DenseLd( m, n ), U_ld = Lyt::DenseLd( m, k ), Vt_ld = Lyt::DenseLd( k, n );
+      Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, m, n, k, one, G.data(), U_ld, H.data(), Vt_ld, zero, A0.data(), ld );
+      const double flops = 4*dm*dn*dk;
+      const double bytes = sz*( 2*dm*dn + ( dm + dn )*dk );
+
+      Mat_SVD_Rnd< Scalar > SVD{};
+      W.resize( SVD.WorkSize( m, n, k ) );
+      const double t = BestTime( opt.reps, [&]{ A = A0; }, [&]
+      { SVD.template Solve< Lyt >( Job::Thin, m, n, k, A.data(), ld, s.data(), U.data(), U_ld, Vt.data(), Vt_ld, W.data() ); } );
+      Add( "Mat_SVD_Rnd", "ind", m, n, k, t, flops, bytes,
+        opt.check ? CheckSVD( m, n, k, A0.data(), ld, U.data(), U_ld, s.data(), Vt.data(), Vt_ld ) : -1 );
+    }
+  }
+}
+
+// Autotuner: searches the block sizes and crossovers read by the
+// Tuned() configurations (see Aux_Tuning) for Scalar, in ColMajor
+// layout, and sets them in tuning. The block sizes are searched one at
+// a time at the largest of the sizes, each from the best of the ones
+// before; the crossovers are the first order at which the alternative
+// is faster, over a sweep of orders.
+template< typename Scalar >
+void Tune( const Options &opt, Aux_Tuning &tuning )
+{
+  using Lyt = ColMajor;
+
+  std::mt19937 gen{ 1 };
+  std::uniform_real_distribution< Scalar > dist{ -1, 1 };
+
+  auto Random = [&]( Size count )
+  {
+    std::vector< Scalar > v( count );
+    for( auto &x : v ){ x = dist( gen ); }
+    return v;
+  };
+
+  auto RandomSym = [&]( Size n )
+  {
+    auto A = Random( n*n );
+    for( Index j = 0; j < (Index)n; ++j )
+    {
+      for( Index i = j+1; i < (Index)n; ++i )
+      { A[ i + j*n ] = A[ j + i*n ]; }
+    }
+    return A;
+  };
+
+  auto Found = [&]( const char *key, Size value )
+  {
+    tuning.Set< Scalar >( key, value );
+    std::cerr << scalarName< Scalar > << ' ' << key << " = " << value << std::endl;
+    return value;
+  };
+
+  // The candidate of the least time( candidate )
+  auto Best = [&]( const char *key, const std::vector< Size > &candidates, auto &&time )
+  {
+    Size best = candidates[0];
+    double tbest = 0;
+    for( const Size c : candidates )
+    {
+      const double t = time( c );
+      if( ( c == candidates[0] ) || ( t < tbest ) ){ best = c; tbest = t; }
+    }
+    return Found( key, best );
+  };
+
+  // The first order at which alt( n ) is faster than base( n ), or
+  // fallback if it is at none of them
+  auto Crossover = [&]( const std::vector< Size > &orders, Size fallback, auto &&base, auto &&alt )
+  {
+    for( const Size order : orders )
+    {
+      if( alt( order ) < base( order ) ){ return order; }
+    }
+    return fallback;
+  };
+
+  const Size n = *std::max_element( opt.sizes.begin(), opt.sizes.end() );
+
+  // Mat_MatMul, cache blocking of the packed engine
+  {
+    using Config = Aux_PkdMatMul_Config< Scalar >;
+
+    const auto A0 = Random( n*n ), B0 = Random( n*n );
+    std::vector< Scalar > C( n*n );
+    auto blk = Aux_PkdMatMul_GetBlocking< Scalar >();
+
+    auto Gemm = [&]( Size s )
+    {
+      return BestTime( opt.reps, []{}, [&]
+      {
+        Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, s, s, s, Scalar{ 1 },
+          A0.data(), (Stride)s, B0.data(), (Stride)s, Scalar{}, C.data(), (Stride)s );
+      } );
+    };
+
+    auto With = [&]( Size &field )
+    {
+      return [&]( Size c )
+      {
+        field = c;
+        Aux_PkdMatMul_SetBlocking< Scalar >( blk );
+        return Gemm( n );
+      };
+    };
+
+    blk.kc = Best( "Mat_MatMul.kc", { 128, 192, 256, 384, 512 }, With( blk.kc ) );
+    blk.mc = Best( "Mat_MatMul.mc", { 4*Config::mr, 8*Config::mr, 12*Config::mr, 16*Config::mr,
+      24*Config::mr, 32*Config::mr }, With( blk.mc ) );
+    blk.nc = Best( "Mat_MatMul.nc", { 128*Config::nr, 256*Config::nr, 512*Config::nr,
+      1024*Config::nr, 2048*Config::nr }, With( blk.nc ) );
+    Aux_PkdMatMul_SetBlocking< Scalar >( blk );
+
+    // The smallest cube the packed engine is faster on
+    auto Packed = [&]( bool on )
+    {
+      return [&, on]( Size s )
+      {
+        blk.minVolume = on ? 0 : ~(Size)0;
+        Aux_PkdMatMul_SetBlocking< Scalar >( blk );
+        return Gemm( s );
+      };
+    };
+    const Size s = Crossover( { 8, 12, 16, 24, 32, 48, 64 }, 64, Packed( false ), Packed( true ) );
+    blk.minVolume = Found( "Mat_MatMul.minVolume", s*s*s );
+    Aux_PkdMatMul_SetBlocking< Scalar >( blk );
+  }
+
+  // Mat_Fctr_LU, panel width
+  {
+    const auto A0 = Random( n*n );
+    std::vector< Scalar > A;
+    std::vector< Index > piv( n );
+
+    Best( "Mat_Fctr_LU.nb", { 16, 32, 48, 64, 96, 128, 192, 256 }, [&]( Size nb )
+    {
+      Mat_Fctr_LU_Config config{};
+      config.nb = nb;
+      return BestTime( opt.reps, [&]{ A = A0; }, [&]
+      { Mat_Fctr_LU_Blk< Lyt >( n, n, A.data(), (Stride)n, piv.data(), config ); } );
+    } );
+  }
+
+  // Sym_Eig, panel width of the one-stage reduction, sweep batch of
+  // Syt_EigVecQR and leaf size of Syt_EigVecDC, then the crossovers
+  {
+    auto Eig = [&]( Size order, const typename Sym_Eig< Scalar >::Config &config, bool par = false )
+    {
+      const auto A0 = RandomSym( order );
+      std::vector< Scalar > A, w( order );
+      Sym_Eig< Scalar > eig{};
+      eig.SetConfig( config );
+      Exec_Par exec{};
+      return BestTime( opt.reps, [&]{ A = A0; }, [&]
+      {
+        if( par ){ eig.template Solve< Lyt >( Half::Lower, order, A.data(), (Stride)order, w.data(), exec ); }
+        else{ eig.template Solve< Lyt >( Half::Lower, order, A.data(), (Stride)order, w.data() ); }
+      } );
+    };
+
+    typename Sym_Eig< Scalar >::Config config{};
+
+    config.nb = Best( "Sym_Eig.nb", { 16, 24, 32, 48, 64, 96 }, [&]( Size nb )
+    {
+      auto c = config;
+      c.nb = nb;
+      c.dcMin = ~(Size)0;
+      return Eig( n, c );
+    } );
+
+    config.qr.sweepBatch = Best( "Syt_EigVecQR.sweepBatch", { 1, 2, 4, 8, 16 }, [&]( Size b )
+    {
+      auto c = config;
+      c.qr.sweepBatch = b;
+      c.dcMin = ~(Size)0;
+      return Eig( n, c );
+    } );
+
+    config.dc.leafSize = Best( "Syt_EigVecDC.leafSize", { 16, 25, 32, 48, 64 }, [&]( Size leaf )
+    {
+      auto c = config;
+      c.dc.leafSize = leaf;
+      c.dcMin = 0;
+      return Eig( n, c );
+    } );
+
+    config.dcMin = Found( "Sym_Eig.dcMin", Crossover( { 16, 24, 32, 48, 64, 96, 128, 192, 256 }, 256,
+      [&]( Size order ){ auto c = config; c.dcMin = ~(Size)0; return Eig( order, c ); },
+      [&]( Size order ){ auto c = config; c.dcMin = 0; return Eig( order, c ); } ) );
+
+    // The two-stage reduction only pays off on large orders, and only
+    // takes place on more than one thread, so the crossover is searched
+    // from 512 up to the largest of the sizes, with all of them.
+    std::vector< Size > orders;
+    for( Size order = 512; order <= n; order *= 2 ){ orders.push_back( order ); }
+
+    Found( "Sym_Eig.twoStageMin", Crossover( orders, Sym_Eig_TwoStageMin,
+      [&]( Size order ){ auto c = config; c.twoStageMin = ~(Size)0; return Eig( order, c, true ); },
+      [&]( Size order ){ auto c = config; c.twoStageMin = 0; return Eig( order, c, true ); } ) );
+  }
+}
+
+void Write( std::ostream &os, const std::vector< Record > &records, bool json )
+{
+  char line[512];
+
+  if( json ){ os << "[\n"; }else
+  { os << "routine,impl,scalar,layout,m,n,k,seconds,gflops,bytes,gbytes_per_s,resid\n"; }
+
+  for( Size r = 0; r < records.size(); ++r )
+  {
+    const auto &x = records[r];
+    const double gflops = ( x.seconds > 0 ) ? x.flops/x.seconds*1e-9 : 0;
+    const double gbps = ( x.seconds > 0 ) ? x.bytes/x.seconds*1e-9 : 0;
+
+    if( json )
+    {
+      std::snprintf( line, sizeof( line ),
+        "  {\"routine\":\"%s\",\"impl\":\"%s\",\"scalar\":\"%s\",\"layout\":\"%s\","
+        "\"m\":%zu,\"n\":%zu,\"k\":%zu,\"seconds\":%.6g,\"gflops\":%.4g,\"bytes\":%.6g,\"gbytes_per_s\":%.4g,"
+        "\"resid\":%.4g}%s\n",
+        x.routine.c_str(), x.impl, x.scalar, x.layout, (size_t)x.m, (size_t)x.n, (size_t)x.k,
+        x.seconds, gflops, x.bytes, gbps, x.resid, ( r+1 < records.size() ) ? "," : "" );
+    }
+    else
+    {
+      std::snprintf( line, sizeof( line ), "%s,%s,%s,%s,%zu,%zu,%zu,%.6g,%.4g,%.6g,%.4g,%.4g\n",
+        x.routine.c_str(), x.impl, x.scalar, x.layout, (size_t)x.m, (size_t)x.n, (size_t)x.k,
+        x.seconds, gflops, x.bytes, gbps, x.resid );
+    }
+    os << line;
+  }
+
+  if( json ){ os << "]\n"; }
+}
+
+// Checks the records against --tol and the baseline, if any, and
+// writes each failure to err; returns the count of failures. The
+// baseline is CSV as written by Write, its columns found by the names
+// in its header, so files from before the resid column are read too.
+Size Compare( const Options &opt, const std::vector< Record > &records, std::ostream &err )
+{
+  auto Key = [&]( const std::string &routine, const std::string &impl, const std::string &scalar,
+    const std::string &layout, Size m, Size n, Size k )
+  {
+    return routine + "," + impl + "," + scalar + "," + layout + ","
+      + std::to_string( m ) + "," + std::to_string( n ) + "," + std::to_string( k );
+  };
+
+  std::vector< std::pair< std::string, double > > base;
+  if( ! opt.baseline.empty() )
+  {
+    std::ifstream file{ opt.baseline };
+    if( ! file )
+    {
+      err << "bench: cannot read baseline " << opt.baseline << std::endl;
+      return 1;
+    }
+
+    auto Split = []( const std::string &line )
+    {
+      std::vector< std::string > cells;
+      std::stringstream ss{ line };
+      for( std::string cell; std::getline( ss, cell, ',' ); ){ cells.push_back( cell ); }
+      return cells;
+    };
+
+    std::string line;
+    std::getline( file, line );
+    const auto header = Split( line );
+    auto Column = [&]( const char *name ) -> Size
+    { return std::find( header.begin(), header.end(), name ) - header.begin(); };
+
+    const Size cols[] = { Column( "routine" ), Column( "impl" ), Column( "scalar" ), Column( "layout" ),
+      Column( "m" ), Column( "n" ), Column( "k" ), Column( "seconds" ) };
+    const Size ncol = *std::max_element( std::begin( cols ), std::end( cols ) );
+    if( ncol >= header.size() )
+    {
+      err << "bench: baseline " << opt.baseline << " is not bench CSV" << std::endl;
+      return 1;
+    }
+
+    while( std::getline( file, line ) )
+    {
+      if( ! line.empty() && ( '\r' == line.back() ) ){ line.pop_back(); }
+      const auto c = Split( line );
+      if( c.size() <= ncol ){ continue; }
+      base.push_back( { Key( c[cols[0]], c[cols[1]], c[cols[2]], c[cols[3]],
+        (Size)std::stoull( c[cols[4]] ), (Size)std::stoull( c[cols[5]] ), (Size)std::stoull( c[cols[6]] ) ),
+        std::stod( c[cols[7]] ) } );
+    }
+  }
+
+  Size failures = 0;
+  char line[512];
+
+  for( const auto &x : records )
+  {
+    if( x.resid > opt.tol )
+    {
+      std::snprintf( line, sizeof( line ), "CHECK FAILED %s %s %s %s m=%zu n=%zu k=%zu: resid %.4g > %.4g\n",
+        x.routine.c_str(), x.impl, x.scalar, x.layout, (size_t)x.m, (size_t)x.n, (size_t)x.k, x.resid, opt.tol );
+      err << line;
+      ++failures;
+    }
+
+    const auto key = Key( x.routine, x.impl, x.scalar, x.layout, x.m, x.n, x.k );
+    const auto b = std::find_if( base.begin(), base.end(), [&]( const auto &y ){ return y.first == key; } );
+    if( ( base.end() == b ) || ( b->second <= 0 ) ){ continue; }
+
+    // Throughput relative to the baseline, at the same flop count
+    const double ratio = ( x.seconds > 0 ) ? b->second/x.seconds : 1;
+    if( ratio < 1 - opt.threshold )
+    {
+      std::snprintf( line, sizeof( line ), "REGRESSION %s %s %s %s m=%zu n=%zu k=%zu: %.6g s per call, %.6g s in the baseline (%+.1f%% throughput)\n",
+        x.routine.c_str(), x.impl, x.scalar, x.layout, (size_t)x.m, (size_t)x.n, (size_t)x.k,
+        x.seconds, b->second, 100*( ratio - 1 ) );
+      err << line;
+      ++failures;
+    }
+  }
+
+  return failures;
+}
+
+int main( int argc, char **argv )
+{
+  Options opt;
+
+  for( int a = 1; a < argc; ++a )
+  {
+    const std::string arg = argv[a];
+    const char *val = ( a+1 < argc ) ? argv[a+1] : nullptr;
+
+    if( ( "--sizes" == arg ) && val )
+    {
+      opt.sizes.clear();
+      for( const char *p = val; *p; )
+      {
+        char *q = nullptr;
+        opt.sizes.push_back( (Size)std::strtoul( p, &q, 10 ) );
+        p = ( ',' == *q ) ? q+1 : q;
+        if( q == p ){ break; }
+      }
+      ++a;
+    }
+    else if( ( "--aspect" == arg ) && val ){ opt.aspect = Max( (Size)std::strtoul( val, nullptr, 10 ), (Size)1 ); ++a; }
+    else if( ( "--reps" == arg ) && val ){ opt.reps = (Size)std::strtoul( val, nullptr, 10 ); ++a; }
+    else if( ( "--only" == arg ) && val ){ opt.only = val; ++a; }
+    else if( ( "--scalar" == arg ) && val )
+    {
+      opt.float32 = ( 0 == std::strcmp( val, "float" ) );
+      opt.float64 = ( 0 == std::strcmp( val, "double" ) );
+      ++a;
+    }
+    else if( ( "--layout" == arg ) && val )
+    {
+      opt.colMajor = ( 0 == std::strcmp( val, "col" ) );
+      opt.rowMajor = ( 0 == std::strcmp( val, "row" ) );
+      ++a;
+    }
+    else if( "--json" == arg ){ opt.json = true; }
+    else if( ( "--out" == arg ) && val ){ opt.out = val; ++a; }
+    else if( ( "--tune" == arg ) && val ){ opt.tune = val; ++a; }
+    else if( "--check" == arg ){ opt.check = true; }
+    else if( ( "--tol" == arg ) && val ){ opt.tol = std::strtod( val, nullptr ); ++a; }
+    else if( ( "--baseline" == arg ) && val ){ opt.baseline = val; ++a; }
+    else if( ( "--threshold" == arg ) && val ){ opt.threshold = std::strtod( val, nullptr ); ++a; }
+    else if( "--suite" == arg )
+    {
+      opt.sizes = { 256, 512, 1024, 2048, 4096, 8192 };
+      opt.check = true;
+    }
+    else
+    {
+      std::cerr << "usage: bench [--sizes 64,128,...] [--aspect a] [--reps r] [--only name]"
+        " [--scalar float|double] [--layout col|row] [--json] [--out file] [--tune file]"
+        " [--check] [--tol t] [--baseline file] [--threshold f] [--suite]" << std::endl;
+      return 1;
+    }
+  }
+
+  if( ! opt.tune.empty() )
+  {
+    // Tuned on top of the tuning file already there, if any
+    Aux_Tuning tuning{};
+    {
+      std::ifstream file{ opt.tune };
+      tuning.Read( file );
+    }
+
+    if( opt.float32 ){ Tune< Float32 >( opt, tuning ); }
+    if( opt.float64 ){ Tune< Float64 >( opt, tuning ); }
+
+    std::ofstream file{ opt.tune };
+    tuning.Write( file );
+    return file ? 0 : 1;
+  }
+
+  std::vector< Record > records;
+
+  if( opt.float32 && opt.colMajor ){ Run< Float32, ColMajor >( opt, records ); }
+  if( opt.float32 && opt.rowMajor ){ Run< Float32, RowMajor >( opt, records ); }
+  if( opt.float64 && opt.colMajor ){ Run< Float64, ColMajor >( opt, records ); }
+  if( opt.float64 && opt.rowMajor ){ Run< Float64, RowMajor >( opt, records ); }
+
+  if( opt.out.empty() ){ Write( std::cout, records, opt.json ); }else
+  {
+    std::ofstream file{ opt.out };
+    Write( file, records, opt.json );
+  }
+
+  return ( Compare( opt, records, std::cerr ) > 0 ) ? 1 : 0;
+}
\ No newline at end of file
@@ -25,6 +25,16 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 void Example_Inverse();
 void Example_Eigensystem();
 void Example_Bidiagonal();
+void Example_LeastSquares();
+void Example_Cholesky();
+void Example_EigensystemBatch();
+void Example_Device();
+void Example_Distributed();
+void Example_Tridiagonal();
+void Example_PivotedQR();
+void Example_Randomized();
+void Example_GeneralizedEigensystem();
+void Example_EigensystemPipe();
 
 int main( int argc, char **argv )
 {
@@ -33,6 +43,16 @@ int main( int argc, char **argv )
   Example_Inverse();
   Example_Eigensystem();
   Example_Bidiagonal();
+  Example_LeastSquares();
+  Example_Cholesky();
+  Example_EigensystemBatch();
+  Example_Device();
+  Example_Distributed();
+  Example_Tridiagonal();
+  Example_PivotedQR();
+  Example_Randomized();
+  Example_GeneralizedEigensystem();
+  Example_EigensystemPipe();
 
   return 0;
 }
@@ -114,42 +134,39 @@ void Example_Eigensystem()
 
   cout << "Solving " << n << " x " << n << " random symmetric problem..." << endl;
 
-  vector< Scalar > bfr;
+  Aux_Arena< Scalar > arena{};
+  Aux_Arena< Scalar >::Frame frame{ arena };
 
-  bfr.resize( 4*n2 + ( 2*n + 3*(n-1) ) + Max(
-    Ort_From_Syt_WorkSize( n ),
-    Syt_EigVecQR_WorkSize( n ) ) );
-
-  auto * A = bfr.data();
-  auto * B = A + n2;
-  auto * C = B + n2;
-  auto * S = C + n2;
-  auto * d = S + n2;
-  auto * d1 = d + n;
-  auto * e = d1 + n;
-  auto * e1 = e + (n-1);
-  auto * tau = e1 + (n-1);
-  auto * work = tau + (n-1);
+  auto * A = arena.Take( n2 );
+  auto * B = arena.Take( n2 );
+  auto * C = arena.Take( n2 );
+  auto * S = arena.Take( n2 );
+  auto * d = arena.Take( n );
+  auto * d1 = arena.Take( n );
+  auto * e1 = arena.Take( n-1 );
+  auto * tau = arena.Take( n-1 );
 
   for( Index i = 0; i < (Index)n2; ++i )
   { A[i] = dist(gen); }
 
-  // S = (~A)*A
-  Mat_MatMul< Lyt >( Trnsp::Yes, Trnsp::No, n, n, n, 1.0f, A,n, A,n, 0.0f, S,n );
-
-  // A := S
-  copy( S, S+n2, A );
+  // S = (~A)*A, lower half
+  Sym_RankKUpd< Lyt >( Half::Lower, Trnsp::Yes, n, n, 1.0, A,n, 0.0, S,n );
 
-  Sym_Rdto_Syt< Lyt >( Half::Lower, n, S,n, d,e,tau );
-  Ort_From_Syt< Lyt >( Half::Lower, n, S,n, tau, work );
+  // A := S, both halves
+  Mat_Copy< Lyt >( Half::Lower, Trnsp::No, n,n, S,n, A,n );
+  Mat_Copy< Lyt >( Half::Lower, Trnsp::Yes, n,n, S,n, A,n );
 
-  copy( d, d+n, d1 );
-  copy( e, e+(n-1), e1 );
+  // Tridiagonal form of a copy, for Syt_EigQR below
+  copy( S, S+n2, B );
+  {
+    Aux_Arena< Scalar >::Frame inner{ arena };
+    Sym_Rdto_Syt_Blk< Lyt >( Half::Lower, n, B,n, d1,e1,tau, arena.Take( Sym_Rdto_Syt_Blk_WorkSize( n ) ) );
+  }
 
-  Syt_EigVecQR< Scalar > VQR{};
-  if( ! VQR.Solve< Lyt >( n, d,e, S,n, work ) )
+  Sym_Eig< Scalar > VE{};
+  if( ! VE.Solve< Lyt >( Half::Lower, n, S,n, d, arena ) )
   {
-    cout << "ERROR: Syt_EigVecQR failed to converge!" << endl;
+    cout << "ERROR: Sym_Eig failed to converge!" << endl;
     return;
   }
 
@@ -158,14 +175,13 @@ void Example_Eigensystem()
   // C = B*(~S) = S*d*(~S)
   Mat_MatMul< Lyt >( Trnsp::No, Trnsp::Yes, n,n,n, 1.0f, B,n, S,n, 0.0f, C,n );
 
-  const Scalar dtol = 1.0e-10f;
   const Scalar Ztol = 1.0e-5f;
 
   for( Index i = 0; i < (Index)n2; ++i )
   {
     if( ! IsWithinBound( A[i] - C[i], Ztol ) )
     {
-      cout << "ERROR: Syt_EigVecQR eigensystem did not round-trip!" << endl;
+      cout << "ERROR: Sym_Eig eigensystem did not round-trip!" << endl;
       break;
     }
   }
@@ -180,11 +196,15 @@ void Example_Eigensystem()
   sort( d, d+n );
   sort( d1, d1+n );
 
+  // Syt_EigQR and Sym_Eig may use different algorithms, which agree
+  // to within a few ulps of the largest eigenvalue.
+  const Scalar dtol = 1.0e-14f*Max( Abs( d1[0] ), Abs( d1[n-1] ) );
+
   for( Index i = 0; i < (Index)n; ++i )
   {
     if( ! IsWithinBound( d1[i] - d[i], dtol ) )
     {
-      cout << "ERROR: Eigenvalues from Syt_EigQR did not match Syt_EigVecQR! " << d1[i] << " = " << d[i] << endl;
+      cout << "ERROR: Eigenvalues from Syt_EigQR did not match Sym_Eig! " << d1[i] << " = " << d[i] << endl;
       break;
     }
   }
@@ -218,19 +238,25 @@ void Example_Bidiagonal()
   Size mn = m*n;
   Size k = Min( m, n );
 
-  vector< Scalar > bfr;
-  bfr.resize( 5*mn + k + (k-1) + 2*Max(n,m) + ( Mat_Rdto_Bid_WorkSize( m, n ) + mn ) );
-
-  auto * A = bfr.data();
-  auto * B = A + mn;
-  auto * C = B + mn;
-  auto * Q = C + mn;
-  auto * Pt = Q + mn;
-  auto * d = Pt + mn;
-  auto * e = d + k;
-  auto * Q_tau = e + (k-1);
-  auto * P_tau = Q_tau + Max(n,m);
-  auto * work = P_tau + Max(n,m); // at least mn in size
+  Aux_Arena< Scalar > arena{};
+  Aux_Arena< Scalar >::Frame frame{ arena };
+
+  auto * A = arena.Take( mn );
+  auto * B = arena.Take( mn );
+  auto * C = arena.Take( mn );
+  auto * Q = arena.Take( mn );
+  auto * Pt = arena.Take( mn );
+  auto * R = arena.Take( mn );
+  auto * D = arena.Take( mn );
+  auto * d = arena.Take( k );
+  auto * e = arena.Take( k-1 );
+  auto * Q_tau = arena.Take( Max(n,m) );
+  auto * P_tau = arena.Take( Max(n,m) );
+  auto * work = arena.Take( Max( Mat_Rdto_Bid_Blk_WorkSize( m, n ),
+    Ort_From_Bid_WorkSize( Vect::Q, m, n, n ),
+    Ort_From_Bid_WorkSize( Vect::Pt, m, n, m ),
+    Ort_MatMul_Bid_WorkSize( Side::Left, m, n ),
+    Ort_MatMul_Bid_WorkSize( Side::Right, m, n ) ) );
 
   for( Index i = 0; i < (Index)mn; ++i )
   { A[i] = dist(gen); }
@@ -242,7 +268,9 @@ void Example_Bidiagonal()
   auto Q_ld = m;
 
   copy( A, A+ mn, B );
-  Mat_Rdto_Bid< Lyt >( m, n, B,B_ld, d,e,Q_tau,P_tau, work );
+  copy( A, A+ mn, D );
+  Mat_Rdto_Bid_Blk< Lyt >( m, n, B,B_ld, d,e,Q_tau,P_tau, work );
+  copy( B, B+mn, R );
 
   copy( B, B+mn, Q );
   copy( B, B+mn, Pt );
@@ -302,5 +330,1142 @@ void Example_Bidiagonal()
     }
   }
 
+  // D = (~Q)*A*P, with Q and P applied from the reflectors in R
+  Ort_MatMul_Bid< Lyt >( Vect::Q, Side::Left, Trnsp::Yes, m, n, n, R,B_ld, Q_tau, D,A_ld, work );
+  Ort_MatMul_Bid< Lyt >( Vect::Pt, Side::Right, Trnsp::No, m, n, m, R,B_ld, P_tau, D,A_ld, work );
+
+  auto * D_d = Lyt::DiagPtr( D, 0, 0, A_ld );
+  auto * D_e = ( m >= n )?
+    Lyt::DiagPtr( D, 0, 1, A_ld ) :
+    Lyt::DiagPtr( D, 1, 0, A_ld );
+
+  for( Index i = 0; i < (Index)k; ++i )
+  {
+    const auto ad = Lyt::VecRef( D_d, i, A_ds );
+    const auto bd = Lyt::VecRef( B_d, i, B_ds );
+    const auto ae = ( i+1 < (Index)k ) ? Lyt::VecRef( D_e, i, A_ds ) : Scalar{};
+    const auto be = ( i+1 < (Index)k ) ? Lyt::VecRef( B_e, i, B_ds ) : Scalar{};
+    if( ! IsWithinBound( ad - bd, diagTol ) || ! IsWithinBound( ae - be, diagTol ) )
+    {
+      cout << "ERROR: Ort_MatMul_Bid - bidiagonal element mismatch! " << ad << " != " << bd << endl;
+      break;
+    }
+  }
+
+  cout << "-------- SUCCESS!" << endl;
+}
+
+void Example_LeastSquares()
+{
+  using namespace std;
+
+  using namespace IND;
+  using namespace Math;
+  using namespace LAPACK;
+
+  cout << "-------- Least Squares Example" << endl;
+
+  using Lyt = ColMajor;
+  using Scalar = Float64;
+
+  uniform_real_distribution< Scalar > dist{ -1.0f, 1.0f };
+  mt19937 gen{};
+
+  const Size nrhs = 3;
+  const Scalar tol = 1.0e-10f;
+
+  Aux_Arena< Scalar > arena{};
+
+  // Overdetermined, then underdetermined
+  const Size shapes[2][2]{ { 40, 12 }, { 12, 40 } };
+
+  for( const auto &shape : shapes )
+  {
+    const Size m = shape[0];
+    const Size n = shape[1];
+    const Size l = Max( m, n );
+
+    cout << "Solving " << m << " x " << n << " random least squares problem..." << endl;
+
+    Aux_Arena< Scalar >::Frame frame{ arena };
+
+    auto * A = arena.Take( m*n );
+    auto * B = arena.Take( m*nrhs );
+    auto * X = arena.Take( l*nrhs );
+    auto * R = arena.Take( m*nrhs );
+    auto * G = arena.Take( n*nrhs );
+
+    for( Index i = 0; i < (Index)(m*n); ++i )
+    { A[i] = dist(gen); }
+    for( Index i = 0; i < (Index)(m*nrhs); ++i )
+    { B[i] = dist(gen); }
+
+    Mat_Copy< Lyt, Lyt >( m, nrhs, B,m, X,l );
+
+    Mat_LS< Scalar > LS{};
+    if( ! LS.Factor< Lyt >( m, n, A,m ) || ! LS.Solve( nrhs, X,l ) )
+    {
+      cout << "ERROR: Mat_LS reported a random matrix rank deficient!" << endl;
+      return;
+    }
+
+    // R = B - A*X
+    Mat_Copy< Lyt, Lyt >( m, nrhs, B,m, R,m );
+    Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, m, nrhs, n, -1.0f, A,m, X,l, 1.0f, R,m );
+
+    // The least squares residual is orthogonal to the range of A, and
+    // the minimum norm solution of a consistent system leaves none.
+    const auto * E = R;
+    Size e_n = m*nrhs;
+    if( m >= n )
+    {
+      // G = (~A)*R
+      Mat_MatMul< Lyt >( Trnsp::Yes, Trnsp::No, n, nrhs, m, 1.0f, A,m, R,m, 0.0f, G,n );
+      E = G;
+      e_n = n*nrhs;
+    }
+
+    for( Index i = 0; i < (Index)e_n; ++i )
+    {
+      if( ! IsWithinBound( E[i], tol ) )
+      {
+        cout << "ERROR: Mat_LS solution is not a least squares solution! " << E[i] << endl;
+        return;
+      }
+    }
+  }
+
+  cout << "-------- SUCCESS!" << endl;
+}
+
+void Example_Cholesky()
+{
+  using namespace std;
+
+  using namespace IND;
+  using namespace Math;
+  using namespace LAPACK;
+
+  cout << "-------- Cholesky Example" << endl;
+
+  using Lyt = ColMajor;
+  using Scalar = Float64;
+
+  uniform_real_distribution< Scalar > dist{ -1.0f, 1.0f };
+  mt19937 gen{};
+
+  const Size n = 50;
+  const Size n2 = n*n;
+
+  cout << "Solving " << n << " x " << n << " random positive definite problem..." << endl;
+
+  Aux_Arena< Scalar > arena{};
+  Aux_Arena< Scalar >::Frame frame{ arena };
+
+  auto * M = arena.Take( n2 );
+  auto * A = arena.Take( n2 );
+  auto * L = arena.Take( n2 );
+  auto * b = arena.Take( n );
+  auto * x = arena.Take( n );
+  auto * y = arena.Take( n );
+
+  for( Index i = 0; i < (Index)n2; ++i )
+  { M[i] = dist(gen); }
+  for( Index i = 0; i < (Index)n; ++i )
+  { b[i] = dist(gen); }
+
+  // A = (~M)*M + n*I, both halves
+  Sym_RankKUpd< Lyt >( Half::Lower, Trnsp::Yes, n, n, 1.0, M,n, 0.0, A,n );
+  for( Index i = 0; i < (Index)n; ++i )
+  { Lyt::MatRef( A, i, i, n ) += (Scalar)n; }
+  Mat_Copy< Lyt >( Half::Lower, Trnsp::Yes, n,n, A,n, A,n );
+
+  // Tiles narrower than n, so that the blocked and parallel codes
+  // do not fall back to the recursive one
+  const Sym_Fctr_Chol_Config config{ 16, 2 };
+
+  const Scalar tol = 1.0e-10f;
+
+  for( int path = 0; path < 3; ++path )
+  {
+    copy( A, A+n2, L );
+
+    const auto factored =
+      ( 0 == path )? Sym_Fctr_Chol< Lyt >( Half::Lower, n, L,n ) :
+      ( 1 == path )? Sym_Fctr_Chol_Blk< Lyt >( Half::Lower, n, L,n, config ) :
+                     Sym_Fctr_Chol_Par< Lyt >( Half::Lower, n, L,n, config );
+    if( ! factored )
+    {
+      cout << "ERROR: Sym_Fctr_Chol failed on a positive definite matrix!" << endl;
+      return;
+    }
+
+    copy( b, b+n, x );
+    Sym_Solv_Chol< Lyt >( Half::Lower, n, L,n, x,1 );
+
+    // y = A*x
+    Mat_VecMul< Lyt >( Trnsp::No, n,n, 1.0f, A,n, x,1, 0.0f, y,1 );
+
+    for( Index i = 0; i < (Index)n; ++i )
+    {
+      if( ! IsWithinBound( y[i] - b[i], tol ) )
+      {
+        cout << "ERROR: With y = A*x, and A*x = b, y != b." << endl;
+        return;
+      }
+    }
+  }
+
+  // A negative pivot must stop the factorization at its own minor
+  const Index k = (Index)n/2;
+  copy( A, A+n2, L );
+  Lyt::MatRef( L, k, k, n ) = -1.0f;
+
+  const auto failed = Sym_Fctr_Chol_Blk< Lyt >( Half::Lower, n, L,n, config );
+  if( failed || ( failed.i != k ) )
+  {
+    cout << "ERROR: Sym_Fctr_Chol did not report an indefinite matrix! " << failed.i << endl;
+    return;
+  }
+
+  cout << "-------- SUCCESS!" << endl;
+}
+
+void Example_EigensystemBatch()
+{
+  using namespace std;
+
+  using namespace IND;
+  using namespace Math;
+  using namespace LAPACK;
+
+  cout << "-------- Eigensystem Batch Example" << endl;
+
+  using Lyt = ColMajor;
+  using Scalar = Float64;
+
+  uniform_real_distribution< Scalar > dist{ -1.0f, 1.0f };
+  mt19937 gen{};
+
+  constexpr Size N = 16;
+  constexpr Size W = Mat_LU_Ilv_Width< Scalar >;
+  // Not a whole number of groups, so the last one is padded
+  const Size count = 2*W + 3;
+
+  cout << "Solving " << count << " random symmetric problems of order " << N << "..." << endl;
+
+  Aux_Arena< Scalar > arena{};
+  Aux_Arena< Scalar >::Frame frame{ arena };
+
+  const Size A_n = Mat_LU_Ilv_Size( N*N, count, W );
+  const Size w_n = Mat_LU_Ilv_Size( N, count, W );
+
+  auto * A = arena.Take( A_n );
+  auto * w = arena.Take( w_n );
+  auto * S = arena.Take( N*N );
+  auto * d = arena.Take( N );
+  auto * work = arena.Take( Sym_Eig_Ilv_WorkSize< Scalar >( N ) );
+
+  auto A_Ilv = [&]( Size b, Size i, Size j ) -> Scalar &
+  { return A[(b/W)*N*N*W + (i + j*N)*W + b%W]; };
+
+  // The padding lanes are computed too, and must hold finite values
+  fill( A, A+A_n, Scalar{} );
+
+  for( Size b = 0; b < count; ++b )
+  {
+    for( Size j = 0; j < N; ++j )
+    {
+      for( Size i = j; i < N; ++i )
+      { A_Ilv( b, i, j ) = A_Ilv( b, j, i ) = dist(gen); }
+    }
+  }
+
+  // Reference eigenvalues, one matrix at a time, are taken from A
+  // before it is overwritten
+  vector< Scalar > ref( count*N );
+  Sym_Eig< Scalar > VE{};
+  for( Size b = 0; b < count; ++b )
+  {
+    for( Size j = 0; j < N; ++j )
+    {
+      for( Size i = 0; i < N; ++i )
+      { Lyt::MatRef( S, i, j, N ) = A_Ilv( b, i, j ); }
+    }
+
+    if( ! VE.Solve< Lyt >( Half::Lower, N, S,N, d, arena ) )
+    {
+      cout << "ERROR: Sym_Eig failed to converge!" << endl;
+      return;
+    }
+    sort( d, d+N );
+    copy( d, d+N, ref.data() + b*N );
+  }
+
+  if( ! Sym_Eig_Ilv< N >( Half::Lower, count, A, w, work ) )
+  {
+    cout << "ERROR: Sym_Eig_Ilv failed to converge!" << endl;
+    return;
+  }
+
+  const Scalar tol = 1.0e-12f;
+
+  for( Size b = 0; b < count; ++b )
+  {
+    for( Size k = 0; k < N; ++k )
+    {
+      const Scalar wk = w[(b/W)*N*W + k*W + b%W];
+      if( ! IsWithinBound( wk - ref[b*N + k], tol ) )
+      {
+        cout << "ERROR: Eigenvalues from Sym_Eig_Ilv did not match Sym_Eig! " << wk << " = " << ref[b*N + k] << endl;
+        return;
+      }
+    }
+  }
+
+  cout << "-------- SUCCESS!" << endl;
+}
+
+void Example_Device()
+{
+  using namespace std;
+
+  using namespace IND;
+  using namespace Math;
+  using namespace LAPACK;
+
+  cout << "-------- Device Example" << endl;
+
+  // Device memory is ColMajor
+  using Lyt = ColMajor;
+  using Scalar = Float64;
+
+  uniform_real_distribution< Scalar > dist{ -1.0f, 1.0f };
+  mt19937 gen{};
+
+  const Size n = 160;
+  const Size n2 = n*n;
+  // Panels narrower than n, so that the device updates run
+  const Size nb = 32;
+
+  cout << "Factoring " << n << " x " << n << " random matrix on Dev_Host..." << endl;
+
+  Aux_Arena< Scalar > arena{};
+  Aux_Arena< Scalar >::Frame frame{ arena };
+
+  auto * A = arena.Take( n2 );
+  auto * S = arena.Take( n2 );
+  auto * B = arena.Take( n2 );
+  auto * C = arena.Take( n2 );
+  auto * tau = arena.Take( n );
+  auto * tau1 = arena.Take( n );
+  auto * d = arena.Take( n );
+  auto * d1 = arena.Take( n );
+  auto * work = arena.Take( Max( Mat_Fctr_LU_Dev_WorkSize( n, nb ),
+    Mat_Fctr_QR_Dev_WorkSize( n, nb ),
+    Mat_Fctr_QR_Blk_WorkSize( n, n, nb ),
+    Sym_Eig_Dev_WorkSize( n, nb ) ) );
+
+  vector< Index > piv( n ), piv1( n );
+
+  for( Index i = 0; i < (Index)n2; ++i )
+  { A[i] = dist(gen); }
+
+  // S = A + (~A)
+  for( Index j = 0; j < (Index)n; ++j )
+  {
+    for( Index i = 0; i < (Index)n; ++i )
+    { Lyt::MatRef( S, i, j, n ) = Lyt::MatRef( A, i, j, n ) + Lyt::MatRef( A, j, i, n ); }
+  }
+
+  Dev_Host< Scalar > dev{};
+  Dev_Buffer< Dev_Host< Scalar > > A_dev{ dev, n2 };
+
+  const Scalar tol = 1.0e-10f;
+
+  auto Match = [&]( const char *name, Size count, const Scalar *x, const Scalar *y ) -> bool
+  {
+    for( Index i = 0; i < (Index)count; ++i )
+    {
+      if( ! IsWithinBound( x[i] - y[i], tol ) )
+      {
+        cout << "ERROR: " << name << " did not match the host routine! " << x[i] << " = " << y[i] << endl;
+        return false;
+      }
+    }
+    return true;
+  };
+
+  // LU
+  Mat_Fctr_LU_Config config{};
+  config.nb = nb;
+
+  copy( A, A+n2, B );
+  Mat_Copy< Lyt, Lyt >( n, n, A,n, A_dev.Ptr(), n );
+  if( ! Mat_Fctr_LU_Dev( n, n, A_dev.Ptr(), n, piv.data(), work, nb, config )
+   || ! Mat_Fctr_LU_Blk< Lyt >( n, n, B,n, piv1.data(), config ) )
+  {
+    cout << "ERROR: Mat_Fctr_LU failed on a random matrix!" << endl;
+    return;
+  }
+  Mat_Copy< Lyt, Lyt >( n, n, A_dev.Ptr(), n, C,n );
+
+  if( piv != piv1 )
+  {
+    cout << "ERROR: Mat_Fctr_LU_Dev pivots did not match the host routine!" << endl;
+    return;
+  }
+  if( ! Match( "Mat_Fctr_LU_Dev", n2, C, B ) )
+  { return; }
+
+  // QR
+  copy( A, A+n2, B );
+  Mat_Copy< Lyt, Lyt >( n, n, A,n, A_dev.Ptr(), n );
+  Mat_Fctr_QR_Dev( n, n, A_dev.Ptr(), n, tau, work, nb );
+  Mat_Fctr_QR_Blk< Lyt >( n, n, B,n, tau1, work, nb );
+  Mat_Copy< Lyt, Lyt >( n, n, A_dev.Ptr(), n, C,n );
+
+  if( ! Match( "Mat_Fctr_QR_Dev", n2, C, B ) || ! Match( "Mat_Fctr_QR_Dev", n, tau, tau1 ) )
+  { return; }
+
+  // Eigenvalues
+  copy( S, S+n2, B );
+  Mat_Copy< Lyt, Lyt >( n, n, S,n, A_dev.Ptr(), n );
+  Sym_Eig< Scalar > VE{};
+  if( ! Sym_Eig_Dev( Half::Lower, n, A_dev.Ptr(), n, d, work, nb )
+   || ! VE.Solve< Lyt >( Half::Lower, n, B,n, d1, arena ) )
+  {
+    cout << "ERROR: Sym_Eig failed to converge!" << endl;
+    return;
+  }
+
+  if( ! Match( "Sym_Eig_Dev", n, d, d1 ) )
+  { return; }
+
+  cout << "-------- SUCCESS!" << endl;
+}
+
+void Example_Distributed()
+{
+  using namespace std;
+
+  using namespace IND;
+  using namespace Math;
+  using namespace LAPACK;
+
+  cout << "-------- Distributed Example" << endl;
+
+  // Local matrices are ColMajor
+  using Lyt = ColMajor;
+  using Scalar = Float64;
+
+  uniform_real_distribution< Scalar > dist{ -1.0f, 1.0f };
+  mt19937 gen{};
+
+  const Size m = 120;
+  const Size n = 90;
+  const Size mn = m*n;
+  const Size n2 = n*n;
+  // Blocks narrower than n, so that the drivers run several panels
+  const Size nb = 16;
+
+  cout << "Factoring " << m << " x " << n << " random matrix on a 1 x 1 grid..." << endl;
+
+  Aux_Arena< Scalar > arena{};
+  Aux_Arena< Scalar >::Frame frame{ arena };
+
+  auto * A = arena.Take( mn );
+  auto * B = arena.Take( mn );
+  auto * C = arena.Take( mn );
+  auto * S = arena.Take( n2 );
+  auto * tau = arena.Take( n );
+  auto * tau1 = arena.Take( n );
+  auto * d = arena.Take( n );
+  auto * d1 = arena.Take( n );
+
+  vector< Index > piv( n ), piv1( n );
+
+  for( Index i = 0; i < (Index)mn; ++i )
+  { A[i] = dist(gen); }
+
+  // S = A(0:n,:) + ~A(0:n,:)
+  for( Index j = 0; j < (Index)n; ++j )
+  {
+    for( Index i = 0; i < (Index)n; ++i )
+    { Lyt::MatRef( S, i, j, n ) = Lyt::MatRef( A, i, j, m ) + Lyt::MatRef( A, j, i, m ); }
+  }
+
+  // On the 1 x 1 grid the local matrix is the whole one
+  Dst_Grid_Self grid{};
+  Dst_Matrix< Dst_Grid_Self, Scalar > A_dst{ &grid, m, n, nb, C, (Stride)m };
+  Dst_Matrix< Dst_Grid_Self, Scalar > S_dst{ &grid, n, n, nb, C, (Stride)n };
+
+  auto * work = arena.Take( Max( Mat_Fctr_LU_Dst_WorkSize( A_dst ),
+    Mat_Fctr_QR_Dst_WorkSize( A_dst ),
+    Mat_Fctr_QR_Blk_WorkSize( m, n, nb ),
+    Sym_Eig_Dst_WorkSize( S_dst ) ) );
+
+  const Scalar tol = 1.0e-10f;
+
+  auto Match = [&]( const char *name, Size count, const Scalar *x, const Scalar *y ) -> bool
+  {
+    for( Index i = 0; i < (Index)count; ++i )
+    {
+      if( ! IsWithinBound( x[i] - y[i], tol ) )
+      {
+        cout << "ERROR: " << name << " did not match the local routine! " << x[i] << " = " << y[i] << endl;
+        return false;
+      }
+    }
+    return true;
+  };
+
+  // LU
+  Mat_Fctr_LU_Config config{};
+  config.nb = nb;
+
+  copy( A, A+mn, B );
+  copy( A, A+mn, C );
+  if( ! Mat_Fctr_LU_Dst( A_dst, piv.data(), work )
+   || ! Mat_Fctr_LU_Blk< Lyt >( m, n, B,m, piv1.data(), config ) )
+  {
+    cout << "ERROR: Mat_Fctr_LU failed on a random matrix!" << endl;
+    return;
+  }
+
+  if( piv != piv1 )
+  {
+    cout << "ERROR: Mat_Fctr_LU_Dst pivots did not match the local routine!" << endl;
+    return;
+  }
+  if( ! Match( "Mat_Fctr_LU_Dst", mn, C, B ) )
+  { return; }
+
+  // QR
+  copy( A, A+mn, B );
+  copy( A, A+mn, C );
+  Mat_Fctr_QR_Dst( A_dst, tau, work );
+  Mat_Fctr_QR_Blk< Lyt >( m, n, B,m, tau1, work, nb );
+
+  if( ! Match( "Mat_Fctr_QR_Dst", mn, C, B ) || ! Match( "Mat_Fctr_QR_Dst", n, tau, tau1 ) )
+  { return; }
+
+  // Eigenvalues
+  copy( S, S+n2, B );
+  copy( S, S+n2, C );
+  Sym_Eig< Scalar > VE{};
+  if( ! Sym_Eig_Dst( Half::Lower, S_dst, d, work )
+   || ! VE.Solve< Lyt >( Half::Lower, n, B,n, d1, arena ) )
+  {
+    cout << "ERROR: Sym_Eig failed to converge!" << endl;
+    return;
+  }
+
+  if( ! Match( "Sym_Eig_Dst", n, d, d1 ) )
+  { return; }
+
+  cout << "-------- SUCCESS!" << endl;
+}
+
+void Example_Tridiagonal()
+{
+  using namespace std;
+
+  using namespace IND;
+  using namespace Math;
+  using namespace LAPACK;
+
+  cout << "-------- Tridiagonal Example" << endl;
+
+  using Scalar = Float64;
+
+  uniform_real_distribution< Scalar > dist{ -1.0f, 1.0f };
+  mt19937 gen{};
+
+  const Size n = 300;
+
+  Aux_Arena< Scalar > arena{};
+  Aux_Arena< Scalar >::Frame frame{ arena };
+
+  auto * d = arena.Take( n );
+  auto * e = arena.Take( n-1 );
+  auto * ref = arena.Take( n );
+  auto * w0 = arena.Take( n );
+  auto * d1 = arena.Take( n );
+  auto * e1 = arena.Take( n-1 );
+  auto * work = arena.Take( Syt_EigQD_WorkSize( n ) );
+
+  Syt_EigQR< Scalar > QR{};
+  Syt_EigQD< Scalar > QD{};
+
+  // Eigenvalues agree to within a few ulps of the largest one
+  auto Match = [&]( const char *name, const Scalar *x ) -> bool
+  {
+    const Scalar tol = 1.0e-13f*Max( Abs( ref[0] ), Abs( ref[n-1] ) );
+    for( Index i = 0; i < (Index)n; ++i )
+    {
+      if( ! IsWithinBound( x[i] - ref[i], tol ) )
+      {
+        cout << "ERROR: Eigenvalues from " << name << " did not match Syt_EigQR! " << x[i] << " = " << ref[i] << endl;
+        return false;
+      }
+    }
+    return true;
+  };
+
+  // A random matrix, then the 1-2-1 matrix of the second difference
+  for( int kind = 0; kind < 2; ++kind )
+  {
+    for( Index i = 0; i < (Index)n; ++i )
+    { d[i] = ( 0 == kind )? dist(gen) : 2.0f; }
+    for( Index i = 0; i < (Index)(n-1); ++i )
+    { e[i] = ( 0 == kind )? dist(gen) : -1.0f; }
+
+    cout << "Solving " << n << " x " << n << ( ( 0 == kind )? " random" : " 1-2-1" ) << " tridiagonal problem..." << endl;
+
+    copy( d, d+n, ref );
+    copy( e, e+n-1, e1 );
+    if( ! QR.Solve( n, ref, e1 ) )
+    {
+      cout << "ERROR: Syt_EigQR failed to converge!" << endl;
+      return;
+    }
+    sort( ref, ref+n );
+
+    if( 1 == kind )
+    {
+      // 2 - 2 cos( k pi/(n+1) ), k = 1..n
+      const Scalar pi = 3.14159265358979323846;
+      for( Index k = 0; k < (Index)n; ++k )
+      { w0[k] = 2.0f - 2.0f*std::cos( (k+1)*pi/(n+1) ); }
+      if( ! Match( "the closed form", w0 ) )
+      { return; }
+    }
+
+    copy( d, d+n, d1 );
+    copy( e, e+n-1, e1 );
+    if( ! QD.Solve( n, d1, e1, work ) )
+    {
+      cout << "ERROR: Syt_EigQD failed to converge!" << endl;
+      return;
+    }
+    if( ! Match( "Syt_EigQD", d1 ) )
+    { return; }
+
+    // Warm start from the eigenvalues of a nearby matrix
+    for( Index i = 0; i < (Index)n; ++i )
+    { w0[i] = d[i] + 1.0e-6f; }
+    copy( e, e+n-1, e1 );
+    if( ! QR.Solve( n, w0, e1 ) )
+    {
+      cout << "ERROR: Syt_EigQR failed to converge!" << endl;
+      return;
+    }
+    sort( w0, w0+n );
+
+    copy( d, d+n, d1 );
+    copy( e, e+n-1, e1 );
+    if( ! QR.Solve( n, d1, e1, w0 ) )
+    {
+      cout << "ERROR: Syt_EigQR failed to converge from a warm start!" << endl;
+      return;
+    }
+    sort( d1, d1+n );
+    if( ! Match( "the warm started Syt_EigQR", d1 ) )
+    { return; }
+  }
+
+  cout << "-------- SUCCESS!" << endl;
+}
+
+void Example_PivotedQR()
+{
+  using namespace std;
+
+  using namespace IND;
+  using namespace Math;
+  using namespace LAPACK;
+
+  cout << "-------- Pivoted QR Example" << endl;
+
+  using Lyt = ColMajor;
+  using Scalar = Float64;
+
+  uniform_real_distribution< Scalar > dist{ -1.0f, 1.0f };
+  mt19937 gen{};
+
+  const Size m = 80;
+  const Size n = 60;
+  const Size r = 20;
+  const Size mn = m*n;
+  // Panels narrower than the rank, so that it falls inside one
+  const Size nb = 16;
+
+  cout << "Factoring " << m << " x " << n << " random matrix of rank " << r << "..." << endl;
+
+  Aux_Arena< Scalar > arena{};
+  Aux_Arena< Scalar >::Frame frame{ arena };
+
+  auto * X = arena.Take( m*r );
+  auto * Y = arena.Take( r*n );
+  auto * A = arena.Take( mn );
+  auto * B = arena.Take( mn );
+  auto * Q = arena.Take( mn );
+  auto * C = arena.Take( mn );
+  auto * tau = arena.Take( n );
+  auto * work = arena.Take( Max( Mat_Fctr_QRP_WorkSize( m, n ),
+    Mat_Fctr_QRP_Blk_WorkSize( m, n, nb ),
+    Mat_Fctr_QRP_Rnd_WorkSize( m, n, nb ),
+    Ort_From_QR_Blk_WorkSize( m, n, n ) ) );
+
+  vector< Index > jpvt( n );
+
+  for( Index i = 0; i < (Index)(m*r); ++i )
+  { X[i] = dist(gen); }
+  for( Index i = 0; i < (Index)(r*n); ++i )
+  { Y[i] = dist(gen); }
+
+  // A = X*Y
+  Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, m, n, r, 1.0f, X,m, Y,r, 0.0f, A,m );
+
+  const Scalar tol = 1.0e-10f;
+
+  for( int path = 0; path < 3; ++path )
+  {
+    const char *name = ( 0 == path )? "Mat_Fctr_QRP" :
+                       ( 1 == path )? "Mat_Fctr_QRP_Blk" : "Mat_Fctr_QRP_Rnd";
+
+    copy( A, A+mn, B );
+    if( 0 == path ){ Mat_Fctr_QRP< Lyt >( m, n, B,m, jpvt.data(), tau, work ); }
+    else if( 1 == path ){ Mat_Fctr_QRP_Blk< Lyt >( m, n, B,m, jpvt.data(), tau, work, nb ); }
+    else { Mat_Fctr_QRP_Rnd< Lyt >( m, n, B,m, jpvt.data(), tau, work, nb ); }
+
+    // jpvt is a permutation
+    vector< Index > cols( jpvt );
+    sort( cols.begin(), cols.end() );
+    for( Index j = 0; j < (Index)n; ++j )
+    {
+      if( cols[j] != j )
+      {
+        cout << "ERROR: " << name << " pivots are not a permutation!" << endl;
+        return;
+      }
+    }
+
+    // The diagonal of R reveals the rank
+    const Scalar r0 = Abs( Lyt::MatRef( B, 0, 0, m ) );
+    if( ! IsWithinBound( Lyt::MatRef( B, r, r, m ), tol*r0 ) )
+    {
+      cout << "ERROR: " << name << " did not reveal the rank! " << Lyt::MatRef( B, r, r, m ) << endl;
+      return;
+    }
+
+    // C = Q*R
+    copy( B, B+mn, Q );
+    Ort_From_QR_Blk< Lyt >( m, n, n, Q,m, tau, work );
+    for( Index j = 0; j < (Index)n; ++j )
+    {
+      for( Index i = j+1; i < (Index)n; ++i )
+      { Lyt::MatRef( B, i, j, m ) = 0.0f; }
+    }
+    Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, m, n, n, 1.0f, Q,m, B,m, 0.0f, C,m );
+
+    // A*P = Q*R, column by column
+    for( Index j = 0; j < (Index)n; ++j )
+    {
+      for( Index i = 0; i < (Index)m; ++i )
+      {
+        const Scalar ap = Lyt::MatRef( A, i, jpvt[j], m );
+        const Scalar qr = Lyt::MatRef( C, i, j, m );
+        if( ! IsWithinBound( ap - qr, tol ) )
+        {
+          cout << "ERROR: With " << name << ", A*P != Q*R! " << ap << " != " << qr << endl;
+          return;
+        }
+      }
+    }
+  }
+
+  cout << "-------- SUCCESS!" << endl;
+}
+
+void Example_Randomized()
+{
+  using namespace std;
+
+  using namespace IND;
+  using namespace Math;
+  using namespace LAPACK;
+
+  cout << "-------- Randomized Example" << endl;
+
+  using Lyt = ColMajor;
+  using Scalar = Float64;
+
+  uniform_real_distribution< Scalar > dist{ -1.0f, 1.0f };
+  mt19937 gen{};
+
+  const Size m = 200;
+  const Size n = 150;
+  const Size r = 10;
+  const Size k = r;
+  const Size mn = m*n;
+  const Size n2 = n*n;
+
+  cout << "Solving " << m << " x " << n << " random problems of rank " << r << "..." << endl;
+
+  Aux_Arena< Scalar > arena{};
+  Aux_Arena< Scalar >::Frame frame{ arena };
+
+  auto * X = arena.Take( m*r );
+  auto * Y = arena.Take( r*n );
+  auto * A = arena.Take( mn );
+  auto * B = arena.Take( mn );
+  auto * S = arena.Take( n2 );
+  auto * U = arena.Take( m*k );
+  auto * Vt = arena.Take( k*n );
+  auto * s = arena.Take( n );
+  auto * s1 = arena.Take( k );
+  auto * w = arena.Take( n );
+  auto * w1 = arena.Take( k );
+
+  for( Index i = 0; i < (Index)(m*r); ++i )
+  { X[i] = dist(gen); }
+  for( Index i = 0; i < (Index)(r*n); ++i )
+  { Y[i] = dist(gen); }
+
+  // A = X*Y, and S = (~Y)*D*Y, with D = diag( Y's first column ) of
+  // both signs
+  Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, m, n, r, 1.0f, X,m, Y,r, 0.0f, A,m );
+  for( Index j = 0; j < (Index)n; ++j )
+  {
+    for( Index i = 0; i < (Index)r; ++i )
+    { Lyt::MatRef( B, i, j, r ) = Y[i]*Lyt::MatRef( Y, i, j, r ); }
+  }
+  Mat_MatMul< Lyt >( Trnsp::Yes, Trnsp::No, n, n, r, 1.0f, Y,r, B,r, 0.0f, S,n );
+
+  // Singular values
+  Mat_SVD_Rnd< Scalar > SVD_Rnd{};
+  if( ! SVD_Rnd.Solve< Lyt >( Job::Thin, m, n, k, A,m, s1, U,m, Vt,k, arena ) )
+  {
+    cout << "ERROR: Mat_SVD_Rnd failed to converge!" << endl;
+    return;
+  }
+
+  copy( A, A+mn, B );
+  Mat_SVD< Scalar > SVD{};
+  {
+    Aux_Arena< Scalar >::Frame inner{ arena };
+    if( ! SVD.Solve< Lyt >( m, n, B,m, s, arena.Take( Mat_SVD_WorkSize( Job::None, m, n ) ) ) )
+    {
+      cout << "ERROR: Mat_SVD failed to converge!" << endl;
+      return;
+    }
+  }
+
+  const Scalar stol = 1.0e-10f*s[0];
+
+  for( Index i = 0; i < (Index)k; ++i )
+  {
+    if( ! IsWithinBound( s1[i] - s[i], stol ) )
+    {
+      cout << "ERROR: Singular values from Mat_SVD_Rnd did not match Mat_SVD! " << s1[i] << " = " << s[i] << endl;
+      return;
+    }
+  }
+
+  // B = U*s*Vt == A, as A is of rank k
+  for( Index j = 0; j < (Index)k; ++j )
+  {
+    for( Index i = 0; i < (Index)m; ++i )
+    { Lyt::MatRef( X, i, j, m ) = Lyt::MatRef( U, i, j, m )*s1[j]; }
+  }
+  Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, m, n, k, 1.0f, X,m, Vt,k, 0.0f, B,m );
+
+  for( Index i = 0; i < (Index)mn; ++i )
+  {
+    if( ! IsWithinBound( A[i] - B[i], stol ) )
+    {
+      cout << "ERROR: Mat_SVD_Rnd singular triplets did not round-trip!" << endl;
+      return;
+    }
+  }
+
+  // Eigenvalues
+  Sym_Eig_Rnd< Scalar > EIG_Rnd{};
+  if( ! EIG_Rnd.Solve< Lyt >( Half::Lower, n, k, S,n, w1, B,n, arena ) )
+  {
+    cout << "ERROR: Sym_Eig_Rnd failed to converge!" << endl;
+    return;
+  }
+
+  Sym_Eig< Scalar > EIG{};
+  if( ! EIG.Solve< Lyt >( Half::Lower, n, S,n, w, arena ) )
+  {
+    cout << "ERROR: Sym_Eig failed to converge!" << endl;
+    return;
+  }
+
+  // Sym_Eig_Rnd gives the largest in magnitude first
+  sort( w, w+n, []( Scalar a, Scalar b ){ return Abs( a ) > Abs( b ); } );
+
+  const Scalar wtol = 1.0e-10f*Abs( w[0] );
+
+  for( Index i = 0; i < (Index)k; ++i )
+  {
+    if( ! IsWithinBound( w1[i] - w[i], wtol ) )
+    {
+      cout << "ERROR: Eigenvalues from Sym_Eig_Rnd did not match Sym_Eig! " << w1[i] << " = " << w[i] << endl;
+      return;
+    }
+  }
+
+  cout << "-------- SUCCESS!" << endl;
+}
+
+void Example_GeneralizedEigensystem()
+{
+  using namespace std;
+
+  using namespace IND;
+  using namespace Math;
+  using namespace LAPACK;
+
+  cout << "-------- Generalized Eigensystem Example" << endl;
+
+  using Lyt = ColMajor;
+  using Scalar = Float64;
+
+  uniform_real_distribution< Scalar > dist{ -1.0f, 1.0f };
+  mt19937 gen{};
+
+  const Size n = 60;
+  const Size n2 = n*n;
+
+  cout << "Solving " << n << " x " << n << " random symmetric-definite problem..." << endl;
+
+  Aux_Arena< Scalar > arena{};
+  Aux_Arena< Scalar >::Frame frame{ arena };
+
+  auto * A = arena.Take( n2 );
+  auto * B = arena.Take( n2 );
+  auto * M = arena.Take( n2 );
+  auto * X = arena.Take( n2 );
+  auto * L = arena.Take( n2 );
+  auto * C = arena.Take( n2 );
+  auto * D = arena.Take( n2 );
+  auto * w = arena.Take( n );
+  auto * w1 = arena.Take( n );
+
+  for( Index j = 0; j < (Index)n; ++j )
+  {
+    for( Index i = j; i < (Index)n; ++i )
+    { Lyt::MatRef( A, i, j, n ) = Lyt::MatRef( A, j, i, n ) = dist(gen); }
+  }
+  for( Index i = 0; i < (Index)n2; ++i )
+  { M[i] = dist(gen); }
+
+  // B = (~M)*M + n*I, both halves
+  Sym_RankKUpd< Lyt >( Half::Lower, Trnsp::Yes, n, n, 1.0, M,n, 0.0, B,n );
+  for( Index i = 0; i < (Index)n; ++i )
+  { Lyt::MatRef( B, i, i, n ) += (Scalar)n; }
+  Mat_Copy< Lyt >( Half::Lower, Trnsp::Yes, n,n, B,n, B,n );
+
+  Sym_EigGen< Scalar > GEN{};
+
+  copy( A, A+n2, X );
+  copy( B, B+n2, L );
+  if( ! GEN.Solve< Lyt >( Half::Lower, n, X,n, L,n, w, arena ) )
+  {
+    cout << "ERROR: Sym_EigGen failed on a positive definite B!" << endl;
+    return;
+  }
+
+  const Scalar tol = 1.0e-10f;
+
+  // C = A*X - B*X*w
+  Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, n, n, n, 1.0f, B,n, X,n, 0.0f, D,n );
+  Mat_MatMul< Lyt >( Trnsp::No, Trnsp::No, n, n, n, 1.0f, A,n, X,n, 0.0f, C,n );
+  for( Index j = 0; j < (Index)n; ++j )
+  {
+    for( Index i = 0; i < (Index)n; ++i )
+    { Lyt::MatRef( C, i, j, n ) -= w[j]*Lyt::MatRef( D, i, j, n ); }
+  }
+
+  for( Index i = 0; i < (Index)n2; ++i )
+  {
+    if( ! IsWithinBound( C[i], tol ) )
+    {
+      cout << "ERROR: Sym_EigGen eigenpairs do not solve A*x = lambda*B*x! " << C[i] << endl;
+      return;
+    }
+  }
+
+  // C = (~X)*B*X == I
+  Mat_MatMul< Lyt >( Trnsp::Yes, Trnsp::No, n, n, n, 1.0f, X,n, D,n, 0.0f, C,n );
+  for( Index j = 0; j < (Index)n; ++j )
+  {
+    for( Index i = 0; i < (Index)n; ++i )
+    {
+      const Scalar eij = ( i == j )? 1.0f : 0.0f;
+      if( ! IsWithinBound( Lyt::MatRef( C, i, j, n ) - eij, tol ) )
+      {
+        cout << "ERROR: Sym_EigGen eigenvectors are not B-orthonormal!" << endl;
+        return;
+      }
+    }
+  }
+
+  // The same eigenvalues from the kept factor of B
+  copy( A, A+n2, X );
+  if( ! GEN.Factor< Lyt >( Half::Lower, n, B,n ) || ! GEN.Solve( X,n, w1, arena ) )
+  {
+    cout << "ERROR: Sym_EigGen failed with the kept factor of B!" << endl;
+    return;
+  }
+
+  for( Index i = 0; i < (Index)n; ++i )
+  {
+    if( ! IsWithinBound( w1[i] - w[i], tol ) )
+    {
+      cout << "ERROR: Sym_EigGen with the kept factor did not match! " << w1[i] << " = " << w[i] << endl;
+      return;
+    }
+  }
+
+  // A B that is not positive definite must be reported at its minor
+  const Index k = (Index)n/2;
+  copy( A, A+n2, X );
+  copy( B, B+n2, L );
+  Lyt::MatRef( L, k, k, n ) = -1.0f;
+
+  const auto failed = GEN.Solve< Lyt >( Half::Lower, n, X,n, L,n, w, arena );
+  if( failed || ( failed.i != k ) )
+  {
+    cout << "ERROR: Sym_EigGen did not report an indefinite B! " << failed.i << endl;
+    return;
+  }
+
+  cout << "-------- SUCCESS!" << endl;
+}
+
+void Example_EigensystemPipe()
+{
+  using namespace std;
+
+  using namespace IND;
+  using namespace Math;
+  using namespace LAPACK;
+
+  cout << "-------- Eigensystem Pipe Example" << endl;
+
+  using Lyt = ColMajor;
+  using Scalar = Float64;
+
+  uniform_real_distribution< Scalar > dist{ -1.0f, 1.0f };
+  mt19937 gen{};
+
+  const Size n = 40;
+  const Size n2 = n*n;
+  const Size count = 6;
+
+  cout << "Solving " << count << " random symmetric problems of order " << n << " in a pipeline..." << endl;
+
+  Aux_Arena< Scalar > arena{};
+  Aux_Arena< Scalar >::Frame frame{ arena };
+
+  auto * A = arena.Take( count*n2 );
+  auto * w = arena.Take( count*n );
+  auto * S = arena.Take( n2 );
+  auto * d = arena.Take( n );
+
+  for( Index i = 0; i < (Index)(count*n2); ++i )
+  { A[i] = dist(gen); }
+
+  atomic< Size > calls{ 0 };
+  atomic< Size > failures{ 0 };
+  auto Done = [&]( bool success )
+  {
+    ++calls;
+    if( ! success ){ ++failures; }
+  };
+
+  {
+    Sym_EigPipe< Scalar > pipe{};
+    vector< future< bool > > results;
+    for( Size b = 0; b < count; ++b )
+    { results.push_back( pipe.Submit( Half::Lower, n, A + b*n2, n, w + b*n, Done ) ); }
+
+    for( auto &result : results )
+    {
+      if( ! result.get() )
+      {
+        cout << "ERROR: Sym_EigPipe failed to converge!" << endl;
+        return;
+      }
+    }
+  }
+
+  if( ( count != calls ) || ( 0 != failures ) )
+  {
+    cout << "ERROR: Sym_EigPipe did not call back once per matrix! " << calls << endl;
+    return;
+  }
+
+  // The same eigenvalues as Sym_Eig, on the same matrices regenerated
+  const Scalar tol = 1.0e-12f;
+
+  Sym_Eig< Scalar > VE{};
+  gen.seed( mt19937::default_seed );
+  for( Size b = 0; b < count; ++b )
+  {
+    for( Index i = 0; i < (Index)n2; ++i )
+    { S[i] = dist(gen); }
+
+    if( ! VE.Solve< Lyt >( Half::Lower, n, S,n, d, arena ) )
+    {
+      cout << "ERROR: Sym_Eig failed to converge!" << endl;
+      return;
+    }
+
+    for( Index i = 0; i < (Index)n; ++i )
+    {
+      if( ! IsWithinBound( w[b*n + i] - d[i], tol ) )
+      {
+        cout << "ERROR: Eigenvalues from Sym_EigPipe did not match Sym_Eig! " << w[b*n + i] << " = " << d[i] << endl;
+        return;
+      }
+    }
+  }
+
+  // A panel too wide to allocate workspace for makes the reduction
+  // throw: the future must hold the exception, and the callback still
+  // be called, with false
+  calls = 0;
+  failures = 0;
+
+  Sym_EigPipe< Scalar >::Config config{};
+  config.nb = (Size)1 << 60;
+  {
+    Sym_EigPipe< Scalar > pipe{ config };
+    auto result = pipe.Submit( Half::Lower, n, A,n, w, Done );
+
+    bool threw = false;
+    try { result.get(); }
+    catch( ... ){ threw = true; }
+
+    if( ! threw )
+    {
+      cout << "ERROR: Sym_EigPipe did not pass on the exception of a stage!" << endl;
+      return;
+    }
+  }
+
+  if( ( 1 != calls ) || ( 1 != failures ) )
+  {
+    cout << "ERROR: Sym_EigPipe did not call back a matrix whose stage threw!" << endl;
+    return;
+  }
+
   cout << "-------- SUCCESS!" << endl;
 }